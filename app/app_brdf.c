@@ -0,0 +1,242 @@
+/*
+File:   app_brdf.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the CPU reference BRDF, the DFG LUT generation and ValidateBrdfReference (see app_brdf.h)
+	** Every formula here has a twin in pbr_shader.glsl, keep them in sync.
+*/
+
+// +--------------------------------------------------------------+
+// |                        BRDF Terms                            |
+// +--------------------------------------------------------------+
+static inline r32 GetBrdfAlpha(r32 perceptualRoughness)
+{
+	r32 clamped = ClampR32(perceptualRoughness, BRDF_MIN_ROUGHNESS, 1.0f);
+	return clamped * clamped;
+}
+
+// GGX / Trowbridge-Reitz normal distribution, integrates to 1 over the hemisphere when weighted by NdotH
+r32 BrdfDistributionGgx(r32 normalDotHalf, r32 alpha)
+{
+	r32 alphaSquared = alpha * alpha;
+	r32 denominator = (normalDotHalf * alphaSquared - normalDotHalf) * normalDotHalf + 1.0f;
+	return alphaSquared / (Pi32 * denominator * denominator);
+}
+
+// Height-correlated Smith-GGX visibility, G / (4 * NdotV * NdotL) already folded in (Heitz 2014)
+r32 BrdfVisibilitySmithGgxCorrelated(r32 normalDotView, r32 normalDotLight, r32 alpha)
+{
+	r32 alphaSquared = alpha * alpha;
+	r32 lambdaView = normalDotLight * SqrtR32(normalDotView * normalDotView * (1.0f - alphaSquared) + alphaSquared);
+	r32 lambdaLight = normalDotView * SqrtR32(normalDotLight * normalDotLight * (1.0f - alphaSquared) + alphaSquared);
+	return 0.5f / (lambdaView + lambdaLight);
+}
+
+// The square root free approximation of the above that the shader uses (Hammon 2017)
+r32 BrdfVisibilitySmithGgxCorrelatedFast(r32 normalDotView, r32 normalDotLight, r32 alpha)
+{
+	r32 lambdaView = normalDotLight * (normalDotView * (1.0f - alpha) + alpha);
+	r32 lambdaLight = normalDotView * (normalDotLight * (1.0f - alpha) + alpha);
+	return 0.5f / (lambdaView + lambdaLight);
+}
+
+// Schlick with f90 = 1, returned as the weight of f0 (1-Fc) and the constant part (Fc) so callers can apply it per channel
+static inline r32 BrdfSchlickWeight(r32 viewDotHalf)
+{
+	r32 oneMinus = 1.0f - ClampR32(viewDotHalf, 0.0f, 1.0f);
+	r32 oneMinusSquared = oneMinus * oneMinus;
+	return oneMinusSquared * oneMinusSquared * oneMinus;
+}
+r32 BrdfFresnelSchlick(r32 viewDotHalf, r32 f0)
+{
+	r32 fresnelWeight = BrdfSchlickWeight(viewDotHalf);
+	return fresnelWeight + f0 * (1.0f - fresnelWeight);
+}
+
+static inline r32 GetBrdfF0(const BrdfSurface* surface, uxx channel)
+{
+	r32 baseColor = (channel == 0) ? surface->baseColor.X : ((channel == 1) ? surface->baseColor.Y : surface->baseColor.Z);
+	return LerpR32(BRDF_DIELECTRIC_F0, baseColor, surface->metallic);
+}
+
+// +--------------------------------------------------------------+
+// |                          DFG LUT                             |
+// +--------------------------------------------------------------+
+static inline r32 GetHammersleyRadicalInverse(u32 bits)
+{
+	bits = (bits << 16) | (bits >> 16);
+	bits = ((bits & 0x55555555u) << 1) | ((bits & 0xAAAAAAAAu) >> 1);
+	bits = ((bits & 0x33333333u) << 2) | ((bits & 0xCCCCCCCCu) >> 2);
+	bits = ((bits & 0x0F0F0F0Fu) << 4) | ((bits & 0xF0F0F0F0u) >> 4);
+	bits = ((bits & 0x00FF00FFu) << 8) | ((bits & 0xFF00FF00u) >> 8);
+	return (r32)bits * 2.3283064365386963e-10f; //divided by 2^32
+}
+
+// Integrates the split-sum environment BRDF for the view direction at normalDotView (normal = +Z) by importance sampling GGX
+BrdfDfg IntegrateBrdfDfg(r32 normalDotView, r32 perceptualRoughness, uxx numSamples)
+{
+	r32 alpha = GetBrdfAlpha(perceptualRoughness);
+	normalDotView = ClampR32(normalDotView, 1e-4f, 1.0f);
+	v3 viewDir = NewV3(SqrtR32(1.0f - normalDotView * normalDotView), 0.0f, normalDotView);
+	BrdfDfg result = ZEROED;
+	for (uxx sIndex = 0; sIndex < numSamples; sIndex++)
+	{
+		r32 sampleU = (r32)sIndex / (r32)numSamples;
+		r32 sampleV = GetHammersleyRadicalInverse((u32)sIndex);
+		r32 phi = TwoPi32 * sampleU;
+		r32 cosTheta = SqrtR32((1.0f - sampleV) / (1.0f + (alpha * alpha - 1.0f) * sampleV));
+		r32 sinTheta = SqrtR32(1.0f - cosTheta * cosTheta);
+		v3 halfVec = NewV3(sinTheta * CosR32(phi), sinTheta * SinR32(phi), cosTheta);
+		r32 viewDotHalf = Dot(viewDir, halfVec);
+		v3 lightDir = Sub(Mul(halfVec, 2.0f * viewDotHalf), viewDir);
+		r32 normalDotLight = lightDir.Z;
+		r32 normalDotHalf = halfVec.Z;
+		if (normalDotLight <= 0.0f || viewDotHalf <= 0.0f) { continue; }
+		//pdf = D * NdotH / (4 * VdotH), so D cancels out of (D * V * NdotL) / pdf
+		r32 visibility = BrdfVisibilitySmithGgxCorrelated(normalDotView, normalDotLight, alpha);
+		r32 weight = visibility * 4.0f * normalDotLight * viewDotHalf / normalDotHalf;
+		r32 fresnelWeight = BrdfSchlickWeight(viewDotHalf);
+		result.scale += (1.0f - fresnelWeight) * weight;
+		result.bias += fresnelWeight * weight;
+	}
+	result.scale /= (r32)numSamples;
+	result.bias /= (r32)numSamples;
+	return result;
+}
+
+// RGBA8 pixels for the DFG LUT texture, scale in R and bias in G. NdotV and roughness are sampled at texel centers
+u32* GenerateBrdfDfgLut(Arena* arena, uxx size, uxx numSamples)
+{
+	NotNull(arena);
+	Assert(size > 0);
+	u32* result = AllocArray(u32, arena, size * size);
+	NotNull(result);
+	for (uxx yIndex = 0; yIndex < size; yIndex++)
+	{
+		r32 perceptualRoughness = ((r32)yIndex + 0.5f) / (r32)size;
+		for (uxx xIndex = 0; xIndex < size; xIndex++)
+		{
+			r32 normalDotView = ((r32)xIndex + 0.5f) / (r32)size;
+			BrdfDfg dfg = IntegrateBrdfDfg(normalDotView, perceptualRoughness, numSamples);
+			u32 scaleByte = (u32)RoundR32i(ClampR32(dfg.scale, 0.0f, 1.0f) * 255.0f);
+			u32 biasByte = (u32)RoundR32i(ClampR32(dfg.bias, 0.0f, 1.0f) * 255.0f);
+			result[yIndex * size + xIndex] = scaleByte | (biasByte << 8) | 0xFF000000u; //bytes are R, G, B, A
+		}
+	}
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                      Full Evaluation                         |
+// +--------------------------------------------------------------+
+// (Fd + Fr) * NdotL for one light direction, the part of the shader between sampling the textures and
+// multiplying by the light's intensity. multiScatterDfg (scale + bias at this NdotV) drives the energy
+// compensation, pass 1 to leave it out
+v3 EvaluateBrdf(const BrdfSurface* surface, v3 normal, v3 viewDir, v3 lightDir, r32 multiScatterDfg)
+{
+	NotNull(surface);
+	v3 halfVec = Normalize(Add(viewDir, lightDir));
+	r32 normalDotView = MaxR32(Dot(normal, viewDir), 1e-4f);
+	r32 normalDotLight = ClampR32(Dot(normal, lightDir), 0.0f, 1.0f);
+	r32 normalDotHalf = ClampR32(Dot(normal, halfVec), 0.0f, 1.0f);
+	r32 lightDotHalf = ClampR32(Dot(lightDir, halfVec), 0.0f, 1.0f);
+	if (normalDotLight <= 0.0f) { return V3_Zero; }
+	r32 alpha = GetBrdfAlpha(surface->perceptualRoughness);
+	r32 distribution = BrdfDistributionGgx(normalDotHalf, alpha);
+	r32 visibility = BrdfVisibilitySmithGgxCorrelatedFast(normalDotView, normalDotLight, alpha);
+	r32 result[3];
+	for (uxx cIndex = 0; cIndex < 3; cIndex++)
+	{
+		r32 f0 = GetBrdfF0(surface, cIndex);
+		r32 baseColor = (cIndex == 0) ? surface->baseColor.X : ((cIndex == 1) ? surface->baseColor.Y : surface->baseColor.Z);
+		r32 energyCompensation = 1.0f + f0 * (1.0f / MaxR32(multiScatterDfg, 1e-4f) - 1.0f);
+		r32 specular = distribution * visibility * BrdfFresnelSchlick(lightDotHalf, f0) * energyCompensation;
+		r32 diffuse = (1.0f - surface->metallic) * baseColor / Pi32;
+		result[cIndex] = (diffuse + specular) * normalDotLight;
+	}
+	return NewV3(result[0], result[1], result[2]);
+}
+
+// Smooth inverse square falloff that reaches 0 at radius (Karis 2013), same as GetPointLightAttenuation in the shader
+r32 GetPointLightAttenuation(r32 distance, r32 radius)
+{
+	r32 ratio = distance / radius;
+	r32 window = ClampR32(1.0f - ratio * ratio * ratio * ratio, 0.0f, 1.0f);
+	return (window * window) / (distance * distance + 1.0f);
+}
+
+// +--------------------------------------------------------------+
+// |                         Validation                           |
+// +--------------------------------------------------------------+
+// Directional albedo of the specular lobe with f0 = 1 (so Fresnel is 1) by brute force integration over a
+// theta/phi grid of light directions. This is exactly what scale + bias of the DFG LUT should add up to
+static r32 IntegrateSpecularAlbedoBruteForce(r32 normalDotView, r32 perceptualRoughness, bool fastVisibility, uxx numTheta, uxx numPhi)
+{
+	r32 alpha = GetBrdfAlpha(perceptualRoughness);
+	v3 viewDir = NewV3(SqrtR32(1.0f - normalDotView * normalDotView), 0.0f, normalDotView);
+	r32 thetaStep = HalfPi32 / (r32)numTheta;
+	r32 phiStep = TwoPi32 / (r32)numPhi;
+	r64 result = 0.0; //millions of tiny terms, r32 loses too much
+	for (uxx tIndex = 0; tIndex < numTheta; tIndex++)
+	{
+		r32 theta = ((r32)tIndex + 0.5f) * thetaStep;
+		r32 cosTheta = CosR32(theta);
+		r32 sinTheta = SinR32(theta);
+		for (uxx pIndex = 0; pIndex < numPhi; pIndex++)
+		{
+			r32 phi = ((r32)pIndex + 0.5f) * phiStep;
+			v3 lightDir = NewV3(sinTheta * CosR32(phi), sinTheta * SinR32(phi), cosTheta);
+			v3 halfVec = Normalize(Add(viewDir, lightDir));
+			r32 visibility = fastVisibility
+				? BrdfVisibilitySmithGgxCorrelatedFast(normalDotView, cosTheta, alpha)
+				: BrdfVisibilitySmithGgxCorrelated(normalDotView, cosTheta, alpha);
+			result += (r64)(BrdfDistributionGgx(halfVec.Z, alpha) * visibility * cosTheta * sinTheta * thetaStep * phiStep);
+		}
+	}
+	return (r32)result;
+}
+
+// Checks the CPU reference against numerical integration and prints the worst errors:
+//  1. GGX is normalized: the integral of D(h) * NdotH over the hemisphere is 1
+//  2. The importance sampled DFG (scale + bias) matches the brute force directional albedo
+//  3. How far the fast Smith approximation the shader uses is from the exact one (in directional albedo)
+// Returns false if 1 or 2 are off by more than a couple of percent
+bool ValidateBrdfReference()
+{
+	const r32 roughnessValues[] = { 0.3f, 0.5f, 0.75f, 1.0f };
+	const r32 normalDotViewValues[] = { 0.1f, 0.3f, 0.6f, 0.95f };
+	const uxx numTheta = 2048; //the r=0.3 lobe is narrow, coarser grids undershoot at grazing angles
+	const uxx numPhi = 512;
+	r32 maxNormalizationError = 0.0f;
+	r32 maxDfgError = 0.0f;
+	r32 maxFastVisibilityError = 0.0f;
+	for (uxx rIndex = 0; rIndex < ArrayCount(roughnessValues); rIndex++)
+	{
+		r32 alpha = GetBrdfAlpha(roughnessValues[rIndex]);
+		r32 thetaStep = HalfPi32 / (r32)numTheta;
+		r32 projectedArea = 0.0f;
+		for (uxx tIndex = 0; tIndex < numTheta; tIndex++)
+		{
+			r32 theta = ((r32)tIndex + 0.5f) * thetaStep;
+			projectedArea += BrdfDistributionGgx(CosR32(theta), alpha) * CosR32(theta) * SinR32(theta) * thetaStep * TwoPi32;
+		}
+		maxNormalizationError = MaxR32(maxNormalizationError, AbsR32(projectedArea - 1.0f));
+		
+		for (uxx vIndex = 0; vIndex < ArrayCount(normalDotViewValues); vIndex++)
+		{
+			r32 normalDotView = normalDotViewValues[vIndex];
+			BrdfDfg dfg = IntegrateBrdfDfg(normalDotView, roughnessValues[rIndex], 4096);
+			r32 exactAlbedo = IntegrateSpecularAlbedoBruteForce(normalDotView, roughnessValues[rIndex], false, numTheta, numPhi);
+			r32 fastAlbedo = IntegrateSpecularAlbedoBruteForce(normalDotView, roughnessValues[rIndex], true, numTheta, numPhi);
+			maxDfgError = MaxR32(maxDfgError, AbsR32((dfg.scale + dfg.bias) - exactAlbedo));
+			maxFastVisibilityError = MaxR32(maxFastVisibilityError, AbsR32(fastAlbedo - exactAlbedo));
+		}
+	}
+	bool result = (maxNormalizationError < 0.02f && maxDfgError < 0.02f);
+	PrintLine_I("BRDF reference validation %s:", result ? "passed" : "FAILED");
+	PrintLine_I("\tGGX normalization: max error %.5f", maxNormalizationError);
+	PrintLine_I("\tDFG LUT integral vs brute force: max error %.5f", maxDfgError);
+	PrintLine_I("\tFast vs exact Smith visibility (directional albedo): max difference %.5f", maxFastVisibilityError);
+	return result;
+}
@@ -0,0 +1,50 @@
+/*
+File:   app_brdf.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** CPU reference for the Cook-Torrance BRDF the pbr shader evaluates: GGX distribution,
+	** height-correlated Smith visibility and Schlick Fresnel for specular, Lambert for diffuse.
+	** It also builds the DFG lookup table (the split-sum "environment BRDF" scale and bias for
+	** every NdotV and roughness) that the shader samples for ambient specular and multiple
+	** scattering energy compensation instead of integrating anything per fragment.
+*/
+
+#ifndef _APP_BRDF_H
+#define _APP_BRDF_H
+
+#define BRDF_DFG_LUT_SIZE        32 //texels along both NdotV (x) and perceptual roughness (y)
+#define BRDF_DFG_LUT_SAMPLES     512 //importance samples per texel when building the LUT
+#define BRDF_MIN_ROUGHNESS       0.045f //perceptual, keeps the GGX peak representable in 16/32 bit floats
+#define BRDF_DIELECTRIC_F0       0.04f
+
+// surfaceParams for the pbr shader (x = metallic, y = roughness factor). glTF materials default both factors to 1 and
+// let the metallicRoughness texture decide, draws without a material sample the white pixel texture so they need
+// metallic forced to 0 or they'd render as rough chrome
+#define PBR_MATERIAL_SURFACE_PARAMS   NewV4(1.0f, 1.0f, 0.0f, 0.0f)
+#define PBR_UNTEXTURED_SURFACE_PARAMS NewV4(0.0f, 0.6f, 0.0f, 0.0f)
+
+// Texture bindings of the pbr shader
+#define PBR_TEXTURE_SLOT_ALBEDO             0
+#define PBR_TEXTURE_SLOT_NORMAL             1
+#define PBR_TEXTURE_SLOT_METALLIC_ROUGHNESS 2 //roughness in G, metallic in B
+#define PBR_TEXTURE_SLOT_OCCLUSION          3
+#define PBR_TEXTURE_SLOT_DFG_LUT            4
+
+typedef struct BrdfSurface BrdfSurface;
+struct BrdfSurface
+{
+	v3 baseColor; //linear
+	r32 metallic;
+	r32 perceptualRoughness; //what glTF stores, squared to get the GGX alpha
+};
+
+// Split-sum environment BRDF: specular reflectance = f0 * scale + bias
+typedef struct BrdfDfg BrdfDfg;
+struct BrdfDfg
+{
+	r32 scale;
+	r32 bias;
+};
+
+#endif //  _APP_BRDF_H
@@ -0,0 +1,868 @@
+/*
+File:   app_bvh.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the build, refit and query functions for a Bvh (see app_bvh.h) as well as a
+	** benchmark that compares the queries against the linear scans they replace.
+	** NOTE: The 4-wide node tests reuse the SIMD target detection from app_trs_kernels.h
+	** (AVX targets use the SSE path here since a node is only 4 lanes wide)
+*/
+
+// +--------------------------------------------------------------+
+// |                          SIMD Lanes                          |
+// +--------------------------------------------------------------+
+#if TRS_SIMD_AVX || TRS_SIMD_SSE
+typedef __m128 BvhLane;
+#define BvhLoad(pntr)                 _mm_loadu_ps(pntr)
+#define BvhStore(pntr, lane)          _mm_storeu_ps((pntr), (lane))
+#define BvhSet1(value)                _mm_set1_ps(value)
+#define BvhAdd(left, right)           _mm_add_ps((left), (right))
+#define BvhSub(left, right)           _mm_sub_ps((left), (right))
+#define BvhMul(left, right)           _mm_mul_ps((left), (right))
+#define BvhDiv(left, right)           _mm_div_ps((left), (right))
+#define BvhMin(left, right)           _mm_min_ps((left), (right))
+#define BvhMax(left, right)           _mm_max_ps((left), (right))
+#define BvhMaskLess(left, right)      (u32)_mm_movemask_ps(_mm_cmplt_ps((left), (right)))
+#define BvhMaskLessEqual(left, right) (u32)_mm_movemask_ps(_mm_cmple_ps((left), (right)))
+#elif TRS_SIMD_NEON
+typedef float32x4_t BvhLane;
+static inline u32 BvhNeonMask(uint32x4_t mask)
+{
+	u32 bits[4];
+	vst1q_u32(bits, mask);
+	return (bits[0] & 0x1) | (bits[1] & 0x2) | (bits[2] & 0x4) | (bits[3] & 0x8);
+}
+//vdivq_f32 is AArch64 only, two Newton-Raphson steps on the estimate get within an ulp or two
+static inline float32x4_t BvhNeonDiv(float32x4_t left, float32x4_t right)
+{
+	float32x4_t reciprocal = vrecpeq_f32(right);
+	reciprocal = vmulq_f32(vrecpsq_f32(right, reciprocal), reciprocal);
+	reciprocal = vmulq_f32(vrecpsq_f32(right, reciprocal), reciprocal);
+	return vmulq_f32(left, reciprocal);
+}
+#define BvhLoad(pntr)                 vld1q_f32(pntr)
+#define BvhStore(pntr, lane)          vst1q_f32((pntr), (lane))
+#define BvhSet1(value)                vdupq_n_f32(value)
+#define BvhAdd(left, right)           vaddq_f32((left), (right))
+#define BvhSub(left, right)           vsubq_f32((left), (right))
+#define BvhMul(left, right)           vmulq_f32((left), (right))
+#define BvhDiv(left, right)           BvhNeonDiv((left), (right))
+#define BvhMin(left, right)           vminq_f32((left), (right))
+#define BvhMax(left, right)           vmaxq_f32((left), (right))
+#define BvhMaskLess(left, right)      BvhNeonMask(vcltq_f32((left), (right)))
+#define BvhMaskLessEqual(left, right) BvhNeonMask(vcleq_f32((left), (right)))
+#else
+typedef struct BvhLane BvhLane;
+struct BvhLane { r32 values[BVH_NODE_WIDTH]; };
+static inline BvhLane BvhLoad(const r32* pntr) { BvhLane result; for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { result.values[lane] = pntr[lane]; } return result; }
+static inline void BvhStore(r32* pntr, BvhLane value) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { pntr[lane] = value.values[lane]; } }
+static inline BvhLane BvhSet1(r32 value) { BvhLane result; for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { result.values[lane] = value; } return result; }
+static inline BvhLane BvhAdd(BvhLane left, BvhLane right) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { left.values[lane] += right.values[lane]; } return left; }
+static inline BvhLane BvhSub(BvhLane left, BvhLane right) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { left.values[lane] -= right.values[lane]; } return left; }
+static inline BvhLane BvhMul(BvhLane left, BvhLane right) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { left.values[lane] *= right.values[lane]; } return left; }
+static inline BvhLane BvhDiv(BvhLane left, BvhLane right) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { left.values[lane] /= right.values[lane]; } return left; }
+static inline BvhLane BvhMin(BvhLane left, BvhLane right) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { left.values[lane] = MinR32(left.values[lane], right.values[lane]); } return left; }
+static inline BvhLane BvhMax(BvhLane left, BvhLane right) { for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { left.values[lane] = MaxR32(left.values[lane], right.values[lane]); } return left; }
+static inline u32 BvhMaskLess(BvhLane left, BvhLane right) { u32 result = 0; for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { if (left.values[lane] < right.values[lane]) { result |= (1u << lane); } } return result; }
+static inline u32 BvhMaskLessEqual(BvhLane left, BvhLane right) { u32 result = 0; for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++) { if (left.values[lane] <= right.values[lane]) { result |= (1u << lane); } } return result; }
+#endif
+
+#define BVH_ALL_LANES_MASK ((1u << BVH_NODE_WIDTH) - 1)
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+static inline v3 GetBvhBoxMin(box bounds) { return bounds.BottomLeftBack; }
+static inline v3 GetBvhBoxMax(box bounds) { return Add(bounds.BottomLeftBack, bounds.Size); }
+static inline r32 GetBvhAxis(v3 vector, uxx axis) { return (axis == 0) ? vector.X : ((axis == 1) ? vector.Y : vector.Z); }
+
+// Half the surface area is enough for SAH since only the ratios between areas matter
+static r32 GetBvhHalfArea(v3 min, v3 max)
+{
+	v3 size = Sub(max, min);
+	if (size.X < 0 || size.Y < 0 || size.Z < 0) { return 0.0f; }
+	return size.X*size.Y + size.Y*size.Z + size.Z*size.X;
+}
+
+static void GetBvhItemRangeBounds(const u32* items, const box* itemBounds, uxx firstItem, uxx numItems, v3* minOut, v3* maxOut)
+{
+	v3 min = FillV3(HighestR32);
+	v3 max = FillV3(LowestR32);
+	for (uxx iIndex = firstItem; iIndex < firstItem + numItems; iIndex++)
+	{
+		box bounds = itemBounds[items[iIndex]];
+		v3 boundsMin = GetBvhBoxMin(bounds);
+		v3 boundsMax = GetBvhBoxMax(bounds);
+		min = NewV3(MinR32(min.X, boundsMin.X), MinR32(min.Y, boundsMin.Y), MinR32(min.Z, boundsMin.Z));
+		max = NewV3(MaxR32(max.X, boundsMax.X), MaxR32(max.Y, boundsMax.Y), MaxR32(max.Z, boundsMax.Z));
+	}
+	*minOut = min;
+	*maxOut = max;
+}
+
+static void GetBvhNodeBounds(const BvhNode* node, v3* minOut, v3* maxOut)
+{
+	v3 min = FillV3(HighestR32);
+	v3 max = FillV3(LowestR32);
+	for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+	{
+		if (node->numItems[lane] == 0) { continue; }
+		min = NewV3(MinR32(min.X, node->minX[lane]), MinR32(min.Y, node->minY[lane]), MinR32(min.Z, node->minZ[lane]));
+		max = NewV3(MaxR32(max.X, node->maxX[lane]), MaxR32(max.Y, node->maxY[lane]), MaxR32(max.Z, node->maxZ[lane]));
+	}
+	*minOut = min;
+	*maxOut = max;
+}
+
+static void SetBvhNodeLaneBounds(BvhNode* node, uxx lane, v3 min, v3 max)
+{
+	node->minX[lane] = min.X; node->minY[lane] = min.Y; node->minZ[lane] = min.Z;
+	node->maxX[lane] = max.X; node->maxY[lane] = max.Y; node->maxZ[lane] = max.Z;
+}
+
+static void AddBvhResult(VarArray* resultsOut, u32 item)
+{
+	if (resultsOut == nullptr) { return; }
+	u32* newResult = VarArrayAdd(u32, resultsOut);
+	NotNull(newResult);
+	*newResult = item;
+}
+
+// Rays parallel to an axis get a huge (but finite) inverse so the slab test never multiplies 0 by infinity
+static inline r32 GetBvhInverseDir(r32 direction)
+{
+	if (AbsR32(direction) < 1e-20f) { return (direction >= 0.0f) ? 1e30f : -1e30f; }
+	return 1.0f / direction;
+}
+
+// +--------------------------------------------------------------+
+// |                        Init and Free                         |
+// +--------------------------------------------------------------+
+void FreeBvh(Bvh* bvh)
+{
+	NotNull(bvh);
+	if (bvh->arena != nullptr)
+	{
+		if (bvh->items != nullptr) { FreeMem(bvh->arena, bvh->items, sizeof(u32) * bvh->allocItems); }
+		FreeVarArray(&bvh->nodes);
+	}
+	ClearPointer(bvh);
+}
+
+void InitBvh(Arena* arena, uxx expectedNumItems, Bvh* bvhOut)
+{
+	NotNull(arena);
+	NotNull(bvhOut);
+	ClearPointer(bvhOut);
+	bvhOut->arena = arena;
+	InitVarArrayWithInitial(BvhNode, &bvhOut->nodes, arena, (expectedNumItems / 2) + 1);
+	if (expectedNumItems > 0)
+	{
+		bvhOut->allocItems = expectedNumItems;
+		bvhOut->items = AllocArray(u32, arena, expectedNumItems);
+		NotNull(bvhOut->items);
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                            Build                             |
+// +--------------------------------------------------------------+
+typedef struct BvhBuildContext BvhBuildContext;
+struct BvhBuildContext
+{
+	Bvh* bvh;
+	const box* itemBounds;
+	v3* centroids; //indexed by item, not by position in bvh->items
+};
+
+static u32 AddBvhNode(Bvh* bvh)
+{
+	BvhNode* newNode = VarArrayAdd(BvhNode, &bvh->nodes);
+	NotNull(newNode);
+	ClearPointer(newNode);
+	return (u32)(bvh->nodes.length - 1);
+}
+
+// Partitions items[first, first+count) in place with a binned SAH split along the
+// axis with the largest centroid extent and returns the index of the first right-side item
+static uxx SplitBvhRange(BvhBuildContext* context, uxx first, uxx count)
+{
+	u32* items = context->bvh->items;
+	uxx midpoint = first + count/2;
+	
+	v3 centroidMin = FillV3(HighestR32);
+	v3 centroidMax = FillV3(LowestR32);
+	for (uxx iIndex = first; iIndex < first + count; iIndex++)
+	{
+		v3 centroid = context->centroids[items[iIndex]];
+		centroidMin = NewV3(MinR32(centroidMin.X, centroid.X), MinR32(centroidMin.Y, centroid.Y), MinR32(centroidMin.Z, centroid.Z));
+		centroidMax = NewV3(MaxR32(centroidMax.X, centroid.X), MaxR32(centroidMax.Y, centroid.Y), MaxR32(centroidMax.Z, centroid.Z));
+	}
+	v3 centroidExtent = Sub(centroidMax, centroidMin);
+	uxx axis = (centroidExtent.X >= centroidExtent.Y && centroidExtent.X >= centroidExtent.Z) ? 0 : ((centroidExtent.Y >= centroidExtent.Z) ? 1 : 2);
+	r32 axisMin = GetBvhAxis(centroidMin, axis);
+	r32 axisExtent = GetBvhAxis(centroidExtent, axis);
+	if (axisExtent <= 1e-6f) { return midpoint; } //All centroids are on top of each other, no split is better than any other
+	
+	uxx binCounts[BVH_NUM_SAH_BINS];
+	v3 binMins[BVH_NUM_SAH_BINS];
+	v3 binMaxs[BVH_NUM_SAH_BINS];
+	for (uxx bIndex = 0; bIndex < BVH_NUM_SAH_BINS; bIndex++)
+	{
+		binCounts[bIndex] = 0;
+		binMins[bIndex] = FillV3(HighestR32);
+		binMaxs[bIndex] = FillV3(LowestR32);
+	}
+	r32 binScale = ((r32)BVH_NUM_SAH_BINS * 0.9999f) / axisExtent;
+	for (uxx iIndex = first; iIndex < first + count; iIndex++)
+	{
+		u32 item = items[iIndex];
+		uxx bIndex = (uxx)((GetBvhAxis(context->centroids[item], axis) - axisMin) * binScale);
+		if (bIndex >= BVH_NUM_SAH_BINS) { bIndex = BVH_NUM_SAH_BINS-1; }
+		v3 itemMin = GetBvhBoxMin(context->itemBounds[item]);
+		v3 itemMax = GetBvhBoxMax(context->itemBounds[item]);
+		binCounts[bIndex]++;
+		binMins[bIndex] = NewV3(MinR32(binMins[bIndex].X, itemMin.X), MinR32(binMins[bIndex].Y, itemMin.Y), MinR32(binMins[bIndex].Z, itemMin.Z));
+		binMaxs[bIndex] = NewV3(MaxR32(binMaxs[bIndex].X, itemMax.X), MaxR32(binMaxs[bIndex].Y, itemMax.Y), MaxR32(binMaxs[bIndex].Z, itemMax.Z));
+	}
+	
+	//rightCosts[b] and rightCounts[b] describe the bins [b, BVH_NUM_SAH_BINS)
+	r32 rightCosts[BVH_NUM_SAH_BINS];
+	uxx rightCounts[BVH_NUM_SAH_BINS];
+	v3 sweepMin = FillV3(HighestR32);
+	v3 sweepMax = FillV3(LowestR32);
+	uxx sweepCount = 0;
+	for (uxx bIndex = BVH_NUM_SAH_BINS-1; bIndex > 0; bIndex--)
+	{
+		sweepCount += binCounts[bIndex];
+		sweepMin = NewV3(MinR32(sweepMin.X, binMins[bIndex].X), MinR32(sweepMin.Y, binMins[bIndex].Y), MinR32(sweepMin.Z, binMins[bIndex].Z));
+		sweepMax = NewV3(MaxR32(sweepMax.X, binMaxs[bIndex].X), MaxR32(sweepMax.Y, binMaxs[bIndex].Y), MaxR32(sweepMax.Z, binMaxs[bIndex].Z));
+		rightCounts[bIndex] = sweepCount;
+		rightCosts[bIndex] = GetBvhHalfArea(sweepMin, sweepMax) * (r32)sweepCount;
+	}
+	
+	uxx bestSplitBin = 0;
+	r32 bestCost = HighestR32;
+	sweepMin = FillV3(HighestR32);
+	sweepMax = FillV3(LowestR32);
+	sweepCount = 0;
+	for (uxx bIndex = 1; bIndex < BVH_NUM_SAH_BINS; bIndex++)
+	{
+		sweepCount += binCounts[bIndex-1];
+		sweepMin = NewV3(MinR32(sweepMin.X, binMins[bIndex-1].X), MinR32(sweepMin.Y, binMins[bIndex-1].Y), MinR32(sweepMin.Z, binMins[bIndex-1].Z));
+		sweepMax = NewV3(MaxR32(sweepMax.X, binMaxs[bIndex-1].X), MaxR32(sweepMax.Y, binMaxs[bIndex-1].Y), MaxR32(sweepMax.Z, binMaxs[bIndex-1].Z));
+		if (sweepCount == 0 || rightCounts[bIndex] == 0) { continue; }
+		r32 cost = GetBvhHalfArea(sweepMin, sweepMax) * (r32)sweepCount + rightCosts[bIndex];
+		if (cost < bestCost) { bestCost = cost; bestSplitBin = bIndex; }
+	}
+	if (bestSplitBin == 0) { return midpoint; }
+	
+	uxx leftIndex = first;
+	uxx rightIndex = first + count;
+	while (leftIndex < rightIndex)
+	{
+		uxx bIndex = (uxx)((GetBvhAxis(context->centroids[items[leftIndex]], axis) - axisMin) * binScale);
+		if (bIndex < bestSplitBin) { leftIndex++; }
+		else
+		{
+			rightIndex--;
+			u32 temp = items[leftIndex];
+			items[leftIndex] = items[rightIndex];
+			items[rightIndex] = temp;
+		}
+	}
+	if (leftIndex == first || leftIndex == first + count) { return midpoint; }
+	return leftIndex;
+}
+
+// Splits the range up to twice (binary SAH splits of the largest piece) to fill the 4 lanes of the node
+static void BuildBvhNode(BvhBuildContext* context, u32 nodeIndex, uxx first, uxx count)
+{
+	uxx laneFirsts[BVH_NODE_WIDTH];
+	uxx laneCounts[BVH_NODE_WIDTH];
+	uxx numLanes = 1;
+	laneFirsts[0] = first;
+	laneCounts[0] = count;
+	while (numLanes < BVH_NODE_WIDTH)
+	{
+		uxx largestLane = numLanes;
+		for (uxx lane = 0; lane < numLanes; lane++)
+		{
+			if (laneCounts[lane] > BVH_MAX_LEAF_ITEMS && (largestLane == numLanes || laneCounts[lane] > laneCounts[largestLane])) { largestLane = lane; }
+		}
+		if (largestLane == numLanes) { break; }
+		uxx splitIndex = SplitBvhRange(context, laneFirsts[largestLane], laneCounts[largestLane]);
+		laneFirsts[numLanes] = splitIndex;
+		laneCounts[numLanes] = (laneFirsts[largestLane] + laneCounts[largestLane]) - splitIndex;
+		laneCounts[largestLane] = splitIndex - laneFirsts[largestLane];
+		numLanes++;
+	}
+	
+	for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+	{
+		//Re-fetched every lane since recursing adds nodes, which can move the array
+		BvhNode* node = VarArrayGetHard(BvhNode, &context->bvh->nodes, nodeIndex);
+		if (lane >= numLanes)
+		{
+			SetBvhNodeLaneBounds(node, lane, FillV3(HighestR32), FillV3(LowestR32));
+			node->children[lane] = BVH_CHILD_LEAF;
+			node->firstItem[lane] = 0;
+			node->numItems[lane] = 0;
+			continue;
+		}
+		
+		v3 laneMin, laneMax;
+		GetBvhItemRangeBounds(context->bvh->items, context->itemBounds, laneFirsts[lane], laneCounts[lane], &laneMin, &laneMax);
+		SetBvhNodeLaneBounds(node, lane, laneMin, laneMax);
+		node->firstItem[lane] = (u32)laneFirsts[lane];
+		node->numItems[lane] = (u32)laneCounts[lane];
+		node->children[lane] = BVH_CHILD_LEAF;
+		if (laneCounts[lane] > BVH_MAX_LEAF_ITEMS)
+		{
+			u32 childIndex = AddBvhNode(context->bvh);
+			node = VarArrayGetHard(BvhNode, &context->bvh->nodes, nodeIndex);
+			node->children[lane] = childIndex;
+			BuildBvhNode(context, childIndex, laneFirsts[lane], laneCounts[lane]);
+		}
+	}
+}
+
+// Cost of a ray that hits the root box, in units of one node (or item) test
+static r32 CalcBvhSahCost(const Bvh* bvh)
+{
+	if (bvh->nodes.length == 0) { return 0.0f; }
+	const BvhNode* nodes = (const BvhNode*)bvh->nodes.items;
+	v3 rootMin, rootMax;
+	GetBvhNodeBounds(&nodes[0], &rootMin, &rootMax);
+	r32 rootArea = GetBvhHalfArea(rootMin, rootMax);
+	if (rootArea <= 0.0f) { return 0.0f; }
+	r32 cost = 0.0f;
+	for (uxx nIndex = 0; nIndex < bvh->nodes.length; nIndex++)
+	{
+		const BvhNode* node = &nodes[nIndex];
+		for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+		{
+			if (node->numItems[lane] == 0) { continue; }
+			r32 laneArea = GetBvhHalfArea(
+				NewV3(node->minX[lane], node->minY[lane], node->minZ[lane]),
+				NewV3(node->maxX[lane], node->maxY[lane], node->maxZ[lane])
+			);
+			cost += laneArea * ((node->children[lane] == BVH_CHILD_LEAF) ? (r32)node->numItems[lane] : 1.0f);
+		}
+	}
+	return 1.0f + (cost / rootArea);
+}
+
+void BuildBvh(Bvh* bvh, const box* itemBounds, uxx numItems)
+{
+	NotNull(bvh);
+	NotNull(bvh->arena);
+	Assert(itemBounds != nullptr || numItems == 0);
+	Assert(numItems < BVH_ITEM_INVALID);
+	if (numItems > bvh->allocItems)
+	{
+		if (bvh->items != nullptr) { FreeMem(bvh->arena, bvh->items, sizeof(u32) * bvh->allocItems); }
+		bvh->allocItems = (numItems > bvh->allocItems*2) ? numItems : bvh->allocItems*2;
+		bvh->items = AllocArray(u32, bvh->arena, bvh->allocItems);
+		NotNull(bvh->items);
+	}
+	bvh->numItems = numItems;
+	bvh->numRefitsSinceBuild = 0;
+	VarArrayClear(&bvh->nodes);
+	if (numItems == 0)
+	{
+		bvh->buildSahCost = 0.0f;
+		bvh->sahCost = 0.0f;
+		return;
+	}
+	
+	ScratchBegin(scratch);
+	BvhBuildContext context = ZEROED;
+	context.bvh = bvh;
+	context.itemBounds = itemBounds;
+	context.centroids = AllocArray(v3, scratch, numItems);
+	NotNull(context.centroids);
+	for (uxx iIndex = 0; iIndex < numItems; iIndex++)
+	{
+		bvh->items[iIndex] = (u32)iIndex;
+		context.centroids[iIndex] = Add(itemBounds[iIndex].BottomLeftBack, Mul(itemBounds[iIndex].Size, 0.5f));
+	}
+	u32 rootIndex = AddBvhNode(bvh);
+	Assert(rootIndex == 0);
+	BuildBvhNode(&context, rootIndex, 0, numItems);
+	ScratchEnd(scratch);
+	
+	bvh->buildSahCost = CalcBvhSahCost(bvh);
+	bvh->sahCost = bvh->buildSahCost;
+}
+
+// +--------------------------------------------------------------+
+// |                            Refit                             |
+// +--------------------------------------------------------------+
+// Recomputes every node's bounds from itemBounds without changing the topology. Children always
+// come after their parent so walking the nodes backwards visits children first.
+// Returns true when the tree has degraded enough (see BVH_REFIT_REBUILD_RATIO) that it should be rebuilt
+bool RefitBvh(Bvh* bvh, const box* itemBounds)
+{
+	NotNull(bvh);
+	if (bvh->nodes.length == 0) { return false; }
+	NotNull(itemBounds);
+	BvhNode* nodes = (BvhNode*)bvh->nodes.items;
+	for (uxx nIndex = bvh->nodes.length; nIndex > 0; nIndex--)
+	{
+		BvhNode* node = &nodes[nIndex-1];
+		for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+		{
+			if (node->numItems[lane] == 0) { continue; }
+			v3 laneMin, laneMax;
+			if (node->children[lane] == BVH_CHILD_LEAF) { GetBvhItemRangeBounds(bvh->items, itemBounds, node->firstItem[lane], node->numItems[lane], &laneMin, &laneMax); }
+			else { GetBvhNodeBounds(&nodes[node->children[lane]], &laneMin, &laneMax); }
+			SetBvhNodeLaneBounds(node, lane, laneMin, laneMax);
+		}
+	}
+	bvh->numRefitsSinceBuild++;
+	bvh->sahCost = CalcBvhSahCost(bvh);
+	return (bvh->sahCost > bvh->buildSahCost * BVH_REFIT_REBUILD_RATIO);
+}
+
+// +--------------------------------------------------------------+
+// |                        Frustum Query                         |
+// +--------------------------------------------------------------+
+// Extracts the 6 clip planes from a projection*view matrix (Gribb/Hartmann). mat4 is column-major so row r is Elements[0..3][r].
+// depthZeroToOne should match the projection, MakePerspectiveMat4Dx maps depth to [0, 1] and MakePerspectiveMat4Gl to [-1, 1]
+BvhFrustum GetBvhFrustumFromMat4(mat4 viewProjMat, bool depthZeroToOne)
+{
+	BvhFrustum result = ZEROED;
+	const uxx planeRows[6] = { 0, 0, 1, 1, 2, 2 }; //left, right, bottom, top, near, far
+	const r32 planeSigns[6] = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+	for (uxx pIndex = 0; pIndex < 6; pIndex++)
+	{
+		uxx row = planeRows[pIndex];
+		r32 sign = planeSigns[pIndex];
+		r32 wScale = (pIndex == 4 && depthZeroToOne) ? 0.0f : 1.0f;
+		v3 normal = NewV3(
+			wScale*viewProjMat.Elements[0][3] + sign*viewProjMat.Elements[0][row],
+			wScale*viewProjMat.Elements[1][3] + sign*viewProjMat.Elements[1][row],
+			wScale*viewProjMat.Elements[2][3] + sign*viewProjMat.Elements[2][row]
+		);
+		r32 distance = wScale*viewProjMat.Elements[3][3] + sign*viewProjMat.Elements[3][row];
+		r32 normalLength = Length(normal);
+		if (normalLength > 0.0f) { normal = Mul(normal, 1.0f / normalLength); distance /= normalLength; }
+		result.planes[pIndex] = NewV4(normal.X, normal.Y, normal.Z, distance);
+	}
+	return result;
+}
+
+bool IsBoxInBvhFrustum(const BvhFrustum* frustum, box bounds)
+{
+	v3 boundsMin = GetBvhBoxMin(bounds);
+	v3 boundsMax = GetBvhBoxMax(bounds);
+	for (uxx pIndex = 0; pIndex < 6; pIndex++)
+	{
+		v4 plane = frustum->planes[pIndex];
+		v3 farCorner = NewV3(
+			(plane.X >= 0.0f) ? boundsMax.X : boundsMin.X,
+			(plane.Y >= 0.0f) ? boundsMax.Y : boundsMin.Y,
+			(plane.Z >= 0.0f) ? boundsMax.Z : boundsMin.Z
+		);
+		if (plane.X*farCorner.X + plane.Y*farCorner.Y + plane.Z*farCorner.Z + plane.W < 0.0f) { return false; }
+	}
+	return true;
+}
+
+// Returns the mask of lanes that are at least partially inside. The corner furthest along
+// each plane normal decides whether a lane is outside and the nearest corner whether it is fully inside
+static u32 TestBvhNodeFrustum(const BvhNode* node, const BvhFrustum* frustum, u32* fullyInsideMaskOut)
+{
+	BvhLane zero = BvhSet1(0.0f);
+	u32 outsideMask = 0;
+	u32 intersectingMask = 0;
+	for (uxx pIndex = 0; pIndex < 6; pIndex++)
+	{
+		v4 plane = frustum->planes[pIndex];
+		BvhLane normalX = BvhSet1(plane.X);
+		BvhLane normalY = BvhSet1(plane.Y);
+		BvhLane normalZ = BvhSet1(plane.Z);
+		BvhLane distance = BvhSet1(plane.W);
+		BvhLane farX = BvhLoad((plane.X >= 0.0f) ? node->maxX : node->minX);
+		BvhLane farY = BvhLoad((plane.Y >= 0.0f) ? node->maxY : node->minY);
+		BvhLane farZ = BvhLoad((plane.Z >= 0.0f) ? node->maxZ : node->minZ);
+		BvhLane nearX = BvhLoad((plane.X >= 0.0f) ? node->minX : node->maxX);
+		BvhLane nearY = BvhLoad((plane.Y >= 0.0f) ? node->minY : node->maxY);
+		BvhLane nearZ = BvhLoad((plane.Z >= 0.0f) ? node->minZ : node->maxZ);
+		BvhLane farDistance = BvhAdd(BvhAdd(BvhMul(normalX, farX), BvhMul(normalY, farY)), BvhAdd(BvhMul(normalZ, farZ), distance));
+		BvhLane nearDistance = BvhAdd(BvhAdd(BvhMul(normalX, nearX), BvhMul(normalY, nearY)), BvhAdd(BvhMul(normalZ, nearZ), distance));
+		outsideMask |= BvhMaskLess(farDistance, zero);
+		intersectingMask |= BvhMaskLess(nearDistance, zero);
+	}
+	*fullyInsideMaskOut = ~(outsideMask | intersectingMask) & BVH_ALL_LANES_MASK;
+	return ~outsideMask & BVH_ALL_LANES_MASK;
+}
+
+// Adds the item index of everything that overlaps the frustum to resultsOut (which can be nullptr to only count them)
+uxx QueryBvhFrustum(const Bvh* bvh, const box* itemBounds, const BvhFrustum* frustum, VarArray* resultsOut)
+{
+	NotNull(bvh);
+	NotNull(frustum);
+	if (bvh->nodes.length == 0) { return 0; }
+	const BvhNode* nodes = (const BvhNode*)bvh->nodes.items;
+	uxx numResults = 0;
+	u32 stack[BVH_MAX_STACK_SIZE];
+	uxx stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const BvhNode* node = &nodes[stack[--stackSize]];
+		u32 fullyInsideMask = 0;
+		u32 overlapMask = TestBvhNodeFrustum(node, frustum, &fullyInsideMask);
+		for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+		{
+			if (node->numItems[lane] == 0 || (overlapMask & (1u << lane)) == 0) { continue; }
+			u32 firstItem = node->firstItem[lane];
+			u32 numItems = node->numItems[lane];
+			if ((fullyInsideMask & (1u << lane)) != 0)
+			{
+				//The whole subtree is inside and its items are contiguous, no need to visit it
+				for (u32 iIndex = firstItem; iIndex < firstItem + numItems; iIndex++) { AddBvhResult(resultsOut, bvh->items[iIndex]); }
+				numResults += numItems;
+			}
+			else if (node->children[lane] == BVH_CHILD_LEAF)
+			{
+				for (u32 iIndex = firstItem; iIndex < firstItem + numItems; iIndex++)
+				{
+					u32 item = bvh->items[iIndex];
+					if (IsBoxInBvhFrustum(frustum, itemBounds[item])) { AddBvhResult(resultsOut, item); numResults++; }
+				}
+			}
+			else
+			{
+				Assert(stackSize < BVH_MAX_STACK_SIZE);
+				stack[stackSize++] = node->children[lane];
+			}
+		}
+	}
+	return numResults;
+}
+
+// +--------------------------------------------------------------+
+// |                          Ray Query                           |
+// +--------------------------------------------------------------+
+// Builds a ray from the camera through screenPos. The first two rows of the view matrix are the camera's
+// right and up axes in world space, which keeps this independent of the handedness MakeLookAtMat4 uses
+BvhRay GetBvhRayFromScreenPos(v3 cameraPos, v3 cameraLookDir, mat4 viewMat, r32 fieldOfViewY, v2 screenSize, v2 screenPos)
+{
+	BvhRay result = ZEROED;
+	result.origin = cameraPos;
+	if (screenSize.Width <= 0 || screenSize.Height <= 0) { result.direction = Normalize(cameraLookDir); return result; }
+	r32 aspectRatio = screenSize.Width / screenSize.Height;
+	r32 tanHalfFov = TanR32(fieldOfViewY / 2.0f);
+	r32 ndcX = (screenPos.X / screenSize.Width) * 2.0f - 1.0f;
+	r32 ndcY = 1.0f - (screenPos.Y / screenSize.Height) * 2.0f;
+	v3 rightVec = NewV3(viewMat.Elements[0][0], viewMat.Elements[1][0], viewMat.Elements[2][0]);
+	v3 upVec = NewV3(viewMat.Elements[0][1], viewMat.Elements[1][1], viewMat.Elements[2][1]);
+	v3 direction = Normalize(cameraLookDir);
+	direction = Add(direction, Mul(rightVec, ndcX * tanHalfFov * aspectRatio));
+	direction = Add(direction, Mul(upVec, ndcY * tanHalfFov));
+	result.direction = Normalize(direction);
+	return result;
+}
+
+static bool RayIntersectsBvhBox(v3 origin, v3 inverseDir, box bounds, r32 maxDistance, r32* distanceOut)
+{
+	v3 boundsMin = GetBvhBoxMin(bounds);
+	v3 boundsMax = GetBvhBoxMax(bounds);
+	r32 t1X = (boundsMin.X - origin.X) * inverseDir.X; r32 t2X = (boundsMax.X - origin.X) * inverseDir.X;
+	r32 t1Y = (boundsMin.Y - origin.Y) * inverseDir.Y; r32 t2Y = (boundsMax.Y - origin.Y) * inverseDir.Y;
+	r32 t1Z = (boundsMin.Z - origin.Z) * inverseDir.Z; r32 t2Z = (boundsMax.Z - origin.Z) * inverseDir.Z;
+	r32 enter = MaxR32(MaxR32(MinR32(t1X, t2X), MinR32(t1Y, t2Y)), MaxR32(MinR32(t1Z, t2Z), 0.0f));
+	r32 exit = MinR32(MinR32(MaxR32(t1X, t2X), MaxR32(t1Y, t2Y)), MinR32(MaxR32(t1Z, t2Z), maxDistance));
+	if (enter > exit) { return false; }
+	*distanceOut = enter;
+	return true;
+}
+
+static u32 TestBvhNodeRay(const BvhNode* node, v3 origin, v3 inverseDir, r32 maxDistance, r32* enterDistancesOut)
+{
+	BvhLane originX = BvhSet1(origin.X);
+	BvhLane originY = BvhSet1(origin.Y);
+	BvhLane originZ = BvhSet1(origin.Z);
+	BvhLane inverseX = BvhSet1(inverseDir.X);
+	BvhLane inverseY = BvhSet1(inverseDir.Y);
+	BvhLane inverseZ = BvhSet1(inverseDir.Z);
+	BvhLane t1X = BvhMul(BvhSub(BvhLoad(node->minX), originX), inverseX);
+	BvhLane t2X = BvhMul(BvhSub(BvhLoad(node->maxX), originX), inverseX);
+	BvhLane t1Y = BvhMul(BvhSub(BvhLoad(node->minY), originY), inverseY);
+	BvhLane t2Y = BvhMul(BvhSub(BvhLoad(node->maxY), originY), inverseY);
+	BvhLane t1Z = BvhMul(BvhSub(BvhLoad(node->minZ), originZ), inverseZ);
+	BvhLane t2Z = BvhMul(BvhSub(BvhLoad(node->maxZ), originZ), inverseZ);
+	BvhLane enter = BvhMax(BvhMax(BvhMin(t1X, t2X), BvhMin(t1Y, t2Y)), BvhMax(BvhMin(t1Z, t2Z), BvhSet1(0.0f)));
+	BvhLane exit = BvhMin(BvhMin(BvhMax(t1X, t2X), BvhMax(t1Y, t2Y)), BvhMin(BvhMax(t1Z, t2Z), BvhSet1(maxDistance)));
+	BvhStore(enterDistancesOut, enter);
+	return BvhMaskLessEqual(enter, exit);
+}
+
+// Finds the closest item whose bounds the ray hits. Children are pushed far-to-near so the
+// nearest one is visited first and shrinks the search distance for the rest
+BvhRayHit RaycastBvh(const Bvh* bvh, const box* itemBounds, BvhRay ray, r32 maxDistance)
+{
+	NotNull(bvh);
+	BvhRayHit result = ZEROED;
+	result.item = BVH_ITEM_INVALID;
+	result.distance = maxDistance;
+	if (bvh->nodes.length == 0) { return result; }
+	const BvhNode* nodes = (const BvhNode*)bvh->nodes.items;
+	v3 inverseDir = NewV3(GetBvhInverseDir(ray.direction.X), GetBvhInverseDir(ray.direction.Y), GetBvhInverseDir(ray.direction.Z));
+	
+	u32 stackNodes[BVH_MAX_STACK_SIZE];
+	r32 stackDistances[BVH_MAX_STACK_SIZE];
+	uxx stackSize = 0;
+	stackNodes[stackSize] = 0;
+	stackDistances[stackSize] = 0.0f;
+	stackSize++;
+	while (stackSize > 0)
+	{
+		stackSize--;
+		if (stackDistances[stackSize] > result.distance) { continue; }
+		const BvhNode* node = &nodes[stackNodes[stackSize]];
+		r32 enterDistances[BVH_NODE_WIDTH];
+		u32 hitMask = TestBvhNodeRay(node, ray.origin, inverseDir, result.distance, enterDistances);
+		
+		u32 childNodes[BVH_NODE_WIDTH];
+		r32 childDistances[BVH_NODE_WIDTH];
+		uxx numChildren = 0;
+		for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+		{
+			if (node->numItems[lane] == 0 || (hitMask & (1u << lane)) == 0) { continue; }
+			if (node->children[lane] == BVH_CHILD_LEAF)
+			{
+				u32 firstItem = node->firstItem[lane];
+				for (u32 iIndex = firstItem; iIndex < firstItem + node->numItems[lane]; iIndex++)
+				{
+					u32 item = bvh->items[iIndex];
+					r32 hitDistance = 0.0f;
+					if (RayIntersectsBvhBox(ray.origin, inverseDir, itemBounds[item], result.distance, &hitDistance) && (result.item == BVH_ITEM_INVALID || hitDistance < result.distance))
+					{
+						result.item = item;
+						result.distance = hitDistance;
+					}
+				}
+			}
+			else
+			{
+				//Insertion sort by distance, furthest first
+				uxx insertIndex = numChildren;
+				while (insertIndex > 0 && childDistances[insertIndex-1] < enterDistances[lane])
+				{
+					childNodes[insertIndex] = childNodes[insertIndex-1];
+					childDistances[insertIndex] = childDistances[insertIndex-1];
+					insertIndex--;
+				}
+				childNodes[insertIndex] = node->children[lane];
+				childDistances[insertIndex] = enterDistances[lane];
+				numChildren++;
+			}
+		}
+		for (uxx cIndex = 0; cIndex < numChildren; cIndex++)
+		{
+			Assert(stackSize < BVH_MAX_STACK_SIZE);
+			stackNodes[stackSize] = childNodes[cIndex];
+			stackDistances[stackSize] = childDistances[cIndex];
+			stackSize++;
+		}
+	}
+	if (result.item != BVH_ITEM_INVALID) { result.position = Add(ray.origin, Mul(ray.direction, result.distance)); }
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                         Sphere Query                         |
+// +--------------------------------------------------------------+
+static bool DoesSphereOverlapBvhBox(v3 center, r32 radiusSquared, box bounds)
+{
+	v3 boundsMin = GetBvhBoxMin(bounds);
+	v3 boundsMax = GetBvhBoxMax(bounds);
+	r32 deltaX = MaxR32(MaxR32(boundsMin.X - center.X, center.X - boundsMax.X), 0.0f);
+	r32 deltaY = MaxR32(MaxR32(boundsMin.Y - center.Y, center.Y - boundsMax.Y), 0.0f);
+	r32 deltaZ = MaxR32(MaxR32(boundsMin.Z - center.Z, center.Z - boundsMax.Z), 0.0f);
+	return (deltaX*deltaX + deltaY*deltaY + deltaZ*deltaZ <= radiusSquared);
+}
+
+static u32 TestBvhNodeSphere(const BvhNode* node, v3 center, r32 radiusSquared)
+{
+	BvhLane zero = BvhSet1(0.0f);
+	BvhLane centerX = BvhSet1(center.X);
+	BvhLane centerY = BvhSet1(center.Y);
+	BvhLane centerZ = BvhSet1(center.Z);
+	BvhLane deltaX = BvhMax(BvhMax(BvhSub(BvhLoad(node->minX), centerX), BvhSub(centerX, BvhLoad(node->maxX))), zero);
+	BvhLane deltaY = BvhMax(BvhMax(BvhSub(BvhLoad(node->minY), centerY), BvhSub(centerY, BvhLoad(node->maxY))), zero);
+	BvhLane deltaZ = BvhMax(BvhMax(BvhSub(BvhLoad(node->minZ), centerZ), BvhSub(centerZ, BvhLoad(node->maxZ))), zero);
+	BvhLane distanceSquared = BvhAdd(BvhAdd(BvhMul(deltaX, deltaX), BvhMul(deltaY, deltaY)), BvhMul(deltaZ, deltaZ));
+	return BvhMaskLessEqual(distanceSquared, BvhSet1(radiusSquared));
+}
+
+// Adds the item index of everything whose bounds overlap the sphere to resultsOut (which can be nullptr to only count them)
+uxx QueryBvhSphere(const Bvh* bvh, const box* itemBounds, v3 center, r32 radius, VarArray* resultsOut)
+{
+	NotNull(bvh);
+	if (bvh->nodes.length == 0) { return 0; }
+	const BvhNode* nodes = (const BvhNode*)bvh->nodes.items;
+	r32 radiusSquared = radius * radius;
+	uxx numResults = 0;
+	u32 stack[BVH_MAX_STACK_SIZE];
+	uxx stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const BvhNode* node = &nodes[stack[--stackSize]];
+		u32 overlapMask = TestBvhNodeSphere(node, center, radiusSquared);
+		for (uxx lane = 0; lane < BVH_NODE_WIDTH; lane++)
+		{
+			if (node->numItems[lane] == 0 || (overlapMask & (1u << lane)) == 0) { continue; }
+			if (node->children[lane] == BVH_CHILD_LEAF)
+			{
+				u32 firstItem = node->firstItem[lane];
+				for (u32 iIndex = firstItem; iIndex < firstItem + node->numItems[lane]; iIndex++)
+				{
+					u32 item = bvh->items[iIndex];
+					if (DoesSphereOverlapBvhBox(center, radiusSquared, itemBounds[item])) { AddBvhResult(resultsOut, item); numResults++; }
+				}
+			}
+			else
+			{
+				Assert(stackSize < BVH_MAX_STACK_SIZE);
+				stack[stackSize++] = node->children[lane];
+			}
+		}
+	}
+	return numResults;
+}
+
+// +--------------------------------------------------------------+
+// |                          Benchmark                           |
+// +--------------------------------------------------------------+
+#define BVH_BENCHMARK_NUM_QUERIES 256
+
+BvhBenchmarkResult RunBvhBenchmark(uxx numItems)
+{
+	Assert(numItems > 0);
+	BvhBenchmarkResult result = ZEROED;
+	result.numItems = numItems;
+	result.numRays = BVH_BENCHMARK_NUM_QUERIES;
+	result.numSpheres = BVH_BENCHMARK_NUM_QUERIES;
+	result.resultsMatch = true;
+	
+	//Items are spread over a flat area that grows with the count so the density (and query selectivity) stays roughly constant, like a level would
+	RandomSeries random = ZEROED;
+	InitRandomSeriesDefault(&random);
+	SeedRandomSeriesU64(&random, 4321);
+	r32 worldSize = 3.0f * SqrtR32((r32)numItems);
+	box* itemBounds = AllocArray(box, stdHeap, numItems);
+	NotNull(itemBounds);
+	for (uxx iIndex = 0; iIndex < numItems; iIndex++)
+	{
+		v3 position = NewV3(GetRandR32Range(&random, 0, worldSize), GetRandR32Range(&random, 0, 10), GetRandR32Range(&random, 0, worldSize));
+		v3 size = NewV3(GetRandR32Range(&random, 0.5f, 2), GetRandR32Range(&random, 0.5f, 2), GetRandR32Range(&random, 0.5f, 2));
+		itemBounds[iIndex] = NewBoxV(position, size);
+	}
+	
+	Bvh bvh = ZEROED;
+	InitBvh(stdHeap, numItems, &bvh);
+	PerfTime buildStart = GetPerfTime();
+	BuildBvh(&bvh, itemBounds, numItems);
+	PerfTime buildEnd = GetPerfTime();
+	result.buildMs = GetPerfTimeDiff(&buildStart, &buildEnd);
+	result.numNodes = bvh.nodes.length;
+	
+	for (uxx iIndex = 0; iIndex < numItems; iIndex++)
+	{
+		itemBounds[iIndex].BottomLeftBack = Add(itemBounds[iIndex].BottomLeftBack, NewV3(GetRandR32Range(&random, -0.5f, 0.5f), 0, GetRandR32Range(&random, -0.5f, 0.5f)));
+	}
+	PerfTime refitStart = GetPerfTime();
+	RefitBvh(&bvh, itemBounds);
+	PerfTime refitEnd = GetPerfTime();
+	result.refitMs = GetPerfTimeDiff(&refitStart, &refitEnd);
+	
+	v3 cameraPos = NewV3(0, 20, 0);
+	mat4 viewProjMat = Mul(
+		MakePerspectiveMat4Dx(ToRadians32(60), 16.0f/9.0f, 0.1f, worldSize),
+		MakeLookAtMat4(cameraPos, NewV3(worldSize/2, 0, worldSize/2), V3_Up)
+	);
+	BvhFrustum frustum = GetBvhFrustumFromMat4(viewProjMat, true);
+	PerfTime frustumBvhStart = GetPerfTime();
+	result.numFrustumResults = QueryBvhFrustum(&bvh, itemBounds, &frustum, nullptr);
+	PerfTime frustumBvhEnd = GetPerfTime();
+	result.frustumBvhMs = GetPerfTimeDiff(&frustumBvhStart, &frustumBvhEnd);
+	PerfTime frustumLinearStart = GetPerfTime();
+	uxx numFrustumLinear = 0;
+	for (uxx iIndex = 0; iIndex < numItems; iIndex++) { if (IsBoxInBvhFrustum(&frustum, itemBounds[iIndex])) { numFrustumLinear++; } }
+	PerfTime frustumLinearEnd = GetPerfTime();
+	result.frustumLinearMs = GetPerfTimeDiff(&frustumLinearStart, &frustumLinearEnd);
+	if (numFrustumLinear != result.numFrustumResults) { result.resultsMatch = false; }
+	
+	BvhRay rays[BVH_BENCHMARK_NUM_QUERIES];
+	for (uxx rIndex = 0; rIndex < BVH_BENCHMARK_NUM_QUERIES; rIndex++)
+	{
+		rays[rIndex].origin = NewV3(GetRandR32Range(&random, 0, worldSize), 30, GetRandR32Range(&random, 0, worldSize));
+		v3 target = NewV3(GetRandR32Range(&random, 0, worldSize), 0, GetRandR32Range(&random, 0, worldSize));
+		rays[rIndex].direction = Normalize(Sub(target, rays[rIndex].origin));
+	}
+	BvhRayHit bvhHits[BVH_BENCHMARK_NUM_QUERIES];
+	PerfTime rayBvhStart = GetPerfTime();
+	for (uxx rIndex = 0; rIndex < BVH_BENCHMARK_NUM_QUERIES; rIndex++) { bvhHits[rIndex] = RaycastBvh(&bvh, itemBounds, rays[rIndex], HighestR32); }
+	PerfTime rayBvhEnd = GetPerfTime();
+	result.rayBvhMs = GetPerfTimeDiff(&rayBvhStart, &rayBvhEnd);
+	PerfTime rayLinearStart = GetPerfTime();
+	for (uxx rIndex = 0; rIndex < BVH_BENCHMARK_NUM_QUERIES; rIndex++)
+	{
+		v3 inverseDir = NewV3(GetBvhInverseDir(rays[rIndex].direction.X), GetBvhInverseDir(rays[rIndex].direction.Y), GetBvhInverseDir(rays[rIndex].direction.Z));
+		r32 closestDistance = HighestR32;
+		bool foundHit = false;
+		for (uxx iIndex = 0; iIndex < numItems; iIndex++)
+		{
+			r32 hitDistance = 0.0f;
+			if (RayIntersectsBvhBox(rays[rIndex].origin, inverseDir, itemBounds[iIndex], closestDistance, &hitDistance) && hitDistance < closestDistance) { closestDistance = hitDistance; foundHit = true; }
+		}
+		if (foundHit != (bvhHits[rIndex].item != BVH_ITEM_INVALID)) { result.resultsMatch = false; }
+		else if (foundHit && AbsR32(closestDistance - bvhHits[rIndex].distance) > 0.001f) { result.resultsMatch = false; }
+	}
+	PerfTime rayLinearEnd = GetPerfTime();
+	result.rayLinearMs = GetPerfTimeDiff(&rayLinearStart, &rayLinearEnd);
+	
+	v3 sphereCenters[BVH_BENCHMARK_NUM_QUERIES];
+	uxx sphereResultCounts[BVH_BENCHMARK_NUM_QUERIES];
+	const r32 sphereRadius = 5.0f;
+	for (uxx sIndex = 0; sIndex < BVH_BENCHMARK_NUM_QUERIES; sIndex++)
+	{
+		sphereCenters[sIndex] = NewV3(GetRandR32Range(&random, 0, worldSize), GetRandR32Range(&random, 0, 10), GetRandR32Range(&random, 0, worldSize));
+	}
+	PerfTime sphereBvhStart = GetPerfTime();
+	for (uxx sIndex = 0; sIndex < BVH_BENCHMARK_NUM_QUERIES; sIndex++) { sphereResultCounts[sIndex] = QueryBvhSphere(&bvh, itemBounds, sphereCenters[sIndex], sphereRadius, nullptr); }
+	PerfTime sphereBvhEnd = GetPerfTime();
+	result.sphereBvhMs = GetPerfTimeDiff(&sphereBvhStart, &sphereBvhEnd);
+	PerfTime sphereLinearStart = GetPerfTime();
+	for (uxx sIndex = 0; sIndex < BVH_BENCHMARK_NUM_QUERIES; sIndex++)
+	{
+		uxx numLinear = 0;
+		for (uxx iIndex = 0; iIndex < numItems; iIndex++) { if (DoesSphereOverlapBvhBox(sphereCenters[sIndex], sphereRadius*sphereRadius, itemBounds[iIndex])) { numLinear++; } }
+		if (numLinear != sphereResultCounts[sIndex]) { result.resultsMatch = false; }
+	}
+	PerfTime sphereLinearEnd = GetPerfTime();
+	result.sphereLinearMs = GetPerfTimeDiff(&sphereLinearStart, &sphereLinearEnd);
+	
+	FreeBvh(&bvh);
+	FreeMem(stdHeap, itemBounds, sizeof(box) * numItems);
+	return result;
+}
+
+void PrintBvhBenchmark(uxx numItems)
+{
+	BvhBenchmarkResult result = RunBvhBenchmark(numItems);
+	PrintLine_I("BVH benchmark (%llu items, %llu nodes):", (u64)result.numItems, (u64)result.numNodes);
+	PrintLine_I("\tBuild: %.3lfms", result.buildMs);
+	PrintLine_I("\tRefit: %.3lfms", result.refitMs);
+	PrintLine_I("\tFrustum (%llu visible): %.3lfms vs %.3lfms linear (%.1lfx)", (u64)result.numFrustumResults, result.frustumBvhMs, result.frustumLinearMs, result.frustumLinearMs / result.frustumBvhMs);
+	PrintLine_I("\t%llu Rays:    %.3lfms vs %.3lfms linear (%.1lfx)", (u64)result.numRays, result.rayBvhMs, result.rayLinearMs, result.rayLinearMs / result.rayBvhMs);
+	PrintLine_I("\t%llu Spheres: %.3lfms vs %.3lfms linear (%.1lfx)", (u64)result.numSpheres, result.sphereBvhMs, result.sphereLinearMs, result.sphereLinearMs / result.sphereBvhMs);
+	if (!result.resultsMatch) { PrintLine_E("\tBVH query results did not match the linear scans!"); }
+}
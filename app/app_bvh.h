@@ -0,0 +1,93 @@
+/*
+File:   app_bvh.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A bounding volume hierarchy over an array of world-space AABBs (usually InstanceStore->bounds).
+	** The tree is built top-down with a binned Surface Area Heuristic and every node has 4 children
+	** whose bounds are stored as SoA so one node can be tested against a frustum/ray/sphere in one
+	** SIMD operation. Moving items are handled by refitting the existing tree, which is only rebuilt
+	** once the refit has degraded the SAH cost too much or items have been added/removed.
+*/
+
+#ifndef _APP_BVH_H
+#define _APP_BVH_H
+
+#define BVH_NODE_WIDTH          4
+#define BVH_MAX_LEAF_ITEMS      4
+#define BVH_NUM_SAH_BINS        16
+#define BVH_MAX_STACK_SIZE      256
+#define BVH_CHILD_LEAF          UINT32_MAX
+#define BVH_ITEM_INVALID        UINT32_MAX
+#define BVH_REFIT_REBUILD_RATIO 1.5f //RefitBvh asks for a rebuild once the SAH cost is this much worse than right after the build
+
+// Bounds of lane i are [minX[i], maxX[i]] etc. Unused lanes have numItems = 0
+typedef struct BvhNode BvhNode;
+struct BvhNode
+{
+	r32 minX[BVH_NODE_WIDTH];
+	r32 minY[BVH_NODE_WIDTH];
+	r32 minZ[BVH_NODE_WIDTH];
+	r32 maxX[BVH_NODE_WIDTH];
+	r32 maxY[BVH_NODE_WIDTH];
+	r32 maxZ[BVH_NODE_WIDTH];
+	u32 children[BVH_NODE_WIDTH]; //index into Bvh->nodes, BVH_CHILD_LEAF for leaves
+	u32 firstItem[BVH_NODE_WIDTH]; //every lane (leaf or not) covers Bvh->items[firstItem, firstItem+numItems)
+	u32 numItems[BVH_NODE_WIDTH];
+};
+
+typedef struct Bvh Bvh;
+struct Bvh
+{
+	Arena* arena;
+	uxx numItems;
+	uxx allocItems;
+	u32* items; //indices into the itemBounds array the tree was built from, in leaf order
+	VarArray nodes; //BvhNode, nodes[0] is the root and children always come after their parent
+	r32 buildSahCost;
+	r32 sahCost;
+	uxx numRefitsSinceBuild;
+};
+
+// Planes are stored as (normal, distance) and a point is inside when Dot(normal, point) + distance >= 0
+typedef struct BvhFrustum BvhFrustum;
+struct BvhFrustum
+{
+	v4 planes[6];
+};
+
+typedef struct BvhRay BvhRay;
+struct BvhRay
+{
+	v3 origin;
+	v3 direction; //normalized
+};
+
+typedef struct BvhRayHit BvhRayHit;
+struct BvhRayHit
+{
+	u32 item; //BVH_ITEM_INVALID when nothing was hit
+	r32 distance;
+	v3 position;
+};
+
+typedef struct BvhBenchmarkResult BvhBenchmarkResult;
+struct BvhBenchmarkResult
+{
+	uxx numItems;
+	uxx numNodes;
+	r64 buildMs;
+	r64 refitMs;
+	uxx numFrustumResults;
+	r64 frustumBvhMs;
+	r64 frustumLinearMs;
+	uxx numRays;
+	r64 rayBvhMs;
+	r64 rayLinearMs;
+	uxx numSpheres;
+	r64 sphereBvhMs;
+	r64 sphereLinearMs;
+	bool resultsMatch; //BVH queries returned the same number of results (and ray distances) as the linear scans
+};
+
+#endif //  _APP_BVH_H
@@ -0,0 +1,158 @@
+/*
+File:   app_cooked_asset.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the hashing, loading and writing of CookedAsset files (see app_cooked_asset.h)
+*/
+
+// FNV-1a, but it takes 8 bytes per step so hashing a whole model's vertices stays well under the cost of what we cache
+u64 HashCookedAssetBytes(u64 hash, const void* bytes, uxx numBytes)
+{
+	const u8* bytePntr = (const u8*)bytes;
+	uxx bIndex = 0;
+	for (; bIndex + sizeof(u64) <= numBytes; bIndex += sizeof(u64))
+	{
+		u64 word = 0;
+		MyMemCopy(&word, &bytePntr[bIndex], sizeof(word));
+		hash = (hash ^ word) * COOKED_ASSET_HASH_PRIME;
+	}
+	for (; bIndex < numBytes; bIndex++) { hash = (hash ^ bytePntr[bIndex]) * COOKED_ASSET_HASH_PRIME; }
+	return hash;
+}
+
+static inline uxx AlignCookedAssetOffset(uxx offset)
+{
+	return ((offset + COOKED_ASSET_ALIGNMENT - 1) / COOKED_ASSET_ALIGNMENT) * COOKED_ASSET_ALIGNMENT;
+}
+
+FilePath GetCookedAssetPath(Arena* arena, FilePath sourcePath)
+{
+	return PrintInArenaStr(arena, "%.*s%s", StrPrint(sourcePath), COOKED_ASSET_EXTENSION);
+}
+
+void FreeCookedAsset(CookedAsset* asset)
+{
+	NotNull(asset);
+	if (asset->arena != nullptr)
+	{
+		FreeVarArray(&asset->sections);
+		FreeVarArray(&asset->sectionDatas);
+	}
+	ClearPointer(asset);
+}
+
+void InitCookedAsset(Arena* arena, u64 sourceHash, CookedAsset* assetOut)
+{
+	NotNull(arena);
+	NotNull(assetOut);
+	ClearPointer(assetOut);
+	assetOut->arena = arena;
+	assetOut->sourceHash = sourceHash;
+	InitVarArray(CookedAssetSection, &assetOut->sections, arena);
+	InitVarArray(Str8, &assetOut->sectionDatas, arena);
+}
+
+// The data isn't copied, it has to stay alive until WriteCookedAsset
+void AddCookedAssetSection(CookedAsset* asset, CookedSectionType type, u32 index, Str8 data)
+{
+	NotNull(asset);
+	NotNull(asset->arena);
+	CookedAssetSection* newSection = VarArrayAdd(CookedAssetSection, &asset->sections);
+	NotNull(newSection);
+	ClearPointer(newSection);
+	newSection->type = (u32)type;
+	newSection->index = index;
+	newSection->size = (u64)data.length;
+	Str8* newData = VarArrayAdd(Str8, &asset->sectionDatas);
+	NotNull(newData);
+	*newData = data;
+}
+
+// Returns an empty string when there's no such section
+Str8 FindCookedAssetSection(const CookedAsset* asset, CookedSectionType type, u32 index)
+{
+	NotNull(asset);
+	VarArrayLoop(&asset->sections, sIndex)
+	{
+		VarArrayLoopGet(CookedAssetSection, section, &asset->sections, sIndex);
+		if (section->type == (u32)type && section->index == index) { return *VarArrayGetHard(Str8, &asset->sectionDatas, sIndex); }
+	}
+	return NewStr8(0, nullptr);
+}
+
+// The file is read into the arena and the sections point into it, so a scratch arena is usually the right choice.
+// Returns false (with assetOut left empty but initialized) when the file is missing, malformed or was cooked from different source data
+bool TryLoadCookedAsset(Arena* arena, FilePath sourcePath, u64 sourceHash, CookedAsset* assetOut)
+{
+	NotNull(arena);
+	NotNull(assetOut);
+	InitCookedAsset(arena, sourceHash, assetOut);
+	FilePath cookedPath = GetCookedAssetPath(arena, sourcePath);
+	Str8 fileContents = ZEROED;
+	if (!OsReadFile(cookedPath, arena, false, &fileContents)) { return false; }
+	if (fileContents.length < sizeof(CookedAssetHeader)) { return false; }
+	
+	CookedAssetHeader header = ZEROED;
+	MyMemCopy(&header, fileContents.chars, sizeof(header));
+	if (header.magic != COOKED_ASSET_MAGIC || header.version != COOKED_ASSET_VERSION || header.sourceHash != sourceHash) { return false; }
+	uxx tableEnd = sizeof(CookedAssetHeader) + (uxx)header.numSections * sizeof(CookedAssetSection);
+	if (tableEnd > fileContents.length) { return false; }
+	
+	for (uxx sIndex = 0; sIndex < (uxx)header.numSections; sIndex++)
+	{
+		CookedAssetSection section = ZEROED;
+		MyMemCopy(&section, &fileContents.chars[sizeof(CookedAssetHeader) + sIndex * sizeof(CookedAssetSection)], sizeof(section));
+		if (section.offset < tableEnd || section.offset > fileContents.length || section.size > fileContents.length - section.offset)
+		{
+			VarArrayClear(&assetOut->sections);
+			VarArrayClear(&assetOut->sectionDatas);
+			return false;
+		}
+		AddCookedAssetSection(assetOut, (CookedSectionType)section.type, section.index, NewStr8((uxx)section.size, &fileContents.chars[section.offset]));
+		VarArrayGetHard(CookedAssetSection, &assetOut->sections, sIndex)->offset = section.offset;
+	}
+	return true;
+}
+
+bool WriteCookedAsset(const CookedAsset* asset, FilePath sourcePath)
+{
+	NotNull(asset);
+	ScratchBegin1(scratch, asset->arena);
+	uxx numSections = asset->sections.length;
+	uxx fileSize = sizeof(CookedAssetHeader) + numSections * sizeof(CookedAssetSection);
+	VarArrayLoop(&asset->sectionDatas, sIndex)
+	{
+		fileSize = AlignCookedAssetOffset(fileSize);
+		fileSize += VarArrayGetHard(Str8, &asset->sectionDatas, sIndex)->length;
+	}
+	u8* fileBytes = AllocArray(u8, scratch, fileSize);
+	NotNull(fileBytes);
+	MyMemSet(fileBytes, 0x00, fileSize);
+	
+	CookedAssetHeader header = ZEROED;
+	header.magic = COOKED_ASSET_MAGIC;
+	header.version = COOKED_ASSET_VERSION;
+	header.sourceHash = asset->sourceHash;
+	header.numSections = (u32)numSections;
+	MyMemCopy(fileBytes, &header, sizeof(header));
+	uxx dataOffset = sizeof(CookedAssetHeader) + numSections * sizeof(CookedAssetSection);
+	VarArrayLoop(&asset->sections, sIndex)
+	{
+		CookedAssetSection section = *VarArrayGetHard(CookedAssetSection, &asset->sections, sIndex);
+		Str8 data = *VarArrayGetHard(Str8, &asset->sectionDatas, sIndex);
+		dataOffset = AlignCookedAssetOffset(dataOffset);
+		section.offset = (u64)dataOffset;
+		section.size = (u64)data.length;
+		MyMemCopy(&fileBytes[sizeof(CookedAssetHeader) + sIndex * sizeof(CookedAssetSection)], &section, sizeof(section));
+		if (data.length > 0) { MyMemCopy(&fileBytes[dataOffset], data.chars, data.length); }
+		dataOffset += data.length;
+	}
+	Assert(dataOffset == fileSize);
+	
+	FilePath cookedPath = GetCookedAssetPath(scratch, sourcePath);
+	bool result = OsWriteBinFile(cookedPath, NewStr8(fileSize, (char*)fileBytes));
+	if (!result) { PrintLine_W("Failed to write cooked asset \"%.*s\"", StrPrint(cookedPath)); }
+	ScratchEnd(scratch);
+	return result;
+}
@@ -0,0 +1,70 @@
+/*
+File:   app_cooked_asset.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A small binary container for data we derive from a source asset at load time (tangents, etc.)
+	** so the next run can read it back instead of deriving it again. The cooked file sits next to the
+	** source file (with COOKED_ASSET_EXTENSION appended) and stores a hash of everything the derived
+	** data was computed from. A file with the wrong magic, version or hash is ignored and rewritten.
+	** Each section is tagged with a type and an index (usually the part index) and its data is aligned
+	** to COOKED_ASSET_ALIGNMENT so it can be read in place straight out of the loaded file.
+*/
+
+#ifndef _APP_COOKED_ASSET_H
+#define _APP_COOKED_ASSET_H
+
+#define COOKED_ASSET_MAGIC       0x4B4F4F43 //"COOK"
+#define COOKED_ASSET_VERSION     1
+#define COOKED_ASSET_EXTENSION   ".cooked"
+#define COOKED_ASSET_ALIGNMENT   16
+#define COOKED_ASSET_HASH_SEED   0xCBF29CE484222325ULL
+#define COOKED_ASSET_HASH_PRIME  0x100000001B3ULL
+
+typedef enum CookedSectionType CookedSectionType;
+enum CookedSectionType
+{
+	CookedSectionType_None = 0,
+	CookedSectionType_PartTangents, //v4 per vertex of the part (split copies included), see GenerateMeshTangents
+	CookedSectionType_FontAtlasSize, //v2i the atlas for each font size (the index) was baked at, see BakeFontAtlasesCached
+	CookedSectionType_FontKerningTable, //FontKerningTableEntry array, filled by FillFontKerningTable
+	CookedSectionType_PartTangentSplits, //u32 per split vertex of the part, the vertex it's a copy of
+	CookedSectionType_PartTangentSplitCorners, //u32 per index of the part that was changed to use a split vertex
+	CookedSectionType_FontAtlasInfo, //the FontAtlas struct for each font size (the index) as BakeFontAtlas left it, see TryRestoreFontAtlas
+	CookedSectionType_FontAtlasGlyphs, //FontGlyph array of the atlas for each font size
+	CookedSectionType_FontAtlasCharRanges, //FontCharRange array of the atlas for each font size
+	CookedSectionType_FontAtlasCoverage, //u8 per atlas pixel (the alpha of the white+alpha texture), see RenderFontAtlasCoverage
+	CookedSectionType_Count,
+};
+
+typedef struct CookedAssetHeader CookedAssetHeader;
+struct CookedAssetHeader
+{
+	u32 magic;
+	u32 version;
+	u64 sourceHash;
+	u32 numSections;
+	u32 reserved;
+};
+
+typedef struct CookedAssetSection CookedAssetSection;
+struct CookedAssetSection
+{
+	u32 type; //CookedSectionType
+	u32 index;
+	u64 offset; //from the start of the file
+	u64 size;
+};
+
+// Holds references only: a loaded asset points into the file contents and sections being added point at the
+// caller's data, so both have to stay alive until the CookedAsset is done being used (or written)
+typedef struct CookedAsset CookedAsset;
+struct CookedAsset
+{
+	Arena* arena;
+	u64 sourceHash;
+	VarArray sections; //CookedAssetSection
+	VarArray sectionDatas; //Str8, parallel to sections
+};
+
+#endif //  _APP_COOKED_ASSET_H
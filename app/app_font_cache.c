@@ -0,0 +1,270 @@
+/*
+File:   app_font_cache.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the atlas size estimate and the cooked font cache used by RasterizeFontAtSizes (see app_font_cache.h)
+*/
+
+// Covers everything that decides what BakeFontAtlasesCached bakes. The TTF file comes from the OS so its bytes are hashed
+// too (a different version of the font installed later misses), as are the sizes of the structs that get cached raw
+u64 HashFontBakeParams(Str8 ttfFile, Str8 fontName, u8 styleFlags, uxx numSizes, const r32* fontSizes, uxx numCharRanges, const FontCharRange* charRanges)
+{
+	u64 result = COOKED_ASSET_HASH_SEED;
+	u64 header[7] = {
+		(u64)FONT_CACHE_VERSION, (u64)styleFlags, (u64)fontName.length,
+		(u64)sizeof(FontKerningTableEntry), (u64)sizeof(FontAtlas), (u64)sizeof(FontGlyph), (u64)sizeof(FontCharRange),
+	};
+	result = HashCookedAssetBytes(result, &header[0], sizeof(header));
+	result = HashCookedAssetBytes(result, ttfFile.chars, ttfFile.length);
+	result = HashCookedAssetBytes(result, fontName.chars, fontName.length);
+	result = HashCookedAssetBytes(result, fontSizes, sizeof(r32) * numSizes);
+	result = HashCookedAssetBytes(result, charRanges, sizeof(FontCharRange) * numCharRanges);
+	return result;
+}
+
+// There's no source file for an OS font, so the cooked file is named after the font instead (ex. "Consolas_01.font.cooked")
+FilePath GetFontCacheSourcePath(Arena* arena, Str8 fontName, u8 styleFlags)
+{
+	return PrintInArenaStr(arena, "%.*s_%02X%s", StrPrint(fontName), (u32)styleFlags, FONT_CACHE_EXTENSION);
+}
+
+static i32 RoundUpFontAtlasDimension(r32 value)
+{
+	i32 result = FONT_ATLAS_MIN_SIZE;
+	while (result < FONT_ATLAS_MAX_SIZE && (r32)result < value) { result *= 2; }
+	return result;
+}
+
+// Guesses the smallest power of two atlas the glyphs will fit in. Glyph boxes average a little over half the font size
+// wide and most of it tall (accents and descenders push some past it) so this errs a step towards too big, one bake at a
+// slightly larger atlas is much cheaper than a bake that runs out of space and has to start over
+v2i EstimateFontAtlasSize(r32 fontSize, uxx numCharRanges, const FontCharRange* charRanges)
+{
+	uxx numGlyphs = 0;
+	for (uxx rIndex = 0; rIndex < numCharRanges; rIndex++)
+	{
+		if (charRanges[rIndex].endCodepoint >= charRanges[rIndex].startCodepoint)
+		{
+			numGlyphs += (uxx)(charRanges[rIndex].endCodepoint - charRanges[rIndex].startCodepoint) + 1;
+		}
+	}
+	r32 cellWidth = fontSize * 0.6f + FONT_ATLAS_GLYPH_PADDING;
+	r32 cellHeight = fontSize * 0.9f + FONT_ATLAS_GLYPH_PADDING;
+	r32 area = ((r32)numGlyphs * cellWidth * cellHeight) / FONT_ATLAS_PACKING_DENSITY;
+	i32 width = RoundUpFontAtlasDimension(MaxR32(SqrtR32(area), cellWidth));
+	i32 height = RoundUpFontAtlasDimension(MaxR32(area / (r32)width, cellHeight));
+	return NewV2i(width, height);
+}
+
+// Replaces the font's kerning table with the cached entries (fonts without kerning cache an empty table). Returns false
+// (leaving the table alone) when the data doesn't look like a kerning table
+bool TryRestoreFontKerningTable(Font* font, Str8 cachedEntries)
+{
+	NotNull(font);
+	NotNull(font->arena);
+	if ((cachedEntries.length % sizeof(FontKerningTableEntry)) != 0) { return false; }
+	uxx numEntries = cachedEntries.length / sizeof(FontKerningTableEntry);
+	FontKerningTableEntry* newEntries = nullptr;
+	if (numEntries > 0)
+	{
+		newEntries = AllocArray(FontKerningTableEntry, font->arena, numEntries);
+		NotNull(newEntries);
+		MyMemCopy(newEntries, cachedEntries.chars, cachedEntries.length);
+	}
+	if (font->kerningTable.entries != nullptr)
+	{
+		FreeMem(font->arena, font->kerningTable.entries, sizeof(FontKerningTableEntry) * font->kerningTable.numEntries);
+	}
+	font->kerningTable.entries = newEntries;
+	font->kerningTable.numEntries = numEntries;
+	return true;
+}
+
+// Renders the coverage of every glyph in the atlas into a u8 per pixel buffer the size of the atlas texture. The pack
+// BakeFontAtlas does renders each glyph with stbtt_MakeGlyphBitmap at the font size's pixel height scale into its
+// atlasSourceRec, doing the same here gives back the pixels it uploaded
+u8* RenderFontAtlasCoverage(Arena* arena, const stbtt_fontinfo* ttfInfo, r32 fontSize, const FontAtlas* atlas)
+{
+	NotNull(arena);
+	NotNull(ttfInfo);
+	NotNull(atlas);
+	v2i atlasSize = NewV2i(atlas->texture.Width, atlas->texture.Height);
+	Assert(atlasSize.Width > 0 && atlasSize.Height > 0);
+	uxx numPixels = (uxx)atlasSize.Width * (uxx)atlasSize.Height;
+	u8* result = AllocArray(u8, arena, numPixels);
+	NotNull(result);
+	MyMemSet(result, 0x00, numPixels);
+	r32 scale = stbtt_ScaleForPixelHeight(ttfInfo, fontSize);
+	VarArrayLoop(&atlas->glyphs, gIndex)
+	{
+		VarArrayLoopGet(FontGlyph, glyph, &atlas->glyphs, gIndex);
+		reci glyphRec = glyph->atlasSourceRec;
+		if (glyph->ttfGlyphIndex < 0 || glyphRec.Width <= 0 || glyphRec.Height <= 0) { continue; }
+		if (glyphRec.X < 0 || glyphRec.Y < 0 || glyphRec.X + glyphRec.Width > atlasSize.Width || glyphRec.Y + glyphRec.Height > atlasSize.Height) { continue; }
+		u8* glyphPixels = &result[(uxx)glyphRec.Y * (uxx)atlasSize.Width + (uxx)glyphRec.X];
+		stbtt_MakeGlyphBitmap(ttfInfo, glyphPixels, glyphRec.Width, glyphRec.Height, atlasSize.Width, scale, scale, glyph->ttfGlyphIndex);
+	}
+	return result;
+}
+
+// Adds the atlas for size sizeIndex to the font straight from the cooked file, the same as BakeFontAtlas would have left
+// it. Returns false (adding nothing) when any of its sections are missing or don't fit together
+bool TryRestoreFontAtlas(Font* font, Str8 fontName, const CookedAsset* cookedAsset, u32 sizeIndex, Str8* coverageOut)
+{
+	NotNull(font);
+	NotNull(font->arena);
+	NotNull(cookedAsset);
+	Str8 cachedInfo = FindCookedAssetSection(cookedAsset, CookedSectionType_FontAtlasInfo, sizeIndex);
+	Str8 cachedGlyphs = FindCookedAssetSection(cookedAsset, CookedSectionType_FontAtlasGlyphs, sizeIndex);
+	Str8 cachedCharRanges = FindCookedAssetSection(cookedAsset, CookedSectionType_FontAtlasCharRanges, sizeIndex);
+	Str8 cachedCoverage = FindCookedAssetSection(cookedAsset, CookedSectionType_FontAtlasCoverage, sizeIndex);
+	if (cachedInfo.length != sizeof(FontAtlas)) { return false; }
+	if ((cachedGlyphs.length % sizeof(FontGlyph)) != 0 || (cachedCharRanges.length % sizeof(FontCharRange)) != 0) { return false; }
+	FontAtlas cachedAtlas = ZEROED;
+	MyMemCopy(&cachedAtlas, cachedInfo.chars, sizeof(FontAtlas));
+	v2i atlasSize = NewV2i(cachedAtlas.texture.Width, cachedAtlas.texture.Height);
+	if (atlasSize.Width <= 0 || atlasSize.Height <= 0 || atlasSize.Width > FONT_ATLAS_MAX_SIZE || atlasSize.Height > FONT_ATLAS_MAX_SIZE) { return false; }
+	uxx numPixels = (uxx)atlasSize.Width * (uxx)atlasSize.Height;
+	if (cachedCoverage.length != numPixels) { return false; }
+	
+	ScratchBegin1(scratch, font->arena);
+	u32* pixels = AllocArray(u32, scratch, numPixels);
+	NotNull(pixels);
+	const u8* coverage = (const u8*)cachedCoverage.chars;
+	for (uxx pIndex = 0; pIndex < numPixels; pIndex++) { pixels[pIndex] = 0x00FFFFFF | ((u32)coverage[pIndex] << 24); }
+	
+	//The arrays and texture in the cached struct pointed at the previous run's memory, everything else is kept as is
+	uxx numGlyphs = cachedGlyphs.length / sizeof(FontGlyph);
+	uxx numCharRanges = cachedCharRanges.length / sizeof(FontCharRange);
+	FontAtlas* newAtlas = VarArrayAdd(FontAtlas, &font->atlases);
+	NotNull(newAtlas);
+	*newAtlas = cachedAtlas;
+	InitVarArrayWithInitial(FontCharRange, &newAtlas->charRanges, font->arena, numCharRanges);
+	for (uxx rIndex = 0; rIndex < numCharRanges; rIndex++)
+	{
+		FontCharRange* newCharRange = VarArrayAdd(FontCharRange, &newAtlas->charRanges);
+		NotNull(newCharRange);
+		MyMemCopy(newCharRange, &cachedCharRanges.chars[rIndex * sizeof(FontCharRange)], sizeof(FontCharRange));
+	}
+	InitVarArrayWithInitial(FontGlyph, &newAtlas->glyphs, font->arena, numGlyphs);
+	for (uxx gIndex = 0; gIndex < numGlyphs; gIndex++)
+	{
+		FontGlyph* newGlyph = VarArrayAdd(FontGlyph, &newAtlas->glyphs);
+		NotNull(newGlyph);
+		MyMemCopy(newGlyph, &cachedGlyphs.chars[gIndex * sizeof(FontGlyph)], sizeof(FontGlyph));
+	}
+	Str8 textureName = PrintInArenaStr(scratch, "%.*s_atlas%u", StrPrint(fontName), sizeIndex);
+	newAtlas->texture = InitTexture(font->arena, textureName, atlasSize, pixels, 0x00);
+	ScratchEnd(scratch);
+	
+	if (coverageOut != nullptr) { *coverageOut = cachedCoverage; }
+	return true;
+}
+
+// Adds an atlas for each size and fills the kerning table, the font needs a TTF file attached. Atlases and kerning come
+// straight from the cooked file when its hash matches, anything it doesn't have gets baked (at the estimated atlas size)
+// and the file is rewritten with everything that was baked this time
+void BakeFontAtlasesCached(Font* font, Str8 fontName, uxx numSizes, const r32* fontSizes, u8 styleFlags, uxx numCharRanges, const FontCharRange* charRanges, FontCacheStats* statsOut)
+{
+	NotNull(font);
+	NotNull(fontSizes);
+	NotNull(charRanges);
+	Assert(font->ttfFile.length > 0);
+	ScratchBegin1(scratch, font->arena);
+	FontCacheStats stats = ZEROED;
+	stats.numSizes = numSizes;
+	u64 paramsHash = HashFontBakeParams(font->ttfFile, fontName, styleFlags, numSizes, fontSizes, numCharRanges, charRanges);
+	FilePath sourcePath = GetFontCacheSourcePath(scratch, fontName, styleFlags);
+	CookedAsset cookedAsset = ZEROED;
+	stats.wasCached = TryLoadCookedAsset(scratch, sourcePath, paramsHash, &cookedAsset);
+	bool cacheIsDirty = !stats.wasCached;
+	
+	PerfTime bakeStartTime = GetPerfTime();
+	uxx* atlasIndices = AllocArray(uxx, scratch, numSizes);
+	Str8* atlasCoverages = AllocArray(Str8, scratch, numSizes);
+	NotNull(atlasIndices);
+	NotNull(atlasCoverages);
+	bool ttfInfoReady = false;
+	stbtt_fontinfo ttfInfo = ZEROED;
+	for (uxx sIndex = 0; sIndex < numSizes; sIndex++)
+	{
+		atlasIndices[sIndex] = font->atlases.length;
+		if (stats.wasCached && TryRestoreFontAtlas(font, fontName, &cookedAsset, (u32)sIndex, &atlasCoverages[sIndex]))
+		{
+			stats.numRestoredAtlases++;
+			continue;
+		}
+		cacheIsDirty = true;
+		
+		Str8 cachedSize = FindCookedAssetSection(&cookedAsset, CookedSectionType_FontAtlasSize, (u32)sIndex);
+		v2i atlasSize = ZEROED;
+		if (cachedSize.length == sizeof(v2i)) { MyMemCopy(&atlasSize, cachedSize.chars, sizeof(v2i)); }
+		if (atlasSize.Width <= 0 || atlasSize.Height <= 0 || atlasSize.Width > FONT_ATLAS_MAX_SIZE || atlasSize.Height > FONT_ATLAS_MAX_SIZE)
+		{
+			atlasSize = EstimateFontAtlasSize(fontSizes[sIndex], numCharRanges, charRanges);
+		}
+		
+		Result bakeResult = BakeFontAtlas(font, fontSizes[sIndex], styleFlags, atlasSize, numCharRanges, charRanges);
+		while (bakeResult == Result_NotEnoughSpace && (atlasSize.Width < FONT_ATLAS_MAX_SIZE || atlasSize.Height < FONT_ATLAS_MAX_SIZE))
+		{
+			if (atlasSize.Width <= atlasSize.Height && atlasSize.Width < FONT_ATLAS_MAX_SIZE) { atlasSize.Width *= 2; }
+			else { atlasSize.Height *= 2; }
+			stats.numRebakes++;
+			bakeResult = BakeFontAtlas(font, fontSizes[sIndex], styleFlags, atlasSize, numCharRanges, charRanges);
+		}
+		Assert(bakeResult == Result_Success);
+		Assert(font->atlases.length == atlasIndices[sIndex] + 1);
+		
+		if (!ttfInfoReady)
+		{
+			const u8* ttfBytes = (const u8*)font->ttfFile.chars;
+			ttfInfoReady = (stbtt_InitFont(&ttfInfo, ttfBytes, stbtt_GetFontOffsetForIndex(ttfBytes, 0)) != 0);
+			Assert(ttfInfoReady);
+		}
+		FontAtlas* bakedAtlas = VarArrayGetHard(FontAtlas, &font->atlases, atlasIndices[sIndex]);
+		u8* coverage = RenderFontAtlasCoverage(scratch, &ttfInfo, fontSizes[sIndex], bakedAtlas);
+		atlasCoverages[sIndex] = NewStr8((uxx)bakedAtlas->texture.Width * (uxx)bakedAtlas->texture.Height, (char*)coverage);
+	}
+	PerfTime bakeEndTime = GetPerfTime();
+	stats.bakeMs = GetPerfTimeDiff(&bakeStartTime, &bakeEndTime);
+	
+	PerfTime kerningStartTime = GetPerfTime();
+	Str8 cachedKerning = FindCookedAssetSection(&cookedAsset, CookedSectionType_FontKerningTable, 0);
+	if (!stats.wasCached || !TryRestoreFontKerningTable(font, cachedKerning))
+	{
+		FillFontKerningTable(font);
+		cacheIsDirty = true;
+	}
+	stats.numKerningEntries = font->kerningTable.numEntries;
+	PerfTime kerningEndTime = GetPerfTime();
+	stats.kerningMs = GetPerfTimeDiff(&kerningStartTime, &kerningEndTime);
+	
+	if (cacheIsDirty)
+	{
+		CookedAsset newCookedAsset = ZEROED;
+		InitCookedAsset(scratch, paramsHash, &newCookedAsset);
+		v2i* atlasSizes = AllocArray(v2i, scratch, numSizes);
+		NotNull(atlasSizes);
+		for (uxx sIndex = 0; sIndex < numSizes; sIndex++)
+		{
+			FontAtlas* atlas = VarArrayGetHard(FontAtlas, &font->atlases, atlasIndices[sIndex]);
+			atlasSizes[sIndex] = NewV2i(atlas->texture.Width, atlas->texture.Height);
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_FontAtlasSize, (u32)sIndex, NewStr8(sizeof(v2i), (char*)&atlasSizes[sIndex]));
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_FontAtlasInfo, (u32)sIndex, NewStr8(sizeof(FontAtlas), (char*)atlas));
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_FontAtlasGlyphs, (u32)sIndex, NewStr8(sizeof(FontGlyph) * atlas->glyphs.length, (char*)atlas->glyphs.items));
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_FontAtlasCharRanges, (u32)sIndex, NewStr8(sizeof(FontCharRange) * atlas->charRanges.length, (char*)atlas->charRanges.items));
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_FontAtlasCoverage, (u32)sIndex, atlasCoverages[sIndex]);
+		}
+		AddCookedAssetSection(&newCookedAsset, CookedSectionType_FontKerningTable, 0, NewStr8(sizeof(FontKerningTableEntry) * font->kerningTable.numEntries, (char*)font->kerningTable.entries));
+		stats.wasWritten = WriteCookedAsset(&newCookedAsset, sourcePath);
+	}
+	
+	PrintLine_D("Font \"%.*s\" %llu size%s: %llu restored from cache, %llu rebake%s, %llu kerning entries (bake %.2lfms, kerning %.2lfms)",
+		StrPrint(fontName), (u64)numSizes, Plural(numSizes, "s"),
+		(u64)stats.numRestoredAtlases, (u64)stats.numRebakes, Plural(stats.numRebakes, "s"),
+		(u64)stats.numKerningEntries, stats.bakeMs, stats.kerningMs
+	);
+	if (statsOut != nullptr) { *statsOut = stats; }
+	ScratchEnd(scratch);
+}
@@ -0,0 +1,39 @@
+/*
+File:   app_font_cache.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Remembers what RasterizeFontAtSizes baked last time so startup doesn't have to bake it again.
+	** For every font (name + style) a CookedAsset stores each baked FontAtlas (its metrics, glyph table, char ranges
+	** and coverage pixels) plus the kerning table that FillFontKerningTable built, keyed by a hash of the TTF file,
+	** the name, style, sizes and char ranges. On a hit the atlases are rebuilt and uploaded without calling
+	** BakeFontAtlas at all, on a miss the atlas size is estimated from the glyph count and font size instead of
+	** baking at 256x256 and growing on Result_NotEnoughSpace.
+	** NOTE: BakeFontAtlas uploads its pixels without keeping a copy (and we can't read the texture back) so on a
+	** miss the coverage is rendered again from the TTF into each glyph's atlasSourceRec before it's written out.
+*/
+
+#ifndef _APP_FONT_CACHE_H
+#define _APP_FONT_CACHE_H
+
+#define FONT_CACHE_VERSION          2 //bump when the estimate or anything about the cached data changes
+#define FONT_CACHE_EXTENSION        ".font"
+#define FONT_ATLAS_MIN_SIZE         64
+#define FONT_ATLAS_MAX_SIZE         4096
+#define FONT_ATLAS_GLYPH_PADDING    2 //pixels around each glyph when estimating, covers the packer's padding and rounding
+#define FONT_ATLAS_PACKING_DENSITY  0.80f //fraction of the atlas area we expect the rect packer to actually fill
+
+typedef struct FontCacheStats FontCacheStats;
+struct FontCacheStats
+{
+	bool wasCached; //a cooked file with a matching hash was found
+	bool wasWritten;
+	uxx numSizes;
+	uxx numRestoredAtlases; //atlases rebuilt from the cooked file without baking
+	uxx numRebakes; //bakes that ran out of space and had to try a bigger atlas
+	uxx numKerningEntries;
+	r64 bakeMs;
+	r64 kerningMs;
+};
+
+#endif //  _APP_FONT_CACHE_H
@@ -0,0 +1,741 @@
+/*
+File:   app_glb.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the file mapping functions and the .glb loader (see app_glb.h)
+*/
+
+// +--------------------------------------------------------------+
+// |                         File Mapping                         |
+// +--------------------------------------------------------------+
+void UnmapFile(MappedFile* file)
+{
+	NotNull(file);
+	if (file->isMapped && file->contents.length > 0)
+	{
+		#if TARGET_IS_WINDOWS
+		UnmapViewOfFile(file->contents.chars);
+		CloseHandle(file->mappingHandle);
+		CloseHandle(file->fileHandle);
+		#elif TARGET_IS_LINUX
+		munmap(file->contents.chars, file->contents.length);
+		#endif
+	}
+	else if (file->arena != nullptr && file->contents.chars != nullptr) { FreeMem(file->arena, file->contents.chars, file->contents.length); }
+	ClearPointer(file);
+}
+
+// Maps the whole file read-only. Targets without a mapping implementation (and empty files, which can't be mapped)
+// get the file read into fallbackArena instead so callers never have to care which one happened
+bool TryMapFile(Arena* fallbackArena, FilePath path, MappedFile* fileOut)
+{
+	NotNull(fallbackArena);
+	NotNull(fileOut);
+	ClearPointer(fileOut);
+	ScratchBegin1(scratch, fallbackArena);
+	char* pathNt = AllocArray(char, scratch, path.length + 1);
+	NotNull(pathNt);
+	MyMemCopy(pathNt, path.chars, path.length);
+	pathNt[path.length] = '\0';
+	
+	#if TARGET_IS_WINDOWS
+	HANDLE fileHandle = CreateFileA(pathNt, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (fileHandle != INVALID_HANDLE_VALUE)
+	{
+		LARGE_INTEGER fileSize = ZEROED;
+		HANDLE mappingHandle = NULL;
+		void* view = nullptr;
+		if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0) { mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL); }
+		if (mappingHandle != NULL) { view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0); }
+		if (view != nullptr)
+		{
+			fileOut->isMapped = true;
+			fileOut->contents = NewStr8((uxx)fileSize.QuadPart, (char*)view);
+			fileOut->fileHandle = fileHandle;
+			fileOut->mappingHandle = mappingHandle;
+			ScratchEnd(scratch);
+			return true;
+		}
+		if (mappingHandle != NULL) { CloseHandle(mappingHandle); }
+		CloseHandle(fileHandle);
+	}
+	#elif TARGET_IS_LINUX
+	int fileDescriptor = open(pathNt, O_RDONLY);
+	if (fileDescriptor >= 0)
+	{
+		struct stat fileStat;
+		void* view = MAP_FAILED;
+		if (fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0) { view = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0); }
+		close(fileDescriptor); //the mapping keeps its own reference to the file
+		if (view != MAP_FAILED)
+		{
+			madvise(view, (size_t)fileStat.st_size, MADV_WILLNEED);
+			fileOut->isMapped = true;
+			fileOut->contents = NewStr8((uxx)fileStat.st_size, (char*)view);
+			ScratchEnd(scratch);
+			return true;
+		}
+	}
+	#endif
+	ScratchEnd(scratch);
+	
+	Str8 fileContents = ZEROED;
+	if (!OsReadFile(path, fallbackArena, false, &fileContents)) { return false; }
+	fileOut->arena = fallbackArena;
+	fileOut->contents = fileContents;
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+static Str8 CopyGlbStr(Arena* arena, Str8 str)
+{
+	Str8 result = NewStr8(str.length, nullptr);
+	if (str.length == 0) { return result; }
+	result.chars = AllocArray(char, arena, str.length);
+	NotNull(result.chars);
+	MyMemCopy(result.chars, str.chars, str.length);
+	return result;
+}
+
+static FilePath GetGlbRelativePath(Arena* arena, FilePath folder, Str8 uri)
+{
+	return PrintInArenaStr(arena, "%.*s%.*s", StrPrint(folder), StrPrint(uri));
+}
+
+static inline u32 ReadGlbU32(const u8* bytes)
+{
+	return ((u32)bytes[0] << 0) | ((u32)bytes[1] << 8) | ((u32)bytes[2] << 16) | ((u32)bytes[3] << 24);
+}
+
+static inline quat MulGlbQuat(quat left, quat right)
+{
+	return NewQuat(
+		left.W*right.X + left.X*right.W + left.Y*right.Z - left.Z*right.Y,
+		left.W*right.Y - left.X*right.Z + left.Y*right.W + left.Z*right.X,
+		left.W*right.Z + left.X*right.Y - left.Y*right.X + left.Z*right.W,
+		left.W*right.W - left.X*right.X - left.Y*right.Y - left.Z*right.Z
+	);
+}
+
+static inline v3 RotateGlbVec(quat rotation, v3 vector)
+{
+	v3 axis = NewV3(rotation.X, rotation.Y, rotation.Z);
+	v3 crossOnce = Cross(axis, vector);
+	v3 crossTwice = Cross(axis, crossOnce);
+	return NewV3(
+		vector.X + 2.0f * (rotation.W * crossOnce.X + crossTwice.X),
+		vector.Y + 2.0f * (rotation.W * crossOnce.Y + crossTwice.Y),
+		vector.Z + 2.0f * (rotation.W * crossOnce.Z + crossTwice.Z)
+	);
+}
+
+// glTF matrices are column major. Shear can't be represented in a TRS so it's dropped
+static void DecomposeGlbMatrix(const r32* matrix, GlbTransform* transformOut)
+{
+	v3 columns[3] = {
+		NewV3(matrix[0], matrix[1], matrix[2]),
+		NewV3(matrix[4], matrix[5], matrix[6]),
+		NewV3(matrix[8], matrix[9], matrix[10]),
+	};
+	transformOut->position = NewV3(matrix[12], matrix[13], matrix[14]);
+	transformOut->scale = NewV3(Length(columns[0]), Length(columns[1]), Length(columns[2]));
+	if (Dot(Cross(columns[0], columns[1]), columns[2]) < 0.0f) { transformOut->scale.X = -transformOut->scale.X; }
+	r32 basis[3][3];
+	for (uxx cIndex = 0; cIndex < 3; cIndex++)
+	{
+		r32 axisScale = (cIndex == 0) ? transformOut->scale.X : ((cIndex == 1) ? transformOut->scale.Y : transformOut->scale.Z);
+		r32 inverseScale = (axisScale != 0.0f) ? (1.0f / axisScale) : 0.0f;
+		basis[cIndex][0] = columns[cIndex].X * inverseScale;
+		basis[cIndex][1] = columns[cIndex].Y * inverseScale;
+		basis[cIndex][2] = columns[cIndex].Z * inverseScale;
+	}
+	//basis[column][row], the usual trace based matrix to quaternion conversion
+	r32 trace = basis[0][0] + basis[1][1] + basis[2][2];
+	quat rotation;
+	if (trace > 0.0f)
+	{
+		r32 scale = SqrtR32(trace + 1.0f) * 2.0f;
+		rotation = NewQuat((basis[1][2] - basis[2][1]) / scale, (basis[2][0] - basis[0][2]) / scale, (basis[0][1] - basis[1][0]) / scale, 0.25f * scale);
+	}
+	else if (basis[0][0] > basis[1][1] && basis[0][0] > basis[2][2])
+	{
+		r32 scale = SqrtR32(1.0f + basis[0][0] - basis[1][1] - basis[2][2]) * 2.0f;
+		rotation = NewQuat(0.25f * scale, (basis[1][0] + basis[0][1]) / scale, (basis[2][0] + basis[0][2]) / scale, (basis[1][2] - basis[2][1]) / scale);
+	}
+	else if (basis[1][1] > basis[2][2])
+	{
+		r32 scale = SqrtR32(1.0f + basis[1][1] - basis[0][0] - basis[2][2]) * 2.0f;
+		rotation = NewQuat((basis[1][0] + basis[0][1]) / scale, 0.25f * scale, (basis[2][1] + basis[1][2]) / scale, (basis[2][0] - basis[0][2]) / scale);
+	}
+	else
+	{
+		r32 scale = SqrtR32(1.0f + basis[2][2] - basis[0][0] - basis[1][1]) * 2.0f;
+		rotation = NewQuat((basis[2][0] + basis[0][2]) / scale, (basis[2][1] + basis[1][2]) / scale, 0.25f * scale, (basis[0][1] - basis[1][0]) / scale);
+	}
+	transformOut->rotation = rotation;
+}
+
+static void ReadGlbNumbers(const JsonDocument* json, const JsonValue* array, r32* valuesOut, uxx numValues)
+{
+	for (uxx vIndex = 0; vIndex < numValues && vIndex < GetJsonLength(array); vIndex++)
+	{
+		valuesOut[vIndex] = (r32)GetJsonNumber(GetJsonElement(json, array, vIndex), (r64)valuesOut[vIndex]);
+	}
+}
+
+static u32 GetGlbTypeNumComponents(Str8 type)
+{
+	const char* typeNames[] = { "SCALAR", "VEC2", "VEC3", "VEC4", "MAT2", "MAT3", "MAT4" };
+	const u32 typeNumComponents[] = { 1, 2, 3, 4, 4, 9, 16 };
+	for (uxx tIndex = 0; tIndex < ArrayCount(typeNames); tIndex++)
+	{
+		uxx nameLength = MyStrLength64(typeNames[tIndex]);
+		if (type.length == nameLength && MyMemCompare(type.chars, typeNames[tIndex], nameLength) == 0) { return typeNumComponents[tIndex]; }
+	}
+	return 0;
+}
+
+static u32 GetGlbComponentSize(u32 componentType)
+{
+	switch (componentType)
+	{
+		case GLTF_COMPONENT_I8:  return 1;
+		case GLTF_COMPONENT_U8:  return 1;
+		case GLTF_COMPONENT_I16: return 2;
+		case GLTF_COMPONENT_U16: return 2;
+		case GLTF_COMPONENT_U32: return 4;
+		case GLTF_COMPONENT_F32: return 4;
+		default: return 0;
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                          Accessors                           |
+// +--------------------------------------------------------------+
+// Resolves the accessor down to a pointer into the mapping, after checking every element is inside its bufferView and buffer
+static bool TryGetGlbAccessor(const GlbLoader* loader, uxx accessorIndex, GlbAccessor* accessorOut)
+{
+	const JsonDocument* json = &loader->json;
+	const JsonValue* accessor = GetJsonElement(json, GetJsonMember(json, loader->root, "accessors"), accessorIndex);
+	if (accessor == nullptr) { return false; }
+	if (GetJsonMember(json, accessor, "sparse") != nullptr) { PrintLine_W("GLB accessor %llu is sparse, which isn't supported", (u64)accessorIndex); return false; }
+	ClearPointer(accessorOut);
+	accessorOut->count = (uxx)GetJsonMemberNumber(json, accessor, "count", 0.0);
+	accessorOut->componentType = (u32)GetJsonMemberNumber(json, accessor, "componentType", 0.0);
+	accessorOut->numComponents = GetGlbTypeNumComponents(GetJsonString(GetJsonMember(json, accessor, "type")));
+	accessorOut->normalized = GetJsonBool(GetJsonMember(json, accessor, "normalized"), false);
+	accessorOut->bufferViewIndex = GetJsonMemberIndex(json, accessor, "bufferView");
+	accessorOut->offsetInView = (uxx)GetJsonMemberNumber(json, accessor, "byteOffset", 0.0);
+	uxx elementSize = (uxx)GetGlbComponentSize(accessorOut->componentType) * accessorOut->numComponents;
+	if (elementSize == 0 || accessorOut->count == 0) { return false; }
+	
+	const JsonValue* bufferView = GetJsonElement(json, GetJsonMember(json, loader->root, "bufferViews"), accessorOut->bufferViewIndex);
+	if (bufferView == nullptr) { return false; }
+	uxx bufferIndex = GetJsonMemberIndex(json, bufferView, "buffer");
+	uxx viewOffset = (uxx)GetJsonMemberNumber(json, bufferView, "byteOffset", 0.0);
+	uxx viewLength = (uxx)GetJsonMemberNumber(json, bufferView, "byteLength", 0.0);
+	accessorOut->stride = (uxx)GetJsonMemberNumber(json, bufferView, "byteStride", 0.0);
+	if (accessorOut->stride == 0) { accessorOut->stride = elementSize; }
+	if (bufferIndex >= loader->glb->buffers.length) { return false; }
+	Str8 buffer = *VarArrayGetHard(Str8, &loader->glb->buffers, bufferIndex);
+	if (viewOffset > buffer.length || viewLength > buffer.length - viewOffset) { return false; }
+	uxx accessorEnd = accessorOut->offsetInView + (accessorOut->stride * (accessorOut->count - 1)) + elementSize;
+	if (accessorEnd > viewLength) { return false; }
+	accessorOut->data = (const u8*)buffer.chars + viewOffset + accessorOut->offsetInView;
+	return true;
+}
+
+// Reads up to numValues components of one element as floats, normalized integers are mapped to [0, 1] or [-1, 1]
+static inline void ReadGlbAccessorFloats(const GlbAccessor* accessor, uxx elementIndex, r32* valuesOut, u32 numValues)
+{
+	const u8* element = accessor->data + (elementIndex * accessor->stride);
+	u32 numComponents = (accessor->numComponents < numValues) ? accessor->numComponents : numValues;
+	if (accessor->componentType == GLTF_COMPONENT_F32) { MyMemCopy(valuesOut, element, sizeof(r32) * numComponents); return; }
+	for (u32 cIndex = 0; cIndex < numComponents; cIndex++)
+	{
+		r32 value = 0.0f;
+		switch (accessor->componentType)
+		{
+			case GLTF_COMPONENT_U8:  value = accessor->normalized ? ((r32)element[cIndex] / 255.0f) : (r32)element[cIndex]; break;
+			case GLTF_COMPONENT_I8:  value = accessor->normalized ? MaxR32((r32)(i8)element[cIndex] / 127.0f, -1.0f) : (r32)(i8)element[cIndex]; break;
+			case GLTF_COMPONENT_U16: { u16 raw; MyMemCopy(&raw, &element[cIndex * 2], sizeof(raw)); value = accessor->normalized ? ((r32)raw / 65535.0f) : (r32)raw; } break;
+			case GLTF_COMPONENT_I16: { i16 raw; MyMemCopy(&raw, &element[cIndex * 2], sizeof(raw)); value = accessor->normalized ? MaxR32((r32)raw / 32767.0f, -1.0f) : (r32)raw; } break;
+			case GLTF_COMPONENT_U32: { u32 raw; MyMemCopy(&raw, &element[cIndex * 4], sizeof(raw)); value = (r32)raw; } break;
+		}
+		valuesOut[cIndex] = value;
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                           Loading                            |
+// +--------------------------------------------------------------+
+bool IsGlbFilePath(FilePath path)
+{
+	if (path.length < 4) { return false; }
+	const char* extension = &path.chars[path.length - 4];
+	return (extension[0] == '.' && (extension[1] | 0x20) == 'g' && (extension[2] | 0x20) == 'l' && (extension[3] | 0x20) == 'b');
+}
+
+void CloseGlbFile(GlbFile* glb)
+{
+	NotNull(glb);
+	if (glb->arena != nullptr)
+	{
+		VarArrayLoop(&glb->externalBuffers, bIndex) { UnmapFile(VarArrayGetHard(MappedFile, &glb->externalBuffers, bIndex)); }
+		FreeVarArray(&glb->externalBuffers);
+		FreeVarArray(&glb->buffers);
+	}
+	UnmapFile(&glb->file);
+	ClearPointer(glb);
+}
+
+// Frees what TryLoadGlbFile allocated. Names are allocated at their exact length and every texture's
+// pixels (decoded or the 1x1 metallic/roughness ones) at width * height
+void FreeGlbModelData(Arena* arena, ModelData* modelData)
+{
+	NotNull(arena);
+	NotNull(modelData);
+	VarArrayLoop(&modelData->parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &modelData->parts, pIndex);
+		if (part->name.length > 0) { FreeMem(arena, part->name.chars, part->name.length); }
+		FreeVarArray(&part->vertices);
+		FreeVarArray(&part->indices);
+	}
+	VarArrayLoop(&modelData->textures, tIndex)
+	{
+		VarArrayLoopGet(ModelDataTexture, texture, &modelData->textures, tIndex);
+		if (texture->name.length > 0) { FreeMem(arena, texture->name.chars, texture->name.length); }
+		if (texture->imageData.pixels != nullptr) { FreeMem(arena, texture->imageData.pixels, sizeof(u32) * (uxx)(texture->imageData.size.Width * texture->imageData.size.Height)); }
+	}
+	FreeVarArray(&modelData->parts);
+	FreeVarArray(&modelData->materials);
+	FreeVarArray(&modelData->textures);
+	ClearPointer(modelData);
+}
+
+// The image's bytes come straight out of the mapping when it's stored in a bufferView, a uri is read from next to the file
+static bool TryGetGlbEncodedImage(const GlbLoader* loader, Arena* scratch, uxx imageIndex, Str8* encodedOut)
+{
+	const JsonDocument* json = &loader->json;
+	const JsonValue* image = GetJsonElement(json, GetJsonMember(json, loader->root, "images"), imageIndex);
+	uxx bufferViewIndex = GetJsonMemberIndex(json, image, "bufferView");
+	Str8 uri = GetJsonString(GetJsonMember(json, image, "uri"));
+	Str8 encodedImage = ZEROED;
+	if (bufferViewIndex != GLB_INDEX_NONE)
+	{
+		const JsonValue* bufferView = GetJsonElement(json, GetJsonMember(json, loader->root, "bufferViews"), bufferViewIndex);
+		uxx bufferIndex = GetJsonMemberIndex(json, bufferView, "buffer");
+		uxx viewOffset = (uxx)GetJsonMemberNumber(json, bufferView, "byteOffset", 0.0);
+		uxx viewLength = (uxx)GetJsonMemberNumber(json, bufferView, "byteLength", 0.0);
+		if (bufferIndex >= loader->glb->buffers.length) { return false; }
+		Str8 buffer = *VarArrayGetHard(Str8, &loader->glb->buffers, bufferIndex);
+		if (viewOffset > buffer.length || viewLength > buffer.length - viewOffset) { return false; }
+		encodedImage = NewStr8(viewLength, buffer.chars + viewOffset);
+	}
+	else if (uri.length > 5 && MyMemCompare(uri.chars, "data:", 5) == 0) { PrintLine_W("GLB image %llu is a data uri, which isn't supported", (u64)imageIndex); return false; }
+	else if (uri.length > 0)
+	{
+		FilePath imagePath = GetGlbRelativePath(scratch, loader->glb->folder, uri);
+		if (!OsReadFile(imagePath, scratch, false, &encodedImage)) { PrintLine_W("Missing GLB texture \"%.*s\"", StrPrint(imagePath)); return false; }
+	}
+	else { return false; }
+	*encodedOut = encodedImage;
+	return true;
+}
+
+static uxx AddGlbTexture(GlbLoader* loader, Str8 name, ImageData imageData)
+{
+	ModelDataTexture* newTexture = VarArrayAdd(ModelDataTexture, &loader->modelData->textures);
+	NotNull(newTexture);
+	ClearPointer(newTexture);
+	newTexture->name = CopyGlbStr(loader->arena, name);
+	newTexture->imageData = imageData;
+	return loader->modelData->textures.length - 1;
+}
+
+// textureInfo is a material's { "index": N } object, the result indexes the ModelData's textures
+static uxx GetGlbTextureIndex(const GlbLoader* loader, const JsonValue* textureInfo)
+{
+	const JsonDocument* json = &loader->json;
+	const JsonValue* texture = GetJsonElement(json, GetJsonMember(json, loader->root, "textures"), GetJsonMemberIndex(json, textureInfo, "index"));
+	uxx imageIndex = GetJsonMemberIndex(json, texture, "source");
+	return (imageIndex < loader->numImages) ? loader->imageTextureIndices[imageIndex] : GLB_INDEX_NONE;
+}
+
+// Our shaders have no metallic/roughness factors so materials without a metallicRoughnessTexture get a 1x1 one holding the factors
+static uxx AddGlbMetallicRoughnessTexture(GlbLoader* loader, Str8 materialName, r32 metallic, r32 roughness)
+{
+	ImageData imageData = ZEROED;
+	imageData.size = NewV2i(1, 1);
+	imageData.pixels = AllocArray(u32, loader->arena, 1);
+	NotNull(imageData.pixels);
+	u8 metallicValue = (u8)(ClampR32(metallic, 0.0f, 1.0f) * 255.0f + 0.5f);
+	u8 roughnessValue = (u8)(ClampR32(roughness, 0.0f, 1.0f) * 255.0f + 0.5f);
+	imageData.pixels[0] = 0xFF0000FF | ((u32)roughnessValue << 8) | ((u32)metallicValue << 16);
+	Str8 name = PrintInArenaStr(loader->scratch, "%.*s_MetallicRoughness", StrPrint(materialName));
+	return AddGlbTexture(loader, name, imageData);
+}
+
+static void AddGlbMaterial(GlbLoader* loader, const JsonValue* material, Str8 name)
+{
+	const JsonDocument* json = &loader->json;
+	const JsonValue* pbr = GetJsonMember(json, material, "pbrMetallicRoughness");
+	r32 albedoFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	ReadGlbNumbers(json, GetJsonMember(json, pbr, "baseColorFactor"), &albedoFactor[0], 4);
+	ModelDataMaterial* newMaterial = VarArrayAdd(ModelDataMaterial, &loader->modelData->materials);
+	NotNull(newMaterial);
+	ClearPointer(newMaterial);
+	newMaterial->albedoFactor.R = albedoFactor[0];
+	newMaterial->albedoFactor.G = albedoFactor[1];
+	newMaterial->albedoFactor.B = albedoFactor[2];
+	newMaterial->albedoFactor.A = albedoFactor[3];
+	newMaterial->albedoTextureIndex = GetGlbTextureIndex(loader, GetJsonMember(json, pbr, "baseColorTexture"));
+	newMaterial->normalTextureIndex = GetGlbTextureIndex(loader, GetJsonMember(json, material, "normalTexture"));
+	newMaterial->ambientOcclusionTextureIndex = GetGlbTextureIndex(loader, GetJsonMember(json, material, "occlusionTexture"));
+	//NOTE: metallicFactor/roughnessFactor are ignored when there is a texture, they are almost always 1 in that case
+	newMaterial->metallicRoughnessTextureIndex = GetGlbTextureIndex(loader, GetJsonMember(json, pbr, "metallicRoughnessTexture"));
+	if (newMaterial->metallicRoughnessTextureIndex == GLB_INDEX_NONE)
+	{
+		r32 metallic = (r32)GetJsonMemberNumber(json, pbr, "metallicFactor", 1.0);
+		r32 roughness = (r32)GetJsonMemberNumber(json, pbr, "roughnessFactor", 1.0);
+		newMaterial->metallicRoughnessTextureIndex = AddGlbMetallicRoughnessTexture(loader, name, metallic, roughness);
+	}
+}
+
+// Adds one part for a triangle primitive, returns false (without adding anything) when the primitive can't be read
+static bool AddGlbPrimitivePart(GlbLoader* loader, const JsonValue* primitive, Str8 name, const GlbTransform* transform)
+{
+	const JsonDocument* json = &loader->json;
+	if ((uxx)GetJsonMemberNumber(json, primitive, "mode", GLTF_MODE_TRIANGLES) != GLTF_MODE_TRIANGLES) { return false; }
+	const JsonValue* attributes = GetJsonMember(json, primitive, "attributes");
+	//TANGENT is ignored, GenerateModelTangents makes the same MikkTSpace tangents for every part no matter where it came from
+	GlbAccessor position, normal, texCoord, color, indices;
+	if (!TryGetGlbAccessor(loader, GetJsonMemberIndex(json, attributes, "POSITION"), &position) || position.numComponents != 3) { return false; }
+	bool hasNormals = TryGetGlbAccessor(loader, GetJsonMemberIndex(json, attributes, "NORMAL"), &normal) && normal.count == position.count;
+	bool hasTexCoords = TryGetGlbAccessor(loader, GetJsonMemberIndex(json, attributes, "TEXCOORD_0"), &texCoord) && texCoord.count == position.count;
+	bool hasColors = TryGetGlbAccessor(loader, GetJsonMemberIndex(json, attributes, "COLOR_0"), &color) && color.count == position.count;
+	uxx indicesIndex = GetJsonMemberIndex(json, primitive, "indices");
+	bool hasIndices = (indicesIndex != GLB_INDEX_NONE);
+	if (hasIndices && (!TryGetGlbAccessor(loader, indicesIndex, &indices) || indices.numComponents != 1)) { return false; }
+	uxx numVertices = position.count;
+	uxx numIndices = hasIndices ? indices.count : numVertices;
+	
+	uxx materialIndex = GetJsonMemberIndex(json, primitive, "material");
+	if (materialIndex >= loader->numMaterials)
+	{
+		if (loader->defaultMaterialIndex == GLB_INDEX_NONE)
+		{
+			loader->defaultMaterialIndex = loader->modelData->materials.length;
+			AddGlbMaterial(loader, nullptr, StrLit("default"));
+		}
+		materialIndex = loader->defaultMaterialIndex;
+	}
+	
+	ModelDataPart* part = VarArrayAdd(ModelDataPart, &loader->modelData->parts);
+	NotNull(part);
+	ClearPointer(part);
+	part->name = CopyGlbStr(loader->arena, name);
+	part->materialIndex = materialIndex;
+	part->transform.position = transform->position;
+	part->transform.rotation = transform->rotation;
+	part->transform.scale = transform->scale;
+	InitVarArrayWithInitial(Vertex3D, &part->vertices, loader->arena, numVertices);
+	InitVarArrayWithInitial(i32, &part->indices, loader->arena, numIndices);
+	for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+	{
+		Vertex3D* newVertex = VarArrayAdd(Vertex3D, &part->vertices);
+		NotNull(newVertex);
+		ClearPointer(newVertex);
+		ReadGlbAccessorFloats(&position, vIndex, &newVertex->position.X, 3);
+		if (hasNormals) { ReadGlbAccessorFloats(&normal, vIndex, &newVertex->normal.X, 3); }
+		if (hasTexCoords) { ReadGlbAccessorFloats(&texCoord, vIndex, &newVertex->texCoord.X, 2); }
+		r32 colorValues[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		if (hasColors) { ReadGlbAccessorFloats(&color, vIndex, &colorValues[0], 4); }
+		newVertex->color.R = colorValues[0];
+		newVertex->color.G = colorValues[1];
+		newVertex->color.B = colorValues[2];
+		newVertex->color.A = colorValues[3];
+	}
+	
+	//Triangles with an index past the end of the vertices are dropped
+	for (uxx iIndex = 0; iIndex + 3 <= numIndices; iIndex += 3)
+	{
+		u32 triangle[3];
+		for (uxx cIndex = 0; cIndex < 3; cIndex++)
+		{
+			uxx sourceIndex = iIndex + cIndex;
+			if (!hasIndices) { triangle[cIndex] = (u32)sourceIndex; continue; }
+			const u8* element = indices.data + (sourceIndex * indices.stride);
+			switch (indices.componentType)
+			{
+				case GLTF_COMPONENT_U8:  triangle[cIndex] = element[0]; break;
+				case GLTF_COMPONENT_U16: { u16 value; MyMemCopy(&value, element, sizeof(value)); triangle[cIndex] = value; } break;
+				case GLTF_COMPONENT_U32: { MyMemCopy(&triangle[cIndex], element, sizeof(u32)); } break;
+				default: triangle[cIndex] = UINT32_MAX; break;
+			}
+		}
+		if (triangle[0] >= numVertices || triangle[1] >= numVertices || triangle[2] >= numVertices) { continue; }
+		*VarArrayAdd(i32, &part->indices) = (i32)triangle[0];
+		*VarArrayAdd(i32, &part->indices) = (i32)triangle[1];
+		*VarArrayAdd(i32, &part->indices) = (i32)triangle[2];
+	}
+	
+	if (!hasNormals)
+	{
+		//Area weighted face normals, the cross product's length is twice the triangle's area
+		Vertex3D* vertices = (Vertex3D*)part->vertices.items;
+		const i32* partIndices = (const i32*)part->indices.items;
+		for (uxx iIndex = 0; iIndex + 3 <= part->indices.length; iIndex += 3)
+		{
+			v3 edge1 = Sub(vertices[partIndices[iIndex+1]].position, vertices[partIndices[iIndex+0]].position);
+			v3 edge2 = Sub(vertices[partIndices[iIndex+2]].position, vertices[partIndices[iIndex+0]].position);
+			v3 faceNormal = Cross(edge1, edge2);
+			for (uxx cIndex = 0; cIndex < 3; cIndex++) { vertices[partIndices[iIndex+cIndex]].normal = Add(vertices[partIndices[iIndex+cIndex]].normal, faceNormal); }
+		}
+		for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+		{
+			vertices[vIndex].normal = (LengthSquared(vertices[vIndex].normal) > 1e-20f) ? Normalize(vertices[vIndex].normal) : V3_Up;
+		}
+	}
+	
+	loader->stats.numVertices += numVertices;
+	loader->stats.numTriangles += part->indices.length / 3;
+	return true;
+}
+
+static void AddGlbNode(GlbLoader* loader, uxx nodeIndex, const GlbTransform* parentTransform, uxx depth)
+{
+	const JsonDocument* json = &loader->json;
+	const JsonValue* node = GetJsonElement(json, GetJsonMember(json, loader->root, "nodes"), nodeIndex);
+	if (node == nullptr || depth >= GLB_MAX_NODE_DEPTH) { return; }
+	GlbTransform localTransform = ZEROED;
+	const JsonValue* matrix = GetJsonMember(json, node, "matrix");
+	if (matrix != nullptr)
+	{
+		r32 values[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+		ReadGlbNumbers(json, matrix, &values[0], 16);
+		DecomposeGlbMatrix(&values[0], &localTransform);
+	}
+	else
+	{
+		r32 translation[3] = { 0.0f, 0.0f, 0.0f };
+		r32 rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		r32 scale[3] = { 1.0f, 1.0f, 1.0f };
+		ReadGlbNumbers(json, GetJsonMember(json, node, "translation"), &translation[0], 3);
+		ReadGlbNumbers(json, GetJsonMember(json, node, "rotation"), &rotation[0], 4);
+		ReadGlbNumbers(json, GetJsonMember(json, node, "scale"), &scale[0], 3);
+		localTransform.position = NewV3(translation[0], translation[1], translation[2]);
+		localTransform.rotation = NewQuat(rotation[0], rotation[1], rotation[2], rotation[3]);
+		localTransform.scale = NewV3(scale[0], scale[1], scale[2]);
+	}
+	//NOTE: Exact for uniform scale, a non-uniform parent scale under a rotated child would need shear which a TRS can't hold
+	GlbTransform worldTransform = ZEROED;
+	worldTransform.position = Add(parentTransform->position, RotateGlbVec(parentTransform->rotation, NewV3(localTransform.position.X * parentTransform->scale.X, localTransform.position.Y * parentTransform->scale.Y, localTransform.position.Z * parentTransform->scale.Z)));
+	worldTransform.rotation = MulGlbQuat(parentTransform->rotation, localTransform.rotation);
+	worldTransform.scale = NewV3(parentTransform->scale.X * localTransform.scale.X, parentTransform->scale.Y * localTransform.scale.Y, parentTransform->scale.Z * localTransform.scale.Z);
+	
+	const JsonValue* mesh = GetJsonElement(json, GetJsonMember(json, loader->root, "meshes"), GetJsonMemberIndex(json, node, "mesh"));
+	if (mesh != nullptr)
+	{
+		const JsonValue* primitives = GetJsonMember(json, mesh, "primitives");
+		Str8 meshName = GetJsonString(GetJsonMember(json, mesh, "name"));
+		if (meshName.length == 0) { meshName = PrintInArenaStr(loader->scratch, "mesh%llu", (u64)GetJsonMemberIndex(json, node, "mesh")); }
+		for (uxx pIndex = 0; pIndex < GetJsonLength(primitives); pIndex++)
+		{
+			Str8 partName = (GetJsonLength(primitives) > 1) ? PrintInArenaStr(loader->scratch, "%.*s_%llu", StrPrint(meshName), (u64)pIndex) : meshName;
+			if (!AddGlbPrimitivePart(loader, GetJsonElement(json, primitives, pIndex), partName, &worldTransform)) { loader->stats.numSkippedPrimitives++; }
+		}
+	}
+	const JsonValue* children = GetJsonMember(json, node, "children");
+	for (uxx cIndex = 0; cIndex < GetJsonLength(children); cIndex++)
+	{
+		AddGlbNode(loader, (uxx)GetJsonNumber(GetJsonElement(json, children, cIndex), -1.0), &worldTransform, depth + 1);
+	}
+}
+
+// Maps filePath and fills modelDataOut from it, everything in modelDataOut is a copy and the mapping is closed before this returns.
+// The PNGs are decoded one job each, free the result with FreeGlbModelData
+Result TryLoadGlbFile(JobSystem* jobs, FilePath filePath, Arena* arena, ModelData* modelDataOut)
+{
+	NotNull(arena);
+	NotNull(modelDataOut);
+	GlbFile glb = ZEROED;
+	ScratchBegin1(scratch, arena);
+	PerfTime mapStart = GetPerfTime();
+	GlbLoader loader = ZEROED;
+	loader.arena = arena;
+	loader.scratch = scratch;
+	loader.glb = &glb;
+	loader.modelData = modelDataOut;
+	loader.defaultMaterialIndex = GLB_INDEX_NONE;
+	if (!TryMapFile(arena, filePath, &glb.file)) { ScratchEnd(scratch); return Result_FailedToReadFile; }
+	glb.arena = arena;
+	glb.folder = filePath;
+	while (glb.folder.length > 0 && glb.folder.chars[glb.folder.length-1] != '/' && glb.folder.chars[glb.folder.length-1] != '\\') { glb.folder.length--; }
+	InitVarArray(Str8, &glb.buffers, arena);
+	InitVarArray(MappedFile, &glb.externalBuffers, arena);
+	loader.stats.fileSize = glb.file.contents.length;
+	
+	// +==============================+
+	// |        Header/Chunks         |
+	// +==============================+
+	const u8* fileBytes = (const u8*)glb.file.contents.chars;
+	uxx fileSize = glb.file.contents.length;
+	if (fileSize < GLB_HEADER_SIZE + 8 || ReadGlbU32(&fileBytes[0]) != GLB_MAGIC || ReadGlbU32(&fileBytes[4]) != GLB_VERSION)
+	{
+		PrintLine_E("\"%.*s\" isn't a version %d GLB file", StrPrint(filePath), GLB_VERSION);
+		CloseGlbFile(&glb);
+		ScratchEnd(scratch);
+		return Result_Failure;
+	}
+	uxx totalLength = (uxx)ReadGlbU32(&fileBytes[8]);
+	if (totalLength < fileSize) { fileSize = totalLength; }
+	Str8 jsonChunk = ZEROED;
+	Str8 binChunk = ZEROED;
+	for (uxx chunkOffset = GLB_HEADER_SIZE; chunkOffset + 8 <= fileSize; )
+	{
+		uxx chunkLength = (uxx)ReadGlbU32(&fileBytes[chunkOffset + 0]);
+		u32 chunkType = ReadGlbU32(&fileBytes[chunkOffset + 4]);
+		if (chunkLength > fileSize - (chunkOffset + 8)) { break; }
+		Str8 chunkContents = NewStr8(chunkLength, (char*)&fileBytes[chunkOffset + 8]);
+		if (chunkType == GLB_CHUNK_JSON && jsonChunk.chars == nullptr) { jsonChunk = chunkContents; }
+		else if (chunkType == GLB_CHUNK_BIN && binChunk.chars == nullptr) { binChunk = chunkContents; }
+		chunkOffset += 8 + chunkLength;
+	}
+	if (jsonChunk.length == 0 || !TryParseJson(scratch, jsonChunk, &loader.json))
+	{
+		PrintLine_E("Failed to parse the JSON chunk of \"%.*s\" (at byte %llu)", StrPrint(filePath), (u64)loader.json.errorOffset);
+		CloseGlbFile(&glb);
+		ScratchEnd(scratch);
+		return Result_Failure;
+	}
+	loader.root = GetJsonRoot(&loader.json);
+	ClearPointer(modelDataOut);
+	InitVarArrayWithInitial(ModelDataPart, &modelDataOut->parts, arena, GetJsonLength(GetJsonMember(&loader.json, loader.root, "meshes")) + 1);
+	InitVarArrayWithInitial(ModelDataMaterial, &modelDataOut->materials, arena, GetJsonLength(GetJsonMember(&loader.json, loader.root, "materials")) + 1);
+	InitVarArrayWithInitial(ModelDataTexture, &modelDataOut->textures, arena, GetJsonLength(GetJsonMember(&loader.json, loader.root, "images")) + 1);
+	const JsonValue* buffers = GetJsonMember(&loader.json, loader.root, "buffers");
+	for (uxx bIndex = 0; bIndex < GetJsonLength(buffers); bIndex++)
+	{
+		const JsonValue* buffer = GetJsonElement(&loader.json, buffers, bIndex);
+		Str8 uri = GetJsonString(GetJsonMember(&loader.json, buffer, "uri"));
+		Str8* newBuffer = VarArrayAdd(Str8, &glb.buffers);
+		NotNull(newBuffer);
+		*newBuffer = (bIndex == 0 && uri.length == 0) ? binChunk : NewStr8(0, nullptr);
+		if (uri.length == 0 || (uri.length > 5 && MyMemCompare(uri.chars, "data:", 5) == 0)) { continue; }
+		MappedFile* newExternal = VarArrayAdd(MappedFile, &glb.externalBuffers);
+		NotNull(newExternal);
+		FilePath bufferPath = GetGlbRelativePath(scratch, glb.folder, uri);
+		if (TryMapFile(arena, bufferPath, newExternal)) { *newBuffer = newExternal->contents; }
+		else { PrintLine_W("Missing GLB buffer \"%.*s\"", StrPrint(bufferPath)); glb.externalBuffers.length--; }
+	}
+	PerfTime mapEnd = GetPerfTime();
+	loader.stats.mapMs = GetPerfTimeDiff(&mapStart, &mapEnd);
+	
+	// +==============================+
+	// |        Images/Materials      |
+	// +==============================+
+	PerfTime imageStart = GetPerfTime();
+	const JsonValue* images = GetJsonMember(&loader.json, loader.root, "images");
+	loader.numImages = GetJsonLength(images);
+	loader.imageTextureIndices = AllocArray(uxx, scratch, loader.numImages + 1);
+	NotNull(loader.imageTextureIndices);
+	PngImageDecode* decodes = AllocArray(PngImageDecode, scratch, loader.numImages + 1);
+	NotNull(decodes);
+	for (uxx iIndex = 0; iIndex < loader.numImages; iIndex++)
+	{
+		ClearPointer(&decodes[iIndex]);
+		TryGetGlbEncodedImage(&loader, scratch, iIndex, &decodes[iIndex].encoded); //left empty when it can't be found, DecodePngImages skips those
+	}
+	DecodePngImages(jobs, arena, loader.numImages, decodes);
+	for (uxx iIndex = 0; iIndex < loader.numImages; iIndex++)
+	{
+		loader.imageTextureIndices[iIndex] = GLB_INDEX_NONE;
+		if (!decodes[iIndex].decoded) { PrintLine_W("Failed to decode GLB image %llu in \"%.*s\"", (u64)iIndex, StrPrint(filePath)); continue; }
+		Str8 imageName = GetJsonString(GetJsonMember(&loader.json, GetJsonElement(&loader.json, images, iIndex), "name"));
+		if (imageName.length == 0) { imageName = PrintInArenaStr(scratch, "image%llu", (u64)iIndex); }
+		loader.imageTextureIndices[iIndex] = AddGlbTexture(&loader, imageName, decodes[iIndex].imageData);
+	}
+	const JsonValue* materials = GetJsonMember(&loader.json, loader.root, "materials");
+	loader.numMaterials = GetJsonLength(materials);
+	for (uxx mIndex = 0; mIndex < loader.numMaterials; mIndex++)
+	{
+		const JsonValue* material = GetJsonElement(&loader.json, materials, mIndex);
+		Str8 materialName = GetJsonString(GetJsonMember(&loader.json, material, "name"));
+		if (materialName.length == 0) { materialName = PrintInArenaStr(scratch, "material%llu", (u64)mIndex); }
+		AddGlbMaterial(&loader, material, materialName);
+	}
+	PerfTime imageEnd = GetPerfTime();
+	loader.stats.imageMs = GetPerfTimeDiff(&imageStart, &imageEnd);
+	
+	// +==============================+
+	// |            Meshes            |
+	// +==============================+
+	PerfTime meshStart = GetPerfTime();
+	GlbTransform rootTransform = ZEROED;
+	rootTransform.position = V3_Zero;
+	rootTransform.rotation = Quat_Identity;
+	rootTransform.scale = V3_One;
+	const JsonValue* scenes = GetJsonMember(&loader.json, loader.root, "scenes");
+	const JsonValue* nodes = GetJsonMember(&loader.json, loader.root, "nodes");
+	uxx sceneIndex = GetJsonMemberIndex(&loader.json, loader.root, "scene");
+	const JsonValue* scene = GetJsonElement(&loader.json, scenes, (sceneIndex != GLB_INDEX_NONE) ? sceneIndex : 0);
+	if (scene != nullptr)
+	{
+		const JsonValue* sceneNodes = GetJsonMember(&loader.json, scene, "nodes");
+		for (uxx nIndex = 0; nIndex < GetJsonLength(sceneNodes); nIndex++)
+		{
+			AddGlbNode(&loader, (uxx)GetJsonNumber(GetJsonElement(&loader.json, sceneNodes, nIndex), -1.0), &rootTransform, 0);
+		}
+	}
+	else
+	{
+		//Without a scene every node that isn't somebody's child is a root
+		uxx numNodes = GetJsonLength(nodes);
+		bool* isChild = AllocArray(bool, scratch, numNodes + 1);
+		NotNull(isChild);
+		MyMemSet(isChild, 0x00, sizeof(bool) * (numNodes + 1));
+		for (uxx nIndex = 0; nIndex < numNodes; nIndex++)
+		{
+			const JsonValue* children = GetJsonMember(&loader.json, GetJsonElement(&loader.json, nodes, nIndex), "children");
+			for (uxx cIndex = 0; cIndex < GetJsonLength(children); cIndex++)
+			{
+				uxx childIndex = (uxx)GetJsonNumber(GetJsonElement(&loader.json, children, cIndex), -1.0);
+				if (childIndex < numNodes) { isChild[childIndex] = true; }
+			}
+		}
+		for (uxx nIndex = 0; nIndex < numNodes; nIndex++) { if (!isChild[nIndex]) { AddGlbNode(&loader, nIndex, &rootTransform, 0); } }
+	}
+	PerfTime meshEnd = GetPerfTime();
+	loader.stats.meshMs = GetPerfTimeDiff(&meshStart, &meshEnd);
+	loader.stats.numTextures = modelDataOut->textures.length;
+	
+	FreeJsonDocument(&loader.json);
+	bool wasMapped = glb.file.isMapped;
+	CloseGlbFile(&glb);
+	ScratchEnd(scratch);
+	if (loader.stats.numSkippedPrimitives > 0)
+	{
+		PrintLine_W("Skipped %llu primitive%s that weren't triangles or had unreadable accessors in \"%.*s\"",
+			(u64)loader.stats.numSkippedPrimitives, Plural(loader.stats.numSkippedPrimitives, "s"), StrPrint(filePath)
+		);
+	}
+	if (loader.stats.numTriangles == 0)
+	{
+		FreeGlbModelData(arena, modelDataOut);
+		return Result_Failure;
+	}
+	PrintLine_D("Loaded \"%.*s\" (%.1lfMB%s): %llu triangle%s, %llu vertices in %llu part%s, %llu texture%s. Map %.2lfms, images %.2lfms, meshes %.2lfms",
+		StrPrint(filePath), (r64)loader.stats.fileSize / (r64)Megabytes(1), wasMapped ? "" : ", read",
+		(u64)loader.stats.numTriangles, Plural(loader.stats.numTriangles, "s"),
+		(u64)loader.stats.numVertices,
+		(u64)modelDataOut->parts.length, Plural(modelDataOut->parts.length, "s"),
+		(u64)loader.stats.numTextures, Plural(loader.stats.numTextures, "s"),
+		loader.stats.mapMs, loader.stats.imageMs, loader.stats.meshMs
+	);
+	return Result_Success;
+}
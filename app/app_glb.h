@@ -0,0 +1,116 @@
+/*
+File:   app_glb.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Loads binary glTF (.glb) files into the same ModelData that TryLoadGltfFile fills. The file is
+	** memory mapped instead of read, the JSON chunk is parsed in place and every accessor, index buffer
+	** and embedded image is read straight out of the mapped BIN chunk, so the file's contents are never
+	** copied as a whole. The vertices are still converted into the ModelData's Vertex3D parts (and later
+	** interleaved with the generated tangents) so the mapping is closed before TryLoadGlbFile returns.
+	** Embedded PNGs are decoded in parallel on the job system.
+	** Every mesh node becomes one ModelDataPart per triangle primitive, with the node's world transform.
+*/
+
+#ifndef _APP_GLB_H
+#define _APP_GLB_H
+
+#if TARGET_IS_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define GLB_MAGIC            0x46546C67 //"glTF"
+#define GLB_VERSION          2
+#define GLB_HEADER_SIZE      12
+#define GLB_CHUNK_JSON       0x4E4F534A //"JSON"
+#define GLB_CHUNK_BIN        0x004E4942 //"BIN\0"
+#define GLB_INDEX_NONE       UINTXX_MAX
+#define GLB_MAX_NODE_DEPTH   64
+
+#define GLTF_COMPONENT_I8    5120
+#define GLTF_COMPONENT_U8    5121
+#define GLTF_COMPONENT_I16   5122
+#define GLTF_COMPONENT_U16   5123
+#define GLTF_COMPONENT_U32   5125
+#define GLTF_COMPONENT_F32   5126
+#define GLTF_MODE_TRIANGLES  4
+
+// The contents of a file either mapped into our address space or (when mapping isn't available/fails) read into the arena
+typedef struct MappedFile MappedFile;
+struct MappedFile
+{
+	Arena* arena; //only set when the file had to be read instead of mapped
+	Str8 contents;
+	bool isMapped;
+	#if TARGET_IS_WINDOWS
+	HANDLE fileHandle;
+	HANDLE mappingHandle;
+	#endif
+};
+
+// A resolved glTF accessor, data points at the first element inside the mapping
+typedef struct GlbAccessor GlbAccessor;
+struct GlbAccessor
+{
+	const u8* data;
+	uxx count;
+	uxx stride; //bytes between elements, the bufferView's byteStride or the tightly packed element size
+	u32 componentType; //GLTF_COMPONENT_
+	u32 numComponents;
+	bool normalized;
+	uxx bufferViewIndex;
+	uxx offsetInView; //the accessor's byteOffset
+};
+
+typedef struct GlbTransform GlbTransform;
+struct GlbTransform
+{
+	v3 position;
+	quat rotation;
+	v3 scale;
+};
+
+typedef struct GlbFile GlbFile;
+struct GlbFile
+{
+	Arena* arena;
+	FilePath folder; //points into the path passed to TryLoadGlbFile, for buffers and images stored next to the file
+	MappedFile file;
+	VarArray buffers; //Str8, the BIN chunk or a mapped external buffer (empty when it couldn't be found)
+	VarArray externalBuffers; //MappedFile, buffers with a uri
+};
+
+typedef struct GlbLoadStats GlbLoadStats;
+struct GlbLoadStats
+{
+	uxx fileSize;
+	uxx numTriangles;
+	uxx numVertices;
+	uxx numTextures;
+	uxx numSkippedPrimitives; //not triangles, or an accessor we can't read
+	r64 mapMs;
+	r64 meshMs;
+	r64 imageMs;
+};
+
+// Everything TryLoadGlbFile's helpers need, the JSON document lives in the scratch arena and is gone once loading is done
+typedef struct GlbLoader GlbLoader;
+struct GlbLoader
+{
+	Arena* arena; //where the ModelData is allocated
+	Arena* scratch;
+	GlbFile* glb;
+	JsonDocument json;
+	const JsonValue* root;
+	ModelData* modelData;
+	uxx numImages;
+	uxx* imageTextureIndices; //ModelData texture of each glTF image, GLB_INDEX_NONE when it couldn't be decoded
+	uxx numMaterials; //glTF materials, they map 1:1 onto the first ModelData materials
+	uxx defaultMaterialIndex; //for primitives without a material, GLB_INDEX_NONE until one needs it
+	GlbLoadStats stats;
+};
+
+#endif //  _APP_GLB_H
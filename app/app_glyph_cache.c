@@ -0,0 +1,415 @@
+/*
+File:   app_glyph_cache.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that look up, rasterize, pack and draw the glyphs of a GlyphCache (see app_glyph_cache.h)
+*/
+
+static inline u32 HashGlyphCodepoint(u32 codepoint)
+{
+	u32 hash = codepoint * 0x9E3779B1u;
+	return hash ^ (hash >> 15);
+}
+
+void FreeGlyphCache(GlyphCache* cache)
+{
+	NotNull(cache);
+	if (cache->arena != nullptr)
+	{
+		if (cache->isRasterizing) { FinishJobs(cache->jobs, &cache->rasterBatch); }
+		for (uxx rIndex = 0; rIndex < cache->numRasters; rIndex++)
+		{
+			if (cache->rasters[rIndex].distances != nullptr) { stbtt_FreeSDF(cache->rasters[rIndex].distances, nullptr); }
+		}
+		for (uxx pIndex = 0; pIndex < cache->numPages; pIndex++)
+		{
+			GlyphCachePage* page = &cache->pages[pIndex];
+			if (page->hasTexture) { FreeTexture(&page->texture); }
+			FreeMem(cache->arena, page->pixels, sizeof(u32) * GLYPH_CACHE_PAGE_SIZE * GLYPH_CACHE_PAGE_SIZE);
+			FreeVarArray(&page->shelves);
+		}
+		if (cache->slots != nullptr) { FreeMem(cache->arena, cache->slots, sizeof(u32) * cache->numSlots); }
+		if (cache->pendingGlyphs != nullptr) { FreeMem(cache->arena, cache->pendingGlyphs, sizeof(u32) * cache->pendingCapacity); }
+		FreeVarArray(&cache->glyphs);
+	}
+	ClearPointer(cache);
+}
+
+// The font (and the job system) have to outlive the cache. It doesn't need any baked char ranges, InitSdfFont with none
+// is enough, but glyphs that are waiting for a page are drawn with the font's baked glyphs when it has them
+void InitGlyphCache(JobSystem* jobs, Arena* arena, SdfFont* font, GlyphCache* cacheOut)
+{
+	NotNull(arena);
+	NotNull(font);
+	NotNull(cacheOut);
+	ClearPointer(cacheOut);
+	cacheOut->arena = arena;
+	cacheOut->jobs = jobs;
+	cacheOut->font = font;
+	cacheOut->numSlots = 256;
+	cacheOut->slots = AllocArray(u32, arena, cacheOut->numSlots);
+	NotNull(cacheOut->slots);
+	MyMemSet(cacheOut->slots, 0xFF, sizeof(u32) * cacheOut->numSlots);
+	InitVarArray(CachedGlyph, &cacheOut->glyphs, arena);
+	cacheOut->pendingCapacity = GLYPH_CACHE_INITIAL_QUEUE_SIZE;
+	cacheOut->pendingGlyphs = AllocArray(u32, arena, cacheOut->pendingCapacity);
+	NotNull(cacheOut->pendingGlyphs);
+}
+
+static void GrowGlyphCacheSlots(GlyphCache* cache)
+{
+	FreeMem(cache->arena, cache->slots, sizeof(u32) * cache->numSlots);
+	cache->numSlots <<= 1;
+	cache->slots = AllocArray(u32, cache->arena, cache->numSlots);
+	NotNull(cache->slots);
+	MyMemSet(cache->slots, 0xFF, sizeof(u32) * cache->numSlots);
+	VarArrayLoop(&cache->glyphs, gIndex)
+	{
+		VarArrayLoopGet(CachedGlyph, glyph, &cache->glyphs, gIndex);
+		uxx slot = HashGlyphCodepoint(glyph->codepoint) & (cache->numSlots-1);
+		while (cache->slots[slot] != GLYPH_CACHE_NONE) { slot = (slot + 1) & (cache->numSlots-1); }
+		cache->slots[slot] = (u32)gIndex;
+	}
+}
+
+// New codepoints get their metrics right away (they're cheap) so text lays out the same before and after the glyph is rasterized
+CachedGlyph* FindOrAddCachedGlyph(GlyphCache* cache, u32 codepoint)
+{
+	uxx slot = HashGlyphCodepoint(codepoint) & (cache->numSlots-1);
+	while (cache->slots[slot] != GLYPH_CACHE_NONE)
+	{
+		CachedGlyph* glyph = VarArrayGetHard(CachedGlyph, &cache->glyphs, cache->slots[slot]);
+		if (glyph->codepoint == codepoint) { return glyph; }
+		slot = (slot + 1) & (cache->numSlots-1);
+	}
+	
+	u32 glyphIndex = (u32)cache->glyphs.length;
+	CachedGlyph* newGlyph = VarArrayAdd(CachedGlyph, &cache->glyphs);
+	NotNull(newGlyph);
+	ClearPointer(newGlyph);
+	newGlyph->codepoint = codepoint;
+	newGlyph->ttfGlyphIndex = stbtt_FindGlyphIndex(&cache->font->ttfInfo, (int)codepoint);
+	newGlyph->advanceX = GetSdfGlyphAdvance(cache->font, newGlyph->ttfGlyphIndex);
+	newGlyph->pageIndex = GLYPH_CACHE_NONE;
+	cache->slots[slot] = glyphIndex;
+	if (cache->glyphs.length * 2 > cache->numSlots)
+	{
+		GrowGlyphCacheSlots(cache);
+		newGlyph = VarArrayGetHard(CachedGlyph, &cache->glyphs, glyphIndex);
+	}
+	return newGlyph;
+}
+
+// +--------------------------------------------------------------+
+// |                        Pending Queue                         |
+// +--------------------------------------------------------------+
+static void PushPendingCachedGlyph(GlyphCache* cache, u32 glyphIndex)
+{
+	if (cache->numPending == cache->pendingCapacity)
+	{
+		//Unwrap into a ring twice the size so the oldest glyph ends up at index 0
+		uxx newCapacity = cache->pendingCapacity * 2;
+		u32* newPendingGlyphs = AllocArray(u32, cache->arena, newCapacity);
+		NotNull(newPendingGlyphs);
+		for (uxx qIndex = 0; qIndex < cache->numPending; qIndex++)
+		{
+			newPendingGlyphs[qIndex] = cache->pendingGlyphs[(cache->pendingHead + qIndex) & (cache->pendingCapacity-1)];
+		}
+		FreeMem(cache->arena, cache->pendingGlyphs, sizeof(u32) * cache->pendingCapacity);
+		cache->pendingGlyphs = newPendingGlyphs;
+		cache->pendingCapacity = newCapacity;
+		cache->pendingHead = 0;
+	}
+	cache->pendingGlyphs[(cache->pendingHead + cache->numPending) & (cache->pendingCapacity-1)] = glyphIndex;
+	cache->numPending++;
+}
+
+static u32 PopPendingCachedGlyph(GlyphCache* cache)
+{
+	Assert(cache->numPending > 0);
+	u32 result = cache->pendingGlyphs[cache->pendingHead];
+	cache->pendingHead = (cache->pendingHead + 1) & (cache->pendingCapacity-1);
+	cache->numPending--;
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                        Pages and Jobs                        |
+// +--------------------------------------------------------------+
+// Returns true when the glyph can be drawn from its page right now, otherwise it's queued for the next StartGlyphCacheRasters
+bool RequestCachedGlyph(GlyphCache* cache, CachedGlyph* glyph)
+{
+	if (glyph->state == CachedGlyphState_Resident)
+	{
+		GlyphCachePage* page = &cache->pages[glyph->pageIndex];
+		if (page->generation == glyph->pageGeneration)
+		{
+			page->lastUsedFrame = cache->frameIndex;
+			return true;
+		}
+		glyph->state = CachedGlyphState_None; //its page was cleared since
+	}
+	if (glyph->state == CachedGlyphState_None)
+	{
+		PushPendingCachedGlyph(cache, (u32)(glyph - (CachedGlyph*)cache->glyphs.items));
+		glyph->state = CachedGlyphState_Queued;
+	}
+	return false;
+}
+
+static void ClearGlyphCachePage(GlyphCachePage* page)
+{
+	page->generation++;
+	page->numGlyphs = 0;
+	page->nextShelfY = 0;
+	VarArrayClear(&page->shelves);
+	for (uxx pIndex = 0; pIndex < GLYPH_CACHE_PAGE_SIZE * GLYPH_CACHE_PAGE_SIZE; pIndex++) { page->pixels[pIndex] = 0x00FFFFFF; }
+	page->isDirty = true;
+}
+
+// Puts the glyph on the shortest shelf it fits on (that isn't too much taller than it) or starts a new shelf below the others
+static bool TryPackGlyphInPage(GlyphCachePage* page, v2i glyphSize, reci* recOut)
+{
+	GlyphCacheShelf* bestShelf = nullptr;
+	VarArrayLoop(&page->shelves, sIndex)
+	{
+		VarArrayLoopGet(GlyphCacheShelf, shelf, &page->shelves, sIndex);
+		if (shelf->height < glyphSize.Height || (r32)shelf->height > (r32)glyphSize.Height * GLYPH_CACHE_SHELF_SLACK) { continue; }
+		if (shelf->usedWidth + glyphSize.Width > GLYPH_CACHE_PAGE_SIZE) { continue; }
+		if (bestShelf == nullptr || shelf->height < bestShelf->height) { bestShelf = shelf; }
+	}
+	if (bestShelf == nullptr)
+	{
+		if (page->nextShelfY + glyphSize.Height > GLYPH_CACHE_PAGE_SIZE) { return false; }
+		bestShelf = VarArrayAdd(GlyphCacheShelf, &page->shelves);
+		NotNull(bestShelf);
+		ClearPointer(bestShelf);
+		bestShelf->y = page->nextShelfY;
+		bestShelf->height = glyphSize.Height;
+		page->nextShelfY += glyphSize.Height + GLYPH_CACHE_SPACING;
+	}
+	*recOut = NewReci(bestShelf->usedWidth, bestShelf->y, glyphSize.Width, glyphSize.Height);
+	bestShelf->usedWidth += glyphSize.Width + GLYPH_CACHE_SPACING;
+	page->numGlyphs++;
+	return true;
+}
+
+// Tries every page, then a new page, then clearing the least recently used page that nothing drew last frame.
+// Returns GLYPH_CACHE_NONE when every page is full of glyphs that are still on screen
+static u32 FindRoomInGlyphCache(GlyphCache* cache, v2i glyphSize, reci* recOut)
+{
+	for (uxx pIndex = 0; pIndex < cache->numPages; pIndex++)
+	{
+		if (TryPackGlyphInPage(&cache->pages[pIndex], glyphSize, recOut)) { return (u32)pIndex; }
+	}
+	if (cache->numPages < GLYPH_CACHE_MAX_PAGES)
+	{
+		GlyphCachePage* newPage = &cache->pages[cache->numPages];
+		ClearPointer(newPage);
+		newPage->pixels = AllocArray(u32, cache->arena, GLYPH_CACHE_PAGE_SIZE * GLYPH_CACHE_PAGE_SIZE);
+		NotNull(newPage->pixels);
+		InitVarArray(GlyphCacheShelf, &newPage->shelves, cache->arena);
+		ClearGlyphCachePage(newPage);
+		cache->numPages++;
+		if (TryPackGlyphInPage(newPage, glyphSize, recOut)) { return (u32)(cache->numPages-1); }
+		return GLYPH_CACHE_NONE;
+	}
+	
+	uxx lruIndex = cache->numPages;
+	for (uxx pIndex = 0; pIndex < cache->numPages; pIndex++)
+	{
+		GlyphCachePage* page = &cache->pages[pIndex];
+		if (page->lastUsedFrame >= cache->frameIndex) { continue; }
+		if (lruIndex == cache->numPages || page->lastUsedFrame < cache->pages[lruIndex].lastUsedFrame) { lruIndex = pIndex; }
+	}
+	if (lruIndex == cache->numPages) { return GLYPH_CACHE_NONE; }
+	ClearGlyphCachePage(&cache->pages[lruIndex]);
+	cache->numEvictions++;
+	if (TryPackGlyphInPage(&cache->pages[lruIndex], glyphSize, recOut)) { return (u32)lruIndex; }
+	return GLYPH_CACHE_NONE;
+}
+
+// Copies the raster's distance field into a page. Returns false (leaving the glyph alone) when every page is full of
+// glyphs that are still on screen
+static bool TryPackGlyphCacheRaster(GlyphCache* cache, const GlyphCacheRaster* raster)
+{
+	CachedGlyph* glyph = VarArrayGetHard(CachedGlyph, &cache->glyphs, raster->glyphIndex);
+	reci atlasRec = ZEROED;
+	u32 pageIndex = FindRoomInGlyphCache(cache, raster->size, &atlasRec);
+	if (pageIndex == GLYPH_CACHE_NONE) { return false; }
+	
+	GlyphCachePage* page = &cache->pages[pageIndex];
+	for (i32 yOffset = 0; yOffset < raster->size.Height; yOffset++)
+	{
+		u32* pageRow = &page->pixels[(uxx)(atlasRec.Y + yOffset) * GLYPH_CACHE_PAGE_SIZE + (uxx)atlasRec.X];
+		const u8* distanceRow = &raster->distances[(uxx)yOffset * (uxx)raster->size.Width];
+		for (i32 xOffset = 0; xOffset < raster->size.Width; xOffset++) { pageRow[xOffset] = 0x00FFFFFF | ((u32)distanceRow[xOffset] << 24); }
+	}
+	page->isDirty = true;
+	page->lastUsedFrame = cache->frameIndex;
+	glyph->state = CachedGlyphState_Resident;
+	glyph->pageIndex = pageIndex;
+	glyph->pageGeneration = page->generation;
+	glyph->atlasRec = atlasRec;
+	glyph->drawOffset = raster->drawOffset;
+	return true;
+}
+
+// Only reads the font and only writes its own raster (stbtt_GetGlyphSDF allocates with malloc, not from an arena)
+static JOB_FUNC_DEF(RasterizeCachedGlyphJob)
+{
+	GlyphCache* cache = (GlyphCache*)userPntr;
+	GlyphCacheRaster* raster = &cache->rasters[jobIndex];
+	raster->distances = RasterizeSdfGlyph(cache->font, raster->ttfGlyphIndex, &raster->size, &raster->drawOffset);
+}
+
+// Call once per frame before any text is drawn from the cache. Waits for the glyphs StartGlyphCacheRasters handed to the
+// jobs last frame (they've had the rest of that frame to finish), packs them into pages and updates the texture of
+// every page that changed. sokol can only update a mutable image once per frame so each page is updated at most once
+// here, with the whole page, no matter how many glyphs went into it
+void UpdateGlyphCache(GlyphCache* cache)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	cache->numFallbacks = cache->numFallbacksThisFrame;
+	cache->numFallbacksThisFrame = 0;
+	
+	if (cache->isRasterizing)
+	{
+		FinishJobs(cache->jobs, &cache->rasterBatch);
+		cache->isRasterizing = false;
+	}
+	for (uxx rIndex = 0; rIndex < cache->numRasters; rIndex++)
+	{
+		GlyphCacheRaster* raster = &cache->rasters[rIndex];
+		CachedGlyph* glyph = VarArrayGetHard(CachedGlyph, &cache->glyphs, raster->glyphIndex);
+		if (raster->distances == nullptr || raster->size.Width > GLYPH_CACHE_PAGE_SIZE || raster->size.Height > GLYPH_CACHE_PAGE_SIZE)
+		{
+			glyph->state = CachedGlyphState_Empty;
+		}
+		else if (TryPackGlyphCacheRaster(cache, raster)) { cache->numRasterized++; }
+		else
+		{
+			//Every page is in use, try again once some of the text on screen goes away
+			glyph->state = CachedGlyphState_Queued;
+			PushPendingCachedGlyph(cache, raster->glyphIndex);
+		}
+		if (raster->distances != nullptr) { stbtt_FreeSDF(raster->distances, nullptr); }
+		raster->distances = nullptr;
+	}
+	cache->numRasters = 0;
+	
+	for (uxx pIndex = 0; pIndex < cache->numPages; pIndex++)
+	{
+		GlyphCachePage* page = &cache->pages[pIndex];
+		if (!page->isDirty || (page->hasTexture && page->lastUploadFrame == cache->frameIndex)) { continue; }
+		if (page->hasTexture) { UpdateTexturePart(&page->texture, NewReci(0, 0, GLYPH_CACHE_PAGE_SIZE, GLYPH_CACHE_PAGE_SIZE), page->pixels); }
+		else
+		{
+			page->texture = InitTexture(cache->arena, StrLit("glyph_cache_page"), FillV2i(GLYPH_CACHE_PAGE_SIZE), page->pixels, TextureFlag_Mutable);
+			page->hasTexture = (page->texture.error == Result_Success);
+		}
+		page->isDirty = false;
+		page->lastUploadFrame = cache->frameIndex;
+		cache->numUploads++;
+	}
+	cache->frameIndex++;
+}
+
+// Call once per frame after all the text using the cache was drawn. Hands up to GLYPH_CACHE_MAX_RASTERS_PER_FRAME of the
+// queued glyphs, oldest first, to the job system and returns without waiting, the next UpdateGlyphCache packs them.
+// Whatever's left stays queued for the frame after
+void StartGlyphCacheRasters(GlyphCache* cache)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	if (cache->isRasterizing || cache->numRasters > 0) { return; }
+	while (cache->numPending > 0 && cache->numRasters < GLYPH_CACHE_MAX_RASTERS_PER_FRAME)
+	{
+		u32 glyphIndex = PopPendingCachedGlyph(cache);
+		CachedGlyph* glyph = VarArrayGetHard(CachedGlyph, &cache->glyphs, glyphIndex);
+		if (glyph->state != CachedGlyphState_Queued) { continue; }
+		glyph->state = CachedGlyphState_Rasterizing;
+		GlyphCacheRaster* raster = &cache->rasters[cache->numRasters++];
+		ClearPointer(raster);
+		raster->glyphIndex = glyphIndex;
+		raster->ttfGlyphIndex = glyph->ttfGlyphIndex;
+	}
+	if (cache->numRasters == 0) { return; }
+	StartJobs(cache->jobs, &cache->rasterBatch, cache->numRasters, RasterizeCachedGlyphJob, cache);
+	cache->isRasterizing = true;
+}
+
+// Draws the glyph from its page if it's resident. Otherwise it's queued and, for now, drawn with the SdfFont's own baked
+// glyph for the codepoint (or the font's fallback glyph). penPos is on the baseline, sizeScale is the font size being
+// drawn over the font's bakeSize
+void DrawCachedGlyph(GlyphCache* cache, CachedGlyph* glyph, v2 penPos, r32 sizeScale, Color32 color)
+{
+	if (RequestCachedGlyph(cache, glyph) && cache->pages[glyph->pageIndex].hasTexture)
+	{
+		GlyphCachePage* page = &cache->pages[glyph->pageIndex];
+		rec drawRec = NewRec(
+			penPos.X + glyph->drawOffset.X * sizeScale,
+			penPos.Y + glyph->drawOffset.Y * sizeScale,
+			(r32)glyph->atlasRec.Width * sizeScale,
+			(r32)glyph->atlasRec.Height * sizeScale
+		);
+		DrawTexturedRectangleEx(drawRec, color, &page->texture, NewRec((r32)glyph->atlasRec.X, (r32)glyph->atlasRec.Y, (r32)glyph->atlasRec.Width, (r32)glyph->atlasRec.Height));
+		return;
+	}
+	if (glyph->state == CachedGlyphState_Empty) { return; }
+	cache->numFallbacksThisFrame++;
+	SdfGlyph* fallbackGlyph = GetSdfGlyphOrFallback(cache->font, glyph->codepoint);
+	if (fallbackGlyph != nullptr) { DrawSdfGlyph(cache->font, fallbackGlyph, penPos, sizeScale, color); }
+}
+
+// Same flow as FlowSdfText: returns the size of the text's logical rectangle at fontSize and draws (when draw is true)
+// every glyph with the pen starting at position on the first line's baseline
+static v2 FlowGlyphCacheText(GlyphCache* cache, Str8 text, v2 position, r32 fontSize, Color32 color, bool draw)
+{
+	SdfFont* font = cache->font;
+	r32 sizeScale = fontSize / font->bakeSize;
+	v2 penPos = position;
+	r32 maxLineWidth = 0.0f;
+	uxx numLines = 1;
+	i32 prevTtfGlyphIndex = -1;
+	for (uxx cIndex = 0; cIndex < text.length; )
+	{
+		u32 codepoint = 0;
+		u8 codepointSize = GetCodepointForUtf8Str(text, cIndex, &codepoint);
+		if (codepointSize == 0) { codepoint = (u32)(u8)text.chars[cIndex]; codepointSize = 1; }
+		cIndex += codepointSize;
+		if (codepoint == '\r') { continue; }
+		if (codepoint == '\n')
+		{
+			maxLineWidth = MaxR32(maxLineWidth, penPos.X - position.X);
+			penPos = NewV2(position.X, penPos.Y + font->lineHeight * sizeScale);
+			numLines++;
+			prevTtfGlyphIndex = -1;
+			continue;
+		}
+		CachedGlyph* glyph = FindOrAddCachedGlyph(cache, codepoint);
+		if (prevTtfGlyphIndex >= 0) { penPos.X += GetSdfGlyphKerning(font, prevTtfGlyphIndex, glyph->ttfGlyphIndex) * sizeScale; }
+		if (draw) { DrawCachedGlyph(cache, glyph, penPos, sizeScale, color); }
+		penPos.X += glyph->advanceX * sizeScale;
+		prevTtfGlyphIndex = glyph->ttfGlyphIndex;
+	}
+	maxLineWidth = MaxR32(maxLineWidth, penPos.X - position.X);
+	return NewV2(maxLineWidth, font->lineHeight * sizeScale * (r32)numLines);
+}
+
+// Measuring never queues anything, only drawing decides which glyphs need to be in a page
+v2 MeasureGlyphCacheText(GlyphCache* cache, Str8 text, r32 fontSize)
+{
+	NotNull(cache);
+	return FlowGlyphCacheText(cache, text, V2_Zero, fontSize, White, false);
+}
+
+// The main2dSdf shader needs to be bound (with BindSdfTextShader) before calling this.
+// Glyphs that aren't resident yet are drawn with the SdfFont's glyph this frame (see DrawCachedGlyph)
+void DrawGlyphCacheText(GlyphCache* cache, Str8 text, v2 position, r32 fontSize, Color32 color)
+{
+	NotNull(cache);
+	FlowGlyphCacheText(cache, text, position, fontSize, color, true);
+}
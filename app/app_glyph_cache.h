@@ -0,0 +1,115 @@
+/*
+File:   app_glyph_cache.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A GlyphCache draws text from an SdfFont without baking any char ranges up front. A glyph's metrics are
+	** looked up the first time a codepoint is drawn, but its distance field is only queued. At the end of the frame
+	** StartGlyphCacheRasters hands the queued glyphs to the job system and UpdateGlyphCache packs whatever they
+	** rasterized at the start of the next frame. Until then the glyph is drawn with the SdfFont's own baked glyph
+	** (or its fallback glyph), so a new glyph is only a stand-in for one frame and the text around it is already
+	** laid out where it will end up.
+	** Glyphs are shelf packed into GLYPH_CACHE_PAGE_SIZE pages. When every page is full, the page used least
+	** recently is cleared and its glyphs go back to being queued the next time they're drawn. This is what
+	** lets CJK text work, only the few hundred characters that are actually on screen are ever rasterized.
+	** Each page is a mutable texture that gets updated (all of it, sokol has no sub-rectangle updates) at most once
+	** per frame, no matter how many glyphs were packed into it.
+	** Glyphs are distance fields (see app_sdf_font.h) so one cached glyph serves every font size.
+*/
+
+#ifndef _APP_GLYPH_CACHE_H
+#define _APP_GLYPH_CACHE_H
+
+#define GLYPH_CACHE_PAGE_SIZE              1024
+#define GLYPH_CACHE_MAX_PAGES              4 //SOKOL_NUM_GLYPH_PAGES in defines.h has to be at least this
+#define GLYPH_CACHE_SPACING                1 //empty pixels between glyphs
+#define GLYPH_CACHE_SHELF_SLACK            1.25f //a glyph may go on a shelf up to this much taller than itself
+#define GLYPH_CACHE_MAX_RASTERS_PER_FRAME  64 //glyphs StartGlyphCacheRasters hands to the jobs each frame
+#define GLYPH_CACHE_INITIAL_QUEUE_SIZE     64 //pendingGlyphs ring capacity, doubles when it fills up
+#define GLYPH_CACHE_NONE                   UINT32_MAX
+
+typedef enum CachedGlyphState CachedGlyphState;
+enum CachedGlyphState
+{
+	CachedGlyphState_None = 0, //metrics are known, not in any page
+	CachedGlyphState_Queued, //in pendingGlyphs
+	CachedGlyphState_Rasterizing, //in rasters, a job is making its distance field
+	CachedGlyphState_Resident, //in pageIndex at atlasRec (as long as the page's generation still matches)
+	CachedGlyphState_Empty, //nothing to draw (whitespace), never needs a page
+};
+
+typedef struct CachedGlyph CachedGlyph;
+struct CachedGlyph
+{
+	u32 codepoint;
+	i32 ttfGlyphIndex; //0 when the font doesn't have the codepoint, that draws the font's missing glyph box
+	u8 state; //CachedGlyphState
+	u32 pageIndex;
+	u32 pageGeneration;
+	reci atlasRec;
+	v2 drawOffset; //from the pen position on the baseline to the top-left of atlasRec, in bake pixels
+	r32 advanceX; //in bake pixels
+};
+
+typedef struct GlyphCacheRaster GlyphCacheRaster;
+struct GlyphCacheRaster
+{
+	u32 glyphIndex;
+	i32 ttfGlyphIndex; //copied so the jobs never read cache->glyphs, the main thread can grow it while they run
+	v2i size;
+	v2 drawOffset;
+	u8* distances; //from stbtt_GetGlyphSDF, freed once it's copied into a page
+};
+
+typedef struct GlyphCacheShelf GlyphCacheShelf;
+struct GlyphCacheShelf
+{
+	i32 y;
+	i32 height;
+	i32 usedWidth;
+};
+
+typedef struct GlyphCachePage GlyphCachePage;
+struct GlyphCachePage
+{
+	u32* pixels; //CPU copy of the whole page, RGB white with the distance in alpha like an SdfFont atlas
+	Texture texture; //TextureFlag_Mutable, made the first time the page is uploaded
+	bool hasTexture;
+	bool isDirty; //pixels changed since the texture was last updated
+	u64 lastUploadFrame;
+	u32 generation; //bumped when the page is cleared, glyphs holding an older generation aren't resident anymore
+	u64 lastUsedFrame;
+	uxx numGlyphs;
+	VarArray shelves; //GlyphCacheShelf
+	i32 nextShelfY;
+};
+
+typedef struct GlyphCache GlyphCache;
+struct GlyphCache
+{
+	Arena* arena;
+	JobSystem* jobs; //rasterizes the queued glyphs, nullptr rasterizes them in StartGlyphCacheRasters instead
+	SdfFont* font;
+	u64 frameIndex;
+	VarArray glyphs; //CachedGlyph, never removed so lookups stay valid when pages are cleared
+	u32* slots; //glyph index or GLYPH_CACHE_NONE, open addressing on the codepoint
+	uxx numSlots;
+	u32* pendingGlyphs; //ring of glyph indices in the order they were first drawn, pendingCapacity is a power of two
+	uxx pendingCapacity;
+	uxx pendingHead;
+	uxx numPending;
+	bool isRasterizing; //rasterBatch is in flight, from StartGlyphCacheRasters until the next UpdateGlyphCache
+	JobBatch rasterBatch;
+	uxx numRasters;
+	GlyphCacheRaster rasters[GLYPH_CACHE_MAX_RASTERS_PER_FRAME];
+	uxx numPages;
+	GlyphCachePage pages[GLYPH_CACHE_MAX_PAGES];
+	
+	uxx numRasterized; //since the cache was made
+	uxx numEvictions; //pages cleared to make room
+	uxx numUploads; //page textures made or updated
+	uxx numFallbacks; //glyphs drawn with the SdfFont's glyph while waiting for a page, last frame
+	uxx numFallbacksThisFrame;
+};
+
+#endif //  _APP_GLYPH_CACHE_H
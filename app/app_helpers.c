@@ -9,82 +9,262 @@ Description:
 #if FP3D_SCENE_ENABLED
 void DrawBox(box boundingBox, Color32 color)
 {
-	mat4 worldMat = Mat4_Identity;
-	TransformMat4(&worldMat, MakeScaleMat4(boundingBox.Size));
-	TransformMat4(&worldMat, MakeTranslateMat4(boundingBox.BottomLeftBack));
-	SetWorldMat(worldMat);
-	SetTintColor(color);
+	SetWorldMat(ComposeTrsMat4(boundingBox.BottomLeftBack, Quat_Identity, boundingBox.Size, TrsOrder_ScaleThenRotate));
+	SetTintColor(ToLinearColor32(color));
 	BindVertBuffer(&app->cubeBuffer);
 	DrawVertices();
 }
 
 void DrawObb3(obb3 boundingBox, Color32 color)
 {
-	mat4 worldMat = Mat4_Identity;
-	TransformMat4(&worldMat, MakeTranslateMat4(FillV3(-0.5f)));
-	TransformMat4(&worldMat, MakeScaleMat4(boundingBox.Size));
-	TransformMat4(&worldMat, ToMat4FromQuat(boundingBox.Rotation));
-	TransformMat4(&worldMat, MakeTranslateMat4(boundingBox.Center));
-	SetWorldMat(worldMat);
-	SetTintColor(color);
+	SetWorldMat(ComposeTrsMat4Ex(boundingBox.Center, boundingBox.Rotation, boundingBox.Size, TrsOrder_ScaleThenRotate, FillV3(-0.5f)));
+	SetTintColor(ToLinearColor32(color));
 	BindVertBuffer(&app->cubeBuffer);
 	DrawVertices();
 }
 
 void DrawSphere(Sphere sphere, Color32 color)
 {
-	mat4 worldMat = Mat4_Identity;
-	TransformMat4(&worldMat, MakeScaleMat4(FillV3(sphere.Radius)));
-	TransformMat4(&worldMat, MakeTranslateMat4(sphere.Center));
-	SetWorldMat(worldMat);
-	SetTintColor(color);
+	SetWorldMat(ComposeTrsMat4(sphere.Center, Quat_Identity, FillV3(sphere.Radius), TrsOrder_ScaleThenRotate));
+	SetTintColor(ToLinearColor32(color));
 	BindVertBuffer(&app->sphereBuffer);
 	DrawVertices();
 }
 
+// Atlased-only textures (and textures that failed to load) have no handle, those fall back to the white pixel texture
+Texture* GetModelTexture(Model3D* model, uxx textureIndex)
+{
+	TextureHandle handle = *VarArrayGetHard(TextureHandle, &model->textureHandles, textureIndex);
+	Texture* result = GetCachedTexture(&app->textureCache, handle);
+	return (result != nullptr) ? result : &gfx.pixelTexture;
+}
+
+// For draws without a material: white albedo, flat normals and PBR_UNTEXTURED_SURFACE_PARAMS
+void BindUntexturedPbrMaterial()
+{
+	BindTextureAtIndex(&gfx.pixelTexture, PBR_TEXTURE_SLOT_ALBEDO);
+	BindTextureAtIndex(&app->flatNormalTexture, PBR_TEXTURE_SLOT_NORMAL);
+	BindTextureAtIndex(&gfx.pixelTexture, PBR_TEXTURE_SLOT_METALLIC_ROUGHNESS);
+	BindTextureAtIndex(&gfx.pixelTexture, PBR_TEXTURE_SLOT_OCCLUSION);
+	SetShaderUniformByNameV4(&app->pbrShader, StrLit("surfaceParams"), PBR_UNTEXTURED_SURFACE_PARAMS);
+}
+
+void BindModelMaterial(Model3D* model, uxx materialIndex)
+{
+	if (materialIndex < model->data.materials.length)
+	{
+		ModelDataMaterial* material = VarArrayGetHard(ModelDataMaterial, &model->data.materials, materialIndex);
+		MaterialAtlasEntry* atlasEntry = VarArrayGetHard(MaterialAtlasEntry, &model->materialAtlasEntries, materialIndex);
+		SetShaderUniformByNameV4(&app->pbrShader, StrLit("uvTransform"), atlasEntry->uvTransform);
+		if (atlasEntry->pageIndex != TEXTURE_ATLAS_PAGE_NONE)
+		{
+			//Every material on the page binds these same textures, only uvTransform changes between them
+			TextureAtlasPage* page = GetTextureAtlasPage(&app->textureAtlas, atlasEntry->pageIndex);
+			BindTextureAtIndex(&page->textures[TextureAtlasSlot_Albedo], PBR_TEXTURE_SLOT_ALBEDO);
+			BindTextureAtIndex(&page->textures[TextureAtlasSlot_Normal], PBR_TEXTURE_SLOT_NORMAL);
+			BindTextureAtIndex(&page->textures[TextureAtlasSlot_MetallicRoughness], PBR_TEXTURE_SLOT_METALLIC_ROUGHNESS);
+			BindTextureAtIndex(&page->textures[TextureAtlasSlot_Occlusion], PBR_TEXTURE_SLOT_OCCLUSION);
+			SetShaderUniformByNameV4(&app->pbrShader, StrLit("surfaceParams"), PBR_MATERIAL_SURFACE_PARAMS);
+			SetTintColorRaw(material->albedoFactor);
+			return;
+		}
+		if (material->albedoTextureIndex < model->data.textures.length) { BindTextureAtIndex(GetModelTexture(model, material->albedoTextureIndex), PBR_TEXTURE_SLOT_ALBEDO); }
+		else { BindTextureAtIndex(&gfx.pixelTexture, PBR_TEXTURE_SLOT_ALBEDO); }
+		if (material->normalTextureIndex < model->data.textures.length) { BindTextureAtIndex(GetModelTexture(model, material->normalTextureIndex), PBR_TEXTURE_SLOT_NORMAL); }
+		else { BindTextureAtIndex(&app->flatNormalTexture, PBR_TEXTURE_SLOT_NORMAL); }
+		if (material->metallicRoughnessTextureIndex < model->data.textures.length) { BindTextureAtIndex(GetModelTexture(model, material->metallicRoughnessTextureIndex), PBR_TEXTURE_SLOT_METALLIC_ROUGHNESS); }
+		else { BindTextureAtIndex(&gfx.pixelTexture, PBR_TEXTURE_SLOT_METALLIC_ROUGHNESS); }
+		if (material->ambientOcclusionTextureIndex < model->data.textures.length) { BindTextureAtIndex(GetModelTexture(model, material->ambientOcclusionTextureIndex), PBR_TEXTURE_SLOT_OCCLUSION); }
+		else { BindTextureAtIndex(&gfx.pixelTexture, PBR_TEXTURE_SLOT_OCCLUSION); }
+		SetShaderUniformByNameV4(&app->pbrShader, StrLit("surfaceParams"), PBR_MATERIAL_SURFACE_PARAMS);
+		SetTintColorRaw(material->albedoFactor);
+	}
+	else
+	{
+		SetShaderUniformByNameV4(&app->pbrShader, StrLit("uvTransform"), NewV4(1.0f, 1.0f, 0.0f, 0.0f));
+		BindUntexturedPbrMaterial();
+		SetTintColor(ToLinearColor32(MonokaiPurple));
+	}
+}
+
+// Only the world matrix changes on every draw, the material (textures, tint, uvTransform) is skipped when it's the same as the last draw's
+void ApplyStagedDraw(StagedDrawList* list, Model3D* model, const StagedDraw* draw, bool depthOnly)
+{
+	NotNull(list);
+	NotNull(draw);
+	SetWorldMat(draw->world);
+	list->numApplies++;
+	if (depthOnly) { return; }
+	if (draw->materialIndex == STAGED_DRAW_NO_MATERIAL)
+	{
+		BindUntexturedPbrMaterial();
+		SetTintColor(ToLinearColor32(draw->tint));
+		ResetStagedDrawState(list);
+	}
+	else if (model != list->boundModel || draw->materialIndex != list->boundMaterialIndex)
+	{
+		NotNull(model);
+		BindModelMaterial(model, draw->materialIndex);
+		list->boundModel = model;
+		list->boundMaterialIndex = draw->materialIndex;
+	}
+	else { list->numMaterialBindsSkipped++; }
+}
+
+void DrawModelPartEx(Model3D* model, uxx partIndex, mat4 partWorldMat, uxx materialIndex, uxx lodIndex)
+{
+	BindModelMaterial(model, materialIndex);
+	VertBuffer* partVertBuffer = GetModelPartLodBuffer(model, partIndex, lodIndex);
+	SetWorldMat(partWorldMat);
+	BindVertBuffer(partVertBuffer);
+	DrawVertices();
+}
+void DrawModelPart(Model3D* model, uxx partIndex, mat4 partWorldMat)
+{
+	ModelDataPart* part = VarArrayGetHard(ModelDataPart, &model->data.parts, partIndex);
+	DrawModelPartEx(model, partIndex, partWorldMat, part->materialIndex, 0);
+}
+
+void DrawModelWithMat(Model3D* model, mat4 baseWorldMat)
+{
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		mat4* partLocalMat = VarArrayGetHard(mat4, &model->partLocalMats, pIndex);
+		DrawModelPart(model, pIndex, Mul(baseWorldMat, *partLocalMat));
+	}
+}
 void DrawModel(Model3D* model, v3 position, v3 scale, quat rotation)
 {
-	mat4 baseWorldMat = Mat4_Identity;
-	TransformMat4(&baseWorldMat, ToMat4FromQuat(rotation)); //TODO: Order of rotation and scaling??
-	TransformMat4(&baseWorldMat, MakeScaleMat4(scale));
-	TransformMat4(&baseWorldMat, MakeTranslateMat4(position));
+	DrawModelWithMat(model, ComposeTrsMat4(position, rotation, scale, TrsOrder_RotateThenScale)); //TODO: Order of rotation and scaling??
+}
+
+// Every part becomes a child node of a new root so the part world matrices are cached by the SceneGraph
+u32 AddModelToSceneGraph(SceneGraph* graph, Model3D* model, mat4 baseWorldMat)
+{
+	u32 rootIndex = AddSceneNode(graph, SCENE_NODE_INVALID, baseWorldMat);
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		mat4* partLocalMat = VarArrayGetHard(mat4, &model->partLocalMats, pIndex);
+		AddSceneNode(graph, rootIndex, *partLocalMat);
+	}
+	return rootIndex;
+}
+void DrawModelFromSceneGraphEx(Model3D* model, const SceneGraph* graph, u32 rootIndex, u32 materialOverride, uxx lodIndex)
+{
+	Assert(graph->subtreeEnds[rootIndex] - (rootIndex+1) == model->data.parts.length);
 	VarArrayLoop(&model->data.parts, pIndex)
 	{
 		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
-		
-		if (part->materialIndex < model->data.materials.length)
+		uxx materialIndex = (materialOverride != INSTANCE_NO_MATERIAL_OVERRIDE) ? (uxx)materialOverride : part->materialIndex;
+		DrawModelPartEx(model, pIndex, graph->worldMats[rootIndex + 1 + pIndex], materialIndex, lodIndex);
+	}
+}
+void DrawModelFromSceneGraph(Model3D* model, const SceneGraph* graph, u32 rootIndex)
+{
+	DrawModelFromSceneGraphEx(model, graph, rootIndex, INSTANCE_NO_MATERIAL_OVERRIDE, 0);
+}
+
+// Draws one RenderQueue item's model (or box) using its StagedDraw (see FillStagedDrawList).
+// depthOnly skips all the material/tint state, it's used by the depth pre-pass (with pbrDepth bound) where only positions matter
+void DrawInstanceEx(InstanceStore* store, uxx instanceIndex, StagedDrawList* list, const StagedDraw* draws, bool depthOnly)
+{
+	Assert(instanceIndex < store->count);
+	if (IsFlagSet(store->flags[instanceIndex], InstanceFlag_DrawAsBox))
+	{
+		ApplyStagedDraw(list, nullptr, &draws[0], depthOnly);
+		BindVertBuffer(&app->cubeBuffer);
+		DrawVertices();
+	}
+	else
+	{
+		Model3D* model = GetInstanceModel(store, store->modelIds[instanceIndex]);
+		NotNull(model);
+		VarArrayLoop(&model->data.parts, pIndex)
 		{
-			ModelDataMaterial* material = VarArrayGetHard(ModelDataMaterial, &model->data.materials, part->materialIndex);
-			if (material->albedoTextureIndex < model->data.textures.length) { BindTextureAtIndex(VarArrayGetHard(Texture, &model->textures, material->albedoTextureIndex), 0); }
-			else { BindTextureAtIndex(&gfx.pixelTexture, 0); }
-			if (material->normalTextureIndex < model->data.textures.length) { BindTextureAtIndex(VarArrayGetHard(Texture, &model->textures, material->normalTextureIndex), 1); }
-			else { BindTextureAtIndex(&gfx.pixelTexture, 1); }
-			if (material->metallicRoughnessTextureIndex < model->data.textures.length) { BindTextureAtIndex(VarArrayGetHard(Texture, &model->textures, material->metallicRoughnessTextureIndex), 2); }
-			else { BindTextureAtIndex(&gfx.pixelTexture, 2); }
-			if (material->metallicRoughnessTextureIndex < model->data.textures.length) { BindTextureAtIndex(VarArrayGetHard(Texture, &model->textures, material->metallicRoughnessTextureIndex), 3); }
-			else { BindTextureAtIndex(&gfx.pixelTexture, 3); }
-			if (material->ambientOcclusionTextureIndex < model->data.textures.length) { BindTextureAtIndex(VarArrayGetHard(Texture, &model->textures, material->ambientOcclusionTextureIndex), 4); }
-			else { BindTextureAtIndex(&gfx.pixelTexture, 4); }
-			SetTintColorRaw(material->albedoFactor);
+			ApplyStagedDraw(list, model, &draws[pIndex], depthOnly);
+			BindVertBuffer(GetModelPartLodBuffer(model, pIndex, store->lodLevels[instanceIndex]));
+			DrawVertices();
 		}
-		else
+	}
+}
+
+// Draws the MeshletDrawRanges that CullModelMeshlets produced for a model instance at LOD 0
+void DrawInstanceMeshletRanges(InstanceStore* store, uxx instanceIndex, StagedDrawList* list, const StagedDraw* draws, const MeshletDrawRange* ranges, uxx numRanges, bool depthOnly)
+{
+	Assert(instanceIndex < store->count);
+	Model3D* model = GetInstanceModel(store, store->modelIds[instanceIndex]);
+	NotNull(model);
+	u32 boundPartIndex = UINT32_MAX;
+	for (uxx rIndex = 0; rIndex < numRanges; rIndex++)
+	{
+		const MeshletDrawRange* range = &ranges[rIndex];
+		if (range->partIndex != boundPartIndex)
 		{
-			BindTextureAtIndex(&gfx.pixelTexture, 0);
-			BindTextureAtIndex(&gfx.pixelTexture, 1);
-			BindTextureAtIndex(&gfx.pixelTexture, 2);
-			BindTextureAtIndex(&gfx.pixelTexture, 3);
-			BindTextureAtIndex(&gfx.pixelTexture, 4);
-			SetTintColor(MonokaiPurple);
+			ApplyStagedDraw(list, model, &draws[range->partIndex], depthOnly);
+			BindVertBuffer(VarArrayGetHard(VertBuffer, &model->vertBuffers, range->partIndex));
+			boundPartIndex = range->partIndex;
 		}
-		
-		VertBuffer* partVertBuffer = VarArrayGetHard(VertBuffer, &model->vertBuffers, pIndex);
-		mat4 partWorldMatrix = Mat4_Identity;
-		TransformMat4(&partWorldMatrix, ToMat4FromQuat(part->transform.rotation)); //TODO: Order of rotation and scaling??
-		TransformMat4(&partWorldMatrix, MakeScaleMat4(part->transform.scale));
-		TransformMat4(&partWorldMatrix, MakeTranslateMat4(part->transform.position));
-		SetWorldMat(Mul(baseWorldMat, partWorldMatrix));
-		BindVertBuffer(partVertBuffer);
-		DrawVertices();
+		DrawVerticesEx(range->firstIndex, range->numIndices);
 	}
 }
+
+// The list must have been filled from this queue (FillStagedDrawList) after it was last sorted
+void DrawRenderQueue(RenderQueue* queue, StagedDrawList* list, InstanceStore* store, reci scissorRec, bool depthOnly)
+{
+	ResetStagedDrawState(list);
+	VarArrayLoop(&queue->items, qIndex)
+	{
+		VarArrayLoopGet(RenderQueueItem, item, &queue->items, qIndex);
+		const StagedDraw* draws = GetFrameStagedDraws(list, item->firstDraw);
+		if (item->scissored) { SetClipRec(scissorRec); }
+		else { DisableClipRec(); }
+		if (item->firstRange != RENDER_QUEUE_NO_RANGES)
+		{
+			const MeshletDrawRange* ranges = VarArrayGetHard(MeshletDrawRange, &queue->meshletRanges, item->firstRange);
+			DrawInstanceMeshletRanges(store, item->instanceIndex, list, draws, ranges, item->numRanges, depthOnly);
+		}
+		else { DrawInstanceEx(store, item->instanceIndex, list, draws, depthOnly); }
+	}
+	DisableClipRec();
+}
+
+// Renders the current instances from the current camera on the CPU and writes path_trace_[mode].png/.exr next to the exe
+void RenderPathTracerReference(PathTracerMode mode)
+{
+	PathTracerScene scene = ZEROED;
+	BuildPathTracerScene(stdHeap, &app->instances, &scene);
+	
+	PathTracerSettings settings = ZEROED;
+	settings.mode = mode;
+	settings.size = NewV2i(PATH_TRACER_REFERENCE_SIZE, PATH_TRACER_REFERENCE_SIZE);
+	settings.samplesPerPixel = (mode == PathTracerMode_Shader) ? 1 : PATH_TRACER_REFERENCE_SPP;
+	settings.maxBounces = 4;
+	settings.seed = 1;
+	settings.cameraPos = app->cameraPos;
+	settings.cameraLookDir = app->cameraLookDir;
+	settings.fieldOfViewY = TEST_CAMERA_FOV;
+	settings.lightPos = app->lightPos;
+	settings.lightIntensity = TEST_LIGHT_INTENSITY;
+	settings.lightRadius = TEST_LIGHT_RADIUS;
+	settings.ambientColor = TEST_AMBIENT_COLOR;
+	settings.backgroundColor = TEST_AMBIENT_COLOR;
+	settings.aoDistance = 1.0f;
+	
+	PathTracer tracer = ZEROED;
+	InitPathTracer(stdHeap, &scene, &settings, &tracer);
+	RenderPathTracerImage(&app->jobs, &tracer);
+	ScratchBegin(scratch);
+	FilePath pngPath = PrintInArenaStr(scratch, "path_trace_%s.png", GetPathTracerModeStr(mode));
+	FilePath exrPath = PrintInArenaStr(scratch, "path_trace_%s.exr", GetPathTracerModeStr(mode));
+	bool wroteImages = WritePathTracerImages(&tracer, pngPath, exrPath, app->exposure.tonemapper, app->exposure.exposure);
+	PrintLine_I("Path traced %s (%llu triangles, %dx%d, %llu spp) in %.1lfms: %llu rays (%.2lf Mrays/s)",
+		GetPathTracerModeStr(mode), (u64)scene.triangles.length, settings.size.Width, settings.size.Height, (u64)settings.samplesPerPixel,
+		tracer.renderMs, (u64)tracer.numRays, (r64)tracer.numRays / (tracer.renderMs * 1000.0)
+	);
+	if (!wroteImages) { PrintLine_E("Failed to write \"%.*s\" and/or \"%.*s\"", StrPrint(pngPath), StrPrint(exrPath)); }
+	ScratchEnd(scratch);
+	
+	FreePathTracer(&tracer);
+	FreePathTracerScene(&scene);
+}
 #endif //FP3D_SCENE_ENABLED
@@ -0,0 +1,220 @@
+/*
+File:   app_image_export.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds EncodePngImage and EncodeExrImage (see app_image_export.h)
+*/
+
+// +--------------------------------------------------------------+
+// |                           Writer                             |
+// +--------------------------------------------------------------+
+static inline void WriteImageBytes(ImageExportWriter* writer, const void* bytes, uxx numBytes)
+{
+	Assert(writer->size + numBytes <= writer->capacity);
+	MyMemCopy(&writer->bytes[writer->size], bytes, numBytes);
+	writer->size += numBytes;
+}
+static inline void WriteImageU8(ImageExportWriter* writer, u8 value) { WriteImageBytes(writer, &value, 1); }
+static inline void WriteImageU32BigEndian(ImageExportWriter* writer, u32 value)
+{
+	u8 bytes[4] = { (u8)(value >> 24), (u8)(value >> 16), (u8)(value >> 8), (u8)value };
+	WriteImageBytes(writer, bytes, sizeof(bytes));
+}
+static inline void WriteImageU32LittleEndian(ImageExportWriter* writer, u32 value)
+{
+	u8 bytes[4] = { (u8)value, (u8)(value >> 8), (u8)(value >> 16), (u8)(value >> 24) };
+	WriteImageBytes(writer, bytes, sizeof(bytes));
+}
+static inline void WriteImageU64LittleEndian(ImageExportWriter* writer, u64 value)
+{
+	WriteImageU32LittleEndian(writer, (u32)value);
+	WriteImageU32LittleEndian(writer, (u32)(value >> 32));
+}
+static inline void WriteImageR32LittleEndian(ImageExportWriter* writer, r32 value)
+{
+	u32 bits = 0;
+	MyMemCopy(&bits, &value, sizeof(bits));
+	WriteImageU32LittleEndian(writer, bits);
+}
+static inline void WriteImageCStr(ImageExportWriter* writer, const char* nullTermStr)
+{
+	WriteImageBytes(writer, nullTermStr, (uxx)MyStrLength64(nullTermStr) + 1);
+}
+
+// +--------------------------------------------------------------+
+// |                             PNG                              |
+// +--------------------------------------------------------------+
+static u32 pngCrcTable[256];
+static bool pngCrcTableFilled = false;
+
+static u32 UpdatePngCrc32(u32 crc, const u8* bytes, uxx numBytes)
+{
+	if (!pngCrcTableFilled)
+	{
+		for (u32 tIndex = 0; tIndex < 256; tIndex++)
+		{
+			u32 value = tIndex;
+			for (uxx bit = 0; bit < 8; bit++) { value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1); }
+			pngCrcTable[tIndex] = value;
+		}
+		pngCrcTableFilled = true;
+	}
+	crc = ~crc;
+	for (uxx bIndex = 0; bIndex < numBytes; bIndex++) { crc = pngCrcTable[(crc ^ bytes[bIndex]) & 0xFF] ^ (crc >> 8); }
+	return ~crc;
+}
+
+// The chunk's CRC covers its type and data but not the length
+static void WritePngChunk(ImageExportWriter* writer, const char* type, uxx dataSize, uxx dataStart)
+{
+	Assert(dataStart >= 8);
+	u8* lengthAndType = &writer->bytes[dataStart - 8];
+	lengthAndType[0] = (u8)(dataSize >> 24); lengthAndType[1] = (u8)(dataSize >> 16); lengthAndType[2] = (u8)(dataSize >> 8); lengthAndType[3] = (u8)dataSize;
+	MyMemCopy(&lengthAndType[4], type, 4);
+	WriteImageU32BigEndian(writer, UpdatePngCrc32(0, &lengthAndType[4], dataSize + 4));
+}
+
+// RGBA8 pixels (R in the lowest byte, the same layout ImageData and InitTexture use) to a PNG file in memory.
+// The zlib stream uses stored (uncompressed) deflate blocks and filter type 0 on every row
+Str8 EncodePngImage(Arena* arena, v2i size, const u32* pixels)
+{
+	NotNull(arena);
+	NotNull(pixels);
+	Assert(size.Width > 0 && size.Height > 0);
+	uxx rowSize = 1 + (uxx)size.Width * 4;
+	uxx rawSize = rowSize * (uxx)size.Height;
+	uxx numBlocks = (rawSize + PNG_MAX_STORED_BLOCK_SIZE - 1) / PNG_MAX_STORED_BLOCK_SIZE;
+	uxx idatSize = 2 + numBlocks * 5 + rawSize + 4;
+	
+	ImageExportWriter writer = ZEROED;
+	writer.capacity = 8 + (12 + 13) + (12 + idatSize) + 12;
+	writer.bytes = AllocArray(u8, arena, writer.capacity);
+	NotNull(writer.bytes);
+	
+	const u8 signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+	WriteImageBytes(&writer, signature, sizeof(signature));
+	
+	writer.size += 8; uxx ihdrStart = writer.size;
+	WriteImageU32BigEndian(&writer, (u32)size.Width);
+	WriteImageU32BigEndian(&writer, (u32)size.Height);
+	WriteImageU8(&writer, 8); //bit depth
+	WriteImageU8(&writer, 6); //color type: RGBA
+	WriteImageU8(&writer, 0); //compression
+	WriteImageU8(&writer, 0); //filter method
+	WriteImageU8(&writer, 0); //no interlacing
+	WritePngChunk(&writer, "IHDR", 13, ihdrStart);
+	
+	writer.size += 8; uxx idatStart = writer.size;
+	WriteImageU8(&writer, 0x78); //deflate, 32k window
+	WriteImageU8(&writer, 0x01); //no preset dictionary, lowest level, (0x7801 % 31) == 0
+	u32 adlerLow = 1;
+	u32 adlerHigh = 0;
+	uxx rawOffset = 0;
+	while (rawOffset < rawSize)
+	{
+		uxx blockSize = MinUXX(rawSize - rawOffset, PNG_MAX_STORED_BLOCK_SIZE);
+		WriteImageU8(&writer, (rawOffset + blockSize >= rawSize) ? 0x01 : 0x00); //BFINAL, BTYPE = stored
+		u8 lengths[4] = { (u8)blockSize, (u8)(blockSize >> 8), (u8)~blockSize, (u8)(~blockSize >> 8) };
+		WriteImageBytes(&writer, lengths, sizeof(lengths));
+		for (uxx bIndex = rawOffset; bIndex < rawOffset + blockSize; bIndex++)
+		{
+			uxx rowIndex = bIndex / rowSize;
+			uxx columnByte = bIndex % rowSize;
+			u8 value = (columnByte == 0) ? 0 : ((const u8*)&pixels[rowIndex * (uxx)size.Width])[columnByte - 1];
+			writer.bytes[writer.size++] = value;
+			adlerLow = (adlerLow + value) % 65521;
+			adlerHigh = (adlerHigh + adlerLow) % 65521;
+		}
+		rawOffset += blockSize;
+	}
+	WriteImageU32BigEndian(&writer, (adlerHigh << 16) | adlerLow);
+	Assert(writer.size - idatStart == idatSize);
+	WritePngChunk(&writer, "IDAT", idatSize, idatStart);
+	
+	writer.size += 8;
+	WritePngChunk(&writer, "IEND", 0, writer.size);
+	Assert(writer.size == writer.capacity);
+	return NewStr8(writer.size, (char*)writer.bytes);
+}
+
+// +--------------------------------------------------------------+
+// |                             EXR                              |
+// +--------------------------------------------------------------+
+static void WriteExrAttributeHeader(ImageExportWriter* writer, const char* name, const char* type, u32 size)
+{
+	WriteImageCStr(writer, name);
+	WriteImageCStr(writer, type);
+	WriteImageU32LittleEndian(writer, size);
+}
+
+static void WriteExrBox2i(ImageExportWriter* writer, const char* name, v2i size)
+{
+	WriteExrAttributeHeader(writer, name, "box2i", 16);
+	WriteImageU32LittleEndian(writer, 0);
+	WriteImageU32LittleEndian(writer, 0);
+	WriteImageU32LittleEndian(writer, (u32)(size.Width - 1));
+	WriteImageU32LittleEndian(writer, (u32)(size.Height - 1));
+}
+
+// Linear RGB to a single-part scanline OpenEXR file with 32-bit float channels and no compression.
+// Channels are written B, G, R since the format requires them sorted by name
+Str8 EncodeExrImage(Arena* arena, v2i size, const v3* pixels)
+{
+	NotNull(arena);
+	NotNull(pixels);
+	Assert(size.Width > 0 && size.Height > 0);
+	const char* channelNames[] = { "B", "G", "R" };
+	uxx scanlineDataSize = (uxx)size.Width * ArrayCount(channelNames) * sizeof(r32);
+	uxx scanlineSize = 4 + 4 + scanlineDataSize;
+	
+	ImageExportWriter writer = ZEROED;
+	writer.capacity = EXR_MAX_HEADER_SIZE + (uxx)size.Height * (sizeof(u64) + scanlineSize);
+	writer.bytes = AllocArray(u8, arena, writer.capacity);
+	NotNull(writer.bytes);
+	
+	WriteImageU32LittleEndian(&writer, 20000630); //magic number
+	WriteImageU32LittleEndian(&writer, 2); //version 2, single part scanline
+	
+	WriteExrAttributeHeader(&writer, "channels", "chlist", (u32)(ArrayCount(channelNames) * (2 + 16) + 1));
+	for (uxx cIndex = 0; cIndex < ArrayCount(channelNames); cIndex++)
+	{
+		WriteImageCStr(&writer, channelNames[cIndex]);
+		WriteImageU32LittleEndian(&writer, 2); //pixel type FLOAT
+		WriteImageU32LittleEndian(&writer, 0); //pLinear and 3 reserved bytes
+		WriteImageU32LittleEndian(&writer, 1); //xSampling
+		WriteImageU32LittleEndian(&writer, 1); //ySampling
+	}
+	WriteImageU8(&writer, 0);
+	WriteExrAttributeHeader(&writer, "compression", "compression", 1);
+	WriteImageU8(&writer, 0); //NO_COMPRESSION
+	WriteExrBox2i(&writer, "dataWindow", size);
+	WriteExrBox2i(&writer, "displayWindow", size);
+	WriteExrAttributeHeader(&writer, "lineOrder", "lineOrder", 1);
+	WriteImageU8(&writer, 0); //INCREASING_Y
+	WriteExrAttributeHeader(&writer, "pixelAspectRatio", "float", 4);
+	WriteImageR32LittleEndian(&writer, 1.0f);
+	WriteExrAttributeHeader(&writer, "screenWindowCenter", "v2f", 8);
+	WriteImageR32LittleEndian(&writer, 0.0f);
+	WriteImageR32LittleEndian(&writer, 0.0f);
+	WriteExrAttributeHeader(&writer, "screenWindowWidth", "float", 4);
+	WriteImageR32LittleEndian(&writer, 1.0f);
+	WriteImageU8(&writer, 0); //end of header
+	Assert(writer.size <= EXR_MAX_HEADER_SIZE);
+	
+	uxx firstScanlineOffset = writer.size + (uxx)size.Height * sizeof(u64);
+	for (uxx yIndex = 0; yIndex < (uxx)size.Height; yIndex++)
+	{
+		WriteImageU64LittleEndian(&writer, (u64)(firstScanlineOffset + yIndex * scanlineSize));
+	}
+	for (uxx yIndex = 0; yIndex < (uxx)size.Height; yIndex++)
+	{
+		const v3* row = &pixels[yIndex * (uxx)size.Width];
+		WriteImageU32LittleEndian(&writer, (u32)yIndex);
+		WriteImageU32LittleEndian(&writer, (u32)scanlineDataSize);
+		for (uxx xIndex = 0; xIndex < (uxx)size.Width; xIndex++) { WriteImageR32LittleEndian(&writer, row[xIndex].Z); }
+		for (uxx xIndex = 0; xIndex < (uxx)size.Width; xIndex++) { WriteImageR32LittleEndian(&writer, row[xIndex].Y); }
+		for (uxx xIndex = 0; xIndex < (uxx)size.Width; xIndex++) { WriteImageR32LittleEndian(&writer, row[xIndex].X); }
+	}
+	return NewStr8(writer.size, (char*)writer.bytes);
+}
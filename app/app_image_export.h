@@ -0,0 +1,26 @@
+/*
+File:   app_image_export.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Minimal encoders for writing images we rendered on the CPU to disk. PNG is for 8-bit display
+	** colors and EXR (uncompressed, 32-bit float scanlines) is for linear HDR values that need to be
+	** compared exactly. Neither one compresses anything, they are meant for reference/debug output
+	** where correctness and simplicity matter more than file size.
+*/
+
+#ifndef _APP_IMAGE_EXPORT_H
+#define _APP_IMAGE_EXPORT_H
+
+#define PNG_MAX_STORED_BLOCK_SIZE 65535 //the most a single uncompressed deflate block can hold
+#define EXR_MAX_HEADER_SIZE       512 //our header only ever has the 8 required attributes
+
+typedef struct ImageExportWriter ImageExportWriter;
+struct ImageExportWriter
+{
+	u8* bytes;
+	uxx size;
+	uxx capacity;
+};
+
+#endif //  _APP_IMAGE_EXPORT_H
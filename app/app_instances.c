@@ -0,0 +1,289 @@
+/*
+File:   app_instances.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that spawn, despawn and update instances in an InstanceStore (see app_instances.h)
+*/
+
+void InitInstanceStore(Arena* arena, uxx capacity, SceneGraph* sceneGraph, InstanceStore* storeOut)
+{
+	NotNull(arena);
+	NotNull(sceneGraph);
+	NotNull(storeOut);
+	Assert(capacity > 0 && capacity < INSTANCE_INDEX_INVALID);
+	ClearPointer(storeOut);
+	storeOut->arena = arena;
+	storeOut->sceneGraph = sceneGraph;
+	storeOut->capacity = capacity;
+	storeOut->firstFreeSlot = INSTANCE_INDEX_INVALID;
+	InitVarArray(Model3D*, &storeOut->models, arena);
+	storeOut->slots = AllocArray(InstanceSlot, arena, capacity);
+	storeOut->slotIndices = AllocArray(u32, arena, capacity);
+	storeOut->transforms = AllocTrsSoa(arena, capacity);
+	storeOut->transforms.count = 0;
+	storeOut->modelIds = AllocArray(u32, arena, capacity);
+	storeOut->materialOverrides = AllocArray(u32, arena, capacity);
+	storeOut->tints = AllocArray(Color32, arena, capacity);
+	storeOut->bounds = AllocArray(box, arena, capacity);
+	storeOut->flags = AllocArray(u16, arena, capacity);
+	storeOut->sceneRoots = AllocArray(u32, arena, capacity);
+	storeOut->physicsBodyIndices = AllocArray(u32, arena, capacity);
+	storeOut->lodLevels = AllocArray(u8, arena, capacity);
+	NotNull(storeOut->slots);
+	NotNull(storeOut->slotIndices);
+	NotNull(storeOut->modelIds);
+	NotNull(storeOut->materialOverrides);
+	NotNull(storeOut->tints);
+	NotNull(storeOut->bounds);
+	NotNull(storeOut->flags);
+	NotNull(storeOut->sceneRoots);
+	NotNull(storeOut->physicsBodyIndices);
+	NotNull(storeOut->lodLevels);
+}
+
+u32 RegisterInstanceModel(InstanceStore* store, Model3D* model)
+{
+	NotNull(store);
+	NotNull(model);
+	VarArrayLoop(&store->models, mIndex)
+	{
+		VarArrayLoopGet(Model3D*, existingModel, &store->models, mIndex);
+		if (*existingModel == model) { return (u32)mIndex; }
+	}
+	Model3D** newModel = VarArrayAdd(Model3D*, &store->models);
+	NotNull(newModel);
+	*newModel = model;
+	return (u32)(store->models.length - 1);
+}
+
+Model3D* GetInstanceModel(InstanceStore* store, u32 modelId)
+{
+	if (modelId == INSTANCE_MODEL_NONE) { return nullptr; }
+	return *VarArrayGetHard(Model3D*, &store->models, modelId);
+}
+
+// Returns INSTANCE_INDEX_INVALID if the handle is stale (instance was despawned)
+u32 GetInstanceIndex(const InstanceStore* store, InstanceHandle handle)
+{
+	NotNull(store);
+	if (handle.generation == 0 || handle.slot >= store->numSlotsUsed) { return INSTANCE_INDEX_INVALID; }
+	const InstanceSlot* slot = &store->slots[handle.slot];
+	if (slot->generation != handle.generation) { return INSTANCE_INDEX_INVALID; }
+	return slot->denseIndex;
+}
+bool IsInstanceHandleValid(const InstanceStore* store, InstanceHandle handle)
+{
+	return (GetInstanceIndex(store, handle) != INSTANCE_INDEX_INVALID);
+}
+
+static mat4 GetInstanceWorldMat(const InstanceStore* store, uxx iIndex)
+{
+	bool isBox = IsFlagSet(store->flags[iIndex], InstanceFlag_DrawAsBox);
+	return ComposeTrsMat4Ex(
+		NewV3(store->transforms.positionX[iIndex], store->transforms.positionY[iIndex], store->transforms.positionZ[iIndex]),
+		NewQuat(store->transforms.rotationX[iIndex], store->transforms.rotationY[iIndex], store->transforms.rotationZ[iIndex], store->transforms.rotationW[iIndex]),
+		NewV3(store->transforms.scaleX[iIndex], store->transforms.scaleY[iIndex], store->transforms.scaleZ[iIndex]),
+		isBox ? TrsOrder_ScaleThenRotate : TrsOrder_RotateThenScale,
+		isBox ? FillV3(-0.5f) : V3_Zero
+	);
+}
+
+static box GetInstanceLocalBounds(InstanceStore* store, uxx iIndex)
+{
+	if (IsFlagSet(store->flags[iIndex], InstanceFlag_DrawAsBox)) { return NewBoxV(V3_Zero, V3_One); }
+	Model3D* model = GetInstanceModel(store, store->modelIds[iIndex]);
+	return (model != nullptr) ? model->localBounds : NewBoxV(V3_Zero, V3_Zero);
+}
+
+InstanceHandle SpawnInstance(InstanceStore* store, u32 modelId, v3 position, quat rotation, v3 scale, u16 flags)
+{
+	NotNull(store);
+	Assert(store->count < store->capacity);
+	Assert(modelId != INSTANCE_MODEL_NONE || IsFlagSet(flags, InstanceFlag_DrawAsBox));
+	Model3D* model = GetInstanceModel(store, modelId);
+	
+	u32 slotIndex = INSTANCE_INDEX_INVALID;
+	if (store->firstFreeSlot != INSTANCE_INDEX_INVALID)
+	{
+		slotIndex = store->firstFreeSlot;
+		store->firstFreeSlot = store->slots[slotIndex].nextFreeSlot;
+	}
+	else
+	{
+		Assert(store->numSlotsUsed < store->capacity);
+		slotIndex = store->numSlotsUsed++;
+		store->slots[slotIndex].generation = 0;
+	}
+	InstanceSlot* slot = &store->slots[slotIndex];
+	slot->generation++;
+	if (slot->generation == 0) { slot->generation = 1; }
+	slot->nextFreeSlot = INSTANCE_INDEX_INVALID;
+	
+	u32 iIndex = (u32)store->count;
+	store->count++;
+	store->transforms.count = store->count;
+	slot->denseIndex = iIndex;
+	store->slotIndices[iIndex] = slotIndex;
+	SetTrsSoaAt(&store->transforms, iIndex, position, rotation, scale);
+	store->modelIds[iIndex] = modelId;
+	store->materialOverrides[iIndex] = INSTANCE_NO_MATERIAL_OVERRIDE;
+	store->tints[iIndex] = White;
+	store->flags[iIndex] = (u16)(flags | InstanceFlag_TransformDirty);
+	store->physicsBodyIndices[iIndex] = INSTANCE_NO_PHYSICS_BODY;
+	store->lodLevels[iIndex] = 0;
+	store->numDirtyTransforms++;
+	store->layoutVersion++;
+	
+	mat4 worldMat = GetInstanceWorldMat(store, iIndex);
+	store->bounds[iIndex] = TransformBoxByMat4(&worldMat, GetInstanceLocalBounds(store, iIndex));
+	store->sceneRoots[iIndex] = (model != nullptr)
+		? AddModelToSceneGraph(store->sceneGraph, model, worldMat)
+		: AddSceneNode(store->sceneGraph, SCENE_NODE_INVALID, worldMat);
+	
+	return (InstanceHandle){ .slot = slotIndex, .generation = slot->generation };
+}
+
+// Swap-removes the instance from the dense arrays, gives its scene node block back to the SceneGraph and pushes its slot on the free list
+void DespawnInstance(InstanceStore* store, InstanceHandle handle)
+{
+	NotNull(store);
+	u32 iIndex = GetInstanceIndex(store, handle);
+	Assert(iIndex != INSTANCE_INDEX_INVALID);
+	RemoveSceneSubtree(store->sceneGraph, store->sceneRoots[iIndex]);
+	if (IsFlagSet(store->flags[iIndex], InstanceFlag_TransformDirty)) { store->numDirtyTransforms--; }
+	u32 lastIndex = (u32)(store->count - 1);
+	if (iIndex != lastIndex)
+	{
+		store->slotIndices[iIndex] = store->slotIndices[lastIndex];
+		store->transforms.positionX[iIndex] = store->transforms.positionX[lastIndex];
+		store->transforms.positionY[iIndex] = store->transforms.positionY[lastIndex];
+		store->transforms.positionZ[iIndex] = store->transforms.positionZ[lastIndex];
+		store->transforms.rotationX[iIndex] = store->transforms.rotationX[lastIndex];
+		store->transforms.rotationY[iIndex] = store->transforms.rotationY[lastIndex];
+		store->transforms.rotationZ[iIndex] = store->transforms.rotationZ[lastIndex];
+		store->transforms.rotationW[iIndex] = store->transforms.rotationW[lastIndex];
+		store->transforms.scaleX[iIndex] = store->transforms.scaleX[lastIndex];
+		store->transforms.scaleY[iIndex] = store->transforms.scaleY[lastIndex];
+		store->transforms.scaleZ[iIndex] = store->transforms.scaleZ[lastIndex];
+		store->modelIds[iIndex] = store->modelIds[lastIndex];
+		store->materialOverrides[iIndex] = store->materialOverrides[lastIndex];
+		store->tints[iIndex] = store->tints[lastIndex];
+		store->bounds[iIndex] = store->bounds[lastIndex];
+		store->flags[iIndex] = store->flags[lastIndex];
+		store->sceneRoots[iIndex] = store->sceneRoots[lastIndex];
+		store->physicsBodyIndices[iIndex] = store->physicsBodyIndices[lastIndex];
+		store->lodLevels[iIndex] = store->lodLevels[lastIndex];
+		store->slots[store->slotIndices[iIndex]].denseIndex = iIndex;
+	}
+	store->count--;
+	store->transforms.count = store->count;
+	store->layoutVersion++;
+	
+	InstanceSlot* slot = &store->slots[handle.slot];
+	slot->denseIndex = INSTANCE_INDEX_INVALID;
+	slot->generation++;
+	if (slot->generation == 0) { slot->generation = 1; }
+	slot->nextFreeSlot = store->firstFreeSlot;
+	store->firstFreeSlot = handle.slot;
+}
+
+void SetInstanceTransformAt(InstanceStore* store, uxx iIndex, v3 position, quat rotation, v3 scale)
+{
+	Assert(iIndex < store->count);
+	SetTrsSoaAt(&store->transforms, iIndex, position, rotation, scale);
+	if (!IsFlagSet(store->flags[iIndex], InstanceFlag_TransformDirty))
+	{
+		FlagSet(store->flags[iIndex], InstanceFlag_TransformDirty);
+		store->numDirtyTransforms++;
+	}
+}
+void SetInstanceTransform(InstanceStore* store, InstanceHandle handle, v3 position, quat rotation, v3 scale)
+{
+	u32 iIndex = GetInstanceIndex(store, handle);
+	Assert(iIndex != INSTANCE_INDEX_INVALID);
+	SetInstanceTransformAt(store, iIndex, position, rotation, scale);
+}
+
+void SetInstancePhysicsBody(InstanceStore* store, InstanceHandle handle, u32 physicsBodyIndex)
+{
+	u32 iIndex = GetInstanceIndex(store, handle);
+	Assert(iIndex != INSTANCE_INDEX_INVALID);
+	store->physicsBodyIndices[iIndex] = physicsBodyIndex;
+	FlagSetTo(store->flags[iIndex], InstanceFlag_PhysicsDriven, (physicsBodyIndex != INSTANCE_NO_PHYSICS_BODY));
+}
+
+#if BUILD_WITH_PHYSX
+// Pulls the transform of every InstanceFlag_PhysicsDriven instance from its PhysicsBody so rendering only ever reads the InstanceStore
+void SyncInstancesFromPhysics(InstanceStore* store, PhysicsWorld* physWorld)
+{
+	NotNull(store);
+	NotNull(physWorld);
+	for (uxx iIndex = 0; iIndex < store->count; iIndex++)
+	{
+		if (!IsFlagSet(store->flags[iIndex], InstanceFlag_PhysicsDriven)) { continue; }
+		PhysicsBody* body = VarArrayGetHard(PhysicsBody, &physWorld->bodies, store->physicsBodyIndices[iIndex]);
+		PhysicsBodyTransform transform = GetPhysicsBodyTransform(body);
+		v3 scale = NewV3(store->transforms.scaleX[iIndex], store->transforms.scaleY[iIndex], store->transforms.scaleZ[iIndex]);
+		SetInstanceTransformAt(store, iIndex,
+			NewV3(transform.position.X, transform.position.Y, transform.position.Z),
+			NewQuat(transform.rotation.X, transform.rotation.Y, transform.rotation.Z, transform.rotation.W),
+			scale
+		);
+	}
+}
+#endif //BUILD_WITH_PHYSX
+
+// Recomposes world matrices of every dirty instance (in one batch per TrsOrder), pushes
+// them into the scene graph and refreshes the world-space bounds, then updates the scene graph.
+// Returns how many instances were recomposed (i.e. how many bounds changed)
+uxx UpdateInstanceTransforms(InstanceStore* store, JobSystem* jobs)
+{
+	NotNull(store);
+	uxx numUpdated = 0;
+	if (store->numDirtyTransforms > 0)
+	{
+		ScratchBegin(scratch);
+		for (uxx oIndex = 0; oIndex < 2; oIndex++)
+		{
+			bool isBoxBatch = (oIndex == 1);
+			TrsSoa dirtySoa = AllocTrsSoa(scratch, store->numDirtyTransforms);
+			u32* dirtyIndices = AllocArray(u32, scratch, store->numDirtyTransforms);
+			NotNull(dirtyIndices);
+			dirtySoa.count = 0;
+			for (uxx iIndex = 0; iIndex < store->count; iIndex++)
+			{
+				u16 instanceFlags = store->flags[iIndex];
+				if (!IsFlagSet(instanceFlags, InstanceFlag_TransformDirty)) { continue; }
+				if (IsFlagSet(instanceFlags, InstanceFlag_DrawAsBox) != isBoxBatch) { continue; }
+				uxx dIndex = dirtySoa.count++;
+				dirtyIndices[dIndex] = (u32)iIndex;
+				SetTrsSoaAt(&dirtySoa, dIndex,
+					NewV3(store->transforms.positionX[iIndex], store->transforms.positionY[iIndex], store->transforms.positionZ[iIndex]),
+					NewQuat(store->transforms.rotationX[iIndex], store->transforms.rotationY[iIndex], store->transforms.rotationZ[iIndex], store->transforms.rotationW[iIndex]),
+					NewV3(store->transforms.scaleX[iIndex], store->transforms.scaleY[iIndex], store->transforms.scaleZ[iIndex])
+				);
+			}
+			if (dirtySoa.count == 0) { continue; }
+			mat4* worldMats = AllocArray(mat4, scratch, dirtySoa.count);
+			NotNull(worldMats);
+			ComposeTrsMat4BatchEx(&dirtySoa,
+				isBoxBatch ? TrsOrder_ScaleThenRotate : TrsOrder_RotateThenScale,
+				isBoxBatch ? FillV3(-0.5f) : V3_Zero,
+				worldMats
+			);
+			for (uxx dIndex = 0; dIndex < dirtySoa.count; dIndex++)
+			{
+				u32 iIndex = dirtyIndices[dIndex];
+				SetSceneNodeLocalMat(store->sceneGraph, store->sceneRoots[iIndex], worldMats[dIndex]);
+				store->bounds[iIndex] = TransformBoxByMat4(&worldMats[dIndex], GetInstanceLocalBounds(store, iIndex));
+				FlagUnset(store->flags[iIndex], InstanceFlag_TransformDirty);
+			}
+			numUpdated += dirtySoa.count;
+		}
+		store->numDirtyTransforms = 0;
+		ScratchEnd(scratch);
+	}
+	UpdateSceneGraph(store->sceneGraph, jobs);
+	return numUpdated;
+}
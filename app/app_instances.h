@@ -0,0 +1,83 @@
+/*
+File:   app_instances.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** The InstanceStore holds every renderable instance in the scene as densely packed
+	** structure-of-arrays components so culling, sorting and drawing can walk them linearly.
+	** Instances are referred to by an InstanceHandle which stays valid while the instance
+	** moves around in the dense arrays. Spawn and despawn are O(1) in the number of instances
+	** (free list + swap-remove), each instance's scene nodes live in a fixed block of the
+	** SceneGraph that is handed out and given back through the graph's own free list
+*/
+
+#ifndef _APP_INSTANCES_H
+#define _APP_INSTANCES_H
+
+typedef struct Model3D Model3D;
+
+#define INSTANCE_INDEX_INVALID         UINT32_MAX
+#define INSTANCE_MODEL_NONE            UINT32_MAX //used by InstanceFlag_DrawAsBox instances
+#define INSTANCE_NO_MATERIAL_OVERRIDE  UINT32_MAX
+#define INSTANCE_NO_PHYSICS_BODY       UINT32_MAX
+
+typedef enum InstanceFlag InstanceFlag;
+enum InstanceFlag
+{
+	InstanceFlag_None           = 0x0000,
+	InstanceFlag_Visible        = 0x0001,
+	InstanceFlag_TransformDirty = 0x0002, //set by SetInstanceTransform, cleared by UpdateInstanceTransforms
+	InstanceFlag_PhysicsDriven  = 0x0004, //transform is pulled from physicsBodyIndices each frame
+	InstanceFlag_DrawAsBox      = 0x0008, //drawn as a unit cube centered on the position, no model
+	InstanceFlag_Culled         = 0x0010, //written by the culling pass each frame
+	InstanceFlag_Occluder       = 0x0020, //rasterized into the OcclusionBuffer when close enough to the camera
+	InstanceFlag_All            = 0x003F,
+};
+
+typedef struct InstanceHandle InstanceHandle;
+struct InstanceHandle
+{
+	u32 slot;
+	u32 generation; //0 is never a valid generation so a ZEROED handle is always invalid
+};
+#define InstanceHandle_Invalid ((InstanceHandle){ .slot = 0, .generation = 0 })
+
+// Slots are what handles point to. They stay put while the dense index of the instance changes
+typedef struct InstanceSlot InstanceSlot;
+struct InstanceSlot
+{
+	u32 generation;
+	u32 denseIndex; //INSTANCE_INDEX_INVALID when the slot is free
+	u32 nextFreeSlot;
+};
+
+typedef struct InstanceStore InstanceStore;
+struct InstanceStore
+{
+	Arena* arena;
+	SceneGraph* sceneGraph;
+	uxx count;
+	uxx capacity;
+	
+	VarArray models; //Model3D*, indexed by modelId
+	
+	InstanceSlot* slots;
+	u32 numSlotsUsed;
+	u32 firstFreeSlot;
+	u32 numDirtyTransforms;
+	uxx layoutVersion; //incremented on every spawn/despawn, anything holding on to dense indices (like a Bvh) is stale once this changes
+	
+	// Dense component arrays, all indexed [0, count)
+	u32* slotIndices;
+	TrsSoa transforms; //position, rotation, scale
+	u32* modelIds;
+	u32* materialOverrides;
+	Color32* tints;
+	box* bounds; //world-space AABB
+	u16* flags; //InstanceFlag
+	u32* sceneRoots;
+	u32* physicsBodyIndices;
+	u8* lodLevels; //written by SelectInstanceLod, kept between frames for hysteresis
+};
+
+#endif //  _APP_INSTANCES_H
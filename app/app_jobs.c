@@ -0,0 +1,278 @@
+/*
+File:   app_jobs.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the worker threads and the functions that start and wait on JobBatches (see app_jobs.h)
+*/
+
+// +--------------------------------------------------------------+
+// |                     Platform Primitives                      |
+// +--------------------------------------------------------------+
+// Returns the value before the add
+i64 JobsAtomicAdd(volatile i64* value, i64 amount)
+{
+	#if TARGET_IS_WINDOWS
+	return InterlockedExchangeAdd64((volatile LONG64*)value, amount);
+	#else
+	return __atomic_fetch_add(value, amount, __ATOMIC_ACQ_REL);
+	#endif
+}
+i64 JobsAtomicLoad(volatile i64* value)
+{
+	#if TARGET_IS_WINDOWS
+	return InterlockedCompareExchange64((volatile LONG64*)value, 0, 0);
+	#else
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+	#endif
+}
+
+static void JobsYield()
+{
+	#if TARGET_IS_WINDOWS
+	SwitchToThread();
+	#elif TARGET_IS_LINUX
+	sched_yield();
+	#endif
+}
+
+static void LockJobSystem(JobSystem* jobs)
+{
+	#if TARGET_IS_WINDOWS
+	AcquireSRWLockExclusive(&jobs->lock);
+	#elif TARGET_IS_LINUX
+	pthread_mutex_lock(&jobs->lock);
+	#endif
+}
+static void UnlockJobSystem(JobSystem* jobs)
+{
+	#if TARGET_IS_WINDOWS
+	ReleaseSRWLockExclusive(&jobs->lock);
+	#elif TARGET_IS_LINUX
+	pthread_mutex_unlock(&jobs->lock);
+	#endif
+}
+// Must be called with the lock held, the lock is held again when this returns
+static void WaitForJobSystemWake(JobSystem* jobs)
+{
+	#if TARGET_IS_WINDOWS
+	SleepConditionVariableSRW(&jobs->wakeCondition, &jobs->lock, INFINITE, 0);
+	#elif TARGET_IS_LINUX
+	pthread_cond_wait(&jobs->wakeCondition, &jobs->lock);
+	#endif
+}
+static void WakeJobSystemWorkers(JobSystem* jobs)
+{
+	#if TARGET_IS_WINDOWS
+	WakeAllConditionVariable(&jobs->wakeCondition);
+	#elif TARGET_IS_LINUX
+	pthread_cond_broadcast(&jobs->wakeCondition);
+	#endif
+}
+
+static uxx GetNumHardwareThreads()
+{
+	#if TARGET_IS_WINDOWS
+	SYSTEM_INFO systemInfo = ZEROED;
+	GetSystemInfo(&systemInfo);
+	return (uxx)systemInfo.dwNumberOfProcessors;
+	#elif TARGET_IS_LINUX
+	long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+	return (numProcessors > 0) ? (uxx)numProcessors : 1;
+	#else
+	return 1;
+	#endif
+}
+
+// +--------------------------------------------------------------+
+// |                           Workers                            |
+// +--------------------------------------------------------------+
+// Claims and runs jobs until every index in the batch has been claimed
+static void RunJobBatchJobs(JobBatch* batch)
+{
+	while (true)
+	{
+		i64 jobIndex = JobsAtomicAdd(&batch->nextJobIndex, 1);
+		if (jobIndex >= batch->numJobs) { break; }
+		batch->func(batch->userPntr, (uxx)jobIndex);
+		JobsAtomicAdd(&batch->numJobsDone, 1);
+	}
+}
+
+// Must be called with the lock held
+static JobBatch* FindJobBatchWithWork(JobSystem* jobs)
+{
+	for (uxx bIndex = 0; bIndex < jobs->numActiveBatches; bIndex++)
+	{
+		JobBatch* batch = jobs->activeBatches[bIndex];
+		if (JobsAtomicLoad(&batch->nextJobIndex) < batch->numJobs) { return batch; }
+	}
+	return nullptr;
+}
+
+static void JobWorkerLoop(JobSystem* jobs)
+{
+	InitScratchArenasVirtual(JOBS_WORKER_SCRATCH_SIZE);
+	LockJobSystem(jobs);
+	while (!jobs->isShuttingDown)
+	{
+		JobBatch* batch = FindJobBatchWithWork(jobs);
+		if (batch == nullptr) { WaitForJobSystemWake(jobs); continue; }
+		//numWorkersInside goes up while the lock is held so FinishJobs can't remove the batch and return in between
+		JobsAtomicAdd(&batch->numWorkersInside, 1);
+		UnlockJobSystem(jobs);
+		RunJobBatchJobs(batch);
+		JobsAtomicAdd(&batch->numWorkersInside, -1); //the last time this worker touches the batch
+		LockJobSystem(jobs);
+	}
+	UnlockJobSystem(jobs);
+}
+
+#if TARGET_IS_WINDOWS
+static DWORD WINAPI JobWorkerMain(LPVOID userPntr) { JobWorkerLoop((JobSystem*)userPntr); return 0; }
+#elif TARGET_IS_LINUX
+static void* JobWorkerMain(void* userPntr) { JobWorkerLoop((JobSystem*)userPntr); return nullptr; }
+#endif
+
+// +--------------------------------------------------------------+
+// |                        Init and Free                         |
+// +--------------------------------------------------------------+
+void FreeJobSystem(JobSystem* jobs)
+{
+	NotNull(jobs);
+	if (jobs->numWorkers > 0)
+	{
+		Assert(jobs->numActiveBatches == 0);
+		LockJobSystem(jobs);
+		jobs->isShuttingDown = true;
+		WakeJobSystemWorkers(jobs);
+		UnlockJobSystem(jobs);
+		for (uxx wIndex = 0; wIndex < jobs->numWorkers; wIndex++)
+		{
+			#if TARGET_IS_WINDOWS
+			WaitForSingleObject(jobs->workerHandles[wIndex], INFINITE);
+			CloseHandle(jobs->workerHandles[wIndex]);
+			#elif TARGET_IS_LINUX
+			pthread_join(jobs->workerHandles[wIndex], nullptr);
+			#endif
+		}
+		#if TARGET_IS_LINUX
+		pthread_cond_destroy(&jobs->wakeCondition);
+		pthread_mutex_destroy(&jobs->lock);
+		#endif
+	}
+	ClearPointer(jobs);
+}
+
+// Pass 0 for numWorkers to use one worker per hardware thread besides the calling one.
+// The JobSystem must not move after this since the workers hold a pointer to it
+void InitJobSystem(Arena* arena, uxx numWorkers, JobSystem* jobsOut)
+{
+	NotNull(arena);
+	NotNull(jobsOut);
+	ClearPointer(jobsOut);
+	jobsOut->arena = arena;
+	if (numWorkers == 0) { numWorkers = GetNumHardwareThreads() - 1; }
+	numWorkers = MinUXX(numWorkers, JOBS_MAX_WORKERS);
+	
+	#if TARGET_IS_WINDOWS
+	InitializeSRWLock(&jobsOut->lock);
+	InitializeConditionVariable(&jobsOut->wakeCondition);
+	for (uxx wIndex = 0; wIndex < numWorkers; wIndex++)
+	{
+		HANDLE workerHandle = CreateThread(NULL, 0, JobWorkerMain, jobsOut, 0, NULL);
+		if (workerHandle == NULL) { break; }
+		jobsOut->workerHandles[jobsOut->numWorkers++] = workerHandle;
+	}
+	#elif TARGET_IS_LINUX
+	pthread_mutex_init(&jobsOut->lock, nullptr);
+	pthread_cond_init(&jobsOut->wakeCondition, nullptr);
+	for (uxx wIndex = 0; wIndex < numWorkers; wIndex++)
+	{
+		if (pthread_create(&jobsOut->workerHandles[jobsOut->numWorkers], nullptr, JobWorkerMain, jobsOut) != 0) { break; }
+		jobsOut->numWorkers++;
+	}
+	#endif
+	
+	if (jobsOut->numWorkers < numWorkers) { PrintLine_W("Only started %llu/%llu job workers", (u64)jobsOut->numWorkers, (u64)numWorkers); }
+}
+
+// +--------------------------------------------------------------+
+// |                           Batches                            |
+// +--------------------------------------------------------------+
+// Queues the batch for the workers and returns right away. The batch (and whatever userPntr points at)
+// must stay alive until FinishJobs is called on it. Without workers (or a free slot) the jobs run here instead
+void StartJobs(JobSystem* jobs, JobBatch* batch, uxx numJobs, JobFunc_f* func, void* userPntr)
+{
+	NotNull(batch);
+	NotNull(func);
+	ClearPointer(batch);
+	batch->func = func;
+	batch->userPntr = userPntr;
+	batch->numJobs = (i64)numJobs;
+	if (jobs != nullptr && jobs->numWorkers > 0 && numJobs > 1)
+	{
+		LockJobSystem(jobs);
+		if (jobs->numActiveBatches < JOBS_MAX_ACTIVE_BATCHES)
+		{
+			jobs->activeBatches[jobs->numActiveBatches++] = batch;
+			batch->isQueued = true;
+			WakeJobSystemWorkers(jobs);
+		}
+		UnlockJobSystem(jobs);
+	}
+	if (!batch->isQueued) { RunJobBatchJobs(batch); }
+}
+
+bool IsJobBatchDone(const JobBatch* batch)
+{
+	NotNull(batch);
+	return (JobsAtomicLoad((volatile i64*)&batch->numJobsDone) >= batch->numJobs);
+}
+
+// Helps run whatever is left of the batch on this thread, then waits for the workers to finish theirs
+void FinishJobs(JobSystem* jobs, JobBatch* batch)
+{
+	NotNull(batch);
+	RunJobBatchJobs(batch);
+	while (!IsJobBatchDone(batch)) { JobsYield(); }
+	if (batch->isQueued)
+	{
+		NotNull(jobs);
+		LockJobSystem(jobs);
+		for (uxx bIndex = 0; bIndex < jobs->numActiveBatches; bIndex++)
+		{
+			if (jobs->activeBatches[bIndex] == batch)
+			{
+				jobs->activeBatches[bIndex] = jobs->activeBatches[jobs->numActiveBatches-1];
+				jobs->numActiveBatches--;
+				break;
+			}
+		}
+		jobs->numBatchesRun++;
+		jobs->numJobsRun += (uxx)batch->numJobs;
+		UnlockJobSystem(jobs);
+		while (JobsAtomicLoad(&batch->numWorkersInside) > 0) { JobsYield(); }
+		batch->isQueued = false;
+	}
+}
+
+// Runs func for every jobIndex in [0, numJobs) across the workers and the calling thread and returns when they are all done
+void RunJobs(JobSystem* jobs, uxx numJobs, JobFunc_f* func, void* userPntr)
+{
+	if (numJobs == 0) { return; }
+	JobBatch batch;
+	StartJobs(jobs, &batch, numJobs, func, userPntr);
+	FinishJobs(jobs, &batch);
+}
+
+// How many jobs to split numItems into so each job gets at least minItemsPerJob items
+// and every thread (workers plus the caller) gets a few jobs to balance uneven work
+uxx GetNumJobsForItems(const JobSystem* jobs, uxx numItems, uxx minItemsPerJob)
+{
+	if (numItems == 0) { return 0; }
+	uxx numThreads = (jobs != nullptr) ? jobs->numWorkers + 1 : 1;
+	minItemsPerJob = MaxUXX(minItemsPerJob, 1);
+	uxx maxJobs = (numItems + minItemsPerJob - 1) / minItemsPerJob;
+	return MinUXX(numThreads * 4, maxJobs);
+}
@@ -0,0 +1,65 @@
+/*
+File:   app_jobs.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A small fixed pool of worker threads that run batches of jobs. A batch is one
+	** function called once per job index, workers (and the thread waiting on the batch)
+	** pull the next index from an atomic counter until every index has been claimed.
+	** Jobs must not allocate from shared arenas, they get their own scratch arenas and
+	** write their results into memory the caller set aside per job index.
+	** A nullptr JobSystem is valid everywhere and simply runs every job on the calling thread.
+*/
+
+#ifndef _APP_JOBS_H
+#define _APP_JOBS_H
+
+#if TARGET_IS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#define JOBS_MAX_WORKERS          15
+#define JOBS_MAX_ACTIVE_BATCHES   16
+#define JOBS_WORKER_SCRATCH_SIZE  Gigabytes(1) //virtual reservation per scratch arena
+
+#define JOB_FUNC_DEF(functionName) void functionName(void* userPntr, uxx jobIndex)
+typedef JOB_FUNC_DEF(JobFunc_f);
+
+typedef struct JobBatch JobBatch;
+struct JobBatch
+{
+	JobFunc_f* func;
+	void* userPntr;
+	i64 numJobs;
+	volatile i64 nextJobIndex; //claimed with an atomic add, runs past numJobs once everything is claimed
+	volatile i64 numJobsDone;
+	volatile i64 numWorkersInside; //workers that picked this batch and may still touch it
+	bool isQueued; //false when the batch ran inline because there were no workers (or no free slot)
+};
+
+typedef struct JobSystem JobSystem;
+struct JobSystem
+{
+	Arena* arena;
+	uxx numWorkers;
+	volatile bool isShuttingDown;
+	uxx numActiveBatches;
+	JobBatch* activeBatches[JOBS_MAX_ACTIVE_BATCHES];
+	
+	#if TARGET_IS_WINDOWS
+	HANDLE workerHandles[JOBS_MAX_WORKERS];
+	SRWLOCK lock;
+	CONDITION_VARIABLE wakeCondition;
+	#elif TARGET_IS_LINUX
+	pthread_t workerHandles[JOBS_MAX_WORKERS];
+	pthread_mutex_t lock;
+	pthread_cond_t wakeCondition;
+	#endif
+	
+	uxx numBatchesRun;
+	uxx numJobsRun;
+};
+
+#endif //  _APP_JOBS_H
@@ -0,0 +1,351 @@
+/*
+File:   app_json.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the JsonDocument parser and lookup functions (see app_json.h)
+*/
+
+//Every power of 10 up to 10^22 is exactly representable as a double
+static const r64 JsonPowersOf10[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// +--------------------------------------------------------------+
+// |                           Parsing                            |
+// +--------------------------------------------------------------+
+static inline void SkipJsonWhitespace(JsonParser* parser)
+{
+	while (parser->pntr < parser->end && (*parser->pntr == ' ' || *parser->pntr == '\t' || *parser->pntr == '\n' || *parser->pntr == '\r')) { parser->pntr++; }
+}
+
+static inline bool IsJsonDigit(char c) { return ((u8)(c - '0') < 10); }
+
+static inline bool ParseJsonLiteral(JsonParser* parser, const char* literal)
+{
+	uxx literalLength = MyStrLength64(literal);
+	if ((uxx)(parser->end - parser->pntr) < literalLength || MyMemCompare(parser->pntr, literal, literalLength) != 0) { return false; }
+	parser->pntr += literalLength;
+	return true;
+}
+
+static bool ParseJsonNumber(JsonParser* parser, r64* valueOut)
+{
+	const char* pntr = parser->pntr;
+	bool isNegative = false;
+	if (pntr < parser->end && *pntr == '-') { isNegative = true; pntr++; }
+	if (pntr >= parser->end || !IsJsonDigit(*pntr)) { return false; }
+	u64 mantissa = 0;
+	i32 exponent = 0;
+	for (; pntr < parser->end && IsJsonDigit(*pntr); pntr++)
+	{
+		if (mantissa < 1000000000000000000ULL) { mantissa = (mantissa * 10) + (u64)(*pntr - '0'); }
+		else { exponent++; }
+	}
+	if (pntr < parser->end && *pntr == '.')
+	{
+		pntr++;
+		if (pntr >= parser->end || !IsJsonDigit(*pntr)) { return false; }
+		for (; pntr < parser->end && IsJsonDigit(*pntr); pntr++)
+		{
+			if (mantissa < 1000000000000000000ULL) { mantissa = (mantissa * 10) + (u64)(*pntr - '0'); exponent--; }
+		}
+	}
+	if (pntr < parser->end && (*pntr == 'e' || *pntr == 'E'))
+	{
+		pntr++;
+		bool isExponentNegative = false;
+		if (pntr < parser->end && (*pntr == '-' || *pntr == '+')) { isExponentNegative = (*pntr == '-'); pntr++; }
+		if (pntr >= parser->end || !IsJsonDigit(*pntr)) { return false; }
+		i32 exponentValue = 0;
+		for (; pntr < parser->end && IsJsonDigit(*pntr); pntr++)
+		{
+			if (exponentValue < 10000) { exponentValue = (exponentValue * 10) + (*pntr - '0'); }
+		}
+		exponent += isExponentNegative ? -exponentValue : exponentValue;
+	}
+	r64 value = (r64)mantissa;
+	if (mantissa != 0)
+	{
+		for (; exponent > 22; exponent -= 22) { value *= JsonPowersOf10[22]; }
+		for (; exponent < -22; exponent += 22) { value /= JsonPowersOf10[22]; }
+		value = (exponent >= 0) ? (value * JsonPowersOf10[exponent]) : (value / JsonPowersOf10[-exponent]);
+	}
+	*valueOut = isNegative ? -value : value;
+	parser->pntr = pntr;
+	return true;
+}
+
+static inline i32 GetJsonHexDigitValue(char c)
+{
+	if (c >= '0' && c <= '9') { return c - '0'; }
+	if (c >= 'a' && c <= 'f') { return 10 + (c - 'a'); }
+	if (c >= 'A' && c <= 'F') { return 10 + (c - 'A'); }
+	return -1;
+}
+
+static bool ParseJsonHex4(const char* pntr, const char* end, u32* valueOut)
+{
+	if (end - pntr < 4) { return false; }
+	u32 value = 0;
+	for (uxx cIndex = 0; cIndex < 4; cIndex++)
+	{
+		i32 digit = GetJsonHexDigitValue(pntr[cIndex]);
+		if (digit < 0) { return false; }
+		value = (value << 4) | (u32)digit;
+	}
+	*valueOut = value;
+	return true;
+}
+
+static uxx EncodeJsonUtf8(u32 codepoint, char* bufferOut)
+{
+	if (codepoint < 0x80) { bufferOut[0] = (char)codepoint; return 1; }
+	if (codepoint < 0x800) { bufferOut[0] = (char)(0xC0 | (codepoint >> 6)); bufferOut[1] = (char)(0x80 | (codepoint & 0x3F)); return 2; }
+	if (codepoint < 0x10000)
+	{
+		bufferOut[0] = (char)(0xE0 | (codepoint >> 12));
+		bufferOut[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+		bufferOut[2] = (char)(0x80 | (codepoint & 0x3F));
+		return 3;
+	}
+	bufferOut[0] = (char)(0xF0 | (codepoint >> 18));
+	bufferOut[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+	bufferOut[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+	bufferOut[3] = (char)(0x80 | (codepoint & 0x3F));
+	return 4;
+}
+
+// Expects parser->pntr on the opening quote
+static bool ParseJsonString(JsonParser* parser, Str8* stringOut)
+{
+	parser->pntr++;
+	const char* stringStart = parser->pntr;
+	bool hasEscapes = false;
+	while (parser->pntr < parser->end && *parser->pntr != '"')
+	{
+		if (*parser->pntr == '\\') { hasEscapes = true; parser->pntr++; }
+		parser->pntr++;
+	}
+	if (parser->pntr >= parser->end) { return false; }
+	const char* stringEnd = parser->pntr;
+	parser->pntr++;
+	if (!hasEscapes) { *stringOut = NewStr8((uxx)(stringEnd - stringStart), (char*)stringStart); return true; }
+	
+	//Escapes only ever make the string shorter (\uXXXX is 6 bytes for at most 3 bytes of UTF-8, a surrogate pair is 12 for 4)
+	char* decoded = AllocArray(char, parser->document->arena, (uxx)(stringEnd - stringStart));
+	NotNull(decoded);
+	uxx decodedLength = 0;
+	for (const char* pntr = stringStart; pntr < stringEnd; pntr++)
+	{
+		if (*pntr != '\\') { decoded[decodedLength++] = *pntr; continue; }
+		pntr++;
+		switch (*pntr)
+		{
+			case '"':  decoded[decodedLength++] = '"';  break;
+			case '\\': decoded[decodedLength++] = '\\'; break;
+			case '/':  decoded[decodedLength++] = '/';  break;
+			case 'b':  decoded[decodedLength++] = '\b'; break;
+			case 'f':  decoded[decodedLength++] = '\f'; break;
+			case 'n':  decoded[decodedLength++] = '\n'; break;
+			case 'r':  decoded[decodedLength++] = '\r'; break;
+			case 't':  decoded[decodedLength++] = '\t'; break;
+			case 'u':
+			{
+				u32 codepoint = 0;
+				if (!ParseJsonHex4(pntr + 1, stringEnd, &codepoint)) { return false; }
+				pntr += 4;
+				u32 lowSurrogate = 0;
+				if (codepoint >= 0xD800 && codepoint <= 0xDBFF && stringEnd - pntr > 6 && pntr[1] == '\\' && pntr[2] == 'u' &&
+					ParseJsonHex4(pntr + 3, stringEnd, &lowSurrogate) && lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF)
+				{
+					codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+					pntr += 6;
+				}
+				decodedLength += EncodeJsonUtf8(codepoint, &decoded[decodedLength]);
+			} break;
+			default: return false;
+		}
+	}
+	*stringOut = NewStr8(decodedLength, decoded);
+	return true;
+}
+
+static u32 ParseJsonValue(JsonParser* parser, Str8 key);
+
+// Expects parser->pntr on the opening bracket/brace. The children are collected on the shared childStack while the
+// container is open and copied into their own array once it closes
+static bool ParseJsonContainer(JsonParser* parser, u32 valueIndex, bool isObject)
+{
+	char closeChar = isObject ? '}' : ']';
+	parser->pntr++;
+	uxx stackStart = parser->childStack.length;
+	SkipJsonWhitespace(parser);
+	if (parser->pntr < parser->end && *parser->pntr == closeChar) { parser->pntr++; return true; }
+	while (true)
+	{
+		Str8 key = ZEROED;
+		if (isObject)
+		{
+			SkipJsonWhitespace(parser);
+			if (parser->pntr >= parser->end || *parser->pntr != '"' || !ParseJsonString(parser, &key)) { return false; }
+			SkipJsonWhitespace(parser);
+			if (parser->pntr >= parser->end || *parser->pntr != ':') { return false; }
+			parser->pntr++;
+		}
+		u32 childIndex = ParseJsonValue(parser, key);
+		if (childIndex == JSON_VALUE_NONE) { return false; }
+		*VarArrayAdd(u32, &parser->childStack) = childIndex;
+		SkipJsonWhitespace(parser);
+		if (parser->pntr >= parser->end) { return false; }
+		if (*parser->pntr == ',') { parser->pntr++; continue; }
+		if (*parser->pntr == closeChar) { parser->pntr++; break; }
+		return false;
+	}
+	uxx numChildren = parser->childStack.length - stackStart;
+	JsonValue* value = VarArrayGetHard(JsonValue, &parser->document->values, valueIndex);
+	value->numChildren = (u32)numChildren;
+	value->children = AllocArray(u32, parser->document->arena, numChildren);
+	NotNull(value->children);
+	MyMemCopy(value->children, VarArrayGetHard(u32, &parser->childStack, stackStart), sizeof(u32) * numChildren);
+	parser->childStack.length = stackStart;
+	return true;
+}
+
+// Returns the index of the new value or JSON_VALUE_NONE on a syntax error
+static u32 ParseJsonValue(JsonParser* parser, Str8 key)
+{
+	SkipJsonWhitespace(parser);
+	if (parser->pntr >= parser->end || parser->depth >= JSON_MAX_DEPTH) { return JSON_VALUE_NONE; }
+	u32 valueIndex = (u32)parser->document->values.length;
+	JsonValue* newValue = VarArrayAdd(JsonValue, &parser->document->values);
+	NotNull(newValue);
+	ClearPointer(newValue);
+	newValue->key = key;
+	bool success = false;
+	char firstChar = *parser->pntr;
+	if (firstChar == '{' || firstChar == '[')
+	{
+		newValue->type = (firstChar == '{') ? JsonType_Object : JsonType_Array;
+		parser->depth++;
+		success = ParseJsonContainer(parser, valueIndex, (firstChar == '{'));
+		parser->depth--;
+	}
+	else if (firstChar == '"')
+	{
+		Str8 string = ZEROED;
+		success = ParseJsonString(parser, &string);
+		newValue->type = JsonType_String;
+		newValue->string = string;
+	}
+	else if (firstChar == 't' || firstChar == 'f')
+	{
+		newValue->type = JsonType_Bool;
+		newValue->boolValue = (firstChar == 't');
+		success = ParseJsonLiteral(parser, newValue->boolValue ? "true" : "false");
+	}
+	else if (firstChar == 'n') { newValue->type = JsonType_Null; success = ParseJsonLiteral(parser, "null"); }
+	else
+	{
+		r64 number = 0.0;
+		success = ParseJsonNumber(parser, &number);
+		newValue->type = JsonType_Number;
+		newValue->number = number;
+	}
+	//newValue may have moved while the children were being added
+	return success ? valueIndex : JSON_VALUE_NONE;
+}
+
+void FreeJsonDocument(JsonDocument* document)
+{
+	NotNull(document);
+	if (document->arena != nullptr) { FreeVarArray(&document->values); }
+	ClearPointer(document);
+}
+
+// Meant for a scratch arena: the children arrays and decoded strings aren't freed individually by FreeJsonDocument
+bool TryParseJson(Arena* arena, Str8 text, JsonDocument* documentOut)
+{
+	NotNull(arena);
+	NotNull(documentOut);
+	ClearPointer(documentOut);
+	documentOut->arena = arena;
+	InitVarArrayWithInitial(JsonValue, &documentOut->values, arena, (text.length / 16) + 16);
+	JsonParser parser = ZEROED;
+	parser.document = documentOut;
+	parser.start = text.chars;
+	parser.pntr = text.chars;
+	parser.end = text.chars + text.length;
+	InitVarArrayWithInitial(u32, &parser.childStack, arena, 256);
+	u32 rootIndex = ParseJsonValue(&parser, NewStr8(0, nullptr));
+	SkipJsonWhitespace(&parser);
+	//The GLB spec pads the JSON chunk with spaces but some exporters pad with zeros
+	while (parser.pntr < parser.end && *parser.pntr == '\0') { parser.pntr++; }
+	bool result = (rootIndex == 0 && parser.pntr == parser.end);
+	if (!result) { documentOut->errorOffset = (uxx)(parser.pntr - parser.start); }
+	FreeVarArray(&parser.childStack);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                           Lookups                            |
+// +--------------------------------------------------------------+
+const JsonValue* GetJsonRoot(const JsonDocument* document)
+{
+	return (document->values.length > 0) ? VarArrayGetHard(JsonValue, &document->values, 0) : nullptr;
+}
+
+// nullptr when object isn't an object or doesn't have the member
+const JsonValue* GetJsonMember(const JsonDocument* document, const JsonValue* object, const char* key)
+{
+	if (object == nullptr || object->type != JsonType_Object) { return nullptr; }
+	uxx keyLength = MyStrLength64(key);
+	for (u32 cIndex = 0; cIndex < object->numChildren; cIndex++)
+	{
+		const JsonValue* child = VarArrayGetHard(JsonValue, &document->values, object->children[cIndex]);
+		if (child->key.length == keyLength && MyMemCompare(child->key.chars, key, keyLength) == 0) { return child; }
+	}
+	return nullptr;
+}
+
+// nullptr when array isn't an array (or object) or the index is past the end
+const JsonValue* GetJsonElement(const JsonDocument* document, const JsonValue* array, uxx index)
+{
+	if (array == nullptr || (array->type != JsonType_Array && array->type != JsonType_Object) || index >= array->numChildren) { return nullptr; }
+	return VarArrayGetHard(JsonValue, &document->values, array->children[index]);
+}
+
+uxx GetJsonLength(const JsonValue* array)
+{
+	if (array == nullptr || (array->type != JsonType_Array && array->type != JsonType_Object)) { return 0; }
+	return (uxx)array->numChildren;
+}
+
+r64 GetJsonNumber(const JsonValue* value, r64 defaultValue)
+{
+	return (value != nullptr && value->type == JsonType_Number) ? value->number : defaultValue;
+}
+
+bool GetJsonBool(const JsonValue* value, bool defaultValue)
+{
+	return (value != nullptr && value->type == JsonType_Bool) ? value->boolValue : defaultValue;
+}
+
+Str8 GetJsonString(const JsonValue* value)
+{
+	return (value != nullptr && value->type == JsonType_String) ? value->string : NewStr8(0, nullptr);
+}
+
+r64 GetJsonMemberNumber(const JsonDocument* document, const JsonValue* object, const char* key, r64 defaultValue)
+{
+	return GetJsonNumber(GetJsonMember(document, object, key), defaultValue);
+}
+
+// For members that index into another array, UINTXX_MAX when missing or not a valid index
+uxx GetJsonMemberIndex(const JsonDocument* document, const JsonValue* object, const char* key)
+{
+	r64 number = GetJsonMemberNumber(document, object, key, -1.0);
+	if (number < 0.0 || number != (r64)(u64)number) { return UINTXX_MAX; }
+	return (uxx)number;
+}
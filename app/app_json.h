@@ -0,0 +1,61 @@
+/*
+File:   app_json.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A small JSON reader, just enough for the glTF header inside a .glb file. The whole document is
+	** parsed up front into a flat array of JsonValues and every array/object keeps the indices of its
+	** children, so looking up the 5000th accessor doesn't have to walk a list. Strings point into the
+	** source text (which has to outlive the document) unless they had escapes, those get decoded into the arena.
+*/
+
+#ifndef _APP_JSON_H
+#define _APP_JSON_H
+
+#define JSON_MAX_DEPTH   128
+#define JSON_VALUE_NONE  UINT32_MAX
+
+typedef enum JsonType JsonType;
+enum JsonType
+{
+	JsonType_Null = 0,
+	JsonType_Bool,
+	JsonType_Number,
+	JsonType_String,
+	JsonType_Array,
+	JsonType_Object,
+	JsonType_Count,
+};
+
+typedef struct JsonValue JsonValue;
+struct JsonValue
+{
+	JsonType type;
+	bool boolValue;
+	r64 number;
+	Str8 string;
+	Str8 key; //set when the value is a member of an object
+	u32 numChildren;
+	u32* children; //indices into JsonDocument->values, in the order they appear in the text
+};
+
+typedef struct JsonDocument JsonDocument;
+struct JsonDocument
+{
+	Arena* arena;
+	VarArray values; //JsonValue, [0] is the root
+	uxx errorOffset; //byte offset into the text where parsing failed
+};
+
+typedef struct JsonParser JsonParser;
+struct JsonParser
+{
+	JsonDocument* document;
+	const char* start;
+	const char* pntr;
+	const char* end;
+	VarArray childStack; //u32, children of every container that is still open
+	uxx depth;
+};
+
+#endif //  _APP_JSON_H
@@ -0,0 +1,463 @@
+/*
+File:   app_lod.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the quadric error metric simplifier (Garland & Heckbert) that builds the LOD chains
+	** in app_lod.h as well as the per-instance screen-size LOD selection.
+	** NOTE: Vertices that share a position are welded for the purposes of simplification so UV
+	** and normal seams collapse together. When a position collapses onto another, each of its
+	** vertices is remapped to whichever vertex at the target position has the closest normal/UV.
+	** Positions on an open border are never moved so the silhouette of open meshes is kept.
+*/
+
+// +--------------------------------------------------------------+
+// |                           Quadrics                           |
+// +--------------------------------------------------------------+
+// Symmetric 4x4 matrix for the plane (a, b, c, d), only the upper triangle is stored
+typedef struct Quadric Quadric;
+struct Quadric
+{
+	r32 a2, ab, ac, ad;
+	r32 b2, bc, bd;
+	r32 c2, cd;
+	r32 d2;
+};
+
+static inline v3 SimplifyCross(v3 left, v3 right)
+{
+	return NewV3(left.Y*right.Z - left.Z*right.Y, left.Z*right.X - left.X*right.Z, left.X*right.Y - left.Y*right.X);
+}
+static inline r32 SimplifyDot(v3 left, v3 right) { return left.X*right.X + left.Y*right.Y + left.Z*right.Z; }
+
+static void AddPlaneToQuadric(Quadric* quadric, v3 normal, r32 distance)
+{
+	quadric->a2 += normal.X*normal.X; quadric->ab += normal.X*normal.Y; quadric->ac += normal.X*normal.Z; quadric->ad += normal.X*distance;
+	quadric->b2 += normal.Y*normal.Y; quadric->bc += normal.Y*normal.Z; quadric->bd += normal.Y*distance;
+	quadric->c2 += normal.Z*normal.Z; quadric->cd += normal.Z*distance;
+	quadric->d2 += distance*distance;
+}
+
+static void AddQuadric(Quadric* quadric, const Quadric* other)
+{
+	quadric->a2 += other->a2; quadric->ab += other->ab; quadric->ac += other->ac; quadric->ad += other->ad;
+	quadric->b2 += other->b2; quadric->bc += other->bc; quadric->bd += other->bd;
+	quadric->c2 += other->c2; quadric->cd += other->cd;
+	quadric->d2 += other->d2;
+}
+
+// Sum of squared distances from point to every plane accumulated in the quadric
+static r32 EvaluateQuadric(const Quadric* quadric, v3 point)
+{
+	r32 x = point.X, y = point.Y, z = point.Z;
+	r32 result = quadric->a2*x*x + 2*quadric->ab*x*y + 2*quadric->ac*x*z + 2*quadric->ad*x
+		+ quadric->b2*y*y + 2*quadric->bc*y*z + 2*quadric->bd*y
+		+ quadric->c2*z*z + 2*quadric->cd*z
+		+ quadric->d2;
+	return MaxR32(result, 0.0f);
+}
+
+// +--------------------------------------------------------------+
+// |                          Simplifier                          |
+// +--------------------------------------------------------------+
+typedef struct SimplifyCollapse SimplifyCollapse;
+struct SimplifyCollapse
+{
+	u32 fromPos;
+	u32 toPos;
+	r32 cost;
+};
+
+static int CompareSimplifyCollapses(const void* left, const void* right)
+{
+	r32 leftCost = ((const SimplifyCollapse*)left)->cost;
+	r32 rightCost = ((const SimplifyCollapse*)right)->cost;
+	return (leftCost < rightCost) ? -1 : ((leftCost > rightCost) ? 1 : 0);
+}
+
+static int CompareSimplifyEdges(const void* left, const void* right)
+{
+	u64 leftEdge = *(const u64*)left;
+	u64 rightEdge = *(const u64*)right;
+	return (leftEdge < rightEdge) ? -1 : ((leftEdge > rightEdge) ? 1 : 0);
+}
+
+static inline u64 GetSimplifyEdgeKey(u32 pos0, u32 pos1)
+{
+	return (pos0 < pos1) ? (((u64)pos0 << 32) | pos1) : (((u64)pos1 << 32) | pos0);
+}
+
+static inline u32 HashSimplifyPosition(v3 position)
+{
+	u32 bits[3];
+	MyMemCopy(&bits[0], &position, sizeof(bits));
+	u32 hash = 2166136261u;
+	for (uxx bIndex = 0; bIndex < 3; bIndex++) { hash = (hash ^ bits[bIndex]) * 16777619u; }
+	return hash;
+}
+
+// Lets a chain of SimplifyMesh calls on the same vertices share their quadrics. The planes come from the
+// first call's triangles and every collapse adds into them, so the cost of a collapse in a later level is
+// still measured against the original surface rather than the already simplified level it started from
+typedef struct SimplifyQuadrics SimplifyQuadrics;
+struct SimplifyQuadrics
+{
+	bool isFilled;
+	Quadric* items; //numVertices long, indexed by welded position (which is the same on every call with the same vertices)
+};
+
+// Reduces the triangle list towards targetNumIndices by collapsing edges in passes (cheapest first, one
+// collapse per neighborhood per pass) until the target is hit, nothing else can collapse, or the next
+// collapse would cost more than maxError (a squared distance). Returns the new number of indices, which
+// are allocated from arena. errorOut receives the largest error that was accepted.
+// carriedQuadrics is optional, without it the error is relative to the triangles that were passed in
+uxx SimplifyMesh(Arena* arena, const Vertex3D* vertices, uxx numVertices, const u32* indices, uxx numIndices, uxx targetNumIndices, r32 maxError, SimplifyQuadrics* carriedQuadrics, u32** indicesOut, r32* errorOut)
+{
+	NotNull(arena);
+	NotNull(indicesOut);
+	Assert((numIndices % 3) == 0);
+	ScratchBegin1(scratch, arena);
+	r32 largestError = 0.0f;
+	
+	// Weld vertices that share a position
+	uxx hashTableSize = 64;
+	while (hashTableSize < numVertices*2) { hashTableSize *= 2; }
+	u32* hashTable = AllocArray(u32, scratch, hashTableSize);
+	u32* vertPosIds = AllocArray(u32, scratch, numVertices);
+	u32* posFirstVerts = AllocArray(u32, scratch, numVertices);
+	u32* nextVertsInPos = AllocArray(u32, scratch, numVertices);
+	v3* positions = AllocArray(v3, scratch, numVertices);
+	NotNull(hashTable);
+	NotNull(vertPosIds);
+	NotNull(posFirstVerts);
+	NotNull(nextVertsInPos);
+	NotNull(positions);
+	for (uxx hIndex = 0; hIndex < hashTableSize; hIndex++) { hashTable[hIndex] = UINT32_MAX; }
+	uxx numPositions = 0;
+	for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+	{
+		v3 position = vertices[vIndex].position;
+		uxx slot = HashSimplifyPosition(position) & (hashTableSize-1);
+		while (hashTable[slot] != UINT32_MAX && !AreEqual(positions[hashTable[slot]], position)) { slot = (slot + 1) & (hashTableSize-1); }
+		if (hashTable[slot] == UINT32_MAX)
+		{
+			hashTable[slot] = (u32)numPositions;
+			positions[numPositions] = position;
+			posFirstVerts[numPositions] = UINT32_MAX;
+			numPositions++;
+		}
+		u32 posId = hashTable[slot];
+		vertPosIds[vIndex] = posId;
+		nextVertsInPos[vIndex] = posFirstVerts[posId];
+		posFirstVerts[posId] = (u32)vIndex;
+	}
+	
+	u32* workIndices = AllocArray(u32, scratch, numIndices);
+	NotNull(workIndices);
+	MyMemCopy(workIndices, indices, sizeof(u32) * numIndices);
+	uxx numWorkIndices = numIndices;
+	
+	// Plane quadrics per position
+	Quadric* quadrics = (carriedQuadrics != nullptr) ? carriedQuadrics->items : AllocArray(Quadric, scratch, numPositions);
+	NotNull(quadrics);
+	bool fillQuadrics = (carriedQuadrics == nullptr || !carriedQuadrics->isFilled);
+	if (fillQuadrics) { MyMemSet(quadrics, 0x00, sizeof(Quadric) * numPositions); }
+	if (carriedQuadrics != nullptr) { carriedQuadrics->isFilled = true; }
+	for (uxx iIndex = 0; fillQuadrics && iIndex < numWorkIndices; iIndex += 3)
+	{
+		u32 posIds[3] = { vertPosIds[workIndices[iIndex+0]], vertPosIds[workIndices[iIndex+1]], vertPosIds[workIndices[iIndex+2]] };
+		v3 normal = SimplifyCross(Sub(positions[posIds[1]], positions[posIds[0]]), Sub(positions[posIds[2]], positions[posIds[0]]));
+		r32 normalLength = Length(normal);
+		if (normalLength <= 1e-12f) { continue; }
+		normal = Mul(normal, 1.0f / normalLength);
+		r32 distance = -SimplifyDot(normal, positions[posIds[0]]);
+		for (uxx cIndex = 0; cIndex < 3; cIndex++) { AddPlaneToQuadric(&quadrics[posIds[cIndex]], normal, distance); }
+	}
+	
+	// Lock positions on open borders (edges that only have one triangle)
+	bool* lockedPositions = AllocArray(bool, scratch, numPositions);
+	u64* edgeKeys = AllocArray(u64, scratch, numWorkIndices);
+	NotNull(lockedPositions);
+	NotNull(edgeKeys);
+	MyMemSet(lockedPositions, 0x00, sizeof(bool) * numPositions);
+	for (uxx iIndex = 0; iIndex < numWorkIndices; iIndex += 3)
+	{
+		for (uxx cIndex = 0; cIndex < 3; cIndex++)
+		{
+			edgeKeys[iIndex + cIndex] = GetSimplifyEdgeKey(vertPosIds[workIndices[iIndex + cIndex]], vertPosIds[workIndices[iIndex + (cIndex+1)%3]]);
+		}
+	}
+	qsort(edgeKeys, numWorkIndices, sizeof(u64), CompareSimplifyEdges);
+	for (uxx eIndex = 0; eIndex < numWorkIndices; )
+	{
+		uxx runLength = 1;
+		while (eIndex + runLength < numWorkIndices && edgeKeys[eIndex + runLength] == edgeKeys[eIndex]) { runLength++; }
+		if (runLength == 1)
+		{
+			lockedPositions[(u32)(edgeKeys[eIndex] >> 32)] = true;
+			lockedPositions[(u32)(edgeKeys[eIndex] & 0xFFFFFFFF)] = true;
+		}
+		eIndex += runLength;
+	}
+	
+	u32* posTriCounts = AllocArray(u32, scratch, numPositions + 1);
+	u32* posTriOffsets = AllocArray(u32, scratch, numPositions + 1);
+	u32* posTris = AllocArray(u32, scratch, numIndices);
+	u32* posRemaps = AllocArray(u32, scratch, numPositions);
+	bool* touchedPositions = AllocArray(bool, scratch, numPositions);
+	u32* vertRemaps = AllocArray(u32, scratch, numVertices);
+	SimplifyCollapse* collapses = AllocArray(SimplifyCollapse, scratch, numIndices);
+	NotNull(posTriCounts);
+	NotNull(posTriOffsets);
+	NotNull(posTris);
+	NotNull(posRemaps);
+	NotNull(touchedPositions);
+	NotNull(vertRemaps);
+	NotNull(collapses);
+	
+	while (numWorkIndices > targetNumIndices)
+	{
+		uxx numTris = numWorkIndices / 3;
+		
+		// Triangles around each position (CSR layout)
+		MyMemSet(posTriCounts, 0x00, sizeof(u32) * (numPositions + 1));
+		for (uxx iIndex = 0; iIndex < numWorkIndices; iIndex++) { posTriCounts[vertPosIds[workIndices[iIndex]]]++; }
+		u32 runningOffset = 0;
+		for (uxx pIndex = 0; pIndex < numPositions; pIndex++) { posTriOffsets[pIndex] = runningOffset; runningOffset += posTriCounts[pIndex]; posTriCounts[pIndex] = 0; }
+		for (uxx iIndex = 0; iIndex < numWorkIndices; iIndex++)
+		{
+			u32 posId = vertPosIds[workIndices[iIndex]];
+			posTris[posTriOffsets[posId] + posTriCounts[posId]++] = (u32)(iIndex / 3);
+		}
+		
+		// Every edge of every triangle is a candidate, collapsing in whichever direction is cheaper
+		uxx numCollapses = 0;
+		for (uxx iIndex = 0; iIndex < numWorkIndices; iIndex++)
+		{
+			u32 pos0 = vertPosIds[workIndices[iIndex]];
+			u32 pos1 = vertPosIds[workIndices[(iIndex - (iIndex%3)) + ((iIndex+1)%3)]];
+			if (pos0 > pos1) { continue; } //each edge shows up from both of its triangles, only keep one direction of it
+			if (pos0 == pos1 || (lockedPositions[pos0] && lockedPositions[pos1])) { continue; }
+			Quadric combined = quadrics[pos0];
+			AddQuadric(&combined, &quadrics[pos1]);
+			r32 cost01 = lockedPositions[pos0] ? HighestR32 : EvaluateQuadric(&combined, positions[pos1]);
+			r32 cost10 = lockedPositions[pos1] ? HighestR32 : EvaluateQuadric(&combined, positions[pos0]);
+			SimplifyCollapse* collapse = &collapses[numCollapses++];
+			collapse->fromPos = (cost01 <= cost10) ? pos0 : pos1;
+			collapse->toPos = (cost01 <= cost10) ? pos1 : pos0;
+			collapse->cost = MinR32(cost01, cost10);
+		}
+		if (numCollapses == 0) { break; }
+		qsort(collapses, numCollapses, sizeof(SimplifyCollapse), CompareSimplifyCollapses);
+		
+		for (uxx pIndex = 0; pIndex < numPositions; pIndex++) { posRemaps[pIndex] = (u32)pIndex; touchedPositions[pIndex] = false; }
+		uxx numApplied = 0;
+		for (uxx cIndex = 0; cIndex < numCollapses && numTris*3 > targetNumIndices; cIndex++)
+		{
+			const SimplifyCollapse* collapse = &collapses[cIndex];
+			if (collapse->cost > maxError) { break; }
+			if (touchedPositions[collapse->fromPos] || touchedPositions[collapse->toPos]) { continue; }
+			
+			// Reject collapses that would flip a surviving triangle
+			bool flips = false;
+			uxx numRemovedTris = 0;
+			for (u32 tIndex = posTriOffsets[collapse->fromPos]; tIndex < posTriOffsets[collapse->fromPos] + posTriCounts[collapse->fromPos]; tIndex++)
+			{
+				u32 triIndex = posTris[tIndex];
+				u32 triPosIds[3] = { vertPosIds[workIndices[triIndex*3+0]], vertPosIds[workIndices[triIndex*3+1]], vertPosIds[workIndices[triIndex*3+2]] };
+				if (triPosIds[0] == collapse->toPos || triPosIds[1] == collapse->toPos || triPosIds[2] == collapse->toPos) { numRemovedTris++; continue; }
+				v3 before[3], after[3];
+				for (uxx corner = 0; corner < 3; corner++)
+				{
+					before[corner] = positions[triPosIds[corner]];
+					after[corner] = (triPosIds[corner] == collapse->fromPos) ? positions[collapse->toPos] : before[corner];
+				}
+				v3 normalBefore = SimplifyCross(Sub(before[1], before[0]), Sub(before[2], before[0]));
+				v3 normalAfter = SimplifyCross(Sub(after[1], after[0]), Sub(after[2], after[0]));
+				if (SimplifyDot(normalBefore, normalAfter) <= 0.0f) { flips = true; break; }
+			}
+			if (flips) { continue; }
+			
+			posRemaps[collapse->fromPos] = collapse->toPos;
+			AddQuadric(&quadrics[collapse->toPos], &quadrics[collapse->fromPos]);
+			touchedPositions[collapse->toPos] = true;
+			for (u32 tIndex = posTriOffsets[collapse->fromPos]; tIndex < posTriOffsets[collapse->fromPos] + posTriCounts[collapse->fromPos]; tIndex++)
+			{
+				u32 triIndex = posTris[tIndex];
+				for (uxx corner = 0; corner < 3; corner++) { touchedPositions[vertPosIds[workIndices[triIndex*3 + corner]]] = true; }
+			}
+			largestError = MaxR32(largestError, collapse->cost);
+			numTris -= numRemovedTris;
+			numApplied++;
+		}
+		if (numApplied == 0) { break; }
+		
+		// Move each vertex of a collapsed position to the best matching vertex at the target position
+		for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+		{
+			vertRemaps[vIndex] = (u32)vIndex;
+			u32 targetPos = posRemaps[vertPosIds[vIndex]];
+			if (targetPos == vertPosIds[vIndex]) { continue; }
+			r32 bestScore = HighestR32;
+			for (u32 candidate = posFirstVerts[targetPos]; candidate != UINT32_MAX; candidate = nextVertsInPos[candidate])
+			{
+				v2 uvDelta = Sub(vertices[candidate].texCoord, vertices[vIndex].texCoord);
+				r32 score = (1.0f - SimplifyDot(vertices[candidate].normal, vertices[vIndex].normal)) + (uvDelta.X*uvDelta.X + uvDelta.Y*uvDelta.Y);
+				if (score < bestScore) { bestScore = score; vertRemaps[vIndex] = candidate; }
+			}
+		}
+		
+		uxx numKeptIndices = 0;
+		for (uxx iIndex = 0; iIndex < numWorkIndices; iIndex += 3)
+		{
+			u32 triVerts[3] = { vertRemaps[workIndices[iIndex+0]], vertRemaps[workIndices[iIndex+1]], vertRemaps[workIndices[iIndex+2]] };
+			u32 triPosIds[3] = { vertPosIds[triVerts[0]], vertPosIds[triVerts[1]], vertPosIds[triVerts[2]] };
+			if (triPosIds[0] == triPosIds[1] || triPosIds[1] == triPosIds[2] || triPosIds[2] == triPosIds[0]) { continue; }
+			workIndices[numKeptIndices++] = triVerts[0];
+			workIndices[numKeptIndices++] = triVerts[1];
+			workIndices[numKeptIndices++] = triVerts[2];
+		}
+		numWorkIndices = numKeptIndices;
+	}
+	
+	u32* result = nullptr;
+	if (numWorkIndices > 0)
+	{
+		result = AllocArray(u32, arena, numWorkIndices);
+		NotNull(result);
+		MyMemCopy(result, workIndices, sizeof(u32) * numWorkIndices);
+	}
+	ScratchEnd(scratch);
+	*indicesOut = result;
+	if (errorOut != nullptr) { *errorOut = largestError; }
+	return numWorkIndices;
+}
+
+// +--------------------------------------------------------------+
+// |                       Model LOD Chains                       |
+// +--------------------------------------------------------------+
+// Builds the LOD chain of every part. Each level is simplified from the previous one (carrying the quadrics
+// along so errors stay relative to LOD 0) and gets its own VertBuffer that only contains the vertices the
+// simplified index buffer still uses
+void GenerateModelLods(Arena* arena, Model3D* model)
+{
+	NotNull(arena);
+	NotNull(model);
+	ScratchBegin1(scratch, arena);
+	r32 modelDiagonal = Length(model->localBounds.Size);
+	InitVarArrayWithInitial(ModelPartLods, &model->partLods, arena, model->data.parts.length);
+	model->numLods = 1;
+	for (uxx lIndex = 0; lIndex < MODEL_MAX_LODS; lIndex++) { model->lodTriangleCounts[lIndex] = 0; }
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+		ModelPartLods* partLods = VarArrayAdd(ModelPartLods, &model->partLods);
+		NotNull(partLods);
+		ClearPointer(partLods);
+		const Vertex3D* vertices = (const Vertex3D*)part->vertices.items;
+		const v4* tangents = GetModelPartTangents(model, pIndex);
+		uxx numIndices = (part->indices.length > 0) ? part->indices.length : part->vertices.length;
+		u32* indices = AllocArray(u32, scratch, numIndices);
+		NotNull(indices);
+		for (uxx iIndex = 0; iIndex < numIndices; iIndex++) { indices[iIndex] = (part->indices.length > 0) ? (u32)((const i32*)part->indices.items)[iIndex] : (u32)iIndex; }
+		numIndices -= (numIndices % 3);
+		partLods->numLods = 1;
+		partLods->numTriangles[0] = numIndices / 3;
+		SimplifyQuadrics carriedQuadrics = ZEROED;
+		carriedQuadrics.items = AllocArray(Quadric, scratch, part->vertices.length);
+		NotNull(carriedQuadrics.items);
+		
+		for (uxx lIndex = 1; lIndex < MODEL_MAX_LODS; lIndex++)
+		{
+			uxx targetNumIndices = (uxx)((r32)numIndices * LOD_REDUCTION_RATIO);
+			targetNumIndices -= (targetNumIndices % 3);
+			r32 maxError = LOD_BASE_ERROR_FRACTION * (r32)(1 << (lIndex-1)) * modelDiagonal;
+			u32* lodIndices = nullptr;
+			r32 lodError = 0.0f;
+			uxx numLodIndices = SimplifyMesh(scratch, vertices, part->vertices.length, indices, numIndices, targetNumIndices, maxError*maxError, &carriedQuadrics, &lodIndices, &lodError);
+			if (numLodIndices == 0 || (r32)numLodIndices > (r32)numIndices * LOD_MIN_REDUCTION) { break; }
+			
+			// Compact the vertices so the LOD buffer only holds the ones that are still referenced
+			u32* vertRemaps = AllocArray(u32, scratch, part->vertices.length);
+			Vertex3D* lodVertices = AllocArray(Vertex3D, scratch, part->vertices.length);
+			v4* lodTangents = (tangents != nullptr) ? AllocArray(v4, scratch, part->vertices.length) : nullptr;
+			i32* lodBufferIndices = AllocArray(i32, scratch, numLodIndices);
+			NotNull(vertRemaps);
+			NotNull(lodVertices);
+			if (tangents != nullptr) { NotNull(lodTangents); }
+			NotNull(lodBufferIndices);
+			for (uxx vIndex = 0; vIndex < part->vertices.length; vIndex++) { vertRemaps[vIndex] = UINT32_MAX; }
+			uxx numLodVertices = 0;
+			for (uxx iIndex = 0; iIndex < numLodIndices; iIndex++)
+			{
+				u32 vIndex = lodIndices[iIndex];
+				if (vertRemaps[vIndex] == UINT32_MAX)
+				{
+					vertRemaps[vIndex] = (u32)numLodVertices;
+					if (lodTangents != nullptr) { lodTangents[numLodVertices] = tangents[vIndex]; }
+					lodVertices[numLodVertices++] = vertices[vIndex];
+				}
+				lodBufferIndices[iIndex] = (i32)vertRemaps[vIndex];
+			}
+			VertBuffer* lodBuffer = &partLods->vertBuffers[lIndex];
+			*lodBuffer = InitPbrVertBuffer(arena, part->name, VertBufferUsage_Static, numLodVertices, lodVertices, lodTangents);
+			AddIndicesToVertBufferEx(lodBuffer, sizeof(i32), numLodIndices, lodBufferIndices, false);
+			Assert(lodBuffer->error == Result_Success);
+			partLods->numTriangles[lIndex] = numLodIndices / 3;
+			//Positions this level didn't touch keep the error they got in earlier levels
+			partLods->errors[lIndex] = MaxR32(partLods->errors[lIndex-1], SqrtR32(lodError));
+			partLods->numLods++;
+			indices = lodIndices;
+			numIndices = numLodIndices;
+		}
+		if (partLods->numLods > model->numLods) { model->numLods = partLods->numLods; }
+	}
+	//Parts that ran out of levels keep drawing their last one
+	VarArrayLoop(&model->partLods, pIndex)
+	{
+		VarArrayLoopGet(ModelPartLods, partLods, &model->partLods, pIndex);
+		for (uxx lIndex = 0; lIndex < model->numLods; lIndex++)
+		{
+			model->lodTriangleCounts[lIndex] += partLods->numTriangles[(lIndex < partLods->numLods) ? lIndex : partLods->numLods-1];
+		}
+	}
+	ScratchEnd(scratch);
+}
+
+VertBuffer* GetModelPartLodBuffer(Model3D* model, uxx partIndex, uxx lodIndex)
+{
+	if (lodIndex > 0 && partIndex < model->partLods.length)
+	{
+		ModelPartLods* partLods = VarArrayGetHard(ModelPartLods, &model->partLods, partIndex);
+		if (lodIndex >= partLods->numLods) { lodIndex = partLods->numLods-1; }
+		if (lodIndex > 0) { return &partLods->vertBuffers[lodIndex]; }
+	}
+	return VarArrayGetHard(VertBuffer, &model->vertBuffers, partIndex);
+}
+
+// +--------------------------------------------------------------+
+// |                        LOD Selection                         |
+// +--------------------------------------------------------------+
+// Projected bounding sphere diameter (as a fraction of screen height) below which LOD i+1 is used instead of LOD i
+static const r32 LodScreenSizeThresholds[MODEL_MAX_LODS-1] = { 0.30f, 0.15f, 0.07f };
+
+// Picks the LOD for one instance from the projected size of its world bounds. A level only changes once
+// the size is LOD_HYSTERESIS past the threshold so instances sitting right on one don't flicker between levels
+u8 SelectInstanceLod(InstanceStore* store, uxx instanceIndex, v3 cameraPos, r32 fieldOfViewY)
+{
+	NotNull(store);
+	Assert(instanceIndex < store->count);
+	Model3D* model = GetInstanceModel(store, store->modelIds[instanceIndex]);
+	if (model == nullptr || model->numLods <= 1) { store->lodLevels[instanceIndex] = 0; return 0; }
+	box bounds = store->bounds[instanceIndex];
+	r32 radius = Length(bounds.Size) / 2.0f;
+	r32 distance = Length(Sub(Add(bounds.BottomLeftBack, Mul(bounds.Size, 0.5f)), cameraPos));
+	r32 screenSize = (distance > radius) ? (radius / (distance * TanR32(fieldOfViewY / 2.0f))) : HighestR32;
+	
+	uxx lodIndex = store->lodLevels[instanceIndex];
+	if (lodIndex >= model->numLods) { lodIndex = model->numLods-1; }
+	while (lodIndex+1 < model->numLods && screenSize < LodScreenSizeThresholds[lodIndex] * (1.0f - LOD_HYSTERESIS)) { lodIndex++; }
+	while (lodIndex > 0 && screenSize > LodScreenSizeThresholds[lodIndex-1] * (1.0f + LOD_HYSTERESIS)) { lodIndex--; }
+	store->lodLevels[instanceIndex] = (u8)lodIndex;
+	return (u8)lodIndex;
+}
@@ -0,0 +1,29 @@
+/*
+File:   app_lod.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Discrete levels of detail for Model3D. Every part gets a chain of progressively simpler
+	** index buffers at load time from a quadric error metric edge-collapse simplifier and each
+	** instance picks a level every frame from the projected size of its bounding sphere.
+*/
+
+#ifndef _APP_LOD_H
+#define _APP_LOD_H
+
+#define MODEL_MAX_LODS            4 //including LOD 0 (the original mesh)
+#define LOD_REDUCTION_RATIO       0.5f //each level targets this fraction of the previous level's triangles
+#define LOD_MIN_REDUCTION         0.9f //a level that can't get below this fraction of the previous one ends the chain
+#define LOD_BASE_ERROR_FRACTION   0.01f //max simplification error for LOD 1 as a fraction of the model's diagonal, doubles every level
+#define LOD_HYSTERESIS            0.1f //screen size has to move this fraction past a threshold before the level changes back
+
+typedef struct ModelPartLods ModelPartLods;
+struct ModelPartLods
+{
+	uxx numLods; //including LOD 0, which is the part's regular VertBuffer in Model3D->vertBuffers
+	uxx numTriangles[MODEL_MAX_LODS];
+	r32 errors[MODEL_MAX_LODS]; //largest distance from the original surface (LOD 0's planes) the simplifier accepted, in model units
+	VertBuffer vertBuffers[MODEL_MAX_LODS]; //[0] is unused
+};
+
+#endif //  _APP_LOD_H
@@ -37,6 +37,34 @@ Description:
 // |                         Header Files                         |
 // +--------------------------------------------------------------+
 #include "platform_interface.h"
+#include "app_jobs.h"
+#include "app_trs_kernels.h"
+#include "app_scene_graph.h"
+#include "app_instances.h"
+#include "app_bvh.h"
+#include "app_occlusion.h"
+#include "app_lod.h"
+#include "app_meshlets.h"
+#include "app_render_queue.h"
+#include "app_brdf.h"
+#include "app_tonemap.h"
+#include "app_texture_streaming.h"
+#include "app_texture_cache.h"
+#include "app_texture_atlas.h"
+#include "app_staged_draws.h"
+#include "app_cooked_asset.h"
+#include "app_tangents.h"
+#include "app_font_cache.h"
+#include "app_sdf_font.h"
+#include "app_glyph_cache.h"
+#include "app_text_layout_cache.h"
+#include "app_png_decode.h"
+#include "app_obj_loader.h"
+#include "app_json.h"
+#include "app_glb.h"
+#include "app_image_export.h"
+#include "app_path_tracer.h"
+#include "app_tests.h"
 #include "app_main.h"
 #include "app_shaders.h"
 
@@ -55,6 +83,34 @@ static Arena* stdHeap = nullptr;
 // +--------------------------------------------------------------+
 // |                         Source Files                         |
 // +--------------------------------------------------------------+
+#include "app_jobs.c"
+#include "app_trs_kernels.c"
+#include "app_scene_graph.c"
+#include "app_instances.c"
+#include "app_bvh.c"
+#include "app_occlusion.c"
+#include "app_lod.c"
+#include "app_meshlets.c"
+#include "app_render_queue.c"
+#include "app_brdf.c"
+#include "app_tonemap.c"
+#include "app_texture_streaming.c"
+#include "app_texture_cache.c"
+#include "app_texture_atlas.c"
+#include "app_staged_draws.c"
+#include "app_cooked_asset.c"
+#include "app_tangents.c"
+#include "app_font_cache.c"
+#include "app_sdf_font.c"
+#include "app_glyph_cache.c"
+#include "app_text_layout_cache.c"
+#include "app_png_decode.c"
+#include "app_obj_loader.c"
+#include "app_json.c"
+#include "app_glb.c"
+#include "app_image_export.c"
+#include "app_path_tracer.c"
+#include "app_tests.c"
 #include "app_helpers.c"
 #include "app_clay_helpers.c"
 
@@ -103,16 +159,16 @@ ImageData LoadImageData(Arena* arena, const char* path)
 	bool readFileResult = OsReadFile(FilePathLit(path), scratch, false, &fileContents);
 	Assert(readFileResult);
 	ImageData imageData = ZEROED;
-	Result parseResult = TryParseImageFile(fileContents, arena, &imageData);
+	Result parseResult = TryDecodePngImage(fileContents, arena, &imageData);
 	Assert(parseResult == Result_Success);
 	ScratchEnd(scratch);
 	return imageData;
 }
-Texture LoadTexture(Arena* arena, const char* path)
+TextureHandle LoadTexture(Arena* arena, const char* path)
 {
 	ScratchBegin1(scratch, arena);
 	ImageData imageData = LoadImageData(scratch, path);
-	Texture result = InitTexture(arena, GetFileNamePart(FilePathLit(path), true), imageData.size, imageData.pixels, TextureFlag_IsRepeating);
+	TextureHandle result = AcquireCachedTexture(&app->textureCache, GetFileNamePart(FilePathLit(path), true), imageData.size, imageData.pixels, TextureFlag_IsRepeating, false, false);
 	ScratchEnd(scratch);
 	return result;
 }
@@ -146,6 +202,7 @@ void RasterizeFontAtSizes(Font* font, Str8 fontName, uxx numSizes, r32* fontSize
 {
 	NotNull(fontSizes);
 	Assert(numSizes > 0);
+	if (app->textLayoutCache.arena != nullptr) { ForgetCachedFontTextLayouts(&app->textLayoutCache, font); }
 	ClearFontAtlases(font);
 	
 	// UNUSED(fontName);
@@ -154,25 +211,11 @@ void RasterizeFontAtSizes(Font* font, Str8 fontName, uxx numSizes, r32* fontSize
 	Assert(attachResult == Result_Success);
 	// OsWriteBinFile(FilePathLit("Default.ttf"), font->ttfFile);
 	
-	for (uxx bIndex = 0; bIndex < numSizes; bIndex++)
-	{
-		FontCharRange charRanges[] = {
-			FontCharRange_ASCII,
-			FontCharRange_LatinExt,
-		};
-		Result bakeResult = BakeFontAtlas(font, fontSizes[bIndex], fontStyleFlags, NewV2i(256, 256), ArrayCount(charRanges), &charRanges[0]);
-		if (bakeResult == Result_NotEnoughSpace)
-		{
-			bakeResult = BakeFontAtlas(font, fontSizes[bIndex], fontStyleFlags, NewV2i(512, 512), ArrayCount(charRanges), &charRanges[0]);
-			if (bakeResult == Result_NotEnoughSpace)
-			{
-				bakeResult = BakeFontAtlas(font, fontSizes[bIndex], fontStyleFlags, NewV2i(1024, 1024), ArrayCount(charRanges), &charRanges[0]);
-			}
-		}
-		Assert(bakeResult == Result_Success);
-	}
-	
-	FillFontKerningTable(font);
+	FontCharRange charRanges[] = {
+		FontCharRange_ASCII,
+		FontCharRange_LatinExt,
+	};
+	BakeFontAtlasesCached(font, fontName, numSizes, fontSizes, fontStyleFlags, ArrayCount(charRanges), &charRanges[0], nullptr);
 	#if 0
 	PrintLine_D("Kerning table has %llu entries", (u64)font->kerningTable.numEntries);
 	for (uxx eIndex = 0; eIndex < font->kerningTable.numEntries; eIndex++)
@@ -220,34 +263,169 @@ void RasterizeFontAtSize(Font* font, Str8 fontName, r32 fontSize, u8 fontStyleFl
 Model3D LoadModel(FilePath filePath)
 {
 	Model3D result = ZEROED;
-	Result loadResult = TryLoadGltfFile(filePath, stdHeap, &result.data);
+	Result loadResult = Result_None;
+	if (IsObjFilePath(filePath)) { loadResult = TryLoadObjFile(&app->jobs, filePath, stdHeap, &result.data); }
+	else if (IsGlbFilePath(filePath)) { loadResult = TryLoadGlbFile(&app->jobs, filePath, stdHeap, &result.data); }
+	else { loadResult = TryLoadGltfFile(filePath, stdHeap, &result.data); }
 	if (loadResult != Result_Success)
 	{
-		PrintLine_E("Failed to load/parse gltf file at \"%.*s\": %s", StrPrint(filePath), GetResultStr(loadResult));
+		PrintLine_E("Failed to load/parse model file at \"%.*s\": %s", StrPrint(filePath), GetResultStr(loadResult));
 		return result;
 	}
-	InitVarArrayWithInitial(Texture, &result.textures, stdHeap, result.data.textures.length);
+	uxx numAlbedoTextures = 0;
+	result.averageAlbedoLuminance = 0.0f;
+	VarArrayLoop(&result.data.materials, mIndex)
+	{
+		VarArrayLoopGet(ModelDataMaterial, material, &result.data.materials, mIndex);
+		if (material->albedoTextureIndex >= result.data.textures.length) { continue; }
+		ModelDataTexture* albedoTexture = VarArrayGetHard(ModelDataTexture, &result.data.textures, material->albedoTextureIndex);
+		result.averageAlbedoLuminance += GetAverageImageLuminance(albedoTexture->imageData.size, albedoTexture->imageData.pixels);
+		numAlbedoTextures++;
+	}
+	result.averageAlbedoLuminance = (numAlbedoTextures > 0) ? (result.averageAlbedoLuminance / (r32)numAlbedoTextures) : 1.0f;
+	
+	InitVarArrayWithInitial(MaterialAtlasEntry, &result.materialAtlasEntries, stdHeap, result.data.materials.length);
+	ScratchBegin(textureScratch);
+	bool* textureNeedsStreaming = AllocArray(bool, textureScratch, result.data.textures.length + 1);
+	NotNull(textureNeedsStreaming);
+	MyMemSet(textureNeedsStreaming, 0x00, sizeof(bool) * (result.data.textures.length + 1));
+	//glTF says base color textures hold sRGB encoded color, every other map is linear data (the OBJ loader follows the same rule)
+	bool* textureIsSrgb = AllocArray(bool, textureScratch, result.data.textures.length + 1);
+	NotNull(textureIsSrgb);
+	MyMemSet(textureIsSrgb, 0x00, sizeof(bool) * (result.data.textures.length + 1));
+	VarArrayLoop(&result.data.materials, mIndex)
+	{
+		VarArrayLoopGet(ModelDataMaterial, material, &result.data.materials, mIndex);
+		if (material->albedoTextureIndex < result.data.textures.length) { textureIsSrgb[material->albedoTextureIndex] = true; }
+		MaterialAtlasEntry* newEntry = VarArrayAdd(MaterialAtlasEntry, &result.materialAtlasEntries);
+		NotNull(newEntry);
+		*newEntry = AddMaterialToTextureAtlas(&app->textureAtlas, &result.data, mIndex);
+		if (newEntry->pageIndex != TEXTURE_ATLAS_PAGE_NONE) { continue; }
+		uxx textureIndices[] = { material->albedoTextureIndex, material->normalTextureIndex, material->metallicRoughnessTextureIndex, material->ambientOcclusionTextureIndex };
+		for (uxx tIndex = 0; tIndex < ArrayCount(textureIndices); tIndex++)
+		{
+			if (textureIndices[tIndex] < result.data.textures.length) { textureNeedsStreaming[textureIndices[tIndex]] = true; }
+		}
+	}
+	FlushTextureAtlas(&app->textureAtlas);
+	InitVarArrayWithInitial(TextureHandle, &result.textureHandles, stdHeap, result.data.textures.length);
+	InitVarArrayWithInitial(u32, &result.textureIds, stdHeap, result.data.textures.length);
 	VarArrayLoop(&result.data.textures, tIndex)
 	{
 		VarArrayLoopGet(ModelDataTexture, texture, &result.data.textures, tIndex);
-		Texture* newTexture = VarArrayAdd(Texture, &result.textures);
-		NotNull(newTexture);
-		*newTexture = InitTexture(stdHeap, texture->name, texture->imageData.size, texture->imageData.pixels, TextureFlag_IsRepeating);
-		Assert(newTexture->error == Result_Success);
+		TextureHandle* newHandle = VarArrayAdd(TextureHandle, &result.textureHandles);
+		NotNull(newHandle);
+		ClearPointer(newHandle);
+		u32* newTextureId = VarArrayAdd(u32, &result.textureIds);
+		NotNull(newTextureId);
+		*newTextureId = TEXTURE_STREAM_ID_INVALID;
+		if (!textureNeedsStreaming[tIndex]) { continue; } //already copied into an atlas page
+		//Another model (or another slot of this one) with the same pixels shares the StreamedTexture instead of uploading its own
+		*newHandle = AcquireCachedTexture(&app->textureCache, texture->name, texture->imageData.size, texture->imageData.pixels, TextureFlag_IsRepeating, textureIsSrgb[tIndex], true);
+		*newTextureId = GetCachedTextureStreamId(&app->textureCache, *newHandle);
 	}
+	ScratchEnd(textureScratch);
+	GenerateModelTangents(&app->jobs, stdHeap, &result, filePath); //before meshlets since splitting vertices changes the indices
+	BuildModelMeshlets(stdHeap, &result);
 	InitVarArrayWithInitial(VertBuffer, &result.vertBuffers, stdHeap, result.data.parts.length);
 	VarArrayLoop(&result.data.parts, pIndex)
 	{
 		VarArrayLoopGet(ModelDataPart, part, &result.data.parts, pIndex);
+		ModelPartMeshlets* partMeshlets = VarArrayGetHard(ModelPartMeshlets, &result.partMeshlets, pIndex);
 		VertBuffer* newVertBuffer = VarArrayAdd(VertBuffer, &result.vertBuffers);
 		NotNull(newVertBuffer);
-		*newVertBuffer = InitVertBuffer3D(stdHeap, part->name, VertBufferUsage_Static, part->vertices.length, (Vertex3D*)part->vertices.items, false);
-		if (part->indices.length > 0) { AddIndicesToVertBufferEx(newVertBuffer, sizeof(i32), part->indices.length, (i32*)part->indices.items, false); }
+		*newVertBuffer = InitPbrVertBuffer(stdHeap, part->name, VertBufferUsage_Static, part->vertices.length, (const Vertex3D*)part->vertices.items, GetModelPartTangents(&result, pIndex));
+		if (partMeshlets->numMeshlets > 0)
+		{
+			//Uploaded in meshlet order so CullModelMeshlets can hand out ranges of this buffer
+			ScratchBegin(scratch);
+			i32* meshletIndices = GetMeshletOrderedIndices(scratch, partMeshlets);
+			AddIndicesToVertBufferEx(newVertBuffer, sizeof(i32), partMeshlets->numIndices, meshletIndices, false);
+			ScratchEnd(scratch);
+		}
+		else if (part->indices.length > 0) { AddIndicesToVertBufferEx(newVertBuffer, sizeof(i32), part->indices.length, (i32*)part->indices.items, false); }
 		Assert(newVertBuffer->error == Result_Success);
 	}
+	InitVarArrayWithInitial(mat4, &result.partLocalMats, stdHeap, result.data.parts.length);
+	bool foundBounds = false;
+	VarArrayLoop(&result.data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &result.data.parts, pIndex);
+		mat4* partLocalMat = VarArrayAdd(mat4, &result.partLocalMats);
+		NotNull(partLocalMat);
+		*partLocalMat = ComposeTrsMat4(part->transform.position, part->transform.rotation, part->transform.scale, TrsOrder_RotateThenScale); //TODO: Order of rotation and scaling??
+		
+		v3 partMin = FillV3(HighestR32);
+		v3 partMax = FillV3(LowestR32);
+		const Vertex3D* vertices = (const Vertex3D*)part->vertices.items;
+		for (uxx vIndex = 0; vIndex < part->vertices.length; vIndex++)
+		{
+			v3 position = TransformPointByMat4(partLocalMat, vertices[vIndex].position);
+			partMin = NewV3(MinR32(partMin.X, position.X), MinR32(partMin.Y, position.Y), MinR32(partMin.Z, position.Z));
+			partMax = NewV3(MaxR32(partMax.X, position.X), MaxR32(partMax.Y, position.Y), MaxR32(partMax.Z, position.Z));
+		}
+		if (part->vertices.length == 0) { continue; }
+		if (!foundBounds) { result.localBounds = NewBoxV(partMin, Sub(partMax, partMin)); foundBounds = true; }
+		else
+		{
+			v3 boundsMin = result.localBounds.BottomLeftBack;
+			v3 boundsMax = Add(result.localBounds.BottomLeftBack, result.localBounds.Size);
+			v3 newMin = NewV3(MinR32(partMin.X, boundsMin.X), MinR32(partMin.Y, boundsMin.Y), MinR32(partMin.Z, boundsMin.Z));
+			v3 newMax = NewV3(MaxR32(partMax.X, boundsMax.X), MaxR32(partMax.Y, boundsMax.Y), MaxR32(partMax.Z, boundsMax.Z));
+			result.localBounds = NewBoxV(newMin, Sub(newMax, newMin));
+		}
+	}
+	result.occluder = BuildOccluderMesh(stdHeap, &result);
+	GenerateModelLods(stdHeap, &result);
 	return result;
 }
 
+// Drops this model's references in app->textureCache, the StreamedTextures go away once no other model shares them.
+// Must be called before the model is unloaded or loaded again with LoadModel
+void ReleaseModelTextures(Model3D* model)
+{
+	NotNull(model);
+	VarArrayLoop(&model->textureHandles, tIndex)
+	{
+		VarArrayLoopGet(TextureHandle, handle, &model->textureHandles, tIndex);
+		ReleaseCachedTexture(&app->textureCache, handle); //the atlased textures have invalid handles, releasing those does nothing
+	}
+	FreeVarArray(&model->textureHandles);
+	FreeVarArray(&model->textureIds);
+}
+
+#if BUILD_WITH_PHYSX && FP3D_SCENE_ENABLED
+// CreatePhysicsTest recreates all the bodies so we throw away the old box instances and spawn one per body
+void RebuildPhysicsInstances()
+{
+	VarArrayLoop(&app->physBoxInstances, hIndex)
+	{
+		VarArrayLoopGet(InstanceHandle, handle, &app->physBoxInstances, hIndex);
+		if (IsInstanceHandleValid(&app->instances, *handle)) { DespawnInstance(&app->instances, *handle); }
+	}
+	VarArrayClear(&app->physBoxInstances);
+	VarArrayLoop(&app->physWorld->bodies, bIndex)
+	{
+		VarArrayLoopGet(PhysicsBody, body, &app->physWorld->bodies, bIndex);
+		PhysicsBodyTransform transform = GetPhysicsBodyTransform(body);
+		v3 position = NewV3(transform.position.X, transform.position.Y, transform.position.Z);
+		quat rotation = NewQuat(transform.rotation.X, transform.rotation.Y, transform.rotation.Z, transform.rotation.W);
+		bool isGroundPlane = (body->index == app->physWorld->groundPlaneBodyIndex);
+		InstanceHandle* newHandle = VarArrayAdd(InstanceHandle, &app->physBoxInstances);
+		NotNull(newHandle);
+		//TODO: Figure out how PhysX want's us to intepret rotation/position on a Plane when drawing it
+		*newHandle = SpawnInstance(&app->instances, INSTANCE_MODEL_NONE,
+			position,
+			isGroundPlane ? Quat_Identity : rotation,
+			isGroundPlane ? NewV3(100.0f, 0.0001f, 100.0f) : NewV3(1.0f, 1.0f, 1.0f),
+			InstanceFlag_Visible|InstanceFlag_DrawAsBox|InstanceFlag_Occluder
+		);
+		app->instances.tints[GetInstanceIndex(&app->instances, *newHandle)] = isGroundPlane ? PalGreenDarker : GetPredefPalColorByIndex(bIndex);
+		if (!isGroundPlane) { SetInstancePhysicsBody(&app->instances, *newHandle, (u32)bIndex); }
+	}
+}
+#endif //BUILD_WITH_PHYSX && FP3D_SCENE_ENABLED
+
 // +==============================+
 // |           AppInit            |
 // +==============================+
@@ -270,6 +448,7 @@ EXPORT_FUNC(AppInit) APP_INIT_DEF(AppInit)
 	
 	InitRandomSeriesDefault(&app->random);
 	SeedRandomSeriesU64(&app->random, 0); //TODO: Use a time value
+	InitJobSystem(stdHeap, 0, &app->jobs);
 	
 	#if FP3D_SCENE_ENABLED
 	{
@@ -279,7 +458,7 @@ EXPORT_FUNC(AppInit) APP_INIT_DEF(AppInit)
 		{
 			MyMemCopy(&cubeVertices[iIndex], &cubeMesh.vertices[cubeMesh.indices[iIndex]], sizeof(Vertex3D));
 		}
-		app->cubeBuffer = InitVertBuffer3D(stdHeap, StrLit("cube"), VertBufferUsage_Static, cubeMesh.numIndices, cubeVertices, false);
+		app->cubeBuffer = InitPbrVertBuffer(stdHeap, StrLit("cube"), VertBufferUsage_Static, cubeMesh.numIndices, cubeVertices, nullptr);
 		Assert(app->cubeBuffer.error == Result_Success);
 		
 		GeneratedMesh sphereMesh = GenerateVertsForSphere(scratch, NewSphereV(V3_Zero, 1.0f), 12, 20, White);
@@ -288,17 +467,32 @@ EXPORT_FUNC(AppInit) APP_INIT_DEF(AppInit)
 		{
 			MyMemCopy(&sphereVertices[iIndex], &sphereMesh.vertices[sphereMesh.indices[iIndex]], sizeof(Vertex3D));
 		}
-		app->sphereBuffer = InitVertBuffer3D(stdHeap, StrLit("sphere"), VertBufferUsage_Static, sphereMesh.numIndices, sphereVertices, false);
+		app->sphereBuffer = InitPbrVertBuffer(stdHeap, StrLit("sphere"), VertBufferUsage_Static, sphereMesh.numIndices, sphereVertices, nullptr);
 		Assert(app->sphereBuffer.error == Result_Success);
 	}
 	#endif //FP3D_SCENE_ENABLED
 	
 	InitCompiledShader(&app->main2dShader, stdHeap, main2d); Assert(app->main2dShader.error == Result_Success);
+	InitCompiledShader(&app->main2dSdfShader, stdHeap, main2dSdf); Assert(app->main2dSdfShader.error == Result_Success);
 	#if FP3D_SCENE_ENABLED
 	InitCompiledShader(&app->main3dShader, stdHeap, main3d); Assert(app->main3dShader.error == Result_Success);
 	InitCompiledShader(&app->pbrShader, stdHeap, pbr); Assert(app->pbrShader.error == Result_Success);
+	InitCompiledShader(&app->pbrDepthShader, stdHeap, pbrDepth); Assert(app->pbrDepthShader.error == Result_Success);
+	{
+		u32* dfgLutPixels = GenerateBrdfDfgLut(scratch, BRDF_DFG_LUT_SIZE, BRDF_DFG_LUT_SAMPLES);
+		app->dfgLutTexture = InitTexture(stdHeap, StrLit("dfg_lut"), FillV2i(BRDF_DFG_LUT_SIZE), dfgLutPixels, 0x00);
+		Assert(app->dfgLutTexture.error == Result_Success);
+		u32 flatNormalPixel = FLAT_NORMAL_COLOR;
+		app->flatNormalTexture = InitTexture(stdHeap, StrLit("flat_normal"), FillV2i(1), &flatNormalPixel, TextureFlag_IsRepeating);
+		Assert(app->flatNormalTexture.error == Result_Success);
+	}
 	#endif //FP3D_SCENE_ENABLED
 	
+	InitTextureStreamer(stdHeap, &app->jobs, TEXTURE_STREAM_DEFAULT_BUDGET, false, &app->textureStreamer);
+	InitTextureCache(stdHeap, &app->textureStreamer, &app->textureCache);
+	InitTextureAtlas(stdHeap, &app->textureAtlas);
+	InitExposureState(&app->exposure);
+	
 	#if 0
 	PrintLine_D("pbrShader has %llu image%s", app->pbrShader.numImages, Plural(app->pbrShader.numImages, "s"));
 	for (uxx iIndex = 0; iIndex < app->pbrShader.numImages; iIndex++)
@@ -341,12 +535,62 @@ EXPORT_FUNC(AppInit) APP_INIT_DEF(AppInit)
 	#endif
 	// app->occlusionTexture = LoadTexture(stdHeap, "test_texture.png");
 	
+	#if FP3D_SCENE_ENABLED
+	{
+		const uxx numChests = ArrayCount(app->chests);
+		InitSceneGraph(stdHeap, TEST_MAX_INSTANCES, 1 + app->testModel.data.parts.length, &app->sceneGraph);
+		InitInstanceStore(stdHeap, TEST_MAX_INSTANCES, &app->sceneGraph, &app->instances);
+		app->chestModelId = RegisterInstanceModel(&app->instances, &app->testModel);
+		for (uxx yIndex = 0; yIndex < TEST_CHEST_GRID_SIZE; yIndex++)
+		{
+			for (uxx xIndex = 0; xIndex < TEST_CHEST_GRID_SIZE; xIndex++)
+			{
+				RandomSeries random = ZEROED;
+				InitRandomSeriesDefault(&random);
+				SeedRandomSeriesU64(&random, (u64)(xIndex * 17 + yIndex * 117));
+				r32 scale = GetRandR32Range(&random, 0.85f, 1.0f);
+				r32 rotation = GetRandR32Range(&random, 0, TwoPi32);
+				v3 modelPos = NewV3(xIndex * TEST_CHEST_GRID_SPACING, 0, yIndex * TEST_CHEST_GRID_SPACING);
+				uxx cIndex = yIndex*TEST_CHEST_GRID_SIZE + xIndex;
+				Assert(cIndex < numChests);
+				app->chests[cIndex] = SpawnInstance(&app->instances, app->chestModelId, modelPos, ToQuatFromAxis(V3_Up, rotation), FillV3(scale), InstanceFlag_Visible|InstanceFlag_Occluder);
+			}
+		}
+		UpdateInstanceTransforms(&app->instances, &app->jobs);
+		
+		InitBvh(stdHeap, TEST_MAX_INSTANCES, &app->instanceBvh);
+		InitVarArrayWithInitial(u32, &app->visibleInstances, stdHeap, TEST_MAX_INSTANCES);
+		InitVarArray(u32, &app->litInstances, stdHeap);
+		app->mousePickHit.item = BVH_ITEM_INVALID;
+		InitOcclusionBuffer(stdHeap, &app->occlusion);
+		app->occlusionCullingEnabled = true;
+		app->lodsEnabled = true;
+		app->meshletCullingEnabled = true;
+		InitRenderQueue(stdHeap, TEST_MAX_INSTANCES, &app->renderQueue);
+		InitStagedDrawList(stdHeap, TEST_MAX_INSTANCES, &app->stagedDraws);
+		app->depthPrePassEnabled = false;
+	}
+	#endif //FP3D_SCENE_ENABLED
+	
 	app->testFont = InitFont(stdHeap, StrLit("testFont"));
 	RasterizeFontAtSize(&app->testFont, StrLit(TEST_FONT_NAME), TEST_FONT_START_SIZE, TEST_FONT_STYLE);
 	app->debugFont = InitFont(stdHeap, StrLit("debugFont"));
 	r32 debugFontSizes[] = { 12, 18, 24 };
 	RasterizeFontAtSizes(&app->debugFont, StrLit("Consolas"), ArrayCount(debugFontSizes), &debugFontSizes[0], FontStyleFlag_Bold);
 	app->fontTestEnabled = false;
+	{
+		FontCharRange sdfCharRanges[] = {
+			FontCharRange_ASCII,
+			FontCharRange_LatinExt,
+		};
+		Result sdfFontResult = InitSdfFont(&app->jobs, stdHeap, StrLit(TEST_FONT_NAME), TEST_FONT_STYLE, SDF_FONT_BAKE_SIZE, ArrayCount(sdfCharRanges), &sdfCharRanges[0], &app->sdfFont);
+		Assert(sdfFontResult == Result_Success);
+		app->sdfTextEnabled = false;
+		InitGlyphCache(&app->jobs, stdHeap, &app->sdfFont, &app->glyphCache);
+		InitTextLayoutCache(stdHeap, &app->textLayoutCache);
+		app->glyphCacheTextEnabled = false;
+		app->sdfTextSize = TEST_FONT_START_SIZE;
+	}
 	
 	#if BUILD_WITH_CLAY
 	InitClayUIRenderer(stdHeap, V2_Zero, &app->clay);
@@ -383,6 +627,10 @@ EXPORT_FUNC(AppInit) APP_INIT_DEF(AppInit)
 	#elif BUILD_WITH_PHYSX
 	app->physWorld = InitPhysicsPhysX(platformInfo->platformStdHeapAllowFreeWithoutSize);
 	CreatePhysicsTest(app->physWorld);
+	#if FP3D_SCENE_ENABLED
+	InitVarArray(InstanceHandle, &app->physBoxInstances, stdHeap);
+	RebuildPhysicsInstances();
+	#endif
 	#endif
 	
 	app->initialized = true;
@@ -467,6 +715,9 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 			}
 			#elif BUILD_WITH_PHYSX
 			CreatePhysicsTest(app->physWorld);
+			#if FP3D_SCENE_ENABLED
+			RebuildPhysicsInstances();
+			#endif
 			#else
 			app->cameraPos = NewV3(3, 0.5f, 2);
 			app->cameraLookDir = Normalize(Sub(app->spherePos, app->cameraPos));
@@ -496,12 +747,21 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 	#endif FP3D_SCENE_ENABLED
 	if (!isTyping)
 	{
-		if (IsKeyboardKeyPressed(&appIn->keyboard, Key_Plus) && IsKeyboardKeyDown(&appIn->keyboard, Key_Control))
+		//SDF text draws at any size from the same atlas so resizing it doesn't need a rebake
+		if (IsKeyboardKeyPressed(&appIn->keyboard, Key_Plus) && IsKeyboardKeyDown(&appIn->keyboard, Key_Control) && app->sdfTextEnabled)
+		{
+			app->sdfTextSize += 2.0f;
+		}
+		else if (IsKeyboardKeyPressed(&appIn->keyboard, Key_Plus) && IsKeyboardKeyDown(&appIn->keyboard, Key_Control))
 		{
 			FontAtlas* lastAtlas = VarArrayGetLast(FontAtlas, &app->testFont.atlases);
 			RasterizeFontAtSize(&app->testFont, StrLit(TEST_FONT_NAME), lastAtlas->fontSize + 2.0f, TEST_FONT_STYLE);
 		}
-		if (IsKeyboardKeyPressed(&appIn->keyboard, Key_Minus) && IsKeyboardKeyDown(&appIn->keyboard, Key_Control))
+		if (IsKeyboardKeyPressed(&appIn->keyboard, Key_Minus) && IsKeyboardKeyDown(&appIn->keyboard, Key_Control) && app->sdfTextEnabled)
+		{
+			app->sdfTextSize = MaxR32(4.0f, app->sdfTextSize - 2.0f);
+		}
+		else if (IsKeyboardKeyPressed(&appIn->keyboard, Key_Minus) && IsKeyboardKeyDown(&appIn->keyboard, Key_Control))
 		{
 			FontAtlas* lastAtlas = VarArrayGetLast(FontAtlas, &app->testFont.atlases);
 			RasterizeFontAtSize(&app->testFont, StrLit(TEST_FONT_NAME), MaxR32(4.0f, lastAtlas->fontSize - 2.0f), TEST_FONT_STYLE);
@@ -513,16 +773,6 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 		PrintLine_D("ScreenSize: %dx%d", appIn->screenSize.Width, appIn->screenSize.Height);
 		app->textPos = Div(ToV2Fromi(appIn->screenSize), 2.0f);
 		if (app->text.chars == nullptr) { app->text = AllocStr8Nt(stdHeap, "Hello World!"); }
-		FreeTextLayout(&app->textLayout);
-		FontFlowState flowState = ZEROED;
-		flowState.font = &app->testFont;
-		flowState.position = app->textPos;
-		flowState.text = app->text;
-		flowState.fontSize = GetDefaultFontSize(&app->testFont);
-		flowState.styleFlags = GetDefaultFontStyleFlags(&app->testFont);
-		Result layoutResult = DoTextLayoutInArena(stdHeap, &flowState, &app->textLayout);
-		Assert(layoutResult == Result_Success);
-		app->textMeasure = MeasureText(&app->testFont, app->text);
 		app->textChanged = false;
 	}
 	
@@ -566,6 +816,22 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 	UpdatePhysics(app->physWorld, TEST_PHYS_SIM_STEP_SIZE, NUM_MS_PER_SECOND/60.0f); //TODO: Actually get deltaTime from appInput!
 	#elif BUILD_WITH_PHYSX
 	UpdatePhysicsWorld(app->physWorld, NUM_MS_PER_SECOND/60.0f); //TODO: Actually get deltaTime from appInput!
+	#if FP3D_SCENE_ENABLED
+	SyncInstancesFromPhysics(&app->instances, app->physWorld);
+	#endif
+	#endif
+	
+	#if FP3D_SCENE_ENABLED
+	uxx numMovedInstances = UpdateInstanceTransforms(&app->instances, &app->jobs);
+	if (app->instanceBvhLayoutVersion != app->instances.layoutVersion)
+	{
+		BuildBvh(&app->instanceBvh, app->instances.bounds, app->instances.count);
+		app->instanceBvhLayoutVersion = app->instances.layoutVersion;
+	}
+	else if (numMovedInstances > 0 && RefitBvh(&app->instanceBvh, app->instances.bounds))
+	{
+		BuildBvh(&app->instanceBvh, app->instances.bounds, app->instances.count);
+	}
 	#endif
 	
 	BeginFrame(platform->GetSokolSwapchain(), appIn->screenSize, PalBlueLight, 1.0f);
@@ -575,48 +841,157 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 		// +==============================+
 		#if FP3D_SCENE_ENABLED
 		{
-			// BindShader(&app->main3dShader);
-			BindShader(&app->pbrShader);
-			SetShaderUniformByNameV4(&app->pbrShader, StrLit("lightPos"), ToV4From3(app->lightPos, 1.0f));
-			SetShaderUniformByNameV4(&app->pbrShader, StrLit("cameraPos"), ToV4From3(app->cameraPos, 1.0f));
-			
 			#if defined(SOKOL_GLCORE)
-			mat4 projMat = MakePerspectiveMat4Gl(ToRadians32(45), (r32)appIn->screenSize.Width/(r32)appIn->screenSize.Height, 0.05f, 400);
+			mat4 projMat = MakePerspectiveMat4Gl(TEST_CAMERA_FOV, (r32)appIn->screenSize.Width/(r32)appIn->screenSize.Height, 0.05f, 400);
 			#else
-			mat4 projMat = MakePerspectiveMat4Dx(ToRadians32(45), (r32)appIn->screenSize.Width/(r32)appIn->screenSize.Height, 0.05f, 400);
+			mat4 projMat = MakePerspectiveMat4Dx(TEST_CAMERA_FOV, (r32)appIn->screenSize.Width/(r32)appIn->screenSize.Height, 0.05f, 400);
 			#endif
-			SetProjectionMat(projMat);
 			mat4 viewMat = MakeLookAtMat4(app->cameraPos, Add(app->cameraPos, app->cameraLookDir), V3_Up);
-			SetViewMat(viewMat);
+			
+			mat4 viewProjMat = Mul(projMat, viewMat);
+			#if defined(SOKOL_GLCORE)
+			BvhFrustum frustum = GetBvhFrustumFromMat4(viewProjMat, false);
+			#else
+			BvhFrustum frustum = GetBvhFrustumFromMat4(viewProjMat, true);
+			#endif
+			VarArrayClear(&app->visibleInstances);
+			QueryBvhFrustum(&app->instanceBvh, app->instances.bounds, &frustum, &app->visibleInstances);
+			for (uxx iIndex = 0; iIndex < app->instances.count; iIndex++) { FlagSet(app->instances.flags[iIndex], InstanceFlag_Culled); }
+			VarArrayLoop(&app->visibleInstances, vIndex)
+			{
+				VarArrayLoopGet(u32, instanceIndex, &app->visibleInstances, vIndex);
+				FlagUnset(app->instances.flags[*instanceIndex], InstanceFlag_Culled);
+			}
+			app->numOccludedInstances = 0;
+			if (app->occlusionCullingEnabled)
+			{
+				app->numOccludedInstances = CullOccludedInstances(&app->occlusion, &app->instances, &app->jobs, viewProjMat, app->cameraPos, &app->visibleInstances);
+			}
+			
+			BvhRay pickRay = GetBvhRayFromScreenPos(app->cameraPos, app->cameraLookDir, viewMat, TEST_CAMERA_FOV, screenSize, appIn->mouse.isLocked ? screenCenter : mousePos);
+			app->mousePickHit = RaycastBvh(&app->instanceBvh, app->instances.bounds, pickRay, HighestR32);
+			
+			//TODO: The pbr shader only takes one light so this only feeds the debug readout for now
+			VarArrayClear(&app->litInstances);
+			QueryBvhSphere(&app->instanceBvh, app->instances.bounds, app->lightPos, TEST_LIGHT_RADIUS, &app->litInstances);
 			
 			// DrawBox(NewBoxV(Sub(app->spherePos, FillV3(app->sphereRadius)), FillV3(app->sphereRadius*2)), White);
 			// DrawSphere(NewSphereV(app->spherePos, app->sphereRadius), White);
 			// DrawBox(NewBoxV(Add(Sub(app->spherePos, FillV3(app->sphereRadius)), NewV3(2.0f*1, 0, 0)), FillV3(app->sphereRadius*2)), White);
 			
 			// DrawModel(&app->testModel, app->spherePos, FillV3(app->sphereRadius*2), Quat_Identity);
-			for (uxx yIndex = 0; yIndex < 10; yIndex++)
+			app->numTrianglesDrawn = 0;
+			app->numTrianglesFullDetail = 0;
+			ClearStruct(app->meshletStats);
+			ClearRenderQueue(&app->renderQueue);
+			reci scissorRec = NewReci(appIn->screenSize.Width/4, appIn->screenSize.Height/4, appIn->screenSize.Width/2, appIn->screenSize.Height/2);
+			//Dense indices move around on despawn so the checkerboard looks up each chest's grid cell through its handle
+			u32* chestGridIndices = AllocArray(u32, scratch, MaxUXX(app->instances.count, 1));
+			NotNull(chestGridIndices);
+			MyMemSet(chestGridIndices, 0xFF, sizeof(u32) * app->instances.count);
+			for (uxx cIndex = 0; cIndex < ArrayCount(app->chests); cIndex++)
+			{
+				u32 chestIndex = GetInstanceIndex(&app->instances, app->chests[cIndex]);
+				if (chestIndex != INSTANCE_INDEX_INVALID) { chestGridIndices[chestIndex] = (u32)cIndex; }
+			}
+			VarArrayLoop(&app->visibleInstances, vIndex)
 			{
-				for (uxx xIndex = 0; xIndex < 10; xIndex++)
+				VarArrayLoopGet(u32, instanceIndex, &app->visibleInstances, vIndex);
+				uxx iIndex = *instanceIndex;
+				if (!IsFlagSet(app->instances.flags[iIndex], InstanceFlag_Visible)) { continue; }
+				Model3D* model = GetInstanceModel(&app->instances, app->instances.modelIds[iIndex]);
+				bool drawAsBox = IsFlagSet(app->instances.flags[iIndex], InstanceFlag_DrawAsBox);
+				if (!drawAsBox)
 				{
-					RandomSeries random = ZEROED;
-					InitRandomSeriesDefault(&random);
-					SeedRandomSeriesU64(&random, (u64)(xIndex * 17 + yIndex * 117));
-					r32 scale = GetRandR32Range(&random, 0.85f, 1.0f);
-					r32 rotation = GetRandR32Range(&random, 0, TwoPi32);
-					v3 modelPos = NewV3(xIndex * 1.5f, 0, yIndex * 1.5f);
-					if (app->scissorTestEnabled && ((xIndex + yIndex) % 2) == 0) { SetClipRec(NewReci(appIn->screenSize.Width/4, appIn->screenSize.Height/4, appIn->screenSize.Width/2, appIn->screenSize.Height/2)); }
-					else { DisableClipRec(); }
-					DrawModel(&app->testModel, modelPos, FillV3(scale), ToQuatFromAxis(V3_Up, rotation));
+					if (app->lodsEnabled) { SelectInstanceLod(&app->instances, iIndex, app->cameraPos, TEST_CAMERA_FOV); }
+					else { app->instances.lodLevels[iIndex] = 0; }
 				}
+				
+				uxx firstRange = app->renderQueue.meshletRanges.length;
+				uxx numMeshletIndicesBefore = app->meshletStats.numIndicesDrawn;
+				bool useMeshlets = (app->meshletCullingEnabled && model != nullptr && model->numMeshlets > 0 && app->instances.lodLevels[iIndex] == 0);
+				if (useMeshlets)
+				{
+					//Occluders are already in the OcclusionBuffer so they would end up hiding parts of themselves
+					u8 cullFlags = MeshletCullFlag_Cone|MeshletCullFlag_Frustum;
+					if (app->occlusionCullingEnabled && !IsFlagSet(app->instances.flags[iIndex], InstanceFlag_Occluder)) { FlagSet(cullFlags, MeshletCullFlag_Occlusion); }
+					CullModelMeshlets(&app->jobs, model, &app->sceneGraph, app->instances.sceneRoots[iIndex], cullFlags, &frustum, app->cameraPos, &app->occlusion, viewProjMat, &app->renderQueue.meshletRanges, &app->meshletStats);
+					if (app->renderQueue.meshletRanges.length == firstRange) { continue; } //every meshlet was culled
+				}
+				
+				//Only counted once we know the instance is actually drawn, and only the meshlets that survived culling
+				if (drawAsBox)
+				{
+					app->numTrianglesDrawn += 12;
+					app->numTrianglesFullDetail += 12;
+				}
+				else
+				{
+					if (useMeshlets) { app->numTrianglesDrawn += (app->meshletStats.numIndicesDrawn - numMeshletIndicesBefore) / 3; }
+					else { app->numTrianglesDrawn += model->lodTriangleCounts[app->instances.lodLevels[iIndex]]; }
+					app->numTrianglesFullDetail += model->lodTriangleCounts[0];
+				}
+				
+				box bounds = app->instances.bounds[iIndex];
+				r32 viewDepth = Dot(Sub(Add(bounds.BottomLeftBack, Mul(bounds.Size, 0.5f)), app->cameraPos), app->cameraLookDir);
+				RenderQueueItem* item = AddRenderQueueItem(&app->renderQueue, (u32)iIndex, viewDepth, GetBoxScreenRec(viewProjMat, bounds));
+				u32 gridIndex = chestGridIndices[iIndex];
+				uxx xIndex = gridIndex % TEST_CHEST_GRID_SIZE;
+				uxx yIndex = gridIndex / TEST_CHEST_GRID_SIZE;
+				item->scissored = (gridIndex != INSTANCE_INDEX_INVALID && app->scissorTestEnabled && ((xIndex + yIndex) % 2) == 0);
+				if (model != nullptr)
+				{
+					r32 screenPixels = MaxR32(item->screenRec.Width * (r32)appIn->screenSize.Width, item->screenRec.Height * (r32)appIn->screenSize.Height);
+					RequestModelTextures(&app->textureStreamer, model, screenPixels);
+				}
+				if (useMeshlets)
+				{
+					item->firstRange = (u32)firstRange;
+					item->numRanges = (u32)(app->renderQueue.meshletRanges.length - firstRange);
+				}
+			}
+			FinishRenderQueue(&app->renderQueue);
+			FillStagedDrawList(&app->stagedDraws, &app->renderQueue, &app->instances);
+			UpdateTextureStreamer(&app->textureStreamer);
+			
+			if (app->depthPrePassEnabled)
+			{
+				BindShader(&app->pbrDepthShader);
+				SetProjectionMat(projMat);
+				SetViewMat(viewMat);
+				SetColorWriteEnabled(false);
+				DrawRenderQueue(&app->renderQueue, &app->stagedDraws, &app->instances, scissorRec, true);
+				SetColorWriteEnabled(true);
+				//pbrDepth and pbr share the same invariant position math so the color pass regenerates exactly the depths
+				//the pre-pass wrote, LESS_EQUAL with writes off then only shades the front-most fragment of every pixel
+				SetDepthWriteEnabled(false);
+				SetDepthCompareFunc(SG_COMPAREFUNC_LESS_EQUAL);
+			}
+			
+			EstimateRenderQueueLuminance(&app->exposure.histogram, &app->renderQueue, &app->instances, app->lightPos, app->cameraPos, GetColor32LinearLuminance(PalBlueLight));
+			UpdateExposure(&app->exposure, 1.0f/60.0f); //TODO: Actually get deltaTime from appInput!
+			
+			BindShader(&app->pbrShader);
+			SetShaderUniformByNameV4(&app->pbrShader, StrLit("lightPos"), ToV4From3(app->lightPos, TEST_LIGHT_INTENSITY));
+			SetShaderUniformByNameV4(&app->pbrShader, StrLit("cameraPos"), ToV4From3(app->cameraPos, TEST_LIGHT_RADIUS));
+			SetShaderUniformByNameV4(&app->pbrShader, StrLit("ambientColor"), ToV4From3(TEST_AMBIENT_COLOR, 1.0f));
+			BindTextureAtIndex(&app->dfgLutTexture, PBR_TEXTURE_SLOT_DFG_LUT);
+			SetShaderUniformByNameV4(&app->pbrShader, StrLit("exposureParams"), NewV4(app->exposure.exposure, (r32)app->exposure.tonemapper, 0.0f, 0.0f));
+			SetProjectionMat(projMat);
+			SetViewMat(viewMat);
+			DrawRenderQueue(&app->renderQueue, &app->stagedDraws, &app->instances, scissorRec, false);
+			if (app->depthPrePassEnabled)
+			{
+				SetDepthWriteEnabled(true);
+				SetDepthCompareFunc(SG_COMPAREFUNC_LESS);
 			}
-			DisableClipRec();
 			
-			BindTextureAtIndex(&gfx.pixelTexture, 0);
-			BindTextureAtIndex(&gfx.pixelTexture, 1);
-			BindTextureAtIndex(&gfx.pixelTexture, 2);
-			BindTextureAtIndex(&gfx.pixelTexture, 3);
-			BindTextureAtIndex(&gfx.pixelTexture, 4);
+			BindUntexturedPbrMaterial();
 			DrawBox(NewBoxV(Sub(app->lightPos, FillV3(0.05f)), FillV3(0.1f)), White);
+			if (app->mousePickHit.item != BVH_ITEM_INVALID)
+			{
+				DrawBox(NewBoxV(Sub(app->mousePickHit.position, FillV3(0.03f)), FillV3(0.06f)), MonokaiRed);
+			}
 			
 			#if BUILD_WITH_ODE
 			VarArrayLoop(&app->physWorld->bodies, bIndex)
@@ -626,23 +1001,6 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 				quat bodyRotation = GetBodyRotation(app->physWorld, body->index);
 				DrawObb3(NewObb3V(bodyPosition, TEST_PHYS_BOX_SIZE, bodyRotation), MonokaiRed);
 			}
-			#elif BUILD_WITH_PHYSX
-			VarArrayLoop(&app->physWorld->bodies, bIndex)
-			{
-				VarArrayLoopGet(PhysicsBody, body, &app->physWorld->bodies, bIndex);
-				PhysicsBodyTransform transform = GetPhysicsBodyTransform(body);
-				v3 position = NewV3(transform.position.X, transform.position.Y, transform.position.Z);
-				quat rotation = NewQuat(transform.rotation.X, transform.rotation.Y, transform.rotation.Z, transform.rotation.W);
-				if (body->index == app->physWorld->groundPlaneBodyIndex)
-				{
-					//TODO: Figure out how PhysX want's us to intepret rotation/position on a Plane when drawing it
-					DrawObb3(NewObb3V(position, NewV3(100.0f, 0.0001f, 100.0f), Quat_Identity), PalGreenDarker);
-				}
-				else
-				{
-					DrawObb3(NewObb3V(position, NewV3(1.0f, 1.0f, 1.0f), rotation), GetPredefPalColorByIndex(bIndex));
-				}
-			}
 			#endif
 		}
 		#endif //FP3D_SCENE_ENABLED
@@ -651,6 +1009,8 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 		// |         2D Rendering         |
 		// +==============================+
 		{
+			UpdateGlyphCache(&app->glyphCache);
+			UpdateTextLayoutCache(&app->textLayoutCache);
 			BindShader(&app->main2dShader);
 			ClearDepthBuffer(1.0f);
 			mat4 projMat = Mat4_Identity;
@@ -677,24 +1037,45 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 					DrawRectangleOutline(atlasRec, 2.0f, White);
 					atlasPosX += (r32)atlas->texture.Width;
 				}
+				if (app->sdfTextEnabled)
+				{
+					rec sdfAtlasRec = NewRec(atlasPosX, viewRec.Y, (r32)app->sdfFont.atlasSize.Width, (r32)app->sdfFont.atlasSize.Height);
+					DrawTexturedRectangle(sdfAtlasRec, White, &app->sdfFont.atlasTexture);
+					DrawRectangleOutline(sdfAtlasRec, 2.0f, MonokaiGreen);
+				}
 				
 				if (!IsEmptyStr(app->text))
 				{
-					BindFontAtSize(&app->debugFont, 18);
-					FontAtlas* fontAtlas = GetFontAtlas(gfx.state.font, gfx.state.fontSize, gfx.state.fontStyleFlags);
+					u8 textStyleFlags = GetDefaultFontStyleFlags(&app->debugFont);
+					FontAtlas* fontAtlas = GetFontAtlas(&app->debugFont, 18, textStyleFlags);
 					NotNull(fontAtlas);
-					DrawText(app->text, app->textPos, White);
+					CachedTextLayout* textLayout = GetCachedFontTextLayout(&app->textLayoutCache, &app->debugFont, app->text, 18, textStyleFlags);
+					DrawCachedTextLayout(textLayout, app->textPos, White);
+					rec textVisualRec = NewRecV(Add(textLayout->visualRec.TopLeft, app->textPos), textLayout->visualRec.Size);
+					rec textLogicalRec = NewRecV(Add(textLayout->logicalRec.TopLeft, app->textPos), textLayout->logicalRec.Size);
 					// #define DrawRectangleOutlineEx(rectangle, borderThickness, color, outside)
-					DrawRectangleOutlineEx(gfx.prevFontFlow.visualRec, 4, MonokaiPurple, true);
-					DrawRectangleOutlineEx(gfx.prevFontFlow.logicalRec, 2, MonokaiGreen, true);
-					DrawRectangleOutlineEx(NewRecV(Add(gfx.prevFontFlow.logicalRec.TopLeft, NewV2(0, fontAtlas->lineHeight)), gfx.prevFontFlow.logicalRec.Size), 1, MonokaiRed, true);
+					DrawRectangleOutlineEx(textVisualRec, 4, MonokaiPurple, true);
+					DrawRectangleOutlineEx(textLogicalRec, 2, MonokaiGreen, true);
+					DrawRectangleOutlineEx(NewRecV(Add(textLogicalRec.TopLeft, NewV2(0, fontAtlas->lineHeight)), textLogicalRec.Size), 1, MonokaiRed, true);
 					DrawRectangle(NewRecCenteredV(app->textPos, NewV2(2,2)), MonokaiBlue);
-					// DrawRectangleOutline(gfx.prevFontFlow.visualRec, 2.0f, White);
-					// for (uxx gIndex = 0; gIndex < app->textLayout.numGlyphs; gIndex++)
+					// DrawRectangleOutline(textVisualRec, 2.0f, White);
+					// for (uxx gIndex = 0; gIndex < textLayout->numGlyphs; gIndex++)
 					// {
-					// 	FontFlowGlyph* glyph = &app->textL ayout.glyphs[gIndex];
-					// 	DrawRectangleOutlineEx(glyph->drawRec, 1.0f, MonokaiRed, true);
+					// 	CachedFontLayoutGlyph* glyph = &textLayout->fontGlyphs[gIndex];
+					// 	DrawRectangleOutlineEx(NewRecV(Add(glyph->drawRec.TopLeft, app->textPos), glyph->drawRec.Size), 1.0f, MonokaiRed, true);
 					// }
+					
+					if (app->sdfTextEnabled)
+					{
+						CachedTextLayout* sdfLayout = GetCachedTextLayout(&app->textLayoutCache, &app->sdfFont, app->glyphCacheTextEnabled ? &app->glyphCache : nullptr, app->text, app->sdfTextSize, (r32)appIn->screenSize.Width * 0.8f);
+						v2 sdfTextPos = NewV2(app->textPos.X - sdfLayout->size.Width/2.0f, textLogicalRec.Y + textLogicalRec.Height + 20.0f);
+						sdfTextPos.Y += app->sdfFont.ascent * (app->sdfTextSize / app->sdfFont.bakeSize);
+						BindSdfTextShader(&app->main2dSdfShader);
+						SetProjectionMat(projMat);
+						SetViewMat(Mat4_Identity);
+						DrawCachedTextLayout(sdfLayout, sdfTextPos, White);
+						BindShader(&app->main2dShader);
+					}
 				}
 			}
 			if (app->horizontalGuidesEnabled)
@@ -713,11 +1094,11 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 				{
 					rec guideRec = NewRec(ClampR32(mousePos.X, mouseLerpRec.X, mouseLerpRec.X + mouseLerpRec.Width), mouseLerpRec.Y, 1, mouseLerpRec.Height);
 					DrawRectangle(guideRec, MonokaiRed);
-					BindFontAtSize(&app->debugFont, 12);
+					u8 guideStyleFlags = GetDefaultFontStyleFlags(&app->debugFont);
 					Str8 displayStr = ScratchPrintStr("X: %.1f%%", mouseLerpX*100.0f);
 					v2 displayStrPos = NewV2(guideRec.X + (mouseLerpX >= 0.5f ? -58 : 5), guideRec.Y + guideRec.Height - 30);
-					DrawText(displayStr, Add(displayStrPos, NewV2(0, 2)), Black);
-					DrawText(displayStr, displayStrPos, MonokaiRed);
+					DrawCachedFontText(&app->textLayoutCache, &app->debugFont, displayStr, Add(displayStrPos, NewV2(0, 2)), 12, guideStyleFlags, Black);
+					DrawCachedFontText(&app->textLayoutCache, &app->debugFont, displayStr, displayStrPos, 12, guideStyleFlags, MonokaiRed);
 				}
 			}
 			if (app->verticalGuidesEnabled)
@@ -734,26 +1115,28 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 				{
 					rec guideRec = NewRec(mouseLerpRec.X, ClampR32(mousePos.Y, mouseLerpRec.Y, mouseLerpRec.Y + mouseLerpRec.Height), mouseLerpRec.Width, 1);
 					DrawRectangle(guideRec, MonokaiGreen);
-					BindFontAtSize(&app->debugFont, 12);
+					u8 guideStyleFlags = GetDefaultFontStyleFlags(&app->debugFont);
 					Str8 displayStr = ScratchPrintStr("Y: %.1f%%", mouseLerpY*100.0f);
 					v2 displayStrPos = NewV2(guideRec.X + guideRec.Width - 50, guideRec.Y + (mouseLerpY >= 0.5f ? -8 : 20));
-					DrawText(displayStr, Add(displayStrPos, NewV2(0, 2)), Black);
-					DrawText(displayStr, displayStrPos, MonokaiGreen);
+					DrawCachedFontText(&app->textLayoutCache, &app->debugFont, displayStr, Add(displayStrPos, NewV2(0, 2)), 12, guideStyleFlags, Black);
+					DrawCachedFontText(&app->textLayoutCache, &app->debugFont, displayStr, displayStrPos, 12, guideStyleFlags, MonokaiGreen);
 				}
 			}
 			
 			if (app->borderThicknessTestEnabled)
 			{
 				rec drawRec = NewRecCenteredV(screenCenter, NewV2(250, 200));
-				rec sourceRec = NewRecV(V2_Zero, ToV2Fromi(app->testTexturePink.size));
+				Texture* pinkTexture = GetCachedTexture(&app->textureCache, app->testTexturePink);
+				Texture* blueTexture = GetCachedTexture(&app->textureCache, app->testTextureBlue);
+				rec sourceRec = NewRecV(V2_Zero, ToV2Fromi(pinkTexture->size));
 				r32 leftThickness = LerpR32(0, 50, mouseLerpX);
 				r32 rightThickness = LerpR32(100, 0, mouseLerpX);
 				r32 topThickness = LerpR32(0, 50, mouseLerpY);
 				r32 bottomThickness = LerpR32(100, 0, mouseLerpY);
-				DrawTexturedRectangleOutlineSidesEx(drawRec, leftThickness, 0, 0, 0, White, false, &app->testTexturePink, sourceRec);
-				DrawTexturedRectangleOutlineSidesEx(drawRec, 0, rightThickness, 0, 0, White, false, &app->testTexturePink, sourceRec);
-				DrawTexturedRectangleOutlineSidesEx(drawRec, 0, 0, topThickness, 0, White, false, &app->testTextureBlue, sourceRec);
-				DrawTexturedRectangleOutlineSidesEx(drawRec, 0, 0, 0, bottomThickness, White, false, &app->testTextureBlue, sourceRec);
+				DrawTexturedRectangleOutlineSidesEx(drawRec, leftThickness, 0, 0, 0, White, false, pinkTexture, sourceRec);
+				DrawTexturedRectangleOutlineSidesEx(drawRec, 0, rightThickness, 0, 0, White, false, pinkTexture, sourceRec);
+				DrawTexturedRectangleOutlineSidesEx(drawRec, 0, 0, topThickness, 0, White, false, blueTexture, sourceRec);
+				DrawTexturedRectangleOutlineSidesEx(drawRec, 0, 0, 0, bottomThickness, White, false, blueTexture, sourceRec);
 			}
 			
 			if (app->roundedRecTestEnabled)
@@ -765,8 +1148,8 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 					LerpR32(0, 200, mouseLerpX), //radiusBR
 					LerpR32(0, 200, mouseLerpY), //radiusBL
 					White,
-					&app->testTextureBlue,
-					NewRecV(V2_Zero, ToV2Fromi(app->testTextureBlue.size))
+					GetCachedTexture(&app->textureCache, app->testTextureBlue),
+					NewRecV(V2_Zero, ToV2Fromi(GetCachedTexture(&app->textureCache, app->testTextureBlue)->size))
 				);
 			}
 			
@@ -782,8 +1165,8 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 					LerpR32(0, 200, mouseLerpY), //radiusBL
 					White,
 					false, //outside
-					&app->testTextureBlue,
-					NewRecV(V2_Zero, ToV2Fromi(app->testTextureBlue.size))
+					GetCachedTexture(&app->textureCache, app->testTextureBlue),
+					NewRecV(V2_Zero, ToV2Fromi(GetCachedTexture(&app->textureCache, app->testTextureBlue)->size))
 				);
 			}
 			if (app->circleTestEnabled && mouseLerpX > 0)
@@ -793,7 +1176,7 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 					app->circlePieceAngleOffset,
 					LerpR32(0, TwoPi32, mouseLerpX) + app->circlePieceAngleOffset,
 					White,
-					&app->testTexturePink
+					GetCachedTexture(&app->textureCache, app->testTexturePink)
 				);
 			}
 			if (app->ringTestEnabled && mouseLerpX > 0)
@@ -804,11 +1187,31 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 					app->ringPieceAngleOffset,
 					LerpR32(0, TwoPi32, mouseLerpX) + app->ringPieceAngleOffset,
 					White,
-					&app->testTexturePink
+					GetCachedTexture(&app->textureCache, app->testTexturePink)
 				);
 			}
 			
 			#if BUILD_WITH_CLAY
+			#if FP3D_SCENE_ENABLED
+			if (app->statusText.chars == nullptr || app->statusTextMouseLocked != appIn->mouse.isLocked)
+			{
+				if (app->statusText.chars != nullptr) { FreeStr8(stdHeap, &app->statusText); }
+				app->statusText = PrintInArenaStr(stdHeap, "WASD=Move Camera     QE=Up/Down     %s     R=Reset     %s=Toggle Topbar",
+					appIn->mouse.isLocked ? "(Press ESC to Release Mouse)" : "F=Capture Mouse",
+					GetKeyStr(CLAY_TOPBAR_TOGGLE_HOTKEY)
+				);
+				app->statusTextMouseLocked = appIn->mouse.isLocked;
+			}
+			Str8 statusText = app->statusText;
+			#else
+			Str8 statusText = StrLit("Move your mouse!");
+			#endif
+			u8 statusStyleFlags = GetDefaultFontStyleFlags(&app->debugFont);
+			CachedTextLayout* statusTextLayout = GetCachedFontTextLayout(&app->textLayoutCache, &app->debugFont, statusText, 18, statusStyleFlags);
+			v2 statusTextSize = statusTextLayout->size;
+			rec statusTextLogicalRec = statusTextLayout->logicalRec;
+			Clay_ElementId statusTextId = ToClayId(StrLit("StatusText"));
+			
 			BeginClayUIRender(&app->clay.clay, ToV2Fromi(appIn->screenSize), 16.6f, isMouseOverUi, appIn->mouse.position, IsMouseBtnDown(&appIn->mouse, MouseBtn_Left), appIn->mouse.scrollDelta);
 			{
 				CLAY(ClayFullscreenContainer("FullscreenContainer", (u16)imguiTopbarHeight))
@@ -826,6 +1229,16 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 									app->fontTestEnabled = !app->fontTestEnabled;
 								} Clay__CloseElement();
 								
+								if (ClayBtn(ScratchPrint("%s SDF Text (%.0fpx)", app->sdfTextEnabled ? "Disable" : "Enable", app->sdfTextSize), Transparent, app->sdfTextEnabled ? MonokaiGreen : MonokaiWhite))
+								{
+									app->sdfTextEnabled = !app->sdfTextEnabled;
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("%s Dynamic Glyphs", app->glyphCacheTextEnabled ? "Disable" : "Enable"), Transparent, app->glyphCacheTextEnabled ? MonokaiGreen : MonokaiWhite))
+								{
+									app->glyphCacheTextEnabled = !app->glyphCacheTextEnabled;
+								} Clay__CloseElement();
+								
 								if (ClayBtn(ScratchPrint("%s Border Thickness", app->borderThicknessTestEnabled ? "Disable" : "Enable"), Transparent, app->borderThicknessTestEnabled ? MonokaiGreen : MonokaiWhite))
 								{
 									app->borderThicknessTestEnabled = !app->borderThicknessTestEnabled;
@@ -895,6 +1308,186 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 									Clay_SetDebugModeEnabled(!Clay_IsDebugModeEnabled());
 								} Clay__CloseElement();
 								
+								if (ClayBtn("Run TRS Benchmark", Transparent, MonokaiWhite))
+								{
+									PrintTrsBenchmark(10000);
+								} Clay__CloseElement();
+								
+								if (ClayBtn("Run BVH Benchmark", Transparent, MonokaiWhite))
+								{
+									PrintBvhBenchmark(10000);
+									PrintBvhBenchmark(100000);
+									PrintBvhBenchmark(1000000);
+								} Clay__CloseElement();
+								
+								if (ClayBtn("Run OBJ Benchmark", Transparent, MonokaiWhite))
+								{
+									PrintObjBenchmark(&app->jobs, 256);
+									PrintObjBenchmark(&app->jobs, 1024);
+								} Clay__CloseElement();
+								
+								if (ClayBtn("Run PNG Benchmark", Transparent, MonokaiWhite))
+								{
+									#if LOAD_FROM_RESOURCES_FOLDER
+									PrintPngBenchmark(&app->jobs, "resources/model/chest/chest_normal.png", 8);
+									PrintPngBenchmark(&app->jobs, "resources/model/chest/chest_roughness.png", 8);
+									PrintPngBenchmark(&app->jobs, "resources/model/fire_hydrant/fire_hydrant_Roughness.png", 8);
+									#else
+									PrintPngBenchmark(&app->jobs, "chest_normal.png", 8);
+									PrintPngBenchmark(&app->jobs, "chest_roughness.png", 8);
+									PrintPngBenchmark(&app->jobs, "fire_hydrant_Roughness.png", 8);
+									#endif
+								} Clay__CloseElement();
+								
+								if (ClayBtn("Validate BRDF", Transparent, MonokaiWhite))
+								{
+									ValidateBrdfReference();
+								} Clay__CloseElement();
+								
+								#if FP3D_SCENE_ENABLED
+								for (uxx mIndex = 0; mIndex < PathTracerMode_Count; mIndex++)
+								{
+									if (ClayBtn(ScratchPrint("Path Trace %s", GetPathTracerModeStr((PathTracerMode)mIndex)), Transparent, MonokaiWhite))
+									{
+										RenderPathTracerReference((PathTracerMode)mIndex);
+									} Clay__CloseElement();
+								}
+								#endif //FP3D_SCENE_ENABLED
+								
+								if (ClayBtn(ScratchPrint("Texture Budget: %lluMB", (u64)(app->textureStreamer.budgetBytes / Megabytes(1))), Transparent, MonokaiWhite))
+								{
+									uxx newBudget = app->textureStreamer.budgetBytes * 4;
+									if (newBudget > Megabytes(256)) { newBudget = Megabytes(16); }
+									SetTextureStreamerBudget(&app->textureStreamer, newBudget);
+								} Clay__CloseElement();
+								
+								#if FP3D_SCENE_ENABLED
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("BVH: %llu nodes, %llu/%llu visible, %llu lit, pick %s",
+										(u64)app->instanceBvh.nodes.length,
+										(u64)app->visibleInstances.length,
+										(u64)app->instances.count,
+										(u64)app->litInstances.length,
+										(app->mousePickHit.item != BVH_ITEM_INVALID) ? ScratchPrint("#%u", app->mousePickHit.item) : "none"
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Occlusion: %llu occluders, %llu tris, %llu culled",
+										(u64)app->occlusion.numOccluders,
+										(u64)app->occlusion.triangles.length,
+										(u64)app->numOccludedInstances
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Triangles: %llu drawn / %llu full detail (%u LODs on chest)",
+										(u64)app->numTrianglesDrawn,
+										(u64)app->numTrianglesFullDetail,
+										(u32)app->testModel.numLods
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Meshlets: %llu tested, %llu cone, %llu frustum, %llu occluded, %llu tris",
+										(u64)app->meshletStats.numTested,
+										(u64)app->meshletStats.numConeCulled,
+										(u64)app->meshletStats.numFrustumCulled,
+										(u64)app->meshletStats.numOccluded,
+										(u64)(app->meshletStats.numIndicesDrawn / 3)
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Overdraw: ~%.2fx over %.0f%% of screen, %llu items (shaded ~%.2fx)",
+										app->renderQueue.estimatedOverdraw,
+										app->renderQueue.coveredScreenArea * 100.0f,
+										(u64)app->renderQueue.items.length,
+										app->depthPrePassEnabled ? 1.0f : app->renderQueue.estimatedOverdraw
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Staged Draws: %llu draws, %llu applies, %llu material binds skipped",
+										(u64)app->stagedDraws.frameCount,
+										(u64)app->stagedDraws.numApplies,
+										(u64)app->stagedDraws.numMaterialBindsSkipped
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Exposure: x%.3f, estimated average luminance %.3f (adapted %.3f), %s",
+										app->exposure.exposure,
+										app->exposure.averageLuminance,
+										app->exposure.adaptedLuminance,
+										GetTonemapperStr(app->exposure.tonemapper)
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								#endif //FP3D_SCENE_ENABLED
+								
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Text Layouts: %llu cached, %llu hits, %llu built, %llu evictions",
+										(u64)app->textLayoutCache.layouts.length,
+										(u64)app->textLayoutCache.numHits,
+										(u64)app->textLayoutCache.numMisses,
+										(u64)app->textLayoutCache.numEvictions
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Glyph Cache: %llu glyphs, %llu/%d pages, %llu rasterized, %llu queued, %llu fallbacks, %llu evictions",
+										(u64)app->glyphCache.glyphs.length,
+										(u64)app->glyphCache.numPages, GLYPH_CACHE_MAX_PAGES,
+										(u64)app->glyphCache.numRasterized,
+										(u64)app->glyphCache.numPending,
+										(u64)app->glyphCache.numFallbacks,
+										(u64)app->glyphCache.numEvictions
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Textures: %lluKB resident, %llu pending, %llu uploads, %llu evictions, %llu denied",
+										(u64)(app->textureStreamer.residentBytes / Kilobytes(1)),
+										(u64)app->textureStreamer.numPendingRequests,
+										(u64)app->textureStreamer.numUploads,
+										(u64)app->textureStreamer.numEvictions,
+										(u64)app->textureStreamer.numDeniedUploads
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Texture Cache: %llu textures, %llu hits, %lluKB not duplicated",
+										(u64)app->textureCache.numTextures,
+										(u64)app->textureCache.numHits,
+										(u64)(app->textureCache.savedBytes / Kilobytes(1))
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+								{
+									ClayText(ScratchPrint("Atlas: %llu pages, %llu materials (%llu shared), %llu textures merged, %.0f%% full",
+										(u64)app->textureAtlas.pages.length,
+										(u64)app->textureAtlas.numMaterials,
+										(u64)app->textureAtlas.numMaterialsShared,
+										(u64)app->textureAtlas.numTexturesMerged,
+										GetTextureAtlasFillRatio(&app->textureAtlas) * 100.0f
+									), app->clayFont, 12, MonokaiGray1);
+								}
+								
+								if (platformInfo->sokolMemoryStats != nullptr)
+								{
+									const SokolMemoryStats* sokolMem = platformInfo->sokolMemoryStats;
+									CLAY({ .layout = { .padding = CLAY_PADDING_ALL(CLAY_DEF_PADDING*4) } })
+									{
+										ClayText(ScratchPrint("Sokol Mem: %llu allocs %lluKB (peak %lluKB)",
+											(u64)sokolMem->numAllocations,
+											(u64)(sokolMem->numBytesAllocated / Kilobytes(1)),
+											(u64)(sokolMem->highWaterNumBytes / Kilobytes(1))
+										), app->clayFont, 12, MonokaiGray1);
+									}
+								}
+								
 								Clay__CloseElement();
 								Clay__CloseElement();
 							} Clay__CloseElement();
@@ -913,6 +1506,42 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 									app->scissorTestEnabled = !app->scissorTestEnabled;
 								} Clay__CloseElement();
 								
+								if (ClayBtn(ScratchPrint("%s Occlusion Culling", app->occlusionCullingEnabled ? "Disable" : "Enable"), Transparent, app->occlusionCullingEnabled ? MonokaiGreen : MonokaiWhite))
+								{
+									app->occlusionCullingEnabled = !app->occlusionCullingEnabled;
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("%s LODs", app->lodsEnabled ? "Disable" : "Enable"), Transparent, app->lodsEnabled ? MonokaiGreen : MonokaiWhite))
+								{
+									app->lodsEnabled = !app->lodsEnabled;
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("%s Meshlet Culling", app->meshletCullingEnabled ? "Disable" : "Enable"), Transparent, app->meshletCullingEnabled ? MonokaiGreen : MonokaiWhite))
+								{
+									app->meshletCullingEnabled = !app->meshletCullingEnabled;
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("%s Depth Pre-Pass", app->depthPrePassEnabled ? "Disable" : "Enable"), Transparent, app->depthPrePassEnabled ? MonokaiGreen : MonokaiWhite))
+								{
+									app->depthPrePassEnabled = !app->depthPrePassEnabled;
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("Tonemapper: %s", GetTonemapperStr(app->exposure.tonemapper)), Transparent, MonokaiWhite))
+								{
+									app->exposure.tonemapper = (Tonemapper)((app->exposure.tonemapper + 1) % Tonemapper_Count);
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("%s Auto-Exposure", app->exposure.autoExposure ? "Disable" : "Enable"), Transparent, app->exposure.autoExposure ? MonokaiGreen : MonokaiWhite))
+								{
+									app->exposure.autoExposure = !app->exposure.autoExposure;
+								} Clay__CloseElement();
+								
+								if (ClayBtn(ScratchPrint("Exposure Compensation: %+.1f EV", app->exposure.compensationEv), Transparent, MonokaiWhite))
+								{
+									app->exposure.compensationEv += 1.0f;
+									if (app->exposure.compensationEv > 3.0f) { app->exposure.compensationEv = -3.0f; }
+								} Clay__CloseElement();
+								
 								if (ClayBtn("Capture Mouse (F)", Transparent, MonokaiWhite))
 								{
 									platform->SetMouseLocked(true);
@@ -927,22 +1556,22 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 					
 					CLAY({ .layout = { .sizing = { .height=CLAY_SIZING_GROW(0) } } }){}
 					
-					#if FP3D_SCENE_ENABLED
-					Str8 statusText = ScratchPrintStr("WASD=Move Camera     QE=Up/Down     %s     R=Reset     %s=Toggle Topbar",
-						appIn->mouse.isLocked ? "(Press ESC to Release Mouse)" : "F=Capture Mouse",
-						GetKeyStr(CLAY_TOPBAR_TOGGLE_HOTKEY)
-					);
-					#else
-					Str8 statusText = StrLit("Move your mouse!");
-					#endif
+					//Clay only reserves the space, the text is drawn from the layout cache after the Clay commands (see below)
 					CLAY({ .layout = { .padding = { .left=4, .bottom=6 } } })
 					{
-						ClayTextStr(statusText, app->clayFont, 18, Black);
+						CLAY({ .id = statusTextId, .layout = { .sizing = { .width=CLAY_SIZING_FIXED(statusTextSize.Width), .height=CLAY_SIZING_FIXED(statusTextSize.Height) } } }){}
 					}
 				}
 			}
 			Clay_RenderCommandArray clayRenderCommands = EndClayUIRender(&app->clay.clay);
 			RenderClayCommandArray(&app->clay, &gfx, &clayRenderCommands);
+			Clay_ElementData statusTextElement = Clay_GetElementData(statusTextId);
+			if (statusTextElement.found)
+			{
+				//The layout's logicalRec is relative to the pen on the baseline, so this puts its top-left at the element's
+				v2 statusTextPos = NewV2(statusTextElement.boundingBox.x - statusTextLogicalRec.X, statusTextElement.boundingBox.y - statusTextLogicalRec.Y);
+				DrawCachedFontText(&app->textLayoutCache, &app->debugFont, statusText, statusTextPos, 18, statusStyleFlags, Black);
+			}
 			#endif //BUILD_WITH_CLAY
 			
 			#if BUILD_WITH_IMGUI
@@ -994,6 +1623,8 @@ EXPORT_FUNC(AppUpdate) APP_UPDATE_DEF(AppUpdate)
 			#endif
 		}
 	}
+	//Everything that drew from the glyph cache has queued its glyphs by now, they rasterize while the frame is submitted
+	StartGlyphCacheRasters(&app->glyphCache);
 	EndFrame();
 	
 	ScratchEnd(scratch);
@@ -1018,11 +1649,40 @@ EXPORT_FUNC(AppClosing) APP_CLOSING_DEF(AppClosing)
 	igSaveIniSettingsToDisk(app->imgui->io->IniFilename);
 	#endif
 	
+	//Every handle goes back to the cache before the cache (and then the streamer it removes StreamedTextures from) is freed
+	#if FP3D_SCENE_ENABLED
+	ReleaseModelTextures(&app->testModel);
+	#endif
+	ReleaseCachedTexture(&app->textureCache, &app->testTexturePink);
+	ReleaseCachedTexture(&app->textureCache, &app->testTextureBlue);
+	FreeTextureCache(&app->textureCache);
+	FreeTextureAtlas(&app->textureAtlas);
+	FreeTextureStreamer(&app->textureStreamer);
+	FreeGlyphCache(&app->glyphCache); //might still have a batch of glyphs in flight on the jobs
+	FreeJobSystem(&app->jobs);
+	
 	ScratchEnd(scratch);
 	ScratchEnd(scratch2);
 	ScratchEnd(scratch3);
 }
 
+// +==============================+
+// |         AppRunTests          |
+// +==============================+
+// int AppRunTests(PlatformInfo* inPlatformInfo, PlatformApi* inPlatformApi)
+EXPORT_FUNC(AppRunTests) APP_RUN_TESTS_DEF(AppRunTests)
+{
+	#if !BUILD_INTO_SINGLE_UNIT
+	InitScratchArenasVirtual(Gigabytes(4));
+	#endif
+	UpdateDllGlobals(inPlatformInfo, inPlatformApi, nullptr, nullptr);
+	JobSystem jobs = ZEROED;
+	InitJobSystem(stdHeap, 0, &jobs);
+	uxx numFailedTests = RunAppTests(stdHeap, &jobs);
+	FreeJobSystem(&jobs);
+	return (int)numFailedTests;
+}
+
 // +==============================+
 // |          AppGetApi           |
 // +==============================+
@@ -1033,5 +1693,6 @@ EXPORT_FUNC(AppGetApi) APP_GET_API_DEF(AppGetApi)
 	result.AppInit = AppInit;
 	result.AppUpdate = AppUpdate;
 	result.AppClosing = AppClosing;
+	result.AppRunTests = AppRunTests;
 	return result;
 }
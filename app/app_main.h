@@ -12,7 +12,19 @@ struct Model3D
 {
 	ModelData data;
 	VarArray vertBuffers; //VertBuffer
-	VarArray textures; //Texture
+	VarArray textureHandles; //TextureHandle, this model's references in app->textureCache, parallel to data.textures (invalid when only atlased materials use the texture)
+	VarArray textureIds; //u32, the StreamedTexture id behind each of the textureHandles (TEXTURE_STREAM_ID_INVALID for the invalid ones)
+	VarArray materialAtlasEntries; //MaterialAtlasEntry, parallel to data.materials
+	r32 averageAlbedoLuminance; //linear, over every material's albedo texture, only used to estimate exposure
+	VarArray partLocalMats; //mat4, part->transform composed once at load since glTF part transforms are static
+	box localBounds; //all parts, after partLocalMats are applied
+	OccluderMesh occluder;
+	VarArray partLods; //ModelPartLods, parallel to data.parts
+	uxx numLods; //largest numLods of any part
+	uxx lodTriangleCounts[MODEL_MAX_LODS];
+	VarArray partMeshlets; //ModelPartMeshlets, parallel to data.parts
+	VarArray partTangents; //ModelPartTangents, parallel to data.parts
+	uxx numMeshlets;
 };
 
 typedef struct AppData AppData;
@@ -20,11 +32,14 @@ struct AppData
 {
 	bool initialized;
 	RandomSeries random;
+	JobSystem jobs;
 	
 	#if BUILD_WITH_CLAY
 	ClayUIRenderer clay;
 	bool clayTopbarEnabled;
 	u16 clayFont;
+	Str8 statusText; //only re-formatted when statusTextMouseLocked changes
+	bool statusTextMouseLocked;
 	#endif
 	
 	#if BUILD_WITH_IMGUI
@@ -36,9 +51,11 @@ struct AppData
 	
 	sg_pass_action sokolPassAction;
 	Shader main2dShader;
+	Shader main2dSdfShader;
 	#if FP3D_SCENE_ENABLED
 	Shader main3dShader;
 	Shader pbrShader;
+	Shader pbrDepthShader;
 	#endif
 	
 	VertBuffer squareBuffer;
@@ -48,8 +65,8 @@ struct AppData
 	#endif
 	
 	Texture testSprite;
-	Texture testTexturePink;
-	Texture testTextureBlue;
+	TextureHandle testTexturePink;
+	TextureHandle testTextureBlue;
 	
 	#if FP3D_SCENE_ENABLED
 	Texture albedoTexture;
@@ -57,16 +74,47 @@ struct AppData
 	Texture metallicTexture;
 	Texture roughnessTexture;
 	Texture occlusionTexture;
+	Texture dfgLutTexture;
+	Texture flatNormalTexture; //1x1 FLAT_NORMAL_COLOR, bound in place of a normal map for materials that don't have one
 	Model3D testModel;
+	SceneGraph sceneGraph;
+	InstanceStore instances;
+	u32 chestModelId;
+	InstanceHandle chests[TEST_CHEST_GRID_SIZE*TEST_CHEST_GRID_SIZE];
+	Bvh instanceBvh;
+	uxx instanceBvhLayoutVersion;
+	VarArray visibleInstances; //u32
+	VarArray litInstances; //u32
+	BvhRayHit mousePickHit;
+	OcclusionBuffer occlusion;
+	bool occlusionCullingEnabled;
+	uxx numOccludedInstances;
+	bool lodsEnabled;
+	uxx numTrianglesDrawn;
+	uxx numTrianglesFullDetail;
+	bool meshletCullingEnabled;
+	MeshletCullStats meshletStats;
+	RenderQueue renderQueue;
+	StagedDrawList stagedDraws;
+	bool depthPrePassEnabled;
 	#endif //FP3D_SCENE_ENABLED
 	
+	TextureStreamer textureStreamer;
+	TextureCache textureCache;
+	TextureAtlas textureAtlas;
+	ExposureState exposure;
+	
 	Font testFont;
 	Font debugFont;
+	SdfFont sdfFont;
+	GlyphCache glyphCache;
+	TextLayoutCache textLayoutCache;
+	bool sdfTextEnabled;
+	bool glyphCacheTextEnabled;
+	r32 sdfTextSize;
 	v2 textPos;
 	Str8 text;
 	bool textChanged;
-	TextMeasure textMeasure;
-	TextLayout textLayout;
 	
 	#if FP3D_SCENE_ENABLED
 	v3 spherePos;
@@ -97,6 +145,9 @@ struct AppData
 	#if BUILD_WITH_ODE || BUILD_WITH_PHYSX
 	PhysicsWorld* physWorld;
 	#endif
+	#if BUILD_WITH_PHYSX && FP3D_SCENE_ENABLED
+	VarArray physBoxInstances; //InstanceHandle
+	#endif
 };
 
 #endif //  _APP_MAIN_H
@@ -0,0 +1,399 @@
+/*
+File:   app_meshlets.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the meshlet builder and the per-frame cluster culling pass described in app_meshlets.h
+	** NOTE: Meshlets are built by scanning the index buffer in order and starting a new meshlet once
+	** the vertex or triangle limit would be exceeded. glTF exporters generally emit vertex cache
+	** optimized index orders so neighboring triangles end up in the same meshlet without a separate
+	** adjacency pass.
+*/
+
+// +--------------------------------------------------------------+
+// |                           Building                           |
+// +--------------------------------------------------------------+
+static void CalcMeshletBounds(Meshlet* meshlet, const u32* meshletVertices, const u8* meshletTriangles, const Vertex3D* vertices)
+{
+	v3 boundsMin = FillV3(HighestR32);
+	v3 boundsMax = FillV3(LowestR32);
+	for (uxx vIndex = 0; vIndex < meshlet->numVertices; vIndex++)
+	{
+		v3 position = vertices[meshletVertices[vIndex]].position;
+		boundsMin = NewV3(MinR32(boundsMin.X, position.X), MinR32(boundsMin.Y, position.Y), MinR32(boundsMin.Z, position.Z));
+		boundsMax = NewV3(MaxR32(boundsMax.X, position.X), MaxR32(boundsMax.Y, position.Y), MaxR32(boundsMax.Z, position.Z));
+	}
+	meshlet->center = Mul(Add(boundsMin, boundsMax), 0.5f);
+	r32 radiusSquared = 0.0f;
+	for (uxx vIndex = 0; vIndex < meshlet->numVertices; vIndex++)
+	{
+		radiusSquared = MaxR32(radiusSquared, LengthSquared(Sub(vertices[meshletVertices[vIndex]].position, meshlet->center)));
+	}
+	meshlet->radius = SqrtR32(radiusSquared);
+	
+	v3 normals[MESHLET_MAX_TRIANGLES];
+	uxx numNormals = 0;
+	v3 normalSum = V3_Zero;
+	for (uxx tIndex = 0; tIndex < meshlet->numTriangles; tIndex++)
+	{
+		v3 pos0 = vertices[meshletVertices[meshletTriangles[tIndex*3 + 0]]].position;
+		v3 pos1 = vertices[meshletVertices[meshletTriangles[tIndex*3 + 1]]].position;
+		v3 pos2 = vertices[meshletVertices[meshletTriangles[tIndex*3 + 2]]].position;
+		v3 edge0 = Sub(pos1, pos0);
+		v3 edge1 = Sub(pos2, pos0);
+		v3 normal = NewV3(edge0.Y*edge1.Z - edge0.Z*edge1.Y, edge0.Z*edge1.X - edge0.X*edge1.Z, edge0.X*edge1.Y - edge0.Y*edge1.X);
+		r32 normalLength = Length(normal);
+		if (normalLength <= 1e-12f) { continue; }
+		normals[numNormals] = Mul(normal, 1.0f / normalLength);
+		normalSum = Add(normalSum, normals[numNormals]);
+		numNormals++;
+	}
+	
+	meshlet->coneAxis = V3_Zero;
+	meshlet->coneCutoff = 1.0f;
+	r32 normalSumLength = Length(normalSum);
+	if (numNormals == 0 || normalSumLength <= 1e-6f) { return; }
+	meshlet->coneAxis = Mul(normalSum, 1.0f / normalSumLength);
+	r32 minDot = 1.0f;
+	for (uxx nIndex = 0; nIndex < numNormals; nIndex++)
+	{
+		v3 normal = normals[nIndex];
+		minDot = MinR32(minDot, normal.X*meshlet->coneAxis.X + normal.Y*meshlet->coneAxis.Y + normal.Z*meshlet->coneAxis.Z);
+	}
+	if (minDot <= MESHLET_MIN_CONE_DOT) { return; }
+	meshlet->coneCutoff = SqrtR32(1.0f - minDot*minDot);
+}
+
+// indices may be nullptr for non-indexed parts. Degenerate triangles are dropped
+ModelPartMeshlets BuildMeshlets(Arena* arena, const Vertex3D* vertices, uxx numVertices, const u32* indices, uxx numIndices)
+{
+	NotNull(arena);
+	Assert((numIndices % 3) == 0);
+	ScratchBegin1(scratch, arena);
+	ModelPartMeshlets result = ZEROED;
+	
+	u8* vertexSlots = AllocArray(u8, scratch, numVertices);
+	Meshlet* meshlets = AllocArray(Meshlet, scratch, numIndices/3 + 1);
+	u32* meshletVertices = AllocArray(u32, scratch, numIndices);
+	u8* meshletTriangles = AllocArray(u8, scratch, numIndices);
+	NotNull(vertexSlots);
+	NotNull(meshlets);
+	NotNull(meshletVertices);
+	NotNull(meshletTriangles);
+	MyMemSet(vertexSlots, 0xFF, sizeof(u8) * numVertices);
+	
+	Meshlet* current = &meshlets[0];
+	ClearPointer(current);
+	for (uxx iIndex = 0; iIndex < numIndices; iIndex += 3)
+	{
+		u32 triVerts[3];
+		for (uxx corner = 0; corner < 3; corner++) { triVerts[corner] = (indices != nullptr) ? indices[iIndex + corner] : (u32)(iIndex + corner); }
+		if (triVerts[0] == triVerts[1] || triVerts[1] == triVerts[2] || triVerts[2] == triVerts[0]) { continue; }
+		uxx numNewVertices = 0;
+		for (uxx corner = 0; corner < 3; corner++) { if (vertexSlots[triVerts[corner]] == 0xFF) { numNewVertices++; } }
+		
+		if (current->numVertices + numNewVertices > MESHLET_MAX_VERTICES || current->numTriangles + 1 > MESHLET_MAX_TRIANGLES)
+		{
+			for (uxx vIndex = 0; vIndex < current->numVertices; vIndex++) { vertexSlots[meshletVertices[current->vertexOffset + vIndex]] = 0xFF; }
+			result.numMeshlets++;
+			Meshlet* next = &meshlets[result.numMeshlets];
+			ClearPointer(next);
+			next->vertexOffset = current->vertexOffset + current->numVertices;
+			next->triangleOffset = current->triangleOffset + current->numTriangles;
+			current = next;
+		}
+		
+		for (uxx corner = 0; corner < 3; corner++)
+		{
+			if (vertexSlots[triVerts[corner]] == 0xFF)
+			{
+				vertexSlots[triVerts[corner]] = (u8)current->numVertices;
+				meshletVertices[current->vertexOffset + current->numVertices] = triVerts[corner];
+				current->numVertices++;
+			}
+			meshletTriangles[(current->triangleOffset + current->numTriangles)*3 + corner] = vertexSlots[triVerts[corner]];
+		}
+		current->numTriangles++;
+	}
+	if (current->numTriangles > 0) { result.numMeshlets++; }
+	
+	if (result.numMeshlets > 0)
+	{
+		Meshlet* lastMeshlet = &meshlets[result.numMeshlets-1];
+		result.numVertices = lastMeshlet->vertexOffset + lastMeshlet->numVertices;
+		result.numTriangles = lastMeshlet->triangleOffset + lastMeshlet->numTriangles;
+		result.numIndices = result.numTriangles * 3;
+		result.meshlets = AllocArray(Meshlet, arena, result.numMeshlets);
+		result.vertices = AllocArray(u32, arena, result.numVertices);
+		result.triangles = AllocArray(u8, arena, result.numTriangles * 3);
+		NotNull(result.meshlets);
+		NotNull(result.vertices);
+		NotNull(result.triangles);
+		MyMemCopy(result.vertices, meshletVertices, sizeof(u32) * result.numVertices);
+		MyMemCopy(result.triangles, meshletTriangles, sizeof(u8) * result.numTriangles * 3);
+		for (uxx mIndex = 0; mIndex < result.numMeshlets; mIndex++)
+		{
+			Meshlet* meshlet = &result.meshlets[mIndex];
+			*meshlet = meshlets[mIndex];
+			meshlet->firstIndex = meshlet->triangleOffset * 3;
+			CalcMeshletBounds(meshlet, &result.vertices[meshlet->vertexOffset], &result.triangles[meshlet->triangleOffset * 3], vertices);
+		}
+	}
+	
+	ScratchEnd(scratch);
+	return result;
+}
+
+// The index buffer a part should be uploaded with so every Meshlet->firstIndex lines up
+i32* GetMeshletOrderedIndices(Arena* arena, const ModelPartMeshlets* partMeshlets)
+{
+	NotNull(arena);
+	NotNull(partMeshlets);
+	i32* result = AllocArray(i32, arena, partMeshlets->numIndices);
+	NotNull(result);
+	for (uxx mIndex = 0; mIndex < partMeshlets->numMeshlets; mIndex++)
+	{
+		const Meshlet* meshlet = &partMeshlets->meshlets[mIndex];
+		for (uxx iIndex = 0; iIndex < meshlet->numTriangles * 3; iIndex++)
+		{
+			u8 localIndex = partMeshlets->triangles[meshlet->triangleOffset*3 + iIndex];
+			result[meshlet->firstIndex + iIndex] = (i32)partMeshlets->vertices[meshlet->vertexOffset + localIndex];
+		}
+	}
+	return result;
+}
+
+// Fills model->partMeshlets for every part that has at least MESHLET_MIN_PART_TRIANGLES triangles
+void BuildModelMeshlets(Arena* arena, Model3D* model)
+{
+	NotNull(arena);
+	NotNull(model);
+	ScratchBegin1(scratch, arena);
+	InitVarArrayWithInitial(ModelPartMeshlets, &model->partMeshlets, arena, model->data.parts.length);
+	model->numMeshlets = 0;
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+		ModelPartMeshlets* partMeshlets = VarArrayAdd(ModelPartMeshlets, &model->partMeshlets);
+		NotNull(partMeshlets);
+		ClearPointer(partMeshlets);
+		uxx numIndices = (part->indices.length > 0) ? part->indices.length : part->vertices.length;
+		partMeshlets->numIndices = numIndices;
+		if (numIndices / 3 < MESHLET_MIN_PART_TRIANGLES) { continue; }
+		
+		u32* indices = nullptr;
+		if (part->indices.length > 0)
+		{
+			indices = AllocArray(u32, scratch, numIndices);
+			NotNull(indices);
+			for (uxx iIndex = 0; iIndex < numIndices; iIndex++) { indices[iIndex] = (u32)((const i32*)part->indices.items)[iIndex]; }
+		}
+		*partMeshlets = BuildMeshlets(arena, (const Vertex3D*)part->vertices.items, part->vertices.length, indices, numIndices - (numIndices % 3));
+		model->numMeshlets += partMeshlets->numMeshlets;
+	}
+	ScratchEnd(scratch);
+}
+
+// +--------------------------------------------------------------+
+// |                           Culling                            |
+// +--------------------------------------------------------------+
+// Ranges before firstMergeableRange belong to other draws (e.g. other instances in a RenderQueue) and are never extended
+static void AddMeshletDrawRange(VarArray* rangesOut, uxx firstMergeableRange, u32 partIndex, u32 firstIndex, u32 numIndices)
+{
+	if (rangesOut->length > firstMergeableRange)
+	{
+		MeshletDrawRange* lastRange = VarArrayGetHard(MeshletDrawRange, rangesOut, rangesOut->length-1);
+		if (lastRange->partIndex == partIndex && lastRange->firstIndex + lastRange->numIndices == firstIndex)
+		{
+			lastRange->numIndices += numIndices;
+			return;
+		}
+	}
+	MeshletDrawRange* newRange = VarArrayAdd(MeshletDrawRange, rangesOut);
+	NotNull(newRange);
+	newRange->partIndex = partIndex;
+	newRange->firstIndex = firstIndex;
+	newRange->numIndices = numIndices;
+}
+
+// Per part values every chunk of that part needs, worked out once on the calling thread
+typedef struct MeshletPartCullInfo MeshletPartCullInfo;
+struct MeshletPartCullInfo
+{
+	const mat4* worldMat;
+	v3 columns[3];
+	r32 maxScale;
+	bool canConeCull;
+	bool isMirrored;
+};
+
+// A run of up to MESHLET_CULL_CHUNK_SIZE meshlets from one part. Parts without meshlets get a
+// chunk with numMeshlets = 0 so that walking the chunks in order visits every part in order
+typedef struct MeshletCullChunk MeshletCullChunk;
+struct MeshletCullChunk
+{
+	u32 partIndex;
+	u32 firstMeshlet;
+	u32 numMeshlets;
+	u32 numSurvivors;
+	u32* survivors; //MESHLET_CULL_CHUNK_SIZE slots, indices of the meshlets that passed every test
+	MeshletCullStats stats;
+};
+
+typedef struct MeshletCullJobs MeshletCullJobs;
+struct MeshletCullJobs
+{
+	u8 cullFlags;
+	const BvhFrustum* frustum;
+	v3 cameraPos;
+	OcclusionBuffer* occlusion;
+	mat4 viewProjMat;
+	const ModelPartMeshlets* partMeshlets; //model->partMeshlets.items
+	const MeshletPartCullInfo* partInfos;
+	MeshletCullChunk* chunks;
+};
+
+// Only reads the model, frustum and OcclusionBuffer and only writes to its own chunk
+static JOB_FUNC_DEF(CullMeshletChunkJob)
+{
+	MeshletCullJobs* context = (MeshletCullJobs*)userPntr;
+	MeshletCullChunk* chunk = &context->chunks[jobIndex];
+	const MeshletPartCullInfo* partInfo = &context->partInfos[chunk->partIndex];
+	const ModelPartMeshlets* partMeshlets = &context->partMeshlets[chunk->partIndex];
+	for (u32 mIndex = chunk->firstMeshlet; mIndex < chunk->firstMeshlet + chunk->numMeshlets; mIndex++)
+	{
+		const Meshlet* meshlet = &partMeshlets->meshlets[mIndex];
+		chunk->stats.numTested++;
+		v3 center = TransformPointByMat4(partInfo->worldMat, meshlet->center);
+		r32 radius = meshlet->radius * partInfo->maxScale;
+		
+		if (partInfo->canConeCull && meshlet->coneCutoff < 1.0f)
+		{
+			v3 axis = Add(Add(Mul(partInfo->columns[0], meshlet->coneAxis.X), Mul(partInfo->columns[1], meshlet->coneAxis.Y)), Mul(partInfo->columns[2], meshlet->coneAxis.Z));
+			axis = Mul(axis, (partInfo->isMirrored ? -1.0f : 1.0f) / partInfo->maxScale);
+			v3 toCenter = Sub(center, context->cameraPos);
+			if (toCenter.X*axis.X + toCenter.Y*axis.Y + toCenter.Z*axis.Z >= meshlet->coneCutoff * Length(toCenter) + radius)
+			{
+				chunk->stats.numConeCulled++;
+				continue;
+			}
+		}
+		
+		if (IsFlagSet(context->cullFlags, MeshletCullFlag_Frustum))
+		{
+			bool outside = false;
+			for (uxx planeIndex = 0; planeIndex < 6 && !outside; planeIndex++)
+			{
+				v4 plane = context->frustum->planes[planeIndex];
+				if (plane.X*center.X + plane.Y*center.Y + plane.Z*center.Z + plane.W < -radius) { outside = true; }
+			}
+			if (outside) { chunk->stats.numFrustumCulled++; continue; }
+		}
+		
+		if (IsFlagSet(context->cullFlags, MeshletCullFlag_Occlusion))
+		{
+			box sphereBounds = NewBoxV(Sub(center, FillV3(radius)), FillV3(radius * 2.0f));
+			if (!IsBoxVisibleInOcclusionBuffer(context->occlusion, context->viewProjMat, sphereBounds)) { chunk->stats.numOccluded++; continue; }
+		}
+		
+		chunk->survivors[chunk->numSurvivors++] = mIndex;
+		chunk->stats.numIndicesDrawn += meshlet->numTriangles * 3;
+	}
+}
+
+// Tests every meshlet of the model against the camera and appends the index ranges that survived to
+// rangesOut, merging neighboring meshlets into one range. Parts that have no meshlets are appended
+// whole. occlusion is only used when cullFlags has MeshletCullFlag_Occlusion and may be nullptr otherwise.
+// The meshlets are tested in chunks on the job system, the surviving ranges are merged afterwards in
+// part and meshlet order so the result is the same no matter how the chunks were scheduled
+void CullModelMeshlets(JobSystem* jobs, const Model3D* model, const SceneGraph* graph, u32 rootIndex, u8 cullFlags, const BvhFrustum* frustum, v3 cameraPos, OcclusionBuffer* occlusion, mat4 viewProjMat, VarArray* rangesOut, MeshletCullStats* stats)
+{
+	NotNull(model);
+	NotNull(graph);
+	NotNull(frustum);
+	NotNull(rangesOut);
+	NotNull(stats);
+	Assert(occlusion != nullptr || !IsFlagSet(cullFlags, MeshletCullFlag_Occlusion));
+	ScratchBegin1(scratch, rangesOut->arena);
+	MeshletCullJobs context = ZEROED;
+	context.partMeshlets = (const ModelPartMeshlets*)model->partMeshlets.items;
+	context.cullFlags = cullFlags;
+	context.frustum = frustum;
+	context.cameraPos = cameraPos;
+	context.occlusion = occlusion;
+	context.viewProjMat = viewProjMat;
+	
+	uxx numChunks = 0;
+	MeshletPartCullInfo* partInfos = AllocArray(MeshletPartCullInfo, scratch, MaxUXX(model->partMeshlets.length, 1));
+	NotNull(partInfos);
+	VarArrayLoop(&model->partMeshlets, pIndex)
+	{
+		VarArrayLoopGet(ModelPartMeshlets, partMeshlets, &model->partMeshlets, pIndex);
+		numChunks += MaxUXX((partMeshlets->numMeshlets + MESHLET_CULL_CHUNK_SIZE-1) / MESHLET_CULL_CHUNK_SIZE, 1);
+		if (partMeshlets->numMeshlets == 0) { continue; }
+		
+		MeshletPartCullInfo* partInfo = &partInfos[pIndex];
+		partInfo->worldMat = &graph->worldMats[rootIndex + 1 + pIndex];
+		for (uxx cIndex = 0; cIndex < 3; cIndex++)
+		{
+			partInfo->columns[cIndex] = NewV3(partInfo->worldMat->Elements[cIndex][0], partInfo->worldMat->Elements[cIndex][1], partInfo->worldMat->Elements[cIndex][2]);
+		}
+		v3 column0 = partInfo->columns[0], column1 = partInfo->columns[1], column2 = partInfo->columns[2];
+		r32 scale0 = Length(column0), scale1 = Length(column1), scale2 = Length(column2);
+		partInfo->maxScale = MaxR32(scale0, MaxR32(scale1, scale2));
+		r32 minScale = MinR32(scale0, MinR32(scale1, scale2));
+		//Non-uniform scale skews the normals so the cones can't be trusted anymore
+		partInfo->canConeCull = (IsFlagSet(cullFlags, MeshletCullFlag_Cone) && minScale > 0.0f && partInfo->maxScale / minScale < 1.01f);
+		partInfo->isMirrored = (column0.X*(column1.Y*column2.Z - column1.Z*column2.Y) - column0.Y*(column1.X*column2.Z - column1.Z*column2.X) + column0.Z*(column1.X*column2.Y - column1.Y*column2.X)) < 0.0f;
+	}
+	context.partInfos = partInfos;
+	
+	context.chunks = AllocArray(MeshletCullChunk, scratch, MaxUXX(numChunks, 1));
+	u32* survivors = AllocArray(u32, scratch, MaxUXX(numChunks, 1) * MESHLET_CULL_CHUNK_SIZE);
+	NotNull(context.chunks);
+	NotNull(survivors);
+	uxx chunkIndex = 0;
+	VarArrayLoop(&model->partMeshlets, pIndex)
+	{
+		VarArrayLoopGet(ModelPartMeshlets, partMeshlets, &model->partMeshlets, pIndex);
+		uxx meshletIndex = 0;
+		do
+		{
+			MeshletCullChunk* chunk = &context.chunks[chunkIndex];
+			ClearPointer(chunk);
+			chunk->partIndex = (u32)pIndex;
+			chunk->firstMeshlet = (u32)meshletIndex;
+			chunk->numMeshlets = (u32)MinUXX(partMeshlets->numMeshlets - meshletIndex, MESHLET_CULL_CHUNK_SIZE);
+			chunk->survivors = &survivors[chunkIndex * MESHLET_CULL_CHUNK_SIZE];
+			meshletIndex += chunk->numMeshlets;
+			chunkIndex++;
+		} while (meshletIndex < partMeshlets->numMeshlets);
+	}
+	Assert(chunkIndex == numChunks);
+	
+	RunJobs(jobs, numChunks, CullMeshletChunkJob, &context);
+	
+	uxx firstRange = rangesOut->length;
+	for (uxx cIndex = 0; cIndex < numChunks; cIndex++)
+	{
+		const MeshletCullChunk* chunk = &context.chunks[cIndex];
+		const ModelPartMeshlets* partMeshlets = &context.partMeshlets[chunk->partIndex];
+		if (partMeshlets->numMeshlets == 0)
+		{
+			if (partMeshlets->numIndices > 0) { AddMeshletDrawRange(rangesOut, firstRange, chunk->partIndex, 0, (u32)partMeshlets->numIndices); }
+			stats->numIndicesDrawn += partMeshlets->numIndices;
+			continue;
+		}
+		for (uxx sIndex = 0; sIndex < chunk->numSurvivors; sIndex++)
+		{
+			const Meshlet* meshlet = &partMeshlets->meshlets[chunk->survivors[sIndex]];
+			AddMeshletDrawRange(rangesOut, firstRange, chunk->partIndex, meshlet->firstIndex, meshlet->numTriangles * 3);
+		}
+		stats->numTested += chunk->stats.numTested;
+		stats->numConeCulled += chunk->stats.numConeCulled;
+		stats->numFrustumCulled += chunk->stats.numFrustumCulled;
+		stats->numOccluded += chunk->stats.numOccluded;
+		stats->numIndicesDrawn += chunk->stats.numIndicesDrawn;
+	}
+	ScratchEnd(scratch);
+}
@@ -0,0 +1,76 @@
+/*
+File:   app_meshlets.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Splits the parts of large models into small clusters of triangles (meshlets) at load time.
+	** Each meshlet has a bounding sphere and a normal cone so the CPU can throw away clusters that
+	** are outside the frustum, completely back-facing or hidden in the OcclusionBuffer. The part's
+	** index buffer is uploaded in meshlet order so the surviving clusters turn into a short list of
+	** index ranges (MeshletDrawRange) that are drawn straight out of the static buffer.
+*/
+
+#ifndef _APP_MESHLETS_H
+#define _APP_MESHLETS_H
+
+#define MESHLET_MAX_VERTICES        64
+#define MESHLET_MAX_TRIANGLES       124
+#define MESHLET_MIN_PART_TRIANGLES  512 //smaller parts are always drawn whole
+#define MESHLET_MIN_CONE_DOT        0.1f //meshlets whose normals spread wider than this never get cone culled
+#define MESHLET_CULL_CHUNK_SIZE     64 //CullModelMeshlets hands meshlets to the job system in chunks of this many
+
+typedef enum MeshletCullFlag MeshletCullFlag;
+enum MeshletCullFlag
+{
+	MeshletCullFlag_None      = 0x00,
+	MeshletCullFlag_Cone      = 0x01, //assumes counter-clockwise front faces and single sided materials
+	MeshletCullFlag_Frustum   = 0x02,
+	MeshletCullFlag_Occlusion = 0x04,
+	MeshletCullFlag_All       = 0x07,
+};
+
+typedef struct Meshlet Meshlet;
+struct Meshlet
+{
+	u32 vertexOffset; //into ModelPartMeshlets->vertices
+	u32 triangleOffset; //into ModelPartMeshlets->triangles, in triangles (3 bytes each)
+	u32 numVertices;
+	u32 numTriangles;
+	u32 firstIndex; //where the meshlet starts in the part's meshlet ordered index buffer
+	v3 center; //bounding sphere in part local space
+	r32 radius;
+	v3 coneAxis; //average facing direction of the triangles
+	r32 coneCutoff; //sin of the cone's half angle, 1 when the cone is too wide to be useful
+};
+
+typedef struct ModelPartMeshlets ModelPartMeshlets;
+struct ModelPartMeshlets
+{
+	uxx numMeshlets; //0 when the part was too small to split
+	Meshlet* meshlets;
+	uxx numVertices;
+	u32* vertices; //indices into the part's vertices
+	uxx numTriangles;
+	u8* triangles; //indices into the meshlet's slice of vertices
+	uxx numIndices; //total indices in the part's VertBuffer
+};
+
+typedef struct MeshletDrawRange MeshletDrawRange;
+struct MeshletDrawRange
+{
+	u32 partIndex;
+	u32 firstIndex;
+	u32 numIndices;
+};
+
+typedef struct MeshletCullStats MeshletCullStats;
+struct MeshletCullStats
+{
+	uxx numTested;
+	uxx numConeCulled;
+	uxx numFrustumCulled;
+	uxx numOccluded;
+	uxx numIndicesDrawn;
+};
+
+#endif //  _APP_MESHLETS_H
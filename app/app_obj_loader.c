@@ -0,0 +1,1228 @@
+/*
+File:   app_obj_loader.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the OBJ/MTL parsing, the chunk merge and the OBJ benchmark (see app_obj_loader.h)
+	** NOTE: Line ends are found 16 bytes at a time with SSE2 (reusing the SIMD target detection from
+	** app_trs_kernels.h) or 8 bytes at a time in a u64 on other targets, and runs of digits are converted
+	** to numbers 8 at a time in a u64. Both of those assume a little-endian target.
+*/
+
+// +--------------------------------------------------------------+
+// |                           Scanning                           |
+// +--------------------------------------------------------------+
+#define OBJ_SWAR_ONES    0x0101010101010101ULL
+#define OBJ_SWAR_HIGHS   0x8080808080808080ULL
+#define OBJ_SWAR_ZEROS   0x3030303030303030ULL //'0' in every byte
+#define OBJ_SWAR_NIBBLES 0xF0F0F0F0F0F0F0F0ULL
+
+static const u64 ObjDigitScales[] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL };
+//Every power of 10 up to 10^22 is exactly representable as a double
+static const r64 ObjPowersOf10[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static inline bool IsObjSpace(char c) { return (c == ' ' || c == '\t' || c == '\r'); }
+static inline bool IsObjDigit(char c) { return ((u8)(c - '0') < 10); }
+
+// Returns the position of the next '\n' at or after pntr, or end when there isn't one
+static inline const char* FindObjLineEnd(const char* pntr, const char* end)
+{
+	#if TRS_SIMD_AVX || TRS_SIMD_SSE
+	__m128i newlines = _mm_set1_epi8('\n');
+	while (end - pntr >= 16)
+	{
+		u32 mask = (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)pntr), newlines));
+		if (mask != 0)
+		{
+			while ((mask & 1) == 0) { mask >>= 1; pntr++; }
+			return pntr;
+		}
+		pntr += 16;
+	}
+	#else
+	while (end - pntr >= 8)
+	{
+		u64 word = 0;
+		MyMemCopy(&word, pntr, sizeof(word));
+		word ^= OBJ_SWAR_ONES * (u64)'\n'; //bytes that were '\n' are now 0
+		if (((word - OBJ_SWAR_ONES) & ~word & OBJ_SWAR_HIGHS) != 0) { break; }
+		pntr += 8;
+	}
+	#endif
+	while (pntr < end && *pntr != '\n') { pntr++; }
+	return pntr;
+}
+
+// How many of the word's bytes (starting from the lowest, which is the first character) are '0'-'9'
+static inline u32 CountObjDigitBytes(u64 word)
+{
+	u64 nonDigits = ((word & OBJ_SWAR_NIBBLES) ^ OBJ_SWAR_ZEROS) | (((word + 0x0606060606060606ULL) & OBJ_SWAR_NIBBLES) ^ OBJ_SWAR_ZEROS);
+	u32 result = 0;
+	while (result < 8 && ((nonDigits >> (result * 8)) & 0xFF) == 0) { result++; }
+	return result;
+}
+
+// Converts 8 ASCII digits (first digit in the lowest byte) to their value with 3 multiplies instead of 8
+static inline u32 ParseEightObjDigits(u64 word)
+{
+	word -= OBJ_SWAR_ZEROS;
+	word = (word * 10) + (word >> 8);
+	word = (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) + (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+	return (u32)word;
+}
+
+// Appends a run of digits to the mantissa. numDigitsOut is how many digits were consumed and numDroppedOut is how
+// many of those didn't fit under OBJ_MAX_MANTISSA (the caller moves the exponent for them instead)
+static inline void ParseObjDigits(const char** pntrPntr, const char* end, u64* mantissa, uxx* numDigitsOut, uxx* numDroppedOut)
+{
+	const char* pntr = *pntrPntr;
+	uxx numDigits = 0;
+	uxx numDropped = 0;
+	while (end - pntr >= 8 && *mantissa < 10000000000ULL) //so 8 more digits still stay under OBJ_MAX_MANTISSA
+	{
+		u64 word = 0;
+		MyMemCopy(&word, pntr, sizeof(word));
+		u32 count = CountObjDigitBytes(word);
+		if (count == 0) { break; }
+		//Move the digits to the top and fill the bottom with '0's, leading zeros don't change the value
+		if (count < 8) { word = (word << ((8 - count) * 8)) | (OBJ_SWAR_ZEROS >> (count * 8)); }
+		*mantissa = (*mantissa * ObjDigitScales[count]) + ParseEightObjDigits(word);
+		pntr += count;
+		numDigits += count;
+		if (count < 8) { break; }
+	}
+	while (pntr < end && IsObjDigit(*pntr))
+	{
+		if (*mantissa < OBJ_MAX_MANTISSA) { *mantissa = (*mantissa * 10) + (u64)(*pntr - '0'); }
+		else { numDropped++; }
+		pntr++;
+		numDigits++;
+	}
+	*pntrPntr = pntr;
+	*numDigitsOut = numDigits;
+	*numDroppedOut = numDropped;
+}
+
+// Parses [+-]digits[.digits][(e|E)[+-]digits] after any leading whitespace. The mantissa is scaled by an exact power
+// of 10 in a double, which is correctly rounded for anything with up to 15 significant digits (every coordinate a
+// real file has), then rounded to r32
+static inline bool ParseObjFloat(const char** pntrPntr, const char* end, r32* valueOut)
+{
+	const char* pntr = *pntrPntr;
+	while (pntr < end && IsObjSpace(*pntr)) { pntr++; }
+	bool isNegative = false;
+	if (pntr < end && (*pntr == '-' || *pntr == '+')) { isNegative = (*pntr == '-'); pntr++; }
+	
+	u64 mantissa = 0;
+	uxx numIntDigits = 0;
+	uxx numIntDropped = 0;
+	ParseObjDigits(&pntr, end, &mantissa, &numIntDigits, &numIntDropped);
+	i32 exponent = (i32)numIntDropped;
+	uxx numFracDigits = 0;
+	if (pntr < end && *pntr == '.')
+	{
+		pntr++;
+		uxx numFracDropped = 0;
+		ParseObjDigits(&pntr, end, &mantissa, &numFracDigits, &numFracDropped);
+		exponent -= (i32)(numFracDigits - numFracDropped);
+	}
+	if (numIntDigits + numFracDigits == 0) { return false; }
+	if (pntr < end && (*pntr == 'e' || *pntr == 'E'))
+	{
+		const char* exponentPntr = pntr + 1;
+		bool isExponentNegative = false;
+		if (exponentPntr < end && (*exponentPntr == '-' || *exponentPntr == '+')) { isExponentNegative = (*exponentPntr == '-'); exponentPntr++; }
+		if (exponentPntr < end && IsObjDigit(*exponentPntr))
+		{
+			i32 exponentValue = 0;
+			for (; exponentPntr < end && IsObjDigit(*exponentPntr); exponentPntr++)
+			{
+				if (exponentValue < 10000) { exponentValue = (exponentValue * 10) + (*exponentPntr - '0'); }
+			}
+			exponent += isExponentNegative ? -exponentValue : exponentValue;
+			pntr = exponentPntr;
+		}
+	}
+	
+	r64 value = (r64)mantissa;
+	if (mantissa != 0)
+	{
+		for (; exponent > 22; exponent -= 22) { value *= ObjPowersOf10[22]; }
+		for (; exponent < -22; exponent += 22) { value /= ObjPowersOf10[22]; }
+		value = (exponent >= 0) ? (value * ObjPowersOf10[exponent]) : (value / ObjPowersOf10[-exponent]);
+	}
+	*valueOut = (r32)(isNegative ? -value : value);
+	*pntrPntr = pntr;
+	return true;
+}
+
+// Face indices, returns false when there's no number here
+static inline bool ParseObjInt(const char** pntrPntr, const char* end, i64* valueOut)
+{
+	const char* pntr = *pntrPntr;
+	bool isNegative = false;
+	if (pntr < end && (*pntr == '-' || *pntr == '+')) { isNegative = (*pntr == '-'); pntr++; }
+	if (pntr >= end || !IsObjDigit(*pntr)) { return false; }
+	i64 value = 0;
+	for (; pntr < end && IsObjDigit(*pntr); pntr++)
+	{
+		if (value <= INT32_MAX) { value = (value * 10) + (*pntr - '0'); }
+	}
+	*valueOut = isNegative ? -value : value;
+	*pntrPntr = pntr;
+	return true;
+}
+
+// Everything after the keyword with the surrounding whitespace trimmed off
+static inline Str8 GetObjLineRest(const char* pntr, const char* end)
+{
+	while (pntr < end && IsObjSpace(*pntr)) { pntr++; }
+	while (end > pntr && IsObjSpace(end[-1])) { end--; }
+	return NewStr8((uxx)(end - pntr), (char*)pntr);
+}
+
+static inline bool IsObjKeyword(const char* pntr, const char* end, const char* keyword)
+{
+	uxx keywordLength = MyStrLength64(keyword);
+	if ((uxx)(end - pntr) < keywordLength) { return false; }
+	if (MyMemCompare(pntr, keyword, keywordLength) != 0) { return false; }
+	return ((uxx)(end - pntr) == keywordLength || IsObjSpace(pntr[keywordLength]));
+}
+
+static inline bool AreObjNamesEqual(Str8 left, Str8 right)
+{
+	return (left.length == right.length && (left.length == 0 || MyMemCompare(left.chars, right.chars, left.length) == 0));
+}
+
+// +--------------------------------------------------------------+
+// |                            Chunks                            |
+// +--------------------------------------------------------------+
+void FreeObjChunk(ObjChunk* chunk)
+{
+	NotNull(chunk);
+	if (chunk->arena != nullptr)
+	{
+		FreeVarArray(&chunk->positions);
+		FreeVarArray(&chunk->colors);
+		FreeVarArray(&chunk->texCoords);
+		FreeVarArray(&chunk->normals);
+		FreeVarArray(&chunk->corners);
+		FreeVarArray(&chunk->materialRuns);
+		FreeVarArray(&chunk->materialLibs);
+	}
+	ClearPointer(chunk);
+}
+
+// Positive indices are 1-based and absolute, negative ones count back from the last element seen so far. Those can
+// only be resolved relative to the chunk here (numSoFar is the chunk's own count), the merge adds the chunk's base
+static inline bool ResolveObjIndex(i64 value, uxx numSoFar, u32 attribIndex, ObjCorner* corner)
+{
+	if (value > 0 && value <= INT32_MAX) { corner->indices[attribIndex] = (i32)(value - 1); return true; }
+	if (value < 0 && value >= -(i64)INT32_MAX)
+	{
+		corner->indices[attribIndex] = (i32)((i64)numSoFar + value);
+		corner->relativeMask |= (1u << attribIndex);
+		return true;
+	}
+	return false;
+}
+
+static void ParseObjFaceLine(ObjChunk* chunk, const char* pntr, const char* end)
+{
+	uxx numCornersBefore = chunk->corners.length;
+	ObjCorner firstCorner = ZEROED;
+	ObjCorner prevCorner = ZEROED;
+	uxx numCorners = 0;
+	bool isValid = true;
+	while (isValid)
+	{
+		while (pntr < end && IsObjSpace(*pntr)) { pntr++; }
+		if (pntr >= end) { break; }
+		ObjCorner corner = ZEROED;
+		corner.indices[0] = OBJ_INDEX_NONE;
+		corner.indices[1] = OBJ_INDEX_NONE;
+		corner.indices[2] = OBJ_INDEX_NONE;
+		i64 value = 0;
+		isValid = (ParseObjInt(&pntr, end, &value) && ResolveObjIndex(value, chunk->positions.length, 0, &corner));
+		if (isValid && pntr < end && *pntr == '/')
+		{
+			pntr++;
+			if (pntr < end && *pntr != '/') { isValid = (ParseObjInt(&pntr, end, &value) && ResolveObjIndex(value, chunk->texCoords.length, 1, &corner)); }
+			if (isValid && pntr < end && *pntr == '/')
+			{
+				pntr++;
+				isValid = (ParseObjInt(&pntr, end, &value) && ResolveObjIndex(value, chunk->normals.length, 2, &corner));
+			}
+		}
+		if (isValid && pntr < end && !IsObjSpace(*pntr)) { isValid = false; }
+		if (!isValid) { break; }
+		
+		//Polygons are fanned around their first corner
+		if (numCorners == 0) { firstCorner = corner; }
+		else if (numCorners >= 2)
+		{
+			*VarArrayAdd(ObjCorner, &chunk->corners) = firstCorner;
+			*VarArrayAdd(ObjCorner, &chunk->corners) = prevCorner;
+			*VarArrayAdd(ObjCorner, &chunk->corners) = corner;
+		}
+		prevCorner = corner;
+		numCorners++;
+	}
+	if (!isValid || numCorners < 3)
+	{
+		chunk->corners.length = numCornersBefore; //drop the triangles we already fanned out of this face
+		chunk->numBadLines++;
+	}
+}
+
+static void ParseObjLine(ObjChunk* chunk, const char* pntr, const char* end)
+{
+	while (pntr < end && IsObjSpace(*pntr)) { pntr++; }
+	if (end - pntr < 2) { return; }
+	
+	if (pntr[0] == 'v' && IsObjSpace(pntr[1]))
+	{
+		pntr++;
+		v3 position = V3_Zero;
+		if (!ParseObjFloat(&pntr, end, &position.X) || !ParseObjFloat(&pntr, end, &position.Y) || !ParseObjFloat(&pntr, end, &position.Z)) { chunk->numBadLines++; return; }
+		*VarArrayAdd(v3, &chunk->positions) = position;
+		//Scans often have a color after the position ("v x y z r g b"), positions without one are white
+		v3 color = V3_One;
+		if (ParseObjFloat(&pntr, end, &color.X) && ParseObjFloat(&pntr, end, &color.Y) && ParseObjFloat(&pntr, end, &color.Z))
+		{
+			while (chunk->colors.length + 1 < chunk->positions.length) { *VarArrayAdd(v3, &chunk->colors) = V3_One; }
+			*VarArrayAdd(v3, &chunk->colors) = color;
+		}
+		else if (chunk->colors.length > 0) { *VarArrayAdd(v3, &chunk->colors) = V3_One; }
+	}
+	else if (pntr[0] == 'v' && pntr[1] == 't')
+	{
+		pntr += 2;
+		v2 texCoord = V2_Zero;
+		if (!ParseObjFloat(&pntr, end, &texCoord.X)) { chunk->numBadLines++; return; }
+		ParseObjFloat(&pntr, end, &texCoord.Y); //v is optional and defaults to 0
+		*VarArrayAdd(v2, &chunk->texCoords) = texCoord;
+	}
+	else if (pntr[0] == 'v' && pntr[1] == 'n')
+	{
+		pntr += 2;
+		v3 normal = V3_Zero;
+		if (!ParseObjFloat(&pntr, end, &normal.X) || !ParseObjFloat(&pntr, end, &normal.Y) || !ParseObjFloat(&pntr, end, &normal.Z)) { chunk->numBadLines++; return; }
+		*VarArrayAdd(v3, &chunk->normals) = normal;
+	}
+	else if (pntr[0] == 'f' && IsObjSpace(pntr[1])) { ParseObjFaceLine(chunk, pntr + 1, end); }
+	else if (IsObjKeyword(pntr, end, "usemtl"))
+	{
+		ObjMaterialRun* newRun = VarArrayAdd(ObjMaterialRun, &chunk->materialRuns);
+		NotNull(newRun);
+		ClearPointer(newRun);
+		newRun->materialName = GetObjLineRest(pntr + 6, end);
+		newRun->firstCorner = chunk->corners.length;
+	}
+	else if (IsObjKeyword(pntr, end, "mtllib")) { *VarArrayAdd(Str8, &chunk->materialLibs) = GetObjLineRest(pntr + 6, end); }
+	//Everything else (comments, o, g, s, l, p, vp, ...) doesn't change what we build
+}
+
+// The text has to stay alive as long as the chunk, material names and libraries point into it
+void ParseObjChunk(Arena* arena, Str8 text, ObjChunk* chunkOut)
+{
+	NotNull(arena);
+	NotNull(chunkOut);
+	ClearPointer(chunkOut);
+	chunkOut->arena = arena;
+	chunkOut->text = text;
+	uxx initialCount = (text.length / 64) + 16; //about one of each line type per 64 bytes keeps regrowing rare
+	InitVarArrayWithInitial(v3, &chunkOut->positions, arena, initialCount);
+	InitVarArray(v3, &chunkOut->colors, arena);
+	InitVarArrayWithInitial(v2, &chunkOut->texCoords, arena, initialCount);
+	InitVarArrayWithInitial(v3, &chunkOut->normals, arena, initialCount);
+	InitVarArrayWithInitial(ObjCorner, &chunkOut->corners, arena, initialCount * 3);
+	InitVarArray(ObjMaterialRun, &chunkOut->materialRuns, arena);
+	InitVarArray(Str8, &chunkOut->materialLibs, arena);
+	
+	const char* pntr = text.chars;
+	const char* end = text.chars + text.length;
+	while (pntr < end)
+	{
+		const char* lineEnd = FindObjLineEnd(pntr, end);
+		ParseObjLine(chunkOut, pntr, lineEnd);
+		chunkOut->numLines++;
+		pntr = lineEnd + 1;
+	}
+}
+
+typedef struct ObjChunkJobs ObjChunkJobs;
+struct ObjChunkJobs
+{
+	ObjChunk* chunks; //text is filled in before the jobs run
+	Arena* chunkArenas; //one std heap arena per chunk so the VarArrays can grow on any thread
+};
+
+// Only reads its own chunk's text and only writes its own ObjChunk
+static JOB_FUNC_DEF(ParseObjChunkJob)
+{
+	ObjChunkJobs* context = (ObjChunkJobs*)userPntr;
+	InitArenaStdHeap(&context->chunkArenas[jobIndex]);
+	ParseObjChunk(&context->chunkArenas[jobIndex], context->chunks[jobIndex].text, &context->chunks[jobIndex]);
+}
+
+// +--------------------------------------------------------------+
+// |                         Vertex Table                         |
+// +--------------------------------------------------------------+
+static inline u32 HashObjVertexKey(const ObjVertexKey* key)
+{
+	u32 hash = 2166136261u;
+	for (uxx aIndex = 0; aIndex < ArrayCount(key->indices); aIndex++) { hash = (hash ^ key->indices[aIndex]) * 16777619u; }
+	return hash ^ (hash >> 15);
+}
+
+static inline bool AreObjVertexKeysEqual(const ObjVertexKey* left, const ObjVertexKey* right)
+{
+	return (left->indices[0] == right->indices[0] && left->indices[1] == right->indices[1] && left->indices[2] == right->indices[2]);
+}
+
+void FreeObjVertexTable(ObjVertexTable* table)
+{
+	NotNull(table);
+	if (table->arena != nullptr)
+	{
+		if (table->slots != nullptr) { FreeMem(table->arena, table->slots, sizeof(u32) * table->numSlots); }
+		FreeVarArray(&table->keys);
+	}
+	ClearPointer(table);
+}
+
+void InitObjVertexTable(Arena* arena, uxx expectedNumVertices, ObjVertexTable* tableOut)
+{
+	NotNull(arena);
+	NotNull(tableOut);
+	ClearPointer(tableOut);
+	tableOut->arena = arena;
+	tableOut->numSlots = 64;
+	while (tableOut->numSlots < expectedNumVertices * 2) { tableOut->numSlots <<= 1; }
+	tableOut->slots = AllocArray(u32, arena, tableOut->numSlots);
+	NotNull(tableOut->slots);
+	MyMemSet(tableOut->slots, 0xFF, sizeof(u32) * tableOut->numSlots);
+	InitVarArrayWithInitial(ObjVertexKey, &tableOut->keys, arena, expectedNumVertices);
+}
+
+static void GrowObjVertexTable(ObjVertexTable* table)
+{
+	FreeMem(table->arena, table->slots, sizeof(u32) * table->numSlots);
+	table->numSlots <<= 1;
+	table->slots = AllocArray(u32, table->arena, table->numSlots);
+	NotNull(table->slots);
+	MyMemSet(table->slots, 0xFF, sizeof(u32) * table->numSlots);
+	VarArrayLoop(&table->keys, kIndex)
+	{
+		VarArrayLoopGet(ObjVertexKey, key, &table->keys, kIndex);
+		uxx slot = HashObjVertexKey(key) & (table->numSlots-1);
+		while (table->slots[slot] != OBJ_VERTEX_NONE) { slot = (slot + 1) & (table->numSlots-1); }
+		table->slots[slot] = (u32)kIndex;
+	}
+}
+
+// Returns the index of the vertex with this key, new keys get the next index (the caller adds the vertex when isNewOut is set)
+static inline u32 FindOrAddObjVertex(ObjVertexTable* table, const ObjVertexKey* key, bool* isNewOut)
+{
+	uxx slot = HashObjVertexKey(key) & (table->numSlots-1);
+	while (table->slots[slot] != OBJ_VERTEX_NONE)
+	{
+		u32 vertexIndex = table->slots[slot];
+		if (AreObjVertexKeysEqual(VarArrayGetHard(ObjVertexKey, &table->keys, vertexIndex), key)) { *isNewOut = false; return vertexIndex; }
+		slot = (slot + 1) & (table->numSlots-1);
+	}
+	u32 result = (u32)table->keys.length;
+	*VarArrayAdd(ObjVertexKey, &table->keys) = *key;
+	table->slots[slot] = result;
+	if (table->keys.length * 2 > table->numSlots) { GrowObjVertexTable(table); }
+	*isNewOut = true;
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                          Materials                           |
+// +--------------------------------------------------------------+
+static Str8 CopyObjStr(Arena* arena, Str8 str)
+{
+	Str8 result = NewStr8(str.length, nullptr);
+	if (str.length == 0) { return result; }
+	result.chars = AllocArray(char, arena, str.length);
+	NotNull(result.chars);
+	MyMemCopy(result.chars, str.chars, str.length);
+	return result;
+}
+
+// Everything up to and including the last slash, empty when the path has no folder
+static FilePath GetObjFolderPart(FilePath path)
+{
+	uxx length = path.length;
+	while (length > 0 && path.chars[length-1] != '/' && path.chars[length-1] != '\\') { length--; }
+	return NewStr8(length, path.chars);
+}
+
+static FilePath GetObjRelativePath(Arena* arena, FilePath folder, Str8 fileName)
+{
+	bool isAbsolute = (fileName.length > 0 && (fileName.chars[0] == '/' || fileName.chars[0] == '\\')) || (fileName.length > 1 && fileName.chars[1] == ':');
+	if (isAbsolute) { return PrintInArenaStr(arena, "%.*s", StrPrint(fileName)); }
+	return PrintInArenaStr(arena, "%.*s%.*s", StrPrint(folder), StrPrint(fileName));
+}
+
+static void InitObjMaterial(Str8 name, ObjMaterial* materialOut)
+{
+	ClearPointer(materialOut);
+	materialOut->name = name;
+	materialOut->albedoFactor.R = 1.0f;
+	materialOut->albedoFactor.G = 1.0f;
+	materialOut->albedoFactor.B = 1.0f;
+	materialOut->albedoFactor.A = 1.0f;
+	materialOut->metallic = 0.0f;
+	materialOut->roughness = -1.0f;
+	materialOut->shininess = -1.0f;
+}
+
+// Adds every newmtl in the file to materials. Names and paths are allocated from (or point into fileContents in) the arena
+static void ParseMtlFile(Arena* arena, FilePath folder, Str8 fileContents, VarArray* materials)
+{
+	ObjMaterial* material = nullptr;
+	const char* pntr = fileContents.chars;
+	const char* end = fileContents.chars + fileContents.length;
+	for (; pntr < end; pntr++)
+	{
+		const char* lineEnd = FindObjLineEnd(pntr, end);
+		while (pntr < lineEnd && IsObjSpace(*pntr)) { pntr++; }
+		const char* keywordEnd = pntr;
+		while (keywordEnd < lineEnd && !IsObjSpace(*keywordEnd)) { keywordEnd++; }
+		
+		if (IsObjKeyword(pntr, lineEnd, "newmtl"))
+		{
+			material = VarArrayAdd(ObjMaterial, materials);
+			NotNull(material);
+			InitObjMaterial(GetObjLineRest(keywordEnd, lineEnd), material);
+		}
+		else if (material != nullptr && keywordEnd > pntr && pntr[0] != '#')
+		{
+			const char* valuePntr = keywordEnd;
+			r32 value = 0.0f;
+			ObjMapSlot mapSlot = ObjMapSlot_Count;
+			if (IsObjKeyword(pntr, lineEnd, "Kd"))
+			{
+				r32 green = 0.0f, blue = 0.0f;
+				if (ParseObjFloat(&valuePntr, lineEnd, &value))
+				{
+					//"Kd r" is a valid shorthand for "Kd r r r"
+					if (!ParseObjFloat(&valuePntr, lineEnd, &green) || !ParseObjFloat(&valuePntr, lineEnd, &blue)) { green = value; blue = value; }
+					material->albedoFactor.R = value;
+					material->albedoFactor.G = green;
+					material->albedoFactor.B = blue;
+				}
+			}
+			else if (IsObjKeyword(pntr, lineEnd, "d") && ParseObjFloat(&valuePntr, lineEnd, &value)) { material->albedoFactor.A = ClampR32(value, 0.0f, 1.0f); }
+			else if (IsObjKeyword(pntr, lineEnd, "Tr") && ParseObjFloat(&valuePntr, lineEnd, &value)) { material->albedoFactor.A = ClampR32(1.0f - value, 0.0f, 1.0f); }
+			else if (IsObjKeyword(pntr, lineEnd, "Pm") && ParseObjFloat(&valuePntr, lineEnd, &value)) { material->metallic = ClampR32(value, 0.0f, 1.0f); }
+			else if (IsObjKeyword(pntr, lineEnd, "Pr") && ParseObjFloat(&valuePntr, lineEnd, &value)) { material->roughness = ClampR32(value, 0.0f, 1.0f); }
+			else if (IsObjKeyword(pntr, lineEnd, "Ns") && ParseObjFloat(&valuePntr, lineEnd, &value)) { material->shininess = MaxR32(value, 0.0f); }
+			else if (IsObjKeyword(pntr, lineEnd, "map_Kd")) { mapSlot = ObjMapSlot_Albedo; }
+			else if (IsObjKeyword(pntr, lineEnd, "norm") || IsObjKeyword(pntr, lineEnd, "map_Bump") || IsObjKeyword(pntr, lineEnd, "map_bump") || IsObjKeyword(pntr, lineEnd, "bump")) { mapSlot = ObjMapSlot_Normal; }
+			else if (IsObjKeyword(pntr, lineEnd, "map_Pm")) { mapSlot = ObjMapSlot_Metallic; }
+			else if (IsObjKeyword(pntr, lineEnd, "map_Pr")) { mapSlot = ObjMapSlot_Roughness; }
+			else if (IsObjKeyword(pntr, lineEnd, "map_ao") || IsObjKeyword(pntr, lineEnd, "map_AO") || IsObjKeyword(pntr, lineEnd, "map_Ka")) { mapSlot = ObjMapSlot_Occlusion; }
+			
+			if (mapSlot != ObjMapSlot_Count)
+			{
+				//The file name is the last thing on the line, options like "-bm 1.0" come before it
+				Str8 rest = GetObjLineRest(keywordEnd, lineEnd);
+				uxx nameStart = rest.length;
+				while (nameStart > 0 && !IsObjSpace(rest.chars[nameStart-1])) { nameStart--; }
+				if (nameStart < rest.length) { material->maps[mapSlot] = GetObjRelativePath(arena, folder, NewStr8(rest.length - nameStart, &rest.chars[nameStart])); }
+			}
+		}
+		pntr = lineEnd;
+	}
+}
+
+// Only reads the file, nullptr when it's missing. Missing files are remembered too so nothing is read twice.
+// Decoding waits for DecodeObjImages so every texture of the model is decoded on the jobs at once
+static ObjImage* FindOrReadObjImage(Arena* scratchArena, VarArray* images, FilePath path)
+{
+	VarArrayLoop(images, iIndex)
+	{
+		VarArrayLoopGet(ObjImage, image, images, iIndex);
+		if (AreObjNamesEqual(image->path, path)) { return image->isRead ? image : nullptr; }
+	}
+	ObjImage* newImage = VarArrayAdd(ObjImage, images);
+	NotNull(newImage);
+	ClearPointer(newImage);
+	newImage->path = path;
+	newImage->textureIndex = OBJ_TEXTURE_NONE;
+	newImage->isRead = OsReadFile(path, scratchArena, false, &newImage->fileContents);
+	return newImage->isRead ? newImage : nullptr;
+}
+
+static void DecodeObjImages(JobSystem* jobs, Arena* scratchArena, VarArray* images)
+{
+	ScratchBegin1(scratch, scratchArena);
+	PngImageDecode* decodes = AllocArray(PngImageDecode, scratch, images->length + 1);
+	NotNull(decodes);
+	VarArrayLoop(images, iIndex)
+	{
+		VarArrayLoopGet(ObjImage, image, images, iIndex);
+		ClearPointer(&decodes[iIndex]);
+		decodes[iIndex].encoded = image->fileContents;
+	}
+	DecodePngImages(jobs, scratchArena, images->length, decodes);
+	VarArrayLoop(images, iIndex)
+	{
+		VarArrayLoopGet(ObjImage, image, images, iIndex);
+		image->isLoaded = decodes[iIndex].decoded;
+		image->imageData = decodes[iIndex].imageData;
+		if (image->isRead && !image->isLoaded) { PrintLine_W("Failed to decode OBJ texture \"%.*s\"", StrPrint(image->path)); }
+	}
+	ScratchEnd(scratch);
+}
+
+// nullptr when the file was missing or couldn't be decoded
+static ObjImage* FindObjImage(VarArray* images, FilePath path)
+{
+	VarArrayLoop(images, iIndex)
+	{
+		VarArrayLoopGet(ObjImage, image, images, iIndex);
+		if (AreObjNamesEqual(image->path, path)) { return image->isLoaded ? image : nullptr; }
+	}
+	return nullptr;
+}
+
+// The pixels are copied out of the scratch arena so everything in the ModelData has a size FreeObjModelData knows
+static uxx AddObjTexture(Arena* arena, ModelData* modelData, Str8 name, v2i size, const u32* pixels)
+{
+	ModelDataTexture* newTexture = VarArrayAdd(ModelDataTexture, &modelData->textures);
+	NotNull(newTexture);
+	ClearPointer(newTexture);
+	newTexture->name = CopyObjStr(arena, name);
+	newTexture->imageData.size = size;
+	newTexture->imageData.pixels = AllocArray(u32, arena, (uxx)(size.Width * size.Height));
+	NotNull(newTexture->imageData.pixels);
+	MyMemCopy(newTexture->imageData.pixels, pixels, sizeof(u32) * (uxx)(size.Width * size.Height));
+	return modelData->textures.length - 1;
+}
+
+static uxx GetObjMapTextureIndex(Arena* arena, ModelData* modelData, VarArray* images, FilePath path)
+{
+	if (path.length == 0) { return OBJ_TEXTURE_NONE; }
+	ObjImage* image = FindObjImage(images, path);
+	if (image == nullptr) { PrintLine_W("Missing OBJ texture \"%.*s\"", StrPrint(path)); return OBJ_TEXTURE_NONE; }
+	if (image->textureIndex == OBJ_TEXTURE_NONE)
+	{
+		image->textureIndex = AddObjTexture(arena, modelData, GetFileNamePart(path, true), image->imageData.size, image->imageData.pixels);
+	}
+	return image->textureIndex;
+}
+
+static inline u8 SampleObjImageRed(const ImageData* image, v2i size, i32 xPos, i32 yPos)
+{
+	i32 sourceX = (i32)(((i64)xPos * image->size.Width) / size.Width);
+	i32 sourceY = (i32)(((i64)yPos * image->size.Height) / size.Height);
+	return (u8)(image->pixels[sourceY * image->size.Width + sourceX] & 0xFF);
+}
+
+// OBJ keeps metallic and roughness in separate grayscale maps (or only as the Pm/Pr/Ns scalars) while our materials want
+// them in one texture, so they're packed here at the size of the bigger map. Scalars fill in for a missing map, that way
+// a material without any metallic/roughness data still comes out dielectric instead of the all-white default's metallic
+static uxx AddObjMetallicRoughnessTexture(Arena* arena, Arena* scratchArena, ModelData* modelData, VarArray* images, const ObjMaterial* material)
+{
+	ObjImage* metallicImage = (material->maps[ObjMapSlot_Metallic].length > 0) ? FindObjImage(images, material->maps[ObjMapSlot_Metallic]) : nullptr;
+	ObjImage* roughnessImage = (material->maps[ObjMapSlot_Roughness].length > 0) ? FindObjImage(images, material->maps[ObjMapSlot_Roughness]) : nullptr;
+	if (material->maps[ObjMapSlot_Metallic].length > 0 && metallicImage == nullptr) { PrintLine_W("Missing OBJ texture \"%.*s\"", StrPrint(material->maps[ObjMapSlot_Metallic])); }
+	if (material->maps[ObjMapSlot_Roughness].length > 0 && roughnessImage == nullptr) { PrintLine_W("Missing OBJ texture \"%.*s\"", StrPrint(material->maps[ObjMapSlot_Roughness])); }
+	
+	v2i size = NewV2i(1, 1);
+	if (metallicImage != nullptr) { size = metallicImage->imageData.size; }
+	if (roughnessImage != nullptr && roughnessImage->imageData.size.Width * roughnessImage->imageData.size.Height > size.Width * size.Height) { size = roughnessImage->imageData.size; }
+	u8 metallicValue = (u8)(ClampR32(material->metallic, 0.0f, 1.0f) * 255.0f + 0.5f);
+	u8 roughnessValue = (u8)(ClampR32(material->roughness, 0.0f, 1.0f) * 255.0f + 0.5f);
+	
+	ScratchBegin1(scratch, scratchArena);
+	u32* pixels = AllocArray(u32, scratch, (uxx)(size.Width * size.Height));
+	NotNull(pixels);
+	for (i32 yPos = 0; yPos < size.Height; yPos++)
+	{
+		for (i32 xPos = 0; xPos < size.Width; xPos++)
+		{
+			u8 metallic = (metallicImage != nullptr) ? SampleObjImageRed(&metallicImage->imageData, size, xPos, yPos) : metallicValue;
+			u8 roughness = (roughnessImage != nullptr) ? SampleObjImageRed(&roughnessImage->imageData, size, xPos, yPos) : roughnessValue;
+			pixels[yPos * size.Width + xPos] = 0xFF0000FF | ((u32)roughness << 8) | ((u32)metallic << 16);
+		}
+	}
+	Str8 name = PrintInArenaStr(scratch, "%.*s_MetallicRoughness", StrPrint(material->name));
+	uxx result = AddObjTexture(arena, modelData, name, size, pixels);
+	ScratchEnd(scratch);
+	return result;
+}
+
+// Used for materials that aren't in any MTL file (the OBJs in our resources folder ship without theirs). Textures exported
+// next to an OBJ are usually named after the material with one of these suffixes
+static const char* ObjConventionSuffixes[ObjMapSlot_Count][4] = {
+	[ObjMapSlot_Albedo]    = { "_Base_Color", "_BaseColor", "_albedo", "_diffuse" },
+	[ObjMapSlot_Normal]    = { "_Normal_OpenGL", "_Normal", "_normal", nullptr },
+	[ObjMapSlot_Metallic]  = { "_Metallic", "_metalness", "_metallic", nullptr },
+	[ObjMapSlot_Roughness] = { "_Roughness", "_roughness", nullptr, nullptr },
+	[ObjMapSlot_Occlusion] = { "_Mixed_AO", "_AO", "_ao", nullptr },
+};
+
+static uxx FindObjConventionMaps(Arena* scratchArena, FilePath folder, VarArray* images, ObjMaterial* material)
+{
+	Str8 lowerName = CopyObjStr(scratchArena, material->name);
+	for (uxx cIndex = 0; cIndex < lowerName.length; cIndex++)
+	{
+		if (lowerName.chars[cIndex] >= 'A' && lowerName.chars[cIndex] <= 'Z') { lowerName.chars[cIndex] += 'a' - 'A'; }
+	}
+	uxx numNames = AreObjNamesEqual(lowerName, material->name) ? 1 : 2;
+	Str8 names[2] = { material->name, lowerName };
+	uxx numFound = 0;
+	for (uxx sIndex = 0; sIndex < ObjMapSlot_Count; sIndex++)
+	{
+		for (uxx suffixIndex = 0; suffixIndex < ArrayCount(ObjConventionSuffixes[sIndex]) && material->maps[sIndex].length == 0; suffixIndex++)
+		{
+			const char* suffix = ObjConventionSuffixes[sIndex][suffixIndex];
+			if (suffix == nullptr) { break; }
+			for (uxx nIndex = 0; nIndex < numNames; nIndex++)
+			{
+				FilePath path = PrintInArenaStr(scratchArena, "%.*s%.*s%s.png", StrPrint(folder), StrPrint(names[nIndex]), suffix);
+				if (FindOrReadObjImage(scratchArena, images, path) != nullptr) { material->maps[sIndex] = path; numFound++; break; }
+			}
+		}
+	}
+	return numFound;
+}
+
+// +--------------------------------------------------------------+
+// |                            Loading                            |
+// +--------------------------------------------------------------+
+// Turns a corner into absolute indices, false when any index is out of range (or there's no position)
+static inline bool ResolveObjCorner(const ObjCorner* corner, const uxx* chunkBases, const uxx* totals, ObjVertexKey* keyOut)
+{
+	for (u32 aIndex = 0; aIndex < 3; aIndex++)
+	{
+		i64 index = corner->indices[aIndex];
+		if (index == OBJ_INDEX_NONE)
+		{
+			if (aIndex == 0) { return false; }
+			keyOut->indices[aIndex] = OBJ_KEY_NONE;
+			continue;
+		}
+		if ((corner->relativeMask & (1u << aIndex)) != 0) { index += (i64)chunkBases[aIndex]; }
+		if (index < 0 || index >= (i64)totals[aIndex]) { return false; }
+		keyOut->indices[aIndex] = (u32)index;
+	}
+	return true;
+}
+
+bool IsObjFilePath(FilePath path)
+{
+	if (path.length < 4) { return false; }
+	const char* extension = &path.chars[path.length - 4];
+	return (extension[0] == '.' && (extension[1] | 0x20) == 'o' && (extension[2] | 0x20) == 'b' && (extension[3] | 0x20) == 'j');
+}
+
+// Frees what TryParseObjModel allocated, every name and pixel array has to be allocated at its exact size
+void FreeObjModelData(Arena* arena, ModelData* modelData)
+{
+	NotNull(arena);
+	NotNull(modelData);
+	VarArrayLoop(&modelData->parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &modelData->parts, pIndex);
+		if (part->name.length > 0) { FreeMem(arena, part->name.chars, part->name.length); }
+		FreeVarArray(&part->vertices);
+		FreeVarArray(&part->indices);
+	}
+	VarArrayLoop(&modelData->textures, tIndex)
+	{
+		VarArrayLoopGet(ModelDataTexture, texture, &modelData->textures, tIndex);
+		if (texture->name.length > 0) { FreeMem(arena, texture->name.chars, texture->name.length); }
+		FreeMem(arena, texture->imageData.pixels, sizeof(u32) * (uxx)(texture->imageData.size.Width * texture->imageData.size.Height));
+	}
+	FreeVarArray(&modelData->parts);
+	FreeVarArray(&modelData->materials);
+	FreeVarArray(&modelData->textures);
+	ClearPointer(modelData);
+}
+
+// Fills modelDataOut from the contents of an OBJ file, filePath is only used to find the MTL files and textures
+// (which are skipped entirely when loadMaterials is false). Every face that uses a material ends up in that
+// material's part. A position without a normal gets the area weighted average of the faces around it.
+// The chunks are parsed in parallel, one job each, and merged on this thread
+Result TryParseObjModel(JobSystem* jobs, Arena* arena, FilePath filePath, Str8 fileContents, bool loadMaterials, ModelData* modelDataOut, ObjLoadStats* statsOut)
+{
+	NotNull(arena);
+	NotNull(modelDataOut);
+	ScratchBegin1(scratch, arena);
+	ObjLoadStats stats = ZEROED;
+	stats.fileSize = fileContents.length;
+	
+	// +==============================+
+	// |            Parse             |
+	// +==============================+
+	PerfTime parseStart = GetPerfTime();
+	uxx maxNumChunks = (fileContents.length / OBJ_CHUNK_SIZE) + 1;
+	ObjChunk* chunks = AllocArray(ObjChunk, scratch, maxNumChunks);
+	NotNull(chunks);
+	uxx numChunks = 0;
+	const char* filePntr = fileContents.chars;
+	const char* fileEnd = fileContents.chars + fileContents.length;
+	while (filePntr < fileEnd)
+	{
+		//Every chunk but the last ends right after a newline so no line is split between two of them
+		const char* chunkEnd = (fileEnd - filePntr > OBJ_CHUNK_SIZE) ? FindObjLineEnd(filePntr + OBJ_CHUNK_SIZE, fileEnd) : fileEnd;
+		if (chunkEnd < fileEnd) { chunkEnd++; }
+		Assert(numChunks < maxNumChunks);
+		chunks[numChunks].text = NewStr8((uxx)(chunkEnd - filePntr), (char*)filePntr);
+		numChunks++;
+		filePntr = chunkEnd;
+	}
+	ObjChunkJobs context = ZEROED;
+	context.chunks = chunks;
+	context.chunkArenas = AllocArray(Arena, scratch, numChunks + 1);
+	NotNull(context.chunkArenas);
+	RunJobs(jobs, numChunks, ParseObjChunkJob, &context);
+	PerfTime parseEnd = GetPerfTime();
+	stats.parseMs = GetPerfTimeDiff(&parseStart, &parseEnd);
+	stats.numChunks = numChunks;
+	
+	// +==============================+
+	// |            Merge             |
+	// +==============================+
+	PerfTime mergeStart = GetPerfTime();
+	uxx totals[3] = { 0, 0, 0 };
+	uxx* chunkBases = AllocArray(uxx, scratch, numChunks * 3);
+	NotNull(chunkBases);
+	bool hasColors = false;
+	for (uxx cIndex = 0; cIndex < numChunks; cIndex++)
+	{
+		chunkBases[cIndex*3 + 0] = totals[0];
+		chunkBases[cIndex*3 + 1] = totals[1];
+		chunkBases[cIndex*3 + 2] = totals[2];
+		totals[0] += chunks[cIndex].positions.length;
+		totals[1] += chunks[cIndex].texCoords.length;
+		totals[2] += chunks[cIndex].normals.length;
+		if (chunks[cIndex].colors.length > 0) { hasColors = true; }
+		stats.numLines += chunks[cIndex].numLines;
+		stats.numBadLines += chunks[cIndex].numBadLines;
+	}
+	stats.numPositions = totals[0];
+	v3* positions = AllocArray(v3, scratch, totals[0] + 1);
+	v2* texCoords = AllocArray(v2, scratch, totals[1] + 1);
+	v3* normals = AllocArray(v3, scratch, totals[2] + 1);
+	v3* colors = hasColors ? AllocArray(v3, scratch, totals[0] + 1) : nullptr;
+	NotNull(positions);
+	NotNull(texCoords);
+	NotNull(normals);
+	for (uxx cIndex = 0; cIndex < numChunks; cIndex++)
+	{
+		ObjChunk* chunk = &chunks[cIndex];
+		const uxx* bases = &chunkBases[cIndex*3];
+		if (chunk->positions.length > 0) { MyMemCopy(&positions[bases[0]], chunk->positions.items, sizeof(v3) * chunk->positions.length); }
+		if (chunk->texCoords.length > 0) { MyMemCopy(&texCoords[bases[1]], chunk->texCoords.items, sizeof(v2) * chunk->texCoords.length); }
+		if (chunk->normals.length > 0) { MyMemCopy(&normals[bases[2]], chunk->normals.items, sizeof(v3) * chunk->normals.length); }
+		if (colors != nullptr)
+		{
+			for (uxx pIndex = 0; pIndex < chunk->positions.length; pIndex++)
+			{
+				//A chunk's colors stop at its last colored position, the rest are white
+				colors[bases[0] + pIndex] = (pIndex < chunk->colors.length) ? *VarArrayGetHard(v3, &chunk->colors, pIndex) : V3_One;
+			}
+		}
+	}
+	
+	//Split every chunk's corners into ranges of one material, faces before a chunk's first usemtl continue the previous chunk's material
+	VarArray partNames; //Str8
+	VarArray faceRanges; //ObjFaceRange
+	InitVarArray(Str8, &partNames, scratch);
+	InitVarArrayWithInitial(ObjFaceRange, &faceRanges, scratch, numChunks + 1);
+	Str8 materialName = StrLit(OBJ_DEFAULT_MATERIAL);
+	for (uxx cIndex = 0; cIndex < numChunks; cIndex++)
+	{
+		ObjChunk* chunk = &chunks[cIndex];
+		for (uxx rIndex = 0; rIndex <= chunk->materialRuns.length; rIndex++)
+		{
+			uxx rangeStart = (rIndex > 0) ? VarArrayGetHard(ObjMaterialRun, &chunk->materialRuns, rIndex-1)->firstCorner : 0;
+			uxx rangeEnd = (rIndex < chunk->materialRuns.length) ? VarArrayGetHard(ObjMaterialRun, &chunk->materialRuns, rIndex)->firstCorner : chunk->corners.length;
+			if (rIndex > 0) { materialName = VarArrayGetHard(ObjMaterialRun, &chunk->materialRuns, rIndex-1)->materialName; }
+			if (rangeEnd <= rangeStart) { continue; }
+			uxx partIndex = partNames.length;
+			VarArrayLoop(&partNames, nIndex)
+			{
+				if (AreObjNamesEqual(*VarArrayGetHard(Str8, &partNames, nIndex), materialName)) { partIndex = nIndex; break; }
+			}
+			if (partIndex == partNames.length) { *VarArrayAdd(Str8, &partNames) = materialName; }
+			ObjFaceRange* newRange = VarArrayAdd(ObjFaceRange, &faceRanges);
+			NotNull(newRange);
+			newRange->chunkIndex = cIndex;
+			newRange->firstCorner = rangeStart;
+			newRange->numCorners = rangeEnd - rangeStart;
+			newRange->partIndex = partIndex;
+		}
+	}
+	
+	//Area weighted face normals for the positions of corners that don't have a normal
+	v3* generatedNormals = nullptr;
+	VarArrayLoop(&faceRanges, rIndex)
+	{
+		VarArrayLoopGet(ObjFaceRange, range, &faceRanges, rIndex);
+		const ObjCorner* corners = VarArrayGetHard(ObjCorner, &chunks[range->chunkIndex].corners, range->firstCorner);
+		for (uxx cIndex = 0; cIndex + 3 <= range->numCorners; cIndex += 3)
+		{
+			ObjVertexKey keys[3];
+			if (!ResolveObjCorner(&corners[cIndex+0], &chunkBases[range->chunkIndex*3], totals, &keys[0]) ||
+				!ResolveObjCorner(&corners[cIndex+1], &chunkBases[range->chunkIndex*3], totals, &keys[1]) ||
+				!ResolveObjCorner(&corners[cIndex+2], &chunkBases[range->chunkIndex*3], totals, &keys[2]))
+			{
+				continue;
+			}
+			if (keys[0].indices[2] != OBJ_KEY_NONE && keys[1].indices[2] != OBJ_KEY_NONE && keys[2].indices[2] != OBJ_KEY_NONE) { continue; }
+			if (generatedNormals == nullptr)
+			{
+				generatedNormals = AllocArray(v3, scratch, totals[0]);
+				NotNull(generatedNormals);
+				for (uxx pIndex = 0; pIndex < totals[0]; pIndex++) { generatedNormals[pIndex] = V3_Zero; }
+			}
+			v3 position0 = positions[keys[0].indices[0]];
+			v3 faceNormal = Cross(Sub(positions[keys[1].indices[0]], position0), Sub(positions[keys[2].indices[0]], position0));
+			for (uxx kIndex = 0; kIndex < 3; kIndex++) { generatedNormals[keys[kIndex].indices[0]] = Add(generatedNormals[keys[kIndex].indices[0]], faceNormal); }
+		}
+	}
+	if (generatedNormals != nullptr)
+	{
+		for (uxx pIndex = 0; pIndex < totals[0]; pIndex++)
+		{
+			generatedNormals[pIndex] = (LengthSquared(generatedNormals[pIndex]) > 0.0f) ? Normalize(generatedNormals[pIndex]) : V3_Up;
+		}
+	}
+	
+	ClearPointer(modelDataOut);
+	InitVarArrayWithInitial(ModelDataPart, &modelDataOut->parts, arena, partNames.length);
+	InitVarArrayWithInitial(ModelDataMaterial, &modelDataOut->materials, arena, partNames.length);
+	InitVarArray(ModelDataTexture, &modelDataOut->textures, arena);
+	VarArrayLoop(&partNames, pIndex)
+	{
+		uxx numPartCorners = 0;
+		VarArrayLoop(&faceRanges, rIndex)
+		{
+			VarArrayLoopGet(ObjFaceRange, range, &faceRanges, rIndex);
+			if (range->partIndex == pIndex) { numPartCorners += range->numCorners; }
+		}
+		ModelDataPart* part = VarArrayAdd(ModelDataPart, &modelDataOut->parts);
+		NotNull(part);
+		ClearPointer(part);
+		part->name = CopyObjStr(arena, *VarArrayGetHard(Str8, &partNames, pIndex));
+		part->materialIndex = pIndex;
+		part->transform.position = V3_Zero;
+		part->transform.rotation = Quat_Identity;
+		part->transform.scale = V3_One;
+		uxx expectedNumVertices = (numPartCorners / 4) + 16; //closed triangle meshes have about 1 vertex per 6 corners, seams add more
+		InitVarArrayWithInitial(Vertex3D, &part->vertices, arena, expectedNumVertices);
+		InitVarArrayWithInitial(i32, &part->indices, arena, numPartCorners);
+		
+		ObjVertexTable vertexTable = ZEROED;
+		InitObjVertexTable(arena, expectedNumVertices, &vertexTable);
+		VarArrayLoop(&faceRanges, rIndex)
+		{
+			VarArrayLoopGet(ObjFaceRange, range, &faceRanges, rIndex);
+			if (range->partIndex != pIndex) { continue; }
+			const ObjCorner* corners = VarArrayGetHard(ObjCorner, &chunks[range->chunkIndex].corners, range->firstCorner);
+			for (uxx cIndex = 0; cIndex + 3 <= range->numCorners; cIndex += 3)
+			{
+				ObjVertexKey keys[3];
+				if (!ResolveObjCorner(&corners[cIndex+0], &chunkBases[range->chunkIndex*3], totals, &keys[0]) ||
+					!ResolveObjCorner(&corners[cIndex+1], &chunkBases[range->chunkIndex*3], totals, &keys[1]) ||
+					!ResolveObjCorner(&corners[cIndex+2], &chunkBases[range->chunkIndex*3], totals, &keys[2]))
+				{
+					stats.numBadTriangles++;
+					continue;
+				}
+				for (uxx kIndex = 0; kIndex < 3; kIndex++)
+				{
+					const ObjVertexKey* key = &keys[kIndex];
+					bool isNew = false;
+					u32 vertexIndex = FindOrAddObjVertex(&vertexTable, key, &isNew);
+					if (isNew)
+					{
+						Vertex3D* newVertex = VarArrayAdd(Vertex3D, &part->vertices);
+						NotNull(newVertex);
+						ClearPointer(newVertex);
+						newVertex->position = positions[key->indices[0]];
+						//OBJ texCoords start at the bottom left, ours (like glTF's) start at the top left
+						if (key->indices[1] != OBJ_KEY_NONE) { newVertex->texCoord = NewV2(texCoords[key->indices[1]].X, 1.0f - texCoords[key->indices[1]].Y); }
+						newVertex->normal = (key->indices[2] != OBJ_KEY_NONE) ? normals[key->indices[2]] : generatedNormals[key->indices[0]];
+						v3 color = (colors != nullptr) ? colors[key->indices[0]] : V3_One;
+						newVertex->color.R = color.X;
+						newVertex->color.G = color.Y;
+						newVertex->color.B = color.Z;
+						newVertex->color.A = 1.0f;
+					}
+					*VarArrayAdd(i32, &part->indices) = (i32)vertexIndex;
+				}
+				stats.numTriangles++;
+			}
+		}
+		stats.numVertices += part->vertices.length;
+		FreeObjVertexTable(&vertexTable);
+	}
+	PerfTime mergeEnd = GetPerfTime();
+	stats.mergeMs = GetPerfTimeDiff(&mergeStart, &mergeEnd);
+	
+	// +==============================+
+	// |          Materials           |
+	// +==============================+
+	PerfTime materialStart = GetPerfTime();
+	FilePath folder = GetObjFolderPart(filePath);
+	VarArray materials; //ObjMaterial
+	VarArray images; //ObjImage
+	InitVarArray(ObjMaterial, &materials, scratch);
+	InitVarArray(ObjImage, &images, scratch);
+	if (loadMaterials)
+	{
+		VarArray libraryPaths; //FilePath
+		InitVarArray(FilePath, &libraryPaths, scratch);
+		for (uxx cIndex = 0; cIndex < numChunks; cIndex++)
+		{
+			VarArrayLoop(&chunks[cIndex].materialLibs, lIndex)
+			{
+				FilePath libraryPath = GetObjRelativePath(scratch, folder, *VarArrayGetHard(Str8, &chunks[cIndex].materialLibs, lIndex));
+				bool alreadyLoaded = false;
+				VarArrayLoop(&libraryPaths, pIndex) { if (AreObjNamesEqual(*VarArrayGetHard(FilePath, &libraryPaths, pIndex), libraryPath)) { alreadyLoaded = true; break; } }
+				if (alreadyLoaded) { continue; }
+				*VarArrayAdd(FilePath, &libraryPaths) = libraryPath;
+				Str8 libraryContents = ZEROED;
+				if (!OsReadFile(libraryPath, scratch, false, &libraryContents)) { PrintLine_W("Missing material library \"%.*s\"", StrPrint(libraryPath)); continue; }
+				ParseMtlFile(scratch, folder, libraryContents, &materials);
+			}
+		}
+	}
+	//Every part's material is resolved (and its texture files read) first so all the images can be decoded together
+	ObjMaterial* partMaterials = AllocArray(ObjMaterial, scratch, partNames.length + 1);
+	NotNull(partMaterials);
+	VarArrayLoop(&partNames, pIndex)
+	{
+		Str8 partName = *VarArrayGetHard(Str8, &partNames, pIndex);
+		ObjMaterial* material = &partMaterials[pIndex];
+		InitObjMaterial(partName, material);
+		bool foundMaterial = false;
+		VarArrayLoop(&materials, mIndex)
+		{
+			VarArrayLoopGet(ObjMaterial, mtlMaterial, &materials, mIndex);
+			if (AreObjNamesEqual(mtlMaterial->name, partName)) { *material = *mtlMaterial; foundMaterial = true; break; }
+		}
+		if (loadMaterials && !foundMaterial)
+		{
+			uxx numFound = FindObjConventionMaps(scratch, folder, &images, material);
+			PrintLine_D("OBJ material \"%.*s\" isn't in a material library, found %llu texture%s next to the file", StrPrint(partName), (u64)numFound, Plural(numFound, "s"));
+		}
+		if (material->roughness < 0.0f)
+		{
+			//The usual Blinn-Phong exponent to GGX roughness conversion
+			material->roughness = (material->shininess >= 0.0f) ? SqrtR32(2.0f / (material->shininess + 2.0f)) : OBJ_DEFAULT_ROUGHNESS;
+		}
+		if (!loadMaterials) { continue; }
+		for (uxx sIndex = 0; sIndex < ObjMapSlot_Count; sIndex++)
+		{
+			if (material->maps[sIndex].length > 0) { FindOrReadObjImage(scratch, &images, material->maps[sIndex]); }
+		}
+	}
+	DecodeObjImages(jobs, scratch, &images);
+	VarArrayLoop(&partNames, pIndex)
+	{
+		const ObjMaterial* material = &partMaterials[pIndex];
+		ModelDataMaterial* newMaterial = VarArrayAdd(ModelDataMaterial, &modelDataOut->materials);
+		NotNull(newMaterial);
+		ClearPointer(newMaterial);
+		newMaterial->albedoFactor = material->albedoFactor;
+		newMaterial->albedoTextureIndex = OBJ_TEXTURE_NONE;
+		newMaterial->normalTextureIndex = OBJ_TEXTURE_NONE;
+		newMaterial->metallicRoughnessTextureIndex = OBJ_TEXTURE_NONE;
+		newMaterial->ambientOcclusionTextureIndex = OBJ_TEXTURE_NONE;
+		if (!loadMaterials) { continue; }
+		newMaterial->albedoTextureIndex = GetObjMapTextureIndex(arena, modelDataOut, &images, material->maps[ObjMapSlot_Albedo]);
+		newMaterial->normalTextureIndex = GetObjMapTextureIndex(arena, modelDataOut, &images, material->maps[ObjMapSlot_Normal]);
+		newMaterial->ambientOcclusionTextureIndex = GetObjMapTextureIndex(arena, modelDataOut, &images, material->maps[ObjMapSlot_Occlusion]);
+		newMaterial->metallicRoughnessTextureIndex = AddObjMetallicRoughnessTexture(arena, scratch, modelDataOut, &images, material);
+	}
+	stats.numTextures = modelDataOut->textures.length;
+	PerfTime materialEnd = GetPerfTime();
+	stats.materialMs = GetPerfTimeDiff(&materialStart, &materialEnd);
+	
+	for (uxx cIndex = 0; cIndex < numChunks; cIndex++) { FreeObjChunk(&chunks[cIndex]); }
+	ScratchEnd(scratch);
+	if (statsOut != nullptr) { *statsOut = stats; }
+	if (stats.numBadLines > 0 || stats.numBadTriangles > 0)
+	{
+		PrintLine_W("Skipped %llu malformed line%s and %llu triangle%s with missing vertices in \"%.*s\"",
+			(u64)stats.numBadLines, Plural(stats.numBadLines, "s"),
+			(u64)stats.numBadTriangles, Plural(stats.numBadTriangles, "s"),
+			StrPrint(filePath)
+		);
+	}
+	if (stats.numTriangles == 0) { FreeObjModelData(arena, modelDataOut); return Result_Failure; }
+	return Result_Success;
+}
+
+// Same interface as TryLoadGltfFile plus the JobSystem the chunks are parsed on (nullptr parses them all on this thread)
+Result TryLoadObjFile(JobSystem* jobs, FilePath filePath, Arena* arena, ModelData* modelDataOut)
+{
+	NotNull(arena);
+	NotNull(modelDataOut);
+	ScratchBegin1(scratch, arena);
+	Str8 fileContents = ZEROED;
+	if (!OsReadFile(filePath, scratch, false, &fileContents)) { ScratchEnd(scratch); return Result_FailedToReadFile; }
+	ObjLoadStats stats = ZEROED;
+	Result result = TryParseObjModel(jobs, arena, filePath, fileContents, true, modelDataOut, &stats);
+	ScratchEnd(scratch);
+	if (result == Result_Success)
+	{
+		r64 fileMegabytes = (r64)stats.fileSize / (r64)Megabytes(1);
+		PrintLine_D("Loaded \"%.*s\" (%.1lfMB): %llu triangle%s, %llu vertices in %llu part%s, %llu texture%s. Parse %.2lfms + merge %.2lfms (%.1lfMB/s), materials %.2lfms",
+			StrPrint(filePath), fileMegabytes,
+			(u64)stats.numTriangles, Plural(stats.numTriangles, "s"),
+			(u64)stats.numVertices,
+			(u64)modelDataOut->parts.length, Plural(modelDataOut->parts.length, "s"),
+			(u64)stats.numTextures, Plural(stats.numTextures, "s"),
+			stats.parseMs, stats.mergeMs, fileMegabytes / ((stats.parseMs + stats.mergeMs) / 1000.0), stats.materialMs
+		);
+	}
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                          Benchmark                           |
+// +--------------------------------------------------------------+
+static char* WriteObjBenchmarkUint(char* pntr, u64 value)
+{
+	char digits[20];
+	uxx numDigits = 0;
+	do { digits[numDigits++] = (char)('0' + (value % 10)); value /= 10; } while (value > 0);
+	while (numDigits > 0) { *pntr++ = digits[--numDigits]; }
+	return pntr;
+}
+static char* WriteObjBenchmarkFloat(char* pntr, r32 value)
+{
+	if (value < 0.0f) { *pntr++ = '-'; value = -value; }
+	u64 fixedValue = (u64)((r64)value * 1000000.0 + 0.5);
+	pntr = WriteObjBenchmarkUint(pntr, fixedValue / 1000000);
+	*pntr++ = '.';
+	for (u64 divisor = 100000; divisor > 0; divisor /= 10) { *pntr++ = (char)('0' + ((fixedValue / divisor) % 10)); }
+	return pntr;
+}
+static char* WriteObjBenchmarkCorner(char* pntr, u64 index)
+{
+	*pntr++ = ' ';
+	pntr = WriteObjBenchmarkUint(pntr, index);
+	*pntr++ = '/';
+	pntr = WriteObjBenchmarkUint(pntr, index);
+	*pntr++ = '/';
+	pntr = WriteObjBenchmarkUint(pntr, index);
+	return pntr;
+}
+
+static inline v3 GetObjBenchmarkPosition(uxx xIndex, uxx zIndex)
+{
+	return NewV3((r32)xIndex * 0.01f, (r32)((xIndex * 7 + zIndex * 13) % 17) * 0.001f, (r32)zIndex * -0.01f);
+}
+
+// A gridSize x gridSize height field written the way scanning software writes them: "v" lines with a vertex
+// color, one "vt" and "vn" per vertex and two triangles per grid cell with all three indices on every corner
+ObjBenchmarkResult RunObjBenchmark(JobSystem* jobs, uxx gridSize)
+{
+	Assert(gridSize >= 2);
+	ObjBenchmarkResult result = ZEROED;
+	result.gridSize = gridSize;
+	
+	PerfTime generateStart = GetPerfTime();
+	uxx numGridVertices = gridSize * gridSize;
+	uxx maxTextSize = numGridVertices * 400 + 64;
+	char* text = AllocArray(char, stdHeap, maxTextSize);
+	NotNull(text);
+	char* pntr = text;
+	for (uxx zIndex = 0; zIndex < gridSize; zIndex++)
+	{
+		for (uxx xIndex = 0; xIndex < gridSize; xIndex++)
+		{
+			v3 position = GetObjBenchmarkPosition(xIndex, zIndex);
+			*pntr++ = 'v';
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, position.X);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, position.Y);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, position.Z);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, (r32)xIndex / (r32)gridSize);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, 0.5f);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, (r32)zIndex / (r32)gridSize);
+			*pntr++ = '\n';
+			*pntr++ = 'v'; *pntr++ = 't';
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, (r32)xIndex / (r32)(gridSize-1));
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, (r32)zIndex / (r32)(gridSize-1));
+			*pntr++ = '\n';
+			*pntr++ = 'v'; *pntr++ = 'n';
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, 0.0f);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, 1.0f);
+			*pntr++ = ' '; pntr = WriteObjBenchmarkFloat(pntr, 0.0f);
+			*pntr++ = '\n';
+		}
+	}
+	for (uxx zIndex = 0; zIndex + 1 < gridSize; zIndex++)
+	{
+		for (uxx xIndex = 0; xIndex + 1 < gridSize; xIndex++)
+		{
+			u64 corners[4] = {
+				(u64)(zIndex * gridSize + xIndex + 1), (u64)(zIndex * gridSize + xIndex + 2),
+				(u64)((zIndex+1) * gridSize + xIndex + 2), (u64)((zIndex+1) * gridSize + xIndex + 1),
+			};
+			*pntr++ = 'f';
+			pntr = WriteObjBenchmarkCorner(pntr, corners[0]);
+			pntr = WriteObjBenchmarkCorner(pntr, corners[1]);
+			pntr = WriteObjBenchmarkCorner(pntr, corners[2]);
+			*pntr++ = '\n';
+			*pntr++ = 'f';
+			pntr = WriteObjBenchmarkCorner(pntr, corners[0]);
+			pntr = WriteObjBenchmarkCorner(pntr, corners[2]);
+			pntr = WriteObjBenchmarkCorner(pntr, corners[3]);
+			*pntr++ = '\n';
+		}
+	}
+	Assert((uxx)(pntr - text) <= maxTextSize);
+	PerfTime generateEnd = GetPerfTime();
+	result.generateMs = GetPerfTimeDiff(&generateStart, &generateEnd);
+	
+	ModelData modelData = ZEROED;
+	Result parseResult = TryParseObjModel(jobs, stdHeap, FilePathLit("benchmark.obj"), NewStr8((uxx)(pntr - text), text), false, &modelData, &result.stats);
+	result.resultsMatch = (parseResult == Result_Success && modelData.parts.length == 1 && result.stats.numBadLines == 0);
+	if (result.resultsMatch)
+	{
+		ModelDataPart* part = VarArrayGetHard(ModelDataPart, &modelData.parts, 0);
+		result.resultsMatch = (part->vertices.length == numGridVertices && part->indices.length == (gridSize-1) * (gridSize-1) * 6);
+		for (uxx vIndex = 0; vIndex < part->vertices.length && result.resultsMatch; vIndex++)
+		{
+			//Vertices come out in the order the faces first use them, so find the grid point each one should be from its x and z
+			Vertex3D* vertex = VarArrayGetHard(Vertex3D, &part->vertices, vIndex);
+			uxx xIndex = (uxx)RoundR32i(vertex->position.X * 100.0f);
+			uxx zIndex = (uxx)RoundR32i(vertex->position.Z * -100.0f);
+			v3 expectedPosition = GetObjBenchmarkPosition(xIndex, zIndex);
+			if (xIndex >= gridSize || zIndex >= gridSize || LengthSquared(Sub(vertex->position, expectedPosition)) > 1e-10f) { result.resultsMatch = false; }
+		}
+	}
+	if (parseResult == Result_Success) { FreeObjModelData(stdHeap, &modelData); }
+	FreeMem(stdHeap, text, maxTextSize);
+	return result;
+}
+
+void PrintObjBenchmark(JobSystem* jobs, uxx gridSize)
+{
+	ObjBenchmarkResult result = RunObjBenchmark(jobs, gridSize);
+	r64 fileMegabytes = (r64)result.stats.fileSize / (r64)Megabytes(1);
+	PrintLine_I("OBJ benchmark (%llux%llu grid, %.1lfMB in %llu chunk%s):", (u64)gridSize, (u64)gridSize, fileMegabytes, (u64)result.stats.numChunks, Plural(result.stats.numChunks, "s"));
+	PrintLine_I("\tGenerate: %.3lfms", result.generateMs);
+	PrintLine_I("\tParse: %.3lfms (%.1lfMB/s)", result.stats.parseMs, fileMegabytes / (result.stats.parseMs / 1000.0));
+	PrintLine_I("\tMerge: %.3lfms (%llu triangles, %llu vertices)", result.stats.mergeMs, (u64)result.stats.numTriangles, (u64)result.stats.numVertices);
+	PrintLine_I("\tTotal: %.3lfms (%.1lfMB/s)", result.stats.parseMs + result.stats.mergeMs, fileMegabytes / ((result.stats.parseMs + result.stats.mergeMs) / 1000.0));
+	if (!result.resultsMatch) { PrintLine_E("\tParsed OBJ did not match the generated grid!"); }
+}
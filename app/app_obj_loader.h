@@ -0,0 +1,147 @@
+/*
+File:   app_obj_loader.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Loads Wavefront OBJ files (and the MTL files they reference) into the same ModelData that
+	** TryLoadGltfFile fills so LoadModel can treat both the same way. The file is cut into chunks at
+	** line boundaries and each chunk is parsed on its own job, negative (relative) indices are kept relative
+	** to the chunk until the merge adds up the counts of the chunks before it. The merge then turns the
+	** (position, texCoord, normal) index triple of every face corner into one deduplicated vertex.
+	** Every material the faces use becomes one ModelDataPart. MTL maps go to the PBR slots in ObjMapSlot,
+	** separate metallic and roughness maps (and the Pm/Pr/Ns scalars) are packed into one metallicRoughness
+	** texture laid out the way glTF has it (G = roughness, B = metallic).
+*/
+
+#ifndef _APP_OBJ_LOADER_H
+#define _APP_OBJ_LOADER_H
+
+#define OBJ_CHUNK_SIZE           Megabytes(1) //chunks end at the first newline after this many bytes, small enough that a file of a few MB is spread across the job workers
+#define OBJ_INDEX_NONE           INT32_MIN //the corner has no texCoord/normal
+#define OBJ_KEY_NONE             UINT32_MAX //the vertex has no texCoord/normal
+#define OBJ_VERTEX_NONE          UINT32_MAX //empty ObjVertexTable slot
+#define OBJ_TEXTURE_NONE         UINTXX_MAX
+#define OBJ_DEFAULT_MATERIAL     "default" //faces before the first usemtl
+#define OBJ_DEFAULT_ROUGHNESS    0.5f //when a material has no Pr, map_Pr or Ns
+#define OBJ_MAX_MANTISSA         1000000000000000000ULL //10^18, digits past this only move the exponent
+
+typedef enum ObjMapSlot ObjMapSlot;
+enum ObjMapSlot
+{
+	ObjMapSlot_Albedo = 0, //map_Kd
+	ObjMapSlot_Normal,     //norm, map_Bump, bump
+	ObjMapSlot_Metallic,   //map_Pm
+	ObjMapSlot_Roughness,  //map_Pr
+	ObjMapSlot_Occlusion,  //map_ao, map_Ka
+	ObjMapSlot_Count,
+};
+
+// indices[0] = position, [1] = texCoord, [2] = normal. Absolute (0-based) indices unless
+// bit n of relativeMask is set, then indices[n] is relative to the start of the chunk
+typedef struct ObjCorner ObjCorner;
+struct ObjCorner
+{
+	i32 indices[3];
+	u32 relativeMask;
+};
+
+typedef struct ObjMaterialRun ObjMaterialRun;
+struct ObjMaterialRun
+{
+	Str8 materialName; //points into the file contents
+	uxx firstCorner;
+};
+
+typedef struct ObjChunk ObjChunk;
+struct ObjChunk
+{
+	Arena* arena;
+	Str8 text;
+	VarArray positions; //v3
+	VarArray colors; //v3, empty when no "v" line in the chunk had a color, otherwise parallel to positions
+	VarArray texCoords; //v2
+	VarArray normals; //v3
+	VarArray corners; //ObjCorner, 3 per triangle (polygons are fanned)
+	VarArray materialRuns; //ObjMaterialRun
+	VarArray materialLibs; //Str8, point into the file contents
+	uxx numLines;
+	uxx numBadLines;
+};
+
+// A contiguous range of one chunk's corners that all use the same material
+typedef struct ObjFaceRange ObjFaceRange;
+struct ObjFaceRange
+{
+	uxx chunkIndex;
+	uxx firstCorner;
+	uxx numCorners;
+	uxx partIndex;
+};
+
+// Absolute indices of the position, texCoord and normal that make up one vertex (OBJ_KEY_NONE when missing)
+typedef struct ObjVertexKey ObjVertexKey;
+struct ObjVertexKey
+{
+	u32 indices[3];
+};
+
+// Open addressing table of vertex indices, the keys live in a VarArray parallel to the part's vertices
+typedef struct ObjVertexTable ObjVertexTable;
+struct ObjVertexTable
+{
+	Arena* arena;
+	uxx numSlots; //always a power of 2
+	u32* slots; //vertex index or OBJ_VERTEX_NONE
+	VarArray keys; //ObjVertexKey
+};
+
+// Every image file the MTL (or the texture naming convention) points at is decoded at most once
+typedef struct ObjImage ObjImage;
+struct ObjImage
+{
+	FilePath path;
+	bool isRead; //the file exists, its contents wait in fileContents until DecodeObjImages runs
+	Str8 fileContents;
+	bool isLoaded; //false when the file was missing or couldn't be decoded
+	ImageData imageData;
+	uxx textureIndex; //OBJ_TEXTURE_NONE until the image is added to the ModelData's textures
+};
+
+typedef struct ObjMaterial ObjMaterial;
+struct ObjMaterial
+{
+	Str8 name;
+	v4r albedoFactor; //Kd and d
+	r32 metallic; //Pm
+	r32 roughness; //Pr, negative when the MTL didn't have one
+	r32 shininess; //Ns, only used for the roughness when there's no Pr, negative when the MTL didn't have one
+	FilePath maps[ObjMapSlot_Count];
+};
+
+typedef struct ObjLoadStats ObjLoadStats;
+struct ObjLoadStats
+{
+	uxx fileSize;
+	uxx numChunks;
+	uxx numLines;
+	uxx numBadLines;
+	uxx numPositions;
+	uxx numTriangles;
+	uxx numBadTriangles; //referenced an index that doesn't exist
+	uxx numVertices; //after deduplication
+	uxx numTextures;
+	r64 parseMs;
+	r64 mergeMs;
+	r64 materialMs;
+};
+
+typedef struct ObjBenchmarkResult ObjBenchmarkResult;
+struct ObjBenchmarkResult
+{
+	uxx gridSize;
+	ObjLoadStats stats;
+	r64 generateMs;
+	bool resultsMatch;
+};
+
+#endif //  _APP_OBJ_LOADER_H
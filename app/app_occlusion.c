@@ -0,0 +1,553 @@
+/*
+File:   app_occlusion.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the occluder mesh simplification, the SIMD depth rasterizer and the box
+	** visibility test for the OcclusionBuffer (see app_occlusion.h)
+	** NOTE: The rasterizer runs 8 pixels at a time with AVX2 (FMA edge functions and an integer max for the
+	** depth merge) and 4 at a time with SSE/NEON. AVX without AVX2 uses the SSE path
+*/
+
+// +--------------------------------------------------------------+
+// |                          SIMD Lanes                          |
+// +--------------------------------------------------------------+
+#if OCC_SIMD_AVX2
+typedef __m256 OccLane;
+typedef __m256 OccMask;
+#define OccLoad(pntr)             _mm256_loadu_ps(pntr)
+#define OccStore(pntr, lane)      _mm256_storeu_ps((pntr), (lane))
+#define OccSet1(value)            _mm256_set1_ps(value)
+#define OccAdd(left, right)       _mm256_add_ps((left), (right))
+#if defined(__FMA__) || defined(_MSC_VER) //MSVC's /arch:AVX2 implies FMA, clang and gcc need -mfma on top of -mavx2
+#define OccMulAdd(mul1, mul2, add) _mm256_fmadd_ps((mul1), (mul2), (add))
+#else
+#define OccMulAdd(mul1, mul2, add) _mm256_add_ps(_mm256_mul_ps((mul1), (mul2)), (add))
+#endif
+//Depth values are never negative so their bit patterns sort the same way as signed integers
+#define OccMax(left, right)       _mm256_castsi256_ps(_mm256_max_epi32(_mm256_castps_si256(left), _mm256_castps_si256(right)))
+#define OccGreater(left, right)   _mm256_cmp_ps((left), (right), _CMP_GT_OQ)
+#define OccGreaterEq(left, right) _mm256_cmp_ps((left), (right), _CMP_GE_OQ)
+#define OccMaskAnd(left, right)   _mm256_and_ps((left), (right))
+#define OccMaskValue(mask, value) _mm256_and_ps((mask), (value))
+#elif OCC_SIMD_SSE
+typedef __m128 OccLane;
+typedef __m128 OccMask;
+#define OccLoad(pntr)             _mm_loadu_ps(pntr)
+#define OccStore(pntr, lane)      _mm_storeu_ps((pntr), (lane))
+#define OccSet1(value)            _mm_set1_ps(value)
+#define OccAdd(left, right)       _mm_add_ps((left), (right))
+#define OccMulAdd(mul1, mul2, add) _mm_add_ps(_mm_mul_ps((mul1), (mul2)), (add))
+#define OccMax(left, right)       _mm_max_ps((left), (right))
+#define OccGreater(left, right)   _mm_cmpgt_ps((left), (right))
+#define OccGreaterEq(left, right) _mm_cmpge_ps((left), (right))
+#define OccMaskAnd(left, right)   _mm_and_ps((left), (right))
+#define OccMaskValue(mask, value) _mm_and_ps((mask), (value))
+#elif OCC_SIMD_NEON
+typedef float32x4_t OccLane;
+typedef uint32x4_t OccMask;
+#define OccLoad(pntr)             vld1q_f32(pntr)
+#define OccStore(pntr, lane)      vst1q_f32((pntr), (lane))
+#define OccSet1(value)            vdupq_n_f32(value)
+#define OccAdd(left, right)       vaddq_f32((left), (right))
+#define OccMulAdd(mul1, mul2, add) vmlaq_f32((add), (mul1), (mul2))
+#define OccMax(left, right)       vmaxq_f32((left), (right))
+#define OccGreater(left, right)   vcgtq_f32((left), (right))
+#define OccGreaterEq(left, right) vcgeq_f32((left), (right))
+#define OccMaskAnd(left, right)   vandq_u32((left), (right))
+#define OccMaskValue(mask, value) vreinterpretq_f32_u32(vandq_u32((mask), vreinterpretq_u32_f32(value)))
+#else
+typedef r32 OccLane;
+typedef bool OccMask;
+#define OccLoad(pntr)             (*(pntr))
+#define OccStore(pntr, lane)      (*(pntr) = (lane))
+#define OccSet1(value)            (value)
+#define OccAdd(left, right)       ((left) + (right))
+#define OccMulAdd(mul1, mul2, add) ((mul1) * (mul2) + (add))
+#define OccMax(left, right)       MaxR32((left), (right))
+#define OccGreater(left, right)   ((left) > (right))
+#define OccGreaterEq(left, right) ((left) >= (right))
+#define OccMaskAnd(left, right)   ((left) && (right))
+#define OccMaskValue(mask, value) ((mask) ? (value) : 0.0f)
+#endif
+
+// +--------------------------------------------------------------+
+// |                        Occluder Mesh                         |
+// +--------------------------------------------------------------+
+static uxx GetOccluderCell(box bounds, v3 cellScale, v3 position)
+{
+	uxx cellX = (uxx)ClampI32((i32)((position.X - bounds.BottomLeftBack.X) * cellScale.X), 0, OCCLUDER_CLUSTER_GRID-1);
+	uxx cellY = (uxx)ClampI32((i32)((position.Y - bounds.BottomLeftBack.Y) * cellScale.Y), 0, OCCLUDER_CLUSTER_GRID-1);
+	uxx cellZ = (uxx)ClampI32((i32)((position.Z - bounds.BottomLeftBack.Z) * cellScale.Z), 0, OCCLUDER_CLUSTER_GRID-1);
+	return cellX + (cellY * OCCLUDER_CLUSTER_GRID) + (cellZ * OCCLUDER_CLUSTER_GRID * OCCLUDER_CLUSTER_GRID);
+}
+
+void FreeOccluderMesh(Arena* arena, OccluderMesh* mesh)
+{
+	NotNull(mesh);
+	if (mesh->vertices != nullptr) { FreeMem(arena, mesh->vertices, sizeof(v3) * mesh->numVertices); }
+	if (mesh->indices != nullptr) { FreeMem(arena, mesh->indices, sizeof(u32) * mesh->numIndices); }
+	ClearPointer(mesh);
+}
+
+// Simplifies every part of the model into one mesh by vertex clustering: vertices are snapped to the
+// average of all vertices in the same cell of an OCCLUDER_CLUSTER_GRID^3 grid over localBounds and
+// triangles that collapse are dropped. Averages stay inside the original geometry's hull so the
+// result can shrink slightly but doesn't grow much past the real silhouette
+OccluderMesh BuildOccluderMesh(Arena* arena, const Model3D* model)
+{
+	NotNull(arena);
+	NotNull(model);
+	OccluderMesh result = ZEROED;
+	ScratchBegin1(scratch, arena);
+	const uxx numCells = OCCLUDER_CLUSTER_GRID * OCCLUDER_CLUSTER_GRID * OCCLUDER_CLUSTER_GRID;
+	v3* cellSums = AllocArray(v3, scratch, numCells);
+	u32* cellCounts = AllocArray(u32, scratch, numCells);
+	u32* cellVertIndices = AllocArray(u32, scratch, numCells);
+	NotNull(cellSums);
+	NotNull(cellCounts);
+	NotNull(cellVertIndices);
+	for (uxx cIndex = 0; cIndex < numCells; cIndex++)
+	{
+		cellSums[cIndex] = V3_Zero;
+		cellCounts[cIndex] = 0;
+		cellVertIndices[cIndex] = UINT32_MAX;
+	}
+	
+	box bounds = model->localBounds;
+	v3 cellScale = NewV3(
+		(bounds.Size.X > 0) ? (OCCLUDER_CLUSTER_GRID * 0.9999f) / bounds.Size.X : 0.0f,
+		(bounds.Size.Y > 0) ? (OCCLUDER_CLUSTER_GRID * 0.9999f) / bounds.Size.Y : 0.0f,
+		(bounds.Size.Z > 0) ? (OCCLUDER_CLUSTER_GRID * 0.9999f) / bounds.Size.Z : 0.0f
+	);
+	
+	uxx maxIndices = 0;
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+		const mat4* partLocalMat = VarArrayGetHard(mat4, &model->partLocalMats, pIndex);
+		const Vertex3D* vertices = (const Vertex3D*)part->vertices.items;
+		for (uxx vIndex = 0; vIndex < part->vertices.length; vIndex++)
+		{
+			v3 position = TransformPointByMat4(partLocalMat, vertices[vIndex].position);
+			uxx cell = GetOccluderCell(bounds, cellScale, position);
+			cellSums[cell] = Add(cellSums[cell], position);
+			cellCounts[cell]++;
+		}
+		maxIndices += (part->indices.length > 0) ? part->indices.length : part->vertices.length;
+	}
+	
+	u32* indices = AllocArray(u32, scratch, maxIndices);
+	NotNull(indices);
+	uxx numIndices = 0;
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+		const mat4* partLocalMat = VarArrayGetHard(mat4, &model->partLocalMats, pIndex);
+		const Vertex3D* vertices = (const Vertex3D*)part->vertices.items;
+		const i32* partIndices = (const i32*)part->indices.items;
+		uxx numPartIndices = (part->indices.length > 0) ? part->indices.length : part->vertices.length;
+		for (uxx iIndex = 0; iIndex + 2 < numPartIndices; iIndex += 3)
+		{
+			u32 cells[3];
+			for (uxx cornerIndex = 0; cornerIndex < 3; cornerIndex++)
+			{
+				uxx vIndex = (part->indices.length > 0) ? (uxx)partIndices[iIndex + cornerIndex] : (iIndex + cornerIndex);
+				cells[cornerIndex] = (u32)GetOccluderCell(bounds, cellScale, TransformPointByMat4(partLocalMat, vertices[vIndex].position));
+			}
+			if (cells[0] == cells[1] || cells[1] == cells[2] || cells[2] == cells[0]) { continue; }
+			for (uxx cornerIndex = 0; cornerIndex < 3; cornerIndex++)
+			{
+				if (cellVertIndices[cells[cornerIndex]] == UINT32_MAX) { cellVertIndices[cells[cornerIndex]] = (u32)result.numVertices++; }
+				indices[numIndices++] = cellVertIndices[cells[cornerIndex]];
+			}
+		}
+	}
+	
+	if (numIndices > 0)
+	{
+		result.vertices = AllocArray(v3, arena, result.numVertices);
+		result.indices = AllocArray(u32, arena, numIndices);
+		NotNull(result.vertices);
+		NotNull(result.indices);
+		result.numIndices = numIndices;
+		MyMemCopy(result.indices, indices, sizeof(u32) * numIndices);
+		for (uxx cIndex = 0; cIndex < numCells; cIndex++)
+		{
+			if (cellVertIndices[cIndex] == UINT32_MAX) { continue; }
+			result.vertices[cellVertIndices[cIndex]] = Mul(cellSums[cIndex], 1.0f / (r32)cellCounts[cIndex]);
+		}
+	}
+	else { result.numVertices = 0; }
+	ScratchEnd(scratch);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                        Init and Clear                        |
+// +--------------------------------------------------------------+
+void FreeOcclusionBuffer(OcclusionBuffer* occlusion)
+{
+	NotNull(occlusion);
+	if (occlusion->arena != nullptr)
+	{
+		FreeMem(occlusion->arena, occlusion->depth, sizeof(r32) * occlusion->width * occlusion->height);
+		FreeMem(occlusion->arena, occlusion->tileMinDepth, sizeof(r32) * occlusion->numTilesX * occlusion->numTilesY);
+		FreeVarArray(&occlusion->triangles);
+		FreeOccluderMesh(occlusion->arena, &occlusion->unitCubeOccluder);
+	}
+	ClearPointer(occlusion);
+}
+
+void InitOcclusionBuffer(Arena* arena, OcclusionBuffer* occlusionOut)
+{
+	NotNull(arena);
+	NotNull(occlusionOut);
+	Assert((OCCLUSION_BUFFER_WIDTH % OCC_LANE_WIDTH) == 0);
+	Assert((OCCLUSION_BUFFER_WIDTH % OCCLUSION_TILE_SIZE) == 0 && (OCCLUSION_BUFFER_HEIGHT % OCCLUSION_TILE_SIZE) == 0);
+	ClearPointer(occlusionOut);
+	occlusionOut->arena = arena;
+	occlusionOut->width = OCCLUSION_BUFFER_WIDTH;
+	occlusionOut->height = OCCLUSION_BUFFER_HEIGHT;
+	occlusionOut->numTilesX = OCCLUSION_BUFFER_WIDTH / OCCLUSION_TILE_SIZE;
+	occlusionOut->numTilesY = OCCLUSION_BUFFER_HEIGHT / OCCLUSION_TILE_SIZE;
+	occlusionOut->depth = AllocArray(r32, arena, occlusionOut->width * occlusionOut->height);
+	occlusionOut->tileMinDepth = AllocArray(r32, arena, occlusionOut->numTilesX * occlusionOut->numTilesY);
+	NotNull(occlusionOut->depth);
+	NotNull(occlusionOut->tileMinDepth);
+	InitVarArrayWithInitial(OcclusionTriangle, &occlusionOut->triangles, arena, 1024);
+	
+	// Unit cube from (0,0,0) to (1,1,1), the DrawAsBox world matrices already contain the -0.5 pivot
+	OccluderMesh* cube = &occlusionOut->unitCubeOccluder;
+	cube->numVertices = 8;
+	cube->numIndices = 36;
+	cube->vertices = AllocArray(v3, arena, cube->numVertices);
+	cube->indices = AllocArray(u32, arena, cube->numIndices);
+	NotNull(cube->vertices);
+	NotNull(cube->indices);
+	for (uxx vIndex = 0; vIndex < 8; vIndex++) { cube->vertices[vIndex] = NewV3((r32)(vIndex & 1), (r32)((vIndex >> 1) & 1), (r32)((vIndex >> 2) & 1)); }
+	const u32 cubeIndices[36] = {
+		0, 2, 1,  1, 2, 3, //-Z
+		4, 5, 6,  5, 7, 6, //+Z
+		0, 1, 4,  1, 5, 4, //-Y
+		2, 6, 3,  3, 6, 7, //+Y
+		0, 4, 2,  2, 4, 6, //-X
+		1, 3, 5,  3, 7, 5, //+X
+	};
+	MyMemCopy(cube->indices, &cubeIndices[0], sizeof(cubeIndices));
+}
+
+void ClearOcclusionBuffer(OcclusionBuffer* occlusion)
+{
+	NotNull(occlusion);
+	MyMemSet(occlusion->depth, 0x00, sizeof(r32) * occlusion->width * occlusion->height);
+	MyMemSet(occlusion->tileMinDepth, 0x00, sizeof(r32) * occlusion->numTilesX * occlusion->numTilesY);
+	VarArrayClear(&occlusion->triangles);
+	occlusion->numOccluders = 0;
+	occlusion->numTestedBoxes = 0;
+	occlusion->numOccludedBoxes = 0;
+}
+
+// +--------------------------------------------------------------+
+// |                         Setup Pass                           |
+// +--------------------------------------------------------------+
+static inline v4 TransformOcclusionPoint(const mat4* matrix, v3 point)
+{
+	return NewV4(
+		matrix->Elements[0][0]*point.X + matrix->Elements[1][0]*point.Y + matrix->Elements[2][0]*point.Z + matrix->Elements[3][0],
+		matrix->Elements[0][1]*point.X + matrix->Elements[1][1]*point.Y + matrix->Elements[2][1]*point.Z + matrix->Elements[3][1],
+		matrix->Elements[0][2]*point.X + matrix->Elements[1][2]*point.Y + matrix->Elements[2][2]*point.Z + matrix->Elements[3][2],
+		matrix->Elements[0][3]*point.X + matrix->Elements[1][3]*point.Y + matrix->Elements[2][3]*point.Z + matrix->Elements[3][3]
+	);
+}
+
+static void AddOcclusionTriangle(OcclusionBuffer* occlusion, v4 clip0, v4 clip1, v4 clip2)
+{
+	v4 clips[3] = { clip0, clip1, clip2 };
+	OcclusionTriangle triangle = ZEROED;
+	r32 minY = HighestR32;
+	r32 maxY = LowestR32;
+	for (uxx cIndex = 0; cIndex < 3; cIndex++)
+	{
+		r32 invW = 1.0f / clips[cIndex].W;
+		triangle.x[cIndex] = (clips[cIndex].X * invW * 0.5f + 0.5f) * (r32)occlusion->width;
+		triangle.y[cIndex] = (0.5f - clips[cIndex].Y * invW * 0.5f) * (r32)occlusion->height;
+		triangle.invW[cIndex] = invW;
+		minY = MinR32(minY, triangle.y[cIndex]);
+		maxY = MaxR32(maxY, triangle.y[cIndex]);
+	}
+	if (maxY < 0 || minY >= (r32)occlusion->height) { return; }
+	triangle.minY = ClampI32(FloorR32i(minY), 0, (i32)occlusion->height-1);
+	triangle.maxY = ClampI32(CeilR32i(maxY), 0, (i32)occlusion->height-1);
+	OcclusionTriangle* newTriangle = VarArrayAdd(OcclusionTriangle, &occlusion->triangles);
+	NotNull(newTriangle);
+	*newTriangle = triangle;
+}
+
+// Transforms the mesh into clip space, clips every triangle against w = OCCLUSION_NEAR_W and queues the result for rasterization
+void AddOccluderToOcclusionBuffer(OcclusionBuffer* occlusion, const OccluderMesh* mesh, mat4 viewProjMat, mat4 worldMat)
+{
+	NotNull(occlusion);
+	NotNull(mesh);
+	if (mesh->numIndices == 0) { return; }
+	ScratchBegin(scratch);
+	mat4 clipMat = Mul(viewProjMat, worldMat);
+	v4* clipVerts = AllocArray(v4, scratch, mesh->numVertices);
+	NotNull(clipVerts);
+	for (uxx vIndex = 0; vIndex < mesh->numVertices; vIndex++) { clipVerts[vIndex] = TransformOcclusionPoint(&clipMat, mesh->vertices[vIndex]); }
+	for (uxx iIndex = 0; iIndex + 2 < mesh->numIndices; iIndex += 3)
+	{
+		v4 corners[3] = { clipVerts[mesh->indices[iIndex+0]], clipVerts[mesh->indices[iIndex+1]], clipVerts[mesh->indices[iIndex+2]] };
+		bool inFront[3] = { corners[0].W >= OCCLUSION_NEAR_W, corners[1].W >= OCCLUSION_NEAR_W, corners[2].W >= OCCLUSION_NEAR_W };
+		uxx numInFront = (inFront[0] ? 1 : 0) + (inFront[1] ? 1 : 0) + (inFront[2] ? 1 : 0);
+		if (numInFront == 3) { AddOcclusionTriangle(occlusion, corners[0], corners[1], corners[2]); continue; }
+		if (numInFront == 0) { continue; }
+		//Sutherland-Hodgman against the near plane gives a polygon of 3 or 4 vertices
+		v4 polygon[4];
+		uxx numPolygonVerts = 0;
+		for (uxx cIndex = 0; cIndex < 3; cIndex++)
+		{
+			v4 current = corners[cIndex];
+			v4 next = corners[(cIndex+1) % 3];
+			bool currentInFront = inFront[cIndex];
+			bool nextInFront = inFront[(cIndex+1) % 3];
+			if (currentInFront) { polygon[numPolygonVerts++] = current; }
+			if (currentInFront != nextInFront)
+			{
+				r32 lerp = (OCCLUSION_NEAR_W - current.W) / (next.W - current.W);
+				polygon[numPolygonVerts++] = NewV4(
+					current.X + (next.X - current.X) * lerp,
+					current.Y + (next.Y - current.Y) * lerp,
+					current.Z + (next.Z - current.Z) * lerp,
+					OCCLUSION_NEAR_W
+				);
+			}
+		}
+		Assert(numPolygonVerts >= 3 && numPolygonVerts <= 4);
+		AddOcclusionTriangle(occlusion, polygon[0], polygon[1], polygon[2]);
+		if (numPolygonVerts == 4) { AddOcclusionTriangle(occlusion, polygon[0], polygon[2], polygon[3]); }
+	}
+	occlusion->numOccluders++;
+	ScratchEnd(scratch);
+}
+
+// +--------------------------------------------------------------+
+// |                          Rasterizer                          |
+// +--------------------------------------------------------------+
+// Pixels exactly on an edge belong to the triangle only when it's a top or left edge (the same fill rule GPUs use),
+// so the two triangles on either side of a shared edge cover it exactly once and a mesh has no cracks along its diagonals
+#define OccEdgeInside(isTopLeft, edgeValue, zero) ((isTopLeft) ? OccGreaterEq((edgeValue), (zero)) : OccGreater((edgeValue), (zero)))
+
+// Rasterizes one triangle into the rows [bandMinY, bandMaxY] keeping the largest 1/w (nearest) per pixel
+static void RasterizeOcclusionTriangle(OcclusionBuffer* occlusion, const OcclusionTriangle* triangle, i32 bandMinY, i32 bandMaxY)
+{
+	r32 x0 = triangle->x[0], y0 = triangle->y[0], z0 = triangle->invW[0];
+	r32 x1 = triangle->x[1], y1 = triangle->y[1], z1 = triangle->invW[1];
+	r32 x2 = triangle->x[2], y2 = triangle->y[2], z2 = triangle->invW[2];
+	r32 doubleArea = (x1 - x0)*(y2 - y0) - (x2 - x0)*(y1 - y0);
+	if (AbsR32(doubleArea) < 1e-6f) { return; }
+	r32 orientation = (doubleArea > 0) ? 1.0f : -1.0f;
+	
+	//Edge i goes from vertex i to vertex i+1, E(x,y) = A*x + B*y + C. Flipping by orientation makes the inside positive regardless of winding
+	r32 edgeA[3] = { (y0 - y1)*orientation, (y1 - y2)*orientation, (y2 - y0)*orientation };
+	r32 edgeB[3] = { (x1 - x0)*orientation, (x2 - x1)*orientation, (x0 - x2)*orientation };
+	r32 edgeC[3] = { (x0*y1 - x1*y0)*orientation, (x1*y2 - x2*y1)*orientation, (x2*y0 - x0*y2)*orientation };
+	//With y pointing down the inside is to the right of a left edge (A > 0) and below a horizontal top edge (A == 0, B > 0)
+	bool isTopLeft[3];
+	for (uxx eIndex = 0; eIndex < 3; eIndex++) { isTopLeft[eIndex] = (edgeA[eIndex] > 0 || (edgeA[eIndex] == 0 && edgeB[eIndex] > 0)); }
+	r32 depthDx = ((z1 - z0)*(y2 - y0) - (z2 - z0)*(y1 - y0)) / doubleArea;
+	r32 depthDy = ((x1 - x0)*(z2 - z0) - (x2 - x0)*(z1 - z0)) / doubleArea;
+	r32 depthC = z0 - depthDx*x0 - depthDy*y0;
+	
+	i32 minX = ClampI32(FloorR32i(MinR32(x0, MinR32(x1, x2))), 0, (i32)occlusion->width-1);
+	i32 maxX = ClampI32(CeilR32i(MaxR32(x0, MaxR32(x1, x2))), 0, (i32)occlusion->width-1);
+	i32 minY = MaxI32(triangle->minY, bandMinY);
+	i32 maxY = MinI32(triangle->maxY, bandMaxY);
+	if (minX > maxX || minY > maxY) { return; }
+	minX -= (minX % OCC_LANE_WIDTH);
+	
+	r32 laneOffsets[OCC_LANE_WIDTH];
+	for (uxx lane = 0; lane < OCC_LANE_WIDTH; lane++) { laneOffsets[lane] = (r32)lane; }
+	OccLane laneOffsetsX = OccLoad(&laneOffsets[0]);
+	OccLane zero = OccSet1(0.0f);
+	OccLane edgeA0 = OccSet1(edgeA[0]), edgeA1 = OccSet1(edgeA[1]), edgeA2 = OccSet1(edgeA[2]);
+	OccLane depthDxLane = OccSet1(depthDx);
+	for (i32 yIndex = minY; yIndex <= maxY; yIndex++)
+	{
+		r32 pixelY = (r32)yIndex + 0.5f;
+		OccLane rowEdge0 = OccSet1(edgeB[0]*pixelY + edgeC[0]);
+		OccLane rowEdge1 = OccSet1(edgeB[1]*pixelY + edgeC[1]);
+		OccLane rowEdge2 = OccSet1(edgeB[2]*pixelY + edgeC[2]);
+		OccLane rowDepth = OccSet1(depthDy*pixelY + depthC);
+		r32* depthRow = &occlusion->depth[yIndex * occlusion->width];
+		for (i32 xIndex = minX; xIndex <= maxX; xIndex += OCC_LANE_WIDTH)
+		{
+			OccLane pixelX = OccAdd(OccSet1((r32)xIndex + 0.5f), laneOffsetsX);
+			OccMask inside = OccMaskAnd(
+				OccMaskAnd(
+					OccEdgeInside(isTopLeft[0], OccMulAdd(edgeA0, pixelX, rowEdge0), zero),
+					OccEdgeInside(isTopLeft[1], OccMulAdd(edgeA1, pixelX, rowEdge1), zero)
+				),
+				OccEdgeInside(isTopLeft[2], OccMulAdd(edgeA2, pixelX, rowEdge2), zero)
+			);
+			OccLane depth = OccMulAdd(depthDxLane, pixelX, rowDepth);
+			//Masked off lanes become 0 which never wins against the (non-negative) buffer
+			OccStore(&depthRow[xIndex], OccMax(OccLoad(&depthRow[xIndex]), OccMaskValue(inside, depth)));
+		}
+	}
+}
+
+// Rasterizes every queued triangle that touches one row of tiles and then refreshes the tile minimums for that row.
+// Rows write disjoint parts of the buffer so they can run on separate threads
+void RasterizeOcclusionTileRow(OcclusionBuffer* occlusion, uxx tileY)
+{
+	NotNull(occlusion);
+	Assert(tileY < occlusion->numTilesY);
+	i32 bandMinY = (i32)(tileY * OCCLUSION_TILE_SIZE);
+	i32 bandMaxY = bandMinY + OCCLUSION_TILE_SIZE - 1;
+	VarArrayLoop(&occlusion->triangles, tIndex)
+	{
+		VarArrayLoopGet(OcclusionTriangle, triangle, &occlusion->triangles, tIndex);
+		if (triangle->maxY < bandMinY || triangle->minY > bandMaxY) { continue; }
+		RasterizeOcclusionTriangle(occlusion, triangle, bandMinY, bandMaxY);
+	}
+	for (uxx tileX = 0; tileX < occlusion->numTilesX; tileX++)
+	{
+		r32 tileMin = HighestR32;
+		for (i32 yIndex = bandMinY; yIndex <= bandMaxY; yIndex++)
+		{
+			const r32* depthRow = &occlusion->depth[yIndex * occlusion->width + tileX * OCCLUSION_TILE_SIZE];
+			for (uxx xIndex = 0; xIndex < OCCLUSION_TILE_SIZE; xIndex++) { tileMin = MinR32(tileMin, depthRow[xIndex]); }
+		}
+		occlusion->tileMinDepth[tileY * occlusion->numTilesX + tileX] = tileMin;
+	}
+}
+
+static JOB_FUNC_DEF(RasterizeOcclusionTileRowJob)
+{
+	RasterizeOcclusionTileRow((OcclusionBuffer*)userPntr, jobIndex);
+}
+
+// Every row of tiles is one job
+void RasterizeOcclusionBuffer(OcclusionBuffer* occlusion, JobSystem* jobs)
+{
+	NotNull(occlusion);
+	RunJobs(jobs, occlusion->numTilesY, RasterizeOcclusionTileRowJob, occlusion);
+}
+
+// +--------------------------------------------------------------+
+// |                          Box Test                            |
+// +--------------------------------------------------------------+
+// Returns false only when every pixel the box's screen rectangle covers has an occluder nearer than the box's nearest corner
+bool IsBoxVisibleInOcclusionBuffer(OcclusionBuffer* occlusion, mat4 viewProjMat, box bounds)
+{
+	NotNull(occlusion);
+	occlusion->numTestedBoxes++;
+	r32 minX = HighestR32, minY = HighestR32;
+	r32 maxX = LowestR32, maxY = LowestR32;
+	r32 nearestInvW = 0.0f;
+	for (uxx cIndex = 0; cIndex < 8; cIndex++)
+	{
+		v3 corner = NewV3(
+			bounds.BottomLeftBack.X + ((cIndex & 1) ? bounds.Size.X : 0.0f),
+			bounds.BottomLeftBack.Y + ((cIndex & 2) ? bounds.Size.Y : 0.0f),
+			bounds.BottomLeftBack.Z + ((cIndex & 4) ? bounds.Size.Z : 0.0f)
+		);
+		v4 clip = TransformOcclusionPoint(&viewProjMat, corner);
+		if (clip.W < OCCLUSION_NEAR_W) { return true; }
+		r32 invW = 1.0f / clip.W;
+		r32 pixelX = (clip.X * invW * 0.5f + 0.5f) * (r32)occlusion->width;
+		r32 pixelY = (0.5f - clip.Y * invW * 0.5f) * (r32)occlusion->height;
+		minX = MinR32(minX, pixelX); maxX = MaxR32(maxX, pixelX);
+		minY = MinR32(minY, pixelY); maxY = MaxR32(maxY, pixelY);
+		nearestInvW = MaxR32(nearestInvW, invW);
+	}
+	if (maxX < 0 || maxY < 0 || minX >= (r32)occlusion->width || minY >= (r32)occlusion->height) { return true; } //off screen, that's the frustum's job
+	i32 pixelMinX = ClampI32(FloorR32i(minX), 0, (i32)occlusion->width-1);
+	i32 pixelMaxX = ClampI32(CeilR32i(maxX), 0, (i32)occlusion->width-1);
+	i32 pixelMinY = ClampI32(FloorR32i(minY), 0, (i32)occlusion->height-1);
+	i32 pixelMaxY = ClampI32(CeilR32i(maxY), 0, (i32)occlusion->height-1);
+	
+	for (i32 tileY = pixelMinY / OCCLUSION_TILE_SIZE; tileY <= pixelMaxY / OCCLUSION_TILE_SIZE; tileY++)
+	{
+		for (i32 tileX = pixelMinX / OCCLUSION_TILE_SIZE; tileX <= pixelMaxX / OCCLUSION_TILE_SIZE; tileX++)
+		{
+			//Even the furthest occluder in this tile is in front of the box
+			if (nearestInvW < occlusion->tileMinDepth[tileY * occlusion->numTilesX + tileX]) { continue; }
+			i32 startX = MaxI32(pixelMinX, tileX * OCCLUSION_TILE_SIZE);
+			i32 endX = MinI32(pixelMaxX, tileX * OCCLUSION_TILE_SIZE + OCCLUSION_TILE_SIZE - 1);
+			i32 startY = MaxI32(pixelMinY, tileY * OCCLUSION_TILE_SIZE);
+			i32 endY = MinI32(pixelMaxY, tileY * OCCLUSION_TILE_SIZE + OCCLUSION_TILE_SIZE - 1);
+			for (i32 yIndex = startY; yIndex <= endY; yIndex++)
+			{
+				const r32* depthRow = &occlusion->depth[yIndex * occlusion->width];
+				for (i32 xIndex = startX; xIndex <= endX; xIndex++)
+				{
+					if (nearestInvW >= depthRow[xIndex]) { return true; }
+				}
+			}
+		}
+	}
+	occlusion->numOccludedBoxes++;
+	return false;
+}
+
+// +--------------------------------------------------------------+
+// |                      Instance Culling                        |
+// +--------------------------------------------------------------+
+// Rasterizes the nearest InstanceFlag_Occluder instances out of visibleInstances, then removes every
+// instance that is hidden behind them from visibleInstances (and marks it InstanceFlag_Culled)
+uxx CullOccludedInstances(OcclusionBuffer* occlusion, InstanceStore* store, JobSystem* jobs, mat4 viewProjMat, v3 cameraPos, VarArray* visibleInstances)
+{
+	NotNull(occlusion);
+	NotNull(store);
+	NotNull(visibleInstances);
+	ClearOcclusionBuffer(occlusion);
+	
+	//Keep the OCCLUSION_MAX_OCCLUDERS closest occluders, sorted nearest first
+	u32 occluders[OCCLUSION_MAX_OCCLUDERS];
+	r32 occluderDistances[OCCLUSION_MAX_OCCLUDERS];
+	uxx numOccluders = 0;
+	VarArrayLoop(visibleInstances, vIndex)
+	{
+		VarArrayLoopGet(u32, instanceIndex, visibleInstances, vIndex);
+		if (!IsFlagSet(store->flags[*instanceIndex], InstanceFlag_Occluder)) { continue; }
+		box bounds = store->bounds[*instanceIndex];
+		r32 distanceSquared = LengthSquared(Sub(Add(bounds.BottomLeftBack, Mul(bounds.Size, 0.5f)), cameraPos));
+		if (numOccluders == OCCLUSION_MAX_OCCLUDERS && distanceSquared >= occluderDistances[numOccluders-1]) { continue; }
+		uxx insertIndex = (numOccluders < OCCLUSION_MAX_OCCLUDERS) ? numOccluders++ : numOccluders-1;
+		while (insertIndex > 0 && occluderDistances[insertIndex-1] > distanceSquared)
+		{
+			occluders[insertIndex] = occluders[insertIndex-1];
+			occluderDistances[insertIndex] = occluderDistances[insertIndex-1];
+			insertIndex--;
+		}
+		occluders[insertIndex] = *instanceIndex;
+		occluderDistances[insertIndex] = distanceSquared;
+	}
+	for (uxx oIndex = 0; oIndex < numOccluders; oIndex++)
+	{
+		u32 iIndex = occluders[oIndex];
+		const OccluderMesh* mesh = &occlusion->unitCubeOccluder;
+		if (!IsFlagSet(store->flags[iIndex], InstanceFlag_DrawAsBox))
+		{
+			Model3D* model = GetInstanceModel(store, store->modelIds[iIndex]);
+			NotNull(model);
+			mesh = &model->occluder;
+		}
+		AddOccluderToOcclusionBuffer(occlusion, mesh, viewProjMat, store->sceneGraph->worldMats[store->sceneRoots[iIndex]]);
+	}
+	RasterizeOcclusionBuffer(occlusion, jobs);
+	
+	uxx numKept = 0;
+	u32* visibleIndices = (u32*)visibleInstances->items;
+	for (uxx vIndex = 0; vIndex < visibleInstances->length; vIndex++)
+	{
+		u32 iIndex = visibleIndices[vIndex];
+		if (IsBoxVisibleInOcclusionBuffer(occlusion, viewProjMat, store->bounds[iIndex])) { visibleIndices[numKept++] = iIndex; }
+		else { FlagSet(store->flags[iIndex], InstanceFlag_Culled); }
+	}
+	uxx numCulled = visibleInstances->length - numKept;
+	visibleInstances->length = numKept;
+	return numCulled;
+}
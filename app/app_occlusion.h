@@ -0,0 +1,86 @@
+/*
+File:   app_occlusion.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A CPU occlusion culling system in the spirit of Masked Occlusion Culling. A small set of
+	** nearby occluders (simplified copies of their meshes) are rasterized into a low resolution
+	** depth buffer and every instance that survived frustum culling has its AABB tested against
+	** it before anything is submitted to the GPU. The buffer stores 1/w so the result does not
+	** depend on which depth range the graphics backend uses. Each row of tiles only touches
+	** its own part of the buffer so the rows are rasterized as separate jobs.
+*/
+
+#ifndef _APP_OCCLUSION_H
+#define _APP_OCCLUSION_H
+
+// The 8 wide path needs AVX2 (for FMA and 256 bit integer max), plain AVX builds use the 4 wide SSE path
+#if defined(__AVX2__)
+#define OCC_SIMD_AVX2  1
+#define OCC_SIMD_SSE   0
+#define OCC_SIMD_NEON  0
+#define OCC_LANE_WIDTH 8
+#elif TRS_SIMD_AVX || TRS_SIMD_SSE
+#define OCC_SIMD_AVX2  0
+#define OCC_SIMD_SSE   1
+#define OCC_SIMD_NEON  0
+#define OCC_LANE_WIDTH 4
+#elif TRS_SIMD_NEON
+#define OCC_SIMD_AVX2  0
+#define OCC_SIMD_SSE   0
+#define OCC_SIMD_NEON  1
+#define OCC_LANE_WIDTH 4
+#else
+#define OCC_SIMD_AVX2  0
+#define OCC_SIMD_SSE   0
+#define OCC_SIMD_NEON  0
+#define OCC_LANE_WIDTH 1
+#endif
+
+#define OCCLUSION_BUFFER_WIDTH    320 //must be a multiple of OCC_LANE_WIDTH
+#define OCCLUSION_BUFFER_HEIGHT   192
+#define OCCLUSION_TILE_SIZE       8 //both dimensions of the buffer must be a multiple of this
+#define OCCLUSION_MAX_OCCLUDERS   64
+#define OCCLUSION_NEAR_W          0.05f //occluder triangles are clipped against this w and boxes that cross it are always visible
+#define OCCLUDER_CLUSTER_GRID     8 //vertex clustering cells along each axis of the model's bounds when building an OccluderMesh
+
+// A cheap stand-in for a model's geometry that is only ever rasterized into the OcclusionBuffer
+typedef struct OccluderMesh OccluderMesh;
+struct OccluderMesh
+{
+	uxx numVertices;
+	v3* vertices; //model space (part transforms already applied)
+	uxx numIndices;
+	u32* indices;
+};
+
+// Screen-space triangle in buffer pixel coordinates, produced by the setup pass
+typedef struct OcclusionTriangle OcclusionTriangle;
+struct OcclusionTriangle
+{
+	r32 x[3];
+	r32 y[3];
+	r32 invW[3];
+	i32 minY;
+	i32 maxY;
+};
+
+typedef struct OcclusionBuffer OcclusionBuffer;
+struct OcclusionBuffer
+{
+	Arena* arena;
+	uxx width;
+	uxx height;
+	uxx numTilesX;
+	uxx numTilesY;
+	r32* depth; //1/w of the nearest occluder, 0 where there is none
+	r32* tileMinDepth; //smallest depth value in each tile, i.e. the furthest occluder in that tile
+	VarArray triangles; //OcclusionTriangle
+	OccluderMesh unitCubeOccluder; //used for InstanceFlag_DrawAsBox instances
+	
+	uxx numOccluders;
+	uxx numTestedBoxes;
+	uxx numOccludedBoxes;
+};
+
+#endif //  _APP_OCCLUSION_H
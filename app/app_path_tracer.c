@@ -0,0 +1,861 @@
+/*
+File:   app_path_tracer.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the scene flattening, packet traversal, shading and image output of the PathTracer (see app_path_tracer.h)
+	** NOTE: The traversal reuses the SoA node test and the BvhLane helpers from app_bvh.c, a node tests
+	** its 4 children against each ray of the packet and a leaf tests each triangle against all 4 rays at once
+*/
+
+const char* GetPathTracerModeStr(PathTracerMode enumValue)
+{
+	switch (enumValue)
+	{
+		case PathTracerMode_Shader:           return "Shader";
+		case PathTracerMode_Reference:        return "Reference";
+		case PathTracerMode_AmbientOcclusion: return "AmbientOcclusion";
+		default: return "Unknown";
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+static inline uxx CountPathTracerLanes(u32 laneMask)
+{
+	uxx result = 0;
+	for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++) { if (laneMask & (1u << lane)) { result++; } }
+	return result;
+}
+
+static inline v3 TransformPathTracerDirection(const mat4* matrix, v3 direction)
+{
+	return Sub(TransformPointByMat4(matrix, direction), TransformPointByMat4(matrix, V3_Zero));
+}
+
+static inline v3 MulPathTracerV3(v3 left, v3 right) { return NewV3(left.X * right.X, left.Y * right.Y, left.Z * right.Z); }
+static inline v3 PathTracerCross(v3 left, v3 right)
+{
+	return NewV3(left.Y * right.Z - left.Z * right.Y, left.Z * right.X - left.X * right.Z, left.X * right.Y - left.Y * right.X);
+}
+
+// Same direction as transpose(inverse(mat3(world))) * normal in the vertex shader: the cofactor matrix is the
+// inverse-transpose scaled by the determinant, so only the determinant's sign has to be put back. Not normalized
+static inline v3 TransformPathTracerNormal(const mat4* matrix, v3 normal)
+{
+	v3 column0 = TransformPathTracerDirection(matrix, NewV3(1, 0, 0));
+	v3 column1 = TransformPathTracerDirection(matrix, NewV3(0, 1, 0));
+	v3 column2 = TransformPathTracerDirection(matrix, NewV3(0, 0, 1));
+	v3 cofactor0 = PathTracerCross(column1, column2);
+	v3 cofactor1 = PathTracerCross(column2, column0);
+	v3 cofactor2 = PathTracerCross(column0, column1);
+	r32 determinantSign = (Dot(column0, cofactor0) < 0.0f) ? -1.0f : 1.0f;
+	return Mul(Add(Add(Mul(cofactor0, normal.X), Mul(cofactor1, normal.Y)), Mul(cofactor2, normal.Z)), determinantSign);
+}
+static inline bool IsPathTracerMatMirrored(const mat4* matrix)
+{
+	v3 column0 = TransformPathTracerDirection(matrix, NewV3(1, 0, 0));
+	v3 column1 = TransformPathTracerDirection(matrix, NewV3(0, 1, 0));
+	v3 column2 = TransformPathTracerDirection(matrix, NewV3(0, 0, 1));
+	return (Dot(column0, PathTracerCross(column1, column2)) < 0.0f);
+}
+
+// Orthonormal basis around a unit normal without branches on the axis (Duff et al. 2017)
+static void GetPathTracerBasis(v3 normal, v3* tangentOut, v3* bitangentOut)
+{
+	r32 sign = (normal.Z >= 0.0f) ? 1.0f : -1.0f;
+	r32 a = -1.0f / (sign + normal.Z);
+	r32 b = normal.X * normal.Y * a;
+	*tangentOut = NewV3(1.0f + sign * normal.X * normal.X * a, sign * b, -sign * normal.X);
+	*bitangentOut = NewV3(b, sign + normal.Y * normal.Y * a, -normal.Y);
+}
+
+static inline v3 PathTracerLocalToWorld(v3 local, v3 normal)
+{
+	v3 tangent, bitangent;
+	GetPathTracerBasis(normal, &tangent, &bitangent);
+	return Add(Add(Mul(tangent, local.X), Mul(bitangent, local.Y)), Mul(normal, local.Z));
+}
+
+static inline v3 SamplePathTracerCosineHemisphere(RandomSeries* random, v3 normal)
+{
+	r32 sampleU = GetRandR32Range(random, 0.0f, 1.0f);
+	r32 sampleV = GetRandR32Range(random, 0.0f, 1.0f);
+	r32 radius = SqrtR32(sampleU);
+	r32 phi = TwoPi32 * sampleV;
+	return PathTracerLocalToWorld(NewV3(radius * CosR32(phi), radius * SinR32(phi), SqrtR32(MaxR32(1.0f - sampleU, 0.0f))), normal);
+}
+
+static void SetPathTracerPacketRay(PathTracerPacket* packet, uxx lane, v3 origin, v3 direction, r32 maxDistance)
+{
+	packet->originX[lane] = origin.X;
+	packet->originY[lane] = origin.Y;
+	packet->originZ[lane] = origin.Z;
+	packet->directionX[lane] = direction.X;
+	packet->directionY[lane] = direction.Y;
+	packet->directionZ[lane] = direction.Z;
+	packet->inverseDirX[lane] = GetBvhInverseDir(direction.X);
+	packet->inverseDirY[lane] = GetBvhInverseDir(direction.Y);
+	packet->inverseDirZ[lane] = GetBvhInverseDir(direction.Z);
+	packet->maxDistance[lane] = maxDistance;
+}
+
+// +--------------------------------------------------------------+
+// |                           Textures                           |
+// +--------------------------------------------------------------+
+// srgbToLinearTable decodes the color channels of sRGB textures, pass nullptr for linear data
+static inline v4 GetPathTracerTexel(const PathTracerTexture* texture, i32 xIndex, i32 yIndex, const r32* srgbToLinearTable)
+{
+	xIndex %= texture->size.Width; if (xIndex < 0) { xIndex += texture->size.Width; }
+	yIndex %= texture->size.Height; if (yIndex < 0) { yIndex += texture->size.Height; }
+	const u8* texel = (const u8*)&texture->pixels[yIndex * texture->size.Width + xIndex];
+	if (srgbToLinearTable != nullptr) { return NewV4(srgbToLinearTable[texel[0]], srgbToLinearTable[texel[1]], srgbToLinearTable[texel[2]], texel[3] / 255.0f); }
+	return NewV4(texel[0] / 255.0f, texel[1] / 255.0f, texel[2] / 255.0f, texel[3] / 255.0f);
+}
+
+// Bilinear with repeat wrapping, sRGB texels are decoded before filtering like an sRGB texture format would (the pbr
+// shader gets plain RGBA8 albedo and decodes after filtering, which only differs between texels of very different color).
+// Missing textures read as white, the same as binding gfx.pixelTexture
+static v4 SamplePathTracerTexture(const PathTracerTexture* texture, v2 texCoord, const r32* srgbToLinearTable)
+{
+	if (texture->pixels == nullptr || texture->size.Width <= 0 || texture->size.Height <= 0) { return NewV4(1.0f, 1.0f, 1.0f, 1.0f); }
+	r32 pixelX = texCoord.X * (r32)texture->size.Width - 0.5f;
+	r32 pixelY = texCoord.Y * (r32)texture->size.Height - 0.5f;
+	r32 floorX = FloorR32(pixelX);
+	r32 floorY = FloorR32(pixelY);
+	r32 fracX = pixelX - floorX;
+	r32 fracY = pixelY - floorY;
+	i32 xIndex = (i32)floorX;
+	i32 yIndex = (i32)floorY;
+	v4 topLeft = GetPathTracerTexel(texture, xIndex, yIndex, srgbToLinearTable);
+	v4 topRight = GetPathTracerTexel(texture, xIndex + 1, yIndex, srgbToLinearTable);
+	v4 bottomLeft = GetPathTracerTexel(texture, xIndex, yIndex + 1, srgbToLinearTable);
+	v4 bottomRight = GetPathTracerTexel(texture, xIndex + 1, yIndex + 1, srgbToLinearTable);
+	return NewV4(
+		LerpR32(LerpR32(topLeft.X, topRight.X, fracX), LerpR32(bottomLeft.X, bottomRight.X, fracX), fracY),
+		LerpR32(LerpR32(topLeft.Y, topRight.Y, fracX), LerpR32(bottomLeft.Y, bottomRight.Y, fracX), fracY),
+		LerpR32(LerpR32(topLeft.Z, topRight.Z, fracX), LerpR32(bottomLeft.Z, bottomRight.Z, fracX), fracY),
+		LerpR32(LerpR32(topLeft.W, topRight.W, fracX), LerpR32(bottomLeft.W, bottomRight.W, fracX), fracY)
+	);
+}
+
+// Bilinear with clamping, texel centers at (i + 0.5) / size like the dfg_lut texture in the pbr shader
+static BrdfDfg SamplePathTracerDfgLut(const u32* lut, r32 normalDotView, r32 perceptualRoughness)
+{
+	r32 pixelX = ClampR32(normalDotView * BRDF_DFG_LUT_SIZE - 0.5f, 0.0f, BRDF_DFG_LUT_SIZE - 1.0f);
+	r32 pixelY = ClampR32(perceptualRoughness * BRDF_DFG_LUT_SIZE - 0.5f, 0.0f, BRDF_DFG_LUT_SIZE - 1.0f);
+	uxx xIndex = (uxx)pixelX;
+	uxx yIndex = (uxx)pixelY;
+	uxx nextX = MinUXX(xIndex + 1, BRDF_DFG_LUT_SIZE - 1);
+	uxx nextY = MinUXX(yIndex + 1, BRDF_DFG_LUT_SIZE - 1);
+	r32 fracX = pixelX - (r32)xIndex;
+	r32 fracY = pixelY - (r32)yIndex;
+	u32 corners[4] = { lut[yIndex * BRDF_DFG_LUT_SIZE + xIndex], lut[yIndex * BRDF_DFG_LUT_SIZE + nextX], lut[nextY * BRDF_DFG_LUT_SIZE + xIndex], lut[nextY * BRDF_DFG_LUT_SIZE + nextX] };
+	BrdfDfg result = ZEROED;
+	result.scale = LerpR32(LerpR32((corners[0] & 0xFF) / 255.0f, (corners[1] & 0xFF) / 255.0f, fracX), LerpR32((corners[2] & 0xFF) / 255.0f, (corners[3] & 0xFF) / 255.0f, fracX), fracY);
+	result.bias = LerpR32(LerpR32(((corners[0] >> 8) & 0xFF) / 255.0f, ((corners[1] >> 8) & 0xFF) / 255.0f, fracX), LerpR32(((corners[2] >> 8) & 0xFF) / 255.0f, ((corners[3] >> 8) & 0xFF) / 255.0f, fracX), fracY);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                            Scene                             |
+// +--------------------------------------------------------------+
+void FreePathTracerScene(PathTracerScene* scene)
+{
+	NotNull(scene);
+	if (scene->arena != nullptr)
+	{
+		if (scene->triangleBounds != nullptr) { FreeMem(scene->arena, scene->triangleBounds, sizeof(box) * scene->triangles.length); }
+		FreeVarArray(&scene->triangles);
+		FreeVarArray(&scene->materials);
+		if (scene->dfgLut != nullptr) { FreeMem(scene->arena, scene->dfgLut, sizeof(u32) * BRDF_DFG_LUT_SIZE * BRDF_DFG_LUT_SIZE); }
+		FreeBvh(&scene->bvh);
+	}
+	ClearPointer(scene);
+}
+
+void InitPathTracerScene(Arena* arena, PathTracerScene* sceneOut)
+{
+	NotNull(arena);
+	NotNull(sceneOut);
+	ClearPointer(sceneOut);
+	sceneOut->arena = arena;
+	InitVarArray(PathTracerTriangle, &sceneOut->triangles, arena);
+	InitVarArray(PathTracerMaterial, &sceneOut->materials, arena);
+}
+
+// A material without textures, tint is sRGB like every other Color32
+u32 AddPathTracerUntexturedMaterial(PathTracerScene* scene, Color32 tint)
+{
+	PathTracerMaterial* newMaterial = VarArrayAdd(PathTracerMaterial, &scene->materials);
+	NotNull(newMaterial);
+	ClearPointer(newMaterial);
+	Color32 linearTint = ToLinearColor32(tint);
+	newMaterial->baseColorFactor = NewV4(linearTint.r / 255.0f, linearTint.g / 255.0f, linearTint.b / 255.0f, linearTint.a / 255.0f);
+	newMaterial->metallicFactor = PBR_UNTEXTURED_SURFACE_PARAMS.X;
+	newMaterial->roughnessFactor = PBR_UNTEXTURED_SURFACE_PARAMS.Y;
+	return (u32)(scene->materials.length - 1);
+}
+
+// normals and texCoords are per corner, tangents can be nullptr when the material has no normal map
+void AddPathTracerTriangle(PathTracerScene* scene, v3 position0, v3 position1, v3 position2, const v3* normals, const v4* tangents, const v2* texCoords, u32 materialIndex)
+{
+	NotNull(scene);
+	PathTracerTriangle* newTriangle = VarArrayAdd(PathTracerTriangle, &scene->triangles);
+	NotNull(newTriangle);
+	newTriangle->position0 = position0;
+	newTriangle->edge1 = Sub(position1, position0);
+	newTriangle->edge2 = Sub(position2, position0);
+	for (uxx cIndex = 0; cIndex < 3; cIndex++)
+	{
+		newTriangle->normals[cIndex] = normals[cIndex];
+		newTriangle->tangents[cIndex] = (tangents != nullptr) ? tangents[cIndex] : NewV4(0, 0, 0, 1);
+		newTriangle->texCoords[cIndex] = texCoords[cIndex];
+	}
+	newTriangle->materialIndex = materialIndex;
+}
+
+// Builds the Bvh over every triangle added so far (and the DFG LUT), call once after the last AddPathTracerTriangle
+void FinishPathTracerScene(PathTracerScene* scene)
+{
+	NotNull(scene);
+	NotNull(scene->arena);
+	Assert(scene->triangleBounds == nullptr);
+	uxx numTriangles = scene->triangles.length;
+	InitBvh(scene->arena, numTriangles, &scene->bvh);
+	if (numTriangles > 0)
+	{
+		scene->triangleBounds = AllocArray(box, scene->arena, numTriangles);
+		NotNull(scene->triangleBounds);
+		VarArrayLoop(&scene->triangles, tIndex)
+		{
+			VarArrayLoopGet(PathTracerTriangle, triangle, &scene->triangles, tIndex);
+			v3 position1 = Add(triangle->position0, triangle->edge1);
+			v3 position2 = Add(triangle->position0, triangle->edge2);
+			v3 boundsMin = NewV3(MinR32(triangle->position0.X, MinR32(position1.X, position2.X)), MinR32(triangle->position0.Y, MinR32(position1.Y, position2.Y)), MinR32(triangle->position0.Z, MinR32(position1.Z, position2.Z)));
+			v3 boundsMax = NewV3(MaxR32(triangle->position0.X, MaxR32(position1.X, position2.X)), MaxR32(triangle->position0.Y, MaxR32(position1.Y, position2.Y)), MaxR32(triangle->position0.Z, MaxR32(position1.Z, position2.Z)));
+			scene->triangleBounds[tIndex] = NewBoxV(boundsMin, Sub(boundsMax, boundsMin));
+		}
+		BuildBvh(&scene->bvh, scene->triangleBounds, numTriangles);
+	}
+	scene->dfgLut = GenerateBrdfDfgLut(scene->arena, BRDF_DFG_LUT_SIZE, BRDF_DFG_LUT_SAMPLES);
+}
+
+#if FP3D_SCENE_ENABLED
+static PathTracerTexture GetPathTracerModelTexture(const Model3D* model, uxx textureIndex)
+{
+	PathTracerTexture result = ZEROED;
+	if (textureIndex >= model->data.textures.length) { return result; }
+	ModelDataTexture* texture = VarArrayGetHard(ModelDataTexture, &model->data.textures, textureIndex);
+	result.size = texture->imageData.size;
+	result.pixels = texture->imageData.pixels;
+	return result;
+}
+
+// Flattens every visible instance into world-space triangles at full detail (LOD 0), using the scene graph's current world
+// matrices, and builds the Bvh over them. Textures are referenced from the models' ImageData, not copied, so the models
+// must outlive the scene
+void BuildPathTracerScene(Arena* arena, InstanceStore* store, PathTracerScene* sceneOut)
+{
+	NotNull(arena);
+	NotNull(store);
+	NotNull(sceneOut);
+	InitPathTracerScene(arena, sceneOut);
+	ScratchBegin1(scratch, arena);
+	
+	//Every model's materials go in once, instances only pick the offset of their model's block
+	u32* modelMaterialOffsets = AllocArray(u32, scratch, store->models.length + 1);
+	NotNull(modelMaterialOffsets);
+	VarArrayLoop(&store->models, mIndex)
+	{
+		Model3D* model = *VarArrayGetHard(Model3D*, &store->models, mIndex);
+		modelMaterialOffsets[mIndex] = (u32)sceneOut->materials.length;
+		if (model == nullptr) { continue; }
+		VarArrayLoop(&model->data.materials, matIndex)
+		{
+			VarArrayLoopGet(ModelDataMaterial, material, &model->data.materials, matIndex);
+			PathTracerMaterial* newMaterial = VarArrayAdd(PathTracerMaterial, &sceneOut->materials);
+			NotNull(newMaterial);
+			ClearPointer(newMaterial);
+			newMaterial->baseColorFactor = NewV4(material->albedoFactor.R, material->albedoFactor.G, material->albedoFactor.B, material->albedoFactor.A);
+			newMaterial->metallicFactor = PBR_MATERIAL_SURFACE_PARAMS.X;
+			newMaterial->roughnessFactor = PBR_MATERIAL_SURFACE_PARAMS.Y;
+			newMaterial->albedo = GetPathTracerModelTexture(model, material->albedoTextureIndex);
+			newMaterial->normal = GetPathTracerModelTexture(model, material->normalTextureIndex);
+			newMaterial->metallicRoughness = GetPathTracerModelTexture(model, material->metallicRoughnessTextureIndex);
+			newMaterial->occlusion = GetPathTracerModelTexture(model, material->ambientOcclusionTextureIndex);
+		}
+	}
+	u32 noMaterialIndex = AddPathTracerUntexturedMaterial(sceneOut, MonokaiPurple); //same fallback as BindModelMaterial
+	
+	const v3 boxFaceNormals[6] = { NewV3(-1, 0, 0), NewV3(1, 0, 0), NewV3(0, -1, 0), NewV3(0, 1, 0), NewV3(0, 0, -1), NewV3(0, 0, 1) };
+	const u8 boxFaceCorners[6][4] = { { 0, 4, 6, 2 }, { 1, 3, 7, 5 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 2, 3, 1 }, { 4, 5, 7, 6 } }; //corner bits are x|y<<1|z<<2
+	const v2 zeroTexCoords[3] = { V2_Zero, V2_Zero, V2_Zero };
+	for (uxx iIndex = 0; iIndex < store->count; iIndex++)
+	{
+		if (!IsFlagSet(store->flags[iIndex], InstanceFlag_Visible)) { continue; }
+		u32 sceneRoot = store->sceneRoots[iIndex];
+		if (IsFlagSet(store->flags[iIndex], InstanceFlag_DrawAsBox))
+		{
+			const mat4* worldMat = &store->sceneGraph->worldMats[sceneRoot];
+			u32 boxMaterialIndex = AddPathTracerUntexturedMaterial(sceneOut, store->tints[iIndex]);
+			v3 corners[8];
+			for (uxx cIndex = 0; cIndex < 8; cIndex++)
+			{
+				corners[cIndex] = TransformPointByMat4(worldMat, NewV3((r32)(cIndex & 1), (r32)((cIndex >> 1) & 1), (r32)((cIndex >> 2) & 1)));
+			}
+			for (uxx fIndex = 0; fIndex < ArrayCount(boxFaceNormals); fIndex++)
+			{
+				v3 faceNormal = TransformPathTracerNormal(worldMat, boxFaceNormals[fIndex]);
+				v3 normals[3] = { faceNormal, faceNormal, faceNormal };
+				const u8* faceCorners = boxFaceCorners[fIndex];
+				AddPathTracerTriangle(sceneOut, corners[faceCorners[0]], corners[faceCorners[1]], corners[faceCorners[2]], normals, nullptr, zeroTexCoords, boxMaterialIndex);
+				AddPathTracerTriangle(sceneOut, corners[faceCorners[0]], corners[faceCorners[2]], corners[faceCorners[3]], normals, nullptr, zeroTexCoords, boxMaterialIndex);
+			}
+			continue;
+		}
+		
+		Model3D* model = GetInstanceModel(store, store->modelIds[iIndex]);
+		if (model == nullptr) { continue; }
+		u32 materialOverride = store->materialOverrides[iIndex];
+		VarArrayLoop(&model->data.parts, pIndex)
+		{
+			VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+			const mat4* worldMat = &store->sceneGraph->worldMats[sceneRoot + 1 + pIndex];
+			uxx materialIndex = (materialOverride != INSTANCE_NO_MATERIAL_OVERRIDE) ? materialOverride : part->materialIndex;
+			u32 triangleMaterialIndex = (materialIndex < model->data.materials.length) ? (modelMaterialOffsets[store->modelIds[iIndex]] + (u32)materialIndex) : noMaterialIndex;
+			const Vertex3D* vertices = (const Vertex3D*)part->vertices.items;
+			const v4* partTangents = GetModelPartTangents(model, pIndex);
+			const i32* partIndices = (const i32*)part->indices.items;
+			r32 bitangentSignScale = IsPathTracerMatMirrored(worldMat) ? -1.0f : 1.0f;
+			uxx numPartIndices = (part->indices.length > 0) ? part->indices.length : part->vertices.length;
+			for (uxx tIndex = 0; tIndex + 2 < numPartIndices; tIndex += 3)
+			{
+				v3 positions[3];
+				v3 normals[3];
+				v4 tangents[3];
+				v2 texCoords[3];
+				for (uxx cornerIndex = 0; cornerIndex < 3; cornerIndex++)
+				{
+					uxx vIndex = (part->indices.length > 0) ? (uxx)partIndices[tIndex + cornerIndex] : (tIndex + cornerIndex);
+					positions[cornerIndex] = TransformPointByMat4(worldMat, vertices[vIndex].position);
+					normals[cornerIndex] = TransformPathTracerNormal(worldMat, vertices[vIndex].normal);
+					texCoords[cornerIndex] = vertices[vIndex].texCoord;
+					tangents[cornerIndex] = NewV4(0, 0, 0, 1);
+					if (partTangents != nullptr)
+					{
+						v3 tangent = TransformPathTracerDirection(worldMat, NewV3(partTangents[vIndex].X, partTangents[vIndex].Y, partTangents[vIndex].Z));
+						tangents[cornerIndex] = NewV4(tangent.X, tangent.Y, tangent.Z, partTangents[vIndex].W * bitangentSignScale);
+					}
+				}
+				AddPathTracerTriangle(sceneOut, positions[0], positions[1], positions[2], normals, tangents, texCoords, triangleMaterialIndex);
+			}
+		}
+	}
+	ScratchEnd(scratch);
+	FinishPathTracerScene(sceneOut);
+}
+#endif //FP3D_SCENE_ENABLED
+
+// +--------------------------------------------------------------+
+// |                        Packet Tracing                        |
+// +--------------------------------------------------------------+
+// Moller-Trumbore for one triangle against every ray in the packet, one ray per lane. Returns the lanes (within
+// laneMask) that hit closer than maxDistances and fills in their distance and barycentrics
+static u32 IntersectPathTracerTrianglePacket(const PathTracerTriangle* triangle, const PathTracerPacket* packet, u32 laneMask, const r32* maxDistances, r32* distancesOut, r32* baryUOut, r32* baryVOut)
+{
+	BvhLane directionX = BvhLoad(packet->directionX);
+	BvhLane directionY = BvhLoad(packet->directionY);
+	BvhLane directionZ = BvhLoad(packet->directionZ);
+	BvhLane edge1X = BvhSet1(triangle->edge1.X); BvhLane edge1Y = BvhSet1(triangle->edge1.Y); BvhLane edge1Z = BvhSet1(triangle->edge1.Z);
+	BvhLane edge2X = BvhSet1(triangle->edge2.X); BvhLane edge2Y = BvhSet1(triangle->edge2.Y); BvhLane edge2Z = BvhSet1(triangle->edge2.Z);
+	//p = direction x edge2
+	BvhLane pX = BvhSub(BvhMul(directionY, edge2Z), BvhMul(directionZ, edge2Y));
+	BvhLane pY = BvhSub(BvhMul(directionZ, edge2X), BvhMul(directionX, edge2Z));
+	BvhLane pZ = BvhSub(BvhMul(directionX, edge2Y), BvhMul(directionY, edge2X));
+	BvhLane determinant = BvhAdd(BvhAdd(BvhMul(edge1X, pX), BvhMul(edge1Y, pY)), BvhMul(edge1Z, pZ));
+	BvhLane inverseDeterminant = BvhDiv(BvhSet1(1.0f), determinant);
+	//s = origin - position0
+	BvhLane sX = BvhSub(BvhLoad(packet->originX), BvhSet1(triangle->position0.X));
+	BvhLane sY = BvhSub(BvhLoad(packet->originY), BvhSet1(triangle->position0.Y));
+	BvhLane sZ = BvhSub(BvhLoad(packet->originZ), BvhSet1(triangle->position0.Z));
+	BvhLane baryU = BvhMul(BvhAdd(BvhAdd(BvhMul(sX, pX), BvhMul(sY, pY)), BvhMul(sZ, pZ)), inverseDeterminant);
+	//q = s x edge1
+	BvhLane qX = BvhSub(BvhMul(sY, edge1Z), BvhMul(sZ, edge1Y));
+	BvhLane qY = BvhSub(BvhMul(sZ, edge1X), BvhMul(sX, edge1Z));
+	BvhLane qZ = BvhSub(BvhMul(sX, edge1Y), BvhMul(sY, edge1X));
+	BvhLane baryV = BvhMul(BvhAdd(BvhAdd(BvhMul(directionX, qX), BvhMul(directionY, qY)), BvhMul(directionZ, qZ)), inverseDeterminant);
+	BvhLane distance = BvhMul(BvhAdd(BvhAdd(BvhMul(edge2X, qX), BvhMul(edge2Y, qY)), BvhMul(edge2Z, qZ)), inverseDeterminant);
+	
+	BvhLane zero = BvhSet1(0.0f);
+	u32 result = laneMask;
+	result &= BvhMaskLess(BvhSet1(1e-20f), BvhMul(determinant, determinant)); //not parallel (or degenerate), both sides count
+	result &= BvhMaskLessEqual(zero, baryU);
+	result &= BvhMaskLessEqual(zero, baryV);
+	result &= BvhMaskLessEqual(BvhAdd(baryU, baryV), BvhSet1(1.0f));
+	result &= BvhMaskLess(zero, distance);
+	result &= BvhMaskLess(distance, BvhLoad(maxDistances));
+	if (result != 0)
+	{
+		BvhStore(distancesOut, distance);
+		BvhStore(baryUOut, baryU);
+		BvhStore(baryVOut, baryV);
+	}
+	return result;
+}
+
+// Closest hit for every active ray (or any hit when anyHit is set, for shadow rays). The packet visits a node
+// when any of its rays hit the node's bounds, children are visited near-to-far by the closest ray's entry distance
+static u32 TracePathTracerPacket(const PathTracerScene* scene, const PathTracerPacket* packet, bool anyHit, PathTracerPacketHits* hitsOut)
+{
+	u32 activeMask = packet->activeMask;
+	u32 hitMask = 0;
+	for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+	{
+		hitsOut->triangles[lane] = BVH_ITEM_INVALID;
+		hitsOut->distances[lane] = packet->maxDistance[lane];
+	}
+	if (scene->bvh.nodes.length == 0 || activeMask == 0) { return hitMask; }
+	const BvhNode* nodes = (const BvhNode*)scene->bvh.nodes.items;
+	const PathTracerTriangle* triangles = (const PathTracerTriangle*)scene->triangles.items;
+	
+	u32 stackNodes[BVH_MAX_STACK_SIZE];
+	r32 stackDistances[BVH_MAX_STACK_SIZE];
+	uxx stackSize = 0;
+	stackNodes[stackSize] = 0;
+	stackDistances[stackSize] = 0.0f;
+	stackSize++;
+	while (stackSize > 0 && activeMask != 0)
+	{
+		stackSize--;
+		r32 farthestHit = 0.0f;
+		for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++) { if (activeMask & (1u << lane)) { farthestHit = MaxR32(farthestHit, hitsOut->distances[lane]); } }
+		if (stackDistances[stackSize] > farthestHit) { continue; }
+		const BvhNode* node = &nodes[stackNodes[stackSize]];
+		
+		u32 childMask = 0;
+		r32 childEnterDistances[BVH_NODE_WIDTH];
+		for (uxx child = 0; child < BVH_NODE_WIDTH; child++) { childEnterDistances[child] = HighestR32; }
+		for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+		{
+			if ((activeMask & (1u << lane)) == 0) { continue; }
+			r32 enterDistances[BVH_NODE_WIDTH];
+			v3 origin = NewV3(packet->originX[lane], packet->originY[lane], packet->originZ[lane]);
+			v3 inverseDir = NewV3(packet->inverseDirX[lane], packet->inverseDirY[lane], packet->inverseDirZ[lane]);
+			u32 laneChildMask = TestBvhNodeRay(node, origin, inverseDir, hitsOut->distances[lane], enterDistances);
+			childMask |= laneChildMask;
+			for (uxx child = 0; child < BVH_NODE_WIDTH; child++)
+			{
+				if (laneChildMask & (1u << child)) { childEnterDistances[child] = MinR32(childEnterDistances[child], enterDistances[child]); }
+			}
+		}
+		
+		u32 childNodes[BVH_NODE_WIDTH];
+		r32 childDistances[BVH_NODE_WIDTH];
+		uxx numChildren = 0;
+		for (uxx child = 0; child < BVH_NODE_WIDTH && activeMask != 0; child++)
+		{
+			if (node->numItems[child] == 0 || (childMask & (1u << child)) == 0) { continue; }
+			if (node->children[child] == BVH_CHILD_LEAF)
+			{
+				u32 firstItem = node->firstItem[child];
+				for (u32 itemIndex = firstItem; itemIndex < firstItem + node->numItems[child] && activeMask != 0; itemIndex++)
+				{
+					u32 triangleIndex = scene->bvh.items[itemIndex];
+					r32 distances[PATH_TRACER_PACKET_WIDTH];
+					r32 baryU[PATH_TRACER_PACKET_WIDTH];
+					r32 baryV[PATH_TRACER_PACKET_WIDTH];
+					u32 triangleMask = IntersectPathTracerTrianglePacket(&triangles[triangleIndex], packet, activeMask, hitsOut->distances, distances, baryU, baryV);
+					if (triangleMask == 0) { continue; }
+					for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+					{
+						if ((triangleMask & (1u << lane)) == 0) { continue; }
+						hitsOut->triangles[lane] = triangleIndex;
+						hitsOut->distances[lane] = distances[lane];
+						hitsOut->baryU[lane] = baryU[lane];
+						hitsOut->baryV[lane] = baryV[lane];
+					}
+					hitMask |= triangleMask;
+					if (anyHit) { activeMask &= ~triangleMask; }
+				}
+			}
+			else
+			{
+				//Insertion sort by distance, furthest first
+				uxx insertIndex = numChildren;
+				while (insertIndex > 0 && childDistances[insertIndex-1] < childEnterDistances[child])
+				{
+					childNodes[insertIndex] = childNodes[insertIndex-1];
+					childDistances[insertIndex] = childDistances[insertIndex-1];
+					insertIndex--;
+				}
+				childNodes[insertIndex] = node->children[child];
+				childDistances[insertIndex] = childEnterDistances[child];
+				numChildren++;
+			}
+		}
+		for (uxx cIndex = 0; cIndex < numChildren; cIndex++)
+		{
+			Assert(stackSize < BVH_MAX_STACK_SIZE);
+			stackNodes[stackSize] = childNodes[cIndex];
+			stackDistances[stackSize] = childDistances[cIndex];
+			stackSize++;
+		}
+	}
+	return hitMask;
+}
+
+// +--------------------------------------------------------------+
+// |                           Shading                            |
+// +--------------------------------------------------------------+
+static PathTracerHit GetPathTracerHit(const PathTracer* tracer, const PathTracerPacket* packet, const PathTracerPacketHits* hits, uxx lane)
+{
+	const PathTracerTriangle* triangle = VarArrayGetHard(PathTracerTriangle, &tracer->scene->triangles, hits->triangles[lane]);
+	const PathTracerMaterial* material = VarArrayGetHard(PathTracerMaterial, &tracer->scene->materials, triangle->materialIndex);
+	r32 baryU = hits->baryU[lane];
+	r32 baryV = hits->baryV[lane];
+	r32 baryW = 1.0f - baryU - baryV;
+	v3 direction = NewV3(packet->directionX[lane], packet->directionY[lane], packet->directionZ[lane]);
+	
+	PathTracerHit result = ZEROED;
+	result.position = Add(NewV3(packet->originX[lane], packet->originY[lane], packet->originZ[lane]), Mul(direction, hits->distances[lane]));
+	result.viewDir = Mul(direction, -1.0f);
+	v3 normal = Add(Add(Mul(triangle->normals[0], baryW), Mul(triangle->normals[1], baryU)), Mul(triangle->normals[2], baryV));
+	if (Length(normal) <= 1e-8f) { normal = PathTracerCross(triangle->edge1, triangle->edge2); }
+	v2 texCoord = Add(Add(Mul(triangle->texCoords[0], baryW), Mul(triangle->texCoords[1], baryU)), Mul(triangle->texCoords[2], baryV));
+	if (material->normal.pixels != nullptr)
+	{
+		//Same as GetMappedNormal in pbr_shader.glsl, including renormalizing and re-orthogonalizing the interpolated basis
+		normal = Normalize(normal);
+		v3 tangent = NewV3(
+			triangle->tangents[0].X * baryW + triangle->tangents[1].X * baryU + triangle->tangents[2].X * baryV,
+			triangle->tangents[0].Y * baryW + triangle->tangents[1].Y * baryU + triangle->tangents[2].Y * baryV,
+			triangle->tangents[0].Z * baryW + triangle->tangents[1].Z * baryU + triangle->tangents[2].Z * baryV
+		);
+		tangent = Sub(tangent, Mul(normal, Dot(normal, tangent)));
+		r32 tangentLength = Length(tangent);
+		tangent = (tangentLength > 1e-8f) ? Mul(tangent, 1.0f / tangentLength) : V3_Zero;
+		v4 normalSample = SamplePathTracerTexture(&material->normal, texCoord, nullptr);
+		r32 bitangentSign = triangle->tangents[0].W * baryW + triangle->tangents[1].W * baryU + triangle->tangents[2].W * baryV;
+		v3 bitangent = Mul(PathTracerCross(normal, tangent), bitangentSign);
+		v3 mappedNormal = Add(Add(Mul(tangent, normalSample.X * 2.0f - 1.0f), Mul(bitangent, normalSample.Y * 2.0f - 1.0f)), Mul(normal, normalSample.Z * 2.0f - 1.0f));
+		if (Length(mappedNormal) > 1e-8f) { normal = mappedNormal; }
+	}
+	result.normal = Normalize(normal);
+	//The pbr shader doesn't flip back faces, everything else treats triangles as two sided
+	if (tracer->settings.mode != PathTracerMode_Shader && Dot(result.normal, result.viewDir) < 0.0f) { result.normal = Mul(result.normal, -1.0f); }
+	
+	v4 albedo = SamplePathTracerTexture(&material->albedo, texCoord, tracer->srgbToLinearTable);
+	v4 metallicRoughness = SamplePathTracerTexture(&material->metallicRoughness, texCoord, nullptr);
+	result.surface.baseColor = NewV3(albedo.X * material->baseColorFactor.X, albedo.Y * material->baseColorFactor.Y, albedo.Z * material->baseColorFactor.Z);
+	result.surface.metallic = metallicRoughness.Z * material->metallicFactor;
+	result.surface.perceptualRoughness = ClampR32(metallicRoughness.Y * material->roughnessFactor, BRDF_MIN_ROUGHNESS, 1.0f);
+	result.occlusion = SamplePathTracerTexture(&material->occlusion, texCoord, nullptr).X;
+	return result;
+}
+
+// Exactly what pbr_shader.glsl's fragment shader computes (before HdrToDisplay) for this hit
+static v3 ShadePathTracerHitLikeShader(const PathTracer* tracer, const PathTracerHit* hit)
+{
+	const PathTracerSettings* settings = &tracer->settings;
+	const BrdfSurface* surface = &hit->surface;
+	v3 toLight = Sub(settings->lightPos, hit->position);
+	r32 lightDistance = Length(toLight);
+	v3 lightDir = Mul(toLight, 1.0f / MaxR32(lightDistance, 1e-6f));
+	r32 normalDotView = MaxR32(Dot(hit->normal, hit->viewDir), 1e-4f);
+	BrdfDfg dfg = SamplePathTracerDfgLut(tracer->scene->dfgLut, normalDotView, surface->perceptualRoughness);
+	r32 multiScatterDfg = MaxR32(dfg.scale + dfg.bias, 1e-4f);
+	
+	v3 direct = EvaluateBrdf(surface, hit->normal, hit->viewDir, lightDir, multiScatterDfg);
+	direct = Mul(direct, settings->lightIntensity * GetPointLightAttenuation(lightDistance, settings->lightRadius));
+	
+	v3 diffuseColor = Mul(surface->baseColor, 1.0f - surface->metallic);
+	r32 channels[3];
+	r32 baseColors[3] = { surface->baseColor.X, surface->baseColor.Y, surface->baseColor.Z };
+	r32 diffuseColors[3] = { diffuseColor.X, diffuseColor.Y, diffuseColor.Z };
+	r32 ambientColors[3] = { settings->ambientColor.X, settings->ambientColor.Y, settings->ambientColor.Z };
+	for (uxx cIndex = 0; cIndex < 3; cIndex++)
+	{
+		r32 f0 = LerpR32(BRDF_DIELECTRIC_F0, baseColors[cIndex], surface->metallic);
+		r32 energyCompensation = 1.0f + f0 * (1.0f / multiScatterDfg - 1.0f);
+		r32 ambientSpecular = (f0 * dfg.scale + dfg.bias) * energyCompensation;
+		channels[cIndex] = (diffuseColors[cIndex] + ambientSpecular) * ambientColors[cIndex] * hit->occlusion;
+	}
+	return Add(direct, NewV3(channels[0], channels[1], channels[2]));
+}
+
+// Picks the next direction from a mix of the cosine weighted diffuse lobe and GGX importance sampling, returns false
+// (and ends the path) when the sampled direction is below the surface. throughputScaleOut is f * NdotL / pdf
+static bool SamplePathTracerBounce(RandomSeries* random, const PathTracerHit* hit, v3* directionOut, v3* throughputScaleOut)
+{
+	const BrdfSurface* surface = &hit->surface;
+	r32 alpha = surface->perceptualRoughness * surface->perceptualRoughness;
+	r32 specularChance = LerpR32(0.5f, 1.0f, surface->metallic); //metals have no diffuse lobe at all
+	v3 lightDir;
+	if (GetRandR32Range(random, 0.0f, 1.0f) < specularChance)
+	{
+		r32 sampleU = GetRandR32Range(random, 0.0f, 1.0f);
+		r32 sampleV = GetRandR32Range(random, 0.0f, 1.0f);
+		r32 cosTheta = SqrtR32((1.0f - sampleV) / (1.0f + (alpha * alpha - 1.0f) * sampleV));
+		r32 sinTheta = SqrtR32(MaxR32(1.0f - cosTheta * cosTheta, 0.0f));
+		r32 phi = TwoPi32 * sampleU;
+		v3 halfVec = PathTracerLocalToWorld(NewV3(sinTheta * CosR32(phi), sinTheta * SinR32(phi), cosTheta), hit->normal);
+		lightDir = Sub(Mul(halfVec, 2.0f * Dot(hit->viewDir, halfVec)), hit->viewDir);
+	}
+	else { lightDir = SamplePathTracerCosineHemisphere(random, hit->normal); }
+	
+	r32 normalDotLight = Dot(hit->normal, lightDir);
+	if (normalDotLight <= 0.0f) { return false; }
+	v3 halfVec = Normalize(Add(hit->viewDir, lightDir));
+	r32 normalDotHalf = MaxR32(Dot(hit->normal, halfVec), 0.0f);
+	r32 viewDotHalf = MaxR32(Dot(hit->viewDir, halfVec), 1e-6f);
+	r32 pdf = (1.0f - specularChance) * normalDotLight / Pi32
+		+ specularChance * BrdfDistributionGgx(normalDotHalf, alpha) * normalDotHalf / (4.0f * viewDotHalf);
+	if (pdf <= 0.0f) { return false; }
+	*directionOut = lightDir;
+	*throughputScaleOut = Mul(EvaluateBrdf(surface, hit->normal, hit->viewDir, lightDir, 1.0f), 1.0f / pdf);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                          Rendering                           |
+// +--------------------------------------------------------------+
+void FreePathTracer(PathTracer* tracer)
+{
+	NotNull(tracer);
+	if (tracer->arena != nullptr && tracer->pixels != nullptr)
+	{
+		FreeMem(tracer->arena, tracer->pixels, sizeof(v3) * (uxx)tracer->settings.size.Width * (uxx)tracer->settings.size.Height);
+	}
+	ClearPointer(tracer);
+}
+
+void InitPathTracer(Arena* arena, const PathTracerScene* scene, const PathTracerSettings* settings, PathTracer* tracerOut)
+{
+	NotNull(arena);
+	NotNull(scene);
+	NotNull(settings);
+	NotNull(tracerOut);
+	Assert(settings->size.Width > 0 && settings->size.Height > 0);
+	Assert(settings->samplesPerPixel > 0);
+	ClearPointer(tracerOut);
+	tracerOut->arena = arena;
+	tracerOut->scene = scene;
+	tracerOut->settings = *settings;
+	tracerOut->viewMat = MakeLookAtMat4(settings->cameraPos, Add(settings->cameraPos, settings->cameraLookDir), V3_Up); //same as AppUpdate
+	tracerOut->numTilesX = ((uxx)settings->size.Width + PATH_TRACER_TILE_SIZE - 1) / PATH_TRACER_TILE_SIZE;
+	tracerOut->numTilesY = ((uxx)settings->size.Height + PATH_TRACER_TILE_SIZE - 1) / PATH_TRACER_TILE_SIZE;
+	tracerOut->pixels = AllocArray(v3, arena, (uxx)settings->size.Width * (uxx)settings->size.Height);
+	NotNull(tracerOut->pixels);
+	for (uxx vIndex = 0; vIndex < 256; vIndex++) { tracerOut->srgbToLinearTable[vIndex] = SrgbToLinearR32((r32)vIndex / 255.0f); }
+}
+
+// One sample for each pixel of the 2x2 quad at (quadX, quadY). Lanes of the quad stay together as a packet for every bounce
+static uxx TracePathTracerQuadSample(const PathTracer* tracer, RandomSeries* random, uxx quadX, uxx quadY, v3* radianceOut)
+{
+	const PathTracerSettings* settings = &tracer->settings;
+	v2 screenSize = NewV2((r32)settings->size.Width, (r32)settings->size.Height);
+	uxx numRays = 0;
+	PathTracerPacket packet = ZEROED;
+	v3 throughputs[PATH_TRACER_PACKET_WIDTH];
+	for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+	{
+		radianceOut[lane] = V3_Zero;
+		throughputs[lane] = V3_One;
+		uxx pixelX = quadX + (lane & 1);
+		uxx pixelY = quadY + (lane >> 1);
+		if (pixelX >= (uxx)settings->size.Width || pixelY >= (uxx)settings->size.Height) { continue; }
+		v2 screenPos = NewV2((r32)pixelX + GetRandR32Range(random, 0.0f, 1.0f), (r32)pixelY + GetRandR32Range(random, 0.0f, 1.0f));
+		BvhRay cameraRay = GetBvhRayFromScreenPos(settings->cameraPos, settings->cameraLookDir, tracer->viewMat, settings->fieldOfViewY, screenSize, screenPos);
+		SetPathTracerPacketRay(&packet, lane, cameraRay.origin, cameraRay.direction, PATH_TRACER_MAX_DISTANCE);
+		packet.activeMask |= (1u << lane);
+	}
+	
+	for (uxx bounce = 0; packet.activeMask != 0; bounce++)
+	{
+		PathTracerPacketHits hits;
+		u32 hitMask = TracePathTracerPacket(tracer->scene, &packet, false, &hits);
+		numRays += CountPathTracerLanes(packet.activeMask);
+		
+		PathTracerPacket shadowPacket = ZEROED;
+		v3 shadowContributions[PATH_TRACER_PACKET_WIDTH];
+		u32 nextMask = 0;
+		for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+		{
+			u32 laneBit = (1u << lane);
+			if ((packet.activeMask & laneBit) == 0) { continue; }
+			if ((hitMask & laneBit) == 0)
+			{
+				v3 missRadiance = (bounce == 0) ? settings->backgroundColor : ((settings->mode == PathTracerMode_AmbientOcclusion) ? V3_One : settings->ambientColor);
+				radianceOut[lane] = Add(radianceOut[lane], MulPathTracerV3(throughputs[lane], missRadiance));
+				continue;
+			}
+			if (settings->mode == PathTracerMode_AmbientOcclusion && bounce > 0) { continue; } //occluded
+			
+			PathTracerHit hit = GetPathTracerHit(tracer, &packet, &hits, lane);
+			v3 offsetOrigin = Add(hit.position, Mul(hit.normal, PATH_TRACER_RAY_EPSILON));
+			if (settings->mode == PathTracerMode_Shader)
+			{
+				radianceOut[lane] = ShadePathTracerHitLikeShader(tracer, &hit);
+			}
+			else if (settings->mode == PathTracerMode_AmbientOcclusion)
+			{
+				SetPathTracerPacketRay(&packet, lane, offsetOrigin, SamplePathTracerCosineHemisphere(random, hit.normal), settings->aoDistance);
+				nextMask |= laneBit;
+			}
+			else
+			{
+				v3 toLight = Sub(settings->lightPos, hit.position);
+				r32 lightDistance = Length(toLight);
+				r32 attenuation = GetPointLightAttenuation(lightDistance, settings->lightRadius);
+				v3 lightDir = Mul(toLight, 1.0f / MaxR32(lightDistance, 1e-6f));
+				if (attenuation > 0.0f && Dot(hit.normal, lightDir) > 0.0f)
+				{
+					v3 reflected = EvaluateBrdf(&hit.surface, hit.normal, hit.viewDir, lightDir, 1.0f);
+					shadowContributions[lane] = Mul(MulPathTracerV3(throughputs[lane], reflected), settings->lightIntensity * attenuation);
+					SetPathTracerPacketRay(&shadowPacket, lane, offsetOrigin, lightDir, lightDistance - PATH_TRACER_RAY_EPSILON);
+					shadowPacket.activeMask |= laneBit;
+				}
+				
+				v3 nextDirection = V3_Zero;
+				v3 throughputScale = V3_Zero;
+				if (bounce >= settings->maxBounces || !SamplePathTracerBounce(random, &hit, &nextDirection, &throughputScale)) { continue; }
+				throughputs[lane] = MulPathTracerV3(throughputs[lane], throughputScale);
+				if (bounce + 1 >= PATH_TRACER_ROULETTE_BOUNCE)
+				{
+					r32 surviveChance = MinR32(MaxR32(throughputs[lane].X, MaxR32(throughputs[lane].Y, throughputs[lane].Z)), 0.95f);
+					if (GetRandR32Range(random, 0.0f, 1.0f) >= surviveChance) { continue; }
+					throughputs[lane] = Mul(throughputs[lane], 1.0f / surviveChance);
+				}
+				SetPathTracerPacketRay(&packet, lane, offsetOrigin, nextDirection, PATH_TRACER_MAX_DISTANCE);
+				nextMask |= laneBit;
+			}
+		}
+		
+		if (shadowPacket.activeMask != 0)
+		{
+			PathTracerPacketHits shadowHits;
+			u32 occludedMask = TracePathTracerPacket(tracer->scene, &shadowPacket, true, &shadowHits);
+			numRays += CountPathTracerLanes(shadowPacket.activeMask);
+			for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+			{
+				u32 laneBit = (1u << lane);
+				if ((shadowPacket.activeMask & laneBit) != 0 && (occludedMask & laneBit) == 0) { radianceOut[lane] = Add(radianceOut[lane], shadowContributions[lane]); }
+			}
+		}
+		packet.activeMask = nextMask;
+	}
+	return numRays;
+}
+
+// Renders every sample of every pixel in one tile. Tiles only write their own pixels and seed their own random
+// series from the tile index, so they can run in any order (or on separate threads) and still give the same image
+uxx RenderPathTracerTile(const PathTracer* tracer, uxx tileIndex)
+{
+	NotNull(tracer);
+	NotNull(tracer->pixels);
+	Assert(tileIndex < tracer->numTilesX * tracer->numTilesY);
+	const PathTracerSettings* settings = &tracer->settings;
+	uxx minX = (tileIndex % tracer->numTilesX) * PATH_TRACER_TILE_SIZE;
+	uxx minY = (tileIndex / tracer->numTilesX) * PATH_TRACER_TILE_SIZE;
+	uxx maxX = MinUXX(minX + PATH_TRACER_TILE_SIZE, (uxx)settings->size.Width);
+	uxx maxY = MinUXX(minY + PATH_TRACER_TILE_SIZE, (uxx)settings->size.Height);
+	RandomSeries random = ZEROED;
+	InitRandomSeriesDefault(&random);
+	SeedRandomSeriesU64(&random, settings->seed ^ ((u64)(tileIndex + 1) * 0x9E3779B97F4A7C15ULL));
+	
+	uxx numRays = 0;
+	r32 sampleWeight = 1.0f / (r32)settings->samplesPerPixel;
+	for (uxx quadY = minY; quadY < maxY; quadY += 2)
+	{
+		for (uxx quadX = minX; quadX < maxX; quadX += 2)
+		{
+			v3 sums[PATH_TRACER_PACKET_WIDTH];
+			for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++) { sums[lane] = V3_Zero; }
+			for (uxx sIndex = 0; sIndex < settings->samplesPerPixel; sIndex++)
+			{
+				v3 radiance[PATH_TRACER_PACKET_WIDTH];
+				numRays += TracePathTracerQuadSample(tracer, &random, quadX, quadY, radiance);
+				for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++) { sums[lane] = Add(sums[lane], radiance[lane]); }
+			}
+			for (uxx lane = 0; lane < PATH_TRACER_PACKET_WIDTH; lane++)
+			{
+				uxx pixelX = quadX + (lane & 1);
+				uxx pixelY = quadY + (lane >> 1);
+				if (pixelX >= maxX || pixelY >= maxY) { continue; }
+				tracer->pixels[pixelY * (uxx)settings->size.Width + pixelX] = Mul(sums[lane], sampleWeight);
+			}
+		}
+	}
+	return numRays;
+}
+
+typedef struct PathTracerTileJobs PathTracerTileJobs;
+struct PathTracerTileJobs
+{
+	const PathTracer* tracer;
+	uxx* tileNumRays; //one per tile
+};
+
+// One job per tile, the workers pull the next tile index from the batch's atomic counter as they finish their last one
+static JOB_FUNC_DEF(RenderPathTracerTileJob)
+{
+	PathTracerTileJobs* context = (PathTracerTileJobs*)userPntr;
+	context->tileNumRays[jobIndex] = RenderPathTracerTile(context->tracer, jobIndex);
+}
+
+// Renders every tile across the job system (or all on this thread when jobs is nullptr), the image is the same either way
+void RenderPathTracerImage(JobSystem* jobs, PathTracer* tracer)
+{
+	NotNull(tracer);
+	ScratchBegin1(scratch, tracer->arena);
+	PerfTime renderStart = GetPerfTime();
+	uxx numTiles = tracer->numTilesX * tracer->numTilesY;
+	PathTracerTileJobs context = ZEROED;
+	context.tracer = tracer;
+	context.tileNumRays = AllocArray(uxx, scratch, numTiles);
+	NotNull(context.tileNumRays);
+	RunJobs(jobs, numTiles, RenderPathTracerTileJob, &context);
+	tracer->numRays = 0;
+	for (uxx tileIndex = 0; tileIndex < numTiles; tileIndex++) { tracer->numRays += context.tileNumRays[tileIndex]; }
+	PerfTime renderEnd = GetPerfTime();
+	tracer->renderMs = GetPerfTimeDiff(&renderStart, &renderEnd);
+	ScratchEnd(scratch);
+}
+
+// +--------------------------------------------------------------+
+// |                            Output                            |
+// +--------------------------------------------------------------+
+// RGBA8 display colors, run through the same exposure, tonemapper and sRGB encode as the end of the pbr shader
+u32* GetPathTracerDisplayPixels(Arena* arena, const PathTracer* tracer, Tonemapper tonemapper, r32 exposure)
+{
+	NotNull(arena);
+	NotNull(tracer);
+	uxx numPixels = (uxx)tracer->settings.size.Width * (uxx)tracer->settings.size.Height;
+	u32* result = AllocArray(u32, arena, numPixels);
+	NotNull(result);
+	for (uxx pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		v3 display = HdrToDisplay(tonemapper, exposure, tracer->pixels[pIndex]);
+		u32 red = (u32)RoundR32i(ClampR32(display.X, 0.0f, 1.0f) * 255.0f);
+		u32 green = (u32)RoundR32i(ClampR32(display.Y, 0.0f, 1.0f) * 255.0f);
+		u32 blue = (u32)RoundR32i(ClampR32(display.Z, 0.0f, 1.0f) * 255.0f);
+		result[pIndex] = red | (green << 8) | (blue << 16) | 0xFF000000u;
+	}
+	return result;
+}
+
+// The PNG is what the screen would show, the EXR holds the raw linear radiance for exact comparisons
+bool WritePathTracerImages(const PathTracer* tracer, FilePath pngPath, FilePath exrPath, Tonemapper tonemapper, r32 exposure)
+{
+	NotNull(tracer);
+	ScratchBegin(scratch);
+	u32* displayPixels = GetPathTracerDisplayPixels(scratch, tracer, tonemapper, exposure);
+	Str8 pngFile = EncodePngImage(scratch, tracer->settings.size, displayPixels);
+	Str8 exrFile = EncodeExrImage(scratch, tracer->settings.size, tracer->pixels);
+	bool result = OsWriteBinFile(pngPath, pngFile);
+	result = OsWriteBinFile(exrPath, exrFile) && result;
+	ScratchEnd(scratch);
+	return result;
+}
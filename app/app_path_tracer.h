@@ -0,0 +1,149 @@
+/*
+File:   app_path_tracer.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A CPU path tracer that renders the same InstanceStore, materials, camera and light as the
+	** pbr shader so its output can be checked on machines without a GPU. The scene is flattened
+	** into world-space triangles with a Bvh over them and rays are traced in packets of
+	** PATH_TRACER_PACKET_WIDTH (one per SIMD lane, a 2x2 pixel quad for camera rays).
+	** Surfaces are shaded with the CPU reference BRDF from app_brdf.c. The image is split into
+	** tiles that only write their own pixels, RenderPathTracerImage hands them out to the JobSystem.
+*/
+
+#ifndef _APP_PATH_TRACER_H
+#define _APP_PATH_TRACER_H
+
+#define PATH_TRACER_TILE_SIZE       16 //pixels along both axes, must be a multiple of 2 for the 2x2 camera packets
+#define PATH_TRACER_PACKET_WIDTH    BVH_NODE_WIDTH
+#define PATH_TRACER_RAY_EPSILON     1e-4f //secondary rays start this far off the surface
+#define PATH_TRACER_MAX_DISTANCE    1000.0f
+#define PATH_TRACER_ROULETTE_BOUNCE 2 //paths can be terminated randomly from this bounce on
+#define PATH_TRACER_REFERENCE_SIZE  512
+#define PATH_TRACER_REFERENCE_SPP   16
+
+typedef enum PathTracerMode PathTracerMode;
+enum PathTracerMode
+{
+	PathTracerMode_Shader = 0, //one hit per sample, lit exactly like pbr_shader.glsl (unshadowed light, DFG LUT ambient times the AO map)
+	PathTracerMode_Reference, //full path tracing: shadowed light, bounces, misses see ambientColor as a uniform sky
+	PathTracerMode_AmbientOcclusion, //visibility of the cosine weighted hemisphere within aoDistance, written to all 3 channels
+	PathTracerMode_Count,
+};
+
+// A texture the path tracer samples straight from the model's CPU ImageData (bilinear, repeating, no mips)
+typedef struct PathTracerTexture PathTracerTexture;
+struct PathTracerTexture
+{
+	v2i size; //0x0 when the material has no texture in this slot
+	const u32* pixels;
+};
+
+typedef struct PathTracerMaterial PathTracerMaterial;
+struct PathTracerMaterial
+{
+	v4 baseColorFactor; //linear
+	r32 metallicFactor; //surfaceParams in the pbr shader
+	r32 roughnessFactor;
+	PathTracerTexture albedo; //sRGB encoded
+	PathTracerTexture normal; //tangent space, MikkTSpace convention
+	PathTracerTexture metallicRoughness; //roughness in G, metallic in B
+	PathTracerTexture occlusion;
+};
+
+// position0 + edge1/edge2 is what the intersection test wants, the rest is only read after a hit
+typedef struct PathTracerTriangle PathTracerTriangle;
+struct PathTracerTriangle
+{
+	v3 position0;
+	v3 edge1;
+	v3 edge2;
+	v3 normals[3]; //world space, not normalized
+	v4 tangents[3]; //world space xyz, w = bitangent sign (see app_tangents.h), only read when the material has a normal map
+	v2 texCoords[3];
+	u32 materialIndex;
+};
+
+// Up to PATH_TRACER_PACKET_WIDTH rays stored SoA so the triangle test can run one ray per lane
+typedef struct PathTracerPacket PathTracerPacket;
+struct PathTracerPacket
+{
+	u32 activeMask; //bit per lane, only these lanes are traced
+	r32 originX[PATH_TRACER_PACKET_WIDTH];
+	r32 originY[PATH_TRACER_PACKET_WIDTH];
+	r32 originZ[PATH_TRACER_PACKET_WIDTH];
+	r32 directionX[PATH_TRACER_PACKET_WIDTH];
+	r32 directionY[PATH_TRACER_PACKET_WIDTH];
+	r32 directionZ[PATH_TRACER_PACKET_WIDTH];
+	r32 inverseDirX[PATH_TRACER_PACKET_WIDTH];
+	r32 inverseDirY[PATH_TRACER_PACKET_WIDTH];
+	r32 inverseDirZ[PATH_TRACER_PACKET_WIDTH];
+	r32 maxDistance[PATH_TRACER_PACKET_WIDTH];
+};
+
+typedef struct PathTracerPacketHits PathTracerPacketHits;
+struct PathTracerPacketHits
+{
+	u32 triangles[PATH_TRACER_PACKET_WIDTH]; //BVH_ITEM_INVALID for lanes that missed
+	r32 distances[PATH_TRACER_PACKET_WIDTH];
+	r32 baryU[PATH_TRACER_PACKET_WIDTH]; //weight of normals[1], texCoords[1]
+	r32 baryV[PATH_TRACER_PACKET_WIDTH]; //weight of normals[2], texCoords[2]
+};
+
+// Everything shading needs at a hit, textures already sampled
+typedef struct PathTracerHit PathTracerHit;
+struct PathTracerHit
+{
+	v3 position;
+	v3 normal;
+	v3 viewDir;
+	BrdfSurface surface;
+	r32 occlusion;
+};
+
+typedef struct PathTracerScene PathTracerScene;
+struct PathTracerScene
+{
+	Arena* arena;
+	VarArray triangles; //PathTracerTriangle
+	VarArray materials; //PathTracerMaterial
+	box* triangleBounds; //parallel to triangles, what the bvh was built from
+	Bvh bvh;
+	u32* dfgLut; //BRDF_DFG_LUT_SIZE^2, the same table the pbr shader samples
+};
+
+typedef struct PathTracerSettings PathTracerSettings;
+struct PathTracerSettings
+{
+	PathTracerMode mode;
+	v2i size;
+	uxx samplesPerPixel;
+	uxx maxBounces; //PathTracerMode_Reference only, 0 is direct light (with shadows) plus the sky
+	u64 seed;
+	v3 cameraPos;
+	v3 cameraLookDir;
+	r32 fieldOfViewY;
+	v3 lightPos;
+	r32 lightIntensity;
+	r32 lightRadius;
+	v3 ambientColor;
+	v3 backgroundColor; //what camera rays that miss everything see
+	r32 aoDistance;
+};
+
+typedef struct PathTracer PathTracer;
+struct PathTracer
+{
+	Arena* arena;
+	const PathTracerScene* scene;
+	PathTracerSettings settings;
+	mat4 viewMat;
+	r32 srgbToLinearTable[256]; //decodes albedo texels
+	v3* pixels; //linear HDR radiance (before exposure), averaged over samplesPerPixel
+	uxx numTilesX;
+	uxx numTilesY;
+	uxx numRays; //every ray traced (camera, bounce and shadow) in the last render
+	r64 renderMs;
+};
+
+#endif //  _APP_PATH_TRACER_H
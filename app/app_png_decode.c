@@ -0,0 +1,944 @@
+/*
+File:   app_png_decode.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the chunk parsing, inflate, unfiltering, the batch decode and the PNG benchmark (see app_png_decode.h)
+	** NOTE: The bit reader loads 8 input bytes at a time in a u64 so this assumes a little-endian target.
+	** The SSE2 unfiltering reuses the SIMD target detection from app_trs_kernels.h, other targets use
+	** the scalar loops for everything but Up.
+*/
+
+// +--------------------------------------------------------------+
+// |                            Chunks                            |
+// +--------------------------------------------------------------+
+static inline u32 ReadPngU32(const u8* bytes)
+{
+	return ((u32)bytes[0] << 24) | ((u32)bytes[1] << 16) | ((u32)bytes[2] << 8) | (u32)bytes[3];
+}
+
+// Steps offset (which starts at PNG_SIGNATURE_SIZE) over one chunk. Returns false at IEND, at the end of the
+// file or when a chunk runs past the end of the file (isValidOut tells those apart)
+static bool GetNextPngChunk(Str8 fileContents, uxx* offset, u32* chunkTypeOut, Str8* chunkDataOut, bool* isValidOut)
+{
+	const u8* bytes = (const u8*)fileContents.chars;
+	*isValidOut = false;
+	if (*offset + 12 > fileContents.length) { return false; }
+	uxx chunkSize = (uxx)ReadPngU32(&bytes[*offset]);
+	u32 chunkType = ReadPngU32(&bytes[*offset + 4]);
+	if (chunkSize > fileContents.length - *offset - 12) { return false; }
+	*isValidOut = true;
+	if (chunkType == PNG_CHUNK_IEND) { return false; }
+	*chunkTypeOut = chunkType;
+	*chunkDataOut = NewStr8(chunkSize, &fileContents.chars[*offset + 8]);
+	*offset += 12 + chunkSize; //length, type, data and CRC (the CRCs are skipped on purpose, see app_png_decode.h)
+	return true;
+}
+
+static void ReadPngInfoChunk(PngInfo* info, u32 chunkType, Str8 chunk)
+{
+	const u8* chunkData = (const u8*)chunk.chars;
+	uxx chunkSize = chunk.length;
+	if (chunkType == PNG_CHUNK_PLTE)
+	{
+		info->numPaletteEntries = MinUXX(chunkSize / 3, ArrayCount(info->palette));
+		for (uxx eIndex = 0; eIndex < info->numPaletteEntries; eIndex++)
+		{
+			const u8* entry = &chunkData[eIndex * 3];
+			info->palette[eIndex] = (u32)entry[0] | ((u32)entry[1] << 8) | ((u32)entry[2] << 16) | 0xFF000000;
+		}
+	}
+	else if (chunkType == PNG_CHUNK_TRNS)
+	{
+		if (info->colorType == PngColorType_Palette)
+		{
+			for (uxx eIndex = 0; eIndex < chunkSize && eIndex < info->numPaletteEntries; eIndex++)
+			{
+				info->palette[eIndex] = (info->palette[eIndex] & 0x00FFFFFF) | ((u32)chunkData[eIndex] << 24);
+			}
+		}
+		//8-bit images store the transparent samples as 16-bit values, only the low byte matters
+		else if (info->colorType == PngColorType_Gray && chunkSize >= 2)
+		{
+			info->hasTransparentColor = true;
+			info->transparentColor[0] = chunkData[1];
+		}
+		else if (info->colorType == PngColorType_Rgb && chunkSize >= 6)
+		{
+			info->hasTransparentColor = true;
+			info->transparentColor[0] = chunkData[1];
+			info->transparentColor[1] = chunkData[3];
+			info->transparentColor[2] = chunkData[5];
+		}
+	}
+	else if (chunkType == PNG_CHUNK_IDAT)
+	{
+		info->numIdatChunks++;
+		info->compressedSize += chunkSize;
+	}
+}
+
+// Reads the IHDR (and the PLTE, tRNS and IDAT sizes) without decoding anything.
+// Returns false when fileContents isn't a PNG file at all
+bool TryReadPngInfo(Str8 fileContents, PngInfo* infoOut)
+{
+	NotNull(infoOut);
+	ClearPointer(infoOut);
+	const u8 signature[PNG_SIGNATURE_SIZE] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+	if (fileContents.length < PNG_SIGNATURE_SIZE + 12 + 13) { return false; }
+	if (MyMemCompare(fileContents.chars, &signature[0], PNG_SIGNATURE_SIZE) != 0) { return false; }
+	const u8* ihdr = (const u8*)fileContents.chars + PNG_SIGNATURE_SIZE;
+	if (ReadPngU32(&ihdr[4]) != PNG_CHUNK_IHDR || ReadPngU32(&ihdr[0]) < 13) { return false; }
+	u32 width = ReadPngU32(&ihdr[8]);
+	u32 height = ReadPngU32(&ihdr[12]);
+	if (width == 0 || height == 0 || width > PNG_MAX_DIMENSION || height > PNG_MAX_DIMENSION) { return false; }
+	infoOut->size = NewV2i((i32)width, (i32)height);
+	infoOut->bitDepth = ihdr[16];
+	infoOut->colorType = ihdr[17];
+	infoOut->interlaceMethod = ihdr[20];
+	switch (infoOut->colorType)
+	{
+		case PngColorType_Gray:      infoOut->bytesPerPixel = 1; break;
+		case PngColorType_Rgb:       infoOut->bytesPerPixel = 3; break;
+		case PngColorType_Palette:   infoOut->bytesPerPixel = 1; break;
+		case PngColorType_GrayAlpha: infoOut->bytesPerPixel = 2; break;
+		case PngColorType_Rgba:      infoOut->bytesPerPixel = 4; break;
+		default: return false;
+	}
+	infoOut->rowSize = (uxx)width * infoOut->bytesPerPixel;
+	uxx offset = PNG_SIGNATURE_SIZE;
+	u32 chunkType = 0;
+	Str8 chunk = ZEROED;
+	bool isValid = false;
+	while (GetNextPngChunk(fileContents, &offset, &chunkType, &chunk, &isValid)) { ReadPngInfoChunk(infoOut, chunkType, chunk); }
+	if (!isValid) { return false; }
+	infoOut->isSupported = (infoOut->bitDepth == 8 && infoOut->interlaceMethod == 0 && infoOut->numIdatChunks > 0 && ihdr[18] == 0 && ihdr[19] == 0);
+	if (infoOut->colorType == PngColorType_Palette && infoOut->numPaletteEntries == 0) { infoOut->isSupported = false; }
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                           Adler-32                           |
+// +--------------------------------------------------------------+
+#if TRS_SIMD_AVX || TRS_SIMD_SSE
+static inline u32 SumPngLanes(__m128i value)
+{
+	value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+	value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+	return (u32)_mm_cvtsi128_si32(value);
+}
+#endif
+
+// The zlib checksum, a is 1 plus the sum of the bytes and b is the sum of every a along the way (both mod 65521)
+u32 CalcPngAdler32(const u8* bytes, uxx numBytes)
+{
+	u32 sumA = 1;
+	u32 sumB = 0;
+	while (numBytes > 0)
+	{
+		uxx blockSize = MinUXX(numBytes, PNG_ADLER_MAX_BLOCK);
+		uxx bIndex = 0;
+		#if TRS_SIMD_AVX || TRS_SIMD_SSE
+		{
+			//Over 16 bytes b grows by 16 * a plus each byte weighted by its distance from the end (16 down to 1),
+			//so a whole block only needs the byte sums, the running total of the earlier byte sums and the weighted sums
+			__m128i zero = _mm_setzero_si128();
+			__m128i weightsLow = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+			__m128i weightsHigh = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+			__m128i byteSums = zero;
+			__m128i earlierByteSums = zero;
+			__m128i weightedSums = zero;
+			for (; bIndex + 16 <= blockSize; bIndex += 16)
+			{
+				__m128i value = _mm_loadu_si128((const __m128i*)&bytes[bIndex]);
+				earlierByteSums = _mm_add_epi32(earlierByteSums, byteSums);
+				byteSums = _mm_add_epi32(byteSums, _mm_sad_epu8(value, zero));
+				weightedSums = _mm_add_epi32(weightedSums, _mm_madd_epi16(_mm_unpacklo_epi8(value, zero), weightsLow));
+				weightedSums = _mm_add_epi32(weightedSums, _mm_madd_epi16(_mm_unpackhi_epi8(value, zero), weightsHigh));
+			}
+			u64 newSumB = (u64)sumB + (u64)sumA * bIndex + 16 * (u64)SumPngLanes(earlierByteSums) + (u64)SumPngLanes(weightedSums);
+			sumA += SumPngLanes(byteSums);
+			sumB = (u32)(newSumB % PNG_ADLER_MODULUS);
+		}
+		#endif
+		for (; bIndex < blockSize; bIndex++) { sumA += bytes[bIndex]; sumB += sumA; }
+		sumA %= PNG_ADLER_MODULUS;
+		sumB %= PNG_ADLER_MODULUS;
+		bytes += blockSize;
+		numBytes -= blockSize;
+	}
+	return (sumB << 16) | sumA;
+}
+
+// +--------------------------------------------------------------+
+// |                           Inflate                            |
+// +--------------------------------------------------------------+
+static const u16 PngLengthBases[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const u8 PngLengthExtraBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const u16 PngDistanceBases[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const u8 PngDistanceExtraBits[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const u8 PngCodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+static inline u32 ReversePngBits16(u32 value)
+{
+	value = ((value & 0xAAAA) >> 1) | ((value & 0x5555) << 1);
+	value = ((value & 0xCCCC) >> 2) | ((value & 0x3333) << 2);
+	value = ((value & 0xF0F0) >> 4) | ((value & 0x0F0F) << 4);
+	value = ((value & 0xFF00) >> 8) | ((value & 0x00FF) << 8);
+	return value;
+}
+
+// Builds the canonical code for numSymbols code lengths (0 meaning the symbol isn't used)
+static bool BuildPngHuffman(PngHuffman* huffman, const u8* codeLengths, uxx numSymbols)
+{
+	Assert(numSymbols <= PNG_HUFFMAN_MAX_SYMBOLS);
+	uxx lengthCounts[16] = ZEROED;
+	MyMemSet(&huffman->fast[0], 0x00, sizeof(huffman->fast));
+	for (uxx sIndex = 0; sIndex < numSymbols; sIndex++) { lengthCounts[codeLengths[sIndex]]++; }
+	lengthCounts[0] = 0;
+	for (uxx length = 1; length < 16; length++)
+	{
+		if (lengthCounts[length] > ((uxx)1 << length)) { return false; }
+	}
+	u32 nextCodes[16];
+	u32 code = 0;
+	uxx numSorted = 0;
+	for (uxx length = 1; length < 16; length++)
+	{
+		nextCodes[length] = code;
+		huffman->firstCode[length] = (u16)code;
+		huffman->firstSymbol[length] = (u16)numSorted;
+		code += (u32)lengthCounts[length];
+		if (lengthCounts[length] > 0 && code - 1 >= ((u32)1 << length)) { return false; } //over-subscribed
+		huffman->maxCode[length] = code << (16 - length);
+		code <<= 1;
+		numSorted += lengthCounts[length];
+	}
+	huffman->maxCode[16] = 0x10000; //sentinel so the slow search always stops
+	for (uxx sIndex = 0; sIndex < numSymbols; sIndex++)
+	{
+		uxx length = codeLengths[sIndex];
+		if (length == 0) { continue; }
+		uxx sortedIndex = huffman->firstSymbol[length] + (nextCodes[length] - huffman->firstCode[length]);
+		huffman->lengths[sortedIndex] = (u8)length;
+		huffman->symbols[sortedIndex] = (u16)sIndex;
+		if (length <= PNG_HUFFMAN_FAST_BITS)
+		{
+			//The bit reader hands out codes least significant bit first, so the table is indexed by the reversed code
+			u32 reversed = ReversePngBits16(nextCodes[length]) >> (16 - length);
+			for (u32 fIndex = reversed; fIndex < (1 << PNG_HUFFMAN_FAST_BITS); fIndex += ((u32)1 << length))
+			{
+				huffman->fast[fIndex] = (u16)((length << 9) | sIndex);
+			}
+		}
+		nextCodes[length]++;
+	}
+	return true;
+}
+
+static inline void RefillPngBits(PngInflater* inflater)
+{
+	if (inflater->inputEnd - inflater->input >= 8)
+	{
+		//Bits past numBits get loaded again by the next refill, ORing in the same bits twice is harmless
+		u64 word;
+		MyMemCopy(&word, inflater->input, sizeof(word));
+		inflater->bitBuffer |= word << inflater->numBits;
+		inflater->input += (63 - inflater->numBits) >> 3;
+		inflater->numBits |= 56;
+		return;
+	}
+	while (inflater->numBits <= 56)
+	{
+		if (inflater->input < inflater->inputEnd) { inflater->bitBuffer |= (u64)(*inflater->input++) << inflater->numBits; }
+		else { inflater->numPaddingBytes++; }
+		inflater->numBits += 8;
+	}
+}
+
+static inline u32 ConsumePngBits(PngInflater* inflater, u32 numBits)
+{
+	Assert(numBits <= inflater->numBits);
+	u32 result = (u32)(inflater->bitBuffer & (((u64)1 << numBits) - 1));
+	inflater->bitBuffer >>= numBits;
+	inflater->numBits -= numBits;
+	return result;
+}
+
+// Expects at least 16 bits in the buffer. Returns PNG_HUFFMAN_MAX_SYMBOLS for a code that doesn't exist
+static inline u32 DecodePngSymbol(PngInflater* inflater, const PngHuffman* huffman)
+{
+	u16 fastEntry = huffman->fast[inflater->bitBuffer & ((1 << PNG_HUFFMAN_FAST_BITS) - 1)];
+	if (fastEntry != 0)
+	{
+		ConsumePngBits(inflater, fastEntry >> 9);
+		return fastEntry & 0x1FF;
+	}
+	u32 reversed = ReversePngBits16((u32)(inflater->bitBuffer & 0xFFFF));
+	uxx length = PNG_HUFFMAN_FAST_BITS + 1;
+	while (reversed >= huffman->maxCode[length]) { length++; }
+	if (length >= 16) { return PNG_HUFFMAN_MAX_SYMBOLS; }
+	uxx sortedIndex = (reversed >> (16 - length)) - huffman->firstCode[length] + huffman->firstSymbol[length];
+	if (sortedIndex >= PNG_HUFFMAN_MAX_SYMBOLS || huffman->lengths[sortedIndex] != length) { return PNG_HUFFMAN_MAX_SYMBOLS; }
+	ConsumePngBits(inflater, (u32)length);
+	return huffman->symbols[sortedIndex];
+}
+
+static bool ReadPngDynamicCodes(PngInflater* inflater)
+{
+	RefillPngBits(inflater);
+	uxx numLengthCodes = ConsumePngBits(inflater, 5) + 257;
+	uxx numDistanceCodes = ConsumePngBits(inflater, 5) + 1;
+	uxx numCodeLengthCodes = ConsumePngBits(inflater, 4) + 4;
+	u8 codeLengthLengths[19] = ZEROED;
+	for (uxx cIndex = 0; cIndex < numCodeLengthCodes; cIndex++)
+	{
+		RefillPngBits(inflater);
+		codeLengthLengths[PngCodeLengthOrder[cIndex]] = (u8)ConsumePngBits(inflater, 3);
+	}
+	PngHuffman* codeLengthCodes = &inflater->distanceCodes; //borrowed until the real distance codes are built
+	if (!BuildPngHuffman(codeLengthCodes, &codeLengthLengths[0], ArrayCount(codeLengthLengths))) { return false; }
+	
+	u8 codeLengths[286 + 32];
+	uxx numCodeLengths = 0;
+	while (numCodeLengths < numLengthCodes + numDistanceCodes)
+	{
+		RefillPngBits(inflater);
+		u32 symbol = DecodePngSymbol(inflater, codeLengthCodes);
+		u8 repeatValue = 0;
+		uxx repeatCount = 0;
+		if (symbol < 16) { codeLengths[numCodeLengths++] = (u8)symbol; continue; }
+		else if (symbol == 16)
+		{
+			if (numCodeLengths == 0) { return false; }
+			repeatValue = codeLengths[numCodeLengths - 1];
+			repeatCount = 3 + ConsumePngBits(inflater, 2);
+		}
+		else if (symbol == 17) { repeatCount = 3 + ConsumePngBits(inflater, 3); }
+		else if (symbol == 18) { repeatCount = 11 + ConsumePngBits(inflater, 7); }
+		else { return false; }
+		if (repeatCount > numLengthCodes + numDistanceCodes - numCodeLengths) { return false; }
+		MyMemSet(&codeLengths[numCodeLengths], repeatValue, repeatCount);
+		numCodeLengths += repeatCount;
+	}
+	if (codeLengths[256] == 0) { return false; } //no end of block code
+	if (!BuildPngHuffman(&inflater->lengthCodes, &codeLengths[0], numLengthCodes)) { return false; }
+	if (!BuildPngHuffman(&inflater->distanceCodes, &codeLengths[numLengthCodes], numDistanceCodes)) { return false; }
+	return true;
+}
+
+static void BuildPngFixedCodes(PngInflater* inflater)
+{
+	u8 codeLengths[PNG_HUFFMAN_MAX_SYMBOLS];
+	MyMemSet(&codeLengths[0], 8, 144);
+	MyMemSet(&codeLengths[144], 9, 256 - 144);
+	MyMemSet(&codeLengths[256], 7, 280 - 256);
+	MyMemSet(&codeLengths[280], 8, PNG_HUFFMAN_MAX_SYMBOLS - 280);
+	bool buildResult = BuildPngHuffman(&inflater->lengthCodes, &codeLengths[0], PNG_HUFFMAN_MAX_SYMBOLS);
+	Assert(buildResult);
+	MyMemSet(&codeLengths[0], 5, 30);
+	buildResult = BuildPngHuffman(&inflater->distanceCodes, &codeLengths[0], 30);
+	Assert(buildResult);
+}
+
+// Skips to the next byte boundary and gives the whole bytes still sitting in the bit buffer back to the input
+static void AlignPngInput(PngInflater* inflater)
+{
+	ConsumePngBits(inflater, inflater->numBits & 7);
+	uxx numBufferedBytes = inflater->numBits / 8;
+	uxx numPadding = MinUXX(numBufferedBytes, inflater->numPaddingBytes);
+	inflater->numPaddingBytes -= numPadding;
+	inflater->input -= (numBufferedBytes - numPadding);
+	inflater->bitBuffer = 0;
+	inflater->numBits = 0;
+}
+
+// Stored blocks are byte aligned
+static bool CopyPngStoredBlock(PngInflater* inflater)
+{
+	AlignPngInput(inflater);
+	if (inflater->inputEnd - inflater->input < 4) { return false; }
+	uxx blockSize = (uxx)inflater->input[0] | ((uxx)inflater->input[1] << 8);
+	uxx blockSizeComplement = (uxx)inflater->input[2] | ((uxx)inflater->input[3] << 8);
+	inflater->input += 4;
+	if ((blockSize ^ 0xFFFF) != blockSizeComplement) { return false; }
+	if (blockSize > (uxx)(inflater->inputEnd - inflater->input) || blockSize > (uxx)(inflater->outputEnd - inflater->outputPntr)) { return false; }
+	MyMemCopy(inflater->outputPntr, inflater->input, blockSize);
+	inflater->outputPntr += blockSize;
+	inflater->input += blockSize;
+	return true;
+}
+
+static bool InflatePngHuffmanBlock(PngInflater* inflater)
+{
+	u8* outputPntr = inflater->outputPntr;
+	u8* outputEnd = inflater->outputEnd;
+	while (true)
+	{
+		//A length code, its extra bits, a distance code and its extra bits are at most 15+5+15+13 = 48 bits
+		if (inflater->numBits < 48) { RefillPngBits(inflater); }
+		u32 symbol = DecodePngSymbol(inflater, &inflater->lengthCodes);
+		if (symbol < 256)
+		{
+			if (outputPntr >= outputEnd) { return false; }
+			*outputPntr++ = (u8)symbol;
+			continue;
+		}
+		if (symbol == 256) { break; }
+		symbol -= 257;
+		if (symbol >= ArrayCount(PngLengthBases)) { return false; }
+		uxx length = PngLengthBases[symbol] + ConsumePngBits(inflater, PngLengthExtraBits[symbol]);
+		u32 distanceSymbol = DecodePngSymbol(inflater, &inflater->distanceCodes);
+		if (distanceSymbol >= ArrayCount(PngDistanceBases)) { return false; }
+		uxx distance = PngDistanceBases[distanceSymbol] + ConsumePngBits(inflater, PngDistanceExtraBits[distanceSymbol]);
+		if (distance > (uxx)(outputPntr - inflater->output) || length > (uxx)(outputEnd - outputPntr)) { return false; }
+		const u8* source = outputPntr - distance;
+		if (distance >= 8)
+		{
+			//Every 8 byte chunk only reads bytes that were written before it, the overshoot lands in PNG_INFLATE_SLACK
+			u8* copyEnd = outputPntr + length;
+			while (outputPntr < copyEnd) { MyMemCopy(outputPntr, source, 8); outputPntr += 8; source += 8; }
+			outputPntr = copyEnd;
+		}
+		else if (distance == 1) { MyMemSet(outputPntr, source[0], length); outputPntr += length; }
+		else { for (uxx bIndex = 0; bIndex < length; bIndex++) { *outputPntr++ = source[bIndex]; } }
+	}
+	inflater->outputPntr = outputPntr;
+	return true;
+}
+
+// Inflates the zlib stream in input into exactly outputSize bytes and checks the Adler-32 that follows it
+static bool InflatePngData(PngInflater* inflater, Str8 input, u8* output, uxx outputSize)
+{
+	ClearPointer(inflater);
+	if (input.length < 2) { return false; }
+	const u8* inputBytes = (const u8*)input.chars;
+	u8 compressionMethod = inputBytes[0];
+	u8 flags = inputBytes[1];
+	if ((compressionMethod & 0x0F) != 8 || (((u32)compressionMethod << 8) | flags) % 31 != 0 || (flags & 0x20) != 0) { return false; }
+	inflater->input = inputBytes + 2;
+	inflater->inputEnd = inputBytes + input.length;
+	inflater->output = output;
+	inflater->outputPntr = output;
+	inflater->outputEnd = output + outputSize;
+	bool isFinalBlock = false;
+	while (!isFinalBlock)
+	{
+		RefillPngBits(inflater);
+		isFinalBlock = (ConsumePngBits(inflater, 1) != 0);
+		u32 blockType = ConsumePngBits(inflater, 2);
+		bool blockResult = false;
+		if (blockType == 0) { blockResult = CopyPngStoredBlock(inflater); }
+		else if (blockType == 1) { BuildPngFixedCodes(inflater); blockResult = InflatePngHuffmanBlock(inflater); }
+		else if (blockType == 2) { blockResult = (ReadPngDynamicCodes(inflater) && InflatePngHuffmanBlock(inflater)); }
+		if (!blockResult) { return false; }
+		if (inflater->numPaddingBytes > 8) { return false; } //read well past the end of the data
+	}
+	if (inflater->outputPntr != inflater->outputEnd) { return false; }
+	AlignPngInput(inflater);
+	if (inflater->inputEnd - inflater->input < 4) { return false; }
+	return (ReadPngU32(inflater->input) == CalcPngAdler32(output, outputSize)); //big-endian like everything else in the zlib header
+}
+
+// +--------------------------------------------------------------+
+// |                          Unfiltering                         |
+// +--------------------------------------------------------------+
+static inline u8 GetPngPaethPredictor(u8 left, u8 above, u8 aboveLeft)
+{
+	i32 distLeft = (i32)above - (i32)aboveLeft;
+	i32 distAbove = (i32)left - (i32)aboveLeft;
+	i32 distAboveLeft = distLeft + distAbove;
+	distLeft = (distLeft < 0) ? -distLeft : distLeft;
+	distAbove = (distAbove < 0) ? -distAbove : distAbove;
+	distAboveLeft = (distAboveLeft < 0) ? -distAboveLeft : distAboveLeft;
+	if (distLeft <= distAbove && distLeft <= distAboveLeft) { return left; }
+	return (distAbove <= distAboveLeft) ? above : aboveLeft;
+}
+
+static void UnfilterPngUp(const u8* row, const u8* prior, u8* out, uxx rowSize)
+{
+	uxx bIndex = 0;
+	#if PNG_SIMD_AVX2
+	for (; bIndex + 32 <= rowSize; bIndex += 32)
+	{
+		__m256i filtered = _mm256_loadu_si256((const __m256i*)&row[bIndex]);
+		__m256i above = _mm256_loadu_si256((const __m256i*)&prior[bIndex]);
+		_mm256_storeu_si256((__m256i*)&out[bIndex], _mm256_add_epi8(filtered, above));
+	}
+	#endif
+	#if TRS_SIMD_AVX || TRS_SIMD_SSE
+	for (; bIndex + 16 <= rowSize; bIndex += 16)
+	{
+		__m128i filtered = _mm_loadu_si128((const __m128i*)&row[bIndex]);
+		__m128i above = _mm_loadu_si128((const __m128i*)&prior[bIndex]);
+		_mm_storeu_si128((__m128i*)&out[bIndex], _mm_add_epi8(filtered, above));
+	}
+	#elif TRS_SIMD_NEON
+	for (; bIndex + 16 <= rowSize; bIndex += 16)
+	{
+		vst1q_u8(&out[bIndex], vaddq_u8(vld1q_u8(&row[bIndex]), vld1q_u8(&prior[bIndex])));
+	}
+	#endif
+	for (; bIndex < rowSize; bIndex++) { out[bIndex] = (u8)(row[bIndex] + prior[bIndex]); }
+}
+
+static void UnfilterPngRowScalar(PngFilter filter, const u8* row, const u8* prior, u8* out, uxx rowSize, uxx bytesPerPixel)
+{
+	switch (filter)
+	{
+		case PngFilter_Sub:
+		{
+			for (uxx bIndex = 0; bIndex < bytesPerPixel; bIndex++) { out[bIndex] = row[bIndex]; }
+			for (uxx bIndex = bytesPerPixel; bIndex < rowSize; bIndex++) { out[bIndex] = (u8)(row[bIndex] + out[bIndex - bytesPerPixel]); }
+		} break;
+		case PngFilter_Avg:
+		{
+			for (uxx bIndex = 0; bIndex < bytesPerPixel; bIndex++) { out[bIndex] = (u8)(row[bIndex] + (prior[bIndex] >> 1)); }
+			for (uxx bIndex = bytesPerPixel; bIndex < rowSize; bIndex++) { out[bIndex] = (u8)(row[bIndex] + (((u32)out[bIndex - bytesPerPixel] + (u32)prior[bIndex]) >> 1)); }
+		} break;
+		case PngFilter_Paeth:
+		{
+			for (uxx bIndex = 0; bIndex < bytesPerPixel; bIndex++) { out[bIndex] = (u8)(row[bIndex] + prior[bIndex]); }
+			for (uxx bIndex = bytesPerPixel; bIndex < rowSize; bIndex++)
+			{
+				out[bIndex] = (u8)(row[bIndex] + GetPngPaethPredictor(out[bIndex - bytesPerPixel], prior[bIndex], prior[bIndex - bytesPerPixel]));
+			}
+		} break;
+		default: Assert(false); break;
+	}
+}
+
+#if TRS_SIMD_AVX || TRS_SIMD_SSE
+// Sub, Avg and Paeth depend on the pixel to the left so a row can't go wide across pixels, instead all the
+// channels of one pixel are handled at once in the low lanes (the same approach libpng takes)
+// 3 byte pixels are loaded with one 4 byte read (building them from a 2 and a 1 byte load was 2-3x slower)
+// so row and prior need a readable byte past their end, see UnfilterPngRow
+static inline __m128i LoadPngPixel(const u8* pntr, uxx bytesPerPixel)
+{
+	u32 value = 0;
+	MyMemCopy(&value, pntr, sizeof(value));
+	if (bytesPerPixel == 3) { value &= 0x00FFFFFF; }
+	return _mm_cvtsi32_si128((int)value);
+}
+static inline void StorePngPixel(u8* pntr, __m128i pixel, uxx bytesPerPixel)
+{
+	u32 value = (u32)_mm_cvtsi128_si32(pixel);
+	MyMemCopy(pntr, &value, bytesPerPixel);
+}
+static inline __m128i SelectPngLanes(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+	return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+static inline __m128i AbsPngLanes(__m128i value)
+{
+	return _mm_max_epi16(value, _mm_sub_epi16(_mm_setzero_si128(), value));
+}
+
+// Always called with a constant bytesPerPixel so the pixel loads and stores compile down to plain moves
+static inline void UnfilterPngRowSse(PngFilter filter, const u8* row, const u8* prior, u8* out, uxx rowSize, uxx bytesPerPixel)
+{
+	__m128i zero = _mm_setzero_si128();
+	switch (filter)
+	{
+		case PngFilter_Sub:
+		{
+			__m128i left = zero;
+			for (uxx bIndex = 0; bIndex < rowSize; bIndex += bytesPerPixel)
+			{
+				left = _mm_add_epi8(left, LoadPngPixel(&row[bIndex], bytesPerPixel));
+				StorePngPixel(&out[bIndex], left, bytesPerPixel);
+			}
+		} break;
+		case PngFilter_Avg:
+		{
+			//_mm_avg_epu8 rounds up, the filter wants (left + above) >> 1
+			__m128i ones = _mm_set1_epi8(1);
+			__m128i left = zero;
+			for (uxx bIndex = 0; bIndex < rowSize; bIndex += bytesPerPixel)
+			{
+				__m128i above = LoadPngPixel(&prior[bIndex], bytesPerPixel);
+				__m128i average = _mm_sub_epi8(_mm_avg_epu8(left, above), _mm_and_si128(_mm_xor_si128(left, above), ones));
+				left = _mm_add_epi8(average, LoadPngPixel(&row[bIndex], bytesPerPixel));
+				StorePngPixel(&out[bIndex], left, bytesPerPixel);
+			}
+		} break;
+		case PngFilter_Paeth:
+		{
+			//Widened to 16 bits so the distances can go negative
+			__m128i left = zero;
+			__m128i aboveLeft = zero;
+			for (uxx bIndex = 0; bIndex < rowSize; bIndex += bytesPerPixel)
+			{
+				__m128i above = _mm_unpacklo_epi8(LoadPngPixel(&prior[bIndex], bytesPerPixel), zero);
+				__m128i filtered = _mm_unpacklo_epi8(LoadPngPixel(&row[bIndex], bytesPerPixel), zero);
+				__m128i distLeft = _mm_sub_epi16(above, aboveLeft);
+				__m128i distAbove = _mm_sub_epi16(left, aboveLeft);
+				__m128i distAboveLeft = AbsPngLanes(_mm_add_epi16(distLeft, distAbove));
+				distLeft = AbsPngLanes(distLeft);
+				distAbove = AbsPngLanes(distAbove);
+				__m128i smallest = _mm_min_epi16(distAboveLeft, _mm_min_epi16(distLeft, distAbove));
+				__m128i predictor = SelectPngLanes(_mm_cmpeq_epi16(smallest, distLeft), left, SelectPngLanes(_mm_cmpeq_epi16(smallest, distAbove), above, aboveLeft));
+				//An 8-bit add wraps each channel mod 256 and leaves the zeroed high bytes alone
+				left = _mm_add_epi8(filtered, predictor);
+				aboveLeft = above;
+				StorePngPixel(&out[bIndex], _mm_packus_epi16(left, left), bytesPerPixel);
+			}
+		} break;
+		default: Assert(false); break;
+	}
+}
+#endif //TRS_SIMD_AVX || TRS_SIMD_SSE
+
+// out can be the same memory as row, prior is the previous row after unfiltering (all zeros for the first row).
+// For 3 byte pixels the byte after the end of row and prior has to be readable, in the inflate buffer that's
+// the next row's filter type byte (or PNG_INFLATE_SLACK after the last row).
+// Sub, Avg and Paeth stay on 128-bit registers even with AVX2 since a pixel never fills more than 4 lanes
+static void UnfilterPngRow(PngFilter filter, const u8* row, const u8* prior, u8* out, uxx rowSize, uxx bytesPerPixel)
+{
+	if (filter == PngFilter_None) { if (out != row) { MyMemCopy(out, row, rowSize); } return; }
+	if (filter == PngFilter_Up) { UnfilterPngUp(row, prior, out, rowSize); return; }
+	#if TRS_SIMD_AVX || TRS_SIMD_SSE
+	if (bytesPerPixel == 4) { UnfilterPngRowSse(filter, row, prior, out, rowSize, 4); return; }
+	if (bytesPerPixel == 3) { UnfilterPngRowSse(filter, row, prior, out, rowSize, 3); return; }
+	#endif
+	UnfilterPngRowScalar(filter, row, prior, out, rowSize, bytesPerPixel);
+}
+
+#if PNG_SIMD_AVX2
+// Expands 8 pixels at a time and returns how many it got through, the rest (and anything with a transparent color) is left to ExpandPngRow.
+// Rgb reads 4 bytes past the 24 it uses, in the inflate buffer that's the next row (or PNG_INFLATE_SLACK after the last row)
+static uxx ExpandPngRowAvx2(const PngInfo* info, const u8* row, u32* pixelsOut)
+{
+	uxx width = (uxx)info->size.Width;
+	uxx pIndex = 0;
+	__m256i opaque = _mm256_set1_epi32((int)0xFF000000);
+	__m256i grayToRgb = _mm256_set1_epi32(0x010101);
+	switch (info->colorType)
+	{
+		case PngColorType_Gray:
+		{
+			if (info->hasTransparentColor) { break; }
+			for (; pIndex + 8 <= width; pIndex += 8)
+			{
+				__m256i gray = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&row[pIndex]));
+				_mm256_storeu_si256((__m256i*)&pixelsOut[pIndex], _mm256_or_si256(_mm256_mullo_epi32(gray, grayToRgb), opaque));
+			}
+		} break;
+		case PngColorType_GrayAlpha:
+		{
+			__m256i grayMask = _mm256_set1_epi32(0xFF);
+			for (; pIndex + 8 <= width; pIndex += 8)
+			{
+				//Each lane holds gray | (alpha << 8)
+				__m256i grayAlpha = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&row[pIndex*2]));
+				__m256i rgb = _mm256_mullo_epi32(_mm256_and_si256(grayAlpha, grayMask), grayToRgb);
+				_mm256_storeu_si256((__m256i*)&pixelsOut[pIndex], _mm256_or_si256(rgb, _mm256_and_si256(_mm256_slli_epi32(grayAlpha, 16), opaque)));
+			}
+		} break;
+		case PngColorType_Rgb:
+		{
+			if (info->hasTransparentColor) { break; }
+			//The shuffle can't cross the 128-bit halves so each half is loaded with its own 4 pixels (12 bytes) at the bottom
+			__m256i spread = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+			for (; pIndex + 8 <= width; pIndex += 8)
+			{
+				const u8* rgb = &row[pIndex * 3];
+				__m256i packed = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&rgb[0])), _mm_loadu_si128((const __m128i*)&rgb[12]), 1);
+				_mm256_storeu_si256((__m256i*)&pixelsOut[pIndex], _mm256_or_si256(_mm256_shuffle_epi8(packed, spread), opaque));
+			}
+		} break;
+		case PngColorType_Palette:
+		{
+			for (; pIndex + 8 <= width; pIndex += 8)
+			{
+				__m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&row[pIndex]));
+				_mm256_storeu_si256((__m256i*)&pixelsOut[pIndex], _mm256_i32gather_epi32((const int*)&info->palette[0], indices, 4));
+			}
+		} break;
+		default: break;
+	}
+	return pIndex;
+}
+#endif //PNG_SIMD_AVX2
+
+// Turns one unfiltered row into RGBA8 (gray is copied into R, G and B the same way TryParseImageFile does)
+static void ExpandPngRow(const PngInfo* info, const u8* row, u32* pixelsOut)
+{
+	uxx width = (uxx)info->size.Width;
+	uxx pIndex = 0;
+	#if PNG_SIMD_AVX2
+	pIndex = ExpandPngRowAvx2(info, row, pixelsOut);
+	#endif
+	switch (info->colorType)
+	{
+		case PngColorType_Gray:
+		{
+			for (; pIndex < width; pIndex++)
+			{
+				u32 alpha = (info->hasTransparentColor && row[pIndex] == info->transparentColor[0]) ? 0x00 : 0xFF;
+				pixelsOut[pIndex] = ((u32)row[pIndex] * 0x010101) | (alpha << 24);
+			}
+		} break;
+		case PngColorType_GrayAlpha:
+		{
+			for (; pIndex < width; pIndex++) { pixelsOut[pIndex] = ((u32)row[pIndex*2] * 0x010101) | ((u32)row[pIndex*2 + 1] << 24); }
+		} break;
+		case PngColorType_Rgb:
+		{
+			for (; pIndex < width; pIndex++)
+			{
+				const u8* rgb = &row[pIndex * 3];
+				u32 alpha = 0xFF;
+				if (info->hasTransparentColor && rgb[0] == info->transparentColor[0] && rgb[1] == info->transparentColor[1] && rgb[2] == info->transparentColor[2]) { alpha = 0x00; }
+				pixelsOut[pIndex] = (u32)rgb[0] | ((u32)rgb[1] << 8) | ((u32)rgb[2] << 16) | (alpha << 24);
+			}
+		} break;
+		case PngColorType_Palette:
+		{
+			for (; pIndex < width; pIndex++) { pixelsOut[pIndex] = info->palette[row[pIndex]]; }
+		} break;
+		default: Assert(false); break;
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                            Decode                            |
+// +--------------------------------------------------------------+
+// Decodes into pixelsOut, which must hold info->size.Width * info->size.Height RGBA8 pixels. info has to come from
+// TryReadPngInfo on the same fileContents and be isSupported. statsOut is optional.
+// RGBA images are unfiltered straight into pixelsOut (each row's prior is the row above it in pixelsOut), the
+// other formats are unfiltered in place in the inflate buffer and then expanded into pixelsOut.
+// Only touches fileContents, pixelsOut and its own scratch memory so it's safe to call from a job (see DecodePngImages)
+Result TryDecodePngInto(Str8 fileContents, const PngInfo* info, u32* pixelsOut, PngDecodeStats* statsOut)
+{
+	NotNull(info);
+	NotNull(pixelsOut);
+	Assert(info->isSupported);
+	ScratchBegin(scratch);
+	PngDecodeStats stats = ZEROED;
+	stats.compressedSize = info->compressedSize;
+	
+	// +==============================+
+	// |           Inflate            |
+	// +==============================+
+	PerfTime inflateStart = GetPerfTime();
+	//TryReadPngInfo already made sure the chunks are all in bounds. A lone IDAT is inflated in place, otherwise they're joined first
+	Str8 compressed = ZEROED;
+	uxx offset = PNG_SIGNATURE_SIZE;
+	u32 chunkType = 0;
+	Str8 chunk = ZEROED;
+	bool isValid = false;
+	if (info->numIdatChunks > 1)
+	{
+		compressed.chars = (char*)AllocArray(u8, scratch, info->compressedSize);
+		NotNull(compressed.chars);
+	}
+	while (GetNextPngChunk(fileContents, &offset, &chunkType, &chunk, &isValid))
+	{
+		if (chunkType != PNG_CHUNK_IDAT) { continue; }
+		if (info->numIdatChunks == 1) { compressed = chunk; break; }
+		MyMemCopy(&compressed.chars[compressed.length], chunk.chars, chunk.length);
+		compressed.length += chunk.length;
+	}
+	Assert(compressed.length == info->compressedSize);
+	uxx filteredRowSize = 1 + info->rowSize;
+	stats.filteredSize = filteredRowSize * (uxx)info->size.Height;
+	u8* filtered = AllocArray(u8, scratch, stats.filteredSize + PNG_INFLATE_SLACK);
+	NotNull(filtered);
+	PngInflater* inflater = AllocType(PngInflater, scratch);
+	NotNull(inflater);
+	if (!InflatePngData(inflater, compressed, filtered, stats.filteredSize)) { ScratchEnd(scratch); return Result_Failure; }
+	PerfTime inflateEnd = GetPerfTime();
+	stats.inflateMs = GetPerfTimeDiff(&inflateStart, &inflateEnd);
+	
+	// +==============================+
+	// |           Unfilter           |
+	// +==============================+
+	PerfTime unfilterStart = GetPerfTime();
+	u8* zeroRow = AllocArray(u8, scratch, info->rowSize + 1);
+	NotNull(zeroRow);
+	MyMemSet(zeroRow, 0x00, info->rowSize + 1);
+	const u8* prior = zeroRow;
+	for (uxx yIndex = 0; yIndex < (uxx)info->size.Height; yIndex++)
+	{
+		u8* row = &filtered[yIndex * filteredRowSize];
+		if (row[0] >= PngFilter_Count) { ScratchEnd(scratch); return Result_Failure; }
+		PngFilter filter = (PngFilter)row[0];
+		stats.filterCounts[filter]++;
+		u32* pixelRow = &pixelsOut[yIndex * (uxx)info->size.Width];
+		if (info->colorType == PngColorType_Rgba)
+		{
+			UnfilterPngRow(filter, row + 1, prior, (u8*)pixelRow, info->rowSize, info->bytesPerPixel);
+			prior = (const u8*)pixelRow;
+		}
+		else
+		{
+			UnfilterPngRow(filter, row + 1, prior, row + 1, info->rowSize, info->bytesPerPixel);
+			ExpandPngRow(info, row + 1, pixelRow);
+			prior = row + 1;
+		}
+	}
+	PerfTime unfilterEnd = GetPerfTime();
+	stats.unfilterMs = GetPerfTimeDiff(&unfilterStart, &unfilterEnd);
+	
+	ScratchEnd(scratch);
+	if (statsOut != nullptr) { *statsOut = stats; }
+	return Result_Success;
+}
+
+// A drop-in replacement for TryParseImageFile, PNGs that TryDecodePngInto can't handle (and every other format) still go through it
+Result TryDecodePngImage(Str8 fileContents, Arena* arena, ImageData* imageDataOut)
+{
+	NotNull(arena);
+	NotNull(imageDataOut);
+	PngInfo info;
+	if (!TryReadPngInfo(fileContents, &info) || !info.isSupported) { return TryParseImageFile(fileContents, arena, imageDataOut); }
+	uxx numPixels = (uxx)info.size.Width * (uxx)info.size.Height;
+	u32* pixels = AllocArray(u32, arena, numPixels);
+	NotNull(pixels);
+	Result result = TryDecodePngInto(fileContents, &info, pixels, nullptr);
+	if (result != Result_Success) { FreeMem(arena, pixels, sizeof(u32) * numPixels); return result; }
+	ClearPointer(imageDataOut);
+	imageDataOut->size = info.size;
+	imageDataOut->pixels = pixels;
+	return Result_Success;
+}
+
+typedef struct PngImageJobs PngImageJobs;
+struct PngImageJobs
+{
+	PngImageDecode* decodes;
+	const uxx* pngIndices; //one per job, the decodes that are isPng
+};
+
+// Only reads its own encoded bytes and only writes the pixels that were allocated for it
+static JOB_FUNC_DEF(DecodePngImageJob)
+{
+	PngImageJobs* context = (PngImageJobs*)userPntr;
+	PngImageDecode* decode = &context->decodes[context->pngIndices[jobIndex]];
+	decode->decoded = (TryDecodePngInto(decode->encoded, &decode->info, decode->imageData.pixels, nullptr) == Result_Success);
+}
+
+// Decodes every image in decodes with one job per PNG. Reading the headers and allocating the pixels from arena
+// happen on the calling thread before the jobs start, the images TryDecodePngInto can't handle go through
+// TryParseImageFile here afterwards. A failed decode frees its pixels and leaves imageData empty
+void DecodePngImages(JobSystem* jobs, Arena* arena, uxx numDecodes, PngImageDecode* decodes)
+{
+	NotNull(arena);
+	Assert(numDecodes == 0 || decodes != nullptr);
+	ScratchBegin1(scratch, arena);
+	uxx* pngIndices = AllocArray(uxx, scratch, numDecodes + 1);
+	NotNull(pngIndices);
+	uxx numPngDecodes = 0;
+	for (uxx dIndex = 0; dIndex < numDecodes; dIndex++)
+	{
+		PngImageDecode* decode = &decodes[dIndex];
+		decode->isPng = false;
+		decode->decoded = false;
+		ClearStruct(decode->imageData);
+		if (decode->encoded.length == 0) { continue; }
+		decode->isPng = (TryReadPngInfo(decode->encoded, &decode->info) && decode->info.isSupported);
+		if (!decode->isPng) { continue; }
+		decode->imageData.size = decode->info.size;
+		decode->imageData.pixels = AllocArray(u32, arena, (uxx)decode->info.size.Width * (uxx)decode->info.size.Height);
+		NotNull(decode->imageData.pixels);
+		pngIndices[numPngDecodes++] = dIndex;
+	}
+	PngImageJobs context = ZEROED;
+	context.decodes = decodes;
+	context.pngIndices = pngIndices;
+	RunJobs(jobs, numPngDecodes, DecodePngImageJob, &context);
+	for (uxx dIndex = 0; dIndex < numDecodes; dIndex++)
+	{
+		PngImageDecode* decode = &decodes[dIndex];
+		if (decode->isPng && !decode->decoded)
+		{
+			FreeMem(arena, decode->imageData.pixels, sizeof(u32) * (uxx)decode->info.size.Width * (uxx)decode->info.size.Height);
+			ClearStruct(decode->imageData);
+		}
+		else if (!decode->isPng && decode->encoded.length > 0) { decode->decoded = (TryParseImageFile(decode->encoded, arena, &decode->imageData) == Result_Success); }
+	}
+	ScratchEnd(scratch);
+}
+
+// +--------------------------------------------------------------+
+// |                          Benchmark                           |
+// +--------------------------------------------------------------+
+PngBenchmarkResult RunPngBenchmark(JobSystem* jobs, Str8 fileContents, uxx numIterations)
+{
+	Assert(numIterations > 0);
+	PngBenchmarkResult result = ZEROED;
+	result.fileSize = fileContents.length;
+	result.numIterations = numIterations;
+	if (!TryReadPngInfo(fileContents, &result.info) || !result.info.isSupported) { return result; }
+	uxx numPixels = (uxx)result.info.size.Width * (uxx)result.info.size.Height;
+	u32* pixels = AllocArray(u32, stdHeap, numPixels);
+	NotNull(pixels);
+	
+	PerfTime decodeStart = GetPerfTime();
+	for (uxx iIndex = 0; iIndex < numIterations; iIndex++)
+	{
+		Result decodeResult = TryDecodePngInto(fileContents, &result.info, pixels, &result.stats);
+		Assert(decodeResult == Result_Success);
+	}
+	PerfTime decodeEnd = GetPerfTime();
+	result.decodeMs = GetPerfTimeDiff(&decodeStart, &decodeEnd) / (r64)numIterations;
+	
+	//The same file numIterations times over, the way a model's textures go through DecodePngImages at load
+	{
+		ScratchBegin(scratch);
+		PngImageDecode* decodes = AllocArray(PngImageDecode, scratch, numIterations);
+		NotNull(decodes);
+		MyMemSet(decodes, 0x00, sizeof(PngImageDecode) * numIterations);
+		for (uxx iIndex = 0; iIndex < numIterations; iIndex++) { decodes[iIndex].encoded = fileContents; }
+		PerfTime batchStart = GetPerfTime();
+		DecodePngImages(jobs, stdHeap, numIterations, decodes);
+		PerfTime batchEnd = GetPerfTime();
+		result.batchMs = GetPerfTimeDiff(&batchStart, &batchEnd) / (r64)numIterations;
+		result.numJobThreads = (jobs != nullptr) ? jobs->numWorkers + 1 : 1;
+		for (uxx iIndex = 0; iIndex < numIterations; iIndex++)
+		{
+			Assert(decodes[iIndex].decoded);
+			FreeMem(stdHeap, decodes[iIndex].imageData.pixels, sizeof(u32) * numPixels);
+		}
+		ScratchEnd(scratch);
+	}
+	
+	result.resultsMatch = true;
+	PerfTime referenceStart = GetPerfTime();
+	for (uxx iIndex = 0; iIndex < numIterations; iIndex++)
+	{
+		ScratchBegin(scratch);
+		ImageData reference = ZEROED;
+		Result referenceResult = TryParseImageFile(fileContents, scratch, &reference);
+		if (iIndex == 0)
+		{
+			if (referenceResult != Result_Success || reference.size.Width != result.info.size.Width || reference.size.Height != result.info.size.Height) { result.resultsMatch = false; }
+			else if (MyMemCompare(reference.pixels, pixels, sizeof(u32) * numPixels) != 0) { result.resultsMatch = false; }
+		}
+		ScratchEnd(scratch);
+	}
+	PerfTime referenceEnd = GetPerfTime();
+	result.referenceMs = GetPerfTimeDiff(&referenceStart, &referenceEnd) / (r64)numIterations;
+	
+	FreeMem(stdHeap, pixels, sizeof(u32) * numPixels);
+	return result;
+}
+
+// Throughput is in decoded (RGBA8) megabytes per second
+void PrintPngBenchmark(JobSystem* jobs, const char* path, uxx numIterations)
+{
+	ScratchBegin(scratch);
+	Str8 fileContents = ZEROED;
+	if (!OsReadFile(FilePathLit(path), scratch, false, &fileContents)) { PrintLine_E("PNG benchmark couldn't read \"%s\"", path); ScratchEnd(scratch); return; }
+	PngBenchmarkResult result = RunPngBenchmark(jobs, fileContents, numIterations);
+	if (!result.info.isSupported) { PrintLine_W("PNG benchmark skipped \"%s\", TryDecodePngInto doesn't support it", path); ScratchEnd(scratch); return; }
+	r64 pixelMegabytes = (r64)((uxx)result.info.size.Width * (uxx)result.info.size.Height * sizeof(u32)) / (r64)Megabytes(1);
+	PrintLine_I("PNG benchmark \"%s\" (%dx%d, %llu bytes per pixel, %.1lfMB file, %llu IDAT chunk%s):", path, result.info.size.Width, result.info.size.Height, (u64)result.info.bytesPerPixel, (r64)result.fileSize / (r64)Megabytes(1), (u64)result.info.numIdatChunks, Plural(result.info.numIdatChunks, "s"));
+	PrintLine_I("\tRows: %llu none, %llu sub, %llu up, %llu avg, %llu paeth", (u64)result.stats.filterCounts[PngFilter_None], (u64)result.stats.filterCounts[PngFilter_Sub], (u64)result.stats.filterCounts[PngFilter_Up], (u64)result.stats.filterCounts[PngFilter_Avg], (u64)result.stats.filterCounts[PngFilter_Paeth]);
+	PrintLine_I("\tInflate: %.3lfms, Unfilter: %.3lfms", result.stats.inflateMs, result.stats.unfilterMs);
+	PrintLine_I("\tDecode: %.3lfms (%.1lfMB/s) vs %.3lfms (%.1lfMB/s) TryParseImageFile (%.1lfx)", result.decodeMs, pixelMegabytes / (result.decodeMs / 1000.0), result.referenceMs, pixelMegabytes / (result.referenceMs / 1000.0), result.referenceMs / result.decodeMs);
+	PrintLine_I("\tBatch of %llu on %llu thread%s: %.3lfms per image (%.1lfMB/s)", (u64)result.numIterations, (u64)result.numJobThreads, Plural(result.numJobThreads, "s"), result.batchMs, pixelMegabytes / (result.batchMs / 1000.0));
+	if (!result.resultsMatch) { PrintLine_E("\tDecoded pixels did not match TryParseImageFile!"); }
+	ScratchEnd(scratch);
+}
@@ -0,0 +1,144 @@
+/*
+File:   app_png_decode.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A PNG decoder for the 8-bit, non-interlaced images that make up nearly all of our texture data.
+	** Decoding happens in two passes: the whole IDAT stream is inflated into one buffer of filtered
+	** rows first, then each row is unfiltered (Up, Sub, Avg and Paeth use SSE2 for 3 and 4 byte pixels)
+	** and expanded straight into the caller's RGBA8 pixels, so the destination can be the final ImageData
+	** or an upload buffer without another copy. Up and the expansion to RGBA8 go 32 bytes wide on AVX2
+	** targets. Anything else (16-bit, sub-byte depths, interlacing, other file formats) is handed to
+	** TryParseImageFile by TryDecodePngImage.
+	** DecodePngImages decodes a whole set of images at once with one job per image.
+	** The zlib Adler-32 of the inflated data is checked. The chunk CRCs are skipped on purpose: a CRC-32
+	** over every IDAT costs about as much as the unfiltering, damage to the image data already fails the
+	** Adler-32, and the few header fields we read are range checked (stb_image skips them too).
+*/
+
+#ifndef _APP_PNG_DECODE_H
+#define _APP_PNG_DECODE_H
+
+#define PNG_SIGNATURE_SIZE      8
+#define PNG_CHUNK_IHDR          0x49484452 //"IHDR", chunk types are read big-endian
+#define PNG_CHUNK_PLTE          0x504C5445 //"PLTE"
+#define PNG_CHUNK_TRNS          0x74524E53 //"tRNS"
+#define PNG_CHUNK_IDAT          0x49444154 //"IDAT"
+#define PNG_CHUNK_IEND          0x49454E44 //"IEND"
+#define PNG_MAX_DIMENSION       16384
+#define PNG_HUFFMAN_FAST_BITS   10
+#define PNG_HUFFMAN_MAX_SYMBOLS 288
+#define PNG_INFLATE_SLACK       16 //bytes past the end of the inflate output so matches can be copied 8 bytes at a time
+#define PNG_ADLER_MODULUS       65521
+#define PNG_ADLER_MAX_BLOCK     5552 //most bytes that can be summed before the modulo without overflowing 32 bits
+
+//The 256-bit integer instructions need AVX2, TRS_SIMD_AVX only promises AVX
+#if TRS_SIMD_AVX && defined(__AVX2__)
+#define PNG_SIMD_AVX2 1
+#else
+#define PNG_SIMD_AVX2 0
+#endif
+
+typedef enum PngColorType PngColorType;
+enum PngColorType
+{
+	PngColorType_Gray      = 0,
+	PngColorType_Rgb       = 2,
+	PngColorType_Palette   = 3,
+	PngColorType_GrayAlpha = 4,
+	PngColorType_Rgba      = 6,
+};
+
+typedef enum PngFilter PngFilter;
+enum PngFilter
+{
+	PngFilter_None = 0,
+	PngFilter_Sub,
+	PngFilter_Up,
+	PngFilter_Avg,
+	PngFilter_Paeth,
+	PngFilter_Count,
+};
+
+typedef struct PngInfo PngInfo;
+struct PngInfo
+{
+	v2i size;
+	u8 bitDepth;
+	u8 colorType; //PngColorType
+	u8 interlaceMethod;
+	bool isSupported; //false when TryDecodePngInto can't decode it (TryParseImageFile still might)
+	uxx bytesPerPixel; //in the file, before expanding to RGBA8
+	uxx rowSize; //bytes in one unfiltered row, not counting the filter type byte
+	uxx numIdatChunks;
+	uxx compressedSize; //over every IDAT chunk
+	uxx numPaletteEntries;
+	u32 palette[256]; //RGBA8 with the tRNS alpha already applied, entries past numPaletteEntries are 0
+	bool hasTransparentColor; //tRNS on a Gray or Rgb image, pixels of exactly that color get alpha 0
+	u8 transparentColor[3];
+};
+
+// One Huffman code. Codes up to PNG_HUFFMAN_FAST_BITS long resolve with a single lookup in fast,
+// longer codes compare the bit-reversed input against maxCode for each length
+typedef struct PngHuffman PngHuffman;
+struct PngHuffman
+{
+	u16 fast[1 << PNG_HUFFMAN_FAST_BITS]; //(length << 9) | symbol, 0 when the code is longer than PNG_HUFFMAN_FAST_BITS
+	u32 maxCode[17]; //first code that's too long for each length, left aligned in 16 bits
+	u16 firstCode[16];
+	u16 firstSymbol[16];
+	u16 symbols[PNG_HUFFMAN_MAX_SYMBOLS]; //sorted by code
+	u8 lengths[PNG_HUFFMAN_MAX_SYMBOLS]; //of each entry in symbols
+};
+
+typedef struct PngInflater PngInflater;
+struct PngInflater
+{
+	const u8* input;
+	const u8* inputEnd;
+	uxx numPaddingBytes; //zeros fed in after inputEnd, a few are expected while decoding the last codes
+	u64 bitBuffer;
+	u32 numBits;
+	u8* output;
+	u8* outputPntr;
+	u8* outputEnd;
+	PngHuffman lengthCodes;
+	PngHuffman distanceCodes;
+};
+
+typedef struct PngDecodeStats PngDecodeStats;
+struct PngDecodeStats
+{
+	uxx compressedSize;
+	uxx filteredSize; //inflated bytes, including the filter type byte at the start of each row
+	uxx filterCounts[PngFilter_Count]; //rows using each filter
+	r64 inflateMs;
+	r64 unfilterMs; //includes expanding to RGBA8
+};
+
+// One image for DecodePngImages, only encoded has to be filled in (an empty encoded is skipped)
+typedef struct PngImageDecode PngImageDecode;
+struct PngImageDecode
+{
+	Str8 encoded; //the whole file, has to stay alive until DecodePngImages returns
+	PngInfo info;
+	bool isPng; //false for formats (and PNG variants) TryDecodePngInto doesn't handle, those go through TryParseImageFile on the calling thread
+	bool decoded;
+	ImageData imageData; //allocated from the arena given to DecodePngImages, empty when !decoded
+};
+
+typedef struct PngBenchmarkResult PngBenchmarkResult;
+struct PngBenchmarkResult
+{
+	PngInfo info;
+	uxx fileSize;
+	uxx numIterations;
+	PngDecodeStats stats; //of the last iteration
+	r64 referenceMs; //TryParseImageFile, average per iteration
+	r64 decodeMs; //TryDecodePngInto, average per iteration
+	r64 batchMs; //DecodePngImages with one copy of the file per iteration, divided by numIterations
+	uxx numJobThreads; //workers plus the calling thread that batchMs was split across
+	bool resultsMatch;
+};
+
+#endif //  _APP_PNG_DECODE_H
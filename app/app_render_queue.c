@@ -0,0 +1,118 @@
+/*
+File:   app_render_queue.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that build, sort and measure the RenderQueue
+	** NOTE: The overdraw estimate works on screen rectangles of the instance bounds, not on actual
+	** triangles, so it overestimates for thin or hollow models. It's meant to show trends (more
+	** chests on screen, pre-pass on/off) rather than to match a GPU counter.
+*/
+
+void FreeRenderQueue(RenderQueue* queue)
+{
+	NotNull(queue);
+	if (queue->arena != nullptr)
+	{
+		FreeVarArray(&queue->items);
+		FreeVarArray(&queue->meshletRanges);
+		if (queue->coverage != nullptr) { FreeMem(queue->arena, queue->coverage, RENDER_QUEUE_COVERAGE_WIDTH * RENDER_QUEUE_COVERAGE_HEIGHT); }
+	}
+	ClearPointer(queue);
+}
+
+void InitRenderQueue(Arena* arena, uxx expectedNumItems, RenderQueue* queueOut)
+{
+	NotNull(arena);
+	NotNull(queueOut);
+	ClearPointer(queueOut);
+	queueOut->arena = arena;
+	InitVarArrayWithInitial(RenderQueueItem, &queueOut->items, arena, expectedNumItems);
+	InitVarArray(MeshletDrawRange, &queueOut->meshletRanges, arena);
+	queueOut->coverage = AllocArray(u8, arena, RENDER_QUEUE_COVERAGE_WIDTH * RENDER_QUEUE_COVERAGE_HEIGHT);
+	NotNull(queueOut->coverage);
+}
+
+void ClearRenderQueue(RenderQueue* queue)
+{
+	NotNull(queue);
+	VarArrayClear(&queue->items);
+	VarArrayClear(&queue->meshletRanges);
+	queue->totalScreenArea = 0.0f;
+	queue->coveredScreenArea = 0.0f;
+	queue->estimatedOverdraw = 0.0f;
+}
+
+// Normalized screen rectangle of the box's projection. Boxes that cross the near plane cover the whole screen
+rec GetBoxScreenRec(mat4 viewProjMat, box bounds)
+{
+	r32 minX = HighestR32, minY = HighestR32;
+	r32 maxX = LowestR32, maxY = LowestR32;
+	for (uxx cIndex = 0; cIndex < 8; cIndex++)
+	{
+		v3 corner = NewV3(
+			bounds.BottomLeftBack.X + ((cIndex & 1) ? bounds.Size.X : 0.0f),
+			bounds.BottomLeftBack.Y + ((cIndex & 2) ? bounds.Size.Y : 0.0f),
+			bounds.BottomLeftBack.Z + ((cIndex & 4) ? bounds.Size.Z : 0.0f)
+		);
+		v4 clip = TransformOcclusionPoint(&viewProjMat, corner);
+		if (clip.W < OCCLUSION_NEAR_W) { return NewRec(0, 0, 1, 1); }
+		r32 screenX = clip.X / clip.W * 0.5f + 0.5f;
+		r32 screenY = 0.5f - clip.Y / clip.W * 0.5f;
+		minX = MinR32(minX, screenX); maxX = MaxR32(maxX, screenX);
+		minY = MinR32(minY, screenY); maxY = MaxR32(maxY, screenY);
+	}
+	minX = ClampR32(minX, 0.0f, 1.0f); maxX = ClampR32(maxX, 0.0f, 1.0f);
+	minY = ClampR32(minY, 0.0f, 1.0f); maxY = ClampR32(maxY, 0.0f, 1.0f);
+	return NewRec(minX, minY, maxX - minX, maxY - minY);
+}
+
+RenderQueueItem* AddRenderQueueItem(RenderQueue* queue, u32 instanceIndex, r32 viewDepth, rec screenRec)
+{
+	NotNull(queue);
+	RenderQueueItem* result = VarArrayAdd(RenderQueueItem, &queue->items);
+	NotNull(result);
+	ClearPointer(result);
+	result->instanceIndex = instanceIndex;
+	result->firstRange = RENDER_QUEUE_NO_RANGES;
+	result->firstDraw = STAGED_DRAW_NONE;
+	result->viewDepth = viewDepth;
+	result->screenRec = screenRec;
+	return result;
+}
+
+static int CompareRenderQueueItems(const void* left, const void* right)
+{
+	r32 leftDepth = ((const RenderQueueItem*)left)->viewDepth;
+	r32 rightDepth = ((const RenderQueueItem*)right)->viewDepth;
+	return (leftDepth < rightDepth) ? -1 : ((leftDepth > rightDepth) ? 1 : 0);
+}
+
+// Sorts the items front-to-back (so the depth test rejects as much as possible in both passes) and fills in the overdraw estimate
+void FinishRenderQueue(RenderQueue* queue)
+{
+	NotNull(queue);
+	if (queue->items.length > 1) { qsort(queue->items.items, queue->items.length, sizeof(RenderQueueItem), CompareRenderQueueItems); }
+	
+	MyMemSet(queue->coverage, 0x00, RENDER_QUEUE_COVERAGE_WIDTH * RENDER_QUEUE_COVERAGE_HEIGHT);
+	queue->totalScreenArea = 0.0f;
+	VarArrayLoop(&queue->items, qIndex)
+	{
+		VarArrayLoopGet(RenderQueueItem, item, &queue->items, qIndex);
+		queue->totalScreenArea += item->screenRec.Width * item->screenRec.Height;
+		i32 cellMinX = ClampI32(FloorR32i(item->screenRec.X * RENDER_QUEUE_COVERAGE_WIDTH), 0, RENDER_QUEUE_COVERAGE_WIDTH-1);
+		i32 cellMaxX = ClampI32(CeilR32i((item->screenRec.X + item->screenRec.Width) * RENDER_QUEUE_COVERAGE_WIDTH) - 1, 0, RENDER_QUEUE_COVERAGE_WIDTH-1);
+		i32 cellMinY = ClampI32(FloorR32i(item->screenRec.Y * RENDER_QUEUE_COVERAGE_HEIGHT), 0, RENDER_QUEUE_COVERAGE_HEIGHT-1);
+		i32 cellMaxY = ClampI32(CeilR32i((item->screenRec.Y + item->screenRec.Height) * RENDER_QUEUE_COVERAGE_HEIGHT) - 1, 0, RENDER_QUEUE_COVERAGE_HEIGHT-1);
+		for (i32 yIndex = cellMinY; yIndex <= cellMaxY; yIndex++)
+		{
+			u8* coverageRow = &queue->coverage[yIndex * RENDER_QUEUE_COVERAGE_WIDTH];
+			for (i32 xIndex = cellMinX; xIndex <= cellMaxX; xIndex++) { if (coverageRow[xIndex] < 255) { coverageRow[xIndex]++; } }
+		}
+	}
+	
+	uxx numCoveredCells = 0;
+	for (uxx cIndex = 0; cIndex < RENDER_QUEUE_COVERAGE_WIDTH * RENDER_QUEUE_COVERAGE_HEIGHT; cIndex++) { if (queue->coverage[cIndex] > 0) { numCoveredCells++; } }
+	queue->coveredScreenArea = (r32)numCoveredCells / (r32)(RENDER_QUEUE_COVERAGE_WIDTH * RENDER_QUEUE_COVERAGE_HEIGHT);
+	queue->estimatedOverdraw = (queue->coveredScreenArea > 0.0f) ? (queue->totalScreenArea / queue->coveredScreenArea) : 0.0f;
+}
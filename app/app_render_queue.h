@@ -0,0 +1,44 @@
+/*
+File:   app_render_queue.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** The RenderQueue is rebuilt every frame from the instances that survived culling. Each item
+	** remembers everything the draw passes need (LOD, meshlet ranges, scissor) so the optional
+	** depth pre-pass and the color pass walk the exact same list in the same front-to-back order.
+	** It also keeps a rough CPU estimate of how much overdraw the frame has.
+*/
+
+#ifndef _APP_RENDER_QUEUE_H
+#define _APP_RENDER_QUEUE_H
+
+#define RENDER_QUEUE_NO_RANGES      UINT32_MAX
+#define RENDER_QUEUE_COVERAGE_WIDTH  64 //cells in the coarse grid used to estimate how much of the screen is covered
+#define RENDER_QUEUE_COVERAGE_HEIGHT 36
+
+typedef struct RenderQueueItem RenderQueueItem;
+struct RenderQueueItem
+{
+	u32 instanceIndex;
+	u32 firstRange; //into RenderQueue->meshletRanges, RENDER_QUEUE_NO_RANGES when the instance is drawn whole
+	u32 numRanges;
+	u32 firstDraw; //into the StagedDrawList filled for this frame, one StagedDraw per model part (or one for boxes)
+	r32 viewDepth; //distance along the camera's look direction to the center of the instance's bounds
+	rec screenRec; //normalized [0,1] screen rectangle covered by the instance's bounds
+	bool scissored;
+};
+
+typedef struct RenderQueue RenderQueue;
+struct RenderQueue
+{
+	Arena* arena;
+	VarArray items; //RenderQueueItem
+	VarArray meshletRanges; //MeshletDrawRange
+	u8* coverage; //RENDER_QUEUE_COVERAGE_WIDTH*HEIGHT, how many items touch each cell (saturates at 255)
+	
+	r32 totalScreenArea; //sum of every item's screen area, as a fraction of the screen
+	r32 coveredScreenArea; //fraction of the screen touched by at least one item
+	r32 estimatedOverdraw; //average number of times each covered pixel gets drawn
+};
+
+#endif //  _APP_RENDER_QUEUE_H
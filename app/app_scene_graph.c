@@ -0,0 +1,236 @@
+/*
+File:   app_scene_graph.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that build and update a SceneGraph (see app_scene_graph.h)
+	** NOTE: Children can only be added to a node whose subtree currently ends at the end
+	** of its root's subtree (i.e. nodes must be added depth-first). This is what keeps every
+	** subtree contiguous so separate roots can be updated independently of each other.
+*/
+
+void FreeSceneGraph(SceneGraph* graph)
+{
+	NotNull(graph);
+	if (graph->arena != nullptr && graph->allocNodes > 0)
+	{
+		FreeMem(graph->arena, graph->parentIndices, sizeof(u32) * graph->allocNodes);
+		FreeMem(graph->arena, graph->subtreeEnds, sizeof(u32) * graph->allocNodes);
+		FreeMem(graph->arena, graph->flags, sizeof(u8) * graph->allocNodes);
+		FreeMem(graph->arena, graph->localMats, sizeof(mat4) * graph->allocNodes);
+		FreeMem(graph->arena, graph->worldMats, sizeof(mat4) * graph->allocNodes);
+		FreeMem(graph->arena, graph->dirtyRoots, sizeof(u32) * graph->allocNodes);
+		FreeMem(graph->arena, graph->changedRoots, sizeof(u32) * graph->allocNodes);
+		FreeMem(graph->arena, graph->freeBlocks, sizeof(u32) * graph->maxRoots);
+	}
+	ClearPointer(graph);
+}
+
+void InitSceneGraph(Arena* arena, uxx maxRoots, uxx nodesPerRoot, SceneGraph* graphOut)
+{
+	NotNull(arena);
+	NotNull(graphOut);
+	Assert(maxRoots > 0 && nodesPerRoot > 0);
+	Assert(maxRoots * nodesPerRoot < SCENE_NODE_INVALID);
+	uxx maxNodes = maxRoots * nodesPerRoot;
+	ClearPointer(graphOut);
+	graphOut->arena = arena;
+	graphOut->allocNodes = maxNodes;
+	graphOut->nodesPerRoot = (u32)nodesPerRoot;
+	graphOut->maxRoots = (u32)maxRoots;
+	graphOut->parentIndices = AllocArray(u32, arena, maxNodes);
+	graphOut->subtreeEnds = AllocArray(u32, arena, maxNodes);
+	graphOut->flags = AllocArray(u8, arena, maxNodes);
+	graphOut->localMats = AllocArray(mat4, arena, maxNodes);
+	graphOut->worldMats = AllocArray(mat4, arena, maxNodes);
+	graphOut->dirtyRoots = AllocArray(u32, arena, maxNodes);
+	graphOut->changedRoots = AllocArray(u32, arena, maxNodes);
+	graphOut->freeBlocks = AllocArray(u32, arena, maxRoots);
+	NotNull(graphOut->parentIndices);
+	NotNull(graphOut->subtreeEnds);
+	NotNull(graphOut->flags);
+	NotNull(graphOut->localMats);
+	NotNull(graphOut->worldMats);
+	NotNull(graphOut->dirtyRoots);
+	NotNull(graphOut->changedRoots);
+	NotNull(graphOut->freeBlocks);
+	MyMemSet(graphOut->flags, SceneNodeFlag_Unused, sizeof(u8) * maxNodes);
+}
+
+u32 GetSceneNodeRoot(const SceneGraph* graph, u32 nodeIndex)
+{
+	Assert(nodeIndex < graph->allocNodes);
+	while (graph->parentIndices[nodeIndex] != SCENE_NODE_INVALID) { nodeIndex = graph->parentIndices[nodeIndex]; }
+	return nodeIndex;
+}
+
+static void MarkSceneNodeRootDirty(SceneGraph* graph, u32 nodeIndex)
+{
+	u32 rootIndex = GetSceneNodeRoot(graph, nodeIndex);
+	if (!IsFlagSet(graph->flags[rootIndex], SceneNodeFlag_SubtreeDirty))
+	{
+		FlagSet(graph->flags[rootIndex], SceneNodeFlag_SubtreeDirty);
+		graph->dirtyRoots[graph->numDirtyRoots++] = rootIndex;
+	}
+}
+
+// Pass SCENE_NODE_INVALID as parentIndex to add a new root, it takes a free block (or the next unused one)
+u32 AddSceneNode(SceneGraph* graph, u32 parentIndex, mat4 localMat)
+{
+	NotNull(graph);
+	u32 newIndex = SCENE_NODE_INVALID;
+	if (parentIndex != SCENE_NODE_INVALID)
+	{
+		Assert(parentIndex < graph->allocNodes && !IsFlagSet(graph->flags[parentIndex], SceneNodeFlag_Unused));
+		u32 rootIndex = GetSceneNodeRoot(graph, parentIndex);
+		newIndex = graph->subtreeEnds[rootIndex];
+		AssertMsg(graph->subtreeEnds[parentIndex] == newIndex, "Scene nodes must be added depth-first to keep subtrees contiguous!");
+		AssertMsg(newIndex < rootIndex + graph->nodesPerRoot, "Subtree doesn't fit in the SceneGraph's nodesPerRoot!");
+		//Grow the subtree range of every ancestor to include the new node
+		for (u32 ancestor = parentIndex; ancestor != SCENE_NODE_INVALID; ancestor = graph->parentIndices[ancestor])
+		{
+			graph->subtreeEnds[ancestor] = newIndex + 1;
+		}
+		graph->flags[newIndex] = SceneNodeFlag_LocalDirty;
+	}
+	else
+	{
+		u32 blockIndex = 0;
+		if (graph->numFreeBlocks > 0) { blockIndex = graph->freeBlocks[--graph->numFreeBlocks]; }
+		else { Assert(graph->numBlocksUsed < graph->maxRoots); blockIndex = graph->numBlocksUsed++; }
+		newIndex = blockIndex * graph->nodesPerRoot;
+		//A root that was removed while dirty is still in dirtyRoots, keeping SubtreeDirty stops MarkSceneNodeRootDirty from listing it twice
+		graph->flags[newIndex] = SceneNodeFlag_LocalDirty | (graph->flags[newIndex] & SceneNodeFlag_SubtreeDirty);
+	}
+	graph->parentIndices[newIndex] = parentIndex;
+	graph->subtreeEnds[newIndex] = newIndex + 1;
+	graph->localMats[newIndex] = localMat;
+	graph->worldMats[newIndex] = localMat;
+	graph->numNodes++;
+	MarkSceneNodeRootDirty(graph, newIndex);
+	return newIndex;
+}
+
+// Removes a root and all of its descendants and puts its block on the free list. No other node moves, so this
+// only touches the removed subtree. If the root is still in dirtyRoots or changedRoots the next update skips it
+void RemoveSceneSubtree(SceneGraph* graph, u32 rootIndex)
+{
+	NotNull(graph);
+	Assert(rootIndex < graph->allocNodes && (rootIndex % graph->nodesPerRoot) == 0);
+	Assert(graph->parentIndices[rootIndex] == SCENE_NODE_INVALID && !IsFlagSet(graph->flags[rootIndex], SceneNodeFlag_Unused));
+	u32 subtreeEnd = graph->subtreeEnds[rootIndex];
+	for (u32 nIndex = rootIndex + 1; nIndex < subtreeEnd; nIndex++) { graph->flags[nIndex] = SceneNodeFlag_Unused; }
+	graph->flags[rootIndex] = SceneNodeFlag_Unused | (graph->flags[rootIndex] & SceneNodeFlag_SubtreeDirty);
+	graph->subtreeEnds[rootIndex] = rootIndex; //empty, so clearing leftover WorldChanged flags on it does nothing
+	graph->numNodes -= subtreeEnd - rootIndex;
+	Assert(graph->numFreeBlocks < graph->maxRoots);
+	graph->freeBlocks[graph->numFreeBlocks++] = rootIndex / graph->nodesPerRoot;
+}
+
+void SetSceneNodeLocalMat(SceneGraph* graph, u32 nodeIndex, mat4 localMat)
+{
+	NotNull(graph);
+	Assert(nodeIndex < graph->allocNodes && !IsFlagSet(graph->flags[nodeIndex], SceneNodeFlag_Unused));
+	graph->localMats[nodeIndex] = localMat;
+	if (!IsFlagSet(graph->flags[nodeIndex], SceneNodeFlag_LocalDirty))
+	{
+		FlagSet(graph->flags[nodeIndex], SceneNodeFlag_LocalDirty);
+		MarkSceneNodeRootDirty(graph, nodeIndex);
+	}
+}
+
+// Updates the world matrices of one root's subtree. Subtrees of different roots touch
+// disjoint index ranges so this can safely be called for separate roots at the same time
+uxx UpdateSceneGraphSubtree(SceneGraph* graph, u32 rootIndex)
+{
+	NotNull(graph);
+	Assert(rootIndex < graph->allocNodes);
+	Assert(graph->parentIndices[rootIndex] == SCENE_NODE_INVALID);
+	uxx numUpdated = 0;
+	u32 subtreeEnd = graph->subtreeEnds[rootIndex];
+	for (u32 nIndex = rootIndex; nIndex < subtreeEnd; nIndex++)
+	{
+		u8 nodeFlags = graph->flags[nIndex];
+		u32 parentIndex = graph->parentIndices[nIndex];
+		bool parentChanged = (parentIndex != SCENE_NODE_INVALID && IsFlagSet(graph->flags[parentIndex], SceneNodeFlag_WorldChanged));
+		if (IsFlagSet(nodeFlags, SceneNodeFlag_LocalDirty) || parentChanged)
+		{
+			graph->worldMats[nIndex] = (parentIndex != SCENE_NODE_INVALID)
+				? Mul(graph->worldMats[parentIndex], graph->localMats[nIndex])
+				: graph->localMats[nIndex];
+			graph->flags[nIndex] = SceneNodeFlag_WorldChanged;
+			numUpdated++;
+		}
+		else { graph->flags[nIndex] = SceneNodeFlag_None; }
+	}
+	return numUpdated;
+}
+
+// Clears SceneNodeFlag_WorldChanged left over from the previous update on subtrees that are not dirty this time
+static void ClearSceneGraphSubtreeChangedFlags(SceneGraph* graph, u32 rootIndex)
+{
+	u32 subtreeEnd = graph->subtreeEnds[rootIndex];
+	for (u32 nIndex = rootIndex; nIndex < subtreeEnd; nIndex++) { FlagUnset(graph->flags[nIndex], SceneNodeFlag_WorldChanged); }
+}
+
+typedef struct SceneGraphUpdateJobs SceneGraphUpdateJobs;
+struct SceneGraphUpdateJobs
+{
+	SceneGraph* graph;
+	uxx numRoots;
+	u32* rootIndices; //the dirty roots followed by last update's changed roots that aren't dirty again
+	uxx numJobs;
+	uxx* numUpdatedPerJob;
+};
+
+static JOB_FUNC_DEF(UpdateSceneGraphJob)
+{
+	SceneGraphUpdateJobs* context = (SceneGraphUpdateJobs*)userPntr;
+	uxx rootStart = (context->numRoots * jobIndex) / context->numJobs;
+	uxx rootEnd = (context->numRoots * (jobIndex+1)) / context->numJobs;
+	uxx numUpdated = 0;
+	for (uxx rIndex = rootStart; rIndex < rootEnd; rIndex++)
+	{
+		u32 rootIndex = context->rootIndices[rIndex];
+		u8 rootFlags = context->graph->flags[rootIndex];
+		if (IsFlagSet(rootFlags, SceneNodeFlag_Unused)) { context->graph->flags[rootIndex] = SceneNodeFlag_Unused; } //removed since it was listed
+		else if (IsFlagSet(rootFlags, SceneNodeFlag_SubtreeDirty)) { numUpdated += UpdateSceneGraphSubtree(context->graph, rootIndex); }
+		else { ClearSceneGraphSubtreeChangedFlags(context->graph, rootIndex); }
+	}
+	context->numUpdatedPerJob[jobIndex] = numUpdated;
+}
+
+// Only the roots that were marked dirty since the last update, plus the roots that were updated last
+// time (their WorldChanged flags need clearing), are visited. They are split into contiguous ranges
+// and handed to the job system (subtrees never overlap so no two jobs touch the same node)
+void UpdateSceneGraph(SceneGraph* graph, JobSystem* jobs)
+{
+	NotNull(graph);
+	graph->numWorldMatsUpdatedLastUpdate = 0;
+	if (graph->numDirtyRoots == 0 && graph->numChangedRoots == 0) { return; }
+	ScratchBegin(scratch);
+	SceneGraphUpdateJobs context = ZEROED;
+	context.graph = graph;
+	context.rootIndices = AllocArray(u32, scratch, graph->numDirtyRoots + graph->numChangedRoots);
+	NotNull(context.rootIndices);
+	MyMemCopy(context.rootIndices, graph->dirtyRoots, sizeof(u32) * graph->numDirtyRoots);
+	context.numRoots = graph->numDirtyRoots;
+	for (uxx rIndex = 0; rIndex < graph->numChangedRoots; rIndex++)
+	{
+		//Roots that are dirty again are already in the list, updating them clears their old flags too
+		u32 rootIndex = graph->changedRoots[rIndex];
+		if (!IsFlagSet(graph->flags[rootIndex], SceneNodeFlag_SubtreeDirty)) { context.rootIndices[context.numRoots++] = rootIndex; }
+	}
+	context.numJobs = GetNumJobsForItems(jobs, context.numRoots, SCENE_GRAPH_ROOTS_PER_JOB);
+	context.numUpdatedPerJob = AllocArray(uxx, scratch, MaxUXX(context.numJobs, 1));
+	NotNull(context.numUpdatedPerJob);
+	RunJobs(jobs, context.numJobs, UpdateSceneGraphJob, &context);
+	for (uxx jIndex = 0; jIndex < context.numJobs; jIndex++) { graph->numWorldMatsUpdatedLastUpdate += context.numUpdatedPerJob[jIndex]; }
+	//Every dirty root had at least one LocalDirty node, so this update's dirty roots are exactly the next update's changed roots
+	u32* oldChangedRoots = graph->changedRoots;
+	graph->changedRoots = graph->dirtyRoots;
+	graph->dirtyRoots = oldChangedRoots;
+	graph->numChangedRoots = graph->numDirtyRoots;
+	graph->numDirtyRoots = 0;
+	ScratchEnd(scratch);
+}
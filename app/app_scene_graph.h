@@ -0,0 +1,55 @@
+/*
+File:   app_scene_graph.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A flattened scene graph where nodes are stored in topological order (parents
+	** always come before their children) and every subtree occupies a contiguous range
+	** of indices. Local and world matrices are cached and world matrices are only
+	** recomputed for nodes whose local matrix (or an ancestor's) changed since the last update.
+	** Every root gets a fixed-size block of nodesPerRoot nodes that its subtree is built in.
+	** Removing a root puts its block on a free list for the next root to reuse, so node
+	** indices never move and adding or removing a root only touches that root's block.
+*/
+
+#ifndef _APP_SCENE_GRAPH_H
+#define _APP_SCENE_GRAPH_H
+
+#define SCENE_NODE_INVALID UINT32_MAX
+#define SCENE_GRAPH_ROOTS_PER_JOB 64 //smallest number of roots worth handing to another thread
+
+typedef enum SceneNodeFlag SceneNodeFlag;
+enum SceneNodeFlag
+{
+	SceneNodeFlag_None         = 0x00,
+	SceneNodeFlag_LocalDirty   = 0x01, //SetSceneNodeLocalMat was called since last update
+	SceneNodeFlag_SubtreeDirty = 0x02, //Only set on roots, something in this subtree needs updating
+	SceneNodeFlag_WorldChanged = 0x04, //World matrix was recomputed in the most recent update
+	SceneNodeFlag_Unused       = 0x08, //Not part of any subtree, either never handed out or its root was removed
+	SceneNodeFlag_All          = 0x0F,
+};
+
+typedef struct SceneGraph SceneGraph;
+struct SceneGraph
+{
+	Arena* arena;
+	uxx numNodes; //nodes currently in use, across all blocks
+	uxx allocNodes;
+	u32 nodesPerRoot;
+	u32 maxRoots;
+	u32 numBlocksUsed; //blocks past this have never been handed out
+	u32 numFreeBlocks;
+	u32* freeBlocks; //block indices, used as a stack
+	u32* parentIndices; //SCENE_NODE_INVALID for roots
+	u32* subtreeEnds; //one past the last descendant, so the subtree of node i is [i, subtreeEnds[i])
+	u8* flags; //SceneNodeFlag
+	mat4* localMats;
+	mat4* worldMats;
+	uxx numDirtyRoots;
+	u32* dirtyRoots; //roots with SceneNodeFlag_SubtreeDirty, in the order they were marked
+	uxx numChangedRoots;
+	u32* changedRoots; //roots whose subtree was updated last time, so they still have SceneNodeFlag_WorldChanged set on some nodes
+	uxx numWorldMatsUpdatedLastUpdate;
+};
+
+#endif //  _APP_SCENE_GRAPH_H
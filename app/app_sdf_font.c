@@ -0,0 +1,316 @@
+/*
+File:   app_sdf_font.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that generate, pack and draw an SdfFont (see app_sdf_font.h)
+*/
+
+void FreeSdfFont(SdfFont* font)
+{
+	NotNull(font);
+	if (font->arena != nullptr)
+	{
+		if (font->atlasTexture.error == Result_Success) { FreeTexture(&font->atlasTexture); }
+		FreeVarArray(&font->glyphs);
+		if (font->ttfFile.chars != nullptr) { FreeStr8(font->arena, &font->ttfFile); }
+		if (font->name.chars != nullptr) { FreeStr8(font->arena, &font->name); }
+	}
+	ClearPointer(font);
+}
+
+// Returns the glyph's distance field (allocated by stb_truetype, free it with stbtt_FreeSDF) or nullptr for glyphs with
+// nothing to draw. Only reads the font so any number of glyphs can be rasterized at once
+u8* RasterizeSdfGlyph(const SdfFont* font, i32 ttfGlyphIndex, v2i* sizeOut, v2* drawOffsetOut)
+{
+	NotNull(font);
+	NotNull(sizeOut);
+	NotNull(drawOffsetOut);
+	i32 width = 0, height = 0, offsetX = 0, offsetY = 0;
+	r32 pixelDistScale = (r32)SDF_FONT_EDGE_VALUE / (r32)SDF_FONT_PADDING;
+	u8* result = stbtt_GetGlyphSDF(&font->ttfInfo, font->bakeScale, ttfGlyphIndex, SDF_FONT_PADDING, SDF_FONT_EDGE_VALUE, pixelDistScale, &width, &height, &offsetX, &offsetY);
+	if (result == nullptr) { width = 0; height = 0; }
+	*sizeOut = NewV2i(width, height);
+	*drawOffsetOut = NewV2((r32)offsetX, (r32)offsetY);
+	return result;
+}
+
+r32 GetSdfGlyphAdvance(const SdfFont* font, i32 ttfGlyphIndex)
+{
+	NotNull(font);
+	i32 advanceWidth = 0, leftSideBearing = 0;
+	stbtt_GetGlyphHMetrics(&font->ttfInfo, ttfGlyphIndex, &advanceWidth, &leftSideBearing);
+	return (r32)advanceWidth * font->bakeScale;
+}
+
+// In bake pixels, 0 when the font has no kerning for the pair
+r32 GetSdfGlyphKerning(const SdfFont* font, i32 leftTtfGlyphIndex, i32 rightTtfGlyphIndex)
+{
+	NotNull(font);
+	return (r32)stbtt_GetGlyphKernAdvance(&font->ttfInfo, leftTtfGlyphIndex, rightTtfGlyphIndex) * font->bakeScale;
+}
+
+static void GenerateSdfGlyph(const SdfFont* font, SdfGlyph* glyph)
+{
+	glyph->advanceX = GetSdfGlyphAdvance(font, glyph->ttfGlyphIndex);
+	v2i glyphSize = ZEROED;
+	glyph->distances = RasterizeSdfGlyph(font, glyph->ttfGlyphIndex, &glyphSize, &glyph->drawOffset);
+	glyph->atlasRec = NewReci(0, 0, glyphSize.Width, glyphSize.Height);
+}
+
+typedef struct SdfGlyphJobs SdfGlyphJobs;
+struct SdfGlyphJobs
+{
+	const SdfFont* font;
+	SdfGlyph* glyphs;
+};
+
+// Only reads the font and only writes its own glyph (stbtt_GetGlyphSDF allocates with malloc, not from an arena)
+static JOB_FUNC_DEF(GenerateSdfGlyphJob)
+{
+	SdfGlyphJobs* context = (SdfGlyphJobs*)userPntr;
+	GenerateSdfGlyph(context->font, &context->glyphs[jobIndex]);
+}
+
+static int CompareSdfGlyphPackKeys(const void* left, const void* right)
+{
+	u64 leftKey = *(const u64*)left;
+	u64 rightKey = *(const u64*)right;
+	return (leftKey < rightKey) ? -1 : ((leftKey > rightKey) ? 1 : 0);
+}
+
+// Shelf packs the glyphs tallest first, fills in each atlasRec's position and returns the (power of two) atlas size.
+// The width comes from the total glyph area so the atlas ends up roughly square
+static v2i PackSdfGlyphs(Arena* scratch, VarArray* glyphs)
+{
+	uxx numGlyphs = glyphs->length;
+	u64* packKeys = AllocArray(u64, scratch, numGlyphs);
+	NotNull(packKeys);
+	uxx totalArea = 0;
+	i32 maxGlyphWidth = 0;
+	VarArrayLoop(glyphs, gIndex)
+	{
+		VarArrayLoopGet(SdfGlyph, glyph, glyphs, gIndex);
+		i32 paddedHeight = glyph->atlasRec.Height + SDF_FONT_ATLAS_SPACING;
+		totalArea += (uxx)(glyph->atlasRec.Width + SDF_FONT_ATLAS_SPACING) * (uxx)paddedHeight;
+		maxGlyphWidth = MaxI32(maxGlyphWidth, glyph->atlasRec.Width + SDF_FONT_ATLAS_SPACING);
+		packKeys[gIndex] = ((u64)(0xFFFF - (u32)MinI32(paddedHeight, 0xFFFF)) << 32) | (u64)gIndex;
+	}
+	qsort(packKeys, numGlyphs, sizeof(u64), CompareSdfGlyphPackKeys);
+	
+	i32 atlasWidth = 64;
+	while (atlasWidth < SDF_FONT_MAX_ATLAS_SIZE && ((r32)atlasWidth < SqrtR32((r32)totalArea * 1.15f) || atlasWidth < maxGlyphWidth)) { atlasWidth *= 2; }
+	i32 shelfX = 0, shelfY = 0, shelfHeight = 0;
+	for (uxx kIndex = 0; kIndex < numGlyphs; kIndex++)
+	{
+		SdfGlyph* glyph = VarArrayGetHard(SdfGlyph, glyphs, (uxx)(packKeys[kIndex] & 0xFFFFFFFF));
+		if (glyph->atlasRec.Width == 0 || glyph->atlasRec.Height == 0) { continue; }
+		if (shelfX + glyph->atlasRec.Width > atlasWidth)
+		{
+			shelfY += shelfHeight + SDF_FONT_ATLAS_SPACING;
+			shelfX = 0;
+			shelfHeight = 0;
+		}
+		glyph->atlasRec.X = shelfX;
+		glyph->atlasRec.Y = shelfY;
+		shelfX += glyph->atlasRec.Width + SDF_FONT_ATLAS_SPACING;
+		shelfHeight = MaxI32(shelfHeight, glyph->atlasRec.Height);
+	}
+	i32 atlasHeight = 64;
+	while (atlasHeight < shelfY + shelfHeight) { atlasHeight *= 2; }
+	return NewV2i(atlasWidth, atlasHeight);
+}
+
+// nullptr when the codepoint wasn't baked
+SdfGlyph* GetSdfGlyph(SdfFont* font, u32 codepoint)
+{
+	NotNull(font);
+	uxx low = 0, high = font->glyphs.length;
+	while (low < high)
+	{
+		uxx middle = low + (high - low) / 2;
+		SdfGlyph* glyph = VarArrayGetHard(SdfGlyph, &font->glyphs, middle);
+		if (glyph->codepoint == codepoint) { return glyph; }
+		if (glyph->codepoint < codepoint) { low = middle + 1; }
+		else { high = middle; }
+	}
+	return nullptr;
+}
+
+// Finds the font through the OS (like AttachOsTtfFileToFont does for a regular Font), generates a distance field for
+// every codepoint in charRanges and uploads them as one atlas. With no charRanges nothing is baked up front and the
+// font is only used for its metrics and by a GlyphCache (see app_glyph_cache.h). The distance fields are generated
+// with one job per glyph, packing and the upload wait for all of them on this thread
+Result InitSdfFont(JobSystem* jobs, Arena* arena, Str8 fontName, u8 styleFlags, r32 bakeSize, uxx numCharRanges, const FontCharRange* charRanges, SdfFont* fontOut)
+{
+	NotNull(arena);
+	Assert(charRanges != nullptr || numCharRanges == 0);
+	NotNull(fontOut);
+	ClearPointer(fontOut);
+	ScratchBegin1(scratch, arena);
+	
+	Font osFont = InitFont(scratch, fontName);
+	Result attachResult = AttachOsTtfFileToFont(&osFont, fontName, bakeSize, styleFlags);
+	if (attachResult != Result_Success) { FreeFont(&osFont); ScratchEnd(scratch); return attachResult; }
+	fontOut->arena = arena;
+	fontOut->name = AllocStr8(arena, fontName);
+	fontOut->styleFlags = styleFlags;
+	fontOut->ttfFile = AllocStr8(arena, osFont.ttfFile);
+	RemoveAttachedTtfFile(&osFont);
+	FreeFont(&osFont);
+	if (!stbtt_InitFont(&fontOut->ttfInfo, (const u8*)fontOut->ttfFile.chars, stbtt_GetFontOffsetForIndex((const u8*)fontOut->ttfFile.chars, 0)))
+	{
+		FreeSdfFont(fontOut);
+		ScratchEnd(scratch);
+		return Result_Failure;
+	}
+	
+	i32 ascent = 0, descent = 0, lineGap = 0;
+	stbtt_GetFontVMetrics(&fontOut->ttfInfo, &ascent, &descent, &lineGap);
+	fontOut->bakeSize = bakeSize;
+	fontOut->bakeScale = stbtt_ScaleForPixelHeight(&fontOut->ttfInfo, bakeSize);
+	fontOut->ascent = (r32)ascent * fontOut->bakeScale;
+	fontOut->descent = (r32)descent * fontOut->bakeScale;
+	fontOut->lineHeight = (r32)(ascent - descent + lineGap) * fontOut->bakeScale;
+	
+	PerfTime generateStartTime = GetPerfTime();
+	InitVarArray(SdfGlyph, &fontOut->glyphs, arena);
+	for (uxx rIndex = 0; rIndex < numCharRanges; rIndex++)
+	{
+		for (u32 codepoint = charRanges[rIndex].startCodepoint; codepoint <= charRanges[rIndex].endCodepoint; codepoint++)
+		{
+			if (GetSdfGlyph(fontOut, codepoint) != nullptr) { continue; }
+			i32 ttfGlyphIndex = stbtt_FindGlyphIndex(&fontOut->ttfInfo, (int)codepoint);
+			if (ttfGlyphIndex == 0) { continue; } //not in the font, drawing falls back to fallbackGlyphIndex
+			SdfGlyph* newGlyph = VarArrayAdd(SdfGlyph, &fontOut->glyphs);
+			NotNull(newGlyph);
+			ClearPointer(newGlyph);
+			newGlyph->codepoint = codepoint;
+			newGlyph->ttfGlyphIndex = ttfGlyphIndex;
+			//Keep the array sorted by codepoint (char ranges are usually already in order so this rarely moves anything)
+			for (uxx gIndex = fontOut->glyphs.length-1; gIndex > 0; gIndex--)
+			{
+				SdfGlyph* prevGlyph = VarArrayGetHard(SdfGlyph, &fontOut->glyphs, gIndex-1);
+				SdfGlyph* glyph = VarArrayGetHard(SdfGlyph, &fontOut->glyphs, gIndex);
+				if (prevGlyph->codepoint < glyph->codepoint) { break; }
+				SdfGlyph temp = *prevGlyph; *prevGlyph = *glyph; *glyph = temp;
+			}
+		}
+	}
+	SdfGlyphJobs generateContext = ZEROED;
+	generateContext.font = fontOut;
+	generateContext.glyphs = (SdfGlyph*)fontOut->glyphs.items;
+	RunJobs(jobs, fontOut->glyphs.length, GenerateSdfGlyphJob, &generateContext);
+	PerfTime generateEndTime = GetPerfTime();
+	fontOut->generateMs = GetPerfTimeDiff(&generateStartTime, &generateEndTime);
+	
+	fontOut->atlasSize = PackSdfGlyphs(scratch, &fontOut->glyphs);
+	uxx numPixels = (uxx)fontOut->atlasSize.Width * (uxx)fontOut->atlasSize.Height;
+	u32* atlasPixels = AllocArray(u32, scratch, numPixels);
+	NotNull(atlasPixels);
+	for (uxx pIndex = 0; pIndex < numPixels; pIndex++) { atlasPixels[pIndex] = 0x00FFFFFF; }
+	VarArrayLoop(&fontOut->glyphs, gIndex)
+	{
+		VarArrayLoopGet(SdfGlyph, glyph, &fontOut->glyphs, gIndex);
+		if (glyph->codepoint == '?') { fontOut->fallbackGlyphIndex = gIndex; }
+		if (glyph->distances == nullptr) { continue; }
+		for (i32 yOffset = 0; yOffset < glyph->atlasRec.Height; yOffset++)
+		{
+			u32* atlasRow = &atlasPixels[(uxx)(glyph->atlasRec.Y + yOffset) * (uxx)fontOut->atlasSize.Width + (uxx)glyph->atlasRec.X];
+			const u8* distanceRow = &glyph->distances[(uxx)yOffset * (uxx)glyph->atlasRec.Width];
+			for (i32 xOffset = 0; xOffset < glyph->atlasRec.Width; xOffset++) { atlasRow[xOffset] = 0x00FFFFFF | ((u32)distanceRow[xOffset] << 24); }
+		}
+		stbtt_FreeSDF(glyph->distances, nullptr);
+		glyph->distances = nullptr;
+	}
+	fontOut->atlasTexture = InitTexture(arena, fontOut->name, fontOut->atlasSize, atlasPixels, 0x00);
+	PerfTime packEndTime = GetPerfTime();
+	fontOut->packMs = GetPerfTimeDiff(&generateEndTime, &packEndTime);
+	ScratchEnd(scratch);
+	
+	PrintLine_D("SDF font \"%.*s\": %llu glyph%s in a %dx%d atlas (generate %.2lfms, pack %.2lfms)",
+		StrPrint(fontName), (u64)fontOut->glyphs.length, Plural(fontOut->glyphs.length, "s"),
+		fontOut->atlasSize.Width, fontOut->atlasSize.Height, fontOut->generateMs, fontOut->packMs
+	);
+	return fontOut->atlasTexture.error;
+}
+
+SdfGlyph* GetSdfGlyphOrFallback(SdfFont* font, u32 codepoint)
+{
+	NotNull(font);
+	SdfGlyph* result = GetSdfGlyph(font, codepoint);
+	if (result == nullptr && font->glyphs.length > 0) { result = VarArrayGetHard(SdfGlyph, &font->glyphs, font->fallbackGlyphIndex); }
+	return result;
+}
+
+// penPos is on the baseline, sizeScale is the font size being drawn over the font's bakeSize
+void DrawSdfGlyph(SdfFont* font, const SdfGlyph* glyph, v2 penPos, r32 sizeScale, Color32 color)
+{
+	if (glyph->atlasRec.Width == 0 || glyph->atlasRec.Height == 0) { return; }
+	rec drawRec = NewRec(
+		penPos.X + glyph->drawOffset.X * sizeScale,
+		penPos.Y + glyph->drawOffset.Y * sizeScale,
+		(r32)glyph->atlasRec.Width * sizeScale,
+		(r32)glyph->atlasRec.Height * sizeScale
+	);
+	DrawTexturedRectangleEx(drawRec, color, &font->atlasTexture, NewRec((r32)glyph->atlasRec.X, (r32)glyph->atlasRec.Y, (r32)glyph->atlasRec.Width, (r32)glyph->atlasRec.Height));
+}
+
+// Walks the text the same way for measuring and drawing. Returns the size of the text's logical rectangle at fontSize,
+// drawing each glyph (when draw is true) with the pen starting at position on the first line's baseline
+static v2 FlowSdfText(SdfFont* font, Str8 text, v2 position, r32 fontSize, Color32 color, bool draw)
+{
+	r32 sizeScale = fontSize / font->bakeSize;
+	v2 penPos = position;
+	r32 maxLineWidth = 0.0f;
+	uxx numLines = 1;
+	SdfGlyph* prevGlyph = nullptr;
+	for (uxx cIndex = 0; cIndex < text.length; )
+	{
+		u32 codepoint = 0;
+		u8 codepointSize = GetCodepointForUtf8Str(text, cIndex, &codepoint);
+		if (codepointSize == 0) { codepoint = (u32)(u8)text.chars[cIndex]; codepointSize = 1; }
+		cIndex += codepointSize;
+		if (codepoint == '\r') { continue; }
+		if (codepoint == '\n')
+		{
+			maxLineWidth = MaxR32(maxLineWidth, penPos.X - position.X);
+			penPos = NewV2(position.X, penPos.Y + font->lineHeight * sizeScale);
+			numLines++;
+			prevGlyph = nullptr;
+			continue;
+		}
+		SdfGlyph* glyph = GetSdfGlyphOrFallback(font, codepoint);
+		if (glyph == nullptr) { continue; }
+		if (prevGlyph != nullptr)
+		{
+			penPos.X += GetSdfGlyphKerning(font, prevGlyph->ttfGlyphIndex, glyph->ttfGlyphIndex) * sizeScale;
+		}
+		if (draw) { DrawSdfGlyph(font, glyph, penPos, sizeScale, color); }
+		penPos.X += glyph->advanceX * sizeScale;
+		prevGlyph = glyph;
+	}
+	maxLineWidth = MaxR32(maxLineWidth, penPos.X - position.X);
+	return NewV2(maxLineWidth, font->lineHeight * sizeScale * (r32)numLines);
+}
+
+v2 MeasureSdfText(SdfFont* font, Str8 text, r32 fontSize)
+{
+	NotNull(font);
+	return FlowSdfText(font, text, V2_Zero, fontSize, White, false);
+}
+
+// The main2dSdf shader needs to be bound (with BindSdfTextShader) before calling this.
+// position is the pen position on the first line's baseline
+void DrawSdfText(SdfFont* font, Str8 text, v2 position, r32 fontSize, Color32 color)
+{
+	NotNull(font);
+	FlowSdfText(font, text, position, fontSize, color, true);
+}
+
+void BindSdfTextShader(Shader* sdfShader)
+{
+	NotNull(sdfShader);
+	BindShader(sdfShader);
+	SetShaderUniformByNameV4(sdfShader, StrLit("sdfParams"), NewV4((r32)SDF_FONT_EDGE_VALUE / 255.0f, SDF_FONT_SOFTNESS, 0.0f, 0.0f));
+}
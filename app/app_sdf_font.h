@@ -0,0 +1,70 @@
+/*
+File:   app_sdf_font.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A font mode that bakes every glyph once, as a single channel signed distance field, and draws it at any
+	** size with the main2dSdf shader (see main2d_shader.glsl). Changing the text size (Ctrl+Plus/Minus, DPI or
+	** UI scale) only changes the quads, the atlas is never rebaked, and one atlas at SDF_FONT_BAKE_SIZE replaces
+	** the atlas per size that a regular Font needs.
+	** Glyphs are rasterized from the font's TTF file with stb_truetype's stbtt_GetGlyphSDF (one job per glyph) and shelf packed into
+	** one atlas. The distance lives in the alpha channel (RGB is white) so the atlas still shows up when drawn with
+	** the regular main2d shader.
+	** NOTE: This is a single channel SDF rather than MSDF. MSDF keeps sharp corners at very large sizes but needs
+	** the glyph outlines split into edge segments (msdfgen), which we don't have. At the sizes our UI draws
+	** text a single channel SDF baked at SDF_FONT_BAKE_SIZE is indistinguishable.
+*/
+
+#ifndef _APP_SDF_FONT_H
+#define _APP_SDF_FONT_H
+
+//PigCore compiles stb_truetype for its Font. In BUILD_INTO_SINGLE_UNIT builds that happens in this translation unit
+//and when PigCore's headers already declared the stbtt_ functions they come from pig_core's exports, either way we
+//use PigCore's copy. Only when pig_core is a separate library that didn't declare them do we compile a private
+//(static) copy right here, so there's never a second non-static definition of any stbtt_ function
+#if !BUILD_INTO_SINGLE_UNIT && !defined(__STB_INCLUDE_STB_TRUETYPE_H__)
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#endif
+#include "third_party/stb/stb_truetype.h"
+
+#define SDF_FONT_BAKE_SIZE      48.0f //pixel height the distance fields are generated at
+#define SDF_FONT_PADDING        6 //pixels of distance field around each glyph, also the max distance that's stored
+#define SDF_FONT_EDGE_VALUE     128 //the stored value that sits exactly on the glyph's outline
+#define SDF_FONT_SOFTNESS       0.7f //scales the shader's fwidth antialiasing band, sdfParams.y
+#define SDF_FONT_ATLAS_SPACING  1 //empty pixels between glyphs in the atlas
+#define SDF_FONT_MAX_ATLAS_SIZE 4096
+
+typedef struct SdfGlyph SdfGlyph;
+struct SdfGlyph
+{
+	u32 codepoint;
+	i32 ttfGlyphIndex;
+	reci atlasRec; //0 size for glyphs with nothing to draw (space)
+	v2 drawOffset; //from the pen position on the baseline to the top-left of atlasRec, in bake pixels
+	r32 advanceX; //in bake pixels
+	u8* distances; //only between generating and packing, freed by stbtt_FreeSDF
+};
+
+typedef struct SdfFont SdfFont;
+struct SdfFont
+{
+	Arena* arena;
+	Str8 name;
+	u8 styleFlags;
+	Str8 ttfFile; //our own copy, stbtt_fontinfo points into it
+	stbtt_fontinfo ttfInfo;
+	r32 bakeSize;
+	r32 bakeScale; //font units to bake pixels
+	r32 ascent; //in bake pixels, like every metric below
+	r32 descent;
+	r32 lineHeight;
+	VarArray glyphs; //SdfGlyph, sorted by codepoint
+	uxx fallbackGlyphIndex; //'?' (or the first glyph) for codepoints that weren't baked
+	v2i atlasSize;
+	Texture atlasTexture;
+	r64 generateMs; //stbtt_GetGlyphSDF for every glyph
+	r64 packMs; //packing, copying into the atlas and the upload
+};
+
+#endif //  _APP_SDF_FONT_H
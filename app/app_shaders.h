@@ -10,4 +10,14 @@ Description:
 #if FP3D_SCENE_ENABLED
 #include "main3d_shader.glsl.h"
 #include "pbr_shader.glsl.h"
+
+// BindModelMaterial and the pbr pass bind textures at the PBR_TEXTURE_SLOT_* indices (see app_brdf.h),
+// catch a regenerated pbr_shader.glsl.h that moved any of the image bindings (the DFG LUT lives at 4)
+#if (PBR_TEXTURE_SLOT_ALBEDO != IMG_pbrAlbedoTexture) || (PBR_TEXTURE_SLOT_NORMAL != IMG_pbrNormalTexture) || (PBR_TEXTURE_SLOT_METALLIC_ROUGHNESS != IMG_pbrMetallicRoughnessTexture) || (PBR_TEXTURE_SLOT_OCCLUSION != IMG_pbrOcclusionTexture) || (PBR_TEXTURE_SLOT_DFG_LUT != IMG_pbrDfgTexture)
+#error "PBR_TEXTURE_SLOT_* in app_brdf.h don't match the image bindings in pbr_shader.glsl.h"
+#endif
+// InitPbrVertBuffer lists its attributes in VertexPbr order (see app_tangents.h), the shader inputs have to come in the same order
+#if (ATTR_pbr_position != 0) || (ATTR_pbr_normal != 1) || (ATTR_pbr_tangent != 2) || (ATTR_pbr_texCoord0 != 3) || (ATTR_pbr_color0 != 4) || (ATTR_pbrDepth_position != ATTR_pbr_position)
+#error "The vertex inputs in pbr_shader.glsl.h don't match the VertexPbr layout"
+#endif
 #endif //FP3D_SCENE_ENABLED
@@ -0,0 +1,111 @@
+/*
+File:   app_staged_draws.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that fill and reset the StagedDrawList (see app_staged_draws.h)
+*/
+
+void FreeStagedDrawList(StagedDrawList* list)
+{
+	NotNull(list);
+	if (list->arena != nullptr && list->slots != nullptr) { FreeMem(list->arena, list->slots, sizeof(StagedDraw) * list->capacity); }
+	ClearPointer(list);
+}
+
+void InitStagedDrawList(Arena* arena, uxx expectedDrawsPerFrame, StagedDrawList* listOut)
+{
+	NotNull(arena);
+	NotNull(listOut);
+	ClearPointer(listOut);
+	listOut->arena = arena;
+	listOut->capacity = MaxUXX(expectedDrawsPerFrame, STAGED_DRAW_LIST_MIN_CAPACITY);
+	listOut->slots = AllocArray(StagedDraw, arena, listOut->capacity);
+	NotNull(listOut->slots);
+	listOut->boundMaterialIndex = STAGED_DRAW_NO_MATERIAL;
+}
+
+// Makes room for this frame's draws (last frame's are overwritten), growing the array when needed
+StagedDraw* BeginStagedDrawFrame(StagedDrawList* list, uxx numDraws)
+{
+	NotNull(list);
+	NotNull(list->arena);
+	if (numDraws > list->capacity)
+	{
+		FreeMem(list->arena, list->slots, sizeof(StagedDraw) * list->capacity);
+		list->capacity = numDraws;
+		list->slots = AllocArray(StagedDraw, list->arena, list->capacity);
+		NotNull(list->slots);
+	}
+	list->frameCount = numDraws;
+	list->numApplies = 0;
+	list->numMaterialBindsSkipped = 0;
+	return list->slots;
+}
+
+const StagedDraw* GetFrameStagedDraws(const StagedDrawList* list, u32 firstDraw)
+{
+	NotNull(list);
+	Assert(firstDraw < list->frameCount);
+	return &list->slots[firstDraw];
+}
+
+static inline uxx GetInstanceNumDraws(InstanceStore* store, uxx instanceIndex)
+{
+	if (IsFlagSet(store->flags[instanceIndex], InstanceFlag_DrawAsBox)) { return 1; }
+	Model3D* model = GetInstanceModel(store, store->modelIds[instanceIndex]);
+	NotNull(model);
+	return model->data.parts.length;
+}
+
+// Gathers every draw's world matrix and material from the SceneGraph and InstanceStore in queue order and
+// assigns each item its firstDraw. Call after FinishRenderQueue since the sort would scramble the blocks otherwise
+void FillStagedDrawList(StagedDrawList* list, RenderQueue* queue, InstanceStore* store)
+{
+	NotNull(list);
+	NotNull(queue);
+	NotNull(store);
+	uxx numDraws = 0;
+	VarArrayLoop(&queue->items, qIndex)
+	{
+		VarArrayLoopGet(RenderQueueItem, item, &queue->items, qIndex);
+		numDraws += GetInstanceNumDraws(store, item->instanceIndex);
+	}
+	
+	StagedDraw* frameDraws = BeginStagedDrawFrame(list, numDraws);
+	uxx drawIndex = 0;
+	VarArrayLoop(&queue->items, qIndex)
+	{
+		VarArrayLoopGet(RenderQueueItem, item, &queue->items, qIndex);
+		uxx iIndex = item->instanceIndex;
+		u32 sceneRoot = store->sceneRoots[iIndex];
+		item->firstDraw = (u32)drawIndex;
+		if (IsFlagSet(store->flags[iIndex], InstanceFlag_DrawAsBox))
+		{
+			StagedDraw* draw = &frameDraws[drawIndex++];
+			draw->world = store->sceneGraph->worldMats[sceneRoot];
+			draw->materialIndex = STAGED_DRAW_NO_MATERIAL;
+			draw->tint = store->tints[iIndex];
+			continue;
+		}
+		Model3D* model = GetInstanceModel(store, store->modelIds[iIndex]);
+		u32 materialOverride = store->materialOverrides[iIndex];
+		VarArrayLoop(&model->data.parts, pIndex)
+		{
+			VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+			StagedDraw* draw = &frameDraws[drawIndex++];
+			draw->world = store->sceneGraph->worldMats[sceneRoot + 1 + pIndex];
+			draw->materialIndex = (materialOverride != INSTANCE_NO_MATERIAL_OVERRIDE) ? materialOverride : (u32)part->materialIndex;
+			draw->tint = MonokaiPurple; //only used if the part has no material, same as BindModelMaterial
+		}
+	}
+	Assert(drawIndex == numDraws);
+}
+
+// Forgets what was bound so the next ApplyStagedDraw binds everything again. Call whenever something else touched the bindings
+void ResetStagedDrawState(StagedDrawList* list)
+{
+	NotNull(list);
+	list->boundModel = nullptr;
+	list->boundMaterialIndex = STAGED_DRAW_NO_MATERIAL;
+}
@@ -0,0 +1,45 @@
+/*
+File:   app_staged_draws.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** The StagedDrawList is CPU-side batching of the per-draw state (world matrix, material, tint) of
+	** every draw the RenderQueue makes in a frame. It's filled in one pass right after the queue is
+	** sorted so both draw passes walk the same contiguous array instead of gathering the values from
+	** the SceneGraph and InstanceStore again. Nothing is uploaded in bulk, each draw still applies its
+	** own uniform block (see ApplyStagedDraw), the list only lets consecutive draws skip re-binding
+	** the same material.
+*/
+
+#ifndef _APP_STAGED_DRAWS_H
+#define _APP_STAGED_DRAWS_H
+
+#define STAGED_DRAW_LIST_MIN_CAPACITY  256
+#define STAGED_DRAW_NO_MATERIAL        UINT32_MAX
+#define STAGED_DRAW_NONE               UINT32_MAX
+
+typedef struct StagedDraw StagedDraw;
+struct StagedDraw
+{
+	mat4 world;
+	u32 materialIndex; //into the instance model's materials, STAGED_DRAW_NO_MATERIAL for untextured draws that use tint
+	Color32 tint;
+};
+
+typedef struct StagedDrawList StagedDrawList;
+struct StagedDrawList
+{
+	Arena* arena;
+	uxx capacity;
+	StagedDraw* slots;
+	uxx frameCount; //draws filled in for the current frame
+	
+	//Redundant state filtering, reset at the start of every pass
+	const struct Model3D* boundModel;
+	u32 boundMaterialIndex;
+	
+	uxx numApplies;
+	uxx numMaterialBindsSkipped;
+};
+
+#endif //  _APP_STAGED_DRAWS_H
@@ -0,0 +1,424 @@
+/*
+File:   app_tangents.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds GenerateMeshTangents, the per-model tangent cache and the VertexPbr buffer helpers (see app_tangents.h)
+*/
+
+// +--------------------------------------------------------------+
+// |                          Generation                          |
+// +--------------------------------------------------------------+
+static inline v3 ProjectTangentOntoPlane(v3 vector, v3 normal) { return Sub(vector, Mul(normal, Dot(normal, vector))); }
+
+// Any unit vector perpendicular to the normal, for vertices that no triangle with usable texCoords touches
+static inline v3 GetFallbackTangent(v3 normal)
+{
+	v3 axis = (AbsR32(normal.X) < 0.9f) ? NewV3(1, 0, 0) : NewV3(0, 1, 0);
+	return Normalize(ProjectTangentOntoPlane(axis, normal));
+}
+
+static inline u32 HashTangentWeldVertex(const Vertex3D* vertex)
+{
+	u32 words[8];
+	MyMemCopy(&words[0], &vertex->position, sizeof(v3));
+	MyMemCopy(&words[3], &vertex->normal, sizeof(v3));
+	MyMemCopy(&words[6], &vertex->texCoord, sizeof(v2));
+	u32 hash = 2166136261u;
+	for (uxx wIndex = 0; wIndex < ArrayCount(words); wIndex++) { hash = (hash ^ words[wIndex]) * 16777619u; }
+	return hash;
+}
+
+static inline bool AreTangentWeldVerticesEqual(const Vertex3D* left, const Vertex3D* right)
+{
+	return (MyMemCompare(&left->position, &right->position, sizeof(v3)) == 0 &&
+		MyMemCompare(&left->normal, &right->normal, sizeof(v3)) == 0 &&
+		MyMemCompare(&left->texCoord, &right->texCoord, sizeof(v2)) == 0);
+}
+
+// Follows MikkTSpace: every triangle's tangent is the direction of increasing U (from its position and texCoord
+// deltas), it's projected onto the plane of each corner's normal and added to that corner's vertex weighted by the
+// corner's angle. Vertices with identical position, normal and texCoord are welded first and triangles with
+// mirrored UVs (negative UV area) accumulate apart from the rest, the sign of the UV area is the bitangent sign.
+// Like MikkTSpace, a vertex that is used by both mirrored and non-mirrored triangles is split: it keeps the
+// non-mirrored tangent and a copy of it (vertex numVertices + s, a copy of splitSourcesOut[s]) gets the mirrored one,
+// the mirrored triangles' indices are changed to point at the copy. tangentsOut needs room for numVertices * 2,
+// splitSourcesOut for numVertices and splitCornersOut (the corners whose index was changed, optional) for numIndices.
+// Returns the number of split vertices. Without indices nothing can split, so numVertices tangents are enough and
+// splitSourcesOut can be nullptr
+uxx GenerateMeshTangents(Arena* scratchArena, const Vertex3D* vertices, uxx numVertices, i32* indices, uxx numIndices, v4* tangentsOut, u32* splitSourcesOut, u32* splitCornersOut, uxx* numSplitCornersOut)
+{
+	NotNull(scratchArena);
+	NotNull(tangentsOut);
+	if (numSplitCornersOut != nullptr) { *numSplitCornersOut = 0; }
+	if (numVertices == 0) { return 0; }
+	NotNull(vertices);
+	ScratchBegin1(scratch, scratchArena);
+	uxx numCorners = (indices != nullptr) ? numIndices : numVertices;
+	numCorners -= (numCorners % 3);
+	
+	//Weld, weldIds[v] is the first vertex with the same attributes as v
+	uxx tableSize = 1;
+	while (tableSize < numVertices * 2) { tableSize <<= 1; }
+	u32* weldTable = AllocArray(u32, scratch, tableSize);
+	u32* weldIds = AllocArray(u32, scratch, numVertices);
+	NotNull(weldTable);
+	NotNull(weldIds);
+	for (uxx tIndex = 0; tIndex < tableSize; tIndex++) { weldTable[tIndex] = UINT32_MAX; }
+	for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+	{
+		uxx slot = HashTangentWeldVertex(&vertices[vIndex]) & (tableSize-1);
+		while (weldTable[slot] != UINT32_MAX && !AreTangentWeldVerticesEqual(&vertices[weldTable[slot]], &vertices[vIndex])) { slot = (slot + 1) & (tableSize-1); }
+		if (weldTable[slot] == UINT32_MAX) { weldTable[slot] = (u32)vIndex; }
+		weldIds[vIndex] = weldTable[slot];
+	}
+	
+	//[0] is for triangles that keep their UV orientation, [1] for mirrored ones
+	v3* tangentSums = AllocArray(v3, scratch, numVertices * 2);
+	r32* tangentWeights = AllocArray(r32, scratch, numVertices * 2);
+	u8* vertexOrientations = AllocArray(u8, scratch, numVertices); //bit 0/1 set when a triangle of that orientation uses the vertex
+	u8* triangleOrientations = AllocArray(u8, scratch, numCorners / 3 + 1);
+	NotNull(tangentSums);
+	NotNull(tangentWeights);
+	NotNull(vertexOrientations);
+	NotNull(triangleOrientations);
+	for (uxx vIndex = 0; vIndex < numVertices * 2; vIndex++) { tangentSums[vIndex] = V3_Zero; tangentWeights[vIndex] = 0.0f; }
+	MyMemSet(vertexOrientations, 0x00, numVertices);
+	
+	for (uxx cIndex = 0; cIndex < numCorners; cIndex += 3)
+	{
+		triangleOrientations[cIndex / 3] = 0;
+		u32 triVertices[3];
+		for (uxx corner = 0; corner < 3; corner++)
+		{
+			triVertices[corner] = (indices != nullptr) ? (u32)indices[cIndex + corner] : (u32)(cIndex + corner);
+			Assert(triVertices[corner] < numVertices);
+		}
+		const Vertex3D* vertex0 = &vertices[triVertices[0]];
+		v3 edge1 = Sub(vertices[triVertices[1]].position, vertex0->position);
+		v3 edge2 = Sub(vertices[triVertices[2]].position, vertex0->position);
+		v2 uvEdge1 = Sub(vertices[triVertices[1]].texCoord, vertex0->texCoord);
+		v2 uvEdge2 = Sub(vertices[triVertices[2]].texCoord, vertex0->texCoord);
+		r32 signedUvArea = uvEdge1.X * uvEdge2.Y - uvEdge1.Y * uvEdge2.X;
+		v3 triTangent = Sub(Mul(edge1, uvEdge2.Y), Mul(edge2, uvEdge1.Y));
+		r32 triTangentLength = Length(triTangent);
+		if (AbsR32(signedUvArea) <= 1e-20f || triTangentLength <= 1e-20f) { continue; } //degenerate in UV space, contributes nothing
+		triTangent = Mul(triTangent, ((signedUvArea > 0.0f) ? 1.0f : -1.0f) / triTangentLength);
+		uxx orientation = (signedUvArea > 0.0f) ? 0 : 1;
+		triangleOrientations[cIndex / 3] = (u8)orientation;
+		
+		for (uxx corner = 0; corner < 3; corner++)
+		{
+			const Vertex3D* vertex = &vertices[triVertices[corner]];
+			vertexOrientations[triVertices[corner]] |= (u8)(1 << orientation);
+			v3 normal = vertex->normal;
+			r32 normalLength = Length(normal);
+			if (normalLength <= 1e-20f) { continue; }
+			normal = Mul(normal, 1.0f / normalLength);
+			v3 cornerEdge1 = ProjectTangentOntoPlane(Sub(vertices[triVertices[(corner+1) % 3]].position, vertex->position), normal);
+			v3 cornerEdge2 = ProjectTangentOntoPlane(Sub(vertices[triVertices[(corner+2) % 3]].position, vertex->position), normal);
+			r32 edgeLengths = Length(cornerEdge1) * Length(cornerEdge2);
+			v3 cornerTangent = ProjectTangentOntoPlane(triTangent, normal);
+			r32 cornerTangentLength = Length(cornerTangent);
+			if (edgeLengths <= 1e-20f || cornerTangentLength <= 1e-20f) { continue; }
+			r32 angle = AcosR32(ClampR32(Dot(cornerEdge1, cornerEdge2) / edgeLengths, -1.0f, 1.0f));
+			uxx sumIndex = weldIds[triVertices[corner]] * 2 + orientation;
+			tangentSums[sumIndex] = Add(tangentSums[sumIndex], Mul(cornerTangent, angle / cornerTangentLength));
+			tangentWeights[sumIndex] += angle;
+		}
+	}
+	
+	//splitIds[v] is the copy of v that mirrored triangles use, UINT32_MAX when v doesn't need one
+	u32* splitIds = AllocArray(u32, scratch, numVertices);
+	NotNull(splitIds);
+	uxx numSplits = 0;
+	for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+	{
+		v3 normal = vertices[vIndex].normal;
+		r32 normalLength = Length(normal);
+		normal = (normalLength > 1e-20f) ? Mul(normal, 1.0f / normalLength) : NewV3(0, 1, 0);
+		uxx sumIndex = weldIds[vIndex] * 2;
+		uxx orientation = 0;
+		if (vertexOrientations[vIndex] == 0x02) { orientation = 1; }
+		else if (vertexOrientations[vIndex] == 0x00) { orientation = (tangentWeights[sumIndex + 1] > tangentWeights[sumIndex]) ? 1 : 0; } //unused, pick what its welded neighbors mostly use
+		splitIds[vIndex] = UINT32_MAX;
+		for (uxx pass = 0; pass < 2; pass++)
+		{
+			v3 tangent = ProjectTangentOntoPlane(tangentSums[sumIndex + orientation], normal);
+			r32 tangentLength = Length(tangent);
+			tangent = (tangentLength > 1e-20f) ? Mul(tangent, 1.0f / tangentLength) : GetFallbackTangent(normal);
+			uxx outIndex = (pass == 0) ? vIndex : (numVertices + numSplits);
+			tangentsOut[outIndex] = NewV4(tangent.X, tangent.Y, tangent.Z, (orientation == 0) ? 1.0f : -1.0f);
+			if (pass == 1)
+			{
+				NotNull(splitSourcesOut);
+				splitSourcesOut[numSplits] = (u32)vIndex;
+				splitIds[vIndex] = (u32)(numVertices + numSplits);
+				numSplits++;
+			}
+			if (vertexOrientations[vIndex] != 0x03) { break; }
+			orientation = 1;
+		}
+	}
+	
+	if (numSplits > 0)
+	{
+		NotNull(indices);
+		uxx numSplitCorners = 0;
+		for (uxx cIndex = 0; cIndex < numCorners; cIndex++)
+		{
+			if (triangleOrientations[cIndex / 3] != 1 || splitIds[indices[cIndex]] == UINT32_MAX) { continue; }
+			indices[cIndex] = (i32)splitIds[indices[cIndex]];
+			if (splitCornersOut != nullptr) { splitCornersOut[numSplitCorners] = (u32)cIndex; }
+			numSplitCorners++;
+		}
+		if (numSplitCornersOut != nullptr) { *numSplitCornersOut = numSplitCorners; }
+	}
+	ScratchEnd(scratch);
+	return numSplits;
+}
+
+// +--------------------------------------------------------------+
+// |                        Vertex Buffers                        |
+// +--------------------------------------------------------------+
+// Interleaves the tangents with the Vertex3D attributes. Passing nullptr for tangents generates them
+// (for meshes we make ourselves that don't go through the model cache, like the cube and sphere)
+VertBuffer InitPbrVertBuffer(Arena* arena, Str8 name, VertBufferUsage usage, uxx numVertices, const Vertex3D* vertices, const v4* tangents)
+{
+	NotNull(arena);
+	ScratchBegin1(scratch, arena);
+	if (tangents == nullptr && numVertices > 0)
+	{
+		v4* generatedTangents = AllocArray(v4, scratch, numVertices);
+		NotNull(generatedTangents);
+		GenerateMeshTangents(scratch, vertices, numVertices, nullptr, 0, generatedTangents, nullptr, nullptr, nullptr);
+		tangents = generatedTangents;
+	}
+	VertexPbr* pbrVertices = AllocArray(VertexPbr, scratch, numVertices + 1);
+	NotNull(pbrVertices);
+	for (uxx vIndex = 0; vIndex < numVertices; vIndex++)
+	{
+		pbrVertices[vIndex].position = vertices[vIndex].position;
+		pbrVertices[vIndex].normal = vertices[vIndex].normal;
+		pbrVertices[vIndex].tangent = tangents[vIndex];
+		pbrVertices[vIndex].texCoord = vertices[vIndex].texCoord;
+		pbrVertices[vIndex].color = vertices[vIndex].color;
+	}
+	VertBufferAttribute attributes[] = {
+		{ .type = VertAttributeType_Position, .size = sizeof(v3),  .offset = STRUCT_VAR_OFFSET(VertexPbr, position) },
+		{ .type = VertAttributeType_Normal,   .size = sizeof(v3),  .offset = STRUCT_VAR_OFFSET(VertexPbr, normal)   },
+		{ .type = VertAttributeType_Tangent,  .size = sizeof(v4),  .offset = STRUCT_VAR_OFFSET(VertexPbr, tangent)  },
+		{ .type = VertAttributeType_TexCoord, .size = sizeof(v2),  .offset = STRUCT_VAR_OFFSET(VertexPbr, texCoord) },
+		{ .type = VertAttributeType_Color,    .size = sizeof(v4r), .offset = STRUCT_VAR_OFFSET(VertexPbr, color)    },
+	};
+	VertBuffer result = InitVertBufferEx(arena, name, usage, sizeof(VertexPbr) * numVertices, pbrVertices, ArrayCount(attributes), &attributes[0], false);
+	ScratchEnd(scratch);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                         Model Cache                          |
+// +--------------------------------------------------------------+
+// Covers everything GenerateMeshTangents reads, so editing the source model (or the generator) invalidates the cooked tangents
+static u64 GetModelTangentSourceHash(const Model3D* model)
+{
+	u64 result = COOKED_ASSET_HASH_SEED;
+	u64 generatorVersion = TANGENT_GENERATOR_VERSION;
+	result = HashCookedAssetBytes(result, &generatorVersion, sizeof(generatorVersion));
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+		u64 counts[2] = { (u64)part->vertices.length, (u64)part->indices.length };
+		result = HashCookedAssetBytes(result, &counts[0], sizeof(counts));
+		result = HashCookedAssetBytes(result, part->vertices.items, sizeof(Vertex3D) * part->vertices.length);
+		result = HashCookedAssetBytes(result, part->indices.items, sizeof(i32) * part->indices.length);
+	}
+	return result;
+}
+
+typedef struct ModelPartTangentJob ModelPartTangentJob;
+struct ModelPartTangentJob
+{
+	ModelDataPart* part;
+	v4* tangents; //room for part->vertices.length * 2
+	u32* splitSources; //room for part->vertices.length
+	u32* splitCorners; //room for part->indices.length
+	uxx numSplits;
+	uxx numSplitCorners;
+};
+
+typedef struct ModelTangentJobs ModelTangentJobs;
+struct ModelTangentJobs
+{
+	ModelPartTangentJob* partJobs; //only the parts that weren't in the cooked file
+};
+
+// Only reads its own part's vertices and only writes its own part's indices and the outputs set aside for it
+static JOB_FUNC_DEF(GenerateModelPartTangentsJob)
+{
+	ModelTangentJobs* context = (ModelTangentJobs*)userPntr;
+	ModelPartTangentJob* partJob = &context->partJobs[jobIndex];
+	ModelDataPart* part = partJob->part;
+	ScratchBegin(scratch);
+	uxx numIndices = part->indices.length;
+	partJob->numSplits = GenerateMeshTangents(scratch,
+		(const Vertex3D*)part->vertices.items, part->vertices.length,
+		(numIndices > 0) ? (i32*)part->indices.items : nullptr, numIndices,
+		partJob->tangents, partJob->splitSources, partJob->splitCorners, &partJob->numSplitCorners
+	);
+	ScratchEnd(scratch);
+}
+
+// Appends the split copies to the part's vertices and points the mirrored corners at them, the same thing
+// GenerateMeshTangents does to the indices, so a part looks the same whether its tangents were generated or cooked
+static bool ApplyModelPartTangentSplits(ModelDataPart* part, uxx numSourceVertices, uxx numSplits, const u32* splitSources, uxx numSplitCorners, const u32* splitCorners, bool remapCorners)
+{
+	for (uxx sIndex = 0; sIndex < numSplits; sIndex++) { if (splitSources[sIndex] >= numSourceVertices) { return false; } }
+	for (uxx cIndex = 0; cIndex < numSplitCorners; cIndex++) { if (splitCorners[cIndex] >= part->indices.length) { return false; } }
+	if (remapCorners && numSplits > 0)
+	{
+		ScratchBegin(scratch);
+		u32* splitIds = AllocArray(u32, scratch, numSourceVertices);
+		NotNull(splitIds);
+		for (uxx vIndex = 0; vIndex < numSourceVertices; vIndex++) { splitIds[vIndex] = UINT32_MAX; }
+		for (uxx sIndex = 0; sIndex < numSplits; sIndex++) { splitIds[splitSources[sIndex]] = (u32)(numSourceVertices + sIndex); }
+		i32* indices = (i32*)part->indices.items;
+		for (uxx cIndex = 0; cIndex < numSplitCorners; cIndex++)
+		{
+			i32 vertexIndex = indices[splitCorners[cIndex]];
+			if (vertexIndex >= 0 && (uxx)vertexIndex < numSourceVertices && splitIds[vertexIndex] != UINT32_MAX) { indices[splitCorners[cIndex]] = (i32)splitIds[vertexIndex]; }
+		}
+		ScratchEnd(scratch);
+	}
+	for (uxx sIndex = 0; sIndex < numSplits; sIndex++)
+	{
+		Vertex3D source = *VarArrayGetHard(Vertex3D, &part->vertices, splitSources[sIndex]);
+		Vertex3D* newVertex = VarArrayAdd(Vertex3D, &part->vertices);
+		NotNull(newVertex);
+		*newVertex = source;
+	}
+	return true;
+}
+
+// Fills model->partTangents from the cooked file next to sourcePath, generating (and re-cooking) any part that's missing from it.
+// Parts that need generating are one job each. Vertices that get split for mixed handedness are appended to their part's
+// vertices (and its indices changed to use them), so this has to run before anything else builds on the indices, like meshlets
+void GenerateModelTangents(JobSystem* jobs, Arena* arena, Model3D* model, FilePath sourcePath)
+{
+	NotNull(arena);
+	NotNull(model);
+	ScratchBegin1(scratch, arena);
+	PerfTime startTime = GetPerfTime();
+	u64 sourceHash = GetModelTangentSourceHash(model);
+	CookedAsset cookedAsset = ZEROED;
+	TryLoadCookedAsset(scratch, sourcePath, sourceHash, &cookedAsset);
+	
+	InitVarArrayWithInitial(ModelPartTangents, &model->partTangents, arena, model->data.parts.length);
+	ModelTangentJobs context = ZEROED;
+	context.partJobs = AllocArray(ModelPartTangentJob, scratch, model->data.parts.length + 1);
+	bool* partWasCooked = AllocArray(bool, scratch, model->data.parts.length + 1);
+	NotNull(context.partJobs);
+	NotNull(partWasCooked);
+	MyMemSet(partWasCooked, 0x00, sizeof(bool) * (model->data.parts.length + 1));
+	uxx numGenerated = 0;
+	VarArrayLoop(&model->data.parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &model->data.parts, pIndex);
+		ModelPartTangents* partTangents = VarArrayAdd(ModelPartTangents, &model->partTangents);
+		NotNull(partTangents);
+		ClearPointer(partTangents);
+		partTangents->numVertices = part->vertices.length;
+		if (part->vertices.length == 0) { continue; }
+		
+		Str8 cookedSplits = FindCookedAssetSection(&cookedAsset, CookedSectionType_PartTangentSplits, (u32)pIndex);
+		Str8 cookedSplitCorners = FindCookedAssetSection(&cookedAsset, CookedSectionType_PartTangentSplitCorners, (u32)pIndex);
+		Str8 cookedTangents = FindCookedAssetSection(&cookedAsset, CookedSectionType_PartTangents, (u32)pIndex);
+		uxx numCookedSplits = cookedSplits.length / sizeof(u32);
+		if (cookedTangents.length == sizeof(v4) * (part->vertices.length + numCookedSplits) &&
+			(cookedSplits.length % sizeof(u32)) == 0 && (cookedSplitCorners.length % sizeof(u32)) == 0)
+		{
+			const u32* splitSources = (const u32*)cookedSplits.chars;
+			const u32* splitCorners = (const u32*)cookedSplitCorners.chars;
+			uxx numSourceVertices = part->vertices.length;
+			if (ApplyModelPartTangentSplits(part, numSourceVertices, numCookedSplits, splitSources, cookedSplitCorners.length / sizeof(u32), splitCorners, true))
+			{
+				partTangents->numVertices = part->vertices.length;
+				partTangents->tangents = AllocArray(v4, arena, part->vertices.length);
+				NotNull(partTangents->tangents);
+				MyMemCopy(partTangents->tangents, cookedTangents.chars, cookedTangents.length);
+				partWasCooked[pIndex] = true;
+				continue;
+			}
+		}
+		ModelPartTangentJob* partJob = &context.partJobs[numGenerated];
+		ClearPointer(partJob);
+		partJob->part = part;
+		partJob->tangents = AllocArray(v4, scratch, part->vertices.length * 2);
+		partJob->splitSources = AllocArray(u32, scratch, part->vertices.length);
+		partJob->splitCorners = AllocArray(u32, scratch, part->indices.length + 1);
+		NotNull(partJob->tangents);
+		NotNull(partJob->splitSources);
+		NotNull(partJob->splitCorners);
+		numGenerated++;
+	}
+	
+	RunJobs(jobs, numGenerated, GenerateModelPartTangentsJob, &context);
+	
+	uxx numSplits = 0;
+	for (uxx jIndex = 0; jIndex < numGenerated; jIndex++)
+	{
+		ModelPartTangentJob* partJob = &context.partJobs[jIndex];
+		uxx partIndex = (uxx)(partJob->part - (ModelDataPart*)model->data.parts.items);
+		ModelPartTangents* partTangents = VarArrayGetHard(ModelPartTangents, &model->partTangents, partIndex);
+		uxx numSourceVertices = partJob->part->vertices.length;
+		bool appliedSplits = ApplyModelPartTangentSplits(partJob->part, numSourceVertices, partJob->numSplits, partJob->splitSources, partJob->numSplitCorners, partJob->splitCorners, false);
+		Assert(appliedSplits); UNUSED(appliedSplits);
+		partTangents->numVertices = partJob->part->vertices.length;
+		partTangents->tangents = AllocArray(v4, arena, partTangents->numVertices);
+		NotNull(partTangents->tangents);
+		MyMemCopy(partTangents->tangents, partJob->tangents, sizeof(v4) * partTangents->numVertices);
+		numSplits += partJob->numSplits;
+	}
+	
+	if (numGenerated > 0)
+	{
+		CookedAsset newCookedAsset = ZEROED;
+		InitCookedAsset(scratch, sourceHash, &newCookedAsset);
+		VarArrayLoop(&model->partTangents, pIndex)
+		{
+			VarArrayLoopGet(ModelPartTangents, partTangents, &model->partTangents, pIndex);
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_PartTangents, (u32)pIndex, NewStr8(sizeof(v4) * partTangents->numVertices, (char*)partTangents->tangents));
+		}
+		for (uxx jIndex = 0; jIndex < numGenerated; jIndex++)
+		{
+			ModelPartTangentJob* partJob = &context.partJobs[jIndex];
+			u32 partIndex = (u32)(partJob->part - (ModelDataPart*)model->data.parts.items);
+			if (partJob->numSplits == 0) { continue; }
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_PartTangentSplits, partIndex, NewStr8(sizeof(u32) * partJob->numSplits, (char*)partJob->splitSources));
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_PartTangentSplitCorners, partIndex, NewStr8(sizeof(u32) * partJob->numSplitCorners, (char*)partJob->splitCorners));
+		}
+		//Parts that came from the cooked file keep the splits they were cooked with
+		VarArrayLoop(&model->data.parts, pIndex)
+		{
+			Str8 cookedSplits = FindCookedAssetSection(&cookedAsset, CookedSectionType_PartTangentSplits, (u32)pIndex);
+			if (!partWasCooked[pIndex] || cookedSplits.length == 0) { continue; }
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_PartTangentSplits, (u32)pIndex, cookedSplits);
+			AddCookedAssetSection(&newCookedAsset, CookedSectionType_PartTangentSplitCorners, (u32)pIndex, FindCookedAssetSection(&cookedAsset, CookedSectionType_PartTangentSplitCorners, (u32)pIndex));
+		}
+		WriteCookedAsset(&newCookedAsset, sourcePath);
+	}
+	PerfTime endTime = GetPerfTime();
+	PrintLine_D("Tangents for %llu part%s: %llu generated, %llu cooked, %llu vert%s split (%.2lfms)",
+		(u64)model->data.parts.length, Plural(model->data.parts.length, "s"),
+		(u64)numGenerated, (u64)(model->data.parts.length - numGenerated),
+		(u64)numSplits, Plural(numSplits, "s"), GetPerfTimeDiff(&startTime, &endTime)
+	);
+	ScratchEnd(scratch);
+}
+
+// nullptr when the model has no tangents for the part (GenerateModelTangents wasn't called)
+const v4* GetModelPartTangents(const Model3D* model, uxx partIndex)
+{
+	if (partIndex >= model->partTangents.length) { return nullptr; }
+	return VarArrayGetHard(ModelPartTangents, &model->partTangents, partIndex)->tangents;
+}
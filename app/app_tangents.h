@@ -0,0 +1,38 @@
+/*
+File:   app_tangents.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Per-vertex tangents for tangent-space normal mapping, generated the way MikkTSpace does it
+	** (the convention glTF normal maps are baked against) and cached in the model's cooked asset
+	** file so they are only generated the first time a model is loaded. Tangents are stored as
+	** xyz = tangent, w = bitangent sign, the shader rebuilds the bitangent as cross(normal, tangent) * w.
+	** Vertices shared by mirrored and non-mirrored triangles are split in two like MikkTSpace does, the copies
+	** are appended to the end of the part's vertices.
+	** Everything the pbr shader draws uses the VertexPbr layout, which is Vertex3D plus the tangent.
+*/
+
+#ifndef _APP_TANGENTS_H
+#define _APP_TANGENTS_H
+
+#define TANGENT_GENERATOR_VERSION 2 //part of the cooked asset hash, bump when GenerateMeshTangents' output changes
+#define FLAT_NORMAL_COLOR         0xFFFF8080 //RGBA8 (R in the lowest byte) of a tangent-space normal pointing straight out of the surface
+
+typedef struct VertexPbr VertexPbr;
+struct VertexPbr
+{
+	v3 position;
+	v3 normal;
+	v4 tangent; //xyz = tangent, w = bitangent sign (+1 or -1)
+	v2 texCoord;
+	v4r color;
+};
+
+typedef struct ModelPartTangents ModelPartTangents;
+struct ModelPartTangents
+{
+	uxx numVertices;
+	v4* tangents; //parallel to part->vertices (including the split copies appended by GenerateModelTangents)
+};
+
+#endif //  _APP_TANGENTS_H
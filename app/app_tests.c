@@ -0,0 +1,844 @@
+/*
+File:   app_tests.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the headless tests and RunAppTests which AppRunTests calls (see app_tests.h)
+*/
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+bool CheckAppTest(AppTests* tests, bool condition, const char* conditionStr, const char* filePath, int lineNumber)
+{
+	NotNull(tests);
+	tests->numChecks++;
+	if (!condition)
+	{
+		tests->numFailedChecks++;
+		tests->currentTestFailed = true;
+		PrintLine_E("[%s] Check failed: %s (%s:%d)", tests->currentTestName, conditionStr, filePath, lineNumber);
+	}
+	return condition;
+}
+
+static void BeginAppTest(AppTests* tests, const char* testName)
+{
+	tests->currentTestName = testName;
+	tests->currentTestFailed = false;
+	tests->numTests++;
+}
+static void EndAppTest(AppTests* tests)
+{
+	if (tests->currentTestFailed) { tests->numFailedTests++; }
+	PrintLine_I("%s %s", tests->currentTestFailed ? "FAILED" : "passed", tests->currentTestName);
+	tests->currentTestName = nullptr;
+}
+
+static bool AreCloseR32(r32 left, r32 right, r32 tolerance) { return (AbsR32(left - right) <= tolerance); }
+
+// +--------------------------------------------------------------+
+// |                          Occlusion                           |
+// +--------------------------------------------------------------+
+// Only divides by z (clip.W = z) so the expected buffer contents can be written down directly:
+// pixelX = (x/z * 0.5 + 0.5) * width, pixelY = (0.5 - y/z * 0.5) * height and the stored depth is 1/z
+static mat4 GetOcclusionTestProjMat()
+{
+	mat4 result = Mat4_Identity;
+	result.Elements[2][3] = 1.0f;
+	result.Elements[3][3] = 0.0f;
+	return result;
+}
+
+static OccluderMesh MakeOcclusionTestQuad(Arena* arena, v3 corner0, v3 corner1, v3 corner2, v3 corner3)
+{
+	OccluderMesh result = ZEROED;
+	result.numVertices = 4;
+	result.numIndices = 6;
+	result.vertices = AllocArray(v3, arena, result.numVertices);
+	result.indices = AllocArray(u32, arena, result.numIndices);
+	NotNull(result.vertices);
+	NotNull(result.indices);
+	result.vertices[0] = corner0; result.vertices[1] = corner1; result.vertices[2] = corner2; result.vertices[3] = corner3;
+	const u32 quadIndices[6] = { 0, 1, 2,  0, 2, 3 };
+	MyMemCopy(result.indices, &quadIndices[0], sizeof(quadIndices));
+	return result;
+}
+
+static void TestOcclusionGoldenDepth(AppTests* tests)
+{
+	BeginAppTest(tests, "OcclusionGoldenDepth");
+	ScratchBegin1(scratch, tests->arena);
+	OcclusionBuffer occlusion = ZEROED;
+	InitOcclusionBuffer(tests->arena, &occlusion);
+	mat4 projMat = GetOcclusionTestProjMat();
+	uxx numPixels = occlusion.width * occlusion.height;
+	
+	//A quad facing the camera at z=2 spanning x,y in [-1,1] lands exactly on pixels [80,240) x [48,144) with depth 0.5.
+	//A bigger quad behind it at z=4 covers the same pixels and must lose to it no matter which is added first.
+	//Pixel centers that land exactly on the diagonal both triangles share must still be covered (by exactly one of them)
+	OccluderMesh nearQuad = MakeOcclusionTestQuad(scratch, NewV3(-1, -1, 2), NewV3(1, -1, 2), NewV3(1, 1, 2), NewV3(-1, 1, 2));
+	OccluderMesh farQuad = MakeOcclusionTestQuad(scratch, NewV3(-2, -2, 4), NewV3(2, -2, 4), NewV3(2, 2, 4), NewV3(-2, 2, 4));
+	i32 rectMinX = (i32)(occlusion.width / 4), rectMaxX = (i32)(occlusion.width * 3 / 4);
+	i32 rectMinY = (i32)(occlusion.height / 4), rectMaxY = (i32)(occlusion.height * 3 / 4);
+	for (uxx orderIndex = 0; orderIndex < 2; orderIndex++)
+	{
+		ClearOcclusionBuffer(&occlusion);
+		AddOccluderToOcclusionBuffer(&occlusion, (orderIndex == 0) ? &nearQuad : &farQuad, projMat, Mat4_Identity);
+		AddOccluderToOcclusionBuffer(&occlusion, (orderIndex == 0) ? &farQuad : &nearQuad, projMat, Mat4_Identity);
+		RasterizeOcclusionBuffer(&occlusion, tests->jobs);
+		uxx numWrongPixels = 0;
+		for (i32 yIndex = 0; yIndex < (i32)occlusion.height; yIndex++)
+		{
+			for (i32 xIndex = 0; xIndex < (i32)occlusion.width; xIndex++)
+			{
+				bool isInside = (xIndex >= rectMinX && xIndex < rectMaxX && yIndex >= rectMinY && yIndex < rectMaxY);
+				if (occlusion.depth[yIndex * occlusion.width + xIndex] != (isInside ? 0.5f : 0.0f)) { numWrongPixels++; }
+			}
+		}
+		TestCheck(tests, numWrongPixels == 0);
+		uxx numWrongTiles = 0;
+		for (i32 tileY = 0; tileY < (i32)occlusion.numTilesY; tileY++)
+		{
+			for (i32 tileX = 0; tileX < (i32)occlusion.numTilesX; tileX++)
+			{
+				bool isInside = (tileX * OCCLUSION_TILE_SIZE >= rectMinX && (tileX+1) * OCCLUSION_TILE_SIZE <= rectMaxX &&
+					tileY * OCCLUSION_TILE_SIZE >= rectMinY && (tileY+1) * OCCLUSION_TILE_SIZE <= rectMaxY);
+				if (occlusion.tileMinDepth[tileY * occlusion.numTilesX + tileX] != (isInside ? 0.5f : 0.0f)) { numWrongTiles++; }
+			}
+		}
+		TestCheck(tests, numWrongTiles == 0);
+	}
+	
+	//Boxes behind the near quad are hidden, boxes in front of it or off to the side are not
+	TestCheck(tests, !IsBoxVisibleInOcclusionBuffer(&occlusion, projMat, NewBoxV(NewV3(-0.25f, -0.25f, 2.75f), FillV3(0.5f))));
+	TestCheck(tests, IsBoxVisibleInOcclusionBuffer(&occlusion, projMat, NewBoxV(NewV3(-0.1f, -0.1f, 1.0f), FillV3(0.2f))));
+	TestCheck(tests, IsBoxVisibleInOcclusionBuffer(&occlusion, projMat, NewBoxV(NewV3(2.75f, -0.25f, 2.75f), FillV3(0.5f))));
+	
+	//A sloped quad on the plane z = 3 + x. For a pixel whose center is at screen position (u,v) the plane
+	//is at z = 3/(1-u) so the expected depth is (1-u)/3, and the pixel is covered when |v| < (1-u)/3
+	OccluderMesh slopedQuad = MakeOcclusionTestQuad(scratch, NewV3(-1, -1, 2), NewV3(1, -1, 4), NewV3(1, 1, 4), NewV3(-1, 1, 2));
+	ClearOcclusionBuffer(&occlusion);
+	AddOccluderToOcclusionBuffer(&occlusion, &slopedQuad, projMat, Mat4_Identity);
+	RasterizeOcclusionBuffer(&occlusion, tests->jobs);
+	uxx numCoveredPixels = 0, numWrongDepths = 0, numWrongCoverage = 0;
+	for (uxx yIndex = 0; yIndex < occlusion.height; yIndex++)
+	{
+		for (uxx xIndex = 0; xIndex < occlusion.width; xIndex++)
+		{
+			r32 screenU = (((r32)xIndex + 0.5f) / (r32)occlusion.width - 0.5f) * 2.0f;
+			r32 screenV = (0.5f - ((r32)yIndex + 0.5f) / (r32)occlusion.height) * 2.0f;
+			r32 expectedDepth = (1.0f - screenU) / 3.0f;
+			r32 distToEdge = MinR32(MinR32(screenU + 0.5f, 0.25f - screenU), expectedDepth - AbsR32(screenV));
+			r32 depth = occlusion.depth[yIndex * occlusion.width + xIndex];
+			if (AbsR32(distToEdge) < 1e-3f) { continue; } //too close to call, either answer is fine
+			bool shouldBeCovered = (distToEdge > 0);
+			if ((depth > 0) != shouldBeCovered) { numWrongCoverage++; }
+			if (depth > 0)
+			{
+				numCoveredPixels++;
+				if (!AreCloseR32(depth, expectedDepth, 1e-5f)) { numWrongDepths++; }
+			}
+		}
+	}
+	TestCheck(tests, numCoveredPixels > 0);
+	TestCheck(tests, numWrongCoverage == 0);
+	TestCheck(tests, numWrongDepths == 0);
+	
+	//Splitting the rows across the job system must give exactly the same buffer as doing them all here
+	r32* threadedDepth = AllocArray(r32, scratch, numPixels);
+	NotNull(threadedDepth);
+	MyMemCopy(threadedDepth, occlusion.depth, sizeof(r32) * numPixels);
+	ClearOcclusionBuffer(&occlusion);
+	AddOccluderToOcclusionBuffer(&occlusion, &slopedQuad, projMat, Mat4_Identity);
+	RasterizeOcclusionBuffer(&occlusion, nullptr);
+	TestCheck(tests, MyMemCompare(threadedDepth, occlusion.depth, sizeof(r32) * numPixels) == 0);
+	
+	FreeOcclusionBuffer(&occlusion);
+	ScratchEnd(scratch);
+	EndAppTest(tests);
+}
+
+// +--------------------------------------------------------------+
+// |                      Texture Streaming                       |
+// +--------------------------------------------------------------+
+#define TEST_STREAMED_TEXTURE_SIZE 256 //mips 256, 128, 64, 32 so mip 3 is the lowest resident one
+
+static u32 AddTestStreamedTexture(TextureStreamer* streamer, Arena* arena, v2i size, u32 seed, bool isSrgb)
+{
+	u32* pixels = AllocArray(u32, arena, (uxx)size.Width * (uxx)size.Height);
+	NotNull(pixels);
+	u32 state = seed;
+	for (uxx pIndex = 0; pIndex < (uxx)size.Width * (uxx)size.Height; pIndex++) { state = state * 1664525u + 1013904223u; pixels[pIndex] = state; }
+	return AddStreamedTexture(streamer, StrLit("test"), size, pixels, 0x00, isSrgb);
+}
+
+static uxx GetTestResidentMip(TextureStreamer* streamer, u32 textureId) { return GetStreamedTexture(streamer, textureId)->residentMip; }
+
+static void TestTextureStreamerMips(AppTests* tests)
+{
+	BeginAppTest(tests, "TextureStreamerMips");
+	ScratchBegin1(scratch, tests->arena);
+	TextureStreamer streamer = ZEROED;
+	InitTextureStreamer(tests->arena, tests->jobs, TEXTURE_STREAM_DEFAULT_BUDGET, true, &streamer);
+	
+	//A black and white checkerboard averages to exactly half intensity in every channel of the first mip. sRGB color
+	//channels are averaged in linear space, 0.5 linear encodes to 0.7354 (188), alpha is always averaged directly
+	v2i checkerSize = FillV2i(64);
+	u32* checkerPixels = AllocArray(u32, scratch, (uxx)checkerSize.Width * (uxx)checkerSize.Height);
+	NotNull(checkerPixels);
+	for (i32 yIndex = 0; yIndex < checkerSize.Height; yIndex++)
+	{
+		for (i32 xIndex = 0; xIndex < checkerSize.Width; xIndex++) { checkerPixels[yIndex * checkerSize.Width + xIndex] = ((xIndex + yIndex) % 2 == 0) ? 0xFFFFFFFF : 0x00000000; }
+	}
+	StreamedTexture* linearTexture = GetStreamedTexture(&streamer, AddStreamedTexture(&streamer, StrLit("checker"), checkerSize, checkerPixels, 0x00, false));
+	TestCheck(tests, linearTexture->numMips == 7);
+	TestCheck(tests, linearTexture->lowestMip == 1);
+	TestCheck(tests, linearTexture->mips[1].size.Width == 32 && linearTexture->mips[1].size.Height == 32);
+	TestCheck(tests, linearTexture->mips[1].pixels[0] == 0x80808080 && linearTexture->mips[1].pixels[32*32-1] == 0x80808080);
+	TestCheck(tests, linearTexture->mips[6].pixels[0] == 0x80808080);
+	StreamedTexture* srgbTexture = GetStreamedTexture(&streamer, AddStreamedTexture(&streamer, StrLit("checker_srgb"), checkerSize, checkerPixels, 0x00, true));
+	TestCheck(tests, srgbTexture->mips[1].pixels[0] == 0x80BCBCBC);
+	
+	//Splitting each level's rows across the job system has to give the same mips as doing it all on this thread,
+	//including odd sizes where the last row/column of a level gets clamped
+	TextureStreamer inlineStreamer = ZEROED;
+	InitTextureStreamer(tests->arena, nullptr, TEXTURE_STREAM_DEFAULT_BUDGET, true, &inlineStreamer);
+	StreamedTexture* threadedTexture = GetStreamedTexture(&streamer, AddTestStreamedTexture(&streamer, scratch, NewV2i(301, 203), 7, true));
+	StreamedTexture* inlineTexture = GetStreamedTexture(&inlineStreamer, AddTestStreamedTexture(&inlineStreamer, scratch, NewV2i(301, 203), 7, true));
+	TestCheck(tests, threadedTexture->numMips == inlineTexture->numMips);
+	uxx numDifferentMips = 0;
+	for (uxx mIndex = 0; mIndex < MinUXX(threadedTexture->numMips, inlineTexture->numMips); mIndex++)
+	{
+		uxx mipBytes = (uxx)inlineTexture->mips[mIndex].size.Width * (uxx)inlineTexture->mips[mIndex].size.Height * sizeof(u32);
+		if (MyMemCompare(threadedTexture->mips[mIndex].pixels, inlineTexture->mips[mIndex].pixels, mipBytes) != 0) { numDifferentMips++; }
+	}
+	TestCheck(tests, numDifferentMips == 0);
+	
+	FreeTextureStreamer(&inlineStreamer);
+	FreeTextureStreamer(&streamer);
+	ScratchEnd(scratch);
+	EndAppTest(tests);
+}
+
+static void TestTextureStreamerBudget(AppTests* tests)
+{
+	BeginAppTest(tests, "TextureStreamerBudget");
+	ScratchBegin1(scratch, tests->arena);
+	v2i size = FillV2i(TEST_STREAMED_TEXTURE_SIZE);
+	uxx lowestBytes = 32*32*sizeof(u32);
+	uxx upgradeBytes = 64*64*sizeof(u32) - lowestBytes; //going from mip 3 to mip 2
+	
+	//Room for every texture's lowest mip plus two of them at mip 2
+	TextureStreamer streamer = ZEROED;
+	InitTextureStreamer(tests->arena, tests->jobs, 3*lowestBytes + 2*upgradeBytes, true, &streamer);
+	u32 textureIds[3];
+	for (uxx tIndex = 0; tIndex < ArrayCount(textureIds); tIndex++) { textureIds[tIndex] = AddTestStreamedTexture(&streamer, scratch, size, (u32)tIndex, false); }
+	TestCheck(tests, streamer.residentBytes == 3*lowestBytes);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureIds[0]) == 3);
+	
+	//Two requests fit, both get uploaded this frame
+	RequestStreamedTextureMip(&streamer, textureIds[0], 2);
+	RequestStreamedTextureMip(&streamer, textureIds[1], 2);
+	UpdateTextureStreamer(&streamer);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureIds[0]) == 2 && GetTestResidentMip(&streamer, textureIds[1]) == 2);
+	TestCheck(tests, streamer.residentBytes == streamer.budgetBytes);
+	TestCheck(tests, streamer.numUploads == 2 && streamer.numEvictions == 0);
+	
+	//Texture 1 is requested one frame longer than texture 0. When the third texture needs room both could be
+	//dropped, the least recently requested one (texture 0) has to be the one that goes
+	RequestStreamedTextureMip(&streamer, textureIds[1], 2);
+	UpdateTextureStreamer(&streamer);
+	RequestStreamedTextureMip(&streamer, textureIds[2], 2);
+	UpdateTextureStreamer(&streamer);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureIds[0]) == 3);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureIds[1]) == 2);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureIds[2]) == 2);
+	TestCheck(tests, streamer.numEvictions == 1 && streamer.numDeniedUploads == 0);
+	TestCheck(tests, streamer.residentBytes <= streamer.budgetBytes);
+	
+	//Everything sharper than the lowest mip is still requested, there's nothing that can be evicted for texture 0
+	RequestStreamedTextureMip(&streamer, textureIds[0], 2);
+	RequestStreamedTextureMip(&streamer, textureIds[1], 2);
+	RequestStreamedTextureMip(&streamer, textureIds[2], 2);
+	UpdateTextureStreamer(&streamer);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureIds[0]) == 3);
+	TestCheck(tests, streamer.numDeniedUploads == 1);
+	TestCheck(tests, streamer.residentBytes <= streamer.budgetBytes);
+	
+	//Shrinking the budget drops whatever isn't needed right away, the lowest mips are allowed to stay over it
+	SetTextureStreamerBudget(&streamer, 0);
+	TestCheck(tests, streamer.residentBytes == 3*lowestBytes);
+	FreeTextureStreamer(&streamer);
+	
+	//With plenty of budget a texture moves one mip sharper per update, then falls back to its lowest mip
+	//once nothing has asked for it in TEXTURE_STREAM_EVICT_AFTER_FRAMES updates
+	InitTextureStreamer(tests->arena, tests->jobs, TEXTURE_STREAM_DEFAULT_BUDGET, true, &streamer);
+	u32 textureId = AddTestStreamedTexture(&streamer, scratch, size, 3, false);
+	for (uxx uIndex = 0; uIndex < 3; uIndex++)
+	{
+		RequestStreamedTextureMip(&streamer, textureId, 0);
+		UpdateTextureStreamer(&streamer);
+		TestCheck(tests, GetTestResidentMip(&streamer, textureId) == 2 - uIndex);
+	}
+	TestCheck(tests, streamer.residentBytes == (uxx)TEST_STREAMED_TEXTURE_SIZE * TEST_STREAMED_TEXTURE_SIZE * sizeof(u32));
+	for (uxx uIndex = 0; uIndex < TEXTURE_STREAM_EVICT_AFTER_FRAMES; uIndex++) { UpdateTextureStreamer(&streamer); }
+	TestCheck(tests, GetTestResidentMip(&streamer, textureId) == 0);
+	UpdateTextureStreamer(&streamer);
+	TestCheck(tests, GetTestResidentMip(&streamer, textureId) == 3);
+	TestCheck(tests, streamer.residentBytes == lowestBytes);
+	FreeTextureStreamer(&streamer);
+	
+	ScratchEnd(scratch);
+	EndAppTest(tests);
+}
+
+// +--------------------------------------------------------------+
+// |                             BRDF                             |
+// +--------------------------------------------------------------+
+// Integral of EvaluateBrdf over every light direction in the hemisphere, ie. how much of a uniform white environment
+// the surface reflects towards the viewer
+static v3 IntegrateTestBrdfAlbedo(const BrdfSurface* surface, r32 normalDotView, r32 multiScatterDfg, uxx numTheta, uxx numPhi)
+{
+	v3 normal = NewV3(0.0f, 0.0f, 1.0f);
+	v3 viewDir = NewV3(SqrtR32(1.0f - normalDotView * normalDotView), 0.0f, normalDotView);
+	r32 thetaStep = HalfPi32 / (r32)numTheta;
+	r32 phiStep = TwoPi32 / (r32)numPhi;
+	r64 sums[3] = { 0.0, 0.0, 0.0 };
+	for (uxx tIndex = 0; tIndex < numTheta; tIndex++)
+	{
+		r32 theta = ((r32)tIndex + 0.5f) * thetaStep;
+		for (uxx pIndex = 0; pIndex < numPhi; pIndex++)
+		{
+			r32 phi = ((r32)pIndex + 0.5f) * phiStep;
+			v3 lightDir = NewV3(SinR32(theta) * CosR32(phi), SinR32(theta) * SinR32(phi), CosR32(theta));
+			v3 reflected = EvaluateBrdf(surface, normal, viewDir, lightDir, multiScatterDfg);
+			r32 solidAngle = SinR32(theta) * thetaStep * phiStep;
+			sums[0] += (r64)(reflected.X * solidAngle);
+			sums[1] += (r64)(reflected.Y * solidAngle);
+			sums[2] += (r64)(reflected.Z * solidAngle);
+		}
+	}
+	return NewV3((r32)sums[0], (r32)sums[1], (r32)sums[2]);
+}
+
+static void TestBrdfReference(AppTests* tests)
+{
+	BeginAppTest(tests, "BrdfReference");
+	ScratchBegin1(scratch, tests->arena);
+	
+	//Schlick Fresnel is f0 head on and 1 at grazing angles
+	TestCheck(tests, AreCloseR32(BrdfFresnelSchlick(1.0f, BRDF_DIELECTRIC_F0), BRDF_DIELECTRIC_F0, 1e-6f));
+	TestCheck(tests, AreCloseR32(BrdfFresnelSchlick(0.0f, BRDF_DIELECTRIC_F0), 1.0f, 1e-6f));
+	
+	//GGX integrates to 1 over the hemisphere when weighted by NdotH
+	const r32 roughnessValues[] = { 0.3f, 0.6f, 1.0f };
+	for (uxx rIndex = 0; rIndex < ArrayCount(roughnessValues); rIndex++)
+	{
+		r32 alpha = GetBrdfAlpha(roughnessValues[rIndex]);
+		const uxx numTheta = 4096;
+		r32 thetaStep = HalfPi32 / (r32)numTheta;
+		r64 projectedArea = 0.0;
+		for (uxx tIndex = 0; tIndex < numTheta; tIndex++)
+		{
+			r32 theta = ((r32)tIndex + 0.5f) * thetaStep;
+			projectedArea += (r64)(BrdfDistributionGgx(CosR32(theta), alpha) * CosR32(theta) * SinR32(theta) * thetaStep * TwoPi32);
+		}
+		TestCheck(tests, AreCloseR32((r32)projectedArea, 1.0f, 0.01f));
+	}
+	
+	//The importance sampled DFG has to match integrating the specular lobe directly (f0 = 1 so scale + bias is the whole albedo)
+	const r32 dfgRoughnessValues[] = { 0.5f, 1.0f };
+	const r32 dfgNormalDotViewValues[] = { 0.2f, 0.5f, 0.9f };
+	for (uxx rIndex = 0; rIndex < ArrayCount(dfgRoughnessValues); rIndex++)
+	{
+		for (uxx vIndex = 0; vIndex < ArrayCount(dfgNormalDotViewValues); vIndex++)
+		{
+			BrdfDfg dfg = IntegrateBrdfDfg(dfgNormalDotViewValues[vIndex], dfgRoughnessValues[rIndex], 2048);
+			r32 bruteForce = IntegrateSpecularAlbedoBruteForce(dfgNormalDotViewValues[vIndex], dfgRoughnessValues[rIndex], false, 512, 256);
+			TestCheck(tests, AreCloseR32(dfg.scale + dfg.bias, bruteForce, 0.02f));
+			TestCheck(tests, dfg.scale >= 0.0f && dfg.bias >= 0.0f && dfg.scale + dfg.bias <= 1.0f);
+		}
+	}
+	
+	//The LUT texels are the DFG at texel centers, scale in R and bias in G
+	const uxx lutSize = 8;
+	const uxx lutSamples = 256;
+	u32* lutPixels = GenerateBrdfDfgLut(scratch, lutSize, lutSamples);
+	uxx numWrongTexels = 0;
+	for (uxx yIndex = 0; yIndex < lutSize; yIndex++)
+	{
+		for (uxx xIndex = 0; xIndex < lutSize; xIndex++)
+		{
+			BrdfDfg dfg = IntegrateBrdfDfg(((r32)xIndex + 0.5f) / (r32)lutSize, ((r32)yIndex + 0.5f) / (r32)lutSize, lutSamples);
+			u32 texel = lutPixels[yIndex * lutSize + xIndex];
+			if ((i32)(texel & 0xFF) != RoundR32i(dfg.scale * 255.0f)) { numWrongTexels++; }
+			else if ((i32)((texel >> 8) & 0xFF) != RoundR32i(dfg.bias * 255.0f)) { numWrongTexels++; }
+			else if ((texel >> 24) != 0xFF) { numWrongTexels++; }
+		}
+	}
+	TestCheck(tests, numWrongTexels == 0);
+	
+	//Helmholtz reciprocity: swapping the view and light gives the same BRDF (EvaluateBrdf includes NdotL so divide that back out)
+	BrdfSurface surface = ZEROED;
+	surface.baseColor = NewV3(0.8f, 0.5f, 0.2f);
+	surface.metallic = 0.3f;
+	surface.perceptualRoughness = 0.4f;
+	v3 normal = NewV3(0.0f, 0.0f, 1.0f);
+	v3 firstDir = Normalize(NewV3(0.6f, 0.1f, 0.7f));
+	v3 secondDir = Normalize(NewV3(-0.3f, 0.4f, 0.5f));
+	v3 forward = EvaluateBrdf(&surface, normal, firstDir, secondDir, 1.0f);
+	v3 backward = EvaluateBrdf(&surface, normal, secondDir, firstDir, 1.0f);
+	TestCheck(tests, AreCloseR32(forward.X / secondDir.Z, backward.X / firstDir.Z, 1e-4f));
+	TestCheck(tests, AreCloseR32(forward.Y / secondDir.Z, backward.Y / firstDir.Z, 1e-4f));
+	TestCheck(tests, AreCloseR32(forward.Z / secondDir.Z, backward.Z / firstDir.Z, 1e-4f));
+	v3 belowSurface = EvaluateBrdf(&surface, normal, firstDir, NewV3(0.0f, 0.6f, -0.8f), 1.0f);
+	TestCheck(tests, belowSurface.X == 0.0f && belowSurface.Y == 0.0f && belowSurface.Z == 0.0f);
+	
+	//White furnace: a white metal loses energy on rough surfaces without the multiple scattering compensation and
+	//(nearly) none with it. A white dielectric reflects all of its diffuse plus the dielectric specular on top, the
+	//layers aren't coupled so that ends up a few percent over 1 at grazing angles (same as the shader)
+	BrdfSurface whiteDiffuse = ZEROED;
+	whiteDiffuse.baseColor = V3_One;
+	whiteDiffuse.metallic = 0.0f;
+	whiteDiffuse.perceptualRoughness = 1.0f;
+	BrdfSurface whiteMetal = whiteDiffuse;
+	whiteMetal.metallic = 1.0f;
+	for (uxx vIndex = 0; vIndex < ArrayCount(dfgNormalDotViewValues); vIndex++)
+	{
+		r32 normalDotView = dfgNormalDotViewValues[vIndex];
+		BrdfDfg dfg = IntegrateBrdfDfg(normalDotView, whiteMetal.perceptualRoughness, 2048);
+		r32 diffuseAlbedo = IntegrateTestBrdfAlbedo(&whiteDiffuse, normalDotView, 1.0f, 256, 128).X;
+		r32 uncompensatedAlbedo = IntegrateTestBrdfAlbedo(&whiteMetal, normalDotView, 1.0f, 256, 128).X;
+		r32 compensatedAlbedo = IntegrateTestBrdfAlbedo(&whiteMetal, normalDotView, dfg.scale + dfg.bias, 256, 128).X;
+		TestCheck(tests, AreCloseR32(diffuseAlbedo, 1.0f + BRDF_DIELECTRIC_F0 * dfg.scale + dfg.bias, 0.02f));
+		TestCheck(tests, uncompensatedAlbedo < 0.9f);
+		TestCheck(tests, AreCloseR32(compensatedAlbedo, 1.0f, 0.05f));
+	}
+	
+	//The light's falloff is 1 right at the light and reaches 0 at its radius
+	TestCheck(tests, AreCloseR32(GetPointLightAttenuation(0.0f, TEST_LIGHT_RADIUS), 1.0f, 1e-6f));
+	TestCheck(tests, GetPointLightAttenuation(TEST_LIGHT_RADIUS, TEST_LIGHT_RADIUS) == 0.0f);
+	TestCheck(tests, GetPointLightAttenuation(TEST_LIGHT_RADIUS * 0.5f, TEST_LIGHT_RADIUS) < GetPointLightAttenuation(TEST_LIGHT_RADIUS * 0.25f, TEST_LIGHT_RADIUS));
+	
+	ScratchEnd(scratch);
+	EndAppTest(tests);
+}
+
+// +--------------------------------------------------------------+
+// |                     Luminance Histogram                      |
+// +--------------------------------------------------------------+
+// Luminance whose log2 sits exactly on the center of the given bin
+static r32 GetTestBinCenterLuminance(uxx binIndex) { return exp2f(GetLuminanceHistogramBinCenterLog2(binIndex)); }
+
+static void TestLuminanceHistogram(AppTests* tests)
+{
+	BeginAppTest(tests, "LuminanceHistogram");
+	ScratchBegin1(scratch, tests->arena);
+	const r32 binWidthLog2 = (LUMINANCE_HISTOGRAM_MAX_LOG2 - LUMINANCE_HISTOGRAM_MIN_LOG2) / LUMINANCE_HISTOGRAM_BINS;
+	
+	//Bin edges: everything at or below the min (including black) lands in the first bin, everything above the max in the last
+	TestCheck(tests, GetLuminanceHistogramBin(0.0f) == 0);
+	TestCheck(tests, GetLuminanceHistogramBin(exp2f(LUMINANCE_HISTOGRAM_MIN_LOG2 - 4.0f)) == 0);
+	TestCheck(tests, GetLuminanceHistogramBin(exp2f(LUMINANCE_HISTOGRAM_MAX_LOG2 + 4.0f)) == LUMINANCE_HISTOGRAM_BINS-1);
+	TestCheck(tests, GetLuminanceHistogramBin(1.0f) == (uxx)((0.0f - LUMINANCE_HISTOGRAM_MIN_LOG2) / binWidthLog2));
+	for (uxx bIndex = 0; bIndex < LUMINANCE_HISTOGRAM_BINS; bIndex++)
+	{
+		if (!TestCheck(tests, GetLuminanceHistogramBin(GetTestBinCenterLuminance(bIndex)) == bIndex)) { break; }
+	}
+	
+	//The reduction over an image has to match binning every pixel by hand, one unit of weight each
+	const uxx numPixels = 4096;
+	v3* pixels = AllocArray(v3, scratch, numPixels);
+	NotNull(pixels);
+	u32 state = 1234;
+	for (uxx pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		r32 channels[3];
+		for (uxx cIndex = 0; cIndex < 3; cIndex++)
+		{
+			state = state * 1664525u + 1013904223u;
+			channels[cIndex] = exp2f(-14.0f + 24.0f * ((r32)(state >> 8) / (r32)(1 << 24))); //goes past both ends of the histogram
+		}
+		pixels[pIndex] = NewV3(channels[0], channels[1], channels[2]);
+	}
+	LuminanceHistogram histogram = ZEROED;
+	AccumulateLuminanceHistogram(&histogram, numPixels, pixels);
+	r32 expectedBins[LUMINANCE_HISTOGRAM_BINS] = ZEROED;
+	for (uxx pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		r32 luminance = pixels[pIndex].X * 0.2126f + pixels[pIndex].Y * 0.7152f + pixels[pIndex].Z * 0.0722f;
+		i32 binIndex = FloorR32i((log2f(luminance) - LUMINANCE_HISTOGRAM_MIN_LOG2) / binWidthLog2);
+		expectedBins[ClampI32(binIndex, 0, LUMINANCE_HISTOGRAM_BINS-1)] += 1.0f;
+	}
+	uxx numDifferentBins = 0;
+	for (uxx bIndex = 0; bIndex < LUMINANCE_HISTOGRAM_BINS; bIndex++) { if (histogram.bins[bIndex] != expectedBins[bIndex]) { numDifferentBins++; } }
+	TestCheck(tests, numDifferentBins == 0);
+	TestCheck(tests, histogram.totalWeight == (r32)numPixels);
+	
+	//A flat image averages to its own bin's center
+	ClearLuminanceHistogram(&histogram);
+	TestCheck(tests, GetHistogramAverageLuminance(&histogram, 0.0f, 1.0f) == 0.0f);
+	AddLuminanceToHistogram(&histogram, GetTestBinCenterLuminance(40), 100.0f);
+	TestCheck(tests, AreCloseR32(GetHistogramAverageLuminance(&histogram, AUTO_EXPOSURE_LOW_PERCENTILE, AUTO_EXPOSURE_HIGH_PERCENTILE), GetTestBinCenterLuminance(40), 1e-4f));
+	
+	//The darkest and brightest 10% are clipped away entirely, the rest averages geometrically (midway in log2)
+	ClearLuminanceHistogram(&histogram);
+	AddLuminanceToHistogram(&histogram, 0.0f, 10.0f);
+	AddLuminanceToHistogram(&histogram, GetTestBinCenterLuminance(20), 40.0f);
+	AddLuminanceToHistogram(&histogram, GetTestBinCenterLuminance(30), 40.0f);
+	AddLuminanceToHistogram(&histogram, 1000.0f, 10.0f);
+	r32 expectedAverage = exp2f((GetLuminanceHistogramBinCenterLog2(20) + GetLuminanceHistogramBinCenterLog2(30)) / 2.0f);
+	TestCheck(tests, AreCloseR32(GetHistogramAverageLuminance(&histogram, 0.1f, 0.9f), expectedAverage, expectedAverage * 1e-4f));
+	//Bins straddling a percentile only count the part that's inside it: [0.3,0.9) is 20 units at 20 and 40 at 30
+	expectedAverage = exp2f((GetLuminanceHistogramBinCenterLog2(20) * 20.0f + GetLuminanceHistogramBinCenterLog2(30) * 40.0f) / 60.0f);
+	TestCheck(tests, AreCloseR32(GetHistogramAverageLuminance(&histogram, 0.3f, 0.9f), expectedAverage, expectedAverage * 1e-4f));
+	
+	ScratchEnd(scratch);
+	EndAppTest(tests);
+}
+
+static void TestAutoExposure(AppTests* tests)
+{
+	BeginAppTest(tests, "AutoExposure");
+	ExposureState state = ZEROED;
+	InitExposureState(&state);
+	
+	//A steady scene converges on mapping its average to AUTO_EXPOSURE_KEY, compensation stacks on top in stops
+	r32 sceneLuminance = GetTestBinCenterLuminance(48);
+	AddLuminanceToHistogram(&state.histogram, sceneLuminance, 1.0f);
+	for (uxx fIndex = 0; fIndex < 60*10; fIndex++) { UpdateExposure(&state, 1.0f/60.0f); }
+	TestCheck(tests, AreCloseR32(state.adaptedLuminance, sceneLuminance, sceneLuminance * 1e-3f));
+	TestCheck(tests, AreCloseR32(state.exposure, AUTO_EXPOSURE_KEY / sceneLuminance, (AUTO_EXPOSURE_KEY / sceneLuminance) * 1e-3f));
+	state.compensationEv = 1.0f;
+	UpdateExposure(&state, 1.0f/60.0f);
+	TestCheck(tests, AreCloseR32(state.exposure, 2.0f * AUTO_EXPOSURE_KEY / sceneLuminance, (AUTO_EXPOSURE_KEY / sceneLuminance) * 2e-3f));
+	
+	//Adapting is eased and gets faster going brighter than going darker by the same number of stops
+	ExposureState brighter = ZEROED;
+	ExposureState darker = ZEROED;
+	InitExposureState(&brighter);
+	InitExposureState(&darker);
+	AddLuminanceToHistogram(&brighter.histogram, AUTO_EXPOSURE_KEY * 16.0f, 1.0f);
+	AddLuminanceToHistogram(&darker.histogram, AUTO_EXPOSURE_KEY / 16.0f, 1.0f);
+	UpdateExposure(&brighter, 0.25f);
+	UpdateExposure(&darker, 0.25f);
+	r32 brighterStops = log2f(brighter.adaptedLuminance / AUTO_EXPOSURE_KEY);
+	r32 darkerStops = -log2f(darker.adaptedLuminance / AUTO_EXPOSURE_KEY);
+	TestCheck(tests, brighterStops > 0.0f && brighterStops < 4.0f);
+	TestCheck(tests, darkerStops > 0.0f && darkerStops < brighterStops);
+	
+	//Manual exposure ignores the histogram, and both are clamped
+	state.autoExposure = false;
+	state.compensationEv = 2.0f;
+	UpdateExposure(&state, 1.0f/60.0f);
+	TestCheck(tests, AreCloseR32(state.exposure, 4.0f, 1e-5f));
+	state.compensationEv = 20.0f;
+	UpdateExposure(&state, 1.0f/60.0f);
+	TestCheck(tests, state.exposure == EXPOSURE_MAX);
+	
+	EndAppTest(tests);
+}
+
+// +--------------------------------------------------------------+
+// |                           Tangents                           |
+// +--------------------------------------------------------------+
+static bool IsTestTangent(v4 tangent, r32 x, r32 y, r32 z, r32 w)
+{
+	return (AreCloseR32(tangent.X, x, 1e-4f) && AreCloseR32(tangent.Y, y, 1e-4f) && AreCloseR32(tangent.Z, z, 1e-4f) && tangent.W == w);
+}
+
+// Two quads side by side sharing their middle edge, the right one has its U flipped like a mirrored half of a model
+static void TestMeshTangentSplits(AppTests* tests)
+{
+	BeginAppTest(tests, "MeshTangentSplits");
+	Vertex3D vertices[6];
+	MyMemSet(&vertices[0], 0x00, sizeof(vertices));
+	v3 positions[6] = { NewV3(0, 0, 0), NewV3(1, 0, 0), NewV3(0, 1, 0), NewV3(1, 1, 0), NewV3(2, 0, 0), NewV3(2, 1, 0) };
+	v2 texCoords[6] = { NewV2(0, 0), NewV2(1, 0), NewV2(0, 1), NewV2(1, 1), NewV2(0, 0), NewV2(0, 1) };
+	for (uxx vIndex = 0; vIndex < ArrayCount(vertices); vIndex++)
+	{
+		vertices[vIndex].position = positions[vIndex];
+		vertices[vIndex].normal = NewV3(0, 0, 1);
+		vertices[vIndex].texCoord = texCoords[vIndex];
+	}
+	const i32 sourceIndices[12] = { 0, 1, 3,  0, 3, 2,  1, 4, 5,  1, 5, 3 };
+	i32 indices[ArrayCount(sourceIndices)];
+	MyMemCopy(&indices[0], &sourceIndices[0], sizeof(indices));
+	v4 tangents[ArrayCount(vertices) * 2];
+	u32 splitSources[ArrayCount(vertices)];
+	u32 splitCorners[ArrayCount(indices)];
+	uxx numSplitCorners = 0;
+	uxx numSplits = GenerateMeshTangents(tests->arena, &vertices[0], ArrayCount(vertices), &indices[0], ArrayCount(indices), &tangents[0], &splitSources[0], &splitCorners[0], &numSplitCorners);
+	
+	//Only the two shared vertices are used by both orientations, the copies go on the end in vertex order
+	TestCheck(tests, numSplits == 2);
+	TestCheck(tests, splitSources[0] == 1 && splitSources[1] == 3);
+	TestCheck(tests, IsTestTangent(tangents[0], 1, 0, 0, 1.0f));
+	TestCheck(tests, IsTestTangent(tangents[1], 1, 0, 0, 1.0f));
+	TestCheck(tests, IsTestTangent(tangents[3], 1, 0, 0, 1.0f));
+	TestCheck(tests, IsTestTangent(tangents[4], -1, 0, 0, -1.0f));
+	TestCheck(tests, IsTestTangent(tangents[6], -1, 0, 0, -1.0f));
+	TestCheck(tests, IsTestTangent(tangents[7], -1, 0, 0, -1.0f));
+	
+	//The mirrored triangles use the copies, the others are untouched
+	i32 expectedIndices[12] = { 0, 1, 3,  0, 3, 2,  6, 4, 5,  6, 5, 7 };
+	TestCheck(tests, MyMemCompare(&indices[0], &expectedIndices[0], sizeof(indices)) == 0);
+	TestCheck(tests, numSplitCorners == 3 && splitCorners[0] == 6 && splitCorners[1] == 9 && splitCorners[2] == 11);
+	
+	//Without indices every vertex has its own triangle, so the same triangles never split anything
+	Vertex3D unindexedVertices[12];
+	for (uxx cIndex = 0; cIndex < ArrayCount(unindexedVertices); cIndex++) { unindexedVertices[cIndex] = vertices[sourceIndices[cIndex]]; }
+	v4 unindexedTangents[ArrayCount(unindexedVertices)];
+	TestCheck(tests, GenerateMeshTangents(tests->arena, &unindexedVertices[0], ArrayCount(unindexedVertices), nullptr, 0, &unindexedTangents[0], nullptr, nullptr, nullptr) == 0);
+	TestCheck(tests, IsTestTangent(unindexedTangents[1], 1, 0, 0, 1.0f));
+	TestCheck(tests, IsTestTangent(unindexedTangents[6], -1, 0, 0, -1.0f));
+	EndAppTest(tests);
+}
+
+// +--------------------------------------------------------------+
+// |                         Path Tracer                          |
+// +--------------------------------------------------------------+
+// Two triangles covering corner + [0,1] * edgeA + [0,1] * edgeB, facing Cross(edgeA, edgeB)
+static void AddTestPathTracerQuad(PathTracerScene* scene, v3 corner, v3 edgeA, v3 edgeB, u32 materialIndex)
+{
+	v3 normal = Normalize(PathTracerCross(edgeA, edgeB));
+	v3 normals[3] = { normal, normal, normal };
+	v2 texCoords[3] = { V2_Zero, V2_Zero, V2_Zero };
+	v3 oppositeCorner = Add(Add(corner, edgeA), edgeB);
+	AddPathTracerTriangle(scene, corner, Add(corner, edgeA), oppositeCorner, normals, nullptr, texCoords, materialIndex);
+	AddPathTracerTriangle(scene, corner, oppositeCorner, Add(corner, edgeB), normals, nullptr, texCoords, materialIndex);
+}
+
+static PathTracerSettings GetTestPathTracerSettings(PathTracerMode mode, v2i size, uxx samplesPerPixel)
+{
+	PathTracerSettings result = ZEROED;
+	result.mode = mode;
+	result.size = size;
+	result.samplesPerPixel = samplesPerPixel;
+	result.seed = 7;
+	result.cameraPos = NewV3(0.0f, 0.0f, 3.0f);
+	result.cameraLookDir = NewV3(0.0f, 0.0f, -1.0f);
+	result.fieldOfViewY = HalfPi32;
+	result.lightRadius = 20.0f;
+	result.aoDistance = 1.0f;
+	return result;
+}
+
+// Where the camera ray through the center of a pixel hits the z = 0 plane
+static v3 GetTestPathTracerWallHit(const PathTracer* tracer, uxx xIndex, uxx yIndex)
+{
+	const PathTracerSettings* settings = &tracer->settings;
+	v2 screenSize = NewV2((r32)settings->size.Width, (r32)settings->size.Height);
+	BvhRay ray = GetBvhRayFromScreenPos(settings->cameraPos, settings->cameraLookDir, tracer->viewMat, settings->fieldOfViewY, screenSize, NewV2((r32)xIndex + 0.5f, (r32)yIndex + 0.5f));
+	return Add(ray.origin, Mul(ray.direction, -ray.origin.Z / ray.direction.Z));
+}
+
+static void TestPathTracerGoldenImages(AppTests* tests)
+{
+	BeginAppTest(tests, "PathTracerGoldenImages");
+	v2i size = NewV2i(32, 32);
+	
+	//Ambient occlusion between two parallel walls a distance d apart: a cosine weighted ray only escapes within aoDistance L
+	//when it leaves at cos(theta) < d/L, which is (d/L)^2 of the rays. The camera sits between the walls looking at one
+	PathTracerScene wallsScene = ZEROED;
+	InitPathTracerScene(tests->arena, &wallsScene);
+	u32 whiteMaterial = AddPathTracerUntexturedMaterial(&wallsScene, NewColor(255, 255, 255, 255));
+	AddTestPathTracerQuad(&wallsScene, NewV3(-50.0f, -50.0f, 0.0f), NewV3(100.0f, 0.0f, 0.0f), NewV3(0.0f, 100.0f, 0.0f), whiteMaterial);
+	AddTestPathTracerQuad(&wallsScene, NewV3(-50.0f, -50.0f, 1.0f), NewV3(0.0f, 100.0f, 0.0f), NewV3(100.0f, 0.0f, 0.0f), whiteMaterial);
+	FinishPathTracerScene(&wallsScene);
+	PathTracerSettings aoSettings = GetTestPathTracerSettings(PathTracerMode_AmbientOcclusion, size, 16);
+	aoSettings.cameraPos = NewV3(0.0f, 0.0f, 0.5f);
+	aoSettings.aoDistance = 2.0f;
+	PathTracer aoTracer = ZEROED;
+	InitPathTracer(tests->arena, &wallsScene, &aoSettings, &aoTracer);
+	RenderPathTracerImage(tests->jobs, &aoTracer);
+	r64 aoSum = 0.0;
+	for (uxx pIndex = 0; pIndex < (uxx)size.Width * (uxx)size.Height; pIndex++) { aoSum += (r64)aoTracer.pixels[pIndex].X; }
+	r32 aoAverage = (r32)(aoSum / (r64)(size.Width * size.Height));
+	TestCheck(tests, AreCloseR32(aoAverage, 0.25f, 0.015f));
+	TestCheck(tests, aoTracer.pixels[0].X == aoTracer.pixels[0].Y && aoTracer.pixels[0].X == aoTracer.pixels[0].Z);
+	FreePathTracer(&aoTracer);
+	FreePathTracerScene(&wallsScene);
+	
+	//Direct light only (no bounces, no sky) on a white wall. A strip behind the camera casts a shadow over the wall past
+	//x = 2 (its edge at x = 0.5, z = 4.5 lines up with the light at z = 6), every shadowed pixel has to be exactly black
+	//and the lit ones have to match the BRDF for a light straight ahead
+	PathTracerScene shadowScene = ZEROED;
+	InitPathTracerScene(tests->arena, &shadowScene);
+	whiteMaterial = AddPathTracerUntexturedMaterial(&shadowScene, NewColor(255, 255, 255, 255));
+	AddTestPathTracerQuad(&shadowScene, NewV3(-50.0f, -50.0f, 0.0f), NewV3(100.0f, 0.0f, 0.0f), NewV3(0.0f, 100.0f, 0.0f), whiteMaterial);
+	AddTestPathTracerQuad(&shadowScene, NewV3(0.5f, -50.0f, 4.5f), NewV3(0.0f, 100.0f, 0.0f), NewV3(50.0f, 0.0f, 0.0f), whiteMaterial);
+	FinishPathTracerScene(&shadowScene);
+	PathTracerSettings lightSettings = GetTestPathTracerSettings(PathTracerMode_Reference, size, 4);
+	lightSettings.lightPos = NewV3(0.0f, 0.0f, 6.0f);
+	lightSettings.lightIntensity = 30.0f;
+	PathTracer lightTracer = ZEROED;
+	InitPathTracer(tests->arena, &shadowScene, &lightSettings, &lightTracer);
+	RenderPathTracerImage(tests->jobs, &lightTracer);
+	uxx numShadowed = 0;
+	uxx numWrongShadowed = 0;
+	uxx numWrongLit = 0;
+	for (uxx yIndex = 0; yIndex < (uxx)size.Height; yIndex++)
+	{
+		for (uxx xIndex = 0; xIndex < (uxx)size.Width; xIndex++)
+		{
+			v3 wallHit = GetTestPathTracerWallHit(&lightTracer, xIndex, yIndex);
+			v3 radiance = lightTracer.pixels[yIndex * (uxx)size.Width + xIndex];
+			if (wallHit.X > 2.2f) //more than a pixel past the shadow's edge
+			{
+				numShadowed++;
+				if (radiance.X != 0.0f || radiance.Y != 0.0f || radiance.Z != 0.0f) { numWrongShadowed++; }
+			}
+			else if (wallHit.X < 1.8f && radiance.X <= 0.0f) { numWrongLit++; }
+		}
+	}
+	TestCheck(tests, numShadowed > 0);
+	TestCheck(tests, numWrongShadowed == 0);
+	TestCheck(tests, numWrongLit == 0);
+	BrdfSurface wallSurface = ZEROED;
+	wallSurface.baseColor = V3_One;
+	wallSurface.metallic = PBR_UNTEXTURED_SURFACE_PARAMS.X;
+	wallSurface.perceptualRoughness = PBR_UNTEXTURED_SURFACE_PARAMS.Y;
+	v3 straightAhead = NewV3(0.0f, 0.0f, 1.0f);
+	r32 expectedCenter = EvaluateBrdf(&wallSurface, straightAhead, straightAhead, straightAhead, 1.0f).X * lightSettings.lightIntensity * GetPointLightAttenuation(6.0f, lightSettings.lightRadius);
+	v3 centerRadiance = lightTracer.pixels[(uxx)(size.Height/2) * (uxx)size.Width + (uxx)(size.Width/2)];
+	TestCheck(tests, AreCloseR32(centerRadiance.X, expectedCenter, expectedCenter * 0.03f));
+	TestCheck(tests, AreCloseR32(centerRadiance.X, centerRadiance.Y, 1e-6f) && AreCloseR32(centerRadiance.X, centerRadiance.Z, 1e-6f));
+	FreePathTracer(&lightTracer);
+	
+	//Looking away from everything, every camera ray misses and sees exactly the background
+	PathTracerSettings missSettings = GetTestPathTracerSettings(PathTracerMode_Shader, size, 1);
+	missSettings.cameraLookDir = NewV3(0.0f, 0.0f, 1.0f);
+	missSettings.cameraPos = NewV3(0.0f, 0.0f, 5.0f);
+	missSettings.backgroundColor = NewV3(0.25f, 0.5f, 0.75f);
+	PathTracer missTracer = ZEROED;
+	InitPathTracer(tests->arena, &shadowScene, &missSettings, &missTracer);
+	RenderPathTracerImage(tests->jobs, &missTracer);
+	uxx numWrongBackground = 0;
+	for (uxx pIndex = 0; pIndex < (uxx)size.Width * (uxx)size.Height; pIndex++)
+	{
+		v3 radiance = missTracer.pixels[pIndex];
+		if (radiance.X != 0.25f || radiance.Y != 0.5f || radiance.Z != 0.75f) { numWrongBackground++; }
+	}
+	TestCheck(tests, numWrongBackground == 0);
+	TestCheck(tests, missTracer.numRays == (uxx)size.Width * (uxx)size.Height);
+	FreePathTracer(&missTracer);
+	FreePathTracerScene(&shadowScene);
+	
+	EndAppTest(tests);
+}
+
+// Tiles seed their own random series, so rendering them across the workers in whatever order they get picked up has
+// to give exactly the same image (and ray count) as rendering them one after another on this thread
+static void TestPathTracerThreadedTiles(AppTests* tests)
+{
+	BeginAppTest(tests, "PathTracerThreadedTiles");
+	PathTracerScene scene = ZEROED;
+	InitPathTracerScene(tests->arena, &scene);
+	u32 floorMaterial = AddPathTracerUntexturedMaterial(&scene, NewColor(200, 200, 200, 255));
+	u32 boxMaterial = AddPathTracerUntexturedMaterial(&scene, NewColor(230, 80, 40, 255));
+	AddTestPathTracerQuad(&scene, NewV3(-10.0f, -10.0f, 0.0f), NewV3(20.0f, 0.0f, 0.0f), NewV3(0.0f, 20.0f, 0.0f), floorMaterial);
+	AddTestPathTracerQuad(&scene, NewV3(-1.0f, -1.0f, 1.0f), NewV3(1.5f, 0.0f, 0.0f), NewV3(0.0f, 1.5f, 0.0f), boxMaterial);
+	AddTestPathTracerQuad(&scene, NewV3(-1.0f, -1.0f, 0.0f), NewV3(0.0f, 0.0f, 1.0f), NewV3(0.0f, 1.5f, 0.0f), boxMaterial);
+	AddTestPathTracerQuad(&scene, NewV3(0.5f, 0.0f, 0.0f), NewV3(0.0f, 1.0f, 0.0f), NewV3(0.0f, 0.0f, 2.0f), boxMaterial);
+	FinishPathTracerScene(&scene);
+	
+	PathTracerSettings settings = GetTestPathTracerSettings(PathTracerMode_Reference, NewV2i(70, 45), 4); //partial tiles on both axes
+	settings.cameraPos = NewV3(0.5f, 0.3f, 4.0f);
+	settings.cameraLookDir = Normalize(NewV3(-0.1f, -0.05f, -1.0f));
+	settings.maxBounces = 3;
+	settings.lightPos = NewV3(2.0f, 2.0f, 3.0f);
+	settings.lightIntensity = 30.0f;
+	settings.ambientColor = NewV3(0.04f, 0.05f, 0.07f);
+	settings.backgroundColor = settings.ambientColor;
+	PathTracer threadedTracer = ZEROED;
+	PathTracer inlineTracer = ZEROED;
+	InitPathTracer(tests->arena, &scene, &settings, &threadedTracer);
+	InitPathTracer(tests->arena, &scene, &settings, &inlineTracer);
+	RenderPathTracerImage(tests->jobs, &threadedTracer);
+	RenderPathTracerImage(nullptr, &inlineTracer);
+	TestCheck(tests, threadedTracer.numTilesX * threadedTracer.numTilesY == 15);
+	TestCheck(tests, threadedTracer.numRays == inlineTracer.numRays);
+	TestCheck(tests, threadedTracer.numRays > (uxx)(70 * 45 * 4));
+	TestCheck(tests, MyMemCompare(threadedTracer.pixels, inlineTracer.pixels, sizeof(v3) * 70 * 45) == 0);
+	FreePathTracer(&inlineTracer);
+	FreePathTracer(&threadedTracer);
+	FreePathTracerScene(&scene);
+	EndAppTest(tests);
+}
+
+// +--------------------------------------------------------------+
+// |                        Depth Pre-Pass                        |
+// +--------------------------------------------------------------+
+#if FP3D_SCENE_ENABLED
+// Returns the statement (up to its ';') that starts with prefix, or an empty string when the source has none
+static Str8 FindTestShaderStatement(const char* source, const char* prefix)
+{
+	uxx sourceLength = (uxx)MyStrLength64(source);
+	uxx prefixLength = (uxx)MyStrLength64(prefix);
+	for (uxx cIndex = 0; cIndex + prefixLength <= sourceLength; cIndex++)
+	{
+		if (MyMemCompare(&source[cIndex], prefix, prefixLength) != 0) { continue; }
+		uxx endIndex = cIndex;
+		while (endIndex < sourceLength && source[endIndex] != ';') { endIndex++; }
+		return NewStr8(endIndex - cIndex, &source[cIndex]);
+	}
+	return NewStr8(0, nullptr);
+}
+
+// The color pass tests against the pre-pass depths with LESS_EQUAL and depth writes off, so a pbr position that comes
+// out even one ulp further away than the pbrDepth one fails the depth test and leaves a hole. There's no GPU here so
+// this checks the generated sources for every backend instead: both programs have to compute the position with the same
+// statement and mark it invariant (precise in HLSL), otherwise the compiler may fuse or reorder the math differently
+static void TestDepthPrePassInvariance(AppTests* tests)
+{
+	BeginAppTest(tests, "DepthPrePassInvariance");
+	sg_backend backends[] = { SG_BACKEND_GLCORE, SG_BACKEND_D3D11, SG_BACKEND_METAL_MACOS };
+	const char* positionPrefixes[] = { "gl_Position = ", "gl_Position = ", "out.gl_Position = " };
+	const char* invariantMarkers[] = { "invariant gl_Position;", "precise float4 gl_Position : SV_Position;", "[[position, invariant]]" };
+	for (uxx bIndex = 0; bIndex < ArrayCount(backends); bIndex++)
+	{
+		const char* colorSource = pbr_shader_desc(backends[bIndex])->vertex_func.source;
+		const char* depthSource = pbrDepth_shader_desc(backends[bIndex])->vertex_func.source;
+		Str8 colorPosition = FindTestShaderStatement(colorSource, positionPrefixes[bIndex]);
+		Str8 depthPosition = FindTestShaderStatement(depthSource, positionPrefixes[bIndex]);
+		TestCheck(tests, colorPosition.length > 0);
+		TestCheck(tests, colorPosition.length == depthPosition.length && MyMemCompare(colorPosition.chars, depthPosition.chars, colorPosition.length) == 0);
+		TestCheck(tests, FindTestShaderStatement(colorSource, invariantMarkers[bIndex]).length > 0);
+		TestCheck(tests, FindTestShaderStatement(depthSource, invariantMarkers[bIndex]).length > 0);
+	}
+	EndAppTest(tests);
+}
+#endif //FP3D_SCENE_ENABLED
+
+// +--------------------------------------------------------------+
+// |                         RunAppTests                          |
+// +--------------------------------------------------------------+
+// Returns the number of tests that failed
+uxx RunAppTests(Arena* arena, JobSystem* jobs)
+{
+	NotNull(arena);
+	AppTests tests = ZEROED;
+	tests.arena = arena;
+	tests.jobs = jobs;
+	
+	TestOcclusionGoldenDepth(&tests);
+	TestTextureStreamerMips(&tests);
+	TestTextureStreamerBudget(&tests);
+	TestBrdfReference(&tests);
+	TestLuminanceHistogram(&tests);
+	TestAutoExposure(&tests);
+	TestMeshTangentSplits(&tests);
+	TestPathTracerGoldenImages(&tests);
+	TestPathTracerThreadedTiles(&tests);
+	#if FP3D_SCENE_ENABLED
+	TestDepthPrePassInvariance(&tests);
+	#endif
+	
+	PrintLine_I("%llu/%llu test%s passed (%llu/%llu checks)",
+		(u64)(tests.numTests - tests.numFailedTests), (u64)tests.numTests, Plural(tests.numTests, "s"),
+		(u64)(tests.numChecks - tests.numFailedChecks), (u64)tests.numChecks
+	);
+	return tests.numFailedTests;
+}
@@ -0,0 +1,31 @@
+/*
+File:   app_tests.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Headless tests for the parts of the app that run entirely on the CPU. They are run by
+	** starting the exe with "--run-tests", which never opens a window or creates a graphics
+	** context, and the process exits with a non-zero code if any test failed.
+	** Expected values ("golden" results) are computed analytically in each test rather than
+	** stored in files so they don't depend on the resources folder.
+*/
+
+#ifndef _APP_TESTS_H
+#define _APP_TESTS_H
+
+typedef struct AppTests AppTests;
+struct AppTests
+{
+	Arena* arena;
+	JobSystem* jobs;
+	const char* currentTestName;
+	bool currentTestFailed;
+	uxx numTests;
+	uxx numFailedTests;
+	uxx numChecks;
+	uxx numFailedChecks;
+};
+
+#define TestCheck(tests, condition) CheckAppTest((tests), (condition), #condition, __FILE__, __LINE__)
+
+#endif //  _APP_TESTS_H
@@ -0,0 +1,419 @@
+/*
+File:   app_text_layout_cache.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that build, look up, draw and evict CachedTextLayouts (see app_text_layout_cache.h)
+*/
+
+// Fills everything that identifies a layout, the text isn't copied (FindOrAddCachedTextLayout copies it for a new layout)
+static CachedTextLayout NewTextLayoutKey(SdfFont* font, GlyphCache* glyphCache, Font* bakedFont, u8 styleFlags, Str8 text, r32 fontSize, r32 wrapWidth)
+{
+	CachedTextLayout result = ZEROED;
+	result.font = font;
+	result.glyphCache = glyphCache;
+	result.bakedFont = bakedFont;
+	result.styleFlags = styleFlags;
+	result.text = text;
+	result.fontSize = fontSize;
+	result.wrapWidth = wrapWidth;
+	result.textHash = (text.length > 0) ? MeowU64From(MeowHash(MeowDefaultSeed, (meow_umm)text.length, (void*)text.chars), 0) : 0;
+	
+	u64 hash = result.textHash;
+	u64 parts[5] = { (u64)(uxx)font, (u64)(uxx)glyphCache, (u64)(uxx)bakedFont, (u64)styleFlags, 0 };
+	u32 sizeBits = 0, wrapBits = 0;
+	MyMemCopy(&sizeBits, &fontSize, sizeof(sizeBits));
+	MyMemCopy(&wrapBits, &wrapWidth, sizeof(wrapBits));
+	parts[4] = ((u64)sizeBits << 32) | (u64)wrapBits;
+	for (uxx pIndex = 0; pIndex < ArrayCount(parts); pIndex++)
+	{
+		hash ^= parts[pIndex] + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+	}
+	result.keyHash = hash;
+	return result;
+}
+
+static void FreeCachedTextLayoutData(TextLayoutCache* cache, CachedTextLayout* layout)
+{
+	if (layout->glyphs != nullptr) { FreeMem(cache->arena, layout->glyphs, sizeof(CachedLayoutGlyph) * layout->numGlyphs); }
+	if (layout->fontGlyphs != nullptr) { FreeMem(cache->arena, layout->fontGlyphs, sizeof(CachedFontLayoutGlyph) * layout->numGlyphs); }
+	if (layout->text.chars != nullptr) { FreeStr8(cache->arena, &layout->text); }
+}
+
+void FreeTextLayoutCache(TextLayoutCache* cache)
+{
+	NotNull(cache);
+	if (cache->arena != nullptr)
+	{
+		VarArrayLoop(&cache->layouts, lIndex)
+		{
+			VarArrayLoopGet(CachedTextLayout, layout, &cache->layouts, lIndex);
+			FreeCachedTextLayoutData(cache, layout);
+		}
+		FreeVarArray(&cache->layouts);
+		if (cache->slots != nullptr) { FreeMem(cache->arena, cache->slots, sizeof(u32) * cache->numSlots); }
+	}
+	ClearPointer(cache);
+}
+
+void InitTextLayoutCache(Arena* arena, TextLayoutCache* cacheOut)
+{
+	NotNull(arena);
+	NotNull(cacheOut);
+	ClearPointer(cacheOut);
+	cacheOut->arena = arena;
+	cacheOut->numSlots = 64;
+	cacheOut->slots = AllocArray(u32, arena, cacheOut->numSlots);
+	NotNull(cacheOut->slots);
+	MyMemSet(cacheOut->slots, 0xFF, sizeof(u32) * cacheOut->numSlots);
+	InitVarArray(CachedTextLayout, &cacheOut->layouts, arena);
+}
+
+// Also how the table grows, and how it's fixed up after evictions move layouts around
+static void RebuildTextLayoutSlots(TextLayoutCache* cache, uxx numSlots)
+{
+	if (numSlots != cache->numSlots)
+	{
+		FreeMem(cache->arena, cache->slots, sizeof(u32) * cache->numSlots);
+		cache->numSlots = numSlots;
+		cache->slots = AllocArray(u32, cache->arena, cache->numSlots);
+		NotNull(cache->slots);
+	}
+	MyMemSet(cache->slots, 0xFF, sizeof(u32) * cache->numSlots);
+	VarArrayLoop(&cache->layouts, lIndex)
+	{
+		VarArrayLoopGet(CachedTextLayout, layout, &cache->layouts, lIndex);
+		uxx slot = (uxx)layout->keyHash & (cache->numSlots-1);
+		while (cache->slots[slot] != TEXT_LAYOUT_CACHE_NONE) { slot = (slot + 1) & (cache->numSlots-1); }
+		cache->slots[slot] = (u32)lIndex;
+	}
+}
+
+// Lays out the text the same way FlowSdfText and FlowGlyphCacheText do, and when wrapWidth is set moves the word that
+// crosses it (everything after the last space on the line) down to the next line. A single word wider than wrapWidth isn't broken
+static void BuildCachedTextLayout(TextLayoutCache* cache, CachedTextLayout* layout)
+{
+	ScratchBegin1(scratch, cache->arena);
+	SdfFont* font = layout->font;
+	Str8 text = layout->text;
+	r32 sizeScale = layout->fontSize / font->bakeSize;
+	r32 lineHeight = font->lineHeight * sizeScale;
+	CachedLayoutGlyph* glyphs = AllocArray(CachedLayoutGlyph, scratch, text.length + 1);
+	NotNull(glyphs);
+	uxx numGlyphs = 0;
+	uxx numLines = 1;
+	uxx lineStartIndex = 0;
+	uxx breakIndex = TEXT_LAYOUT_CACHE_NONE; //first glyph after the last space on this line
+	v2 penPos = V2_Zero;
+	i32 prevTtfGlyphIndex = -1;
+	for (uxx cIndex = 0; cIndex < text.length; )
+	{
+		u32 codepoint = 0;
+		u8 codepointSize = GetCodepointForUtf8Str(text, cIndex, &codepoint);
+		if (codepointSize == 0) { codepoint = (u32)(u8)text.chars[cIndex]; codepointSize = 1; }
+		cIndex += codepointSize;
+		if (codepoint == '\r') { continue; }
+		if (codepoint == '\n')
+		{
+			penPos = NewV2(0.0f, penPos.Y + lineHeight);
+			numLines++;
+			lineStartIndex = numGlyphs;
+			breakIndex = TEXT_LAYOUT_CACHE_NONE;
+			prevTtfGlyphIndex = -1;
+			continue;
+		}
+		
+		u32 glyphIndex = 0;
+		i32 ttfGlyphIndex = 0;
+		r32 advanceX = 0.0f;
+		if (layout->glyphCache != nullptr)
+		{
+			CachedGlyph* glyph = FindOrAddCachedGlyph(layout->glyphCache, codepoint);
+			glyphIndex = (u32)(glyph - (CachedGlyph*)layout->glyphCache->glyphs.items);
+			ttfGlyphIndex = glyph->ttfGlyphIndex;
+			advanceX = glyph->advanceX * sizeScale;
+		}
+		else
+		{
+			SdfGlyph* glyph = GetSdfGlyphOrFallback(font, codepoint);
+			if (glyph == nullptr) { continue; }
+			glyphIndex = (u32)(glyph - (SdfGlyph*)font->glyphs.items);
+			ttfGlyphIndex = glyph->ttfGlyphIndex;
+			advanceX = glyph->advanceX * sizeScale;
+		}
+		if (prevTtfGlyphIndex >= 0) { penPos.X += GetSdfGlyphKerning(font, prevTtfGlyphIndex, ttfGlyphIndex) * sizeScale; }
+		
+		if (layout->wrapWidth > 0.0f && codepoint != ' ' && penPos.X + advanceX > layout->wrapWidth &&
+			breakIndex != TEXT_LAYOUT_CACHE_NONE && breakIndex > lineStartIndex && breakIndex < numGlyphs)
+		{
+			r32 shiftX = glyphs[breakIndex].penOffset.X;
+			for (uxx gIndex = breakIndex; gIndex < numGlyphs; gIndex++)
+			{
+				glyphs[gIndex].penOffset.X -= shiftX;
+				glyphs[gIndex].penOffset.Y += lineHeight;
+			}
+			penPos = NewV2(penPos.X - shiftX, penPos.Y + lineHeight);
+			numLines++;
+			lineStartIndex = breakIndex;
+			breakIndex = TEXT_LAYOUT_CACHE_NONE;
+		}
+		
+		CachedLayoutGlyph* newGlyph = &glyphs[numGlyphs++];
+		newGlyph->glyphIndex = glyphIndex;
+		newGlyph->codepoint = codepoint;
+		newGlyph->penOffset = penPos;
+		newGlyph->advanceX = advanceX;
+		penPos.X += advanceX;
+		if (codepoint == ' ') { breakIndex = numGlyphs; }
+		prevTtfGlyphIndex = ttfGlyphIndex;
+	}
+	
+	r32 maxLineWidth = 0.0f;
+	for (uxx gIndex = 0; gIndex < numGlyphs; gIndex++)
+	{
+		if (glyphs[gIndex].codepoint == ' ') { continue; }
+		maxLineWidth = MaxR32(maxLineWidth, glyphs[gIndex].penOffset.X + glyphs[gIndex].advanceX);
+	}
+	layout->numGlyphs = numGlyphs;
+	layout->glyphs = nullptr;
+	if (numGlyphs > 0)
+	{
+		layout->glyphs = AllocArray(CachedLayoutGlyph, cache->arena, numGlyphs);
+		NotNull(layout->glyphs);
+		MyMemCopy(layout->glyphs, glyphs, sizeof(CachedLayoutGlyph) * numGlyphs);
+	}
+	layout->numLines = numLines;
+	layout->size = NewV2(maxLineWidth, lineHeight * (r32)numLines);
+	ScratchEnd(scratch);
+}
+
+static const FontGlyph* FindFontAtlasGlyph(const FontAtlas* atlas, u32 codepoint)
+{
+	VarArrayLoop(&atlas->glyphs, gIndex)
+	{
+		VarArrayLoopGet(FontGlyph, glyph, &atlas->glyphs, gIndex);
+		if (glyph->codepoint == codepoint) { return glyph; }
+	}
+	return nullptr;
+}
+
+// Runs PigCore's font flow once at the origin (what DrawText and MeasureText do on every call) and keeps each glyph's
+// draw rectangle along with the atlas rectangle it samples. Glyphs are matched to their FontGlyph by codepoint in the
+// atlas GetFontAtlas picks for the size and style, which is the one the flow used
+static void BuildCachedFontTextLayout(TextLayoutCache* cache, CachedTextLayout* layout)
+{
+	ScratchBegin1(scratch, cache->arena);
+	FontFlowState flowState = ZEROED;
+	flowState.font = layout->bakedFont;
+	flowState.position = V2_Zero;
+	flowState.text = layout->text;
+	flowState.fontSize = layout->fontSize;
+	flowState.styleFlags = layout->styleFlags;
+	TextLayout textLayout = ZEROED;
+	Result layoutResult = DoTextLayoutInArena(scratch, &flowState, &textLayout);
+	Assert(layoutResult == Result_Success);
+	layout->visualRec = textLayout.visualRec;
+	layout->logicalRec = textLayout.logicalRec;
+	layout->size = textLayout.logicalRec.Size;
+	layout->numLines = 1;
+	for (uxx cIndex = 0; cIndex < layout->text.length; cIndex++) { if (layout->text.chars[cIndex] == '\n') { layout->numLines++; } }
+	
+	CachedFontLayoutGlyph* glyphs = AllocArray(CachedFontLayoutGlyph, scratch, textLayout.numGlyphs + 1);
+	NotNull(glyphs);
+	uxx numGlyphs = 0;
+	FontAtlas* atlas = GetFontAtlas(layout->bakedFont, layout->fontSize, layout->styleFlags);
+	if (atlas != nullptr)
+	{
+		uxx atlasIndex = (uxx)(atlas - (FontAtlas*)layout->bakedFont->atlases.items);
+		for (uxx gIndex = 0; gIndex < textLayout.numGlyphs; gIndex++)
+		{
+			const FontFlowGlyph* flowGlyph = &textLayout.glyphs[gIndex];
+			const FontGlyph* fontGlyph = FindFontAtlasGlyph(atlas, flowGlyph->codepoint);
+			if (fontGlyph == nullptr || fontGlyph->atlasSourceRec.Width <= 0 || fontGlyph->atlasSourceRec.Height <= 0) { continue; }
+			CachedFontLayoutGlyph* newGlyph = &glyphs[numGlyphs++];
+			newGlyph->drawRec = flowGlyph->drawRec;
+			newGlyph->sourceRec = NewRec((r32)fontGlyph->atlasSourceRec.X, (r32)fontGlyph->atlasSourceRec.Y, (r32)fontGlyph->atlasSourceRec.Width, (r32)fontGlyph->atlasSourceRec.Height);
+			newGlyph->atlasIndex = atlasIndex;
+		}
+	}
+	layout->numGlyphs = numGlyphs;
+	layout->fontGlyphs = nullptr;
+	if (numGlyphs > 0)
+	{
+		layout->fontGlyphs = AllocArray(CachedFontLayoutGlyph, cache->arena, numGlyphs);
+		NotNull(layout->fontGlyphs);
+		MyMemCopy(layout->fontGlyphs, glyphs, sizeof(CachedFontLayoutGlyph) * numGlyphs);
+	}
+	ScratchEnd(scratch);
+}
+
+// Returns the layout matching everything in key (made by NewTextLayoutKey). A miss adds an empty layout with its own
+// copy of the text that the caller has to build
+static CachedTextLayout* FindOrAddCachedTextLayout(TextLayoutCache* cache, const CachedTextLayout* key, bool* wasAddedOut)
+{
+	uxx slot = (uxx)key->keyHash & (cache->numSlots-1);
+	while (cache->slots[slot] != TEXT_LAYOUT_CACHE_NONE)
+	{
+		CachedTextLayout* layout = VarArrayGetHard(CachedTextLayout, &cache->layouts, cache->slots[slot]);
+		if (layout->keyHash == key->keyHash && layout->textHash == key->textHash &&
+			layout->font == key->font && layout->glyphCache == key->glyphCache && layout->bakedFont == key->bakedFont && layout->styleFlags == key->styleFlags &&
+			layout->fontSize == key->fontSize && layout->wrapWidth == key->wrapWidth && layout->text.length == key->text.length &&
+			(key->text.length == 0 || MyMemCompare(layout->text.chars, key->text.chars, key->text.length) == 0))
+		{
+			layout->lastUsedFrame = cache->frameIndex;
+			cache->numHitsThisFrame++;
+			*wasAddedOut = false;
+			return layout;
+		}
+		slot = (slot + 1) & (cache->numSlots-1);
+	}
+	
+	u32 layoutIndex = (u32)cache->layouts.length;
+	CachedTextLayout* newLayout = VarArrayAdd(CachedTextLayout, &cache->layouts);
+	NotNull(newLayout);
+	*newLayout = *key;
+	newLayout->text = (key->text.length > 0) ? AllocStr8(cache->arena, key->text) : key->text;
+	newLayout->lastUsedFrame = cache->frameIndex;
+	cache->slots[slot] = layoutIndex;
+	cache->numMissesThisFrame++;
+	if (cache->layouts.length * 2 > cache->numSlots)
+	{
+		RebuildTextLayoutSlots(cache, cache->numSlots * 2);
+		newLayout = VarArrayGetHard(CachedTextLayout, &cache->layouts, layoutIndex);
+	}
+	*wasAddedOut = true;
+	return newLayout;
+}
+
+// Finds the layout for this text, building it when it's not cached yet. glyphCache can be nullptr to draw from the
+// font's baked atlas. The returned pointer is only good until the next GetCachedTextLayout or UpdateTextLayoutCache
+CachedTextLayout* GetCachedTextLayout(TextLayoutCache* cache, SdfFont* font, GlyphCache* glyphCache, Str8 text, r32 fontSize, r32 wrapWidth)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	NotNull(font);
+	Assert(glyphCache == nullptr || glyphCache->font == font);
+	CachedTextLayout key = NewTextLayoutKey(font, glyphCache, nullptr, 0x00, text, fontSize, wrapWidth);
+	bool wasAdded = false;
+	CachedTextLayout* result = FindOrAddCachedTextLayout(cache, &key, &wasAdded);
+	if (wasAdded) { BuildCachedTextLayout(cache, result); }
+	return result;
+}
+
+// Same as GetCachedTextLayout for a regular Font, which has to have an atlas baked at (or near) fontSize. The returned
+// pointer is only good until the next GetCachedTextLayout, UpdateTextLayoutCache or ForgetCachedFontTextLayouts
+CachedTextLayout* GetCachedFontTextLayout(TextLayoutCache* cache, Font* font, Str8 text, r32 fontSize, u8 styleFlags)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	NotNull(font);
+	CachedTextLayout key = NewTextLayoutKey(nullptr, nullptr, font, styleFlags, text, fontSize, 0.0f);
+	bool wasAdded = false;
+	CachedTextLayout* result = FindOrAddCachedTextLayout(cache, &key, &wasAdded);
+	if (wasAdded) { BuildCachedFontTextLayout(cache, result); }
+	return result;
+}
+
+// SDF layouts need the main2dSdf shader to be bound (with BindSdfTextShader) before calling this, a regular Font's
+// layout draws with the regular main2d shader like DrawText does. position is the pen position on the first line's baseline
+void DrawCachedTextLayout(const CachedTextLayout* layout, v2 position, Color32 color)
+{
+	NotNull(layout);
+	if (layout->bakedFont != nullptr)
+	{
+		for (uxx gIndex = 0; gIndex < layout->numGlyphs; gIndex++)
+		{
+			const CachedFontLayoutGlyph* layoutGlyph = &layout->fontGlyphs[gIndex];
+			FontAtlas* atlas = VarArrayGetHard(FontAtlas, &layout->bakedFont->atlases, layoutGlyph->atlasIndex);
+			rec drawRec = layoutGlyph->drawRec;
+			drawRec.X += position.X;
+			drawRec.Y += position.Y;
+			DrawTexturedRectangleEx(drawRec, color, &atlas->texture, layoutGlyph->sourceRec);
+		}
+		return;
+	}
+	r32 sizeScale = layout->fontSize / layout->font->bakeSize;
+	for (uxx gIndex = 0; gIndex < layout->numGlyphs; gIndex++)
+	{
+		const CachedLayoutGlyph* layoutGlyph = &layout->glyphs[gIndex];
+		if (layoutGlyph->codepoint == ' ') { continue; }
+		v2 penPos = Add(position, layoutGlyph->penOffset);
+		if (layout->glyphCache != nullptr)
+		{
+			DrawCachedGlyph(layout->glyphCache, VarArrayGetHard(CachedGlyph, &layout->glyphCache->glyphs, layoutGlyph->glyphIndex), penPos, sizeScale, color);
+		}
+		else
+		{
+			DrawSdfGlyph(layout->font, VarArrayGetHard(SdfGlyph, &layout->font->glyphs, layoutGlyph->glyphIndex), penPos, sizeScale, color);
+		}
+	}
+}
+
+v2 MeasureCachedText(TextLayoutCache* cache, SdfFont* font, GlyphCache* glyphCache, Str8 text, r32 fontSize, r32 wrapWidth)
+{
+	return GetCachedTextLayout(cache, font, glyphCache, text, fontSize, wrapWidth)->size;
+}
+
+void DrawCachedText(TextLayoutCache* cache, SdfFont* font, GlyphCache* glyphCache, Str8 text, v2 position, r32 fontSize, r32 wrapWidth, Color32 color)
+{
+	DrawCachedTextLayout(GetCachedTextLayout(cache, font, glyphCache, text, fontSize, wrapWidth), position, color);
+}
+
+// Cached stand-ins for MeasureText and DrawText, the font is passed in instead of coming from BindFontAtSize
+v2 MeasureCachedFontText(TextLayoutCache* cache, Font* font, Str8 text, r32 fontSize, u8 styleFlags)
+{
+	return GetCachedFontTextLayout(cache, font, text, fontSize, styleFlags)->size;
+}
+
+void DrawCachedFontText(TextLayoutCache* cache, Font* font, Str8 text, v2 position, r32 fontSize, u8 styleFlags, Color32 color)
+{
+	DrawCachedTextLayout(GetCachedFontTextLayout(cache, font, text, fontSize, styleFlags), position, color);
+}
+
+static void RemoveCachedTextLayout(TextLayoutCache* cache, uxx layoutIndex)
+{
+	CachedTextLayout* layout = VarArrayGetHard(CachedTextLayout, &cache->layouts, layoutIndex);
+	FreeCachedTextLayoutData(cache, layout);
+	if (layoutIndex + 1 < cache->layouts.length) { *layout = *VarArrayGetHard(CachedTextLayout, &cache->layouts, cache->layouts.length-1); }
+	cache->layouts.length--;
+}
+
+// Call before the font's atlases are cleared or rebaked, its layouts point at the atlases by index
+void ForgetCachedFontTextLayouts(TextLayoutCache* cache, const Font* font)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	uxx numRemoved = 0;
+	for (uxx lIndex = 0; lIndex < cache->layouts.length; )
+	{
+		CachedTextLayout* layout = VarArrayGetHard(CachedTextLayout, &cache->layouts, lIndex);
+		if (layout->bakedFont != font) { lIndex++; continue; }
+		RemoveCachedTextLayout(cache, lIndex);
+		numRemoved++;
+	}
+	if (numRemoved > 0) { RebuildTextLayoutSlots(cache, cache->numSlots); }
+}
+
+// Call once per frame, before any cached text is drawn. Drops layouts that haven't been used in TEXT_LAYOUT_CACHE_EVICT_AFTER_FRAMES,
+// text that changes every frame (a number that's counting) only ever holds onto that many layouts at once
+void UpdateTextLayoutCache(TextLayoutCache* cache)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	cache->numHits = cache->numHitsThisFrame;
+	cache->numMisses = cache->numMissesThisFrame;
+	cache->numHitsThisFrame = 0;
+	cache->numMissesThisFrame = 0;
+	
+	uxx numEvicted = 0;
+	for (uxx lIndex = 0; lIndex < cache->layouts.length; )
+	{
+		CachedTextLayout* layout = VarArrayGetHard(CachedTextLayout, &cache->layouts, lIndex);
+		if (cache->frameIndex - layout->lastUsedFrame <= TEXT_LAYOUT_CACHE_EVICT_AFTER_FRAMES) { lIndex++; continue; }
+		RemoveCachedTextLayout(cache, lIndex);
+		numEvicted++;
+	}
+	if (numEvicted > 0) { RebuildTextLayoutSlots(cache, cache->numSlots); }
+	cache->numEvictions += numEvicted;
+	cache->frameIndex++;
+}
@@ -0,0 +1,78 @@
+/*
+File:   app_text_layout_cache.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Keeps the laid out glyphs of recently drawn text around so a label that's drawn every frame
+	** only pays for a hash and a lookup instead of decoding, kerning and wrapping it again. Layouts are
+	** keyed by a MeowHash of the text plus the font (an SdfFont, GlyphCache or regular Font), font size,
+	** style flags and wrap width, and are dropped once they haven't been drawn for TEXT_LAYOUT_CACHE_EVICT_AFTER_FRAMES.
+	** An SDF layout stores glyph indices (into the SdfFont or GlyphCache) and pen offsets, not draw rectangles,
+	** so GlyphCache text still notices when one of its glyphs gets evicted and re-queues it.
+	** A regular Font's layout is what DoTextLayoutInArena gives back (the same flow DrawText and MeasureText run
+	** on every call) reduced to draw and atlas rectangles. Those point into the Font's atlases so rebaking the
+	** font has to drop them first, see ForgetCachedFontTextLayouts.
+*/
+
+#ifndef _APP_TEXT_LAYOUT_CACHE_H
+#define _APP_TEXT_LAYOUT_CACHE_H
+
+#define TEXT_LAYOUT_CACHE_EVICT_AFTER_FRAMES  120
+#define TEXT_LAYOUT_CACHE_NONE                UINT32_MAX
+
+typedef struct CachedLayoutGlyph CachedLayoutGlyph;
+struct CachedLayoutGlyph
+{
+	u32 glyphIndex; //into the SdfFont's glyphs, or the GlyphCache's glyphs when the layout has one
+	u32 codepoint;
+	v2 penOffset; //from the layout's position, on the glyph's baseline, in pixels at the layout's fontSize
+	r32 advanceX; //in pixels at the layout's fontSize
+};
+
+typedef struct CachedFontLayoutGlyph CachedFontLayoutGlyph;
+struct CachedFontLayoutGlyph
+{
+	rec drawRec; //relative to the layout's position, where DoTextLayoutInArena put it
+	rec sourceRec; //in the atlas' texture
+	uxx atlasIndex; //into the Font's atlases
+};
+
+typedef struct CachedTextLayout CachedTextLayout;
+struct CachedTextLayout
+{
+	u64 keyHash; //textHash mixed with the rest of the key, what slots are probed with
+	u64 textHash;
+	Str8 text; //our own copy, compared on lookup so a hash collision can't draw the wrong text
+	SdfFont* font; //nullptr for a regular Font's layout
+	GlyphCache* glyphCache; //nullptr when the glyphs come from the font's baked atlas
+	Font* bakedFont; //a regular Font drawn from its baked atlases, nullptr for SDF text
+	u8 styleFlags; //bakedFont only
+	r32 fontSize;
+	r32 wrapWidth; //0 for no wrapping, always 0 for bakedFont
+	uxx numGlyphs;
+	CachedLayoutGlyph* glyphs; //SDF text
+	CachedFontLayoutGlyph* fontGlyphs; //bakedFont text
+	uxx numLines;
+	v2 size; //logical size, the widest line (without trailing spaces) by numLines line heights
+	rec visualRec; //bakedFont only, relative to the position the text is drawn at (the first line's baseline)
+	rec logicalRec; //bakedFont only, same as visualRec
+	u64 lastUsedFrame;
+};
+
+typedef struct TextLayoutCache TextLayoutCache;
+struct TextLayoutCache
+{
+	Arena* arena;
+	u64 frameIndex;
+	VarArray layouts; //CachedTextLayout
+	u32* slots; //layout index or TEXT_LAYOUT_CACHE_NONE, open addressing on keyHash
+	uxx numSlots;
+	
+	uxx numHits; //last frame
+	uxx numMisses; //last frame, layouts that had to be built
+	uxx numHitsThisFrame;
+	uxx numMissesThisFrame;
+	uxx numEvictions; //since the cache was made
+};
+
+#endif //  _APP_TEXT_LAYOUT_CACHE_H
@@ -0,0 +1,354 @@
+/*
+File:   app_texture_atlas.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the skyline packer and the functions that fill TextureAtlas pages with material textures
+	** NOTE: Pages are plain 2D textures rather than texture arrays since Texture doesn't support
+	** array layers. That forces the UVs of an atlased material to stay inside [0,1] (no repeating),
+	** materials that tile are left with their own textures.
+*/
+
+// +--------------------------------------------------------------+
+// |                       Skyline Packer                         |
+// +--------------------------------------------------------------+
+void FreeSkylinePacker(SkylinePacker* packer)
+{
+	NotNull(packer);
+	FreeVarArray(&packer->nodes);
+	ClearPointer(packer);
+}
+
+void InitSkylinePacker(Arena* arena, v2i size, SkylinePacker* packerOut)
+{
+	NotNull(arena);
+	NotNull(packerOut);
+	Assert(size.Width > 0 && size.Height > 0);
+	ClearPointer(packerOut);
+	packerOut->size = size;
+	InitVarArray(SkylineNode, &packerOut->nodes, arena);
+	SkylineNode* firstNode = VarArrayAdd(SkylineNode, &packerOut->nodes);
+	NotNull(firstNode);
+	firstNode->x = 0;
+	firstNode->y = 0;
+	firstNode->width = size.Width;
+}
+
+// Returns the y a rectangle of the given size would rest at if its left edge was placed at nodes[nodeIndex].x, or -1 if it doesn't fit there
+static i32 GetSkylineFitY(const SkylinePacker* packer, uxx nodeIndex, v2i size)
+{
+	const SkylineNode* nodes = (const SkylineNode*)packer->nodes.items;
+	i32 left = nodes[nodeIndex].x;
+	if (left + size.Width > packer->size.Width) { return -1; }
+	i32 result = 0;
+	i32 widthLeft = size.Width;
+	for (uxx nIndex = nodeIndex; nIndex < packer->nodes.length && widthLeft > 0; nIndex++)
+	{
+		if (nodes[nIndex].y > result) { result = nodes[nIndex].y; }
+		if (result + size.Height > packer->size.Height) { return -1; }
+		widthLeft -= nodes[nIndex].width;
+	}
+	return result;
+}
+
+// Bottom-left heuristic: lowest top edge wins, ties go to the narrower node (less wasted space under the rectangle)
+bool PackSkylineRect(SkylinePacker* packer, v2i size, v2i* positionOut)
+{
+	NotNull(packer);
+	NotNull(positionOut);
+	Assert(size.Width > 0 && size.Height > 0);
+	uxx bestIndex = packer->nodes.length;
+	i32 bestY = 0;
+	i32 bestTop = INT32_MAX;
+	i32 bestNodeWidth = INT32_MAX;
+	VarArrayLoop(&packer->nodes, nIndex)
+	{
+		VarArrayLoopGet(SkylineNode, node, &packer->nodes, nIndex);
+		i32 fitY = GetSkylineFitY(packer, nIndex, size);
+		if (fitY < 0) { continue; }
+		i32 top = fitY + size.Height;
+		if (top < bestTop || (top == bestTop && node->width < bestNodeWidth))
+		{
+			bestIndex = nIndex;
+			bestY = fitY;
+			bestTop = top;
+			bestNodeWidth = node->width;
+		}
+	}
+	if (bestIndex >= packer->nodes.length) { return false; }
+	
+	//Rebuild the node list with the new rectangle's top edge replacing everything it covers
+	ScratchBegin(scratch);
+	uxx oldNumNodes = packer->nodes.length;
+	SkylineNode* oldNodes = AllocArray(SkylineNode, scratch, oldNumNodes);
+	NotNull(oldNodes);
+	MyMemCopy(oldNodes, packer->nodes.items, sizeof(SkylineNode) * oldNumNodes);
+	VarArrayClear(&packer->nodes);
+	i32 left = oldNodes[bestIndex].x;
+	i32 right = left + size.Width;
+	for (uxx nIndex = 0; nIndex < oldNumNodes; nIndex++)
+	{
+		SkylineNode node = oldNodes[nIndex];
+		if (nIndex == bestIndex)
+		{
+			SkylineNode* newNode = VarArrayAdd(SkylineNode, &packer->nodes);
+			NotNull(newNode);
+			newNode->x = left;
+			newNode->y = bestTop;
+			newNode->width = size.Width;
+		}
+		if (nIndex >= bestIndex)
+		{
+			if (node.x + node.width <= right) { continue; }
+			if (node.x < right) { node.width -= right - node.x; node.x = right; }
+		}
+		SkylineNode* lastNode = (packer->nodes.length > 0) ? VarArrayGetLast(SkylineNode, &packer->nodes) : nullptr;
+		if (lastNode != nullptr && lastNode->y == node.y) { lastNode->width += node.width; continue; }
+		SkylineNode* copiedNode = VarArrayAdd(SkylineNode, &packer->nodes);
+		NotNull(copiedNode);
+		*copiedNode = node;
+	}
+	ScratchEnd(scratch);
+	
+	packer->usedArea += (uxx)size.Width * (uxx)size.Height;
+	*positionOut = NewV2i(left, bestY);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                        Texture Atlas                         |
+// +--------------------------------------------------------------+
+#define TEXTURE_ATLAS_PAGE_PIXELS (TEXTURE_ATLAS_PAGE_SIZE * TEXTURE_ATLAS_PAGE_SIZE)
+
+void FreeTextureAtlas(TextureAtlas* atlas)
+{
+	NotNull(atlas);
+	if (atlas->arena != nullptr)
+	{
+		VarArrayLoop(&atlas->pages, pIndex)
+		{
+			VarArrayLoopGet(TextureAtlasPage, page, &atlas->pages, pIndex);
+			for (uxx sIndex = 0; sIndex < TextureAtlasSlot_Count; sIndex++)
+			{
+				if (page->isUploaded) { FreeTexture(&page->textures[sIndex]); }
+				FreeMem(atlas->arena, page->pixels[sIndex], sizeof(u32) * TEXTURE_ATLAS_PAGE_PIXELS);
+			}
+			FreeSkylinePacker(&page->packer);
+		}
+		FreeVarArray(&atlas->pages);
+		FreeVarArray(&atlas->items);
+	}
+	ClearPointer(atlas);
+}
+
+void InitTextureAtlas(Arena* arena, TextureAtlas* atlasOut)
+{
+	NotNull(arena);
+	NotNull(atlasOut);
+	ClearPointer(atlasOut);
+	atlasOut->arena = arena;
+	InitVarArray(TextureAtlasPage, &atlasOut->pages, arena);
+	InitVarArray(TextureAtlasItem, &atlasOut->items, arena);
+}
+
+static TextureAtlasPage* AddTextureAtlasPage(TextureAtlas* atlas)
+{
+	TextureAtlasPage* result = VarArrayAdd(TextureAtlasPage, &atlas->pages);
+	NotNull(result);
+	ClearPointer(result);
+	InitSkylinePacker(atlas->arena, FillV2i(TEXTURE_ATLAS_PAGE_SIZE), &result->packer);
+	for (uxx sIndex = 0; sIndex < TextureAtlasSlot_Count; sIndex++)
+	{
+		result->pixels[sIndex] = AllocArray(u32, atlas->arena, TEXTURE_ATLAS_PAGE_PIXELS);
+		NotNull(result->pixels[sIndex]);
+		MyMemSet(result->pixels[sIndex], 0x00, sizeof(u32) * TEXTURE_ATLAS_PAGE_PIXELS);
+	}
+	return result;
+}
+
+static inline i32 AlignToAtlasGutter(i32 value)
+{
+	return ((value + TEXTURE_ATLAS_GUTTER - 1) / TEXTURE_ATLAS_GUTTER) * TEXTURE_ATLAS_GUTTER;
+}
+
+static void GetMaterialAtlasTextureIndices(const ModelDataMaterial* material, uxx* indicesOut)
+{
+	indicesOut[TextureAtlasSlot_Albedo] = material->albedoTextureIndex;
+	indicesOut[TextureAtlasSlot_Normal] = material->normalTextureIndex;
+	indicesOut[TextureAtlasSlot_MetallicRoughness] = material->metallicRoughnessTextureIndex;
+	indicesOut[TextureAtlasSlot_Occlusion] = material->ambientOcclusionTextureIndex;
+}
+
+// A material can go in the atlas when all of its textures are the same small size and no part using it samples outside [0,1]
+bool IsMaterialAtlasCompatible(const ModelData* modelData, uxx materialIndex, v2i* textureSizeOut)
+{
+	NotNull(modelData);
+	const ModelDataMaterial* material = VarArrayGetHard(ModelDataMaterial, &modelData->materials, materialIndex);
+	uxx textureIndices[TextureAtlasSlot_Count];
+	GetMaterialAtlasTextureIndices(material, &textureIndices[0]);
+	v2i textureSize = V2i_Zero;
+	for (uxx sIndex = 0; sIndex < TextureAtlasSlot_Count; sIndex++)
+	{
+		if (textureIndices[sIndex] >= modelData->textures.length) { continue; }
+		const ModelDataTexture* texture = VarArrayGetHard(ModelDataTexture, &modelData->textures, textureIndices[sIndex]);
+		if (texture->imageData.size.Width <= 0 || texture->imageData.size.Height <= 0) { return false; }
+		if (textureSize.Width == 0) { textureSize = texture->imageData.size; }
+		else if (texture->imageData.size.Width != textureSize.Width || texture->imageData.size.Height != textureSize.Height) { return false; }
+	}
+	if (textureSize.Width == 0) { return false; } //nothing to merge, the material only uses gfx.pixelTexture
+	if (textureSize.Width > TEXTURE_ATLAS_MAX_ITEM_SIZE || textureSize.Height > TEXTURE_ATLAS_MAX_ITEM_SIZE) { return false; }
+	
+	const r32 uvEpsilon = 0.001f;
+	VarArrayLoop(&modelData->parts, pIndex)
+	{
+		VarArrayLoopGet(ModelDataPart, part, &modelData->parts, pIndex);
+		if (part->materialIndex != materialIndex) { continue; }
+		const Vertex3D* vertices = (const Vertex3D*)part->vertices.items;
+		for (uxx vIndex = 0; vIndex < part->vertices.length; vIndex++)
+		{
+			v2 texCoord = vertices[vIndex].texCoord;
+			if (texCoord.X < -uvEpsilon || texCoord.X > 1.0f + uvEpsilon || texCoord.Y < -uvEpsilon || texCoord.Y > 1.0f + uvEpsilon) { return false; }
+		}
+	}
+	
+	if (textureSizeOut != nullptr) { *textureSizeOut = textureSize; }
+	return true;
+}
+
+// Copies the texture into the page with a border of wrapped texels all the way to the edge of the (aligned) item rectangle.
+// Slots the material doesn't have a texture for get filled with fillColor (whatever BindModelMaterial would bind instead)
+static void CopyTextureIntoAtlasPage(u32* pagePixels, v2i itemPos, v2i itemSize, const u32* sourcePixels, v2i sourceSize, u32 fillColor)
+{
+	for (i32 yOffset = 0; yOffset < itemSize.Height; yOffset++)
+	{
+		u32* destRow = &pagePixels[(itemPos.Y + yOffset) * TEXTURE_ATLAS_PAGE_SIZE + itemPos.X];
+		if (sourcePixels == nullptr)
+		{
+			for (i32 xOffset = 0; xOffset < itemSize.Width; xOffset++) { destRow[xOffset] = fillColor; }
+			continue;
+		}
+		i32 sourceY = (((yOffset - TEXTURE_ATLAS_GUTTER) % sourceSize.Height) + sourceSize.Height) % sourceSize.Height;
+		const u32* sourceRow = &sourcePixels[sourceY * sourceSize.Width];
+		for (i32 xOffset = 0; xOffset < itemSize.Width; xOffset++)
+		{
+			i32 sourceX = (((xOffset - TEXTURE_ATLAS_GUTTER) % sourceSize.Width) + sourceSize.Width) % sourceSize.Width;
+			destRow[xOffset] = sourceRow[sourceX];
+		}
+	}
+}
+
+// Packs the material's textures into the first page with room (making a new page if needed).
+// The page isn't uploaded until FlushTextureAtlas so a whole model can be added with one upload per page
+MaterialAtlasEntry AddMaterialToTextureAtlas(TextureAtlas* atlas, const ModelData* modelData, uxx materialIndex)
+{
+	NotNull(atlas);
+	NotNull(atlas->arena);
+	MaterialAtlasEntry result = ZEROED;
+	result.pageIndex = TEXTURE_ATLAS_PAGE_NONE;
+	result.uvTransform = NewV4(1.0f, 1.0f, 0.0f, 0.0f);
+	
+	v2i textureSize = V2i_Zero;
+	if (!IsMaterialAtlasCompatible(modelData, materialIndex, &textureSize)) { return result; }
+	const ModelDataMaterial* material = VarArrayGetHard(ModelDataMaterial, &modelData->materials, materialIndex);
+	uxx textureIndices[TextureAtlasSlot_Count];
+	GetMaterialAtlasTextureIndices(material, &textureIndices[0]);
+	u64 slotHashes[TextureAtlasSlot_Count + 1];
+	for (uxx sIndex = 0; sIndex < TextureAtlasSlot_Count; sIndex++)
+	{
+		const ModelDataTexture* texture = (textureIndices[sIndex] < modelData->textures.length) ? VarArrayGetHard(ModelDataTexture, &modelData->textures, textureIndices[sIndex]) : nullptr;
+		slotHashes[sIndex] = (texture != nullptr) ? HashTexturePixels(texture->imageData.size, texture->imageData.pixels) : 0;
+	}
+	slotHashes[TextureAtlasSlot_Count] = ((u64)(u32)textureSize.Width << 32) | (u64)(u32)textureSize.Height;
+	u64 contentHash = MeowU64From(MeowHash(MeowDefaultSeed, sizeof(slotHashes), &slotHashes[0]), 0);
+	VarArrayLoop(&atlas->items, iIndex)
+	{
+		VarArrayLoopGet(TextureAtlasItem, item, &atlas->items, iIndex);
+		if (item->contentHash == contentHash) { atlas->numMaterialsShared++; return item->entry; }
+	}
+	v2i itemSize = NewV2i(
+		AlignToAtlasGutter(textureSize.Width + TEXTURE_ATLAS_GUTTER*2),
+		AlignToAtlasGutter(textureSize.Height + TEXTURE_ATLAS_GUTTER*2)
+	);
+	
+	TextureAtlasPage* page = nullptr;
+	v2i itemPos = V2i_Zero;
+	VarArrayLoop(&atlas->pages, pIndex)
+	{
+		VarArrayLoopGet(TextureAtlasPage, existingPage, &atlas->pages, pIndex);
+		if (PackSkylineRect(&existingPage->packer, itemSize, &itemPos)) { page = existingPage; result.pageIndex = (u32)pIndex; break; }
+	}
+	if (page == nullptr)
+	{
+		result.pageIndex = (u32)atlas->pages.length;
+		page = AddTextureAtlasPage(atlas);
+		bool packed = PackSkylineRect(&page->packer, itemSize, &itemPos);
+		Assert(packed); //TEXTURE_ATLAS_MAX_ITEM_SIZE plus gutters always fits in an empty page
+	}
+	
+	for (uxx sIndex = 0; sIndex < TextureAtlasSlot_Count; sIndex++)
+	{
+		const u32* sourcePixels = nullptr;
+		if (textureIndices[sIndex] < modelData->textures.length)
+		{
+			sourcePixels = VarArrayGetHard(ModelDataTexture, &modelData->textures, textureIndices[sIndex])->imageData.pixels;
+			atlas->numTexturesMerged++;
+		}
+		CopyTextureIntoAtlasPage(page->pixels[sIndex], itemPos, itemSize, sourcePixels, textureSize, (sIndex == TextureAtlasSlot_Normal) ? FLAT_NORMAL_COLOR : 0xFFFFFFFF);
+	}
+	page->isDirty = true;
+	page->numMaterials++;
+	atlas->numMaterials++;
+	
+	result.uvTransform = NewV4(
+		(r32)textureSize.Width / (r32)TEXTURE_ATLAS_PAGE_SIZE,
+		(r32)textureSize.Height / (r32)TEXTURE_ATLAS_PAGE_SIZE,
+		(r32)(itemPos.X + TEXTURE_ATLAS_GUTTER) / (r32)TEXTURE_ATLAS_PAGE_SIZE,
+		(r32)(itemPos.Y + TEXTURE_ATLAS_GUTTER) / (r32)TEXTURE_ATLAS_PAGE_SIZE
+	);
+	TextureAtlasItem* newItem = VarArrayAdd(TextureAtlasItem, &atlas->items);
+	NotNull(newItem);
+	newItem->contentHash = contentHash;
+	newItem->entry = result;
+	return result;
+}
+
+// (Re)creates the GPU textures of every page that had materials added since the last flush
+void FlushTextureAtlas(TextureAtlas* atlas)
+{
+	NotNull(atlas);
+	VarArrayLoop(&atlas->pages, pIndex)
+	{
+		VarArrayLoopGet(TextureAtlasPage, page, &atlas->pages, pIndex);
+		if (!page->isDirty) { continue; }
+		for (uxx sIndex = 0; sIndex < TextureAtlasSlot_Count; sIndex++)
+		{
+			if (page->isUploaded) { FreeTexture(&page->textures[sIndex]); }
+			ScratchBegin(scratch);
+			Str8 textureName = PrintInArenaStr(scratch, "atlas_page%llu_slot%llu", (u64)pIndex, (u64)sIndex);
+			page->textures[sIndex] = InitTexture(atlas->arena, textureName, FillV2i(TEXTURE_ATLAS_PAGE_SIZE), page->pixels[sIndex], 0x00);
+			Assert(page->textures[sIndex].error == Result_Success);
+			ScratchEnd(scratch);
+		}
+		page->isUploaded = true;
+		page->isDirty = false;
+	}
+}
+
+TextureAtlasPage* GetTextureAtlasPage(TextureAtlas* atlas, u32 pageIndex)
+{
+	NotNull(atlas);
+	return VarArrayGetHard(TextureAtlasPage, &atlas->pages, pageIndex);
+}
+
+r32 GetTextureAtlasFillRatio(const TextureAtlas* atlas)
+{
+	NotNull(atlas);
+	if (atlas->pages.length == 0) { return 0.0f; }
+	uxx usedArea = 0;
+	VarArrayLoop(&atlas->pages, pIndex)
+	{
+		VarArrayLoopGet(TextureAtlasPage, page, &atlas->pages, pIndex);
+		usedArea += page->packer.usedArea;
+	}
+	return (r32)usedArea / (r32)(atlas->pages.length * TEXTURE_ATLAS_PAGE_PIXELS);
+}
@@ -0,0 +1,87 @@
+/*
+File:   app_texture_atlas.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Packs the textures of small materials into shared atlas pages so materials on the same
+	** page draw with the exact same texture bindings. A page has one texture per material slot
+	** (albedo, normal, metallic/roughness, occlusion) and every material gets the same rectangle
+	** in each of them, so a single UV transform (scale + offset) per material is enough.
+	** Rectangles are placed by a skyline bottom-left packer and surrounded by a gutter of wrapped
+	** texels that is aligned so it stays intact down to TEXTURE_ATLAS_SAFE_MIPS mip levels.
+*/
+
+#ifndef _APP_TEXTURE_ATLAS_H
+#define _APP_TEXTURE_ATLAS_H
+
+#define TEXTURE_ATLAS_PAGE_SIZE      1024
+#define TEXTURE_ATLAS_MAX_ITEM_SIZE  256 //materials with textures bigger than this in either dimension keep their own textures
+#define TEXTURE_ATLAS_SAFE_MIPS      3
+#define TEXTURE_ATLAS_GUTTER         (1 << TEXTURE_ATLAS_SAFE_MIPS) //also the alignment of every rectangle
+#define TEXTURE_ATLAS_PAGE_NONE      UINT32_MAX
+
+typedef enum TextureAtlasSlot TextureAtlasSlot;
+enum TextureAtlasSlot
+{
+	TextureAtlasSlot_Albedo = 0,
+	TextureAtlasSlot_Normal,
+	TextureAtlasSlot_MetallicRoughness,
+	TextureAtlasSlot_Occlusion,
+	TextureAtlasSlot_Count,
+};
+
+typedef struct SkylineNode SkylineNode;
+struct SkylineNode
+{
+	i32 x;
+	i32 y; //height of the skyline along [x, x+width)
+	i32 width;
+};
+
+typedef struct SkylinePacker SkylinePacker;
+struct SkylinePacker
+{
+	v2i size;
+	VarArray nodes; //SkylineNode, sorted by x and always covering [0, size.Width)
+	uxx usedArea;
+};
+
+typedef struct TextureAtlasPage TextureAtlasPage;
+struct TextureAtlasPage
+{
+	SkylinePacker packer;
+	u32* pixels[TextureAtlasSlot_Count]; //CPU copy that packing writes into, uploaded by FlushTextureAtlas
+	Texture textures[TextureAtlasSlot_Count];
+	bool isUploaded;
+	bool isDirty;
+	uxx numMaterials;
+};
+
+// Model3D keeps one of these per material
+typedef struct MaterialAtlasEntry MaterialAtlasEntry;
+struct MaterialAtlasEntry
+{
+	u32 pageIndex; //TEXTURE_ATLAS_PAGE_NONE when the material uses its own textures
+	v4 uvTransform; //xy = scale, zw = offset
+};
+
+// Materials whose textures hash the same (like the same model loaded twice) share one rectangle
+typedef struct TextureAtlasItem TextureAtlasItem;
+struct TextureAtlasItem
+{
+	u64 contentHash; //over the HashTexturePixels of every slot and the texture size
+	MaterialAtlasEntry entry;
+};
+
+typedef struct TextureAtlas TextureAtlas;
+struct TextureAtlas
+{
+	Arena* arena;
+	VarArray pages; //TextureAtlasPage
+	VarArray items; //TextureAtlasItem
+	uxx numMaterials;
+	uxx numMaterialsShared; //found an identical item instead of packing a new one
+	uxx numTexturesMerged;
+};
+
+#endif //  _APP_TEXTURE_ATLAS_H
@@ -0,0 +1,149 @@
+/*
+File:   app_texture_cache.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that manage the TextureCache (see app_texture_cache.h)
+*/
+
+u64 HashTexturePixels(v2i size, const u32* pixels)
+{
+	if (pixels == nullptr) { return 0; }
+	meow_u128 hash = MeowHash(MeowDefaultSeed, (meow_umm)size.Width * (meow_umm)size.Height * sizeof(u32), (void*)pixels);
+	return MeowU64From(hash, 0);
+}
+
+void FreeTextureCache(TextureCache* cache)
+{
+	NotNull(cache);
+	if (cache->arena != nullptr)
+	{
+		VarArrayLoop(&cache->entries, eIndex)
+		{
+			VarArrayLoopGet(CachedTexture, entry, &cache->entries, eIndex);
+			if (entry->refCount == 0) { continue; }
+			if (entry->isStreamed) { RemoveStreamedTexture(cache->streamer, entry->streamedId); }
+			else { FreeTexture(&entry->texture); }
+		}
+		FreeVarArray(&cache->entries);
+	}
+	ClearPointer(cache);
+}
+
+void InitTextureCache(Arena* arena, TextureStreamer* streamer, TextureCache* cacheOut)
+{
+	NotNull(arena);
+	NotNull(streamer);
+	NotNull(cacheOut);
+	ClearPointer(cacheOut);
+	cacheOut->arena = arena;
+	cacheOut->streamer = streamer;
+	InitVarArray(CachedTexture, &cacheOut->entries, arena);
+}
+
+static CachedTexture* GetCachedTextureEntry(TextureCache* cache, TextureHandle handle)
+{
+	if (handle.generation == 0 || handle.index >= cache->entries.length) { return nullptr; }
+	CachedTexture* entry = VarArrayGetHard(CachedTexture, &cache->entries, handle.index);
+	return (entry->refCount > 0 && entry->generation == handle.generation) ? entry : nullptr;
+}
+
+bool IsTextureHandleValid(TextureCache* cache, TextureHandle handle)
+{
+	NotNull(cache);
+	return (GetCachedTextureEntry(cache, handle) != nullptr);
+}
+
+// Returns a handle to the texture with these exact pixels, creating it if nobody holds one yet. Every acquire
+// needs a matching ReleaseCachedTexture. isStreamed textures go through the TextureStreamer (and are only as
+// sharp as the last requests made them), the others are uploaded once at full resolution.
+// isSrgb only changes how the TextureStreamer averages mips. The GPU texture is plain RGBA8 either way (InitTexture
+// has no sRGB format, the pbr shader decodes albedo itself) so it's ignored for textures that aren't streamed.
+// NOTE: Acquiring only happens at load time so a linear scan over the hashes is plenty
+TextureHandle AcquireCachedTexture(TextureCache* cache, Str8 name, v2i size, const u32* pixels, u8 textureFlags, bool isSrgb, bool isStreamed)
+{
+	NotNull(cache);
+	NotNull(cache->arena);
+	NotNull(pixels);
+	if (!isStreamed) { isSrgb = false; }
+	u64 contentHash = HashTexturePixels(size, pixels);
+	uxx freeIndex = cache->entries.length;
+	VarArrayLoop(&cache->entries, eIndex)
+	{
+		VarArrayLoopGet(CachedTexture, entry, &cache->entries, eIndex);
+		if (entry->refCount == 0) { if (freeIndex == cache->entries.length) { freeIndex = eIndex; } continue; }
+		if (entry->contentHash != contentHash || entry->size.Width != size.Width || entry->size.Height != size.Height) { continue; }
+		if (entry->textureFlags != textureFlags || entry->isSrgb != isSrgb || entry->isStreamed != isStreamed) { continue; }
+		entry->refCount++;
+		cache->numHits++;
+		cache->savedBytes += (uxx)size.Width * (uxx)size.Height * sizeof(u32);
+		TextureHandle result = { .index = (u32)eIndex, .generation = entry->generation };
+		return result;
+	}
+	
+	CachedTexture* entry = nullptr;
+	if (freeIndex < cache->entries.length) { entry = VarArrayGetHard(CachedTexture, &cache->entries, freeIndex); }
+	else
+	{
+		entry = VarArrayAdd(CachedTexture, &cache->entries);
+		NotNull(entry);
+		ClearPointer(entry);
+	}
+	u32 generation = entry->generation + 1;
+	if (generation == 0) { generation = 1; }
+	ClearPointer(entry);
+	entry->contentHash = contentHash;
+	entry->size = size;
+	entry->textureFlags = textureFlags;
+	entry->isSrgb = isSrgb;
+	entry->isStreamed = isStreamed;
+	entry->refCount = 1;
+	entry->generation = generation;
+	entry->streamedId = TEXTURE_STREAM_ID_INVALID;
+	if (isStreamed) { entry->streamedId = AddStreamedTexture(cache->streamer, name, size, pixels, textureFlags, isSrgb); }
+	else { entry->texture = InitTexture(cache->arena, name, size, pixels, textureFlags); }
+	cache->numTextures++;
+	TextureHandle result = { .index = (u32)freeIndex, .generation = generation };
+	return result;
+}
+
+// For handing a texture that's already held to another owner
+TextureHandle AddCachedTextureRef(TextureCache* cache, TextureHandle handle)
+{
+	NotNull(cache);
+	CachedTexture* entry = GetCachedTextureEntry(cache, handle);
+	if (entry != nullptr) { entry->refCount++; }
+	return handle;
+}
+
+// Frees the GPU texture when the last reference goes away. Releasing an invalid (or already released) handle does nothing
+void ReleaseCachedTexture(TextureCache* cache, TextureHandle* handle)
+{
+	NotNull(cache);
+	NotNull(handle);
+	CachedTexture* entry = GetCachedTextureEntry(cache, *handle);
+	ClearPointer(handle);
+	if (entry == nullptr) { return; }
+	entry->refCount--;
+	if (entry->refCount > 0) { return; }
+	if (entry->isStreamed) { RemoveStreamedTexture(cache->streamer, entry->streamedId); }
+	else { FreeTexture(&entry->texture); }
+	entry->streamedId = TEXTURE_STREAM_ID_INVALID;
+	cache->numTextures--;
+}
+
+// nullptr for an invalid handle. Streamed textures return whatever mip is resident right now
+Texture* GetCachedTexture(TextureCache* cache, TextureHandle handle)
+{
+	NotNull(cache);
+	CachedTexture* entry = GetCachedTextureEntry(cache, handle);
+	if (entry == nullptr) { return nullptr; }
+	return entry->isStreamed ? &GetStreamedTexture(cache->streamer, entry->streamedId)->texture : &entry->texture;
+}
+
+u32 GetCachedTextureStreamId(TextureCache* cache, TextureHandle handle)
+{
+	NotNull(cache);
+	CachedTexture* entry = GetCachedTextureEntry(cache, handle);
+	return (entry != nullptr) ? entry->streamedId : TEXTURE_STREAM_ID_INVALID;
+}
@@ -0,0 +1,48 @@
+/*
+File:   app_texture_cache.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** The TextureCache hands out refcounted TextureHandles for every model and UI texture so
+	** identical images only ever exist once on the GPU. Textures are keyed by a MeowHash of their
+	** pixels (plus size, flags and color space), acquiring a texture that's already in the cache just
+	** bumps its refCount. Model textures are backed by a StreamedTexture in the TextureStreamer, UI
+	** textures (that always need their full resolution) by a plain Texture.
+*/
+
+#ifndef _APP_TEXTURE_CACHE_H
+#define _APP_TEXTURE_CACHE_H
+
+typedef struct TextureHandle TextureHandle;
+struct TextureHandle
+{
+	u32 index; //into TextureCache->entries
+	u32 generation; //0 is never a live generation so a zeroed handle is invalid
+};
+
+typedef struct CachedTexture CachedTexture;
+struct CachedTexture
+{
+	u64 contentHash;
+	v2i size;
+	u8 textureFlags;
+	bool isSrgb; //only when isStreamed, picks linear mip averaging in the TextureStreamer
+	bool isStreamed;
+	u32 refCount; //0 when the slot is free
+	u32 generation; //bumped every time the slot is freed so stale handles can be caught
+	u32 streamedId; //when isStreamed, TEXTURE_STREAM_ID_INVALID otherwise
+	Texture texture; //when !isStreamed
+};
+
+typedef struct TextureCache TextureCache;
+struct TextureCache
+{
+	Arena* arena;
+	TextureStreamer* streamer;
+	VarArray entries; //CachedTexture
+	uxx numTextures; //live entries
+	uxx numHits; //acquires that found the texture already in the cache
+	uxx savedBytes; //full resolution bytes that weren't stored again because of a hit
+};
+
+#endif //  _APP_TEXTURE_CACHE_H
@@ -0,0 +1,321 @@
+/*
+File:   app_texture_streaming.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the functions that manage the TextureStreamer (see app_texture_streaming.h)
+	** NOTE: Mips are generated on the CPU with a 2x2 box filter when the texture is added, each level's
+	** rows are split across the JobSystem. The per-frame work is limited to TEXTURE_STREAM_MAX_UPLOADS_PER_FRAME
+	** texture creations.
+*/
+
+static inline uxx GetStreamedTextureMipBytes(const StreamedTexture* texture, uxx mipIndex)
+{
+	return (uxx)texture->mips[mipIndex].size.Width * (uxx)texture->mips[mipIndex].size.Height * sizeof(u32);
+}
+
+void FreeTextureStreamer(TextureStreamer* streamer)
+{
+	NotNull(streamer);
+	if (streamer->arena != nullptr)
+	{
+		VarArrayLoop(&streamer->textures, tIndex)
+		{
+			VarArrayLoopGet(StreamedTexture, texture, &streamer->textures, tIndex);
+			if (texture->numMips == 0) { continue; } //removed
+			if (!streamer->headless) { FreeTexture(&texture->texture); }
+			for (uxx mIndex = 0; mIndex < texture->numMips; mIndex++)
+			{
+				FreeMem(streamer->arena, texture->mips[mIndex].pixels, GetStreamedTextureMipBytes(texture, mIndex));
+			}
+			FreeStr8(streamer->arena, &texture->name);
+		}
+		FreeVarArray(&streamer->textures);
+	}
+	ClearPointer(streamer);
+}
+
+// jobs may be nullptr (mips are then generated on the calling thread), otherwise it has to outlive the streamer
+void InitTextureStreamer(Arena* arena, JobSystem* jobs, uxx budgetBytes, bool headless, TextureStreamer* streamerOut)
+{
+	NotNull(arena);
+	NotNull(streamerOut);
+	ClearPointer(streamerOut);
+	streamerOut->arena = arena;
+	streamerOut->jobs = jobs;
+	streamerOut->headless = headless;
+	streamerOut->budgetBytes = budgetBytes;
+	for (uxx vIndex = 0; vIndex < 256; vIndex++) { streamerOut->srgbToLinearTable[vIndex] = SrgbToLinearR32((r32)vIndex / 255.0f); }
+	InitVarArray(StreamedTexture, &streamerOut->textures, arena);
+}
+
+StreamedTexture* GetStreamedTexture(TextureStreamer* streamer, u32 textureId)
+{
+	NotNull(streamer);
+	return VarArrayGetHard(StreamedTexture, &streamer->textures, textureId);
+}
+
+static void SetStreamedTextureResidency(TextureStreamer* streamer, StreamedTexture* texture, uxx mipIndex)
+{
+	Assert(mipIndex < texture->numMips);
+	if (!streamer->headless)
+	{
+		if (texture->residentBytes > 0) { FreeTexture(&texture->texture); }
+		texture->texture = InitTexture(streamer->arena, texture->name, texture->mips[mipIndex].size, texture->mips[mipIndex].pixels, texture->textureFlags);
+		Assert(texture->texture.error == Result_Success);
+	}
+	streamer->residentBytes -= texture->residentBytes;
+	texture->residentMip = mipIndex;
+	texture->residentBytes = GetStreamedTextureMipBytes(texture, mipIndex);
+	streamer->residentBytes += texture->residentBytes;
+}
+
+// 2x2 box filter of RGBA8 texels. sRGB color channels are averaged in linear space so darker texels don't
+// dominate (averaging the encoded values darkens every mip), alpha and non-color textures are averaged directly
+static u32 AverageTexels(const u32* samples, const r32* srgbToLinearTable)
+{
+	u32 result = 0;
+	for (u32 shift = 0; shift < 32; shift += 8)
+	{
+		if (srgbToLinearTable != nullptr && shift < 24)
+		{
+			r32 linearSum = 0.0f;
+			for (uxx sIndex = 0; sIndex < 4; sIndex++) { linearSum += srgbToLinearTable[(samples[sIndex] >> shift) & 0xFF]; }
+			result |= ((u32)RoundR32i(LinearToSrgbR32(linearSum / 4.0f) * 255.0f) & 0xFF) << shift;
+		}
+		else
+		{
+			u32 channelSum = 2; //rounds to nearest
+			for (uxx sIndex = 0; sIndex < 4; sIndex++) { channelSum += (samples[sIndex] >> shift) & 0xFF; }
+			result |= ((channelSum / 4) << shift);
+		}
+	}
+	return result;
+}
+
+typedef struct StreamedMipJobs StreamedMipJobs;
+struct StreamedMipJobs
+{
+	const StreamedTextureMip* prevMip;
+	StreamedTextureMip* mip;
+	const r32* srgbToLinearTable; //nullptr for non-color textures
+	uxx numJobs;
+};
+
+// Every job fills its own band of rows in the new mip and only reads the previous one
+static JOB_FUNC_DEF(GenerateStreamedMipRowsJob)
+{
+	StreamedMipJobs* context = (StreamedMipJobs*)userPntr;
+	const StreamedTextureMip* prevMip = context->prevMip;
+	StreamedTextureMip* mip = context->mip;
+	i32 rowStart = (i32)(((uxx)mip->size.Height * jobIndex) / context->numJobs);
+	i32 rowEnd = (i32)(((uxx)mip->size.Height * (jobIndex+1)) / context->numJobs);
+	for (i32 yIndex = rowStart; yIndex < rowEnd; yIndex++)
+	{
+		i32 prevY0 = MinI32(yIndex*2, prevMip->size.Height-1);
+		i32 prevY1 = MinI32(yIndex*2 + 1, prevMip->size.Height-1);
+		for (i32 xIndex = 0; xIndex < mip->size.Width; xIndex++)
+		{
+			i32 prevX0 = MinI32(xIndex*2, prevMip->size.Width-1);
+			i32 prevX1 = MinI32(xIndex*2 + 1, prevMip->size.Width-1);
+			u32 samples[4] = {
+				prevMip->pixels[prevY0 * prevMip->size.Width + prevX0],
+				prevMip->pixels[prevY0 * prevMip->size.Width + prevX1],
+				prevMip->pixels[prevY1 * prevMip->size.Width + prevX0],
+				prevMip->pixels[prevY1 * prevMip->size.Width + prevX1],
+			};
+			mip->pixels[yIndex * mip->size.Width + xIndex] = AverageTexels(&samples[0], context->srgbToLinearTable);
+		}
+	}
+}
+
+// Copies the pixels, builds the full mip chain and makes the smallest streamed mip resident right away.
+// The smallest mip is allowed to go over the budget since there'd be nothing to draw with otherwise
+u32 AddStreamedTexture(TextureStreamer* streamer, Str8 name, v2i size, const u32* pixels, u8 textureFlags, bool isSrgb)
+{
+	NotNull(streamer);
+	NotNull(pixels);
+	Assert(size.Width > 0 && size.Height > 0);
+	//Removed textures leave a zeroed slot behind (ids have to stay stable), the first one is reused
+	u32 result = (u32)streamer->textures.length;
+	VarArrayLoop(&streamer->textures, tIndex)
+	{
+		if (VarArrayGetHard(StreamedTexture, &streamer->textures, tIndex)->numMips == 0) { result = (u32)tIndex; break; }
+	}
+	StreamedTexture* texture = (result < streamer->textures.length) ? GetStreamedTexture(streamer, result) : VarArrayAdd(StreamedTexture, &streamer->textures);
+	NotNull(texture);
+	ClearPointer(texture);
+	texture->name = AllocStr8(streamer->arena, name);
+	texture->textureFlags = textureFlags;
+	texture->isSrgb = isSrgb;
+	
+	texture->mips[0].size = size;
+	texture->mips[0].pixels = AllocArray(u32, streamer->arena, (uxx)size.Width * (uxx)size.Height);
+	NotNull(texture->mips[0].pixels);
+	MyMemCopy(texture->mips[0].pixels, pixels, GetStreamedTextureMipBytes(texture, 0));
+	texture->numMips = 1;
+	while (texture->numMips < TEXTURE_STREAM_MAX_MIPS)
+	{
+		const StreamedTextureMip* prevMip = &texture->mips[texture->numMips-1];
+		if (prevMip->size.Width <= 1 && prevMip->size.Height <= 1) { break; }
+		StreamedTextureMip* mip = &texture->mips[texture->numMips];
+		mip->size = NewV2i(MaxI32(prevMip->size.Width / 2, 1), MaxI32(prevMip->size.Height / 2, 1));
+		mip->pixels = AllocArray(u32, streamer->arena, (uxx)mip->size.Width * (uxx)mip->size.Height);
+		NotNull(mip->pixels);
+		StreamedMipJobs context = ZEROED;
+		context.prevMip = prevMip;
+		context.mip = mip;
+		context.srgbToLinearTable = isSrgb ? &streamer->srgbToLinearTable[0] : nullptr;
+		context.numJobs = GetNumJobsForItems(streamer->jobs, (uxx)mip->size.Height, TEXTURE_STREAM_MIP_ROWS_PER_JOB);
+		RunJobs(streamer->jobs, context.numJobs, GenerateStreamedMipRowsJob, &context);
+		texture->numMips++;
+	}
+	
+	texture->lowestMip = texture->numMips-1;
+	for (uxx mIndex = 0; mIndex < texture->numMips; mIndex++)
+	{
+		if (texture->mips[mIndex].size.Width <= TEXTURE_STREAM_MIN_RESIDENT_SIZE && texture->mips[mIndex].size.Height <= TEXTURE_STREAM_MIN_RESIDENT_SIZE) { texture->lowestMip = mIndex; break; }
+	}
+	texture->requestedMip = texture->lowestMip;
+	texture->lastRequestFrame = streamer->frameIndex;
+	SetStreamedTextureResidency(streamer, texture, texture->lowestMip);
+	return result;
+}
+
+// Frees the texture's mips (and GPU texture) and leaves an empty slot that AddStreamedTexture will reuse.
+// An empty slot has every mip index at 0 so the residency loops in UpdateTextureStreamer never touch it
+void RemoveStreamedTexture(TextureStreamer* streamer, u32 textureId)
+{
+	NotNull(streamer);
+	StreamedTexture* texture = GetStreamedTexture(streamer, textureId);
+	if (texture->numMips == 0) { return; }
+	if (!streamer->headless && texture->residentBytes > 0) { FreeTexture(&texture->texture); }
+	Assert(streamer->residentBytes >= texture->residentBytes);
+	streamer->residentBytes -= texture->residentBytes;
+	for (uxx mIndex = 0; mIndex < texture->numMips; mIndex++)
+	{
+		FreeMem(streamer->arena, texture->mips[mIndex].pixels, GetStreamedTextureMipBytes(texture, mIndex));
+	}
+	FreeStr8(streamer->arena, &texture->name);
+	ClearPointer(texture);
+}
+
+// The mip whose texels are closest to 1:1 with screen pixels when the whole texture is spread across screenPixels
+uxx CalcStreamedTextureMip(const StreamedTexture* texture, r32 screenPixels)
+{
+	r32 texelsPerPixel = (r32)MaxI32(texture->mips[0].size.Width, texture->mips[0].size.Height) / MaxR32(screenPixels, 1.0f);
+	uxx mipIndex = 0;
+	while (texelsPerPixel >= 2.0f && mipIndex < texture->lowestMip) { texelsPerPixel /= 2.0f; mipIndex++; }
+	return mipIndex;
+}
+
+void RequestStreamedTextureMip(TextureStreamer* streamer, u32 textureId, uxx mipIndex)
+{
+	StreamedTexture* texture = GetStreamedTexture(streamer, textureId);
+	if (mipIndex < texture->requestedMip) { texture->requestedMip = mipIndex; }
+	texture->lastRequestFrame = streamer->frameIndex;
+}
+
+// NOTE: This assumes the model's UVs cover each texture about once, which is true for the glTF models we have
+void RequestModelTextures(TextureStreamer* streamer, const Model3D* model, r32 screenPixels)
+{
+	NotNull(streamer);
+	NotNull(model);
+	VarArrayLoop(&model->data.materials, mIndex)
+	{
+		VarArrayLoopGet(ModelDataMaterial, material, &model->data.materials, mIndex);
+		uxx textureIndices[] = { material->albedoTextureIndex, material->normalTextureIndex, material->metallicRoughnessTextureIndex, material->ambientOcclusionTextureIndex };
+		for (uxx tIndex = 0; tIndex < ArrayCount(textureIndices); tIndex++)
+		{
+			if (textureIndices[tIndex] >= model->textureIds.length) { continue; }
+			u32 textureId = *VarArrayGetHard(u32, &model->textureIds, textureIndices[tIndex]);
+			if (textureId == TEXTURE_STREAM_ID_INVALID) { continue; }
+			RequestStreamedTextureMip(streamer, textureId, CalcStreamedTextureMip(GetStreamedTexture(streamer, textureId), screenPixels));
+		}
+	}
+}
+
+// Drops the least recently requested textures that are sharper than they currently need to be until neededBytes
+// more will fit in the budget. Returns false if that's not possible even after dropping everything it could
+static bool MakeRoomInTextureStreamer(TextureStreamer* streamer, uxx neededBytes, u32 exceptTextureId)
+{
+	while (streamer->residentBytes + neededBytes > streamer->budgetBytes)
+	{
+		StreamedTexture* victim = nullptr;
+		VarArrayLoop(&streamer->textures, tIndex)
+		{
+			VarArrayLoopGet(StreamedTexture, texture, &streamer->textures, tIndex);
+			if ((u32)tIndex == exceptTextureId || texture->residentMip >= texture->requestedMip) { continue; }
+			if (victim == nullptr || texture->lastRequestFrame < victim->lastRequestFrame) { victim = texture; }
+		}
+		if (victim == nullptr) { return false; }
+		SetStreamedTextureResidency(streamer, victim, victim->requestedMip);
+		streamer->numEvictions++;
+	}
+	return true;
+}
+
+void SetTextureStreamerBudget(TextureStreamer* streamer, uxx budgetBytes)
+{
+	NotNull(streamer);
+	streamer->budgetBytes = budgetBytes;
+	MakeRoomInTextureStreamer(streamer, 0, TEXTURE_STREAM_ID_INVALID);
+}
+
+// Call once per frame after culling has made its requests and before drawing. Textures move one mip sharper
+// per upload so a texture that suddenly fills the screen streams in over a few frames instead of stalling one
+void UpdateTextureStreamer(TextureStreamer* streamer)
+{
+	NotNull(streamer);
+	ScratchBegin1(scratch, streamer->arena);
+	
+	VarArrayLoop(&streamer->textures, tIndex)
+	{
+		VarArrayLoopGet(StreamedTexture, texture, &streamer->textures, tIndex);
+		if (texture->residentMip < texture->lowestMip && streamer->frameIndex - texture->lastRequestFrame > TEXTURE_STREAM_EVICT_AFTER_FRAMES)
+		{
+			SetStreamedTextureResidency(streamer, texture, texture->lowestMip);
+			streamer->numEvictions++;
+		}
+	}
+	
+	u32* pendingIds = AllocArray(u32, scratch, streamer->textures.length + 1);
+	NotNull(pendingIds);
+	uxx numPending = 0;
+	VarArrayLoop(&streamer->textures, tIndex)
+	{
+		VarArrayLoopGet(StreamedTexture, texture, &streamer->textures, tIndex);
+		if (texture->requestedMip < texture->residentMip) { pendingIds[numPending++] = (u32)tIndex; }
+	}
+	streamer->numPendingRequests = numPending;
+	
+	// Most blurry relative to what was asked for goes first. Pending lists are short so a selection pass is fine
+	for (uxx uIndex = 0; uIndex < TEXTURE_STREAM_MAX_UPLOADS_PER_FRAME && uIndex < numPending; uIndex++)
+	{
+		uxx bestIndex = uIndex;
+		for (uxx pIndex = uIndex+1; pIndex < numPending; pIndex++)
+		{
+			const StreamedTexture* candidate = GetStreamedTexture(streamer, pendingIds[pIndex]);
+			const StreamedTexture* best = GetStreamedTexture(streamer, pendingIds[bestIndex]);
+			if (candidate->residentMip - candidate->requestedMip > best->residentMip - best->requestedMip) { bestIndex = pIndex; }
+		}
+		u32 textureId = pendingIds[bestIndex];
+		pendingIds[bestIndex] = pendingIds[uIndex];
+		pendingIds[uIndex] = textureId;
+		
+		StreamedTexture* texture = GetStreamedTexture(streamer, textureId);
+		uxx targetMip = texture->residentMip - 1;
+		uxx extraBytes = GetStreamedTextureMipBytes(texture, targetMip) - texture->residentBytes;
+		if (!MakeRoomInTextureStreamer(streamer, extraBytes, textureId)) { streamer->numDeniedUploads++; continue; }
+		SetStreamedTextureResidency(streamer, texture, targetMip);
+		streamer->numUploads++;
+	}
+	
+	VarArrayLoop(&streamer->textures, tIndex)
+	{
+		VarArrayLoopGet(StreamedTexture, texture, &streamer->textures, tIndex);
+		texture->requestedMip = texture->lowestMip;
+	}
+	streamer->frameIndex++;
+	ScratchEnd(scratch);
+}
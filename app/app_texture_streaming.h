@@ -0,0 +1,71 @@
+/*
+File:   app_texture_streaming.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** The TextureStreamer owns every model texture and decides how much of each one's mip chain
+	** is on the GPU. Every texture starts with only its small mips resident. Culling asks for
+	** sharper mips based on how many texels land on each pixel, and once per frame the streamer
+	** uploads the most urgent requests while keeping the total GPU memory under a budget by
+	** dropping least recently used textures back down to their smallest mip.
+	** The GPU only ever holds one Texture per StreamedTexture, sized to the sharpest resident
+	** mip, so "uploading mip N" means replacing that Texture with one built from CPU mip N.
+	** Scope: this streams between CPU memory and the GPU only. Every mip is generated when the
+	** texture is added (split across the JobSystem) and stays in CPU memory, nothing is paged in
+	** from disk, and the resident "range" is that single level rather than a GPU mip chain (the
+	** requested mip is already the one closest to 1:1 texels per pixel, see CalcStreamedTextureMip).
+*/
+
+#ifndef _APP_TEXTURE_STREAMING_H
+#define _APP_TEXTURE_STREAMING_H
+
+#define TEXTURE_STREAM_MAX_MIPS              16
+#define TEXTURE_STREAM_MIN_RESIDENT_SIZE     32 //the largest mip at or below this size (in both dimensions) is always resident
+#define TEXTURE_STREAM_DEFAULT_BUDGET        Megabytes(64)
+#define TEXTURE_STREAM_MAX_UPLOADS_PER_FRAME 2
+#define TEXTURE_STREAM_EVICT_AFTER_FRAMES    60 //textures that haven't been requested for this long are the first to go when over budget
+#define TEXTURE_STREAM_ID_INVALID            UINT32_MAX
+#define TEXTURE_STREAM_MIP_ROWS_PER_JOB      32
+
+typedef struct StreamedTextureMip StreamedTextureMip;
+struct StreamedTextureMip
+{
+	v2i size;
+	u32* pixels;
+};
+
+typedef struct StreamedTexture StreamedTexture;
+struct StreamedTexture
+{
+	Str8 name;
+	u8 textureFlags;
+	bool isSrgb; //color data, mips are averaged in linear space. The GPU texture is still plain RGBA8, the pbr shader decodes it
+	uxx numMips;
+	StreamedTextureMip mips[TEXTURE_STREAM_MAX_MIPS]; //[0] is full resolution, all kept on the CPU
+	uxx lowestMip; //the mip that never gets evicted
+	uxx residentMip; //sharpest mip currently on the GPU
+	uxx requestedMip; //sharpest mip requested since the last UpdateTextureStreamer, lowestMip when nothing asked
+	u64 lastRequestFrame;
+	Texture texture; //invalid when the streamer is headless
+	uxx residentBytes;
+};
+
+typedef struct TextureStreamer TextureStreamer;
+struct TextureStreamer
+{
+	Arena* arena;
+	JobSystem* jobs; //mips are generated on this, may be nullptr
+	bool headless; //only track sizes and residency, never create GPU textures (for testing the budget logic)
+	r32 srgbToLinearTable[256];
+	VarArray textures; //StreamedTexture
+	uxx budgetBytes;
+	uxx residentBytes;
+	u64 frameIndex;
+	
+	uxx numPendingRequests; //textures wanting a sharper mip after the last update
+	uxx numUploads;
+	uxx numEvictions;
+	uxx numDeniedUploads; //uploads that couldn't fit in the budget even after evicting
+};
+
+#endif //  _APP_TEXTURE_STREAMING_H
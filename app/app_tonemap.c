@@ -0,0 +1,298 @@
+/*
+File:   app_tonemap.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the CPU reference tonemappers, the luminance histogram and the auto-exposure update (see app_tonemap.h)
+	** NOTE: The live histogram is a CPU estimate, not a reduction of the rendered HDR frame (see app_tonemap.h).
+	** AccumulateLuminanceHistogram is what a real per-pixel pass would do and is only used by the tests for now
+*/
+
+const char* GetTonemapperStr(Tonemapper enumValue)
+{
+	switch (enumValue)
+	{
+		case Tonemapper_None:     return "None";
+		case Tonemapper_Reinhard: return "Reinhard";
+		case Tonemapper_Aces:     return "ACES";
+		case Tonemapper_AgX:      return "AgX";
+		default: return "Unknown";
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                    CPU Reference Tonemap                     |
+// +--------------------------------------------------------------+
+// Rec.709 weights, same as GetLuminance in pbr_shader.glsl
+r32 GetLinearLuminance(v3 color)
+{
+	return color.X * 0.2126f + color.Y * 0.7152f + color.Z * 0.0722f;
+}
+
+r32 LinearToSrgbR32(r32 value)
+{
+	if (value <= 0.0f) { return 0.0f; }
+	if (value < 0.0031308f) { return value * 12.92f; }
+	return 1.055f * powf(value, 1.0f/2.4f) - 0.055f;
+}
+r32 SrgbToLinearR32(r32 value)
+{
+	if (value <= 0.0f) { return 0.0f; }
+	if (value < 0.04045f) { return value / 12.92f; }
+	return powf((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static inline r32 TonemapReinhardR32(r32 value)
+{
+	return value / (1.0f + value);
+}
+
+// Krzysztof Narkowicz's fit of the ACES RRT+ODT, the 0.6 brings the fit's exposure in line with the other tonemappers
+static inline r32 TonemapAcesR32(r32 value)
+{
+	value *= 0.6f;
+	return ClampR32((value * (2.51f * value + 0.03f)) / (value * (2.43f * value + 0.59f) + 0.14f), 0.0f, 1.0f);
+}
+
+// Minimal AgX with the default look: inset matrix, log2 encode, 6th order sigmoid fit, outset matrix and back to linear
+static v3 TonemapAgX(v3 color)
+{
+	const r32 minEv = -12.47393f;
+	const r32 maxEv = 4.026069f;
+	v3 inset = NewV3(
+		0.842479062253094f * color.X + 0.0784335999999992f * color.Y + 0.0792237451477643f * color.Z,
+		0.0423282422610123f * color.X + 0.878468636469772f * color.Y + 0.0791661274605434f * color.Z,
+		0.0423756549057051f * color.X + 0.0784336f * color.Y + 0.879142973793104f * color.Z
+	);
+	r32 channels[3] = { inset.X, inset.Y, inset.Z };
+	for (uxx cIndex = 0; cIndex < 3; cIndex++)
+	{
+		r32 encoded = (ClampR32(log2f(MaxR32(channels[cIndex], 1e-10f)), minEv, maxEv) - minEv) / (maxEv - minEv);
+		r32 x2 = encoded * encoded;
+		r32 x4 = x2 * x2;
+		channels[cIndex] = 15.5f*x4*x2 - 40.14f*x4*encoded + 31.96f*x4 - 6.868f*x2*encoded + 0.4298f*x2 + 0.1191f*encoded - 0.00232f;
+	}
+	v3 outset = NewV3(
+		1.19687900512017f * channels[0] + -0.0980208811401368f * channels[1] + -0.0990297440797205f * channels[2],
+		-0.0528968517574562f * channels[0] + 1.15190312990417f * channels[1] + -0.0989611768448433f * channels[2],
+		-0.0529716355144438f * channels[0] + -0.0980434501171241f * channels[1] + 1.15107367264116f * channels[2]
+	);
+	return NewV3(
+		powf(ClampR32(outset.X, 0.0f, 1.0f), 2.2f),
+		powf(ClampR32(outset.Y, 0.0f, 1.0f), 2.2f),
+		powf(ClampR32(outset.Z, 0.0f, 1.0f), 2.2f)
+	);
+}
+
+// Linear HDR in, linear [0,1] display color out (before the sRGB encode)
+v3 ApplyTonemap(Tonemapper tonemapper, v3 color)
+{
+	switch (tonemapper)
+	{
+		case Tonemapper_Reinhard: return NewV3(TonemapReinhardR32(color.X), TonemapReinhardR32(color.Y), TonemapReinhardR32(color.Z));
+		case Tonemapper_Aces: return NewV3(TonemapAcesR32(color.X), TonemapAcesR32(color.Y), TonemapAcesR32(color.Z));
+		case Tonemapper_AgX: return TonemapAgX(color);
+		default: return NewV3(ClampR32(color.X, 0.0f, 1.0f), ClampR32(color.Y, 0.0f, 1.0f), ClampR32(color.Z, 0.0f, 1.0f));
+	}
+}
+
+// Everything the end of the pbr shader does: exposure, tonemap and sRGB encode
+v3 HdrToDisplay(Tonemapper tonemapper, r32 exposure, v3 hdrColor)
+{
+	v3 display = ApplyTonemap(tonemapper, Mul(hdrColor, exposure));
+	return NewV3(LinearToSrgbR32(display.X), LinearToSrgbR32(display.Y), LinearToSrgbR32(display.Z));
+}
+
+r32 GetColor32LinearLuminance(Color32 color)
+{
+	return GetLinearLuminance(NewV3(SrgbToLinearR32(color.r / 255.0f), SrgbToLinearR32(color.g / 255.0f), SrgbToLinearR32(color.b / 255.0f)));
+}
+
+// Color32 constants are picked as sRGB but the pbr shader wants linear tints. 8 bits of linear loses some precision in
+// very dark colors, which is fine for the debug colors this is used on
+Color32 ToLinearColor32(Color32 color)
+{
+	return NewColor(
+		(u8)RoundR32i(SrgbToLinearR32(color.r / 255.0f) * 255.0f),
+		(u8)RoundR32i(SrgbToLinearR32(color.g / 255.0f) * 255.0f),
+		(u8)RoundR32i(SrgbToLinearR32(color.b / 255.0f) * 255.0f),
+		color.a
+	);
+}
+
+// Average linear luminance of an sRGB RGBA8 image, sampled on a sparse grid since it only feeds exposure estimates
+r32 GetAverageImageLuminance(v2i size, const u32* pixels)
+{
+	NotNull(pixels);
+	const i32 numSamplesPerAxis = 64;
+	i32 stepX = (size.Width > numSamplesPerAxis) ? (size.Width / numSamplesPerAxis) : 1;
+	i32 stepY = (size.Height > numSamplesPerAxis) ? (size.Height / numSamplesPerAxis) : 1;
+	r32 sum = 0.0f;
+	uxx numSamples = 0;
+	for (i32 yIndex = 0; yIndex < size.Height; yIndex += stepY)
+	{
+		for (i32 xIndex = 0; xIndex < size.Width; xIndex += stepX)
+		{
+			const u8* pixel = (const u8*)&pixels[yIndex * size.Width + xIndex]; //bytes are R, G, B, A
+			sum += GetLinearLuminance(NewV3(SrgbToLinearR32(pixel[0] / 255.0f), SrgbToLinearR32(pixel[1] / 255.0f), SrgbToLinearR32(pixel[2] / 255.0f)));
+			numSamples++;
+		}
+	}
+	return (numSamples > 0) ? (sum / (r32)numSamples) : 0.0f;
+}
+
+// +--------------------------------------------------------------+
+// |                     Luminance Histogram                      |
+// +--------------------------------------------------------------+
+void ClearLuminanceHistogram(LuminanceHistogram* histogram)
+{
+	NotNull(histogram);
+	ClearPointer(histogram);
+}
+
+static inline uxx GetLuminanceHistogramBin(r32 luminance)
+{
+	if (luminance <= 0.0f) { return 0; }
+	r32 normalized = (log2f(luminance) - LUMINANCE_HISTOGRAM_MIN_LOG2) / (LUMINANCE_HISTOGRAM_MAX_LOG2 - LUMINANCE_HISTOGRAM_MIN_LOG2);
+	if (normalized <= 0.0f) { return 0; }
+	if (normalized >= 1.0f) { return LUMINANCE_HISTOGRAM_BINS-1; }
+	return (uxx)(normalized * LUMINANCE_HISTOGRAM_BINS);
+}
+static inline r32 GetLuminanceHistogramBinCenterLog2(uxx binIndex)
+{
+	return LUMINANCE_HISTOGRAM_MIN_LOG2 + ((r32)binIndex + 0.5f) * ((LUMINANCE_HISTOGRAM_MAX_LOG2 - LUMINANCE_HISTOGRAM_MIN_LOG2) / LUMINANCE_HISTOGRAM_BINS);
+}
+
+void AddLuminanceToHistogram(LuminanceHistogram* histogram, r32 luminance, r32 weight)
+{
+	NotNull(histogram);
+	if (weight <= 0.0f) { return; }
+	histogram->bins[GetLuminanceHistogramBin(luminance)] += weight;
+	histogram->totalWeight += weight;
+}
+
+// The reference reduction over a whole linear HDR image, one unit of weight per pixel
+void AccumulateLuminanceHistogram(LuminanceHistogram* histogram, uxx numPixels, const v3* pixels)
+{
+	NotNull(histogram);
+	Assert(pixels != nullptr || numPixels == 0);
+	for (uxx pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		AddLuminanceToHistogram(histogram, GetLinearLuminance(pixels[pIndex]), 1.0f);
+	}
+}
+
+// Geometric mean of the luminance between the two percentiles (0-1) of the histogram's weight. Returns 0 for an empty histogram
+r32 GetHistogramAverageLuminance(const LuminanceHistogram* histogram, r32 lowPercentile, r32 highPercentile)
+{
+	NotNull(histogram);
+	Assert(lowPercentile >= 0.0f && lowPercentile < highPercentile && highPercentile <= 1.0f);
+	if (histogram->totalWeight <= 0.0f) { return 0.0f; }
+	r32 lowWeight = histogram->totalWeight * lowPercentile;
+	r32 highWeight = histogram->totalWeight * highPercentile;
+	r32 weightBefore = 0.0f;
+	r32 sumLog2 = 0.0f;
+	r32 sumWeight = 0.0f;
+	for (uxx bIndex = 0; bIndex < LUMINANCE_HISTOGRAM_BINS; bIndex++)
+	{
+		r32 binWeight = histogram->bins[bIndex];
+		//Only the part of this bin's weight that falls inside [lowWeight, highWeight) counts
+		r32 binStart = MaxR32(weightBefore, lowWeight);
+		r32 binEnd = MinR32(weightBefore + binWeight, highWeight);
+		if (binEnd > binStart)
+		{
+			sumLog2 += GetLuminanceHistogramBinCenterLog2(bIndex) * (binEnd - binStart);
+			sumWeight += binEnd - binStart;
+		}
+		weightBefore += binWeight;
+		if (weightBefore >= highWeight) { break; }
+	}
+	return (sumWeight > 0.0f) ? exp2f(sumLog2 / sumWeight) : 0.0f;
+}
+
+// +--------------------------------------------------------------+
+// |                        Auto-Exposure                         |
+// +--------------------------------------------------------------+
+void InitExposureState(ExposureState* stateOut)
+{
+	NotNull(stateOut);
+	ClearPointer(stateOut);
+	stateOut->tonemapper = Tonemapper_Aces;
+	stateOut->autoExposure = true;
+	stateOut->compensationEv = 0.0f;
+	stateOut->averageLuminance = AUTO_EXPOSURE_KEY;
+	stateOut->adaptedLuminance = AUTO_EXPOSURE_KEY;
+	stateOut->exposure = 1.0f;
+}
+
+// Call after the frame's histogram has been filled. Adaptation happens in log2 space so brightening and darkening by the same number of stops take the same time
+void UpdateExposure(ExposureState* state, r32 elapsedSeconds)
+{
+	NotNull(state);
+	if (state->autoExposure)
+	{
+		state->averageLuminance = GetHistogramAverageLuminance(&state->histogram, AUTO_EXPOSURE_LOW_PERCENTILE, AUTO_EXPOSURE_HIGH_PERCENTILE);
+		if (state->averageLuminance > 0.0f)
+		{
+			r32 currentLog2 = log2f(MaxR32(state->adaptedLuminance, 1e-6f));
+			r32 targetLog2 = log2f(state->averageLuminance);
+			r32 speed = (targetLog2 > currentLog2) ? AUTO_EXPOSURE_SPEED_UP : AUTO_EXPOSURE_SPEED_DOWN;
+			r32 lerpAmount = 1.0f - expf(-elapsedSeconds * speed);
+			state->adaptedLuminance = exp2f(currentLog2 + (targetLog2 - currentLog2) * lerpAmount);
+		}
+		state->exposure = (AUTO_EXPOSURE_KEY / state->adaptedLuminance) * exp2f(state->compensationEv);
+	}
+	else { state->exposure = exp2f(state->compensationEv); }
+	state->exposure = ClampR32(state->exposure, EXPOSURE_MIN, EXPOSURE_MAX);
+}
+
+#if FP3D_SCENE_ENABLED
+// What the pbr shader outputs (before exposure) for a dielectric surface of the given albedo luminance, lit by the
+// test light and the ambient term. Energy compensation is left out, it's a couple percent at this roughness
+static r32 EstimatePbrLuminance(r32 albedoLuminance, v3 normal, v3 toLight, v3 viewDir)
+{
+	BrdfSurface surface = ZEROED;
+	surface.baseColor = FillV3(albedoLuminance);
+	surface.metallic = 0.0f;
+	surface.perceptualRoughness = 0.5f;
+	r32 lightDistance = Length(toLight);
+	v3 reflected = EvaluateBrdf(&surface, normal, viewDir, Normalize(toLight), 1.0f);
+	r32 direct = reflected.X * TEST_LIGHT_INTENSITY * GetPointLightAttenuation(lightDistance, TEST_LIGHT_RADIUS);
+	r32 ambient = (albedoLuminance + BRDF_DIELECTRIC_F0) * GetLinearLuminance(TEST_AMBIENT_COLOR);
+	return direct + ambient;
+}
+
+// A CPU estimate standing in for a histogram of the rendered frame: each queued instance contributes its
+// estimated luminance (albedo times the shader's lighting at the center of its bounds, facing the camera)
+// weighted by its screen area, the rest of the screen contributes the clear color
+void EstimateRenderQueueLuminance(LuminanceHistogram* histogram, const RenderQueue* queue, InstanceStore* store, v3 lightPos, v3 cameraPos, r32 backgroundLuminance)
+{
+	NotNull(histogram);
+	NotNull(queue);
+	NotNull(store);
+	ClearLuminanceHistogram(histogram);
+	VarArrayLoop(&queue->items, qIndex)
+	{
+		VarArrayLoopGet(RenderQueueItem, item, &queue->items, qIndex);
+		box bounds = store->bounds[item->instanceIndex];
+		v3 center = Add(bounds.BottomLeftBack, Mul(bounds.Size, 0.5f));
+		v3 toCamera = Sub(cameraPos, center);
+		v3 toLight = Sub(lightPos, center);
+		if (Length(toCamera) <= 0.0f || Length(toLight) <= 0.0f) { continue; }
+		v3 viewDir = Normalize(toCamera);
+		r32 albedoLuminance = 1.0f;
+		if (IsFlagSet(store->flags[item->instanceIndex], InstanceFlag_DrawAsBox))
+		{
+			albedoLuminance = GetColor32LinearLuminance(store->tints[item->instanceIndex]);
+		}
+		else
+		{
+			Model3D* model = GetInstanceModel(store, store->modelIds[item->instanceIndex]);
+			if (model != nullptr) { albedoLuminance = model->averageAlbedoLuminance; }
+		}
+		r32 luminance = EstimatePbrLuminance(albedoLuminance, viewDir, toLight, viewDir);
+		AddLuminanceToHistogram(histogram, luminance, item->screenRec.Width * item->screenRec.Height);
+	}
+	AddLuminanceToHistogram(histogram, backgroundLuminance, MaxR32(1.0f - queue->coveredScreenArea, 0.0f));
+}
+#endif //FP3D_SCENE_ENABLED
@@ -0,0 +1,62 @@
+/*
+File:   app_tonemap.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Exposure and tonemapping for the 3D scene. The pbr shader lights everything in linear HDR,
+	** multiplies by the current exposure and then runs one of the Tonemappers and the sRGB encode
+	** as its very last step. Auto-exposure picks the exposure from a histogram of log2 luminance
+	** and eases towards it over time.
+	** The live histogram is NOT built from the rendered frame. The HDR color never leaves the pbr
+	** shader (there's no RGBA16F render target and no fullscreen tonemap pass to read it back) so EstimateRenderQueueLuminance fills it
+	** with a CPU estimate of each queued instance instead. It's a stand-in, exposure can be off for
+	** scenes where the estimate is poor (mostly textured or partially lit surfaces).
+	** The tonemappers and the histogram reduction are CPU references that mirror the shader code and
+	** none of them touch the graphics API, so they can be run headless to check the shader's math.
+*/
+
+#ifndef _APP_TONEMAP_H
+#define _APP_TONEMAP_H
+
+#define LUMINANCE_HISTOGRAM_BINS      64
+#define LUMINANCE_HISTOGRAM_MIN_LOG2  -10.0f //luminance below 2^this all lands in the first bin
+#define LUMINANCE_HISTOGRAM_MAX_LOG2  6.0f
+#define AUTO_EXPOSURE_LOW_PERCENTILE  0.10f //darkest part of the histogram that's ignored when averaging
+#define AUTO_EXPOSURE_HIGH_PERCENTILE 0.90f //brightest part above this is ignored too, so small highlights don't darken everything
+#define AUTO_EXPOSURE_KEY             0.18f //average luminance gets mapped to middle grey
+#define AUTO_EXPOSURE_SPEED_UP        3.0f //per second, adapting to brighter scenes
+#define AUTO_EXPOSURE_SPEED_DOWN      1.0f //per second, adapting to darker scenes
+#define EXPOSURE_MIN                  (1.0f/64.0f)
+#define EXPOSURE_MAX                  64.0f
+
+// NOTE: The values are passed to the pbr shader as a float in exposureParams.y so they must match ApplyTonemap there
+typedef enum Tonemapper Tonemapper;
+enum Tonemapper
+{
+	Tonemapper_None = 0, //just clamps, this is what the shader did before HDR
+	Tonemapper_Reinhard,
+	Tonemapper_Aces,
+	Tonemapper_AgX,
+	Tonemapper_Count,
+};
+
+typedef struct LuminanceHistogram LuminanceHistogram;
+struct LuminanceHistogram
+{
+	r32 bins[LUMINANCE_HISTOGRAM_BINS]; //weights (usually pixel counts or screen area) of log2 luminance buckets
+	r32 totalWeight;
+};
+
+typedef struct ExposureState ExposureState;
+struct ExposureState
+{
+	Tonemapper tonemapper;
+	bool autoExposure;
+	r32 compensationEv; //added on top of auto-exposure, or the whole exposure when auto-exposure is off
+	LuminanceHistogram histogram;
+	r32 averageLuminance; //from the last histogram
+	r32 adaptedLuminance; //eases towards averageLuminance
+	r32 exposure; //linear multiplier the shader applies before tonemapping
+};
+
+#endif //  _APP_TONEMAP_H
@@ -0,0 +1,337 @@
+/*
+File:   app_trs_kernels.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the scalar and SIMD implementations of the TRS composition functions
+	** declared in app_trs_kernels.h as well as a micro-benchmark that compares them
+	** against the TransformMat4 chain that DrawModel and DrawObb3 used to do.
+	** NOTE: mat4 is column-major (Elements[column][row]) so the translation lives in Elements[3]
+*/
+
+// +--------------------------------------------------------------+
+// |                          SIMD Lanes                          |
+// +--------------------------------------------------------------+
+#if TRS_SIMD_AVX
+typedef __m256 TrsLane;
+#define TrsLoad(pntr)         _mm256_loadu_ps(pntr)
+#define TrsStore(pntr, lane)  _mm256_storeu_ps((pntr), (lane))
+#define TrsSet1(value)        _mm256_set1_ps(value)
+#define TrsAdd(left, right)   _mm256_add_ps((left), (right))
+#define TrsSub(left, right)   _mm256_sub_ps((left), (right))
+#define TrsMul(left, right)   _mm256_mul_ps((left), (right))
+#elif TRS_SIMD_SSE
+typedef __m128 TrsLane;
+#define TrsLoad(pntr)         _mm_loadu_ps(pntr)
+#define TrsStore(pntr, lane)  _mm_storeu_ps((pntr), (lane))
+#define TrsSet1(value)        _mm_set1_ps(value)
+#define TrsAdd(left, right)   _mm_add_ps((left), (right))
+#define TrsSub(left, right)   _mm_sub_ps((left), (right))
+#define TrsMul(left, right)   _mm_mul_ps((left), (right))
+#elif TRS_SIMD_NEON
+typedef float32x4_t TrsLane;
+#define TrsLoad(pntr)         vld1q_f32(pntr)
+#define TrsStore(pntr, lane)  vst1q_f32((pntr), (lane))
+#define TrsSet1(value)        vdupq_n_f32(value)
+#define TrsAdd(left, right)   vaddq_f32((left), (right))
+#define TrsSub(left, right)   vsubq_f32((left), (right))
+#define TrsMul(left, right)   vmulq_f32((left), (right))
+#endif
+
+// +--------------------------------------------------------------+
+// |                            TrsSoa                            |
+// +--------------------------------------------------------------+
+void FreeTrsSoa(Arena* arena, TrsSoa* soa)
+{
+	NotNull(soa);
+	if (soa->allocCount > 0)
+	{
+		// All 10 component arrays are carved out of one allocation, see AllocTrsSoa
+		FreeMem(arena, soa->positionX, sizeof(r32) * soa->allocCount * 10);
+	}
+	ClearPointer(soa);
+}
+
+TrsSoa AllocTrsSoa(Arena* arena, uxx count)
+{
+	TrsSoa result = ZEROED;
+	if (count == 0) { return result; }
+	r32* block = (r32*)AllocMem(arena, sizeof(r32) * count * 10);
+	NotNull(block);
+	result.count = count;
+	result.allocCount = count;
+	result.positionX = &block[count*0];
+	result.positionY = &block[count*1];
+	result.positionZ = &block[count*2];
+	result.rotationX = &block[count*3];
+	result.rotationY = &block[count*4];
+	result.rotationZ = &block[count*5];
+	result.rotationW = &block[count*6];
+	result.scaleX    = &block[count*7];
+	result.scaleY    = &block[count*8];
+	result.scaleZ    = &block[count*9];
+	return result;
+}
+
+void SetTrsSoaAt(TrsSoa* soa, uxx index, v3 position, quat rotation, v3 scale)
+{
+	NotNull(soa);
+	Assert(index < soa->count);
+	soa->positionX[index] = position.X;
+	soa->positionY[index] = position.Y;
+	soa->positionZ[index] = position.Z;
+	soa->rotationX[index] = rotation.X;
+	soa->rotationY[index] = rotation.Y;
+	soa->rotationZ[index] = rotation.Z;
+	soa->rotationW[index] = rotation.W;
+	soa->scaleX[index] = scale.X;
+	soa->scaleY[index] = scale.Y;
+	soa->scaleZ[index] = scale.Z;
+}
+
+// +--------------------------------------------------------------+
+// |                        Scalar Kernel                         |
+// +--------------------------------------------------------------+
+// pivot is a local-space offset applied before scale/rotation (DrawObb3 uses -0.5 to center the unit cube)
+mat4 ComposeTrsMat4Ex(v3 position, quat rotation, v3 scale, TrsOrder order, v3 pivot)
+{
+	r32 xx = rotation.X * rotation.X; r32 yy = rotation.Y * rotation.Y; r32 zz = rotation.Z * rotation.Z;
+	r32 xy = rotation.X * rotation.Y; r32 xz = rotation.X * rotation.Z; r32 yz = rotation.Y * rotation.Z;
+	r32 wx = rotation.W * rotation.X; r32 wy = rotation.W * rotation.Y; r32 wz = rotation.W * rotation.Z;
+	
+	//r[row][column] of the 3x3 rotation
+	r32 r[3][3] = {
+		{ 1.0f - 2.0f*(yy + zz), 2.0f*(xy - wz),        2.0f*(xz + wy)        },
+		{ 2.0f*(xy + wz),        1.0f - 2.0f*(xx + zz), 2.0f*(yz - wx)        },
+		{ 2.0f*(xz - wy),        2.0f*(yz + wx),        1.0f - 2.0f*(xx + yy) },
+	};
+	r32 s[3] = { scale.X, scale.Y, scale.Z };
+	
+	mat4 result = Mat4_Identity;
+	for (uxx col = 0; col < 3; col++)
+	{
+		for (uxx row = 0; row < 3; row++)
+		{
+			//S*R scales rows, R*S scales columns
+			result.Elements[col][row] = r[row][col] * ((order == TrsOrder_RotateThenScale) ? s[row] : s[col]);
+		}
+		result.Elements[col][3] = 0.0f;
+	}
+	result.Elements[3][0] = position.X + result.Elements[0][0]*pivot.X + result.Elements[1][0]*pivot.Y + result.Elements[2][0]*pivot.Z;
+	result.Elements[3][1] = position.Y + result.Elements[0][1]*pivot.X + result.Elements[1][1]*pivot.Y + result.Elements[2][1]*pivot.Z;
+	result.Elements[3][2] = position.Z + result.Elements[0][2]*pivot.X + result.Elements[1][2]*pivot.Y + result.Elements[2][2]*pivot.Z;
+	result.Elements[3][3] = 1.0f;
+	return result;
+}
+mat4 ComposeTrsMat4(v3 position, quat rotation, v3 scale, TrsOrder order)
+{
+	return ComposeTrsMat4Ex(position, rotation, scale, order, V3_Zero);
+}
+
+v3 TransformPointByMat4(const mat4* matrix, v3 point)
+{
+	return NewV3(
+		matrix->Elements[0][0]*point.X + matrix->Elements[1][0]*point.Y + matrix->Elements[2][0]*point.Z + matrix->Elements[3][0],
+		matrix->Elements[0][1]*point.X + matrix->Elements[1][1]*point.Y + matrix->Elements[2][1]*point.Z + matrix->Elements[3][1],
+		matrix->Elements[0][2]*point.X + matrix->Elements[1][2]*point.Y + matrix->Elements[2][2]*point.Z + matrix->Elements[3][2]
+	);
+}
+
+// Transforms the center and sums the absolute extents (Arvo's method) rather than transforming all 8 corners
+box TransformBoxByMat4(const mat4* matrix, box localBox)
+{
+	v3 halfSize = Mul(localBox.Size, 0.5f);
+	v3 center = TransformPointByMat4(matrix, Add(localBox.BottomLeftBack, halfSize));
+	v3 extents = NewV3(
+		AbsR32(matrix->Elements[0][0])*halfSize.X + AbsR32(matrix->Elements[1][0])*halfSize.Y + AbsR32(matrix->Elements[2][0])*halfSize.Z,
+		AbsR32(matrix->Elements[0][1])*halfSize.X + AbsR32(matrix->Elements[1][1])*halfSize.Y + AbsR32(matrix->Elements[2][1])*halfSize.Z,
+		AbsR32(matrix->Elements[0][2])*halfSize.X + AbsR32(matrix->Elements[1][2])*halfSize.Y + AbsR32(matrix->Elements[2][2])*halfSize.Z
+	);
+	return NewBoxV(Sub(center, extents), Mul(extents, 2.0f));
+}
+
+// +--------------------------------------------------------------+
+// |                         Batch Kernel                         |
+// +--------------------------------------------------------------+
+void ComposeTrsMat4BatchEx(const TrsSoa* soa, TrsOrder order, v3 pivot, mat4* matricesOut)
+{
+	NotNull(soa);
+	Assert(matricesOut != nullptr || soa->count == 0);
+	uxx iIndex = 0;
+	
+	#if TRS_LANE_WIDTH > 1
+	const TrsLane one = TrsSet1(1.0f);
+	const TrsLane two = TrsSet1(2.0f);
+	const TrsLane pivotX = TrsSet1(pivot.X);
+	const TrsLane pivotY = TrsSet1(pivot.Y);
+	const TrsLane pivotZ = TrsSet1(pivot.Z);
+	for (; iIndex + TRS_LANE_WIDTH <= soa->count; iIndex += TRS_LANE_WIDTH)
+	{
+		TrsLane qx = TrsLoad(&soa->rotationX[iIndex]);
+		TrsLane qy = TrsLoad(&soa->rotationY[iIndex]);
+		TrsLane qz = TrsLoad(&soa->rotationZ[iIndex]);
+		TrsLane qw = TrsLoad(&soa->rotationW[iIndex]);
+		TrsLane xx = TrsMul(qx, qx); TrsLane yy = TrsMul(qy, qy); TrsLane zz = TrsMul(qz, qz);
+		TrsLane xy = TrsMul(qx, qy); TrsLane xz = TrsMul(qx, qz); TrsLane yz = TrsMul(qy, qz);
+		TrsLane wx = TrsMul(qw, qx); TrsLane wy = TrsMul(qw, qy); TrsLane wz = TrsMul(qw, qz);
+		
+		//m[column][row] of the upper 3x3, starting as pure rotation
+		TrsLane m[3][3];
+		m[0][0] = TrsSub(one, TrsMul(two, TrsAdd(yy, zz)));
+		m[0][1] = TrsMul(two, TrsAdd(xy, wz));
+		m[0][2] = TrsMul(two, TrsSub(xz, wy));
+		m[1][0] = TrsMul(two, TrsSub(xy, wz));
+		m[1][1] = TrsSub(one, TrsMul(two, TrsAdd(xx, zz)));
+		m[1][2] = TrsMul(two, TrsAdd(yz, wx));
+		m[2][0] = TrsMul(two, TrsAdd(xz, wy));
+		m[2][1] = TrsMul(two, TrsSub(yz, wx));
+		m[2][2] = TrsSub(one, TrsMul(two, TrsAdd(xx, yy)));
+		
+		TrsLane s[3] = { TrsLoad(&soa->scaleX[iIndex]), TrsLoad(&soa->scaleY[iIndex]), TrsLoad(&soa->scaleZ[iIndex]) };
+		for (uxx col = 0; col < 3; col++)
+		{
+			for (uxx row = 0; row < 3; row++)
+			{
+				m[col][row] = TrsMul(m[col][row], (order == TrsOrder_RotateThenScale) ? s[row] : s[col]);
+			}
+		}
+		
+		TrsLane t[3];
+		t[0] = TrsAdd(TrsLoad(&soa->positionX[iIndex]), TrsAdd(TrsMul(m[0][0], pivotX), TrsAdd(TrsMul(m[1][0], pivotY), TrsMul(m[2][0], pivotZ))));
+		t[1] = TrsAdd(TrsLoad(&soa->positionY[iIndex]), TrsAdd(TrsMul(m[0][1], pivotX), TrsAdd(TrsMul(m[1][1], pivotY), TrsMul(m[2][1], pivotZ))));
+		t[2] = TrsAdd(TrsLoad(&soa->positionZ[iIndex]), TrsAdd(TrsMul(m[0][2], pivotX), TrsAdd(TrsMul(m[1][2], pivotY), TrsMul(m[2][2], pivotZ))));
+		
+		//Transpose from SoA lanes back into one mat4 per instance
+		r32 lanes[12][TRS_LANE_WIDTH];
+		for (uxx col = 0; col < 3; col++)
+		{
+			for (uxx row = 0; row < 3; row++) { TrsStore(&lanes[col*3 + row][0], m[col][row]); }
+		}
+		TrsStore(&lanes[9][0], t[0]);
+		TrsStore(&lanes[10][0], t[1]);
+		TrsStore(&lanes[11][0], t[2]);
+		for (uxx lIndex = 0; lIndex < TRS_LANE_WIDTH; lIndex++)
+		{
+			mat4* matrix = &matricesOut[iIndex + lIndex];
+			for (uxx col = 0; col < 3; col++)
+			{
+				matrix->Elements[col][0] = lanes[col*3 + 0][lIndex];
+				matrix->Elements[col][1] = lanes[col*3 + 1][lIndex];
+				matrix->Elements[col][2] = lanes[col*3 + 2][lIndex];
+				matrix->Elements[col][3] = 0.0f;
+			}
+			matrix->Elements[3][0] = lanes[9][lIndex];
+			matrix->Elements[3][1] = lanes[10][lIndex];
+			matrix->Elements[3][2] = lanes[11][lIndex];
+			matrix->Elements[3][3] = 1.0f;
+		}
+	}
+	#endif //TRS_LANE_WIDTH > 1
+	
+	//Remainder (or everything when there is no SIMD support)
+	for (; iIndex < soa->count; iIndex++)
+	{
+		matricesOut[iIndex] = ComposeTrsMat4Ex(
+			NewV3(soa->positionX[iIndex], soa->positionY[iIndex], soa->positionZ[iIndex]),
+			NewQuat(soa->rotationX[iIndex], soa->rotationY[iIndex], soa->rotationZ[iIndex], soa->rotationW[iIndex]),
+			NewV3(soa->scaleX[iIndex], soa->scaleY[iIndex], soa->scaleZ[iIndex]),
+			order, pivot
+		);
+	}
+}
+void ComposeTrsMat4Batch(const TrsSoa* soa, TrsOrder order, mat4* matricesOut)
+{
+	ComposeTrsMat4BatchEx(soa, order, V3_Zero, matricesOut);
+}
+
+// +--------------------------------------------------------------+
+// |                          Benchmark                           |
+// +--------------------------------------------------------------+
+TrsBenchmarkResult RunTrsBenchmark(uxx numInstances, uxx numIterations)
+{
+	Assert(numInstances > 0 && numIterations > 0);
+	ScratchBegin(scratch);
+	TrsBenchmarkResult result = ZEROED;
+	result.numInstances = numInstances;
+	result.numIterations = numIterations;
+	
+	RandomSeries random = ZEROED;
+	InitRandomSeriesDefault(&random);
+	SeedRandomSeriesU64(&random, 1234);
+	TrsSoa soa = AllocTrsSoa(scratch, numInstances);
+	for (uxx iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		v3 position = NewV3(GetRandR32Range(&random, -100, 100), GetRandR32Range(&random, -100, 100), GetRandR32Range(&random, -100, 100));
+		v3 axis = Normalize(NewV3(GetRandR32Range(&random, -1, 1), GetRandR32Range(&random, 0.1f, 1), GetRandR32Range(&random, -1, 1)));
+		quat rotation = ToQuatFromAxis(axis, GetRandR32Range(&random, 0, TwoPi32));
+		v3 scale = NewV3(GetRandR32Range(&random, 0.5f, 2), GetRandR32Range(&random, 0.5f, 2), GetRandR32Range(&random, 0.5f, 2));
+		SetTrsSoaAt(&soa, iIndex, position, rotation, scale);
+	}
+	mat4* chainMats = AllocArray(mat4, scratch, numInstances);
+	mat4* scalarMats = AllocArray(mat4, scratch, numInstances);
+	mat4* batchMats = AllocArray(mat4, scratch, numInstances);
+	NotNull(chainMats);
+	NotNull(scalarMats);
+	NotNull(batchMats);
+	
+	PerfTime chainStart = GetPerfTime();
+	for (uxx itIndex = 0; itIndex < numIterations; itIndex++)
+	{
+		for (uxx iIndex = 0; iIndex < numInstances; iIndex++)
+		{
+			mat4 worldMat = Mat4_Identity;
+			TransformMat4(&worldMat, ToMat4FromQuat(NewQuat(soa.rotationX[iIndex], soa.rotationY[iIndex], soa.rotationZ[iIndex], soa.rotationW[iIndex])));
+			TransformMat4(&worldMat, MakeScaleMat4(NewV3(soa.scaleX[iIndex], soa.scaleY[iIndex], soa.scaleZ[iIndex])));
+			TransformMat4(&worldMat, MakeTranslateMat4(NewV3(soa.positionX[iIndex], soa.positionY[iIndex], soa.positionZ[iIndex])));
+			chainMats[iIndex] = worldMat;
+		}
+	}
+	PerfTime chainEnd = GetPerfTime();
+	
+	PerfTime scalarStart = GetPerfTime();
+	for (uxx itIndex = 0; itIndex < numIterations; itIndex++)
+	{
+		for (uxx iIndex = 0; iIndex < numInstances; iIndex++)
+		{
+			scalarMats[iIndex] = ComposeTrsMat4(
+				NewV3(soa.positionX[iIndex], soa.positionY[iIndex], soa.positionZ[iIndex]),
+				NewQuat(soa.rotationX[iIndex], soa.rotationY[iIndex], soa.rotationZ[iIndex], soa.rotationW[iIndex]),
+				NewV3(soa.scaleX[iIndex], soa.scaleY[iIndex], soa.scaleZ[iIndex]),
+				TrsOrder_RotateThenScale
+			);
+		}
+	}
+	PerfTime scalarEnd = GetPerfTime();
+	
+	PerfTime batchStart = GetPerfTime();
+	for (uxx itIndex = 0; itIndex < numIterations; itIndex++)
+	{
+		ComposeTrsMat4Batch(&soa, TrsOrder_RotateThenScale, batchMats);
+	}
+	PerfTime batchEnd = GetPerfTime();
+	
+	result.chainMs = GetPerfTimeDiff(&chainStart, &chainEnd) / (r64)numIterations;
+	result.scalarMs = GetPerfTimeDiff(&scalarStart, &scalarEnd) / (r64)numIterations;
+	result.batchMs = GetPerfTimeDiff(&batchStart, &batchEnd) / (r64)numIterations;
+	for (uxx iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		for (uxx eIndex = 0; eIndex < 16; eIndex++)
+		{
+			r32 error = AbsR32(chainMats[iIndex].Elements[eIndex/4][eIndex%4] - batchMats[iIndex].Elements[eIndex/4][eIndex%4]);
+			result.maxError = MaxR32(result.maxError, error);
+		}
+	}
+	
+	ScratchEnd(scratch);
+	return result;
+}
+
+void PrintTrsBenchmark(uxx numInstances)
+{
+	TrsBenchmarkResult result = RunTrsBenchmark(numInstances, 32);
+	PrintLine_I("TRS benchmark (%llu instances, %u-wide lanes):", (u64)result.numInstances, (u32)TRS_LANE_WIDTH);
+	PrintLine_I("\tTransformMat4 chain: %.3lfms", result.chainMs);
+	PrintLine_I("\tComposeTrsMat4:      %.3lfms (%.2lfx)", result.scalarMs, result.chainMs / result.scalarMs);
+	PrintLine_I("\tComposeTrsMat4Batch: %.3lfms (%.2lfx)", result.batchMs, result.chainMs / result.batchMs);
+	PrintLine_I("\tMax error vs chain:  %g", result.maxError);
+}
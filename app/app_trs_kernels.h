@@ -0,0 +1,82 @@
+/*
+File:   app_trs_kernels.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Batch kernels that compose Translate/Rotate/Scale directly into world matrices
+	** without going through a chain of full 4x4 multiplies (TransformMat4). The batch
+	** versions operate on SoA arrays and use AVX, SSE or NEON lanes depending on the target.
+*/
+
+#ifndef _APP_TRS_KERNELS_H
+#define _APP_TRS_KERNELS_H
+
+#if defined(__AVX__)
+#define TRS_SIMD_AVX  1
+#define TRS_SIMD_SSE  0
+#define TRS_SIMD_NEON 0
+#define TRS_LANE_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRS_SIMD_AVX  0
+#define TRS_SIMD_SSE  1
+#define TRS_SIMD_NEON 0
+#define TRS_LANE_WIDTH 4
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TRS_SIMD_AVX  0
+#define TRS_SIMD_SSE  0
+#define TRS_SIMD_NEON 1
+#define TRS_LANE_WIDTH 4
+#else
+#define TRS_SIMD_AVX  0
+#define TRS_SIMD_SSE  0
+#define TRS_SIMD_NEON 0
+#define TRS_LANE_WIDTH 1
+#endif
+
+#if TRS_SIMD_AVX || TRS_SIMD_SSE
+#include <immintrin.h>
+#elif TRS_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// The existing draw code is inconsistent about whether rotation or scale is applied first
+// (see the "Order of rotation and scaling??" TODOs) so both orders are supported and produce
+// exactly what the equivalent TransformMat4 chain would produce
+typedef enum TrsOrder TrsOrder;
+enum TrsOrder
+{
+	TrsOrder_RotateThenScale = 0, //world = T * S * R (DrawModel)
+	TrsOrder_ScaleThenRotate,     //world = T * R * S (DrawObb3)
+	TrsOrder_Count,
+};
+
+// Structure-of-arrays input for the batch kernels. Rotations must be unit quaternions
+typedef struct TrsSoa TrsSoa;
+struct TrsSoa
+{
+	uxx count;
+	uxx allocCount;
+	r32* positionX;
+	r32* positionY;
+	r32* positionZ;
+	r32* rotationX;
+	r32* rotationY;
+	r32* rotationZ;
+	r32* rotationW;
+	r32* scaleX;
+	r32* scaleY;
+	r32* scaleZ;
+};
+
+typedef struct TrsBenchmarkResult TrsBenchmarkResult;
+struct TrsBenchmarkResult
+{
+	uxx numInstances;
+	uxx numIterations;
+	r64 chainMs;   //TransformMat4 chain (what DrawModel used to do)
+	r64 scalarMs;  //ComposeTrsMat4 one instance at a time
+	r64 batchMs;   //ComposeTrsMat4Batch over SoA
+	r32 maxError;  //largest absolute element difference between the chain and batch results
+};
+
+#endif //  _APP_TRS_KERNELS_H
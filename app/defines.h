@@ -17,9 +17,45 @@ Date:   02\02\2025
 #define CLAY_TOPBAR_TOGGLE_HOTKEY Key_F7
 #define IMGUI_TOPBAR_TOGGLE_HOTKEY Key_F6
 
+#define TEST_CHEST_GRID_SIZE    10
+#define TEST_CHEST_GRID_SPACING 1.5f
+#define TEST_MAX_INSTANCES      1024
+#define TEST_CAMERA_FOV         ToRadians32(45)
+#define TEST_LIGHT_RADIUS       4.0f
+#define TEST_LIGHT_INTENSITY    30.0f //the light's falloff is 1/(d^2+1), so this is roughly the irradiance right next to it
+#define TEST_AMBIENT_COLOR      NewV3(0.04f, 0.05f, 0.07f) //linear, stands in for the sky until there's image based lighting
+
 #define TEST_PHYS_GRAVITY       NewV3(0, -9.8f, 0)
 #define TEST_PHYS_BOX_SIZE      NewV3(0.2f, 0.1f, 0.15f)
 #define TEST_PHYS_BOX_DENSITY   1.0f
 #define TEST_PHYS_SIM_STEP_SIZE 1 //ms
 
+// Sokol resource pools are sized explicitly so we fail loudly at init rather than silently when a pool runs out mid-frame.
+// Each feature that makes GPU resources gets a named count here, the pool sizes are the sum of those with 2x headroom.
+#define SOKOL_NUM_MODEL_PARTS          128 //one VertBuffer per ModelDataPart across all loaded models
+#define SOKOL_NUM_LOD_BUFFERS          (SOKOL_NUM_MODEL_PARTS * 3) //a VertBuffer for every LOD past 0 of every part (MODEL_MAX_LODS-1)
+#define SOKOL_NUM_MODEL_TEXTURES       128 //textures referenced by model materials
+#define SOKOL_NUM_ATLAS_PAGES          8   //material TextureAtlas pages, each one is TextureAtlasSlot_Count (4) textures
+#define SOKOL_NUM_PBR_TEXTURES         2   //the DFG LUT and the flat normal map, shared by every pbr draw
+#define SOKOL_NUM_PRIMITIVE_BUFFERS    3   //cube, sphere and the GfxSystem's square
+#define SOKOL_NUM_FONTS                2   //testFont and debugFont
+#define SOKOL_NUM_ATLASES_PER_FONT     3   //RasterizeFontAtSizes bakes at most 3 sizes per font
+#define SOKOL_NUM_SDF_ATLASES          1   //the sdfFont's distance field atlas, see InitSdfFont
+#define SOKOL_NUM_GLYPH_PAGES          4   //GlyphCache pages, at least GLYPH_CACHE_MAX_PAGES
+#define SOKOL_NUM_UI_BUFFERS           4   //imgui and clay vertex/index buffers
+#define SOKOL_NUM_UI_IMAGES            2   //imgui's font texture and the GfxSystem's white pixel
+#define SOKOL_NUM_SHADERS              7   //main2d, main2dSdf, main3d, pbr, pbrDepth + imgui's shader and one spare for hot-reloading
+#define SOKOL_NUM_PIPELINES_PER_SHADER 8   //pipelines are cached per shader for each blend/depth/cull combination in use
+#define SOKOL_NUM_ATTACHMENTS          4   //offscreen render targets
+#define SOKOL_BUFFER_POOL_SIZE         (2 * (SOKOL_NUM_MODEL_PARTS + SOKOL_NUM_LOD_BUFFERS + SOKOL_NUM_PRIMITIVE_BUFFERS + SOKOL_NUM_UI_BUFFERS))
+#define SOKOL_IMAGE_POOL_SIZE          (2 * (SOKOL_NUM_MODEL_TEXTURES + SOKOL_NUM_ATLAS_PAGES*4 + SOKOL_NUM_PBR_TEXTURES + SOKOL_NUM_FONTS*SOKOL_NUM_ATLASES_PER_FONT + SOKOL_NUM_SDF_ATLASES + SOKOL_NUM_GLYPH_PAGES + SOKOL_NUM_UI_IMAGES))
+#define SOKOL_SAMPLER_POOL_SIZE        SOKOL_IMAGE_POOL_SIZE
+#define SOKOL_SHADER_POOL_SIZE         (2 * SOKOL_NUM_SHADERS)
+#define SOKOL_PIPELINE_POOL_SIZE       (2 * SOKOL_NUM_SHADERS * SOKOL_NUM_PIPELINES_PER_SHADER)
+#define SOKOL_ATTACHMENTS_POOL_SIZE    (2 * SOKOL_NUM_ATTACHMENTS)
+// Every draw applies one vertex and one fragment uniform block, each padded to 256 bytes in the uniform buffer
+#define SOKOL_MAX_DRAWS_PER_FRAME      8192
+#define SOKOL_UNIFORM_BLOCK_ALIGNMENT  256
+#define SOKOL_UNIFORM_BUFFER_SIZE      (SOKOL_MAX_DRAWS_PER_FRAME * 2 * SOKOL_UNIFORM_BLOCK_ALIGNMENT)
+
 #endif //  _DEFINES_H
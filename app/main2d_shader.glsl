@@ -59,3 +59,36 @@ void main()
 @end
 
 @program main2d vertex_shader fragment_shader
+
+// +--------------------------------------------------------------+
+// |                   SDF Text Fragment Shader                   |
+// +--------------------------------------------------------------+
+// The texture's alpha is a distance to the glyph's edge (see GenerateSdfGlyph), sdfParams.x is the value that
+// sits exactly on the edge and sdfParams.y scales the antialiasing band. The band is measured with fwidth so
+// edges stay one screen pixel soft no matter how far the atlas is scaled up or down.
+// Shares vertex_shader, the texture and the sampler with main2d. sokol-shdc merges the bindings of every program
+// in this file, so the fragment block gets its own slot (2) instead of clashing with main2d_FragParams at 1
+@fs sdf_fragment_shader
+
+layout(binding=2) uniform main2dSdf_FragParams
+{
+	uniform vec4 tint;
+	uniform vec4 sdfParams; //x=edgeValue y=softness zw=unused
+};
+layout(binding=0) uniform texture2D main2d_texture0;
+layout(binding=0) uniform sampler main2d_sampler0;
+
+in vec4 fragColor;
+in vec2 fragSampleCoord;
+out vec4 frag_color;
+
+void main()
+{
+	float edgeDistance = texture(sampler2D(main2d_texture0, main2d_sampler0), fragSampleCoord).a;
+	float edgeWidth = max(fwidth(edgeDistance) * sdfParams.y, 1.0f / 255.0f);
+	float coverage = smoothstep(sdfParams.x - edgeWidth, sdfParams.x + edgeWidth, edgeDistance);
+	frag_color = fragColor * tint * vec4(1.0f, 1.0f, 1.0f, coverage);
+}
+@end
+
+@program main2dSdf vertex_shader sdf_fragment_shader
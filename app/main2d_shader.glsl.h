@@ -17,6 +17,14 @@
             ATTR_main2d_position => 0
             ATTR_main2d_texCoord0 => 1
             ATTR_main2d_color0 => 2
+    Shader program: 'main2dSdf':
+        Get shader desc: main2dSdf_shader_desc(sg_query_backend());
+        Vertex Shader: vertex_shader
+        Fragment Shader: sdf_fragment_shader
+        Attributes:
+            ATTR_main2dSdf_position => 0
+            ATTR_main2dSdf_texCoord0 => 1
+            ATTR_main2dSdf_color0 => 2
     Bindings:
         Uniform block 'main2d_VertParams':
             C struct: main2d_VertParams_t
@@ -24,6 +32,9 @@
         Uniform block 'main2d_FragParams':
             C struct: main2d_FragParams_t
             Bind slot: UB_main2d_FragParams => 1
+        Uniform block 'main2dSdf_FragParams':
+            C struct: main2dSdf_FragParams_t
+            Bind slot: UB_main2dSdf_FragParams => 2
         Image 'main2d_texture0':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
@@ -44,11 +55,16 @@
 #endif
 #endif
 const sg_shader_desc* main2d_shader_desc(sg_backend backend);
+const sg_shader_desc* main2dSdf_shader_desc(sg_backend backend);
 #define ATTR_main2d_position (0)
 #define ATTR_main2d_texCoord0 (1)
 #define ATTR_main2d_color0 (2)
+#define ATTR_main2dSdf_position (0)
+#define ATTR_main2dSdf_texCoord0 (1)
+#define ATTR_main2dSdf_color0 (2)
 #define UB_main2d_VertParams (0)
 #define UB_main2d_FragParams (1)
+#define UB_main2dSdf_FragParams (2)
 #define IMG_main2d_texture0 (0)
 #define SMP_main2d_sampler0 (0)
 #pragma pack(push,1)
@@ -66,6 +82,12 @@ SOKOL_SHDC_ALIGN(16) typedef struct main2d_FragParams_t {
     v4r tint;
 } main2d_FragParams_t;
 #pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct main2dSdf_FragParams_t {
+    v4r tint;
+    v4r sdfParams;
+} main2dSdf_FragParams_t;
+#pragma pack(pop)
 #if defined(SOKOL_SHDC_IMPL)
 /*
     #version 430
@@ -183,6 +205,64 @@ static const uint8_t fragment_shader_source_glsl430[382] = {
     0x29,0x20,0x2a,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x46,0x72,0x61,0x67,0x50,
     0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
+/*
+    #version 430
+
+    uniform vec4 main2dSdf_FragParams[2];
+    layout(binding = 16) uniform sampler2D main2d_texture0_main2d_sampler0;
+
+    layout(location = 1) in vec2 fragSampleCoord;
+    layout(location = 0) out vec4 frag_color;
+    layout(location = 0) in vec4 fragColor;
+
+    void main()
+    {
+        float _26 = texture(main2d_texture0_main2d_sampler0, fragSampleCoord).w;
+        float _40 = max(fwidth(_26) * main2dSdf_FragParams[1].y, 0.0039215688593685626983642578125);
+        frag_color = (fragColor * main2dSdf_FragParams[0]) * vec4(1.0, 1.0, 1.0, smoothstep(main2dSdf_FragParams[1].x - _40, main2dSdf_FragParams[1].x + _40, _26));
+    }
+
+*/
+static const uint8_t sdf_fragment_shader_source_glsl430[607] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x6d,0x61,0x69,0x6e,0x32,
+    0x64,0x53,0x64,0x66,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,
+    0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x6d,0x61,0x69,0x6e,0x32,
+    0x64,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x6d,0x61,0x69,0x6e,0x32,
+    0x64,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x30,0x5f,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x30,0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,
+    0x6f,0x6f,0x72,0x64,0x29,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x34,0x30,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x66,0x77,0x69,
+    0x64,0x74,0x68,0x28,0x5f,0x32,0x36,0x29,0x20,0x2a,0x20,0x6d,0x61,0x69,0x6e,0x32,
+    0x64,0x53,0x64,0x66,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,
+    0x38,0x38,0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,
+    0x32,0x35,0x37,0x38,0x31,0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x53,0x64,
+    0x66,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x29,
+    0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,
+    0x70,0x28,0x6d,0x61,0x69,0x6e,0x32,0x64,0x53,0x64,0x66,0x5f,0x46,0x72,0x61,0x67,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x20,0x2d,0x20,0x5f,0x34,
+    0x30,0x2c,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x53,0x64,0x66,0x5f,0x46,0x72,0x61,
+    0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x20,0x2b,0x20,0x5f,
+    0x34,0x30,0x2c,0x20,0x5f,0x32,0x36,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
 /*
     cbuffer main2d_VertParams : register(b0)
     {
@@ -422,6 +502,117 @@ static const uint8_t fragment_shader_source_hlsl5[830] = {
     0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,
     0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
+/*
+    cbuffer main2dSdf_FragParams : register(b0)
+    {
+        float4 _35_tint : packoffset(c0);
+        float4 _35_sdfParams : packoffset(c1);
+    };
+
+    Texture2D<float4> main2d_texture0 : register(t0);
+    SamplerState main2d_sampler0 : register(s0);
+
+    static float2 fragSampleCoord;
+    static float4 frag_color;
+    static float4 fragColor;
+
+    struct SPIRV_Cross_Input
+    {
+        float4 fragColor : TEXCOORD0;
+        float2 fragSampleCoord : TEXCOORD1;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        float4 frag_color : SV_Target0;
+    };
+
+    void frag_main()
+    {
+        float _26 = main2d_texture0.Sample(main2d_sampler0, fragSampleCoord).w;
+        float _40 = max(fwidth(_26) * _35_sdfParams.y, 0.0039215688593685626983642578125f);
+        frag_color = (fragColor * _35_tint) * float4(1.0f, 1.0f, 1.0f, smoothstep(_35_sdfParams.x - _40, _35_sdfParams.x + _40, _26));
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        fragSampleCoord = stage_input.fragSampleCoord;
+        fragColor = stage_input.fragColor;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.frag_color = frag_color;
+        return stage_output;
+    }
+*/
+static const uint8_t sdf_fragment_shader_source_hlsl5[1071] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x53,0x64,
+    0x66,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x35,0x5f,0x74,0x69,0x6e,
+    0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x33,0x35,0x5f,0x73,0x64,0x66,0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,
+    0x65,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,
+    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x72,
+    0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x36,0x20,0x3d,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x30,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x6d,0x61,0x69,
+    0x6e,0x32,0x64,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x30,0x2c,0x20,0x66,0x72,
+    0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x77,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x20,
+    0x3d,0x20,0x6d,0x61,0x78,0x28,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x5f,0x32,0x36,
+    0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,0x5f,0x73,0x64,0x66,0x50,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,
+    0x38,0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,
+    0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x5f,0x33,0x35,0x5f,0x74,0x69,0x6e,0x74,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x31,0x2e,0x30,0x66,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x73,0x6d,0x6f,
+    0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x5f,0x33,0x35,0x5f,0x73,0x64,0x66,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x20,0x2d,0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,
+    0x33,0x35,0x5f,0x73,0x64,0x66,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x20,0x2b,
+    0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x32,0x36,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
 /*
     #include <metal_stdlib>
     #include <simd/simd.h>
@@ -597,6 +788,94 @@ static const uint8_t fragment_shader_source_metal_macos[626] = {
     0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
     0x0a,0x00,
 };
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main2dSdf_FragParams
+    {
+        float4 tint;
+        float4 sdfParams;
+    };
+
+    struct main0_out
+    {
+        float4 frag_color [[color(0)]];
+    };
+
+    struct main0_in
+    {
+        float4 fragColor [[user(locn0)]];
+        float2 fragSampleCoord [[user(locn1)]];
+    };
+
+    fragment main0_out main0(main0_in in [[stage_in]], constant main2dSdf_FragParams& _35 [[buffer(0)]], texture2d<float> main2d_texture0 [[texture(0)]], sampler main2d_sampler0 [[sampler(0)]])
+    {
+        main0_out out = {};
+        float _26 = main2d_texture0.sample(main2d_sampler0, in.fragSampleCoord).w;
+        float _40 = max(fwidth(_26) * _35.sdfParams.y, 0.0039215688593685626983642578125);
+        out.frag_color = (in.fragColor * _35.tint) * float4(1.0, 1.0, 1.0, smoothstep(_35.sdfParams.x - _40, _35.sdfParams.x + _40, _26));
+        return out;
+    }
+
+*/
+static const uint8_t sdf_fragment_shader_source_metal_macos[845] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x32,0x64,0x53,0x64,0x66,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,
+    0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x73,0x64,0x66,0x50,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,
+    0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x32,0x64,0x53,0x64,0x66,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,
+    0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x33,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x30,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x36,0x20,0x3d,0x20,0x6d,0x61,0x69,0x6e,
+    0x32,0x64,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x6d,0x61,0x69,0x6e,0x32,0x64,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x30,0x2c,0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x66,
+    0x77,0x69,0x64,0x74,0x68,0x28,0x5f,0x32,0x36,0x29,0x20,0x2a,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x64,0x66,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x2c,0x20,0x30,0x2e,
+    0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,0x35,
+    0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x5f,0x33,0x35,0x2e,0x74,0x69,0x6e,0x74,0x29,
+    0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,
+    0x74,0x65,0x70,0x28,0x5f,0x33,0x35,0x2e,0x73,0x64,0x66,0x50,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x78,0x20,0x2d,0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x64,0x66,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x20,0x2b,0x20,0x5f,0x34,0x30,
+    0x2c,0x20,0x5f,0x32,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
 const sg_shader_desc* main2d_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
         static sg_shader_desc desc;
@@ -710,6 +989,119 @@ const sg_shader_desc* main2d_shader_desc(sg_backend backend) {
     }
     return 0;
 }
+const sg_shader_desc* main2dSdf_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vertex_shader_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sdf_fragment_shader_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "position";
+            desc.attrs[1].glsl_name = "texCoord0";
+            desc.attrs[2].glsl_name = "color0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 224;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 14;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "main2d_VertParams";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 32;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "main2dSdf_FragParams";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "main2d_texture0_main2d_sampler0";
+            desc.label = "main2dSdf_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vertex_shader_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)sdf_fragment_shader_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.attrs[1].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[1].hlsl_sem_index = 1;
+            desc.attrs[2].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[2].hlsl_sem_index = 2;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 224;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 32;
+            desc.uniform_blocks[2].hlsl_register_b_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].hlsl_register_t_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].hlsl_register_s_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "main2dSdf_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)vertex_shader_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)sdf_fragment_shader_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 224;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 32;
+            desc.uniform_blocks[2].msl_buffer_n = 0;
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[0].msl_texture_n = 0;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[0].msl_sampler_n = 0;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.label = "main2dSdf_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
 #endif // SOKOL_SHDC_IMPL
 
 //NOTE: These lines were added by find_and_compile_shaders.py
@@ -741,3 +1133,28 @@ const sg_shader_desc* main2d_shader_desc(sg_backend backend) {
 	{ .name="texCoord0", .index=ATTR_main2d_texCoord0 }, \
 	{ .name="color0", .index=ATTR_main2d_color0 }, \
 } // These should match ShaderAttributeDef struct found in gfx_shader.h
+#define main2dSdf_SHADER_FILE_PATH "C:\\gamedev\\projects\\SokolPbrRenderer\\app\\main2d_shader.glsl"
+#define main2dSdf_SHADER_IMAGE_COUNT 1
+#define main2dSdf_SHADER_IMAGE_DEFS { \
+	{ .name="main2d_texture0", .index=IMG_main2d_texture0 }, \
+} // These should match ShaderImageDef struct found in gfx_shader.h
+#define main2dSdf_SHADER_SAMPLER_COUNT 1
+#define main2dSdf_SHADER_SAMPLER_DEFS { \
+	{ .name="main2d_sampler0", .index=SMP_main2d_sampler0 }, \
+} // These should match ShaderSamplerDef struct found in gfx_shader.h
+#define main2dSdf_SHADER_UNIFORM_COUNT 7
+#define main2dSdf_SHADER_UNIFORM_DEFS { \
+	{ .name="world", .blockIndex=UB_main2d_VertParams, .offset=STRUCT_VAR_OFFSET(main2d_VertParams_t, world), .size=STRUCT_VAR_SIZE(main2d_VertParams_t, world) }, \
+	{ .name="view", .blockIndex=UB_main2d_VertParams, .offset=STRUCT_VAR_OFFSET(main2d_VertParams_t, view), .size=STRUCT_VAR_SIZE(main2d_VertParams_t, view) }, \
+	{ .name="projection", .blockIndex=UB_main2d_VertParams, .offset=STRUCT_VAR_OFFSET(main2d_VertParams_t, projection), .size=STRUCT_VAR_SIZE(main2d_VertParams_t, projection) }, \
+	{ .name="main2d_texture0_size", .blockIndex=UB_main2d_VertParams, .offset=STRUCT_VAR_OFFSET(main2d_VertParams_t, main2d_texture0_size), .size=STRUCT_VAR_SIZE(main2d_VertParams_t, main2d_texture0_size) }, \
+	{ .name="sourceRec0", .blockIndex=UB_main2d_VertParams, .offset=STRUCT_VAR_OFFSET(main2d_VertParams_t, sourceRec0), .size=STRUCT_VAR_SIZE(main2d_VertParams_t, sourceRec0) }, \
+	{ .name="tint", .blockIndex=UB_main2dSdf_FragParams, .offset=STRUCT_VAR_OFFSET(main2dSdf_FragParams_t, tint), .size=STRUCT_VAR_SIZE(main2dSdf_FragParams_t, tint) }, \
+	{ .name="sdfParams", .blockIndex=UB_main2dSdf_FragParams, .offset=STRUCT_VAR_OFFSET(main2dSdf_FragParams_t, sdfParams), .size=STRUCT_VAR_SIZE(main2dSdf_FragParams_t, sdfParams) }, \
+} // These should match ShaderUniformDef struct found in gfx_shader.h
+#define main2dSdf_SHADER_ATTR_COUNT 3
+#define main2dSdf_SHADER_ATTR_DEFS { \
+	{ .name="position", .index=ATTR_main2dSdf_position }, \
+	{ .name="texCoord0", .index=ATTR_main2dSdf_texCoord0 }, \
+	{ .name="color0", .index=ATTR_main2dSdf_color0 }, \
+} // These should match ShaderAttributeDef struct found in gfx_shader.h
@@ -8,43 +8,135 @@
 // +--------------------------------------------------------------+
 @vs vertex_shader
 
-layout(binding=0) uniform pbr_VertParams
+// Only changes once per frame, kept apart from the per-draw block (world, uvTransform) which changes on every draw
+layout(binding=0) uniform pbr_FrameVertParams
 {
-	uniform mat4 world;
 	uniform mat4 view;
 	uniform mat4 projection;
 };
 
+layout(binding=1) uniform pbr_DrawVertParams
+{
+	uniform mat4 world;
+	uniform vec4 uvTransform; //xy = scale, zw = offset, places the material's rectangle when its textures live in an atlas page
+};
+
 in vec3 position;
 in vec3 normal;
+in vec4 tangent; //w = bitangent sign, see app_tangents.h
 in vec2 texCoord0;
 in vec4 color0;
 
 out vec3 fragPosition;
 out vec3 fragNormal;
+out vec4 fragTangent;
 out vec2 fragSampleCoord;
 out vec4 fragColor;
 
+// pbrDepth (below) writes the depth this pass is tested against with EQUAL-or-closer, both have to produce bit identical positions
+invariant gl_Position;
+
 void main()
 {
 	gl_Position = projection * (view * (world * vec4(position, 1.0f)));
 	fragPosition = (world * vec4(position, 1.0f)).xyz;
-	fragNormal = (world * vec4(normal, 0.0f)).xyz;
-	fragSampleCoord = texCoord0;
+	//Normals go through the inverse-transpose so non-uniform scale keeps them perpendicular to the surface, tangents
+	//lie in the surface and go through world like positions do. A mirroring world flips which way cross(normal, tangent) points
+	mat3 worldLinear = mat3(world);
+	fragNormal = transpose(inverse(worldLinear)) * normal;
+	fragTangent = vec4(worldLinear * tangent.xyz, tangent.w * (determinant(worldLinear) < 0.0f ? -1.0f : 1.0f));
+	fragSampleCoord = texCoord0 * uvTransform.xy + uvTransform.zw;
 	fragColor = color0;
 }
 @end
 
+// +--------------------------------------------------------------+
+// |                        Output Block                          |
+// +--------------------------------------------------------------+
+// Turns linear HDR color into the final sRGB encoded display color. Runs at the end of the pbr fragment
+// shader itself, there is no offscreen HDR target and no separate fullscreen tonemap pass.
+// Must match HdrToDisplay in app_tonemap.c, tonemapper values match the Tonemapper enum there
+@block tonemap_output
+float GetLuminance(vec3 linearColor)
+{
+	return dot(linearColor, vec3(0.2126f, 0.7152f, 0.0722f));
+}
+
+vec3 TonemapAces(vec3 color)
+{
+	color *= 0.6f;
+	return clamp((color * (2.51f * color + 0.03f)) / (color * (2.43f * color + 0.59f) + 0.14f), 0.0f, 1.0f);
+}
+
+vec3 TonemapAgX(vec3 color)
+{
+	const mat3 agxInset = mat3(
+		0.842479062253094f, 0.0423282422610123f, 0.0423756549057051f,
+		0.0784335999999992f, 0.878468636469772f, 0.0784336f,
+		0.0792237451477643f, 0.0791661274605434f, 0.879142973793104f
+	);
+	const mat3 agxOutset = mat3(
+		1.19687900512017f, -0.0528968517574562f, -0.0529716355144438f,
+		-0.0980208811401368f, 1.15190312990417f, -0.0980434501171241f,
+		-0.0990297440797205f, -0.0989611768448433f, 1.15107367264116f
+	);
+	const float minEv = -12.47393f;
+	const float maxEv = 4.026069f;
+	vec3 encoded = (clamp(log2(max(agxInset * color, vec3(1e-10f))), minEv, maxEv) - minEv) / (maxEv - minEv);
+	vec3 x2 = encoded * encoded;
+	vec3 x4 = x2 * x2;
+	vec3 curve = 15.5f*x4*x2 - 40.14f*x4*encoded + 31.96f*x4 - 6.868f*x2*encoded + 0.4298f*x2 + 0.1191f*encoded - 0.00232f;
+	return pow(clamp(agxOutset * curve, 0.0f, 1.0f), vec3(2.2f));
+}
+
+vec3 ApplyTonemap(vec3 color, int tonemapper)
+{
+	if (tonemapper == 1) { return color / (vec3(1.0f) + color); }
+	else if (tonemapper == 2) { return TonemapAces(color); }
+	else if (tonemapper == 3) { return TonemapAgX(color); }
+	else { return clamp(color, 0.0f, 1.0f); }
+}
+
+vec3 LinearToSrgb(vec3 linearColor)
+{
+	bvec3 cutoff = lessThan(linearColor, vec3(0.0031308f));
+	vec3 higher = vec3(1.055f)*pow(linearColor, vec3(1.0f/2.4f)) - vec3(0.055f);
+	vec3 lower = linearColor * vec3(12.92f);
+	return mix(higher, lower, cutoff);
+}
+
+vec3 SrgbToLinear(vec3 srgbColor)
+{
+	bvec3 cutoff = lessThan(srgbColor, vec3(0.04045f));
+	vec3 higher = pow((srgbColor + vec3(0.055f))/vec3(1.055f), vec3(2.4f));
+	vec3 lower = srgbColor/vec3(12.92f);
+	return mix(higher, lower, cutoff);
+}
+
+// exposureParams: x = exposure multiplier, y = tonemapper
+vec3 HdrToDisplay(vec3 hdrColor, vec4 exposureParams)
+{
+	return LinearToSrgb(ApplyTonemap(hdrColor * exposureParams.x, int(exposureParams.y + 0.5f)));
+}
+@end
+
 // +--------------------------------------------------------------+
 // |                       Fragment Shader                        |
 // +--------------------------------------------------------------+
 @fs fragment_shader
 
-layout(binding=1) uniform pbr_FragParams
+layout(binding=2) uniform pbr_FrameFragParams
+{
+	uniform vec4 lightPos; //xyz = position, w = intensity
+	uniform vec4 cameraPos; //w = light radius, where the light's falloff reaches 0
+	uniform vec4 ambientColor; //linear rgb, already multiplied by its intensity
+	uniform vec4 exposureParams; //x = exposure multiplier, y = tonemapper (see HdrToDisplay)
+};
+
+layout(binding=3) uniform pbr_DrawFragParams
 {
 	uniform vec4 tint;
-	uniform vec4 lightPos;
-	uniform vec4 cameraPos;
+	uniform vec4 surfaceParams; //x = metallic factor, y = roughness factor, multiplied with the metallicRoughness texture
 };
 layout(binding=0) uniform texture2D pbrAlbedoTexture;
 layout(binding=0) uniform sampler pbrAlbedoSampler;
@@ -52,104 +144,160 @@ layout(binding=0) uniform sampler pbrAlbedoSampler;
 layout(binding=1) uniform texture2D pbrNormalTexture;
 layout(binding=1) uniform sampler pbrNormalSampler;
 
-layout(binding=2) uniform texture2D pbrMetallicTexture;
-layout(binding=2) uniform sampler pbrMetallicSampler;
+//glTF packs roughness in G and metallic in B of the same texture
+layout(binding=2) uniform texture2D pbrMetallicRoughnessTexture;
+layout(binding=2) uniform sampler pbrMetallicRoughnessSampler;
 
-layout(binding=3) uniform texture2D pbrRoughnessTexture;
-layout(binding=3) uniform sampler pbrRoughnessSampler;
+layout(binding=3) uniform texture2D pbrOcclusionTexture;
+layout(binding=3) uniform sampler pbrOcclusionSampler;
 
-layout(binding=4) uniform texture2D pbrOcclusionTexture;
-layout(binding=4) uniform sampler pbrOcclusionSampler;
+// Split-sum environment BRDF generated by GenerateBrdfDfgLut in app_brdf.c, x = NdotV, y = perceptual roughness
+layout(binding=4) uniform texture2D pbrDfgTexture;
+layout(binding=4) uniform sampler pbrDfgSampler;
 
 in vec3 fragPosition;
 in vec3 fragNormal;
+in vec4 fragTangent;
 in vec2 fragSampleCoord;
 in vec4 fragColor;
 out vec4 frag_color;
 
 const float PI = 3.141592653589793238462643383279502884197;
+const float MIN_ROUGHNESS = 0.045f; //BRDF_MIN_ROUGHNESS
+const float DIELECTRIC_F0 = 0.04f; //BRDF_DIELECTRIC_F0
 
-float DistributionGGX(vec3 normal, vec3 halfVec, float roughness)
+// Every function below has a CPU twin in app_brdf.c (ValidateBrdfReference checks those against numerical integration)
+float DistributionGGX(float normalDotHalf, float alpha)
 {
-	float roughnessSquared = roughness * roughness;
-	float normalDotHalfVec = max(dot(normal, halfVec), 0.0f);
-	float normalDotHalfVecSquared = normalDotHalfVec * normalDotHalfVec;
-	float numerator = roughnessSquared;
-	float denominator = (normalDotHalfVecSquared * (roughnessSquared - 1.0f) + 1.0f);
-	denominator = PI * denominator * denominator;
-	return numerator / denominator;
+	float alphaSquared = alpha * alpha;
+	float denominator = (normalDotHalf * alphaSquared - normalDotHalf) * normalDotHalf + 1.0f;
+	return alphaSquared / (PI * denominator * denominator);
 }
 
-// The geometry function statistically approximates the relative surface area where its micro surface-details overshadow each other, causing light rays to be occluded. 
-float GeometrySchlickGGX(float normalDotLightOrView, float roughness)
+// Height-correlated Smith visibility, already divided by 4 * NdotV * NdotL. Uses the square root free approximation
+float VisibilitySmithGGXCorrelatedFast(float normalDotView, float normalDotLight, float alpha)
 {
-	float numerator = normalDotLightOrView;
-	float denominator = normalDotLightOrView * (1.0f - roughness) + roughness;
-	return numerator / denominator;
+	float lambdaView = normalDotLight * (normalDotView * (1.0f - alpha) + alpha);
+	float lambdaLight = normalDotView * (normalDotLight * (1.0f - alpha) + alpha);
+	return 0.5f / (lambdaView + lambdaLight);
 }
-float GeometrySmith(vec3 normal, vec3 viewDir, vec3 lightVec, float roughness)
+
+vec3 FresnelSchlick(float viewDotHalf, vec3 f0)
 {
-	float normalDotView = max(dot(normal, viewDir), 0.0f);
-	float normalDotLight = max(dot(normal, lightVec), 0.0f);
-	float geometryObstruction = GeometrySchlickGGX(normalDotView, roughness);
-	float geometryShadowing = GeometrySchlickGGX(normalDotLight, roughness);
-	return geometryObstruction * geometryShadowing;
+	float oneMinus = 1.0f - viewDotHalf;
+	float oneMinusSquared = oneMinus * oneMinus;
+	float fresnelWeight = oneMinusSquared * oneMinusSquared * oneMinus;
+	return f0 * (1.0f - fresnelWeight) + vec3(fresnelWeight);
 }
 
-vec4 fromLinear(vec4 linearRGB)
+float GetPointLightAttenuation(float distance, float radius)
 {
-	bvec4 cutoff = lessThan(linearRGB, vec4(0.0031308));
-	vec4 higher = vec4(1.055)*pow(linearRGB, vec4(1.0/2.4)) - vec4(0.055);
-	vec4 lower = linearRGB * vec4(12.92);
-	return mix(higher, lower, cutoff);
+	float ratio = distance / radius;
+	float window = clamp(1.0f - ratio * ratio * ratio * ratio, 0.0f, 1.0f);
+	return (window * window) / (distance * distance + 1.0f);
 }
 
-vec4 toLinear(vec4 sRGB)
+// MikkTSpace convention (what glTF normal maps are baked against): the bitangent is rebuilt per fragment from the
+// interpolated normal and tangent. Both are renormalized after interpolation and the tangent is made perpendicular to
+// the normal again (Gram-Schmidt) so the basis stays orthonormal. Materials without a normal map bind a flat (0.5, 0.5, 1) texture
+vec3 GetMappedNormal(vec3 vertexNormal, vec4 vertexTangent, vec3 normalSample)
 {
-	bvec4 cutoff = lessThan(sRGB, vec4(0.04045));
-	vec4 higher = pow((sRGB + vec4(0.055))/vec4(1.055), vec4(2.4));
-	vec4 lower = sRGB/vec4(12.92);
-	return mix(higher, lower, cutoff);
+	vec3 tangentNormal = normalSample * 2.0f - 1.0f;
+	vec3 normal = normalize(vertexNormal);
+	vec3 tangent = normalize(vertexTangent.xyz - normal * dot(normal, vertexTangent.xyz));
+	vec3 bitangent = cross(normal, tangent) * vertexTangent.w;
+	vec3 result = tangentNormal.x * tangent + tangentNormal.y * bitangent + tangentNormal.z * normal;
+	return normalize(result);
 }
 
+@include_block tonemap_output
+
 void main()
 {
-	vec3 surfaceNormal = texture(sampler2D(pbrNormalTexture, pbrNormalSampler), fragSampleCoord).xyz * 2.0f - vec3(1.0f, 1.0f, 1.0f);
-	vec4 albedo = toLinear(texture(sampler2D(pbrAlbedoTexture, pbrAlbedoSampler), fragSampleCoord));
-	vec4 ambientOcclusion = texture(sampler2D(pbrOcclusionTexture, pbrOcclusionSampler), fragSampleCoord);
-	float roughness = texture(sampler2D(pbrRoughnessTexture, pbrRoughnessSampler), fragSampleCoord).r;
+	vec4 albedo = texture(sampler2D(pbrAlbedoTexture, pbrAlbedoSampler), fragSampleCoord);
+	albedo.rgb = SrgbToLinear(albedo.rgb); //albedo textures are plain RGBA8 holding sRGB color, decoded here after filtering
+	float ambientOcclusion = texture(sampler2D(pbrOcclusionTexture, pbrOcclusionSampler), fragSampleCoord).r;
+	vec4 metallicRoughness = texture(sampler2D(pbrMetallicRoughnessTexture, pbrMetallicRoughnessSampler), fragSampleCoord);
+	float metallic = metallicRoughness.b * surfaceParams.x;
+	float roughness = metallicRoughness.g * surfaceParams.y;
+	roughness = clamp(roughness, MIN_ROUGHNESS, 1.0f);
+	float alpha = roughness * roughness;
+	//Vertex colors and material factors are linear in glTF and tints are linearized on the CPU
+	vec4 baseColor = fragColor * albedo * tint;
+	vec3 diffuseColor = baseColor.rgb * (1.0f - metallic);
+	vec3 f0 = mix(vec3(DIELECTRIC_F0), baseColor.rgb, metallic);
 	
-	vec3 normalVec = normalize(fragNormal);
-	vec3 lightVec = normalize(lightPos.xyz - fragPosition);
+	vec3 toLight = lightPos.xyz - fragPosition;
+	float lightDistance = length(toLight);
+	vec3 normalVec = GetMappedNormal(fragNormal, fragTangent, texture(sampler2D(pbrNormalTexture, pbrNormalSampler), fragSampleCoord).rgb);
+	vec3 lightVec = toLight / lightDistance;
 	vec3 viewDir = normalize(cameraPos.xyz - fragPosition);
-	vec3 halfVec = (normalVec + lightVec) / 2.0f;
-	
-	float normalDistributionValue = DistributionGGX(normalVec, halfVec, roughness);
-	vec4 normalDistributionMult = vec4(normalDistributionValue, normalDistributionValue, normalDistributionValue, 1.0f);
+	vec3 halfVec = normalize(viewDir + lightVec);
+	float normalDotView = max(dot(normalVec, viewDir), 1e-4f);
+	float normalDotLight = clamp(dot(normalVec, lightVec), 0.0f, 1.0f);
+	float normalDotHalf = clamp(dot(normalVec, halfVec), 0.0f, 1.0f);
+	float lightDotHalf = clamp(dot(lightVec, halfVec), 0.0f, 1.0f);
 	
-	float directLightRoughness = ((roughness + 1) * (roughness + 1)) / 8.0f;
-	float geometryValue = GeometrySmith(normalVec, viewDir, lightVec, directLightRoughness);
-	vec4 geometryMult = vec4(geometryValue, geometryValue, geometryValue, 1.0f);
+	//One texture fetch replaces integrating the specular lobe: dfg.x * f0 + dfg.y is its directional albedo. Single scattering
+	//GGX loses energy on rough surfaces, scaling by 1/albedo (weighted by f0) puts back what multiple bounces would add
+	vec2 dfg = texture(sampler2D(pbrDfgTexture, pbrDfgSampler), vec2(normalDotView, roughness)).rg;
+	vec3 energyCompensation = vec3(1.0f) + f0 * (1.0f / max(dfg.x + dfg.y, 1e-4f) - 1.0f);
 	
-	// frag_color = fragColor * albedo * tint;
-	// frag_color = fragColor * albedo * tint * vec4((fragNormal + vec3(1.0f,1.0f,1.0f))/2.0f, 1.0f);
-	// vec4 positionMult = vec4(
-	// 	(sin(fragPosition.x * 3.1415926f) + 1.0f)/2.0f,
-	// 	(sin(fragPosition.y * 3.1415926f) + 1.0f)/2.0f,
-	// 	(sin(fragPosition.z * 3.1415926f) + 1.0f)/2.0f,
-	// 	1.0f
-	// );
-	// frag_color = fragColor * albedo * tint * positionMult;
-	// float lightDistance = length(cameraPos.xyz - fragPosition);
-	// vec4 lightMult = vec4(1.0f - lightDistance/3.5f, 1.0f - lightDistance/4.0f, 1.0f - lightDistance/6.0f, 1.0f);
-	// frag_color = fragColor * albedo * tint * lightMult;
+	float distribution = DistributionGGX(normalDotHalf, alpha);
+	float visibility = VisibilitySmithGGXCorrelatedFast(normalDotView, normalDotLight, alpha);
+	vec3 specular = (distribution * visibility) * FresnelSchlick(lightDotHalf, f0) * energyCompensation;
+	vec3 diffuse = diffuseColor / PI;
+	float lightAmount = lightPos.w * GetPointLightAttenuation(lightDistance, cameraPos.w) * normalDotLight;
+	vec3 direct = (diffuse + specular) * lightAmount;
 	
-	// float lightDot = dot(normalize(fragNormal + surfaceNormal), lightVec);
-	// vec4 lightMult = vec4(lightDot, lightDot, lightDot, 1.0f);
+	vec3 ambientSpecular = (f0 * dfg.x + vec3(dfg.y)) * energyCompensation;
+	vec3 ambient = (diffuseColor + ambientSpecular) * ambientColor.rgb * ambientOcclusion;
 	
-	vec4 addedMult = vec4(vec3(normalDistributionValue + geometryValue), 1.0f);
-	frag_color = fromLinear(toLinear(fragColor) * albedo * toLinear(tint) * addedMult);
+	vec3 hdrColor = direct + ambient;
+	frag_color = vec4(HdrToDisplay(hdrColor, exposureParams), baseColor.a);
 }
 @end
 
 @program pbr vertex_shader fragment_shader
+
+// +--------------------------------------------------------------+
+// |                      Depth Only Program                      |
+// +--------------------------------------------------------------+
+// Used by the depth pre-pass. Only reads positions and does exactly the same transform as vertex_shader so the
+// depths it writes match what the pbr program generates later. The uniform blocks have to be declared exactly like
+// vertex_shader's, sokol-shdc merges the bindings of every program in this file and rejects two different blocks on one slot
+@vs depth_vertex_shader
+
+layout(binding=0) uniform pbr_FrameVertParams
+{
+	uniform mat4 view;
+	uniform mat4 projection;
+};
+
+layout(binding=1) uniform pbr_DrawVertParams
+{
+	uniform mat4 world;
+	uniform vec4 uvTransform;
+};
+
+in vec3 position;
+
+invariant gl_Position;
+
+void main()
+{
+	gl_Position = projection * (view * (world * vec4(position, 1.0f)));
+}
+@end
+
+// Color writes are masked off while this is bound, the output only exists because every program needs a fragment shader
+@fs depth_fragment_shader
+out vec4 frag_color;
+
+void main()
+{
+	frag_color = vec4(1.0f);
+}
+@end
+
+@program pbrDepth depth_vertex_shader depth_fragment_shader
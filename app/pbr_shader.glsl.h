@@ -16,31 +16,68 @@
         Attributes:
             ATTR_pbr_position => 0
             ATTR_pbr_normal => 1
-            ATTR_pbr_texCoord0 => 2
-            ATTR_pbr_color0 => 3
+            ATTR_pbr_tangent => 2
+            ATTR_pbr_texCoord0 => 3
+            ATTR_pbr_color0 => 4
+    Shader program: 'pbrDepth':
+        Get shader desc: pbrDepth_shader_desc(sg_query_backend());
+        Vertex Shader: depth_vertex_shader
+        Fragment Shader: depth_fragment_shader
+        Attributes:
+            ATTR_pbrDepth_position => 0
     Bindings:
-        Uniform block 'pbr_VertParams':
-            C struct: pbr_VertParams_t
-            Bind slot: UB_pbr_VertParams => 0
-        Uniform block 'pbr_FragParams':
-            C struct: pbr_FragParams_t
-            Bind slot: UB_pbr_FragParams => 1
+        Uniform block 'pbr_FrameVertParams':
+            C struct: pbr_FrameVertParams_t
+            Bind slot: UB_pbr_FrameVertParams => 0
+        Uniform block 'pbr_DrawVertParams':
+            C struct: pbr_DrawVertParams_t
+            Bind slot: UB_pbr_DrawVertParams => 1
+        Uniform block 'pbr_FrameFragParams':
+            C struct: pbr_FrameFragParams_t
+            Bind slot: UB_pbr_FrameFragParams => 2
+        Uniform block 'pbr_DrawFragParams':
+            C struct: pbr_DrawFragParams_t
+            Bind slot: UB_pbr_DrawFragParams => 3
         Image 'pbrAlbedoTexture':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
             Multisampled: false
             Bind slot: IMG_pbrAlbedoTexture => 0
-        Image 'pbrRoughnessTexture':
+        Image 'pbrNormalTexture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_pbrNormalTexture => 1
+        Image 'pbrMetallicRoughnessTexture':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
             Multisampled: false
-            Bind slot: IMG_pbrRoughnessTexture => 3
+            Bind slot: IMG_pbrMetallicRoughnessTexture => 2
+        Image 'pbrOcclusionTexture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_pbrOcclusionTexture => 3
+        Image 'pbrDfgTexture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_pbrDfgTexture => 4
         Sampler 'pbrAlbedoSampler':
             Type: SG_SAMPLERTYPE_FILTERING
             Bind slot: SMP_pbrAlbedoSampler => 0
-        Sampler 'pbrRoughnessSampler':
+        Sampler 'pbrNormalSampler':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_pbrNormalSampler => 1
+        Sampler 'pbrMetallicRoughnessSampler':
             Type: SG_SAMPLERTYPE_FILTERING
-            Bind slot: SMP_pbrRoughnessSampler => 3
+            Bind slot: SMP_pbrMetallicRoughnessSampler => 2
+        Sampler 'pbrOcclusionSampler':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_pbrOcclusionSampler => 3
+        Sampler 'pbrDfgSampler':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_pbrDfgSampler => 4
 */
 #if !defined(SOKOL_GFX_INCLUDED)
 #error "Please include sokol_gfx.h before pbr_shader.glsl.h"
@@ -53,386 +90,850 @@
 #endif
 #endif
 const sg_shader_desc* pbr_shader_desc(sg_backend backend);
+const sg_shader_desc* pbrDepth_shader_desc(sg_backend backend);
 #define ATTR_pbr_position (0)
 #define ATTR_pbr_normal (1)
-#define ATTR_pbr_texCoord0 (2)
-#define ATTR_pbr_color0 (3)
-#define UB_pbr_VertParams (0)
-#define UB_pbr_FragParams (1)
+#define ATTR_pbr_tangent (2)
+#define ATTR_pbr_texCoord0 (3)
+#define ATTR_pbr_color0 (4)
+#define ATTR_pbrDepth_position (0)
+#define UB_pbr_FrameVertParams (0)
+#define UB_pbr_DrawVertParams (1)
+#define UB_pbr_FrameFragParams (2)
+#define UB_pbr_DrawFragParams (3)
 #define IMG_pbrAlbedoTexture (0)
-#define IMG_pbrRoughnessTexture (3)
+#define IMG_pbrNormalTexture (1)
+#define IMG_pbrMetallicRoughnessTexture (2)
+#define IMG_pbrOcclusionTexture (3)
+#define IMG_pbrDfgTexture (4)
 #define SMP_pbrAlbedoSampler (0)
-#define SMP_pbrRoughnessSampler (3)
+#define SMP_pbrNormalSampler (1)
+#define SMP_pbrMetallicRoughnessSampler (2)
+#define SMP_pbrOcclusionSampler (3)
+#define SMP_pbrDfgSampler (4)
 #pragma pack(push,1)
-SOKOL_SHDC_ALIGN(16) typedef struct pbr_VertParams_t {
-    mat4 world;
+SOKOL_SHDC_ALIGN(16) typedef struct pbr_FrameVertParams_t {
     mat4 view;
     mat4 projection;
-} pbr_VertParams_t;
+} pbr_FrameVertParams_t;
 #pragma pack(pop)
 #pragma pack(push,1)
-SOKOL_SHDC_ALIGN(16) typedef struct pbr_FragParams_t {
-    v4r tint;
+SOKOL_SHDC_ALIGN(16) typedef struct pbr_DrawVertParams_t {
+    mat4 world;
+    v4r uvTransform;
+} pbr_DrawVertParams_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct pbr_FrameFragParams_t {
     v4r lightPos;
     v4r cameraPos;
-} pbr_FragParams_t;
+    v4r ambientColor;
+    v4r exposureParams;
+} pbr_FrameFragParams_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct pbr_DrawFragParams_t {
+    v4r tint;
+    v4r surfaceParams;
+} pbr_DrawFragParams_t;
 #pragma pack(pop)
 #if defined(SOKOL_SHDC_IMPL)
 /*
     #version 430
 
-    uniform vec4 pbr_VertParams[12];
+    uniform vec4 pbr_FrameVertParams[8];
+    uniform vec4 pbr_DrawVertParams[5];
     layout(location = 0) in vec3 position;
     layout(location = 0) out vec3 fragPosition;
     layout(location = 1) out vec3 fragNormal;
     layout(location = 1) in vec3 normal;
-    layout(location = 2) out vec2 fragSampleCoord;
-    layout(location = 2) in vec2 texCoord0;
-    layout(location = 3) out vec4 fragColor;
-    layout(location = 3) in vec4 color0;
+    layout(location = 2) out vec4 fragTangent;
+    layout(location = 2) in vec4 tangent;
+    layout(location = 3) out vec2 fragSampleCoord;
+    layout(location = 3) in vec2 texCoord0;
+    layout(location = 4) out vec4 fragColor;
+    layout(location = 4) in vec4 color0;
+    invariant gl_Position;
 
     void main()
     {
-        mat4 _28 = mat4(pbr_VertParams[0], pbr_VertParams[1], pbr_VertParams[2], pbr_VertParams[3]);
-        vec4 _38 = _28 * vec4(position, 1.0);
-        gl_Position = mat4(pbr_VertParams[8], pbr_VertParams[9], pbr_VertParams[10], pbr_VertParams[11]) * (mat4(pbr_VertParams[4], pbr_VertParams[5], pbr_VertParams[6], pbr_VertParams[7]) * _38);
-        fragPosition = _38.xyz;
-        fragNormal = (_28 * vec4(normal, 0.0)).xyz;
-        fragSampleCoord = texCoord0;
+        gl_Position = mat4(pbr_FrameVertParams[4], pbr_FrameVertParams[5], pbr_FrameVertParams[6], pbr_FrameVertParams[7]) * (mat4(pbr_FrameVertParams[0], pbr_FrameVertParams[1], pbr_FrameVertParams[2], pbr_FrameVertParams[3]) * (mat4(pbr_DrawVertParams[0], pbr_DrawVertParams[1], pbr_DrawVertParams[2], pbr_DrawVertParams[3]) * vec4(position, 1.0)));
+        mat4 _51 = mat4(pbr_DrawVertParams[0], pbr_DrawVertParams[1], pbr_DrawVertParams[2], pbr_DrawVertParams[3]);
+        fragPosition = (_51 * vec4(position, 1.0)).xyz;
+        mat3 _63 = mat3(_51[0].xyz, _51[1].xyz, _51[2].xyz);
+        fragNormal = transpose(inverse(_63)) * normal;
+        fragTangent = vec4(_63 * tangent.xyz, tangent.w * ((determinant(_63) < 0.0) ? (-1.0) : 1.0));
+        fragSampleCoord = fma(texCoord0, pbr_DrawVertParams[4].xy, pbr_DrawVertParams[4].zw);
         fragColor = color0;
     }
 
 */
-static const uint8_t vertex_shader_source_glsl430[858] = {
+static const uint8_t vertex_shader_source_glsl430[1370] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
-    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x62,0x72,0x5f,0x56,
-    0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,
-    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-    0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
-    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,
-    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,
-    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x66,
-    0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,
-    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
-    0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,
-    0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,
-    0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x62,0x72,0x5f,0x46,
+    0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x66,0x72,0x61,0x67,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,
+    0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,
     0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
-    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x5f,0x32,
-    0x38,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,
+    0x20,0x3d,0x20,0x34,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x69,
+    0x6e,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,
+    0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x34,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,
+    0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,
+    0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x36,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,
+    0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x28,0x6d,
+    0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,
+    0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,
+    0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,
+    0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,
+    0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x33,0x5d,0x29,0x20,0x2a,0x20,0x28,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,
+    0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,
+    0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,
+    0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x5f,0x35,0x31,0x20,0x3d,0x20,
+    0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,
     0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,
-    0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x70,
-    0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,
-    0x2c,0x20,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,
-    0x5b,0x33,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,
-    0x33,0x38,0x20,0x3d,0x20,0x5f,0x32,0x38,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
-    0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,
-    0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x56,0x65,
-    0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x70,0x62,0x72,
-    0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x30,0x5d,0x2c,
-    0x20,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
-    0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x28,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,
-    0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,
-    0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,
-    0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,
-    0x73,0x5b,0x36,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,
-    0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x5f,0x33,0x38,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x5f,0x33,0x38,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x5f,
-    0x32,0x38,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,
-    0x20,0x3d,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,
+    0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,
+    0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x28,0x5f,0x35,0x31,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x33,0x20,0x5f,
+    0x36,0x33,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x5f,0x35,0x31,0x5b,0x30,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x35,0x31,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x5f,0x35,0x31,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
+    0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,
+    0x65,0x28,0x5f,0x36,0x33,0x29,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x36,0x33,0x20,0x2a,0x20,0x74,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x2e,0x77,0x20,0x2a,0x20,0x28,0x28,0x64,0x65,0x74,0x65,0x72,0x6d,
+    0x69,0x6e,0x61,0x6e,0x74,0x28,0x5f,0x36,0x33,0x29,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x29,0x20,0x3f,0x20,0x28,0x2d,0x31,0x2e,0x30,0x29,0x20,0x3a,0x20,0x31,0x2e,0x30,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x74,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,
+    0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,
+    0x79,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x7a,0x77,0x29,0x3b,0x0a,0x20,0x20,
     0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
     0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 430
 
-    uniform vec4 pbr_FragParams[3];
+    uniform vec4 pbr_FrameFragParams[4];
+    uniform vec4 pbr_DrawFragParams[2];
     layout(binding = 16) uniform sampler2D pbrAlbedoTexture_pbrAlbedoSampler;
-    layout(binding = 17) uniform sampler2D pbrRoughnessTexture_pbrRoughnessSampler;
+    layout(binding = 17) uniform sampler2D pbrNormalTexture_pbrNormalSampler;
+    layout(binding = 18) uniform sampler2D pbrMetallicRoughnessTexture_pbrMetallicRoughnessSampler;
+    layout(binding = 19) uniform sampler2D pbrOcclusionTexture_pbrOcclusionSampler;
+    layout(binding = 20) uniform sampler2D pbrDfgTexture_pbrDfgSampler;
 
-    layout(location = 2) in vec2 fragSampleCoord;
-    layout(location = 1) in vec3 fragNormal;
+    layout(location = 3) in vec2 fragSampleCoord;
+    layout(location = 4) in vec4 fragColor;
     layout(location = 0) in vec3 fragPosition;
+    layout(location = 1) in vec3 fragNormal;
+    layout(location = 2) in vec4 fragTangent;
     layout(location = 0) out vec4 frag_color;
-    layout(location = 3) in vec4 fragColor;
 
-    vec4 toLinear(vec4 sRGB)
+    float DistributionGGX(float normalDotHalf, float alpha)
+    {
+        float _25 = alpha * alpha;
+        float _33 = (((normalDotHalf * _25) - normalDotHalf) * normalDotHalf) + 1.0;
+        return _25 / ((3.1415927410125732421875 * _33) * _33);
+    }
+
+    float VisibilitySmithGGXCorrelatedFast(float normalDotView, float normalDotLight, float alpha)
+    {
+        return 0.5 / ((normalDotLight * ((normalDotView * (1.0 - alpha)) + alpha)) + (normalDotView * ((normalDotLight * (1.0 - alpha)) + alpha)));
+    }
+
+    vec3 FresnelSchlick(float viewDotHalf, vec3 f0)
+    {
+        float _57 = 1.0 - viewDotHalf;
+        float _60 = _57 * _57;
+        float _65 = (_60 * _60) * _57;
+        return (f0 * (1.0 - _65)) + vec3(_65);
+    }
+
+    float GetPointLightAttenuation(float lightDistance, float radius)
     {
-        bvec4 _145 = lessThan(sRGB, vec4(0.040449999272823333740234375));
-        vec4 _152 = pow((sRGB + vec4(0.054999999701976776123046875)) * vec4(0.947867333889007568359375), vec4(2.400000095367431640625));
-        vec4 _155 = sRGB * vec4(0.077399380505084991455078125);
-        return vec4(_145.x ? _155.x : _152.x, _145.y ? _155.y : _152.y, _145.z ? _155.z : _152.z, _145.w ? _155.w : _152.w);
+        float _75 = lightDistance / radius;
+        float _84 = clamp(1.0 - (((_75 * _75) * _75) * _75), 0.0, 1.0);
+        return (_84 * _84) / ((lightDistance * lightDistance) + 1.0);
     }
 
-    float DistributionGGX(vec3 normal, vec3 halfVec, float roughness)
+    vec3 GetMappedNormal(vec3 vertexNormal, vec4 vertexTangent, vec3 normalSample)
     {
-        float _46 = max(dot(normal, halfVec), 0.0);
-        float _59 = fma(_46 * _46, fma(roughness, roughness, -1.0), 1.0);
-        return (roughness * roughness) / ((3.1415927410125732421875 * _59) * _59);
+        vec3 _101 = (normalSample * 2.0) - vec3(1.0);
+        vec3 _104 = normalize(vertexNormal);
+        vec3 _114 = normalize(vertexTangent.xyz - (_104 * dot(_104, vertexTangent.xyz)));
+        vec3 _121 = cross(_104, _114) * vertexTangent.w;
+        return normalize(((_114 * _101.x) + (_121 * _101.y)) + (_104 * _101.z));
     }
 
-    float GeometrySchlickGGX(float normalDotLightOrView, float roughness)
+    vec3 SrgbToLinear(vec3 srgbColor)
     {
-        return normalDotLightOrView / fma(normalDotLightOrView, 1.0 - roughness, roughness);
+        bvec3 _140 = lessThan(srgbColor, vec3(0.040449999272823333740234375));
+        vec3 _148 = pow((srgbColor + vec3(0.054999999701976776123046875)) / vec3(1.05499994754791259765625), vec3(2.400000095367431640625));
+        vec3 _152 = srgbColor / vec3(12.9200000762939453125);
+        return mix(_148, _152, _140);
     }
 
-    float GeometrySmith(vec3 normal, vec3 viewDir, vec3 lightVec, float roughness)
+    vec3 TonemapAces(vec3 color)
     {
-        float param = max(dot(normal, viewDir), 0.0);
-        float param_1 = roughness;
-        float param_2 = max(dot(normal, lightVec), 0.0);
-        float param_3 = roughness;
-        return GeometrySchlickGGX(param, param_1) * GeometrySchlickGGX(param_2, param_3);
+        vec3 _161 = color * 0.60000002384185791015625;
+        return clamp((_161 * ((_161 * 2.5099999904632568359375) + vec3(0.02999999932944774627685546875))) / ((_161 * ((_161 * 2.4300000667572021484375) + vec3(0.589999973773956298828125))) + vec3(0.14000000059604644775390625)), vec3(0.0), vec3(1.0));
     }
 
-    vec4 fromLinear(vec4 linearRGB)
+    vec3 TonemapAgX(vec3 color)
     {
-        bvec4 _118 = lessThan(linearRGB, vec4(0.003130800090730190277099609375));
-        vec4 _129 = fma(vec4(1.05499994754791259765625), pow(linearRGB, vec4(0.4166666567325592041015625)), vec4(-0.054999999701976776123046875));
-        vec4 _134 = linearRGB * vec4(12.9200000762939453125);
-        return vec4(_118.x ? _134.x : _129.x, _118.y ? _134.y : _129.y, _118.z ? _134.z : _129.z, _118.w ? _134.w : _129.w);
+        mat3 _190 = mat3(vec3(0.842479050159454345703125, 0.0423282422125339508056640625, 0.0423756539821624755859375), vec3(0.0784336030483245849609375, 0.87846863269805908203125, 0.0784336030483245849609375), vec3(0.079223744571208953857421875, 0.07916612923145294189453125, 0.8791429996490478515625));
+        mat3 _199 = mat3(vec3(1.19687902927398681640625, -0.0528968535363674163818359375, -0.0529716350138187408447265625), vec3(-0.0980208814144134521484375, 1.1519031524658203125, -0.098043449223041534423828125), vec3(-0.099029742181301116943359375, -0.098961174488067626953125, 1.1510736942291259765625));
+        vec3 _214 = (clamp(log2(max(_190 * color, vec3(1.0000000133514319600180897396058e-10))), vec3(-12.47393035888671875), vec3(4.026069164276123046875)) - vec3(-12.47393035888671875)) / vec3(16.4999980926513671875);
+        vec3 _217 = _214 * _214;
+        vec3 _220 = _217 * _217;
+        vec3 _251 = (((((((_220 * 15.5) * _217) - ((_220 * 40.1399993896484375) * _214)) + (_220 * 31.95999908447265625)) - ((_217 * 6.868000030517578125) * _214)) + (_217 * 0.4298000037670135498046875)) + (_214 * 0.119099996984004974365234375)) - vec3(0.002319999970495700836181640625);
+        return pow(clamp(_199 * _251, vec3(0.0), vec3(1.0)), vec3(2.2000000476837158203125));
+    }
+
+    vec3 ApplyTonemap(vec3 color, int tonemapper)
+    {
+        if (tonemapper == 1)
+        {
+            return color / (vec3(1.0) + color);
+        }
+        else
+        {
+            if (tonemapper == 2)
+            {
+                return TonemapAces(color);
+            }
+            else
+            {
+                if (tonemapper == 3)
+                {
+                    return TonemapAgX(color);
+                }
+                else
+                {
+                    return clamp(color, vec3(0.0), vec3(1.0));
+                }
+            }
+        }
+    }
+
+    vec3 LinearToSrgb(vec3 linearColor)
+    {
+        bvec3 _288 = lessThan(linearColor, vec3(0.003130800090730190277099609375));
+        vec3 _297 = (vec3(1.05499994754791259765625) * pow(linearColor, vec3(0.4166666567325592041015625))) - vec3(0.054999999701976776123046875);
+        vec3 _301 = linearColor * vec3(12.9200000762939453125);
+        return mix(_297, _301, _288);
+    }
+
+    vec3 HdrToDisplay(vec3 hdrColor, vec4 exposureParams)
+    {
+        return LinearToSrgb(ApplyTonemap(hdrColor * exposureParams.x, int(exposureParams.y + 0.5)));
     }
 
     void main()
     {
-        vec4 param = texture(pbrAlbedoTexture_pbrAlbedoSampler, fragSampleCoord);
-        vec4 _208 = texture(pbrRoughnessTexture_pbrRoughnessSampler, fragSampleCoord);
-        float _211 = _208.x;
-        vec3 _216 = normalize(fragNormal);
-        vec3 _230 = normalize(pbr_FragParams[1].xyz - fragPosition);
-        vec3 param_1 = _216;
-        vec3 param_2 = (_216 + _230) * vec3(0.5);
-        float param_3 = _211;
-        float _260 = _211 + 1.0;
-        vec3 param_4 = _216;
-        vec3 param_5 = normalize(pbr_FragParams[2].xyz - fragPosition);
-        vec3 param_6 = _230;
-        float param_7 = (_260 * _260) * 0.125;
-        float _284 = DistributionGGX(param_1, param_2, param_3) + GeometrySmith(param_4, param_5, param_6, param_7);
-        vec4 param_8 = fragColor;
-        vec4 param_9 = pbr_FragParams[0];
-        vec4 param_10 = ((toLinear(param_8) * toLinear(param)) * toLinear(param_9)) * vec4(_284, _284, _284, 1.0);
-        frag_color = fromLinear(param_10);
+        vec4 _330 = texture(pbrAlbedoTexture_pbrAlbedoSampler, fragSampleCoord);
+        vec3 _334 = SrgbToLinear(_330.xyz);
+        float _343 = texture(pbrOcclusionTexture_pbrOcclusionSampler, fragSampleCoord).x;
+        vec4 _350 = texture(pbrMetallicRoughnessTexture_pbrMetallicRoughnessSampler, fragSampleCoord);
+        float _358 = _350.z * pbr_DrawFragParams[1].x;
+        float _366 = clamp(_350.y * pbr_DrawFragParams[1].y, 0.04500000178813934326171875, 1.0);
+        float _369 = _366 * _366;
+        vec4 _380 = (fragColor * vec4(_334, _330.w)) * pbr_DrawFragParams[0];
+        vec3 _386 = _380.xyz * (1.0 - _358);
+        vec3 _392 = mix(vec3(0.039999999105930328369140625), _380.xyz, vec3(_358));
+        vec3 _400 = pbr_FrameFragParams[0].xyz - fragPosition;
+        float _403 = length(_400);
+        vec3 _413 = GetMappedNormal(fragNormal, fragTangent, texture(pbrNormalTexture_pbrNormalSampler, fragSampleCoord).xyz);
+        vec3 _418 = _400 / vec3(_403);
+        vec3 _425 = normalize(pbr_FrameFragParams[1].xyz - fragPosition);
+        vec3 _429 = normalize(_425 + _418);
+        float _435 = max(dot(_413, _425), 9.9999997473787516355514526367188e-05);
+        float _440 = clamp(dot(_413, _418), 0.0, 1.0);
+        float _445 = clamp(dot(_413, _429), 0.0, 1.0);
+        float _450 = clamp(dot(_418, _429), 0.0, 1.0);
+        vec4 _459 = texture(pbrDfgTexture_pbrDfgSampler, vec2(_435, _366));
+        vec3 _473 = vec3(1.0) + (_392 * ((1.0 / max(_459.x + _459.y, 9.9999997473787516355514526367188e-05)) - 1.0));
+        vec3 _495 = ((FresnelSchlick(_450, _392) * (DistributionGGX(_445, _369) * VisibilitySmithGGXCorrelatedFast(_435, _440, _369))) * _473);
+        float _508 = (pbr_FrameFragParams[0].w * GetPointLightAttenuation(_403, pbr_FrameFragParams[1].w)) * _440;
+        vec3 _512 = ((_386 / vec3(3.1415927410125732421875)) + _495) * _508;
+        vec3 _527 = ((_386 + (((_392 * _459.x) + vec3(_459.y)) * _473)) * pbr_FrameFragParams[2].xyz) * _343;
+        frag_color = vec4(HdrToDisplay(_512 + _527, pbr_FrameFragParams[3]), _380.w);
     }
 
 */
-static const uint8_t fragment_shader_source_glsl430[2958] = {
+static const uint8_t fragment_shader_source_glsl430[6973] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x62,0x72,0x5f,0x46,
-    0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x3b,0x0a,0x6c,0x61,
-    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,
-    0x36,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x32,0x44,0x20,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
-    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x37,0x29,0x20,0x75,0x6e,0x69,
-    0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x70,
-    0x62,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x5f,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x53,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
-    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,
-    0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,
+    0x72,0x61,0x6d,0x65,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x70,0x62,
+    0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,
+    0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x31,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x38,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,
+    0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x39,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,
+    0x6f,0x6e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x32,0x30,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x70,0x62,0x72,0x44,0x66,0x67,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x70,0x62,0x72,0x44,0x66,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,
     0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
-    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x66,0x72,0x61,
-    0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
-    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
-    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
-    0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x65,
-    0x63,0x34,0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x76,0x65,0x63,0x34,
-    0x20,0x73,0x52,0x47,0x42,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x76,0x65,
-    0x63,0x34,0x20,0x5f,0x31,0x34,0x35,0x20,0x3d,0x20,0x6c,0x65,0x73,0x73,0x54,0x68,
-    0x61,0x6e,0x28,0x73,0x52,0x47,0x42,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,
-    0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,0x32,0x38,0x32,0x33,0x33,
-    0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,0x70,
-    0x6f,0x77,0x28,0x28,0x73,0x52,0x47,0x42,0x20,0x2b,0x20,0x76,0x65,0x63,0x34,0x28,
-    0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,
-    0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,
-    0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x39,0x34,0x37,0x38,0x36,0x37,0x33,
-    0x33,0x33,0x38,0x38,0x39,0x30,0x30,0x37,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,
-    0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x32,0x2e,0x34,0x30,0x30,0x30,0x30,
-    0x30,0x30,0x39,0x35,0x33,0x36,0x37,0x34,0x33,0x31,0x36,0x34,0x30,0x36,0x32,0x35,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,0x35,
-    0x35,0x20,0x3d,0x20,0x73,0x52,0x47,0x42,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
-    0x30,0x2e,0x30,0x37,0x37,0x33,0x39,0x39,0x33,0x38,0x30,0x35,0x30,0x35,0x30,0x38,
-    0x34,0x39,0x39,0x31,0x34,0x35,0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,
-    0x5f,0x31,0x34,0x35,0x2e,0x78,0x20,0x3f,0x20,0x5f,0x31,0x35,0x35,0x2e,0x78,0x20,
-    0x3a,0x20,0x5f,0x31,0x35,0x32,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x34,0x35,0x2e,0x79,
-    0x20,0x3f,0x20,0x5f,0x31,0x35,0x35,0x2e,0x79,0x20,0x3a,0x20,0x5f,0x31,0x35,0x32,
-    0x2e,0x79,0x2c,0x20,0x5f,0x31,0x34,0x35,0x2e,0x7a,0x20,0x3f,0x20,0x5f,0x31,0x35,
-    0x35,0x2e,0x7a,0x20,0x3a,0x20,0x5f,0x31,0x35,0x32,0x2e,0x7a,0x2c,0x20,0x5f,0x31,
-    0x34,0x35,0x2e,0x77,0x20,0x3f,0x20,0x5f,0x31,0x35,0x35,0x2e,0x77,0x20,0x3a,0x20,
-    0x5f,0x31,0x35,0x32,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,
-    0x58,0x28,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x68,0x61,0x6c,0x66,0x56,0x65,0x63,0x2c,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x36,0x20,0x3d,0x20,
-    0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,
-    0x68,0x61,0x6c,0x66,0x56,0x65,0x63,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x39,0x20,0x3d,0x20,
-    0x66,0x6d,0x61,0x28,0x5f,0x34,0x36,0x20,0x2a,0x20,0x5f,0x34,0x36,0x2c,0x20,0x66,
-    0x6d,0x61,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x72,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x29,0x2c,0x20,
-    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,
-    0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,
-    0x32,0x31,0x38,0x37,0x35,0x20,0x2a,0x20,0x5f,0x35,0x39,0x29,0x20,0x2a,0x20,0x5f,
-    0x35,0x39,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x65,
-    0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x47,0x47,0x58,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,
-    0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,0x77,0x2c,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,0x77,0x20,
-    0x2f,0x20,0x66,0x6d,0x61,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,
-    0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,0x77,0x2c,0x20,0x31,0x2e,0x30,0x20,
-    0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x72,0x6f,0x75,
-    0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x6d,0x69,0x74,0x68,0x28,
-    0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x65,0x63,
-    0x33,0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x6c,0x69,0x67,0x68,0x74,0x56,0x65,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x6d,
-    0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,
-    0x69,0x65,0x77,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
-    0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x56,0x65,0x63,0x29,0x2c,0x20,0x30,0x2e,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x47,0x65,0x6f,
-    0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x47,0x47,0x58,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,
-    0x2a,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,0x6c,0x69,0x63,
-    0x6b,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,
-    0x66,0x72,0x6f,0x6d,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x76,0x65,0x63,0x34,0x20,
-    0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,0x31,0x38,0x20,0x3d,0x20,0x6c,0x65,
-    0x73,0x73,0x54,0x68,0x61,0x6e,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,
-    0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,
-    0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,
-    0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x5f,0x31,0x32,0x39,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x76,
-    0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,
+    0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x72,0x61,
+    0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x66,0x72,
+    0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,
+    0x6e,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,
+    0x6e,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x35,0x20,0x3d,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x2a,
+    0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x28,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x20,0x2a,0x20,0x5f,0x32,0x35,0x29,0x20,
+    0x2d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x29,
+    0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,
+    0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x5f,0x32,0x35,0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,
+    0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,
+    0x31,0x38,0x37,0x35,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x20,0x2a,0x20,0x5f,0x33,
+    0x33,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,0x69,0x73,
+    0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x43,
+    0x6f,0x72,0x72,0x65,0x6c,0x61,0x74,0x65,0x64,0x46,0x61,0x73,0x74,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x56,0x69,0x65,
+    0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,
+    0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,
+    0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x56,0x69,0x65,0x77,0x20,0x2a,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,0x61,
+    0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x44,0x6f,0x74,0x56,0x69,0x65,0x77,0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x20,0x2a,0x20,0x28,0x31,0x2e,
+    0x30,0x20,0x2d,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,0x61,0x6c,
+    0x70,0x68,0x61,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,
+    0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x66,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x37,0x20,0x3d,0x20,0x31,0x2e,0x30,
+    0x20,0x2d,0x20,0x76,0x69,0x65,0x77,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x30,0x20,0x3d,0x20,
+    0x5f,0x35,0x37,0x20,0x2a,0x20,0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x36,0x30,0x20,
+    0x2a,0x20,0x5f,0x36,0x30,0x29,0x20,0x2a,0x20,0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x66,0x30,0x20,0x2a,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x36,0x35,0x29,0x29,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x5f,0x36,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x47,0x65,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x41,
+    0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x37,0x35,0x20,0x3d,0x20,
+    0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2f,0x20,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,
+    0x30,0x20,0x2d,0x20,0x28,0x28,0x28,0x5f,0x37,0x35,0x20,0x2a,0x20,0x5f,0x37,0x35,
+    0x29,0x20,0x2a,0x20,0x5f,0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,0x37,0x35,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x38,0x34,0x20,0x2a,0x20,0x5f,0x38,
+    0x34,0x29,0x20,0x2f,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x76,0x65,0x63,0x33,0x20,0x47,0x65,0x74,0x4d,0x61,0x70,0x70,0x65,0x64,0x4e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x28,0x76,0x65,0x63,0x33,0x20,0x76,0x65,0x72,0x74,0x65,
+    0x78,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x30,0x31,0x20,
+    0x3d,0x20,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x30,
+    0x34,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x31,0x34,0x20,0x3d,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x54,0x61,0x6e,
+    0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x28,0x5f,0x31,0x30,0x34,
+    0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x30,0x34,0x2c,0x20,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x29,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x32,0x31,
+    0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,0x31,0x30,0x34,0x2c,0x20,0x5f,
+    0x31,0x31,0x34,0x29,0x20,0x2a,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x54,0x61,0x6e,
+    0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x28,0x5f,
+    0x31,0x31,0x34,0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,0x2e,0x78,0x29,0x20,0x2b,0x20,
+    0x28,0x5f,0x31,0x32,0x31,0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,0x2e,0x79,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x5f,0x31,0x30,0x34,0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,0x2e,
+    0x7a,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x53,0x72,0x67,
+    0x62,0x54,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x76,0x65,0x63,0x33,0x20,0x73,
+    0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x34,0x30,0x20,0x3d,0x20,0x6c,0x65,0x73,
+    0x73,0x54,0x68,0x61,0x6e,0x28,0x73,0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,
+    0x39,0x32,0x37,0x32,0x38,0x32,0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,
+    0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x5f,0x31,0x34,0x38,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x28,0x73,0x72,0x67,0x62,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,
+    0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,
+    0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,0x2f,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,
     0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,
-    0x70,0x6f,0x77,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x2c,0x20,0x76,
-    0x65,0x63,0x34,0x28,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,
-    0x33,0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,
-    0x29,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x2d,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,
-    0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,
-    0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x34,0x20,0x5f,0x31,0x33,0x34,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,
-    0x52,0x47,0x42,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x32,0x2e,0x39,0x32,
+    0x76,0x65,0x63,0x33,0x28,0x32,0x2e,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x39,0x35,
+    0x33,0x36,0x37,0x34,0x33,0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,
+    0x73,0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x31,0x32,0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,
+    0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x78,0x28,0x5f,0x31,0x34,0x38,0x2c,0x20,0x5f,
+    0x31,0x35,0x32,0x2c,0x20,0x5f,0x31,0x34,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x65,0x63,0x33,0x20,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x63,0x65,0x73,0x28,
+    0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x36,0x31,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x2a,0x20,0x30,0x2e,0x36,0x30,0x30,0x30,0x30,0x30,0x30,0x32,
+    0x33,0x38,0x34,0x31,0x38,0x35,0x37,0x39,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,0x2a,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,
+    0x20,0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,0x34,0x36,
+    0x33,0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,
+    0x32,0x39,0x34,0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,0x36,
+    0x38,0x37,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,
+    0x2a,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,0x2a,0x20,0x32,0x2e,0x34,0x33,0x30,
+    0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,0x32,0x30,0x32,0x31,0x34,0x38,0x34,
+    0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x35,0x38,
+    0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,0x32,0x39,0x38,
+    0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x29,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x39,0x36,0x30,
+    0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x29,0x2c,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,
+    0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x67,0x58,0x28,0x76,0x65,0x63,0x33,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,
+    0x33,0x20,0x5f,0x31,0x39,0x30,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x76,0x65,
+    0x63,0x33,0x28,0x30,0x2e,0x38,0x34,0x32,0x34,0x37,0x39,0x30,0x35,0x30,0x31,0x35,
+    0x39,0x34,0x35,0x34,0x33,0x34,0x35,0x37,0x30,0x33,0x31,0x32,0x35,0x2c,0x20,0x30,
+    0x2e,0x30,0x34,0x32,0x33,0x32,0x38,0x32,0x34,0x32,0x32,0x31,0x32,0x35,0x33,0x33,
+    0x39,0x35,0x30,0x38,0x30,0x35,0x36,0x36,0x34,0x30,0x36,0x32,0x35,0x2c,0x20,0x30,
+    0x2e,0x30,0x34,0x32,0x33,0x37,0x35,0x36,0x35,0x33,0x39,0x38,0x32,0x31,0x36,0x32,
+    0x34,0x37,0x35,0x35,0x38,0x35,0x39,0x33,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x30,0x2e,0x30,0x37,0x38,0x34,0x33,0x33,0x36,0x30,0x33,0x30,0x34,0x38,
+    0x33,0x32,0x34,0x35,0x38,0x34,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x2c,0x20,0x30,
+    0x2e,0x38,0x37,0x38,0x34,0x36,0x38,0x36,0x33,0x32,0x36,0x39,0x38,0x30,0x35,0x39,
+    0x30,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x30,0x37,0x38,0x34,
+    0x33,0x33,0x36,0x30,0x33,0x30,0x34,0x38,0x33,0x32,0x34,0x35,0x38,0x34,0x39,0x36,
+    0x30,0x39,0x33,0x37,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,
+    0x37,0x39,0x32,0x32,0x33,0x37,0x34,0x34,0x35,0x37,0x31,0x32,0x30,0x38,0x39,0x35,
+    0x33,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x37,
+    0x39,0x31,0x36,0x36,0x31,0x32,0x39,0x32,0x33,0x31,0x34,0x35,0x32,0x39,0x34,0x31,
+    0x38,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x2c,0x20,0x30,0x2e,0x38,0x37,0x39,0x31,
+    0x34,0x32,0x39,0x39,0x39,0x36,0x34,0x39,0x30,0x34,0x37,0x38,0x35,0x31,0x35,0x36,
+    0x32,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x33,0x20,0x5f,
+    0x31,0x39,0x39,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x76,0x65,0x63,0x33,0x28,
+    0x31,0x2e,0x31,0x39,0x36,0x38,0x37,0x39,0x30,0x32,0x39,0x32,0x37,0x33,0x39,0x38,
+    0x36,0x38,0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x35,
+    0x32,0x38,0x39,0x36,0x38,0x35,0x33,0x35,0x33,0x36,0x33,0x36,0x37,0x34,0x31,0x36,
+    0x33,0x38,0x31,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,
+    0x35,0x32,0x39,0x37,0x31,0x36,0x33,0x35,0x30,0x31,0x33,0x38,0x31,0x38,0x37,0x34,
+    0x30,0x38,0x34,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x2d,0x30,0x2e,0x30,0x39,0x38,0x30,0x32,0x30,0x38,0x38,0x31,0x34,
+    0x31,0x34,0x34,0x31,0x33,0x34,0x35,0x32,0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x2c,
+    0x20,0x31,0x2e,0x31,0x35,0x31,0x39,0x30,0x33,0x31,0x35,0x32,0x34,0x36,0x35,0x38,
+    0x32,0x30,0x33,0x31,0x32,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x39,0x38,0x30,0x34,
+    0x33,0x34,0x34,0x39,0x32,0x32,0x33,0x30,0x34,0x31,0x35,0x33,0x34,0x34,0x32,0x33,
+    0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x2d,0x30,
+    0x2e,0x30,0x39,0x39,0x30,0x32,0x39,0x37,0x34,0x32,0x31,0x38,0x31,0x33,0x30,0x31,
+    0x31,0x31,0x36,0x39,0x34,0x33,0x33,0x35,0x39,0x33,0x37,0x35,0x2c,0x20,0x2d,0x30,
+    0x2e,0x30,0x39,0x38,0x39,0x36,0x31,0x31,0x37,0x34,0x34,0x38,0x38,0x30,0x36,0x37,
+    0x36,0x32,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x2c,0x20,0x31,0x2e,0x31,0x35,0x31,
+    0x30,0x37,0x33,0x36,0x39,0x34,0x32,0x32,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,
+    0x36,0x32,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x5f,0x32,0x31,0x34,0x20,0x3d,0x20,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,
+    0x67,0x32,0x28,0x6d,0x61,0x78,0x28,0x5f,0x31,0x39,0x30,0x20,0x2a,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x31,0x33,0x33,0x35,0x31,0x34,0x33,0x31,0x39,0x36,0x30,0x30,0x31,
+    0x38,0x30,0x38,0x39,0x37,0x33,0x39,0x36,0x30,0x35,0x38,0x65,0x2d,0x31,0x30,0x29,
+    0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x2d,0x31,0x32,0x2e,0x34,0x37,0x33,
+    0x39,0x33,0x30,0x33,0x35,0x38,0x38,0x38,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x2c,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x34,0x2e,0x30,0x32,0x36,0x30,0x36,0x39,0x31,0x36,
+    0x34,0x32,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,
+    0x2d,0x20,0x76,0x65,0x63,0x33,0x28,0x2d,0x31,0x32,0x2e,0x34,0x37,0x33,0x39,0x33,
+    0x30,0x33,0x35,0x38,0x38,0x38,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x29,0x20,0x2f,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x36,0x2e,0x34,0x39,0x39,0x39,0x39,0x38,0x30,
+    0x39,0x32,0x36,0x35,0x31,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x32,0x31,0x37,0x20,0x3d,0x20,0x5f,
+    0x32,0x31,0x34,0x20,0x2a,0x20,0x5f,0x32,0x31,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x5f,0x32,0x32,0x30,0x20,0x3d,0x20,0x5f,0x32,0x31,0x37,
+    0x20,0x2a,0x20,0x5f,0x32,0x31,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x5f,0x32,0x35,0x31,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+    0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,0x31,0x35,0x2e,0x35,0x29,0x20,0x2a,0x20,0x5f,
+    0x32,0x31,0x37,0x29,0x20,0x2d,0x20,0x28,0x28,0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,
+    0x34,0x30,0x2e,0x31,0x33,0x39,0x39,0x39,0x39,0x33,0x38,0x39,0x36,0x34,0x38,0x34,
+    0x33,0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,0x32,0x31,0x34,0x29,0x29,0x20,0x2b,0x20,
+    0x28,0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,0x33,0x31,0x2e,0x39,0x35,0x39,0x39,0x39,
+    0x39,0x30,0x38,0x34,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x29,0x29,0x20,0x2d,
+    0x20,0x28,0x28,0x5f,0x32,0x31,0x37,0x20,0x2a,0x20,0x36,0x2e,0x38,0x36,0x38,0x30,
+    0x30,0x30,0x30,0x33,0x30,0x35,0x31,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x29,0x20,
+    0x2a,0x20,0x5f,0x32,0x31,0x34,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x31,0x37,
+    0x20,0x2a,0x20,0x30,0x2e,0x34,0x32,0x39,0x38,0x30,0x30,0x30,0x30,0x33,0x37,0x36,
+    0x37,0x30,0x31,0x33,0x35,0x34,0x39,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x5f,0x32,0x31,0x34,0x20,0x2a,0x20,0x30,0x2e,0x31,0x31,0x39,
+    0x30,0x39,0x39,0x39,0x39,0x36,0x39,0x38,0x34,0x30,0x30,0x34,0x39,0x37,0x34,0x33,
+    0x36,0x35,0x32,0x33,0x34,0x33,0x37,0x35,0x29,0x29,0x20,0x2d,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x30,0x2e,0x30,0x30,0x32,0x33,0x31,0x39,0x39,0x39,0x39,0x39,0x37,0x30,
+    0x34,0x39,0x35,0x37,0x30,0x30,0x38,0x33,0x36,0x31,0x38,0x31,0x36,0x34,0x30,0x36,
+    0x32,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x70,0x6f,0x77,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x31,0x39,0x39,0x20,0x2a,
+    0x20,0x5f,0x32,0x35,0x31,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,
+    0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x41,0x70,0x70,0x6c,0x79,0x54,0x6f,0x6e,0x65,
+    0x6d,0x61,0x70,0x28,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,
+    0x69,0x6e,0x74,0x20,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,
+    0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x28,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,
+    0x30,0x29,0x20,0x2b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,
+    0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x6f,0x6e,0x65,
+    0x6d,0x61,0x70,0x41,0x63,0x65,0x73,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x33,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x67,
+    0x58,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x30,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x4c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,
+    0x53,0x72,0x67,0x62,0x28,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,
+    0x43,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x76,0x65,
+    0x63,0x33,0x20,0x5f,0x32,0x38,0x38,0x20,0x3d,0x20,0x6c,0x65,0x73,0x73,0x54,0x68,
+    0x61,0x6e,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,
+    0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,
+    0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,
+    0x30,0x39,0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x5f,0x32,0x39,0x37,0x20,0x3d,0x20,0x28,0x76,0x65,0x63,0x33,0x28,0x31,
+    0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,
+    0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,
+    0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x29,0x29,
+    0x20,0x2d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,
+    0x34,0x36,0x38,0x37,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x5f,0x33,0x30,0x31,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x32,0x2e,0x39,0x32,
     0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,
-    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,
-    0x65,0x63,0x34,0x28,0x5f,0x31,0x31,0x38,0x2e,0x78,0x20,0x3f,0x20,0x5f,0x31,0x33,
-    0x34,0x2e,0x78,0x20,0x3a,0x20,0x5f,0x31,0x32,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x31,
-    0x31,0x38,0x2e,0x79,0x20,0x3f,0x20,0x5f,0x31,0x33,0x34,0x2e,0x79,0x20,0x3a,0x20,
-    0x5f,0x31,0x32,0x39,0x2e,0x79,0x2c,0x20,0x5f,0x31,0x31,0x38,0x2e,0x7a,0x20,0x3f,
-    0x20,0x5f,0x31,0x33,0x34,0x2e,0x7a,0x20,0x3a,0x20,0x5f,0x31,0x32,0x39,0x2e,0x7a,
-    0x2c,0x20,0x5f,0x31,0x31,0x38,0x2e,0x77,0x20,0x3f,0x20,0x5f,0x31,0x33,0x34,0x2e,
-    0x77,0x20,0x3a,0x20,0x5f,0x31,0x32,0x39,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,
-    0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,
-    0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x30,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x28,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,0x68,
-    0x6e,0x65,0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,
-    0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x31,0x31,0x20,0x3d,0x20,
-    0x5f,0x32,0x30,0x38,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-    0x20,0x5f,0x32,0x31,0x36,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
-    0x65,0x28,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x32,0x33,0x30,0x20,0x3d,0x20,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,
+    0x69,0x78,0x28,0x5f,0x32,0x39,0x37,0x2c,0x20,0x5f,0x33,0x30,0x31,0x2c,0x20,0x5f,
+    0x32,0x38,0x38,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x48,0x64,
+    0x72,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x76,0x65,0x63,0x33,0x20,
+    0x68,0x64,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x65,
+    0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4c,0x69,0x6e,0x65,
+    0x61,0x72,0x54,0x6f,0x53,0x72,0x67,0x62,0x28,0x41,0x70,0x70,0x6c,0x79,0x54,0x6f,
+    0x6e,0x65,0x6d,0x61,0x70,0x28,0x68,0x64,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,
+    0x20,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,
+    0x78,0x2c,0x20,0x69,0x6e,0x74,0x28,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x33,0x33,0x30,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x70,0x62,0x72,0x41,0x6c,
+    0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x41,
+    0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,
+    0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x33,0x33,0x34,0x20,0x3d,0x20,
+    0x53,0x72,0x67,0x62,0x54,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x5f,0x33,0x33,
+    0x30,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x33,0x34,0x33,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+    0x6e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x33,0x35,0x30,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,
+    0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,
+    0x67,0x68,0x6e,0x65,0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,
+    0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x35,0x38,0x20,
+    0x3d,0x20,0x5f,0x33,0x35,0x30,0x2e,0x7a,0x20,0x2a,0x20,0x70,0x62,0x72,0x5f,0x44,
+    0x72,0x61,0x77,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,
+    0x36,0x36,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x33,0x35,0x30,0x2e,
+    0x79,0x20,0x2a,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x46,0x72,0x61,0x67,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,
+    0x34,0x35,0x30,0x30,0x30,0x30,0x30,0x31,0x37,0x38,0x38,0x31,0x33,0x39,0x33,0x34,
+    0x33,0x32,0x36,0x31,0x37,0x31,0x38,0x37,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x36,0x39,0x20,
+    0x3d,0x20,0x5f,0x33,0x36,0x36,0x20,0x2a,0x20,0x5f,0x33,0x36,0x36,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x33,0x38,0x30,0x20,0x3d,0x20,0x28,
+    0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x5f,0x33,0x33,0x34,0x2c,0x20,0x5f,0x33,0x33,0x30,0x2e,0x77,0x29,0x29,0x20,
+    0x2a,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x46,0x72,0x61,0x67,0x50,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x5f,0x33,0x38,0x36,0x20,0x3d,0x20,0x5f,0x33,0x38,0x30,0x2e,0x78,0x79,
+    0x7a,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x33,0x35,0x38,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x33,0x39,0x32,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x33,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,0x33,0x30,0x33,0x32,0x38,0x33,
+    0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x29,0x2c,0x20,0x5f,0x33,0x38,0x30,0x2e,
+    0x78,0x79,0x7a,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x5f,0x33,0x35,0x38,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x30,0x30,0x20,
+    0x3d,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x46,0x72,0x61,0x67,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x66,
+    0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x33,0x20,0x3d,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x28,0x5f,0x34,0x30,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x31,0x33,0x20,0x3d,0x20,0x47,0x65,0x74,0x4d,
+    0x61,0x70,0x70,0x65,0x64,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x66,0x72,0x61,0x67,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x70,0x62,0x72,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x70,0x62,
+    0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,
+    0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x5f,0x34,0x31,0x38,0x20,0x3d,0x20,0x5f,0x34,0x30,0x30,0x20,0x2f,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x5f,0x34,0x30,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x5f,0x34,0x32,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x69,0x7a,0x65,0x28,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x46,0x72,0x61,
     0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,
     0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x20,0x3d,0x20,0x5f,0x32,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x28,0x5f,0x32,0x31,
-    0x36,0x20,0x2b,0x20,0x5f,0x32,0x33,0x30,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,
-    0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x32,0x31,0x31,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x36,0x30,0x20,
-    0x3d,0x20,0x5f,0x32,0x31,0x31,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,
-    0x20,0x5f,0x32,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x69,0x7a,0x65,0x28,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,
-    0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x66,0x72,0x61,0x67,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x32,
-    0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x28,0x5f,0x32,0x36,0x30,0x20,0x2a,0x20,
-    0x5f,0x32,0x36,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x31,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,0x34,0x20,0x3d,0x20,
-    0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,0x58,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x20,0x2b,0x20,0x47,0x65,0x6f,
-    0x6d,0x65,0x74,0x72,0x79,0x53,0x6d,0x69,0x74,0x68,0x28,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x2c,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
-    0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,
-    0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,
-    0x30,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x28,0x28,0x74,0x6f,0x4c,0x69,0x6e,0x65,
-    0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x29,0x20,0x2a,0x20,0x74,0x6f,
-    0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x20,0x2a,
-    0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x39,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x32,0x38,0x34,0x2c,
-    0x20,0x5f,0x32,0x38,0x34,0x2c,0x20,0x5f,0x32,0x38,0x34,0x2c,0x20,0x31,0x2e,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
-    0x72,0x20,0x3d,0x20,0x66,0x72,0x6f,0x6d,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x34,0x32,0x39,0x20,0x3d,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x34,0x32,0x35,0x20,0x2b,
+    0x20,0x5f,0x34,0x31,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x34,0x33,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x32,0x35,0x29,0x2c,0x20,0x39,0x2e,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,
+    0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,
+    0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x31,0x38,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x34,0x34,0x35,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x32,0x39,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x35,0x30,0x20,0x3d,0x20,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x38,0x2c,0x20,0x5f,0x34,0x32,
+    0x39,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x70,0x62,0x72,0x44,0x66,0x67,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x70,0x62,0x72,0x44,0x66,0x67,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x34,0x33,0x35,0x2c,0x20,0x5f,
+    0x33,0x36,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x5f,0x34,0x37,0x33,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,
+    0x20,0x2b,0x20,0x28,0x5f,0x33,0x39,0x32,0x20,0x2a,0x20,0x28,0x28,0x31,0x2e,0x30,
+    0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x5f,0x34,0x35,0x39,0x2e,0x78,0x20,0x2b,0x20,
+    0x5f,0x34,0x35,0x39,0x2e,0x79,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,
+    0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x29,0x20,
+    0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,0x28,0x28,0x46,0x72,0x65,0x73,0x6e,
+    0x65,0x6c,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x5f,0x34,0x35,0x30,0x2c,0x20,
+    0x5f,0x33,0x39,0x32,0x29,0x20,0x2a,0x20,0x28,0x44,0x69,0x73,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,0x58,0x28,0x5f,0x34,0x34,0x35,0x2c,0x20,0x5f,
+    0x33,0x36,0x39,0x29,0x20,0x2a,0x20,0x56,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,
+    0x79,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x43,0x6f,0x72,0x72,0x65,0x6c,0x61,
+    0x74,0x65,0x64,0x46,0x61,0x73,0x74,0x28,0x5f,0x34,0x33,0x35,0x2c,0x20,0x5f,0x34,
+    0x34,0x30,0x2c,0x20,0x5f,0x33,0x36,0x39,0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,
+    0x37,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x35,0x30,0x38,0x20,0x3d,0x20,0x28,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,
+    0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x20,
+    0x2a,0x20,0x47,0x65,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x41,
+    0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x5f,0x34,0x30,0x33,0x2c,
+    0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x46,0x72,0x61,0x67,0x50,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x77,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,
+    0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x31,
+    0x32,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x38,0x36,0x20,0x2f,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,
+    0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x29,0x29,0x20,0x2b,0x20,0x5f,
+    0x34,0x39,0x35,0x29,0x20,0x2a,0x20,0x5f,0x35,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x32,0x37,0x20,0x3d,0x20,0x28,0x28,0x5f,
+    0x33,0x38,0x36,0x20,0x2b,0x20,0x28,0x28,0x28,0x5f,0x33,0x39,0x32,0x20,0x2a,0x20,
+    0x5f,0x34,0x35,0x39,0x2e,0x78,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x5f,
+    0x34,0x35,0x39,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x37,0x33,0x29,0x29,
+    0x20,0x2a,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x46,0x72,0x61,0x67,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,
+    0x20,0x5f,0x33,0x34,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x48,0x64,0x72,
+    0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x5f,0x35,0x31,0x32,0x20,0x2b,
+    0x20,0x5f,0x35,0x32,0x37,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,
+    0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x2c,0x20,
+    0x5f,0x33,0x38,0x30,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
-    cbuffer pbr_VertParams : register(b0)
+    #version 430
+
+    uniform vec4 pbr_FrameVertParams[8];
+    uniform vec4 pbr_DrawVertParams[5];
+    layout(location = 0) in vec3 position;
+    invariant gl_Position;
+
+    void main()
     {
-        row_major float4x4 _19_world : packoffset(c0);
-        row_major float4x4 _19_view : packoffset(c4);
-        row_major float4x4 _19_projection : packoffset(c8);
+        gl_Position = mat4(pbr_FrameVertParams[4], pbr_FrameVertParams[5], pbr_FrameVertParams[6], pbr_FrameVertParams[7]) * (mat4(pbr_FrameVertParams[0], pbr_FrameVertParams[1], pbr_FrameVertParams[2], pbr_FrameVertParams[3]) * (mat4(pbr_DrawVertParams[0], pbr_DrawVertParams[1], pbr_DrawVertParams[2], pbr_DrawVertParams[3]) * vec4(position, 1.0)));
+    }
+
+*/
+static const uint8_t depth_vertex_shader_source_glsl430[516] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x62,0x72,0x5f,0x46,
+    0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,
+    0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x69,0x6e,
+    0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x46,
+    0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,
+    0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,
+    0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,
+    0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x20,0x2a,0x20,0x28,0x6d,0x61,
+    0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,
+    0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x46,
+    0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,
+    0x5d,0x29,0x20,0x2a,0x20,0x28,0x6d,0x61,0x74,0x34,0x28,0x70,0x62,0x72,0x5f,0x44,
+    0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,
+    0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,
+    0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x33,0x5d,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(location = 0) out vec4 frag_color;
+
+    void main()
+    {
+        frag_color = vec4(1.0);
+    }
+
+*/
+static const uint8_t depth_fragment_shader_source_glsl430[103] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer pbr_FrameVertParams : register(b0)
+    {
+        row_major float4x4 _19_view : packoffset(c0);
+        row_major float4x4 _19_projection : packoffset(c4);
+    };
+
+    cbuffer pbr_DrawVertParams : register(b1)
+    {
+        row_major float4x4 _27_world : packoffset(c0);
+        float4 _27_uvTransform : packoffset(c4);
     };
 
 
-    static float4 gl_Position;
+    static precise float4 gl_Position;
     static float3 position;
     static float3 fragPosition;
     static float3 fragNormal;
     static float3 normal;
+    static float4 fragTangent;
+    static float4 tangent;
     static float2 fragSampleCoord;
     static float2 texCoord0;
     static float4 fragColor;
@@ -442,26 +943,32 @@ static const uint8_t fragment_shader_source_glsl430[2958] = {
     {
         float3 position : TEXCOORD0;
         float3 normal : TEXCOORD1;
-        float2 texCoord0 : TEXCOORD2;
-        float4 color0 : TEXCOORD3;
+        float4 tangent : TEXCOORD2;
+        float2 texCoord0 : TEXCOORD3;
+        float4 color0 : TEXCOORD4;
     };
 
     struct SPIRV_Cross_Output
     {
         float3 fragPosition : TEXCOORD0;
         float3 fragNormal : TEXCOORD1;
-        float2 fragSampleCoord : TEXCOORD2;
-        float4 fragColor : TEXCOORD3;
-        float4 gl_Position : SV_Position;
+        float4 fragTangent : TEXCOORD2;
+        float2 fragSampleCoord : TEXCOORD3;
+        float4 fragColor : TEXCOORD4;
+        precise float4 gl_Position : SV_Position;
     };
 
     void vert_main()
     {
-        float4 _38 = mul(float4(position, 1.0f), _19_world);
-        gl_Position = mul(mul(_38, _19_view), _19_projection);
-        fragPosition = _38.xyz;
-        fragNormal = mul(float4(normal, 0.0f), _19_world).xyz;
-        fragSampleCoord = texCoord0;
+        gl_Position = mul(mul(mul(float4(position, 1.0f), _27_world), _19_view), _19_projection);
+        fragPosition = mul(float4(position, 1.0f), _27_world).xyz;
+        float3 _70 = _27_world[0].xyz;
+        float3 _74 = _27_world[1].xyz;
+        float3 _78 = _27_world[2].xyz;
+        float _84 = dot(_70, cross(_74, _78));
+        fragNormal = (((cross(_74, _78) * normal.x) + (cross(_78, _70) * normal.y)) + (cross(_70, _74) * normal.z)) / _84.xxx;
+        fragTangent = float4(((_70 * tangent.x) + (_74 * tangent.y)) + (_78 * tangent.z), tangent.w * ((_84 < 0.0f) ? (-1.0f) : 1.0f));
+        fragSampleCoord = mad(texCoord0, _27_uvTransform.xy, _27_uvTransform.zw);
         fragColor = color0;
     }
 
@@ -469,6 +976,7 @@ static const uint8_t fragment_shader_source_glsl430[2958] = {
     {
         position = stage_input.position;
         normal = stage_input.normal;
+        tangent = stage_input.tangent;
         texCoord0 = stage_input.texCoord0;
         color0 = stage_input.color0;
         vert_main();
@@ -476,138 +984,199 @@ static const uint8_t fragment_shader_source_glsl430[2958] = {
         stage_output.gl_Position = gl_Position;
         stage_output.fragPosition = fragPosition;
         stage_output.fragNormal = fragNormal;
+        stage_output.fragTangent = fragTangent;
         stage_output.fragSampleCoord = fragSampleCoord;
         stage_output.fragColor = fragColor;
         return stage_output;
     }
 */
-static const uint8_t vertex_shader_source_hlsl5[1596] = {
-    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,
-    0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
-    0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,
-    0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,
-    0x31,0x39,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
-    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
-    0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,
-    0x34,0x20,0x5f,0x31,0x39,0x5f,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x70,0x61,0x63,
-    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,
+static const uint8_t vertex_shader_source_hlsl5[2309] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,
+    0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
     0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,
-    0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
-    0x63,0x38,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
-    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,
-    0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,
-    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,
-    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
-    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,
-    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
-    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,
-    0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
-    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,
+    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x62,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
+    0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x37,0x5f,0x75,0x76,0x54,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,
+    0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
+    0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,
+    0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
     0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,
     0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-    0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,
-    0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x38,0x20,0x3d,0x20,0x6d,0x75,0x6c,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x77,0x6f,0x72,
-    0x6c,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x6d,0x75,0x6c,0x28,0x5f,
-    0x33,0x38,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x76,0x69,0x65,0x77,0x29,0x2c,0x20,0x5f,
-    0x31,0x39,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x5f,0x33,0x38,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x75,0x6c,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,
-    0x30,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x77,0x6f,0x72,0x6c,0x64,
-    0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x53,
-    0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x74,0x65,0x78,
-    0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
-    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
-    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
-    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x20,
-    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,
-    0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
-    0x6f,0x72,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
-    0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,
-    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
-    0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
-    0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,
-    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,
-    0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x4e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,
-    0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,
-    0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x6d,0x75,0x6c,0x28,0x6d,0x75,
+    0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,0x32,0x37,0x5f,0x77,0x6f,
+    0x72,0x6c,0x64,0x29,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x76,0x69,0x65,0x77,0x29,0x2c,
+    0x20,0x5f,0x31,0x39,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,
+    0x20,0x5f,0x32,0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,0x30,0x20,
+    0x3d,0x20,0x5f,0x32,0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x37,0x34,0x20,0x3d,0x20,0x5f,0x32,0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5b,0x31,
+    0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x37,0x38,0x20,0x3d,0x20,0x5f,0x32,0x37,0x5f,0x77,0x6f,0x72,0x6c,
+    0x64,0x5b,0x32,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x37,
+    0x30,0x2c,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,0x37,0x34,0x2c,0x20,0x5f,0x37,
+    0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x28,0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,
+    0x37,0x34,0x2c,0x20,0x5f,0x37,0x38,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,0x37,
+    0x38,0x2c,0x20,0x5f,0x37,0x30,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,0x37,
+    0x30,0x2c,0x20,0x5f,0x37,0x34,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x2e,0x7a,0x29,0x29,0x20,0x2f,0x20,0x5f,0x38,0x34,0x2e,0x78,0x78,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x28,0x28,0x5f,0x37,0x30,0x20,0x2a,
+    0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x5f,
+    0x37,0x34,0x20,0x2a,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x79,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x5f,0x37,0x38,0x20,0x2a,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x2e,0x7a,0x29,0x2c,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x20,
+    0x2a,0x20,0x28,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x30,0x2e,0x30,0x66,0x29,0x20,
+    0x3f,0x20,0x28,0x2d,0x31,0x2e,0x30,0x66,0x29,0x20,0x3a,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,0x74,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x2c,0x20,0x5f,0x32,0x37,0x5f,0x75,0x76,0x54,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x2e,0x78,0x79,0x2c,0x20,0x5f,0x32,0x37,
+    0x5f,0x75,0x76,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x2e,0x7a,0x77,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x43,0x6f,
+    0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,
+    0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,
+    0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,
+    0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,
+    0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,
+    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    cbuffer pbr_FragParams : register(b0)
+    cbuffer pbr_FrameFragParams : register(b0)
+    {
+        float4 _110_lightPos : packoffset(c0);
+        float4 _110_cameraPos : packoffset(c1);
+        float4 _110_ambientColor : packoffset(c2);
+        float4 _110_exposureParams : packoffset(c3);
+    };
+
+    cbuffer pbr_DrawFragParams : register(b1)
     {
-        float4 _220_tint : packoffset(c0);
-        float4 _220_lightPos : packoffset(c1);
-        float4 _220_cameraPos : packoffset(c2);
+        float4 _95_tint : packoffset(c0);
+        float4 _95_surfaceParams : packoffset(c1);
     };
 
     Texture2D<float4> pbrAlbedoTexture : register(t0);
     SamplerState pbrAlbedoSampler : register(s0);
-    Texture2D<float4> pbrRoughnessTexture : register(t1);
-    SamplerState pbrRoughnessSampler : register(s1);
+    Texture2D<float4> pbrNormalTexture : register(t1);
+    SamplerState pbrNormalSampler : register(s1);
+    Texture2D<float4> pbrMetallicRoughnessTexture : register(t2);
+    SamplerState pbrMetallicRoughnessSampler : register(s2);
+    Texture2D<float4> pbrOcclusionTexture : register(t3);
+    SamplerState pbrOcclusionSampler : register(s3);
+    Texture2D<float4> pbrDfgTexture : register(t4);
+    SamplerState pbrDfgSampler : register(s4);
 
     static float2 fragSampleCoord;
-    static float3 fragNormal;
+    static float4 fragColor;
     static float3 fragPosition;
+    static float3 fragNormal;
+    static float4 fragTangent;
     static float4 frag_color;
-    static float4 fragColor;
 
     struct SPIRV_Cross_Input
     {
         float3 fragPosition : TEXCOORD0;
         float3 fragNormal : TEXCOORD1;
-        float2 fragSampleCoord : TEXCOORD2;
-        float4 fragColor : TEXCOORD3;
+        float4 fragTangent : TEXCOORD2;
+        float2 fragSampleCoord : TEXCOORD3;
+        float4 fragColor : TEXCOORD4;
     };
 
     struct SPIRV_Cross_Output
@@ -615,330 +1184,795 @@ static const uint8_t vertex_shader_source_hlsl5[1596] = {
         float4 frag_color : SV_Target0;
     };
 
-    float4 toLinear(float4 sRGB)
+    float DistributionGGX(float normalDotHalf, float alpha)
+    {
+        float _25 = alpha * alpha;
+        float _33 = (((normalDotHalf * _25) - normalDotHalf) * normalDotHalf) + 1.0f;
+        return _25 / ((3.1415927410125732421875f * _33) * _33);
+    }
+
+    float VisibilitySmithGGXCorrelatedFast(float normalDotView, float normalDotLight, float alpha)
+    {
+        return 0.5f / ((normalDotLight * ((normalDotView * (1.0f - alpha)) + alpha)) + (normalDotView * ((normalDotLight * (1.0f - alpha)) + alpha)));
+    }
+
+    float3 FresnelSchlick(float viewDotHalf, float3 f0)
+    {
+        float _57 = 1.0f - viewDotHalf;
+        float _60 = _57 * _57;
+        float _65 = (_60 * _60) * _57;
+        return (f0 * (1.0f - _65)) + (_65).xxx;
+    }
+
+    float GetPointLightAttenuation(float lightDistance, float radius)
+    {
+        float _75 = lightDistance / radius;
+        float _84 = clamp(1.0f - (((_75 * _75) * _75) * _75), 0.0f, 1.0f);
+        return (_84 * _84) / ((lightDistance * lightDistance) + 1.0f);
+    }
+
+    float3 GetMappedNormal(float3 vertexNormal, float4 vertexTangent, float3 normalSample)
+    {
+        float3 _101 = (normalSample * 2.0f) - (1.0f).xxx;
+        float3 _104 = normalize(vertexNormal);
+        float3 _114 = normalize(vertexTangent.xyz - (_104 * dot(_104, vertexTangent.xyz)));
+        float3 _121 = cross(_104, _114) * vertexTangent.w;
+        return normalize(((_114 * _101.x) + (_121 * _101.y)) + (_104 * _101.z));
+    }
+
+    float3 SrgbToLinear(float3 srgbColor)
+    {
+        bool3 _140 = (srgbColor < (0.040449999272823333740234375f).xxx);
+        float3 _148 = pow((srgbColor + (0.054999999701976776123046875f).xxx) / (1.05499994754791259765625f).xxx, (2.400000095367431640625f).xxx);
+        float3 _152 = srgbColor / (12.9200000762939453125f).xxx;
+        return _140 ? _152 : _148;
+    }
+
+    float3 TonemapAces(float3 color)
     {
-        bool4 _145 = bool4(sRGB.x < 0.040449999272823333740234375f.xxxx.x, sRGB.y < 0.040449999272823333740234375f.xxxx.y, sRGB.z < 0.040449999272823333740234375f.xxxx.z, sRGB.w < 0.040449999272823333740234375f.xxxx.w);
-        float4 _152 = pow((sRGB + 0.054999999701976776123046875f.xxxx) * 0.947867333889007568359375f.xxxx, 2.400000095367431640625f.xxxx);
-        float4 _155 = sRGB * 0.077399380505084991455078125f.xxxx;
-        return float4(_145.x ? _155.x : _152.x, _145.y ? _155.y : _152.y, _145.z ? _155.z : _152.z, _145.w ? _155.w : _152.w);
+        float3 _161 = color * 0.60000002384185791015625f;
+        return clamp((_161 * ((_161 * 2.5099999904632568359375f) + (0.02999999932944774627685546875f).xxx)) / ((_161 * ((_161 * 2.4300000667572021484375f) + (0.589999973773956298828125f).xxx)) + (0.14000000059604644775390625f).xxx), (0.0f).xxx, (1.0f).xxx);
     }
 
-    float DistributionGGX(float3 normal, float3 halfVec, float roughness)
+    float3 TonemapAgX(float3 color)
     {
-        float _46 = max(dot(normal, halfVec), 0.0f);
-        float _59 = mad(_46 * _46, mad(roughness, roughness, -1.0f), 1.0f);
-        return (roughness * roughness) / ((3.1415927410125732421875f * _59) * _59);
+        float3x3 _190 = float3x3(float3(0.842479050159454345703125f, 0.0423282422125339508056640625f, 0.0423756539821624755859375f), float3(0.0784336030483245849609375f, 0.87846863269805908203125f, 0.0784336030483245849609375f), float3(0.079223744571208953857421875f, 0.07916612923145294189453125f, 0.8791429996490478515625f));
+        float3x3 _199 = float3x3(float3(1.19687902927398681640625f, -0.0528968535363674163818359375f, -0.0529716350138187408447265625f), float3(-0.0980208814144134521484375f, 1.1519031524658203125f, -0.098043449223041534423828125f), float3(-0.099029742181301116943359375f, -0.098961174488067626953125f, 1.1510736942291259765625f));
+        float3 _214 = (clamp(log2(max(mul(color, _190), (1.0000000133514319600180897396058e-10f).xxx)), (-12.47393035888671875f).xxx, (4.026069164276123046875f).xxx) - (-12.47393035888671875f).xxx) / (16.4999980926513671875f).xxx;
+        float3 _217 = _214 * _214;
+        float3 _220 = _217 * _217;
+        float3 _251 = (((((((_220 * 15.5f) * _217) - ((_220 * 40.1399993896484375f) * _214)) + (_220 * 31.95999908447265625f)) - ((_217 * 6.868000030517578125f) * _214)) + (_217 * 0.4298000037670135498046875f)) + (_214 * 0.119099996984004974365234375f)) - (0.002319999970495700836181640625f).xxx;
+        return pow(clamp(mul(_251, _199), (0.0f).xxx, (1.0f).xxx), (2.2000000476837158203125f).xxx);
     }
 
-    float GeometrySchlickGGX(float normalDotLightOrView, float roughness)
+    float3 ApplyTonemap(float3 color, int tonemapper)
     {
-        return normalDotLightOrView / mad(normalDotLightOrView, 1.0f - roughness, roughness);
+        if (tonemapper == 1)
+        {
+            return color / ((1.0f).xxx + color);
+        }
+        else
+        {
+            if (tonemapper == 2)
+            {
+                return TonemapAces(color);
+            }
+            else
+            {
+                if (tonemapper == 3)
+                {
+                    return TonemapAgX(color);
+                }
+                else
+                {
+                    return clamp(color, (0.0f).xxx, (1.0f).xxx);
+                }
+            }
+        }
     }
 
-    float GeometrySmith(float3 normal, float3 viewDir, float3 lightVec, float roughness)
+    float3 LinearToSrgb(float3 linearColor)
     {
-        float param = max(dot(normal, viewDir), 0.0f);
-        float param_1 = roughness;
-        float param_2 = max(dot(normal, lightVec), 0.0f);
-        float param_3 = roughness;
-        return GeometrySchlickGGX(param, param_1) * GeometrySchlickGGX(param_2, param_3);
+        bool3 _288 = (linearColor < (0.003130800090730190277099609375f).xxx);
+        float3 _297 = ((1.05499994754791259765625f).xxx * pow(linearColor, (0.4166666567325592041015625f).xxx)) - (0.054999999701976776123046875f).xxx;
+        float3 _301 = linearColor * (12.9200000762939453125f).xxx;
+        return _288 ? _301 : _297;
     }
 
-    float4 fromLinear(float4 linearRGB)
+    float3 HdrToDisplay(float3 hdrColor, float4 exposureParams)
     {
-        bool4 _118 = bool4(linearRGB.x < 0.003130800090730190277099609375f.xxxx.x, linearRGB.y < 0.003130800090730190277099609375f.xxxx.y, linearRGB.z < 0.003130800090730190277099609375f.xxxx.z, linearRGB.w < 0.003130800090730190277099609375f.xxxx.w);
-        float4 _129 = mad(1.05499994754791259765625f.xxxx, pow(linearRGB, 0.4166666567325592041015625f.xxxx), (-0.054999999701976776123046875f).xxxx);
-        float4 _134 = linearRGB * 12.9200000762939453125f.xxxx;
-        return float4(_118.x ? _134.x : _129.x, _118.y ? _134.y : _129.y, _118.z ? _134.z : _129.z, _118.w ? _134.w : _129.w);
+        return LinearToSrgb(ApplyTonemap(hdrColor * exposureParams.x, int(exposureParams.y + 0.5f)));
     }
 
     void frag_main()
     {
-        float4 param = pbrAlbedoTexture.Sample(pbrAlbedoSampler, fragSampleCoord);
-        float4 _208 = pbrRoughnessTexture.Sample(pbrRoughnessSampler, fragSampleCoord);
-        float _211 = _208.x;
-        float3 _216 = normalize(fragNormal);
-        float3 _230 = normalize(_220_lightPos.xyz - fragPosition);
-        float3 param_1 = _216;
-        float3 param_2 = (_216 + _230) * 0.5f.xxx;
-        float param_3 = _211;
-        float _260 = _211 + 1.0f;
-        float3 param_4 = _216;
-        float3 param_5 = normalize(_220_cameraPos.xyz - fragPosition);
-        float3 param_6 = _230;
-        float param_7 = (_260 * _260) * 0.125f;
-        float _284 = DistributionGGX(param_1, param_2, param_3) + GeometrySmith(param_4, param_5, param_6, param_7);
-        float4 param_8 = fragColor;
-        float4 param_9 = _220_tint;
-        float4 param_10 = ((toLinear(param_8) * toLinear(param)) * toLinear(param_9)) * float4(_284, _284, _284, 1.0f);
-        frag_color = fromLinear(param_10);
+        float4 _330 = pbrAlbedoTexture.Sample(pbrAlbedoSampler, fragSampleCoord);
+        float3 _334 = SrgbToLinear(_330.xyz);
+        float _343 = pbrOcclusionTexture.Sample(pbrOcclusionSampler, fragSampleCoord).x;
+        float4 _350 = pbrMetallicRoughnessTexture.Sample(pbrMetallicRoughnessSampler, fragSampleCoord);
+        float _358 = _350.z * _95_surfaceParams.x;
+        float _366 = clamp(_350.y * _95_surfaceParams.y, 0.04500000178813934326171875f, 1.0f);
+        float _369 = _366 * _366;
+        float4 _380 = (fragColor * float4(_334, _330.w)) * _95_tint;
+        float3 _386 = _380.xyz * (1.0f - _358);
+        float3 _392 = lerp((0.039999999105930328369140625f).xxx, _380.xyz, (_358).xxx);
+        float3 _400 = _110_lightPos.xyz - fragPosition;
+        float _403 = length(_400);
+        float3 _413 = GetMappedNormal(fragNormal, fragTangent, pbrNormalTexture.Sample(pbrNormalSampler, fragSampleCoord).xyz);
+        float3 _418 = _400 / (_403).xxx;
+        float3 _425 = normalize(_110_cameraPos.xyz - fragPosition);
+        float3 _429 = normalize(_425 + _418);
+        float _435 = max(dot(_413, _425), 9.9999997473787516355514526367188e-05f);
+        float _440 = clamp(dot(_413, _418), 0.0f, 1.0f);
+        float _445 = clamp(dot(_413, _429), 0.0f, 1.0f);
+        float _450 = clamp(dot(_418, _429), 0.0f, 1.0f);
+        float4 _459 = pbrDfgTexture.Sample(pbrDfgSampler, float2(_435, _366));
+        float3 _473 = (1.0f).xxx + (_392 * ((1.0f / max(_459.x + _459.y, 9.9999997473787516355514526367188e-05f)) - 1.0f));
+        float3 _495 = ((FresnelSchlick(_450, _392) * (DistributionGGX(_445, _369) * VisibilitySmithGGXCorrelatedFast(_435, _440, _369))) * _473);
+        float _508 = (_110_lightPos.w * GetPointLightAttenuation(_403, _110_cameraPos.w)) * _440;
+        float3 _512 = ((_386 / (3.1415927410125732421875f).xxx) + _495) * _508;
+        float3 _527 = ((_386 + (((_392 * _459.x) + (_459.y).xxx) * _473)) * _110_ambientColor.xyz) * _343;
+        frag_color = float4(HdrToDisplay(_512 + _527, _110_exposureParams), _380.w);
     }
 
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
         fragSampleCoord = stage_input.fragSampleCoord;
-        fragNormal = stage_input.fragNormal;
-        fragPosition = stage_input.fragPosition;
         fragColor = stage_input.fragColor;
+        fragPosition = stage_input.fragPosition;
+        fragNormal = stage_input.fragNormal;
+        fragTangent = stage_input.fragTangent;
         frag_main();
         SPIRV_Cross_Output stage_output;
         stage_output.frag_color = frag_color;
         return stage_output;
     }
 */
-static const uint8_t fragment_shader_source_hlsl5[4024] = {
-    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x67,
-    0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
-    0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x5f,0x32,0x32,0x30,0x5f,0x74,0x69,0x6e,0x74,0x20,0x3a,0x20,0x70,
-    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x32,0x30,0x5f,0x6c,
-    0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
-    0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x32,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,
-    0x50,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
-    0x28,0x63,0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x70,0x62,0x72,0x41,
-    0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,
-    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x62,0x72,0x41,0x6c,0x62,
-    0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,
-    0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x70,0x62,0x72,
-    0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+static const uint8_t fragment_shader_source_hlsl5[8095] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,
+    0x65,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x31,0x30,0x5f,0x6c,0x69,0x67,
+    0x68,0x74,0x50,0x6f,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x31,0x31,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,
+    0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x31,0x31,0x30,0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,
+    0x31,0x30,0x5f,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x33,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,
+    0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x31,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x39,0x35,0x5f,0x74,0x69,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x35,0x5f,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x70,
+    0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x62,0x72,
+    0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,
+    0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
     0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,
     0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x62,
-    0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x31,0x29,
-    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
-    0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,
-    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,
-    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x31,0x29,0x3b,0x0a,0x54,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,
+    0x20,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,
+    0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,0x0a,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x62,0x72,0x4d,0x65,0x74,
+    0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x73,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,
+    0x73,0x69,0x6f,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x33,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,
+    0x75,0x73,0x69,0x6f,0x6e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x33,0x29,0x3b,0x0a,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x70,
+    0x62,0x72,0x44,0x66,0x67,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x34,0x29,0x3b,0x0a,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x70,0x62,0x72,0x44,0x66,0x67,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x73,0x34,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,
+    0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,
     0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
-    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,
-    0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
-    0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,
     0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
-    0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,
-    0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x52,0x47,0x42,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x20,0x5f,0x31,0x34,0x35,0x20,0x3d,
-    0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x73,0x52,0x47,0x42,0x2e,0x78,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,0x32,0x38,0x32,
-    0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x78,0x2e,0x78,0x2c,0x20,0x73,0x52,0x47,0x42,0x2e,0x79,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,0x32,0x38,0x32,
-    0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x78,0x2e,0x79,0x2c,0x20,0x73,0x52,0x47,0x42,0x2e,0x7a,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,0x32,0x38,0x32,
-    0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x78,0x2e,0x7a,0x2c,0x20,0x73,0x52,0x47,0x42,0x2e,0x77,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,0x32,0x38,0x32,
-    0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,0x66,0x2e,0x78,
-    0x78,0x78,0x78,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x28,0x73,
-    0x52,0x47,0x42,0x20,0x2b,0x20,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,
-    0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,
-    0x38,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x29,0x20,0x2a,0x20,0x30,0x2e,0x39,
-    0x34,0x37,0x38,0x36,0x37,0x33,0x33,0x33,0x38,0x38,0x39,0x30,0x30,0x37,0x35,0x36,
-    0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x2c,0x20,0x32,
-    0x2e,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x39,0x35,0x33,0x36,0x37,0x34,0x33,0x31,
-    0x36,0x34,0x30,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x35,0x35,0x20,0x3d,
-    0x20,0x73,0x52,0x47,0x42,0x20,0x2a,0x20,0x30,0x2e,0x30,0x37,0x37,0x33,0x39,0x39,
-    0x33,0x38,0x30,0x35,0x30,0x35,0x30,0x38,0x34,0x39,0x39,0x31,0x34,0x35,0x35,0x30,
-    0x37,0x38,0x31,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,
-    0x31,0x34,0x35,0x2e,0x78,0x20,0x3f,0x20,0x5f,0x31,0x35,0x35,0x2e,0x78,0x20,0x3a,
-    0x20,0x5f,0x31,0x35,0x32,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x34,0x35,0x2e,0x79,0x20,
-    0x3f,0x20,0x5f,0x31,0x35,0x35,0x2e,0x79,0x20,0x3a,0x20,0x5f,0x31,0x35,0x32,0x2e,
-    0x79,0x2c,0x20,0x5f,0x31,0x34,0x35,0x2e,0x7a,0x20,0x3f,0x20,0x5f,0x31,0x35,0x35,
-    0x2e,0x7a,0x20,0x3a,0x20,0x5f,0x31,0x35,0x32,0x2e,0x7a,0x2c,0x20,0x5f,0x31,0x34,
-    0x35,0x2e,0x77,0x20,0x3f,0x20,0x5f,0x31,0x35,0x35,0x2e,0x77,0x20,0x3a,0x20,0x5f,
-    0x31,0x35,0x32,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,0x58,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x68,0x61,0x6c,0x66,0x56,0x65,0x63,0x2c,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x36,
-    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x2c,0x20,0x68,0x61,0x6c,0x66,0x56,0x65,0x63,0x29,0x2c,0x20,0x30,0x2e,0x30,
-    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,
-    0x39,0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,0x5f,0x34,0x36,0x20,0x2a,0x20,0x5f,0x34,
-    0x36,0x2c,0x20,0x6d,0x61,0x64,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x2d,0x31,0x2e,
-    0x30,0x66,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-    0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x20,0x2f,
-    0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,
-    0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x20,0x2a,0x20,0x5f,
-    0x35,0x39,0x29,0x20,0x2a,0x20,0x5f,0x35,0x39,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,
-    0x6c,0x69,0x63,0x6b,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,
-    0x65,0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,
-    0x4f,0x72,0x56,0x69,0x65,0x77,0x20,0x2f,0x20,0x6d,0x61,0x64,0x28,0x6e,0x6f,0x72,
-    0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,
-    0x77,0x2c,0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,
-    0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,
-    0x72,0x79,0x53,0x6d,0x69,0x74,0x68,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x69,
-    0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,0x69,
-    0x67,0x68,0x74,0x56,0x65,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x6d,0x61,0x78,
-    0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,
-    0x77,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
-    0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,
-    0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
-    0x20,0x6c,0x69,0x67,0x68,0x74,0x56,0x65,0x63,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x47,0x65,0x6f,
-    0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x47,0x47,0x58,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,
-    0x2a,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,0x6c,0x69,0x63,
-    0x6b,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x66,0x72,0x6f,0x6d,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x29,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x20,0x5f,0x31,0x31,0x38,0x20,
-    0x3d,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,
-    0x42,0x2e,0x78,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,
-    0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,
-    0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x2e,0x78,0x2c,0x20,
-    0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x2e,0x79,0x20,0x3c,0x20,0x30,0x2e,
-    0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,
-    0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2e,
-    0x78,0x78,0x78,0x78,0x2e,0x79,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,
-    0x42,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,
-    0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,
-    0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x2e,0x7a,0x2c,0x20,
-    0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x2e,0x77,0x20,0x3c,0x20,0x30,0x2e,
-    0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,
-    0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2e,
-    0x78,0x78,0x78,0x78,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x5f,0x31,0x32,0x39,0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,0x31,
-    0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,
-    0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,0x2c,0x20,
-    0x70,0x6f,0x77,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x2c,0x20,0x30,
-    0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,
-    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x78,
-    0x29,0x2c,0x20,0x28,0x2d,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,
-    0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,
-    0x37,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x33,0x34,0x20,0x3d,0x20,0x6c,0x69,
-    0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x20,0x2a,0x20,0x31,0x32,0x2e,0x39,0x32,0x30,
+    0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x54,
+    0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x44,0x69,0x73,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x20,0x3d,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x20,0x2a,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x28,
+    0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x20,
+    0x2a,0x20,0x5f,0x32,0x35,0x29,0x20,0x2d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,
+    0x6f,0x74,0x48,0x61,0x6c,0x66,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x35,0x20,
+    0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,
+    0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x20,0x2a,0x20,
+    0x5f,0x33,0x33,0x29,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,
+    0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x43,0x6f,0x72,0x72,0x65,0x6c,0x61,0x74,
+    0x65,0x64,0x46,0x61,0x73,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x44,0x6f,0x74,0x56,0x69,0x65,0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x66,
+    0x20,0x2f,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,
+    0x67,0x68,0x74,0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,
+    0x74,0x56,0x69,0x65,0x77,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x56,0x69,
+    0x65,0x77,0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,
+    0x4c,0x69,0x67,0x68,0x74,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x46,0x72,
+    0x65,0x73,0x6e,0x65,0x6c,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x37,0x20,0x3d,0x20,0x31,0x2e,0x30,
+    0x66,0x20,0x2d,0x20,0x76,0x69,0x65,0x77,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x30,0x20,0x3d,
+    0x20,0x5f,0x35,0x37,0x20,0x2a,0x20,0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x36,0x30,
+    0x20,0x2a,0x20,0x5f,0x36,0x30,0x29,0x20,0x2a,0x20,0x5f,0x35,0x37,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x66,0x30,0x20,0x2a,0x20,
+    0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x5f,0x36,0x35,0x29,0x29,0x20,0x2b,0x20,
+    0x28,0x5f,0x36,0x35,0x29,0x2e,0x78,0x78,0x78,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x47,0x65,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,
+    0x74,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x37,0x35,0x20,
+    0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+    0x2f,0x20,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x28,0x28,0x28,0x5f,0x37,0x35,0x20,0x2a,0x20,
+    0x5f,0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,0x37,
+    0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x38,0x34,
+    0x20,0x2a,0x20,0x5f,0x38,0x34,0x29,0x20,0x2f,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,
+    0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,
+    0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x47,0x65,
+    0x74,0x4d,0x61,0x70,0x70,0x65,0x64,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x65,0x72,0x74,0x65,0x78,
+    0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x30,0x31,0x20,
+    0x3d,0x20,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x66,0x29,0x20,0x2d,0x20,0x28,0x31,0x2e,0x30,0x66,0x29,
+    0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x31,0x30,0x34,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x31,0x34,
+    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2d,
+    0x20,0x28,0x5f,0x31,0x30,0x34,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x30,
+    0x34,0x2c,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x2e,0x78,0x79,0x7a,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x31,0x32,0x31,0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,
+    0x28,0x5f,0x31,0x30,0x34,0x2c,0x20,0x5f,0x31,0x31,0x34,0x29,0x20,0x2a,0x20,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x28,0x28,0x28,0x5f,0x31,0x31,0x34,0x20,0x2a,0x20,0x5f,0x31,
+    0x30,0x31,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x5f,0x31,0x32,0x31,0x20,0x2a,0x20,
+    0x5f,0x31,0x30,0x31,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x31,0x30,0x34,
+    0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x53,0x72,0x67,0x62,0x54,0x6f,0x4c,0x69,0x6e,
+    0x65,0x61,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x73,0x72,0x67,0x62,0x43,
+    0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,
+    0x33,0x20,0x5f,0x31,0x34,0x30,0x20,0x3d,0x20,0x28,0x73,0x72,0x67,0x62,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3c,0x20,0x28,0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,
+    0x39,0x39,0x32,0x37,0x32,0x38,0x32,0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,
+    0x34,0x33,0x37,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x34,0x38,0x20,0x3d,0x20,0x70,
+    0x6f,0x77,0x28,0x28,0x73,0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2b,0x20,
+    0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,
+    0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x66,0x29,
+    0x2e,0x78,0x78,0x78,0x29,0x20,0x2f,0x20,0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,
+    0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,
+    0x32,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x2c,0x20,0x28,0x32,0x2e,0x34,0x30,0x30,
+    0x30,0x30,0x30,0x30,0x39,0x35,0x33,0x36,0x37,0x34,0x33,0x31,0x36,0x34,0x30,0x36,
+    0x32,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,0x73,0x72,0x67,
+    0x62,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x28,0x31,0x32,0x2e,0x39,0x32,0x30,
     0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,
-    0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x31,0x31,0x38,0x2e,0x78,
-    0x20,0x3f,0x20,0x5f,0x31,0x33,0x34,0x2e,0x78,0x20,0x3a,0x20,0x5f,0x31,0x32,0x39,
-    0x2e,0x78,0x2c,0x20,0x5f,0x31,0x31,0x38,0x2e,0x79,0x20,0x3f,0x20,0x5f,0x31,0x33,
-    0x34,0x2e,0x79,0x20,0x3a,0x20,0x5f,0x31,0x32,0x39,0x2e,0x79,0x2c,0x20,0x5f,0x31,
-    0x31,0x38,0x2e,0x7a,0x20,0x3f,0x20,0x5f,0x31,0x33,0x34,0x2e,0x7a,0x20,0x3a,0x20,
-    0x5f,0x31,0x32,0x39,0x2e,0x7a,0x2c,0x20,0x5f,0x31,0x31,0x38,0x2e,0x77,0x20,0x3f,
-    0x20,0x5f,0x31,0x33,0x34,0x2e,0x77,0x20,0x3a,0x20,0x5f,0x31,0x32,0x39,0x2e,0x77,
-    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,
-    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x70,0x62,0x72,0x41,
-    0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x53,0x61,0x6d,
-    0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,
-    0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x5f,0x32,0x30,0x38,0x20,0x3d,0x20,0x70,0x62,0x72,0x52,0x6f,0x75,
+    0x66,0x29,0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x5f,0x31,0x34,0x30,0x20,0x3f,0x20,0x5f,0x31,0x35,0x32,0x20,0x3a,
+    0x20,0x5f,0x31,0x34,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x63,0x65,0x73,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x36,0x31,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x30,0x2e,0x36,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x32,0x33,0x38,0x34,0x31,0x38,0x35,0x37,0x39,0x31,0x30,0x31,0x35,0x36,0x32,0x35,
+    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,0x2a,0x20,0x28,0x28,0x5f,0x31,
+    0x36,0x31,0x20,0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,
+    0x34,0x36,0x33,0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x66,0x29,0x20,
+    0x2b,0x20,0x28,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x33,0x32,
+    0x39,0x34,0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,0x36,0x38,
+    0x37,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x5f,
+    0x31,0x36,0x31,0x20,0x2a,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,0x2a,0x20,0x32,
+    0x2e,0x34,0x33,0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,0x32,0x30,0x32,
+    0x31,0x34,0x38,0x34,0x33,0x37,0x35,0x66,0x29,0x20,0x2b,0x20,0x28,0x30,0x2e,0x35,
+    0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,0x32,0x39,
+    0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x29,0x29,0x20,
+    0x2b,0x20,0x28,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x39,
+    0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x66,
+    0x29,0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x28,0x30,0x2e,0x30,0x66,0x29,0x2e,0x78,
+    0x78,0x78,0x2c,0x20,0x28,0x31,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x54,0x6f,0x6e,0x65,0x6d,
+    0x61,0x70,0x41,0x67,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x78,0x33,0x20,0x5f,0x31,0x39,0x30,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x78,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x38,0x34,0x32,0x34,
+    0x37,0x39,0x30,0x35,0x30,0x31,0x35,0x39,0x34,0x35,0x34,0x33,0x34,0x35,0x37,0x30,
+    0x33,0x31,0x32,0x35,0x66,0x2c,0x20,0x30,0x2e,0x30,0x34,0x32,0x33,0x32,0x38,0x32,
+    0x34,0x32,0x32,0x31,0x32,0x35,0x33,0x33,0x39,0x35,0x30,0x38,0x30,0x35,0x36,0x36,
+    0x34,0x30,0x36,0x32,0x35,0x66,0x2c,0x20,0x30,0x2e,0x30,0x34,0x32,0x33,0x37,0x35,
+    0x36,0x35,0x33,0x39,0x38,0x32,0x31,0x36,0x32,0x34,0x37,0x35,0x35,0x38,0x35,0x39,
+    0x33,0x37,0x35,0x66,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,
+    0x30,0x37,0x38,0x34,0x33,0x33,0x36,0x30,0x33,0x30,0x34,0x38,0x33,0x32,0x34,0x35,
+    0x38,0x34,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,0x2c,0x20,0x30,0x2e,0x38,0x37,
+    0x38,0x34,0x36,0x38,0x36,0x33,0x32,0x36,0x39,0x38,0x30,0x35,0x39,0x30,0x38,0x32,
+    0x30,0x33,0x31,0x32,0x35,0x66,0x2c,0x20,0x30,0x2e,0x30,0x37,0x38,0x34,0x33,0x33,
+    0x36,0x30,0x33,0x30,0x34,0x38,0x33,0x32,0x34,0x35,0x38,0x34,0x39,0x36,0x30,0x39,
+    0x33,0x37,0x35,0x66,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,
+    0x30,0x37,0x39,0x32,0x32,0x33,0x37,0x34,0x34,0x35,0x37,0x31,0x32,0x30,0x38,0x39,
+    0x35,0x33,0x38,0x35,0x37,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x2c,0x20,0x30,0x2e,
+    0x30,0x37,0x39,0x31,0x36,0x36,0x31,0x32,0x39,0x32,0x33,0x31,0x34,0x35,0x32,0x39,
+    0x34,0x31,0x38,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,0x2c,0x20,0x30,0x2e,0x38,
+    0x37,0x39,0x31,0x34,0x32,0x39,0x39,0x39,0x36,0x34,0x39,0x30,0x34,0x37,0x38,0x35,
+    0x31,0x35,0x36,0x32,0x35,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x78,0x33,0x20,0x5f,0x31,0x39,0x39,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x78,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,
+    0x31,0x39,0x36,0x38,0x37,0x39,0x30,0x32,0x39,0x32,0x37,0x33,0x39,0x38,0x36,0x38,
+    0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x35,0x32,
+    0x38,0x39,0x36,0x38,0x35,0x33,0x35,0x33,0x36,0x33,0x36,0x37,0x34,0x31,0x36,0x33,
+    0x38,0x31,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,0x30,
+    0x35,0x32,0x39,0x37,0x31,0x36,0x33,0x35,0x30,0x31,0x33,0x38,0x31,0x38,0x37,0x34,
+    0x30,0x38,0x34,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x2d,0x30,0x2e,0x30,0x39,0x38,0x30,0x32,0x30,0x38,
+    0x38,0x31,0x34,0x31,0x34,0x34,0x31,0x33,0x34,0x35,0x32,0x31,0x34,0x38,0x34,0x33,
+    0x37,0x35,0x66,0x2c,0x20,0x31,0x2e,0x31,0x35,0x31,0x39,0x30,0x33,0x31,0x35,0x32,
+    0x34,0x36,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,
+    0x30,0x39,0x38,0x30,0x34,0x33,0x34,0x34,0x39,0x32,0x32,0x33,0x30,0x34,0x31,0x35,
+    0x33,0x34,0x34,0x32,0x33,0x38,0x32,0x38,0x31,0x32,0x35,0x66,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x2d,0x30,0x2e,0x30,0x39,0x39,0x30,0x32,0x39,0x37,
+    0x34,0x32,0x31,0x38,0x31,0x33,0x30,0x31,0x31,0x31,0x36,0x39,0x34,0x33,0x33,0x35,
+    0x39,0x33,0x37,0x35,0x66,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x39,0x38,0x39,0x36,0x31,
+    0x31,0x37,0x34,0x34,0x38,0x38,0x30,0x36,0x37,0x36,0x32,0x36,0x39,0x35,0x33,0x31,
+    0x32,0x35,0x66,0x2c,0x20,0x31,0x2e,0x31,0x35,0x31,0x30,0x37,0x33,0x36,0x39,0x34,
+    0x32,0x32,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x66,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x31,
+    0x34,0x20,0x3d,0x20,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,0x67,0x32,0x28,
+    0x6d,0x61,0x78,0x28,0x6d,0x75,0x6c,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x5f,
+    0x31,0x39,0x30,0x29,0x2c,0x20,0x28,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x31,0x33,0x33,0x35,0x31,0x34,0x33,0x31,0x39,0x36,0x30,0x30,0x31,0x38,0x30,0x38,
+    0x39,0x37,0x33,0x39,0x36,0x30,0x35,0x38,0x65,0x2d,0x31,0x30,0x66,0x29,0x2e,0x78,
+    0x78,0x78,0x29,0x29,0x2c,0x20,0x28,0x2d,0x31,0x32,0x2e,0x34,0x37,0x33,0x39,0x33,
+    0x30,0x33,0x35,0x38,0x38,0x38,0x36,0x37,0x31,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,
+    0x78,0x78,0x2c,0x20,0x28,0x34,0x2e,0x30,0x32,0x36,0x30,0x36,0x39,0x31,0x36,0x34,
+    0x32,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,
+    0x78,0x78,0x29,0x20,0x2d,0x20,0x28,0x2d,0x31,0x32,0x2e,0x34,0x37,0x33,0x39,0x33,
+    0x30,0x33,0x35,0x38,0x38,0x38,0x36,0x37,0x31,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,
+    0x78,0x78,0x29,0x20,0x2f,0x20,0x28,0x31,0x36,0x2e,0x34,0x39,0x39,0x39,0x39,0x38,
+    0x30,0x39,0x32,0x36,0x35,0x31,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x66,0x29,0x2e,
+    0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x5f,0x32,0x31,0x37,0x20,0x3d,0x20,0x5f,0x32,0x31,0x34,0x20,0x2a,0x20,0x5f,0x32,
+    0x31,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x32,0x32,0x30,0x20,0x3d,0x20,0x5f,0x32,0x31,0x37,0x20,0x2a,0x20,0x5f,0x32,0x31,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,
+    0x35,0x31,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x5f,0x32,0x32,0x30,
+    0x20,0x2a,0x20,0x31,0x35,0x2e,0x35,0x66,0x29,0x20,0x2a,0x20,0x5f,0x32,0x31,0x37,
+    0x29,0x20,0x2d,0x20,0x28,0x28,0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,0x34,0x30,0x2e,
+    0x31,0x33,0x39,0x39,0x39,0x39,0x33,0x38,0x39,0x36,0x34,0x38,0x34,0x33,0x37,0x35,
+    0x66,0x29,0x20,0x2a,0x20,0x5f,0x32,0x31,0x34,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,
+    0x32,0x32,0x30,0x20,0x2a,0x20,0x33,0x31,0x2e,0x39,0x35,0x39,0x39,0x39,0x39,0x30,
+    0x38,0x34,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x66,0x29,0x29,0x20,0x2d,0x20,
+    0x28,0x28,0x5f,0x32,0x31,0x37,0x20,0x2a,0x20,0x36,0x2e,0x38,0x36,0x38,0x30,0x30,
+    0x30,0x30,0x33,0x30,0x35,0x31,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x29,0x20,
+    0x2a,0x20,0x5f,0x32,0x31,0x34,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x31,0x37,
+    0x20,0x2a,0x20,0x30,0x2e,0x34,0x32,0x39,0x38,0x30,0x30,0x30,0x30,0x33,0x37,0x36,
+    0x37,0x30,0x31,0x33,0x35,0x34,0x39,0x38,0x30,0x34,0x36,0x38,0x37,0x35,0x66,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x31,0x34,0x20,0x2a,0x20,0x30,0x2e,0x31,0x31,
+    0x39,0x30,0x39,0x39,0x39,0x39,0x36,0x39,0x38,0x34,0x30,0x30,0x34,0x39,0x37,0x34,
+    0x33,0x36,0x35,0x32,0x33,0x34,0x33,0x37,0x35,0x66,0x29,0x29,0x20,0x2d,0x20,0x28,
+    0x30,0x2e,0x30,0x30,0x32,0x33,0x31,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x34,0x39,
+    0x35,0x37,0x30,0x30,0x38,0x33,0x36,0x31,0x38,0x31,0x36,0x34,0x30,0x36,0x32,0x35,
+    0x66,0x29,0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x70,0x6f,0x77,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,0x75,0x6c,
+    0x28,0x5f,0x32,0x35,0x31,0x2c,0x20,0x5f,0x31,0x39,0x39,0x29,0x2c,0x20,0x28,0x30,
+    0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,0x2c,0x20,0x28,0x31,0x2e,0x30,0x66,0x29,
+    0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,
+    0x66,0x29,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x41,0x70,0x70,0x6c,0x79,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x69,0x6e,
+    0x74,0x20,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,
+    0x65,0x72,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x2f,0x20,0x28,0x28,0x31,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,
+    0x78,0x20,0x2b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6e,
+    0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x6f,0x6e,0x65,0x6d,
+    0x61,0x70,0x41,0x63,0x65,0x73,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x33,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x67,0x58,
+    0x28,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x28,0x30,0x2e,0x30,0x66,0x29,
+    0x2e,0x78,0x78,0x78,0x2c,0x20,0x28,0x31,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x4c,0x69,0x6e,0x65,0x61,
+    0x72,0x54,0x6f,0x53,0x72,0x67,0x62,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6c,
+    0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x33,0x20,0x5f,0x32,0x38,0x38,0x20,0x3d,0x20,0x28,
+    0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3c,0x20,0x28,0x30,
+    0x2e,0x30,0x30,0x33,0x31,0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,
+    0x31,0x39,0x30,0x32,0x37,0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x66,
+    0x29,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x32,0x39,0x37,0x20,0x3d,0x20,0x28,0x28,0x31,0x2e,0x30,0x35,
+    0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,
+    0x36,0x35,0x36,0x32,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x20,0x2a,0x20,0x70,0x6f,
+    0x77,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x28,
+    0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,
+    0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x29,0x2e,0x78,0x78,
+    0x78,0x29,0x29,0x20,0x2d,0x20,0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,
+    0x36,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x30,0x31,0x20,0x3d,0x20,0x6c,0x69,
+    0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x28,0x31,0x32,0x2e,
+    0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,
+    0x31,0x32,0x35,0x66,0x29,0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x38,0x38,0x20,0x3f,0x20,0x5f,0x33,0x30,
+    0x31,0x20,0x3a,0x20,0x5f,0x32,0x39,0x37,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x48,0x64,0x72,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x68,0x64,0x72,0x43,0x6f,0x6c,0x6f,0x72,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,
+    0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x4c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x72,
+    0x67,0x62,0x28,0x41,0x70,0x70,0x6c,0x79,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x28,
+    0x68,0x64,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x65,0x78,0x70,0x6f,0x73,
+    0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x2c,0x20,0x69,0x6e,0x74,
+    0x28,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,
+    0x79,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,
+    0x33,0x30,0x20,0x3d,0x20,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,
+    0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,
+    0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x33,0x34,
+    0x20,0x3d,0x20,0x53,0x72,0x67,0x62,0x54,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,
+    0x5f,0x33,0x33,0x30,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x34,0x33,0x20,0x3d,0x20,0x70,0x62,0x72,0x4f,
+    0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,
+    0x69,0x6f,0x6e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,0x67,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x35,0x30,0x20,
+    0x3d,0x20,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,
     0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x53,0x61,
-    0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-    0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,
-    0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x31,0x31,0x20,0x3d,0x20,0x5f,0x32,0x30,
-    0x38,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
-    0x5f,0x32,0x31,0x36,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-    0x28,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x33,0x30,0x20,0x3d,0x20,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x32,0x32,0x30,0x5f,0x6c,
-    0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x66,0x72,
-    0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
-    0x3d,0x20,0x5f,0x32,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x28,0x5f,0x32,
-    0x31,0x36,0x20,0x2b,0x20,0x5f,0x32,0x33,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
-    0x66,0x2e,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x5f,0x32,0x31,0x31,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x36,0x30,0x20,
-    0x3d,0x20,0x5f,0x32,0x31,0x31,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x34,0x20,0x3d,0x20,0x5f,0x32,0x31,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x32,0x32,0x30,0x5f,0x63,0x61,
-    0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x66,0x72,
-    0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,
-    0x3d,0x20,0x5f,0x32,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x28,0x5f,0x32,0x36,
-    0x30,0x20,0x2a,0x20,0x5f,0x32,0x36,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x31,0x32,
-    0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
-    0x38,0x34,0x20,0x3d,0x20,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,
-    0x6e,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x20,
-    0x2b,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x6d,0x69,0x74,0x68,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,
-    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x32,0x32,0x30,0x5f,0x74,
-    0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x28,0x28,0x74,0x6f,0x4c,
-    0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x29,0x20,0x2a,
-    0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,
-    0x29,0x20,0x2a,0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x39,0x29,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
-    0x5f,0x32,0x38,0x34,0x2c,0x20,0x5f,0x32,0x38,0x34,0x2c,0x20,0x5f,0x32,0x38,0x34,
-    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
-    0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x6f,0x6d,0x4c,0x69,
-    0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x29,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
-    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
-    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,
-    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,
-    0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,
+    0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
+    0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,
+    0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,
+    0x35,0x38,0x20,0x3d,0x20,0x5f,0x33,0x35,0x30,0x2e,0x7a,0x20,0x2a,0x20,0x5f,0x39,
+    0x35,0x5f,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x36,
+    0x36,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x33,0x35,0x30,0x2e,0x79,
+    0x20,0x2a,0x20,0x5f,0x39,0x35,0x5f,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x50,0x61,
+    0x72,0x61,0x6d,0x73,0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,0x34,0x35,0x30,0x30,0x30,
+    0x30,0x30,0x31,0x37,0x38,0x38,0x31,0x33,0x39,0x33,0x34,0x33,0x32,0x36,0x31,0x37,
+    0x31,0x38,0x37,0x35,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x36,0x39,0x20,0x3d,0x20,0x5f,
+    0x33,0x36,0x36,0x20,0x2a,0x20,0x5f,0x33,0x36,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x38,0x30,0x20,0x3d,0x20,0x28,0x66,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x5f,0x33,0x33,0x34,0x2c,0x20,0x5f,0x33,0x33,0x30,0x2e,0x77,0x29,0x29,
+    0x20,0x2a,0x20,0x5f,0x39,0x35,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x38,0x36,0x20,0x3d,0x20,0x5f,
+    0x33,0x38,0x30,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,
+    0x2d,0x20,0x5f,0x33,0x35,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x33,0x39,0x32,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,
+    0x28,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,0x39,
+    0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x66,0x29,
+    0x2e,0x78,0x78,0x78,0x2c,0x20,0x5f,0x33,0x38,0x30,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x28,0x5f,0x33,0x35,0x38,0x29,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x30,0x30,0x20,0x3d,0x20,0x5f,
+    0x31,0x31,0x30,0x5f,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,
+    0x20,0x2d,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x33,0x20,
+    0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x5f,0x34,0x30,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x31,0x33,0x20,
+    0x3d,0x20,0x47,0x65,0x74,0x4d,0x61,0x70,0x70,0x65,0x64,0x4e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x28,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x66,0x72,
+    0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x70,0x62,0x72,0x4e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x2c,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,
+    0x6f,0x6f,0x72,0x64,0x29,0x2e,0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x31,0x38,0x20,0x3d,0x20,0x5f,0x34,
+    0x30,0x30,0x20,0x2f,0x20,0x28,0x5f,0x34,0x30,0x33,0x29,0x2e,0x78,0x78,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x32,0x35,
+    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x31,0x31,
+    0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x20,
+    0x2d,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x32,0x39,
+    0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x34,0x32,
+    0x35,0x20,0x2b,0x20,0x5f,0x34,0x31,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x33,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x32,0x35,0x29,0x2c,
+    0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,
+    0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,
+    0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x31,0x38,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x34,0x35,0x20,0x3d,0x20,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,
+    0x5f,0x34,0x32,0x39,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x35,0x30,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x31,0x38,0x2c,0x20,0x5f,0x34,0x32,0x39,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,
+    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x70,0x62,0x72,0x44,0x66,
+    0x67,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,
+    0x70,0x62,0x72,0x44,0x66,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x34,0x33,0x35,0x2c,0x20,0x5f,0x33,0x36,0x36,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x34,0x37,0x33,0x20,0x3d,0x20,0x28,0x31,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,
+    0x20,0x2b,0x20,0x28,0x5f,0x33,0x39,0x32,0x20,0x2a,0x20,0x28,0x28,0x31,0x2e,0x30,
+    0x66,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x5f,0x34,0x35,0x39,0x2e,0x78,0x20,0x2b,
+    0x20,0x5f,0x34,0x35,0x39,0x2e,0x79,0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,
+    0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x35,0x66,0x29,
+    0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,0x28,0x28,
+    0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,0x5f,
+    0x34,0x35,0x30,0x2c,0x20,0x5f,0x33,0x39,0x32,0x29,0x20,0x2a,0x20,0x28,0x44,0x69,
+    0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,0x58,0x28,0x5f,0x34,
+    0x34,0x35,0x2c,0x20,0x5f,0x33,0x36,0x39,0x29,0x20,0x2a,0x20,0x56,0x69,0x73,0x69,
+    0x62,0x69,0x6c,0x69,0x74,0x79,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,0x58,0x43,0x6f,
+    0x72,0x72,0x65,0x6c,0x61,0x74,0x65,0x64,0x46,0x61,0x73,0x74,0x28,0x5f,0x34,0x33,
+    0x35,0x2c,0x20,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x33,0x36,0x39,0x29,0x29,0x29,
+    0x20,0x2a,0x20,0x5f,0x34,0x37,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x35,0x30,0x38,0x20,0x3d,0x20,0x28,0x5f,0x31,0x31,0x30,
+    0x5f,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x2e,0x77,0x20,0x2a,0x20,0x47,0x65,
+    0x74,0x50,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x41,0x74,0x74,0x65,0x6e,
+    0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x5f,0x34,0x30,0x33,0x2c,0x20,0x5f,0x31,0x31,
+    0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x2e,0x77,0x29,0x29,0x20,
+    0x2a,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x35,0x31,0x32,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x38,0x36,
+    0x20,0x2f,0x20,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,
+    0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,
+    0x78,0x78,0x29,0x20,0x2b,0x20,0x5f,0x34,0x39,0x35,0x29,0x20,0x2a,0x20,0x5f,0x35,
+    0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x35,0x32,0x37,0x20,0x3d,0x20,0x28,0x28,0x5f,0x33,0x38,0x36,0x20,0x2b,0x20,0x28,
+    0x28,0x28,0x5f,0x33,0x39,0x32,0x20,0x2a,0x20,0x5f,0x34,0x35,0x39,0x2e,0x78,0x29,
+    0x20,0x2b,0x20,0x28,0x5f,0x34,0x35,0x39,0x2e,0x79,0x29,0x2e,0x78,0x78,0x78,0x29,
+    0x20,0x2a,0x20,0x5f,0x34,0x37,0x33,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x31,0x30,
+    0x5f,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x79,
+    0x7a,0x29,0x20,0x2a,0x20,0x5f,0x33,0x34,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x48,0x64,0x72,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,
+    0x5f,0x35,0x31,0x32,0x20,0x2b,0x20,0x5f,0x35,0x32,0x37,0x2c,0x20,0x5f,0x31,0x31,
+    0x30,0x5f,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,
+    0x29,0x2c,0x20,0x5f,0x33,0x38,0x30,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
     0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
     0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,
     0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,
-    0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
-    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
-    0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
-    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
-    0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    cbuffer pbr_FrameVertParams : register(b0)
+    {
+        row_major float4x4 _19_view : packoffset(c0);
+        row_major float4x4 _19_projection : packoffset(c4);
+    };
+
+    cbuffer pbr_DrawVertParams : register(b1)
+    {
+        row_major float4x4 _27_world : packoffset(c0);
+        float4 _27_uvTransform : packoffset(c4);
+    };
+
+
+    static precise float4 gl_Position;
+    static float3 position;
+
+    struct SPIRV_Cross_Input
+    {
+        float3 position : TEXCOORD0;
+    };
+
+    struct SPIRV_Cross_Output
+    {
+        precise float4 gl_Position : SV_Position;
+    };
+
+    void vert_main()
+    {
+        gl_Position = mul(mul(mul(float4(position, 1.0f), _27_world), _19_view), _19_projection);
+    }
+
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        position = stage_input.position;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        return stage_output;
+    }
+*/
+static const uint8_t depth_vertex_shader_source_hlsl5[838] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,
+    0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x76,0x69,0x65,0x77,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x31,0x39,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,
+    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,
+    0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x62,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,
+    0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x32,
+    0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x37,0x5f,0x75,0x76,0x54,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x6d,
+    0x75,0x6c,0x28,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,0x5f,
+    0x32,0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x29,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x76,
+    0x69,0x65,0x77,0x29,0x2c,0x20,0x5f,0x31,0x39,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,
+    0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    static float4 frag_color;
+
+    struct SPIRV_Cross_Output
+    {
+        float4 frag_color : SV_Target0;
+    };
+
+    void frag_main()
+    {
+        frag_color = 1.0f.xxxx;
+    }
+
+    SPIRV_Cross_Output main()
+    {
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.frag_color = frag_color;
+        return stage_output;
+    }
+*/
+static const uint8_t depth_fragment_shader_source_hlsl5[297] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,
+    0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,
+    0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -946,105 +1980,156 @@ static const uint8_t fragment_shader_source_hlsl5[4024] = {
 
     using namespace metal;
 
-    struct pbr_VertParams
+    struct pbr_FrameVertParams
     {
-        float4x4 world;
         float4x4 view;
         float4x4 projection;
     };
 
+    struct pbr_DrawVertParams
+    {
+        float4x4 world;
+        float4 uvTransform;
+    };
+
     struct main0_out
     {
         float3 fragPosition [[user(locn0)]];
         float3 fragNormal [[user(locn1)]];
-        float2 fragSampleCoord [[user(locn2)]];
-        float4 fragColor [[user(locn3)]];
-        float4 gl_Position [[position]];
+        float4 fragTangent [[user(locn2)]];
+        float2 fragSampleCoord [[user(locn3)]];
+        float4 fragColor [[user(locn4)]];
+        float4 gl_Position [[position, invariant]];
     };
 
     struct main0_in
     {
         float3 position [[attribute(0)]];
         float3 normal [[attribute(1)]];
-        float2 texCoord0 [[attribute(2)]];
-        float4 color0 [[attribute(3)]];
+        float4 tangent [[attribute(2)]];
+        float2 texCoord0 [[attribute(3)]];
+        float4 color0 [[attribute(4)]];
     };
 
-    vertex main0_out main0(main0_in in [[stage_in]], constant pbr_VertParams& _19 [[buffer(0)]])
+    vertex main0_out main0(main0_in in [[stage_in]], constant pbr_FrameVertParams& _19 [[buffer(0)]], constant pbr_DrawVertParams& _27 [[buffer(1)]])
     {
         main0_out out = {};
-        float4 _38 = _19.world * float4(in.position, 1.0);
-        out.gl_Position = _19.projection * (_19.view * _38);
-        out.fragPosition = _38.xyz;
-        out.fragNormal = (_19.world * float4(in.normal, 0.0)).xyz;
-        out.fragSampleCoord = in.texCoord0;
+        out.gl_Position = _19.projection * (_19.view * (_27.world * float4(in.position, 1.0)));
+        out.fragPosition = (_27.world * float4(in.position, 1.0)).xyz;
+        float3 _70 = _27.world[0].xyz;
+        float3 _74 = _27.world[1].xyz;
+        float3 _78 = _27.world[2].xyz;
+        float _84 = dot(_70, cross(_74, _78));
+        out.fragNormal = (((cross(_74, _78) * in.normal.x) + (cross(_78, _70) * in.normal.y)) + (cross(_70, _74) * in.normal.z)) / float3(_84);
+        out.fragTangent = float4(((_70 * in.tangent.x) + (_74 * in.tangent.y)) + (_78 * in.tangent.z), in.tangent.w * ((_84 < 0.0) ? (-1.0) : 1.0));
+        out.fragSampleCoord = fma(in.texCoord0, _27.uvTransform.xy, _27.uvTransform.zw);
         out.fragColor = in.color0;
         return out;
     }
 
 */
-static const uint8_t vertex_shader_source_metal_macos[974] = {
+static const uint8_t vertex_shader_source_metal_macos[1606] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
     0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
     0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,
-    0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x77,0x6f,0x72,
-    0x6c,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,
-    0x20,0x76,0x69,0x65,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x78,0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
-    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,
-    0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,
-    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,
-    0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
-    0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,
-    0x64,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,
-    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
-    0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
-    0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,
+    0x34,0x20,0x76,0x69,0x65,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x78,0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x62,0x72,0x5f,
+    0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x77,0x6f,
+    0x72,0x6c,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x76,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,
+    0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,
+    0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,
+    0x20,0x69,0x6e,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
     0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
     0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
     0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
     0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
     0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x61,0x74,
     0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,
-    0x64,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,
-    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
-    0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,
-    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
-    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
-    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
-    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,0x72,0x5f,0x56,0x65,0x72,0x74,0x50,
-    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,
-    0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,
-    0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x20,0x2a,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-    0x20,0x5f,0x31,0x39,0x2e,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,
-    0x2a,0x20,0x28,0x5f,0x31,0x39,0x2e,0x76,0x69,0x65,0x77,0x20,0x2a,0x20,0x5f,0x33,
-    0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x33,0x38,0x2e,0x78,
-    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,
-    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x5f,0x31,0x39,0x2e,0x77,0x6f,
-    0x72,0x6c,0x64,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,
-    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x53,
-    0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x74,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-    0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,
+    0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,0x72,0x5f,
+    0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,0x72,
+    0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x32,0x37,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x29,
+    0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x20,0x2a,0x20,0x28,0x5f,0x31,0x39,0x2e,0x76,0x69,0x65,0x77,0x20,0x2a,
+    0x20,0x28,0x5f,0x32,0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x28,0x5f,0x32,0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,0x30,0x20,0x3d,0x20,0x5f,0x32,
+    0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,0x34,0x20,0x3d,
+    0x20,0x5f,0x32,0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x5b,0x31,0x5d,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,
+    0x38,0x20,0x3d,0x20,0x5f,0x32,0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x5b,0x32,0x5d,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x38,0x34,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x37,0x30,0x2c,0x20,0x63,
+    0x72,0x6f,0x73,0x73,0x28,0x5f,0x37,0x34,0x2c,0x20,0x5f,0x37,0x38,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x20,0x3d,0x20,0x28,0x28,0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,
+    0x37,0x34,0x2c,0x20,0x5f,0x37,0x38,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x72,0x6f,0x73,0x73,
+    0x28,0x5f,0x37,0x38,0x2c,0x20,0x5f,0x37,0x30,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x72,
+    0x6f,0x73,0x73,0x28,0x5f,0x37,0x30,0x2c,0x20,0x5f,0x37,0x34,0x29,0x20,0x2a,0x20,
+    0x69,0x6e,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x7a,0x29,0x29,0x20,0x2f,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x38,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x28,0x28,0x5f,0x37,0x30,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x37,0x34,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x37,0x38,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x7a,0x29,0x2c,0x20,
+    0x69,0x6e,0x2e,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x20,0x2a,0x20,0x28,
+    0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,
+    0x31,0x2e,0x30,0x29,0x20,0x3a,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x69,0x6e,0x2e,0x74,
+    0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x30,0x2c,0x20,0x5f,0x32,0x37,0x2e,0x75,0x76,
+    0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x2e,0x78,0x79,0x2c,0x20,0x5f,0x32,
+    0x37,0x2e,0x75,0x76,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x2e,0x7a,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -1054,11 +2139,18 @@ static const uint8_t vertex_shader_source_metal_macos[974] = {
 
     using namespace metal;
 
-    struct pbr_FragParams
+    struct pbr_FrameFragParams
     {
-        float4 tint;
         float4 lightPos;
         float4 cameraPos;
+        float4 ambientColor;
+        float4 exposureParams;
+    };
+
+    struct pbr_DrawFragParams
+    {
+        float4 tint;
+        float4 surfaceParams;
     };
 
     struct main0_out
@@ -1070,72 +2162,157 @@ static const uint8_t vertex_shader_source_metal_macos[974] = {
     {
         float3 fragPosition [[user(locn0)]];
         float3 fragNormal [[user(locn1)]];
-        float2 fragSampleCoord [[user(locn2)]];
-        float4 fragColor [[user(locn3)]];
+        float4 fragTangent [[user(locn2)]];
+        float2 fragSampleCoord [[user(locn3)]];
+        float4 fragColor [[user(locn4)]];
     };
 
     static inline __attribute__((always_inline))
-    float4 toLinear(thread const float4& sRGB)
+    float DistributionGGX(float normalDotHalf, float alpha)
+    {
+        float _25 = alpha * alpha;
+        float _33 = (((normalDotHalf * _25) - normalDotHalf) * normalDotHalf) + 1.0;
+        return _25 / ((3.1415927410125732421875 * _33) * _33);
+    }
+
+    static inline __attribute__((always_inline))
+    float VisibilitySmithGGXCorrelatedFast(float normalDotView, float normalDotLight, float alpha)
+    {
+        return 0.5 / ((normalDotLight * ((normalDotView * (1.0 - alpha)) + alpha)) + (normalDotView * ((normalDotLight * (1.0 - alpha)) + alpha)));
+    }
+
+    static inline __attribute__((always_inline))
+    float3 FresnelSchlick(float viewDotHalf, float3 f0)
+    {
+        float _57 = 1.0 - viewDotHalf;
+        float _60 = _57 * _57;
+        float _65 = (_60 * _60) * _57;
+        return (f0 * (1.0 - _65)) + float3(_65);
+    }
+
+    static inline __attribute__((always_inline))
+    float GetPointLightAttenuation(float lightDistance, float radius)
     {
-        return select(pow((sRGB + float4(0.054999999701976776123046875)) * float4(0.947867333889007568359375), float4(2.400000095367431640625)), sRGB * float4(0.077399380505084991455078125), sRGB < float4(0.040449999272823333740234375));
+        float _75 = lightDistance / radius;
+        float _84 = clamp(1.0 - (((_75 * _75) * _75) * _75), 0.0, 1.0);
+        return (_84 * _84) / ((lightDistance * lightDistance) + 1.0);
     }
 
     static inline __attribute__((always_inline))
-    float DistributionGGX(thread const float3& normal, thread const float3& halfVec, thread const float& roughness)
+    float3 GetMappedNormal(float3 vertexNormal, float4 vertexTangent, float3 normalSample)
     {
-        float _46 = fast::max(dot(normal, halfVec), 0.0);
-        float _59 = fma(_46 * _46, fma(roughness, roughness, -1.0), 1.0);
-        return (roughness * roughness) / ((3.1415927410125732421875 * _59) * _59);
+        float3 _101 = (normalSample * 2.0) - float3(1.0);
+        float3 _104 = normalize(vertexNormal);
+        float3 _114 = normalize(vertexTangent.xyz - (_104 * dot(_104, vertexTangent.xyz)));
+        float3 _121 = cross(_104, _114) * vertexTangent.w;
+        return normalize(((_114 * _101.x) + (_121 * _101.y)) + (_104 * _101.z));
     }
 
     static inline __attribute__((always_inline))
-    float GeometrySchlickGGX(thread const float& normalDotLightOrView, thread const float& roughness)
+    float3 SrgbToLinear(float3 srgbColor)
     {
-        return normalDotLightOrView / fma(normalDotLightOrView, 1.0 - roughness, roughness);
+        bool3 _140 = (srgbColor < float3(0.040449999272823333740234375));
+        float3 _148 = pow((srgbColor + float3(0.054999999701976776123046875)) / float3(1.05499994754791259765625), float3(2.400000095367431640625));
+        float3 _152 = srgbColor / float3(12.9200000762939453125);
+        return select(_148, _152, _140);
     }
 
     static inline __attribute__((always_inline))
-    float GeometrySmith(thread const float3& normal, thread const float3& viewDir, thread const float3& lightVec, thread const float& roughness)
+    float3 TonemapAces(float3 color)
     {
-        float param = fast::max(dot(normal, viewDir), 0.0);
-        float param_1 = roughness;
-        float param_2 = fast::max(dot(normal, lightVec), 0.0);
-        float param_3 = roughness;
-        return GeometrySchlickGGX(param, param_1) * GeometrySchlickGGX(param_2, param_3);
+        float3 _161 = color * 0.60000002384185791015625;
+        return clamp((_161 * ((_161 * 2.5099999904632568359375) + float3(0.02999999932944774627685546875))) / ((_161 * ((_161 * 2.4300000667572021484375) + float3(0.589999973773956298828125))) + float3(0.14000000059604644775390625)), float3(0.0), float3(1.0));
     }
 
     static inline __attribute__((always_inline))
-    float4 fromLinear(thread const float4& linearRGB)
+    float3 TonemapAgX(float3 color)
     {
-        return select(fma(float4(1.05499994754791259765625), pow(linearRGB, float4(0.4166666567325592041015625)), float4(-0.054999999701976776123046875)), linearRGB * float4(12.9200000762939453125), linearRGB < float4(0.003130800090730190277099609375));
+        float3x3 _190 = float3x3(float3(0.842479050159454345703125, 0.0423282422125339508056640625, 0.0423756539821624755859375), float3(0.0784336030483245849609375, 0.87846863269805908203125, 0.0784336030483245849609375), float3(0.079223744571208953857421875, 0.07916612923145294189453125, 0.8791429996490478515625));
+        float3x3 _199 = float3x3(float3(1.19687902927398681640625, -0.0528968535363674163818359375, -0.0529716350138187408447265625), float3(-0.0980208814144134521484375, 1.1519031524658203125, -0.098043449223041534423828125), float3(-0.099029742181301116943359375, -0.098961174488067626953125, 1.1510736942291259765625));
+        float3 _214 = (clamp(log2(max(_190 * color, float3(1.0000000133514319600180897396058e-10))), float3(-12.47393035888671875), float3(4.026069164276123046875)) - float3(-12.47393035888671875)) / float3(16.4999980926513671875);
+        float3 _217 = _214 * _214;
+        float3 _220 = _217 * _217;
+        float3 _251 = (((((((_220 * 15.5) * _217) - ((_220 * 40.1399993896484375) * _214)) + (_220 * 31.95999908447265625)) - ((_217 * 6.868000030517578125) * _214)) + (_217 * 0.4298000037670135498046875)) + (_214 * 0.119099996984004974365234375)) - float3(0.002319999970495700836181640625);
+        return pow(clamp(_199 * _251, float3(0.0), float3(1.0)), float3(2.2000000476837158203125));
     }
 
-    fragment main0_out main0(main0_in in [[stage_in]], constant pbr_FragParams& _220 [[buffer(0)]], texture2d<float> pbrAlbedoTexture [[texture(0)]], texture2d<float> pbrRoughnessTexture [[texture(1)]], sampler pbrAlbedoSampler [[sampler(0)]], sampler pbrRoughnessSampler [[sampler(1)]])
+    static inline __attribute__((always_inline))
+    float3 ApplyTonemap(float3 color, int tonemapper)
+    {
+        if (tonemapper == 1)
+        {
+            return color / (float3(1.0) + color);
+        }
+        else
+        {
+            if (tonemapper == 2)
+            {
+                return TonemapAces(color);
+            }
+            else
+            {
+                if (tonemapper == 3)
+                {
+                    return TonemapAgX(color);
+                }
+                else
+                {
+                    return clamp(color, float3(0.0), float3(1.0));
+                }
+            }
+        }
+    }
+
+    static inline __attribute__((always_inline))
+    float3 LinearToSrgb(float3 linearColor)
+    {
+        bool3 _288 = (linearColor < float3(0.003130800090730190277099609375));
+        float3 _297 = (float3(1.05499994754791259765625) * pow(linearColor, float3(0.4166666567325592041015625))) - float3(0.054999999701976776123046875);
+        float3 _301 = linearColor * float3(12.9200000762939453125);
+        return select(_297, _301, _288);
+    }
+
+    static inline __attribute__((always_inline))
+    float3 HdrToDisplay(float3 hdrColor, float4 exposureParams)
+    {
+        return LinearToSrgb(ApplyTonemap(hdrColor * exposureParams.x, int(exposureParams.y + 0.5)));
+    }
+
+    fragment main0_out main0(main0_in in [[stage_in]], constant pbr_FrameFragParams& _110 [[buffer(0)]], constant pbr_DrawFragParams& _95 [[buffer(1)]], texture2d<float> pbrAlbedoTexture [[texture(0)]], texture2d<float> pbrNormalTexture [[texture(1)]], texture2d<float> pbrMetallicRoughnessTexture [[texture(2)]], texture2d<float> pbrOcclusionTexture [[texture(3)]], texture2d<float> pbrDfgTexture [[texture(4)]], sampler pbrAlbedoSampler [[sampler(0)]], sampler pbrNormalSampler [[sampler(1)]], sampler pbrMetallicRoughnessSampler [[sampler(2)]], sampler pbrOcclusionSampler [[sampler(3)]], sampler pbrDfgSampler [[sampler(4)]])
     {
         main0_out out = {};
-        float4 param = pbrAlbedoTexture.sample(pbrAlbedoSampler, in.fragSampleCoord);
-        float4 _208 = pbrRoughnessTexture.sample(pbrRoughnessSampler, in.fragSampleCoord);
-        float _211 = _208.x;
-        float3 _216 = fast::normalize(in.fragNormal);
-        float3 _230 = fast::normalize(_220.lightPos.xyz - in.fragPosition);
-        float3 param_1 = _216;
-        float3 param_2 = (_216 + _230) * float3(0.5);
-        float param_3 = _211;
-        float _260 = _211 + 1.0;
-        float3 param_4 = _216;
-        float3 param_5 = fast::normalize(_220.cameraPos.xyz - in.fragPosition);
-        float3 param_6 = _230;
-        float param_7 = (_260 * _260) * 0.125;
-        float _284 = DistributionGGX(param_1, param_2, param_3) + GeometrySmith(param_4, param_5, param_6, param_7);
-        float4 param_8 = in.fragColor;
-        float4 param_9 = _220.tint;
-        float4 param_10 = ((toLinear(param_8) * toLinear(param)) * toLinear(param_9)) * float4(_284, _284, _284, 1.0);
-        out.frag_color = fromLinear(param_10);
+        float4 _330 = pbrAlbedoTexture.sample(pbrAlbedoSampler, in.fragSampleCoord);
+        float3 _334 = SrgbToLinear(_330.xyz);
+        float _343 = pbrOcclusionTexture.sample(pbrOcclusionSampler, in.fragSampleCoord).x;
+        float4 _350 = pbrMetallicRoughnessTexture.sample(pbrMetallicRoughnessSampler, in.fragSampleCoord);
+        float _358 = _350.z * _95.surfaceParams.x;
+        float _366 = clamp(_350.y * _95.surfaceParams.y, 0.04500000178813934326171875, 1.0);
+        float _369 = _366 * _366;
+        float4 _380 = (in.fragColor * float4(_334, _330.w)) * _95.tint;
+        float3 _386 = _380.xyz * (1.0 - _358);
+        float3 _392 = mix(float3(0.039999999105930328369140625), _380.xyz, float3(_358));
+        float3 _400 = _110.lightPos.xyz - in.fragPosition;
+        float _403 = length(_400);
+        float3 _413 = GetMappedNormal(in.fragNormal, in.fragTangent, pbrNormalTexture.sample(pbrNormalSampler, in.fragSampleCoord).xyz);
+        float3 _418 = _400 / float3(_403);
+        float3 _425 = normalize(_110.cameraPos.xyz - in.fragPosition);
+        float3 _429 = normalize(_425 + _418);
+        float _435 = max(dot(_413, _425), 9.9999997473787516355514526367188e-05);
+        float _440 = clamp(dot(_413, _418), 0.0, 1.0);
+        float _445 = clamp(dot(_413, _429), 0.0, 1.0);
+        float _450 = clamp(dot(_418, _429), 0.0, 1.0);
+        float4 _459 = pbrDfgTexture.sample(pbrDfgSampler, float2(_435, _366));
+        float3 _473 = float3(1.0) + (_392 * ((1.0 / max(_459.x + _459.y, 9.9999997473787516355514526367188e-05)) - 1.0));
+        float3 _495 = ((FresnelSchlick(_450, _392) * (DistributionGGX(_445, _369) * VisibilitySmithGGXCorrelatedFast(_435, _440, _369))) * _473);
+        float _508 = (_110.lightPos.w * GetPointLightAttenuation(_403, _110.cameraPos.w)) * _440;
+        float3 _512 = ((_386 / float3(3.1415927410125732421875)) + _495) * _508;
+        float3 _527 = ((_386 + (((_392 * _459.x) + float3(_459.y)) * _473)) * _110.ambientColor.xyz) * _343;
+        out.frag_color = float4(HdrToDisplay(_512 + _527, _110.exposureParams), _380.w);
         return out;
     }
 
 */
-static const uint8_t fragment_shader_source_metal_macos[3482] = {
+static const uint8_t fragment_shader_source_metal_macos[8157] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -1144,216 +2321,623 @@ static const uint8_t fragment_shader_source_metal_macos[3482] = {
     0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
     0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
     0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
-    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x67,
-    0x50,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
-    0x50,0x6f,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,
-    0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
-    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,
-    0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
-    0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,
-    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x4e,0x6f,
-    0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
-    0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
-    0x20,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,
-    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
-    0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,
+    0x65,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x61,
+    0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x43,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x65,0x78,0x70,
+    0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,
+    0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+    0x50,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x72,0x61,
+    0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x72,0x61,0x67,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x44,0x69,0x73,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x69,0x6f,0x6e,0x47,0x47,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x35,0x20,0x3d,0x20,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x2a,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x48,0x61,0x6c,0x66,0x20,0x2a,0x20,
+    0x5f,0x32,0x35,0x29,0x20,0x2d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,
+    0x48,0x61,0x6c,0x66,0x29,0x20,0x2a,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,
+    0x74,0x48,0x61,0x6c,0x66,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x35,0x20,0x2f,0x20,0x28,
+    0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,
+    0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,
+    0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
     0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
     0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
-    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
-    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x73,0x52,
-    0x47,0x42,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x70,0x6f,0x77,0x28,0x28,0x73,0x52,0x47,
-    0x42,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,0x30,0x35,0x34,
-    0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,
-    0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x28,0x30,0x2e,0x39,0x34,0x37,0x38,0x36,0x37,0x33,0x33,0x33,0x38,
-    0x38,0x39,0x30,0x30,0x37,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x29,0x2c,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x32,0x2e,0x34,0x30,0x30,0x30,0x30,0x30,
-    0x30,0x39,0x35,0x33,0x36,0x37,0x34,0x33,0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x29,
-    0x29,0x2c,0x20,0x73,0x52,0x47,0x42,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x28,0x30,0x2e,0x30,0x37,0x37,0x33,0x39,0x39,0x33,0x38,0x30,0x35,0x30,0x35,0x30,
-    0x38,0x34,0x39,0x39,0x31,0x34,0x35,0x35,0x30,0x37,0x38,0x31,0x32,0x35,0x29,0x2c,
-    0x20,0x73,0x52,0x47,0x42,0x20,0x3c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,
-    0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,0x32,0x38,0x32,0x33,
-    0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
-    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
-    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,
-    0x6f,0x6e,0x47,0x47,0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x6e,0x6f,0x72,0x6d,0x61,
-    0x6c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x68,0x61,0x6c,0x66,0x56,0x65,0x63,0x2c,
-    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x36,0x20,
-    0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,
-    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x61,0x6c,0x66,0x56,0x65,0x63,0x29,
-    0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x5f,0x35,0x39,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x5f,0x34,0x36,0x20,
-    0x2a,0x20,0x5f,0x34,0x36,0x2c,0x20,0x66,0x6d,0x61,0x28,0x72,0x6f,0x75,0x67,0x68,
-    0x6e,0x65,0x73,0x73,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,
-    0x20,0x2d,0x31,0x2e,0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,
-    0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,
-    0x20,0x2f,0x20,0x28,0x28,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,
-    0x30,0x31,0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x20,0x2a,0x20,
-    0x5f,0x35,0x39,0x29,0x20,0x2a,0x20,0x5f,0x35,0x39,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
-    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
-    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,0x6c,0x69,
-    0x63,0x6b,0x47,0x47,0x58,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
-    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-    0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,0x77,0x2c,0x20,
-    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,
-    0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,0x77,
-    0x20,0x2f,0x20,0x66,0x6d,0x61,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,
-    0x4c,0x69,0x67,0x68,0x74,0x4f,0x72,0x56,0x69,0x65,0x77,0x2c,0x20,0x31,0x2e,0x30,
-    0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x72,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x56,
+    0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x53,0x6d,0x69,0x74,0x68,0x47,0x47,
+    0x58,0x43,0x6f,0x72,0x72,0x65,0x6c,0x61,0x74,0x65,0x64,0x46,0x61,0x73,0x74,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x56,
+    0x69,0x65,0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x35,0x20,0x2f,0x20,0x28,0x28,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x20,0x2a,0x20,0x28,0x28,
+    0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x56,0x69,0x65,0x77,0x20,0x2a,0x20,
+    0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,
+    0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,0x28,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x44,0x6f,0x74,0x56,0x69,0x65,0x77,0x20,0x2a,0x20,0x28,0x28,0x6e,0x6f,
+    0x72,0x6d,0x61,0x6c,0x44,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x20,0x2a,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x20,0x2b,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
     0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,
     0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,
-    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x6d,0x69,0x74,0x68,0x28,0x74,0x68,
-    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x26,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
-    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,
-    0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
-    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x6c,0x69,
-    0x67,0x68,0x74,0x56,0x65,0x63,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
-    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x72,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,
-    0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
-    0x20,0x76,0x69,0x65,0x77,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x20,0x3d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x64,0x6f,
-    0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x56,
-    0x65,0x63,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x72,
-    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-    0x74,0x75,0x72,0x6e,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x63,0x68,
-    0x6c,0x69,0x63,0x6b,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x20,0x2a,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,
-    0x72,0x79,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x47,0x47,0x58,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x3b,0x0a,
+    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x53,0x63,0x68,0x6c,0x69,0x63,0x6b,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x44,0x6f,0x74,0x48,0x61,0x6c,
+    0x66,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x66,0x30,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x37,0x20,0x3d,0x20,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x76,0x69,0x65,0x77,0x44,0x6f,0x74,0x48,0x61,0x6c,
+    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x30,
+    0x20,0x3d,0x20,0x5f,0x35,0x37,0x20,0x2a,0x20,0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,
+    0x36,0x30,0x20,0x2a,0x20,0x5f,0x36,0x30,0x29,0x20,0x2a,0x20,0x5f,0x35,0x37,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x66,0x30,0x20,
+    0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x36,0x35,0x29,0x29,0x20,0x2b,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x36,0x35,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x47,0x65,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,
+    0x74,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x37,0x35,0x20,
+    0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+    0x2f,0x20,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x28,0x28,0x28,0x5f,0x37,0x35,0x20,0x2a,0x20,0x5f,
+    0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,0x37,0x35,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x38,0x34,0x20,0x2a,0x20,
+    0x5f,0x38,0x34,0x29,0x20,0x2f,0x20,0x28,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
     0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
     0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
     0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x6f,0x6d,0x4c,0x69,0x6e,0x65,0x61,
-    0x72,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,
-    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
-    0x65,0x6c,0x65,0x63,0x74,0x28,0x66,0x6d,0x61,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,0x37,0x35,0x34,0x37,0x39,
-    0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,0x70,0x6f,0x77,
-    0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x28,0x30,0x2e,0x34,0x31,0x36,0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,
-    0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x29,
-    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x2d,0x30,0x2e,0x30,0x35,0x34,0x39,
-    0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,
-    0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x61,
-    0x72,0x52,0x47,0x42,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x31,0x32,
-    0x2e,0x39,0x32,0x30,0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,
-    0x33,0x31,0x32,0x35,0x29,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x52,0x47,0x42,
-    0x20,0x3c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,
-    0x33,0x30,0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,
-    0x37,0x30,0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
-    0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,
-    0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
-    0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,0x72,
-    0x5f,0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x32,
-    0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x47,0x65,0x74,0x4d,0x61,0x70,0x70,0x65,0x64,
+    0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x76,0x65,
+    0x72,0x74,0x65,0x78,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x31,0x30,0x31,0x20,0x3d,0x20,0x28,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,
+    0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x30,0x34,0x20,0x3d,
+    0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x65,0x72,0x74,0x65,
+    0x78,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x31,0x34,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x54,0x61,0x6e,0x67,
+    0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x28,0x5f,0x31,0x30,0x34,0x20,
+    0x2a,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x30,0x34,0x2c,0x20,0x76,0x65,0x72,0x74,
+    0x65,0x78,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x7a,0x29,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x32,
+    0x31,0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x5f,0x31,0x30,0x34,0x2c,0x20,
+    0x5f,0x31,0x31,0x34,0x29,0x20,0x2a,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x54,0x61,
+    0x6e,0x67,0x65,0x6e,0x74,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x28,
+    0x5f,0x31,0x31,0x34,0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,0x2e,0x78,0x29,0x20,0x2b,
+    0x20,0x28,0x5f,0x31,0x32,0x31,0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,0x2e,0x79,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x5f,0x31,0x30,0x34,0x20,0x2a,0x20,0x5f,0x31,0x30,0x31,
+    0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x53,0x72,0x67,
+    0x62,0x54,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x73,0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x33,0x20,0x5f,0x31,0x34,0x30,0x20,0x3d,0x20,0x28,
+    0x73,0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x30,0x2e,0x30,0x34,0x30,0x34,0x34,0x39,0x39,0x39,0x39,0x32,0x37,
+    0x32,0x38,0x32,0x33,0x33,0x33,0x33,0x37,0x34,0x30,0x32,0x33,0x34,0x33,0x37,0x35,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x31,0x34,0x38,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x28,0x73,0x72,0x67,0x62,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,
+    0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x31,0x39,0x37,0x36,0x37,
+    0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,0x2f,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,
+    0x34,0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,0x2e,0x34,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x39,0x35,0x33,0x36,0x37,0x34,0x33,0x31,0x36,0x34,0x30,0x36,0x32,
+    0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x5f,0x31,0x35,0x32,0x20,0x3d,0x20,0x73,0x72,0x67,0x62,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x32,0x2e,0x39,0x32,0x30,
+    0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x28,0x5f,0x31,0x34,0x38,0x2c,0x20,0x5f,0x31,0x35,0x32,0x2c,
+    0x20,0x5f,0x31,0x34,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x54,
+    0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x63,0x65,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x36,0x31,0x20,0x3d,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x2a,0x20,0x30,0x2e,0x36,0x30,0x30,0x30,0x30,0x30,0x30,0x32,0x33,
+    0x38,0x34,0x31,0x38,0x35,0x37,0x39,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x28,0x5f,0x31,0x36,0x31,0x20,0x2a,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,
+    0x2a,0x20,0x32,0x2e,0x35,0x30,0x39,0x39,0x39,0x39,0x39,0x39,0x30,0x34,0x36,0x33,
+    0x32,0x35,0x36,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x32,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x33,0x32,0x39,0x34,0x34,0x37,0x37,0x34,0x36,0x32,0x37,0x36,0x38,0x35,0x35,0x34,
+    0x36,0x38,0x37,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,
+    0x20,0x2a,0x20,0x28,0x28,0x5f,0x31,0x36,0x31,0x20,0x2a,0x20,0x32,0x2e,0x34,0x33,
+    0x30,0x30,0x30,0x30,0x30,0x36,0x36,0x37,0x35,0x37,0x32,0x30,0x32,0x31,0x34,0x38,
+    0x34,0x33,0x37,0x35,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,
+    0x2e,0x35,0x38,0x39,0x39,0x39,0x39,0x39,0x37,0x33,0x37,0x37,0x33,0x39,0x35,0x36,
+    0x32,0x39,0x38,0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x31,0x34,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x35,0x39,0x36,0x30,0x34,0x36,0x34,0x34,0x37,0x37,0x35,0x33,0x39,0x30,0x36,
+    0x32,0x35,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,
+    0x67,0x58,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x20,
+    0x5f,0x31,0x39,0x30,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x38,0x34,0x32,0x34,0x37,0x39,0x30,
+    0x35,0x30,0x31,0x35,0x39,0x34,0x35,0x34,0x33,0x34,0x35,0x37,0x30,0x33,0x31,0x32,
+    0x35,0x2c,0x20,0x30,0x2e,0x30,0x34,0x32,0x33,0x32,0x38,0x32,0x34,0x32,0x32,0x31,
+    0x32,0x35,0x33,0x33,0x39,0x35,0x30,0x38,0x30,0x35,0x36,0x36,0x34,0x30,0x36,0x32,
+    0x35,0x2c,0x20,0x30,0x2e,0x30,0x34,0x32,0x33,0x37,0x35,0x36,0x35,0x33,0x39,0x38,
+    0x32,0x31,0x36,0x32,0x34,0x37,0x35,0x35,0x38,0x35,0x39,0x33,0x37,0x35,0x29,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x37,0x38,0x34,0x33,0x33,
+    0x36,0x30,0x33,0x30,0x34,0x38,0x33,0x32,0x34,0x35,0x38,0x34,0x39,0x36,0x30,0x39,
+    0x33,0x37,0x35,0x2c,0x20,0x30,0x2e,0x38,0x37,0x38,0x34,0x36,0x38,0x36,0x33,0x32,
+    0x36,0x39,0x38,0x30,0x35,0x39,0x30,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x2c,0x20,
+    0x30,0x2e,0x30,0x37,0x38,0x34,0x33,0x33,0x36,0x30,0x33,0x30,0x34,0x38,0x33,0x32,
+    0x34,0x35,0x38,0x34,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x37,0x39,0x32,0x32,0x33,0x37,0x34,0x34,
+    0x35,0x37,0x31,0x32,0x30,0x38,0x39,0x35,0x33,0x38,0x35,0x37,0x34,0x32,0x31,0x38,
+    0x37,0x35,0x2c,0x20,0x30,0x2e,0x30,0x37,0x39,0x31,0x36,0x36,0x31,0x32,0x39,0x32,
+    0x33,0x31,0x34,0x35,0x32,0x39,0x34,0x31,0x38,0x39,0x34,0x35,0x33,0x31,0x32,0x35,
+    0x2c,0x20,0x30,0x2e,0x38,0x37,0x39,0x31,0x34,0x32,0x39,0x39,0x39,0x36,0x34,0x39,
+    0x30,0x34,0x37,0x38,0x35,0x31,0x35,0x36,0x32,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x20,0x5f,0x31,0x39,0x39,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x78,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x31,0x2e,0x31,0x39,0x36,0x38,0x37,0x39,0x30,0x32,0x39,0x32,0x37,0x33,
+    0x39,0x38,0x36,0x38,0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x2c,0x20,0x2d,0x30,0x2e,
+    0x30,0x35,0x32,0x38,0x39,0x36,0x38,0x35,0x33,0x35,0x33,0x36,0x33,0x36,0x37,0x34,
+    0x31,0x36,0x33,0x38,0x31,0x38,0x33,0x35,0x39,0x33,0x37,0x35,0x2c,0x20,0x2d,0x30,
+    0x2e,0x30,0x35,0x32,0x39,0x37,0x31,0x36,0x33,0x35,0x30,0x31,0x33,0x38,0x31,0x38,
+    0x37,0x34,0x30,0x38,0x34,0x34,0x37,0x32,0x36,0x35,0x36,0x32,0x35,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x2d,0x30,0x2e,0x30,0x39,0x38,0x30,0x32,0x30,
+    0x38,0x38,0x31,0x34,0x31,0x34,0x34,0x31,0x33,0x34,0x35,0x32,0x31,0x34,0x38,0x34,
+    0x33,0x37,0x35,0x2c,0x20,0x31,0x2e,0x31,0x35,0x31,0x39,0x30,0x33,0x31,0x35,0x32,
+    0x34,0x36,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,
+    0x39,0x38,0x30,0x34,0x33,0x34,0x34,0x39,0x32,0x32,0x33,0x30,0x34,0x31,0x35,0x33,
+    0x34,0x34,0x32,0x33,0x38,0x32,0x38,0x31,0x32,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x28,0x2d,0x30,0x2e,0x30,0x39,0x39,0x30,0x32,0x39,0x37,0x34,0x32,
+    0x31,0x38,0x31,0x33,0x30,0x31,0x31,0x31,0x36,0x39,0x34,0x33,0x33,0x35,0x39,0x33,
+    0x37,0x35,0x2c,0x20,0x2d,0x30,0x2e,0x30,0x39,0x38,0x39,0x36,0x31,0x31,0x37,0x34,
+    0x34,0x38,0x38,0x30,0x36,0x37,0x36,0x32,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x2c,
+    0x20,0x31,0x2e,0x31,0x35,0x31,0x30,0x37,0x33,0x36,0x39,0x34,0x32,0x32,0x39,0x31,
+    0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x31,0x34,0x20,0x3d,0x20,0x28,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,0x67,0x32,0x28,0x6d,0x61,0x78,0x28,0x5f,
+    0x31,0x39,0x30,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x33,0x33,
+    0x35,0x31,0x34,0x33,0x31,0x39,0x36,0x30,0x30,0x31,0x38,0x30,0x38,0x39,0x37,0x33,
+    0x39,0x36,0x30,0x35,0x38,0x65,0x2d,0x31,0x30,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x2d,0x31,0x32,0x2e,0x34,0x37,0x33,0x39,0x33,0x30,0x33,
+    0x35,0x38,0x38,0x38,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x28,0x34,0x2e,0x30,0x32,0x36,0x30,0x36,0x39,0x31,0x36,0x34,0x32,
+    0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,0x2d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x2d,0x31,0x32,0x2e,0x34,0x37,0x33,0x39,0x33,
+    0x30,0x33,0x35,0x38,0x38,0x38,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x29,0x20,0x2f,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x36,0x2e,0x34,0x39,0x39,0x39,0x39,
+    0x38,0x30,0x39,0x32,0x36,0x35,0x31,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x31,0x37,
+    0x20,0x3d,0x20,0x5f,0x32,0x31,0x34,0x20,0x2a,0x20,0x5f,0x32,0x31,0x34,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x30,0x20,
+    0x3d,0x20,0x5f,0x32,0x31,0x37,0x20,0x2a,0x20,0x5f,0x32,0x31,0x37,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x35,0x31,0x20,0x3d,
+    0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,0x31,
+    0x35,0x2e,0x35,0x29,0x20,0x2a,0x20,0x5f,0x32,0x31,0x37,0x29,0x20,0x2d,0x20,0x28,
+    0x28,0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,0x34,0x30,0x2e,0x31,0x33,0x39,0x39,0x39,
+    0x39,0x33,0x38,0x39,0x36,0x34,0x38,0x34,0x33,0x37,0x35,0x29,0x20,0x2a,0x20,0x5f,
+    0x32,0x31,0x34,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x32,0x30,0x20,0x2a,0x20,
+    0x33,0x31,0x2e,0x39,0x35,0x39,0x39,0x39,0x39,0x30,0x38,0x34,0x34,0x37,0x32,0x36,
+    0x35,0x36,0x32,0x35,0x29,0x29,0x20,0x2d,0x20,0x28,0x28,0x5f,0x32,0x31,0x37,0x20,
+    0x2a,0x20,0x36,0x2e,0x38,0x36,0x38,0x30,0x30,0x30,0x30,0x33,0x30,0x35,0x31,0x37,
+    0x35,0x37,0x38,0x31,0x32,0x35,0x29,0x20,0x2a,0x20,0x5f,0x32,0x31,0x34,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x5f,0x32,0x31,0x37,0x20,0x2a,0x20,0x30,0x2e,0x34,0x32,0x39,
+    0x38,0x30,0x30,0x30,0x30,0x33,0x37,0x36,0x37,0x30,0x31,0x33,0x35,0x34,0x39,0x38,
+    0x30,0x34,0x36,0x38,0x37,0x35,0x29,0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x31,0x34,
+    0x20,0x2a,0x20,0x30,0x2e,0x31,0x31,0x39,0x30,0x39,0x39,0x39,0x39,0x36,0x39,0x38,
+    0x34,0x30,0x30,0x34,0x39,0x37,0x34,0x33,0x36,0x35,0x32,0x33,0x34,0x33,0x37,0x35,
+    0x29,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x30,
+    0x32,0x33,0x31,0x39,0x39,0x39,0x39,0x39,0x37,0x30,0x34,0x39,0x35,0x37,0x30,0x30,
+    0x38,0x33,0x36,0x31,0x38,0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x6f,0x77,0x28,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x5f,0x31,0x39,0x39,0x20,0x2a,0x20,0x5f,0x32,0x35,0x31,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,
+    0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x41,0x70,0x70,0x6c,0x79,0x54,0x6f,0x6e,0x65,0x6d,
+    0x61,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,
+    0x20,0x69,0x6e,0x74,0x20,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6e,0x65,0x6d,
+    0x61,0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x31,0x2e,0x30,0x29,0x20,0x2b,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x20,0x3d,0x3d,0x20,0x32,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,
+    0x6f,0x6e,0x65,0x6d,0x61,0x70,0x41,0x63,0x65,0x73,0x28,0x63,0x6f,0x6c,0x6f,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x70,0x65,0x72,0x20,0x3d,
+    0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x6f,0x6e,0x65,0x6d,0x61,
+    0x70,0x41,0x67,0x58,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x4c,0x69,
+    0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x72,0x67,0x62,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x33,0x20,0x5f,0x32,0x38,0x38,0x20,
+    0x3d,0x20,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x30,0x30,0x33,0x31,0x33,0x30,
+    0x38,0x30,0x30,0x30,0x39,0x30,0x37,0x33,0x30,0x31,0x39,0x30,0x32,0x37,0x37,0x30,
+    0x39,0x39,0x36,0x30,0x39,0x33,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x39,0x37,0x20,0x3d,0x20,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x34,
+    0x37,0x35,0x34,0x37,0x39,0x31,0x32,0x35,0x39,0x37,0x36,0x35,0x36,0x32,0x35,0x29,
+    0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,
+    0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x31,0x36,
+    0x36,0x36,0x36,0x36,0x35,0x36,0x37,0x33,0x32,0x35,0x35,0x39,0x32,0x30,0x34,0x31,
+    0x30,0x31,0x35,0x36,0x32,0x35,0x29,0x29,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x30,0x2e,0x30,0x35,0x34,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x30,
+    0x31,0x39,0x37,0x36,0x37,0x37,0x36,0x31,0x32,0x33,0x30,0x34,0x36,0x38,0x37,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,
+    0x30,0x31,0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,
+    0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x31,0x32,0x2e,0x39,0x32,0x30,
+    0x30,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x28,0x5f,0x32,0x39,0x37,0x2c,0x20,0x5f,0x33,0x30,0x31,0x2c,
+    0x20,0x5f,0x32,0x38,0x38,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x48,
+    0x64,0x72,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x68,0x64,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x4c,0x69,0x6e,0x65,0x61,0x72,0x54,0x6f,0x53,0x72,0x67,0x62,0x28,0x41,0x70,
+    0x70,0x6c,0x79,0x54,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x28,0x68,0x64,0x72,0x43,0x6f,
+    0x6c,0x6f,0x72,0x20,0x2a,0x20,0x65,0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,
+    0x72,0x61,0x6d,0x73,0x2e,0x78,0x2c,0x20,0x69,0x6e,0x74,0x28,0x65,0x78,0x70,0x6f,
+    0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x46,
+    0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x31,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,0x72,0x5f,0x44,0x72,0x61,0x77,
+    0x46,0x72,0x61,0x67,0x50,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x39,0x35,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
     0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
-    0x3e,0x20,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,
+    0x3e,0x20,0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,
     0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,
-    0x61,0x74,0x3e,0x20,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x61,0x74,0x3e,0x20,0x70,0x62,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,
+    0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x20,
+    0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,
+    0x20,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x33,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x70,0x62,0x72,0x44,0x66,0x67,0x54,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x34,0x29,
+    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x62,0x72,0x41,
+    0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x62,
+    0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x33,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x62,
+    0x72,0x44,0x66,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x28,0x34,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,
+    0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x5f,0x33,0x33,0x30,0x20,0x3d,0x20,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,
+    0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,
     0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
-    0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
-    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,
-    0x68,0x6e,0x65,0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x31,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,
-    0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x70,0x62,0x72,0x41,0x6c,0x62,
-    0x65,0x64,0x6f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x28,0x70,0x62,0x72,0x41,0x6c,0x62,0x65,0x64,0x6f,0x53,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,
-    0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x5f,0x32,0x30,0x38,0x20,0x3d,0x20,0x70,0x62,0x72,0x52,0x6f,
-    0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,
+    0x2c,0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,
+    0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x33,0x33,0x34,0x20,0x3d,0x20,0x53,0x72,0x67,0x62,0x54,0x6f,0x4c,
+    0x69,0x6e,0x65,0x61,0x72,0x28,0x5f,0x33,0x33,0x30,0x2e,0x78,0x79,0x7a,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x34,0x33,0x20,
+    0x3d,0x20,0x70,0x62,0x72,0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,
+    0x4f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x2c,0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,
+    0x6f,0x6f,0x72,0x64,0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x33,0x35,0x30,0x20,0x3d,0x20,0x70,0x62,0x72,0x4d,0x65,
+    0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x54,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,
+    0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,
     0x73,0x73,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x66,0x72,
     0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x31,0x31,0x20,0x3d,
-    0x20,0x5f,0x32,0x30,0x38,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x5f,0x32,0x31,0x36,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,
-    0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x69,0x6e,0x2e,0x66,0x72,
-    0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x33,0x30,0x20,0x3d,0x20,0x66,0x61,0x73,
-    0x74,0x3a,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x32,0x32,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x35,0x38,0x20,0x3d,
+    0x20,0x5f,0x33,0x35,0x30,0x2e,0x7a,0x20,0x2a,0x20,0x5f,0x39,0x35,0x2e,0x73,0x75,
+    0x72,0x66,0x61,0x63,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x36,0x36,0x20,0x3d,0x20,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x5f,0x33,0x35,0x30,0x2e,0x79,0x20,0x2a,0x20,0x5f,
+    0x39,0x35,0x2e,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,0x34,0x35,0x30,0x30,0x30,0x30,0x30,0x31,0x37,
+    0x38,0x38,0x31,0x33,0x39,0x33,0x34,0x33,0x32,0x36,0x31,0x37,0x31,0x38,0x37,0x35,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x33,0x36,0x39,0x20,0x3d,0x20,0x5f,0x33,0x36,0x36,0x20,0x2a,0x20,
+    0x5f,0x33,0x36,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x5f,0x33,0x38,0x30,0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,
+    0x33,0x33,0x34,0x2c,0x20,0x5f,0x33,0x33,0x30,0x2e,0x77,0x29,0x29,0x20,0x2a,0x20,
+    0x5f,0x39,0x35,0x2e,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x33,0x38,0x36,0x20,0x3d,0x20,0x5f,0x33,0x38,0x30,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x5f,0x33,
+    0x35,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x5f,0x33,0x39,0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x30,0x2e,0x30,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x31,0x30,0x35,
+    0x39,0x33,0x30,0x33,0x32,0x38,0x33,0x36,0x39,0x31,0x34,0x30,0x36,0x32,0x35,0x29,
+    0x2c,0x20,0x5f,0x33,0x38,0x30,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x5f,0x33,0x35,0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x30,0x30,0x20,0x3d,0x20,0x5f,0x31,0x31,
     0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x20,0x2d,
     0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x32,0x31,0x36,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x20,0x3d,0x20,0x28,0x5f,0x32,0x31,0x36,0x20,0x2b,0x20,0x5f,0x32,0x33,0x30,0x29,
-    0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x33,0x20,0x3d,0x20,0x5f,0x32,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x32,0x36,0x30,0x20,0x3d,0x20,0x5f,0x32,0x31,0x31,0x20,
-    0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x5f,0x32,0x31,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6e,0x6f,0x72,
-    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x32,0x32,0x30,0x2e,0x63,0x61,0x6d,0x65,
-    0x72,0x61,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x66,
-    0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,
-    0x20,0x3d,0x20,0x5f,0x32,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x28,0x5f,0x32,
-    0x36,0x30,0x20,0x2a,0x20,0x5f,0x32,0x36,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x31,
-    0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
-    0x38,0x34,0x20,0x3d,0x20,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,
-    0x6e,0x47,0x47,0x58,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x20,
-    0x2b,0x20,0x47,0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x53,0x6d,0x69,0x74,0x68,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x32,0x32,
-    0x30,0x2e,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x28,0x28,
-    0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
-    0x29,0x20,0x2a,0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x29,0x29,0x20,0x2a,0x20,0x74,0x6f,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x28,0x5f,0x32,0x38,0x34,0x2c,0x20,0x5f,0x32,0x38,0x34,0x2c,0x20,0x5f,
-    0x32,0x38,0x34,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
-    0x66,0x72,0x6f,0x6d,0x4c,0x69,0x6e,0x65,0x61,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-    0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x33,
+    0x20,0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x5f,0x34,0x30,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x31,0x33,
+    0x20,0x3d,0x20,0x47,0x65,0x74,0x4d,0x61,0x70,0x70,0x65,0x64,0x4e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x28,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x4e,0x6f,0x72,0x6d,0x61,0x6c,
+    0x2c,0x20,0x69,0x6e,0x2e,0x66,0x72,0x61,0x67,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,
+    0x2c,0x20,0x70,0x62,0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x4e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x66,
+    0x72,0x61,0x67,0x53,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,
+    0x78,0x79,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x34,0x31,0x38,0x20,0x3d,0x20,0x5f,0x34,0x30,0x30,0x20,0x2f,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x34,0x30,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x32,0x35,0x20,0x3d,0x20,0x6e,
+    0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x31,0x31,0x30,0x2e,0x63,0x61,
+    0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x66,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x32,0x39,0x20,
+    0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x5f,0x34,0x32,0x35,
+    0x20,0x2b,0x20,0x5f,0x34,0x31,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x34,0x33,0x35,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x32,0x35,0x29,0x2c,0x20,
+    0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,
+    0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,
+    0x38,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x31,0x38,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x34,0x35,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x33,0x2c,0x20,0x5f,0x34,0x32,0x39,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x35,0x30,0x20,0x3d,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x31,0x38,0x2c,0x20,0x5f,
+    0x34,0x32,0x39,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x35,0x39,
+    0x20,0x3d,0x20,0x70,0x62,0x72,0x44,0x66,0x67,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x70,0x62,0x72,0x44,0x66,0x67,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,0x34,
+    0x33,0x35,0x2c,0x20,0x5f,0x33,0x36,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x37,0x33,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x31,0x2e,0x30,0x29,0x20,0x2b,0x20,0x28,0x5f,0x33,0x39,
+    0x32,0x20,0x2a,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,
+    0x5f,0x34,0x35,0x39,0x2e,0x78,0x20,0x2b,0x20,0x5f,0x34,0x35,0x39,0x2e,0x79,0x2c,
+    0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,
+    0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,
+    0x38,0x38,0x65,0x2d,0x30,0x35,0x29,0x29,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x39,
+    0x35,0x20,0x3d,0x20,0x28,0x28,0x46,0x72,0x65,0x73,0x6e,0x65,0x6c,0x53,0x63,0x68,
+    0x6c,0x69,0x63,0x6b,0x28,0x5f,0x34,0x35,0x30,0x2c,0x20,0x5f,0x33,0x39,0x32,0x29,
+    0x20,0x2a,0x20,0x28,0x44,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,0x6e,
+    0x47,0x47,0x58,0x28,0x5f,0x34,0x34,0x35,0x2c,0x20,0x5f,0x33,0x36,0x39,0x29,0x20,
+    0x2a,0x20,0x56,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x53,0x6d,0x69,0x74,
+    0x68,0x47,0x47,0x58,0x43,0x6f,0x72,0x72,0x65,0x6c,0x61,0x74,0x65,0x64,0x46,0x61,
+    0x73,0x74,0x28,0x5f,0x34,0x33,0x35,0x2c,0x20,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,
+    0x33,0x36,0x39,0x29,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x37,0x33,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x35,0x30,0x38,0x20,0x3d,
+    0x20,0x28,0x5f,0x31,0x31,0x30,0x2e,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x2e,
+    0x77,0x20,0x2a,0x20,0x47,0x65,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,
+    0x74,0x41,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x28,0x5f,0x34,0x30,
+    0x33,0x2c,0x20,0x5f,0x31,0x31,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,
+    0x73,0x2e,0x77,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x31,0x32,0x20,0x3d,0x20,
+    0x28,0x28,0x5f,0x33,0x38,0x36,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,
+    0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x29,0x29,0x20,0x2b,0x20,0x5f,0x34,0x39,
+    0x35,0x29,0x20,0x2a,0x20,0x5f,0x35,0x30,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x35,0x32,0x37,0x20,0x3d,0x20,0x28,0x28,0x5f,
+    0x33,0x38,0x36,0x20,0x2b,0x20,0x28,0x28,0x28,0x5f,0x33,0x39,0x32,0x20,0x2a,0x20,
+    0x5f,0x34,0x35,0x39,0x2e,0x78,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x5f,0x34,0x35,0x39,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x34,0x37,0x33,
+    0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x31,0x30,0x2e,0x61,0x6d,0x62,0x69,0x65,0x6e,
+    0x74,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,0x20,0x5f,0x33,
+    0x34,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x48,0x64,0x72,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x28,0x5f,0x35,0x31,
+    0x32,0x20,0x2b,0x20,0x5f,0x35,0x32,0x37,0x2c,0x20,0x5f,0x31,0x31,0x30,0x2e,0x65,
+    0x78,0x70,0x6f,0x73,0x75,0x72,0x65,0x50,0x61,0x72,0x61,0x6d,0x73,0x29,0x2c,0x20,
+    0x5f,0x33,0x38,0x30,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct pbr_FrameVertParams
+    {
+        float4x4 view;
+        float4x4 projection;
+    };
+
+    struct pbr_DrawVertParams
+    {
+        float4x4 world;
+        float4 uvTransform;
+    };
+
+    struct main0_out
+    {
+        float4 gl_Position [[position, invariant]];
+    };
+
+    struct main0_in
+    {
+        float3 position [[attribute(0)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant pbr_FrameVertParams& _19 [[buffer(0)]], constant pbr_DrawVertParams& _27 [[buffer(1)]])
+    {
+        main0_out out = {};
+        out.gl_Position = _19.projection * (_19.view * (_27.world * float4(in.position, 1.0)));
+        return out;
+    }
+
+*/
+static const uint8_t depth_vertex_shader_source_metal_macos[640] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,
+    0x62,0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,
+    0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,
+    0x34,0x20,0x76,0x69,0x65,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x78,0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x62,0x72,0x5f,
+    0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x77,0x6f,
+    0x72,0x6c,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x76,0x54,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x69,0x6e,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,
+    0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x62,
+    0x72,0x5f,0x46,0x72,0x61,0x6d,0x65,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,
+    0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,
+    0x62,0x72,0x5f,0x44,0x72,0x61,0x77,0x56,0x65,0x72,0x74,0x50,0x61,0x72,0x61,0x6d,
+    0x73,0x26,0x20,0x5f,0x32,0x37,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x31,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x5f,0x31,0x39,0x2e,0x70,0x72,0x6f,0x6a,0x65,0x63,
+    0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x28,0x5f,0x31,0x39,0x2e,0x76,0x69,0x65,0x77,
+    0x20,0x2a,0x20,0x28,0x5f,0x32,0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x20,0x2a,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct main0_out
+    {
+        float4 frag_color [[color(0)]];
+    };
+
+    fragment main0_out main0()
+    {
+        main0_out out = {};
+        out.frag_color = float4(1.0);
+        return out;
+    }
+
+*/
+static const uint8_t depth_fragment_shader_source_metal_macos[238] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 const sg_shader_desc* pbr_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
@@ -1367,40 +2951,83 @@ const sg_shader_desc* pbr_shader_desc(sg_backend backend) {
             desc.fragment_func.entry = "main";
             desc.attrs[0].glsl_name = "position";
             desc.attrs[1].glsl_name = "normal";
-            desc.attrs[2].glsl_name = "texCoord0";
-            desc.attrs[3].glsl_name = "color0";
+            desc.attrs[2].glsl_name = "tangent";
+            desc.attrs[3].glsl_name = "texCoord0";
+            desc.attrs[4].glsl_name = "color0";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 128;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
-            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "pbr_VertParams";
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 8;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "pbr_FrameVertParams";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 48;
+            desc.uniform_blocks[1].size = 80;
             desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
-            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 3;
-            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "pbr_FragParams";
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 5;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "pbr_DrawVertParams";
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[2].glsl_uniforms[0].array_count = 4;
+            desc.uniform_blocks[2].glsl_uniforms[0].glsl_name = "pbr_FrameFragParams";
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[3].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[3].glsl_uniforms[0].glsl_name = "pbr_DrawFragParams";
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
             desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[3].image_type = SG_IMAGETYPE_2D;
             desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[3].multisampled = false;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
             desc.image_sampler_pairs[0].glsl_name = "pbrAlbedoTexture_pbrAlbedoSampler";
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[1].image_slot = 3;
-            desc.image_sampler_pairs[1].sampler_slot = 3;
-            desc.image_sampler_pairs[1].glsl_name = "pbrRoughnessTexture_pbrRoughnessSampler";
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[1].glsl_name = "pbrNormalTexture_pbrNormalSampler";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[2].glsl_name = "pbrMetallicRoughnessTexture_pbrMetallicRoughnessSampler";
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.image_sampler_pairs[3].glsl_name = "pbrOcclusionTexture_pbrOcclusionSampler";
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 4;
+            desc.image_sampler_pairs[4].glsl_name = "pbrDfgTexture_pbrDfgSampler";
             desc.label = "pbr_shader";
         }
         return &desc;
@@ -1424,36 +3051,79 @@ const sg_shader_desc* pbr_shader_desc(sg_backend backend) {
             desc.attrs[2].hlsl_sem_index = 2;
             desc.attrs[3].hlsl_sem_name = "TEXCOORD";
             desc.attrs[3].hlsl_sem_index = 3;
+            desc.attrs[4].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[4].hlsl_sem_index = 4;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 128;
             desc.uniform_blocks[0].hlsl_register_b_n = 0;
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 48;
-            desc.uniform_blocks[1].hlsl_register_b_n = 0;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].hlsl_register_b_n = 0;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].hlsl_register_b_n = 1;
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[0].multisampled = false;
             desc.images[0].hlsl_register_t_n = 0;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[1].hlsl_register_t_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].hlsl_register_t_n = 2;
             desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[3].image_type = SG_IMAGETYPE_2D;
             desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[3].multisampled = false;
-            desc.images[3].hlsl_register_t_n = 1;
+            desc.images[3].hlsl_register_t_n = 3;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.images[4].hlsl_register_t_n = 4;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].hlsl_register_s_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].hlsl_register_s_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].hlsl_register_s_n = 2;
             desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.samplers[3].hlsl_register_s_n = 1;
+            desc.samplers[3].hlsl_register_s_n = 3;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].hlsl_register_s_n = 4;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[1].image_slot = 3;
-            desc.image_sampler_pairs[1].sampler_slot = 3;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 4;
             desc.label = "pbr_shader";
         }
         return &desc;
@@ -1469,40 +3139,156 @@ const sg_shader_desc* pbr_shader_desc(sg_backend backend) {
             desc.fragment_func.entry = "main0";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].size = 128;
             desc.uniform_blocks[0].msl_buffer_n = 0;
-            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
             desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[1].size = 48;
-            desc.uniform_blocks[1].msl_buffer_n = 0;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].msl_buffer_n = 1;
+            desc.uniform_blocks[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[2].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[2].size = 64;
+            desc.uniform_blocks[2].msl_buffer_n = 0;
+            desc.uniform_blocks[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[3].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[3].size = 32;
+            desc.uniform_blocks[3].msl_buffer_n = 1;
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[0].multisampled = false;
             desc.images[0].msl_texture_n = 0;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.images[1].msl_texture_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].msl_texture_n = 2;
             desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[3].image_type = SG_IMAGETYPE_2D;
             desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[3].multisampled = false;
-            desc.images[3].msl_texture_n = 1;
+            desc.images[3].msl_texture_n = 3;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.images[4].msl_texture_n = 4;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].msl_sampler_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].msl_sampler_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
             desc.samplers[3].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[3].sampler_type = SG_SAMPLERTYPE_FILTERING;
-            desc.samplers[3].msl_sampler_n = 1;
+            desc.samplers[3].msl_sampler_n = 3;
+            desc.samplers[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[4].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[4].msl_sampler_n = 4;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
-            desc.image_sampler_pairs[1].image_slot = 3;
-            desc.image_sampler_pairs[1].sampler_slot = 3;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 1;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 2;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 3;
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 4;
             desc.label = "pbr_shader";
         }
         return &desc;
     }
     return 0;
 }
+const sg_shader_desc* pbrDepth_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)depth_vertex_shader_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)depth_fragment_shader_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].glsl_name = "position";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 8;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "pbr_FrameVertParams";
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[1].glsl_uniforms[0].array_count = 5;
+            desc.uniform_blocks[1].glsl_uniforms[0].glsl_name = "pbr_DrawVertParams";
+            desc.label = "pbrDepth_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)depth_vertex_shader_source_hlsl5;
+            desc.vertex_func.d3d11_target = "vs_5_0";
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)depth_fragment_shader_source_hlsl5;
+            desc.fragment_func.d3d11_target = "ps_5_0";
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[0].hlsl_sem_index = 0;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].hlsl_register_b_n = 1;
+            desc.label = "pbrDepth_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)depth_vertex_shader_source_metal_macos;
+            desc.vertex_func.entry = "main0";
+            desc.fragment_func.source = (const char*)depth_fragment_shader_source_metal_macos;
+            desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.uniform_blocks[1].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[1].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[1].size = 80;
+            desc.uniform_blocks[1].msl_buffer_n = 1;
+            desc.label = "pbrDepth_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
 #endif // SOKOL_SHDC_IMPL
 
 //NOTE: These lines were added by find_and_compile_shaders.py
@@ -1511,29 +3297,60 @@ const sg_shader_desc* pbr_shader_desc(sg_backend backend) {
 #define NO_ENTRIES_STR "no_entries"
 #endif
 #define pbr_SHADER_FILE_PATH "C:\\gamedev\\projects\\SokolPbrRenderer\\app\\pbr_shader.glsl"
-#define pbr_SHADER_IMAGE_COUNT 2
+#define pbr_SHADER_IMAGE_COUNT 5
 #define pbr_SHADER_IMAGE_DEFS { \
 	{ .name="pbrAlbedoTexture", .index=IMG_pbrAlbedoTexture }, \
-	{ .name="pbrRoughnessTexture", .index=IMG_pbrRoughnessTexture }, \
+	{ .name="pbrNormalTexture", .index=IMG_pbrNormalTexture }, \
+	{ .name="pbrMetallicRoughnessTexture", .index=IMG_pbrMetallicRoughnessTexture }, \
+	{ .name="pbrOcclusionTexture", .index=IMG_pbrOcclusionTexture }, \
+	{ .name="pbrDfgTexture", .index=IMG_pbrDfgTexture }, \
 } // These should match ShaderImageDef struct found in gfx_shader.h
-#define pbr_SHADER_SAMPLER_COUNT 2
+#define pbr_SHADER_SAMPLER_COUNT 5
 #define pbr_SHADER_SAMPLER_DEFS { \
 	{ .name="pbrAlbedoSampler", .index=SMP_pbrAlbedoSampler }, \
-	{ .name="pbrRoughnessSampler", .index=SMP_pbrRoughnessSampler }, \
+	{ .name="pbrNormalSampler", .index=SMP_pbrNormalSampler }, \
+	{ .name="pbrMetallicRoughnessSampler", .index=SMP_pbrMetallicRoughnessSampler }, \
+	{ .name="pbrOcclusionSampler", .index=SMP_pbrOcclusionSampler }, \
+	{ .name="pbrDfgSampler", .index=SMP_pbrDfgSampler }, \
 } // These should match ShaderSamplerDef struct found in gfx_shader.h
-#define pbr_SHADER_UNIFORM_COUNT 6
+#define pbr_SHADER_UNIFORM_COUNT 10
 #define pbr_SHADER_UNIFORM_DEFS { \
-	{ .name="world", .blockIndex=UB_pbr_VertParams, .offset=STRUCT_VAR_OFFSET(pbr_VertParams_t, world), .size=STRUCT_VAR_SIZE(pbr_VertParams_t, world) }, \
-	{ .name="view", .blockIndex=UB_pbr_VertParams, .offset=STRUCT_VAR_OFFSET(pbr_VertParams_t, view), .size=STRUCT_VAR_SIZE(pbr_VertParams_t, view) }, \
-	{ .name="projection", .blockIndex=UB_pbr_VertParams, .offset=STRUCT_VAR_OFFSET(pbr_VertParams_t, projection), .size=STRUCT_VAR_SIZE(pbr_VertParams_t, projection) }, \
-	{ .name="tint", .blockIndex=UB_pbr_FragParams, .offset=STRUCT_VAR_OFFSET(pbr_FragParams_t, tint), .size=STRUCT_VAR_SIZE(pbr_FragParams_t, tint) }, \
-	{ .name="lightPos", .blockIndex=UB_pbr_FragParams, .offset=STRUCT_VAR_OFFSET(pbr_FragParams_t, lightPos), .size=STRUCT_VAR_SIZE(pbr_FragParams_t, lightPos) }, \
-	{ .name="cameraPos", .blockIndex=UB_pbr_FragParams, .offset=STRUCT_VAR_OFFSET(pbr_FragParams_t, cameraPos), .size=STRUCT_VAR_SIZE(pbr_FragParams_t, cameraPos) }, \
+	{ .name="view", .blockIndex=UB_pbr_FrameVertParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameVertParams_t, view), .size=STRUCT_VAR_SIZE(pbr_FrameVertParams_t, view) }, \
+	{ .name="projection", .blockIndex=UB_pbr_FrameVertParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameVertParams_t, projection), .size=STRUCT_VAR_SIZE(pbr_FrameVertParams_t, projection) }, \
+	{ .name="world", .blockIndex=UB_pbr_DrawVertParams, .offset=STRUCT_VAR_OFFSET(pbr_DrawVertParams_t, world), .size=STRUCT_VAR_SIZE(pbr_DrawVertParams_t, world) }, \
+	{ .name="uvTransform", .blockIndex=UB_pbr_DrawVertParams, .offset=STRUCT_VAR_OFFSET(pbr_DrawVertParams_t, uvTransform), .size=STRUCT_VAR_SIZE(pbr_DrawVertParams_t, uvTransform) }, \
+	{ .name="lightPos", .blockIndex=UB_pbr_FrameFragParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameFragParams_t, lightPos), .size=STRUCT_VAR_SIZE(pbr_FrameFragParams_t, lightPos) }, \
+	{ .name="cameraPos", .blockIndex=UB_pbr_FrameFragParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameFragParams_t, cameraPos), .size=STRUCT_VAR_SIZE(pbr_FrameFragParams_t, cameraPos) }, \
+	{ .name="ambientColor", .blockIndex=UB_pbr_FrameFragParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameFragParams_t, ambientColor), .size=STRUCT_VAR_SIZE(pbr_FrameFragParams_t, ambientColor) }, \
+	{ .name="exposureParams", .blockIndex=UB_pbr_FrameFragParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameFragParams_t, exposureParams), .size=STRUCT_VAR_SIZE(pbr_FrameFragParams_t, exposureParams) }, \
+	{ .name="tint", .blockIndex=UB_pbr_DrawFragParams, .offset=STRUCT_VAR_OFFSET(pbr_DrawFragParams_t, tint), .size=STRUCT_VAR_SIZE(pbr_DrawFragParams_t, tint) }, \
+	{ .name="surfaceParams", .blockIndex=UB_pbr_DrawFragParams, .offset=STRUCT_VAR_OFFSET(pbr_DrawFragParams_t, surfaceParams), .size=STRUCT_VAR_SIZE(pbr_DrawFragParams_t, surfaceParams) }, \
 } // These should match ShaderUniformDef struct found in gfx_shader.h
-#define pbr_SHADER_ATTR_COUNT 4
+#define pbr_SHADER_ATTR_COUNT 5
 #define pbr_SHADER_ATTR_DEFS { \
 	{ .name="position", .index=ATTR_pbr_position }, \
 	{ .name="normal", .index=ATTR_pbr_normal }, \
+	{ .name="tangent", .index=ATTR_pbr_tangent }, \
 	{ .name="texCoord0", .index=ATTR_pbr_texCoord0 }, \
 	{ .name="color0", .index=ATTR_pbr_color0 }, \
 } // These should match ShaderAttributeDef struct found in gfx_shader.h
+#define pbrDepth_SHADER_FILE_PATH "C:\\gamedev\\projects\\SokolPbrRenderer\\app\\pbr_shader.glsl"
+#define pbrDepth_SHADER_IMAGE_COUNT 0
+#define pbrDepth_SHADER_IMAGE_DEFS { \
+	{ .name=NO_ENTRIES_STR, .index=0 }, \
+} // These should match ShaderImageDef struct found in gfx_shader.h
+#define pbrDepth_SHADER_SAMPLER_COUNT 0
+#define pbrDepth_SHADER_SAMPLER_DEFS { \
+	{ .name=NO_ENTRIES_STR, .index=0 }, \
+} // These should match ShaderSamplerDef struct found in gfx_shader.h
+#define pbrDepth_SHADER_UNIFORM_COUNT 4
+#define pbrDepth_SHADER_UNIFORM_DEFS { \
+	{ .name="view", .blockIndex=UB_pbr_FrameVertParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameVertParams_t, view), .size=STRUCT_VAR_SIZE(pbr_FrameVertParams_t, view) }, \
+	{ .name="projection", .blockIndex=UB_pbr_FrameVertParams, .offset=STRUCT_VAR_OFFSET(pbr_FrameVertParams_t, projection), .size=STRUCT_VAR_SIZE(pbr_FrameVertParams_t, projection) }, \
+	{ .name="world", .blockIndex=UB_pbr_DrawVertParams, .offset=STRUCT_VAR_OFFSET(pbr_DrawVertParams_t, world), .size=STRUCT_VAR_SIZE(pbr_DrawVertParams_t, world) }, \
+	{ .name="uvTransform", .blockIndex=UB_pbr_DrawVertParams, .offset=STRUCT_VAR_OFFSET(pbr_DrawVertParams_t, uvTransform), .size=STRUCT_VAR_SIZE(pbr_DrawVertParams_t, uvTransform) }, \
+} // These should match ShaderUniformDef struct found in gfx_shader.h
+#define pbrDepth_SHADER_ATTR_COUNT 1
+#define pbrDepth_SHADER_ATTR_DEFS { \
+	{ .name="position", .index=ATTR_pbrDepth_position }, \
+} // These should match ShaderAttributeDef struct found in gfx_shader.h
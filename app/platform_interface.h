@@ -10,11 +10,26 @@ Description:
 #ifndef _PLATFORM_INTERFACE_H
 #define _PLATFORM_INTERFACE_H
 
+//Tracks every allocation that sokol_gfx and sokol_app make through the allocator callbacks in platform_sokol_alloc.c
+typedef struct SokolMemoryStats SokolMemoryStats;
+struct SokolMemoryStats
+{
+	uxx numAllocations;
+	uxx numBytesAllocated;
+	uxx highWaterNumAllocations;
+	uxx highWaterNumBytes;
+	u64 totalNumAllocations;
+	u64 totalNumBytesAllocated;
+	u64 totalNumFrees;
+	u64 numFailedAllocations;
+};
+
 typedef struct PlatformInfo PlatformInfo;
 struct PlatformInfo
 {
 	Arena* platformStdHeap;
 	Arena* platformStdHeapAllowFreeWithoutSize;
+	const SokolMemoryStats* sokolMemoryStats;
 };
 
 typedef struct AppInput AppInput;
@@ -83,12 +98,17 @@ typedef APP_UPDATE_DEF(AppUpdate_f);
 #define APP_CLOSING_DEF(functionName) void functionName(PlatformInfo* inPlatformInfo, PlatformApi* inPlatformApi, void* memoryPntr)
 typedef APP_CLOSING_DEF(AppClosing_f);
 
+// Runs the headless tests in app_tests.c without a window or graphics context, returns the number of tests that failed
+#define APP_RUN_TESTS_DEF(functionName) int functionName(PlatformInfo* inPlatformInfo, PlatformApi* inPlatformApi)
+typedef APP_RUN_TESTS_DEF(AppRunTests_f);
+
 typedef struct AppApi AppApi;
 struct AppApi
 {
 	AppInit_f* AppInit;
 	AppUpdate_f* AppUpdate;
 	AppClosing_f* AppClosing;
+	AppRunTests_f* AppRunTests;
 };
 
 #define APP_GET_API_DEF(functionName) AppApi functionName()
@@ -63,11 +63,13 @@ PlatformApi* platform = nullptr;
 // |                    Platform Source Files                     |
 // +--------------------------------------------------------------+
 #include "platform_api.c"
+#include "platform_sokol_alloc.c"
 
 // +--------------------------------------------------------------+
 // |                       Main Entry Point                       |
 // +--------------------------------------------------------------+
-void PlatSappInit(void)
+// Sets up the heaps, PlatformInfo and PlatformApi and loads the app dll. Shared by the window and the headless test run
+void PlatInitCommon()
 {
 	Arena stdHeapLocal = ZEROED;
 	InitArenaStdHeap(&stdHeapLocal);
@@ -80,27 +82,12 @@ void PlatSappInit(void)
 	FlagSet(platformData->stdHeapAllowFreeWithoutSize.flags, ArenaFlag_AllowFreeWithoutSize);
 	InitScratchArenasVirtual(Gigabytes(4));
 	
-	ScratchBegin(loadScratch);
-	
-	#if BUILD_WITH_BULLET
-	void* physicsWorld = InitBulletPhysics(stdHeap);
-	FreeBulletPhysics(stdHeap, physicsWorld);
-	// void* pntr = TestAllocatingClasses(stdHeap);
-	// TestFreeingClasses(stdHeap, pntr);
-	#endif
-	
-	InitKeyboardState(&platformData->appInputs[0].keyboard);
-	InitKeyboardState(&platformData->appInputs[1].keyboard);
-	InitMouseState(&platformData->appInputs[0].mouse);
-	InitMouseState(&platformData->appInputs[1].mouse);
-	platformData->currentAppInput = &platformData->appInputs[0];
-	platformData->oldAppInput = &platformData->appInputs[1];
-	
 	platformInfo = AllocType(PlatformInfo, stdHeap);
 	NotNull(platformInfo);
 	ClearPointer(platformInfo);
 	platformInfo->platformStdHeap = stdHeap;
 	platformInfo->platformStdHeapAllowFreeWithoutSize = &platformData->stdHeapAllowFreeWithoutSize;
+	platformInfo->sokolMemoryStats = &sokolAllocator.stats;
 	
 	platform = AllocType(PlatformApi, stdHeap);
 	NotNull(platform);
@@ -135,19 +122,40 @@ void PlatSappInit(void)
 		platformData->appApi = appGetApi();
 		NotNull(platformData->appApi.AppInit);
 		NotNull(platformData->appApi.AppUpdate);
+		NotNull(platformData->appApi.AppRunTests);
 	}
 	#endif
+}
+
+void PlatSappInit(void)
+{
+	PlatInitCommon();
+	ScratchBegin(loadScratch);
+	
+	#if BUILD_WITH_BULLET
+	void* physicsWorld = InitBulletPhysics(stdHeap);
+	FreeBulletPhysics(stdHeap, physicsWorld);
+	// void* pntr = TestAllocatingClasses(stdHeap);
+	// TestFreeingClasses(stdHeap, pntr);
+	#endif
+	
+	InitKeyboardState(&platformData->appInputs[0].keyboard);
+	InitKeyboardState(&platformData->appInputs[1].keyboard);
+	InitMouseState(&platformData->appInputs[0].mouse);
+	InitMouseState(&platformData->appInputs[1].mouse);
+	platformData->currentAppInput = &platformData->appInputs[0];
+	platformData->oldAppInput = &platformData->appInputs[1];
 	
 	//TODO: Should we do an early call into app dll to get options?
 	
 	InitSokolGraphics((sg_desc){
-		// .buffer_pool_size = ?; //int
-		// .image_pool_size = ?; //int
-		// .sampler_pool_size = ?; //int
-		// .shader_pool_size = ?; //int
-		// .pipeline_pool_size = ?; //int
-		// .attachments_pool_size = ?; //int
-		// .uniform_buffer_size = ?; //int
+		.buffer_pool_size = SOKOL_BUFFER_POOL_SIZE,
+		.image_pool_size = SOKOL_IMAGE_POOL_SIZE,
+		.sampler_pool_size = SOKOL_SAMPLER_POOL_SIZE,
+		.shader_pool_size = SOKOL_SHADER_POOL_SIZE,
+		.pipeline_pool_size = SOKOL_PIPELINE_POOL_SIZE,
+		.attachments_pool_size = SOKOL_ATTACHMENTS_POOL_SIZE,
+		.uniform_buffer_size = SOKOL_UNIFORM_BUFFER_SIZE,
 		// .max_commit_listeners = ?; //int
 		// .disable_validation = ?; //bool    // disable validation layer even in debug mode, useful for tests
 		// .d3d11_shader_debugging = ?; //bool    // if true, HLSL shaders are compiled with D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION
@@ -155,7 +163,7 @@ void PlatSappInit(void)
 		// .mtl_use_command_buffer_with_retained_references = ?; //bool    // Metal: use a managed MTLCommandBuffer which ref-counts used resources
 		// .wgpu_disable_bindgroups_cache = ?; //bool  // set to true to disable the WebGPU backend BindGroup cache
 		// .wgpu_bindgroups_cache_size = ?; //int      // number of slots in the WebGPU bindgroup cache (must be 2^N)
-		// .allocator = ?; //sg_allocator TODO: Fill this out!
+		.allocator = GetSokolGfxAllocator(),
 		.environment = CreateSokolAppEnvironment(),
 		.logger.func = SokolLogCallback,
 		
@@ -178,6 +186,8 @@ void PlatSappCleanup(void)
 {
 	platformData->appApi.AppClosing(platformInfo, platform, platformData->appMemoryPntr);
 	ShutdownSokolGraphics();
+	//sokol_app still holds its own allocations until after this callback returns, so only sokol_gfx's are checked here
+	if (sokolAllocator.numGfxAllocations > 0) { PrintLine_W("sokol_gfx leaked %llu allocation%s (%llu bytes) at shutdown", (u64)sokolAllocator.numGfxAllocations, Plural(sokolAllocator.numGfxAllocations, "s"), (u64)sokolAllocator.numGfxBytesAllocated); }
 }
 
 void PlatSappEvent(const sapp_event* event)
@@ -280,8 +290,16 @@ void PlatSappFrame(void)
 
 sapp_desc sokol_main(int argc, char* argv[])
 {
-	UNUSED(argc);
-	UNUSED(argv);
+	// "--run-tests" runs the app's headless tests (no window or graphics) and exits with a non-zero code if any failed
+	for (int aIndex = 1; aIndex < argc; aIndex++)
+	{
+		if (strcmp(argv[aIndex], "--run-tests") == 0)
+		{
+			PlatInitCommon();
+			int numFailedTests = platformData->appApi.AppRunTests(platformInfo, platform);
+			exit((numFailedTests > 0) ? 1 : 0);
+		}
+	}
 	return (sapp_desc){
 		.init_cb = PlatSappInit,
 		.frame_cb = PlatSappFrame,
@@ -291,6 +309,7 @@ sapp_desc sokol_main(int argc, char* argv[])
 		.height = 600,
 		.window_title = "Loading...",
 		.icon.sokol_default = false,
+		.allocator = GetSokolAppAllocator(),
 		.logger.func = SokolLogCallback,
 	};
 }
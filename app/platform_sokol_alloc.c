@@ -0,0 +1,109 @@
+/*
+File:   platform_sokol_alloc.c
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the sg_allocator and sapp_allocator callbacks that route all of sokol_gfx
+	** and sokol_app's internal allocations through a dedicated Arena so we can track them.
+	** NOTE: sokol_app allocates before PlatSappInit is called (inside sapp_run) so the
+	** arena is lazily initialized on the first allocation rather than in PlatSappInit
+	** NOTE: sokol_app only frees its own state after cleanup_cb returns, so the leak report in
+	** PlatSappCleanup only looks at sokol_gfx's allocations, which are tracked separately for that reason
+*/
+
+// Every allocation is prefixed with a header holding the size because sokol's free_fn doesn't tell us the size
+// The header is 16 bytes so the pointer we hand back to sokol keeps malloc's alignment
+typedef struct SokolAllocHeader SokolAllocHeader;
+struct SokolAllocHeader
+{
+	uxx size;
+	u64 magic;
+};
+#define SOKOL_ALLOC_HEADER_MAGIC 0x534F4B4F4C414C43ULL //"SOKOLALC"
+
+typedef struct SokolAllocator SokolAllocator;
+struct SokolAllocator
+{
+	bool initialized;
+	Arena arena;
+	SokolMemoryStats stats; //both libraries combined
+	uxx numGfxAllocations;
+	uxx numGfxBytesAllocated;
+};
+
+static SokolAllocator sokolAllocator = ZEROED;
+
+void InitSokolAllocatorIfNeeded()
+{
+	if (!sokolAllocator.initialized)
+	{
+		InitArenaStdHeap(&sokolAllocator.arena);
+		ClearPointer(&sokolAllocator.stats);
+		sokolAllocator.numGfxAllocations = 0;
+		sokolAllocator.numGfxBytesAllocated = 0;
+		sokolAllocator.initialized = true;
+	}
+}
+
+static void* PlatSokolAlloc(size_t size, void* userData, bool isGfx)
+{
+	SokolAllocator* allocator = (SokolAllocator*)userData;
+	NotNull(allocator);
+	InitSokolAllocatorIfNeeded();
+	uxx totalSize = sizeof(SokolAllocHeader) + (uxx)size;
+	SokolAllocHeader* header = (SokolAllocHeader*)AllocMem(&allocator->arena, totalSize);
+	if (header == nullptr) { allocator->stats.numFailedAllocations++; return nullptr; }
+	header->size = (uxx)size;
+	header->magic = SOKOL_ALLOC_HEADER_MAGIC;
+	
+	allocator->stats.numAllocations++;
+	allocator->stats.numBytesAllocated += (uxx)size;
+	allocator->stats.totalNumAllocations++;
+	allocator->stats.totalNumBytesAllocated += (u64)size;
+	if (allocator->stats.numBytesAllocated > allocator->stats.highWaterNumBytes) { allocator->stats.highWaterNumBytes = allocator->stats.numBytesAllocated; }
+	if (allocator->stats.numAllocations > allocator->stats.highWaterNumAllocations) { allocator->stats.highWaterNumAllocations = allocator->stats.numAllocations; }
+	if (isGfx)
+	{
+		allocator->numGfxAllocations++;
+		allocator->numGfxBytesAllocated += (uxx)size;
+	}
+	return (void*)(header + 1);
+}
+
+static void PlatSokolFree(void* pntr, void* userData, bool isGfx)
+{
+	if (pntr == nullptr) { return; }
+	SokolAllocator* allocator = (SokolAllocator*)userData;
+	NotNull(allocator);
+	Assert(allocator->initialized);
+	SokolAllocHeader* header = ((SokolAllocHeader*)pntr) - 1;
+	Assert(header->magic == SOKOL_ALLOC_HEADER_MAGIC);
+	Assert(allocator->stats.numAllocations > 0);
+	Assert(allocator->stats.numBytesAllocated >= header->size);
+	allocator->stats.numAllocations--;
+	allocator->stats.numBytesAllocated -= header->size;
+	allocator->stats.totalNumFrees++;
+	if (isGfx)
+	{
+		Assert(allocator->numGfxAllocations > 0 && allocator->numGfxBytesAllocated >= header->size);
+		allocator->numGfxAllocations--;
+		allocator->numGfxBytesAllocated -= header->size;
+	}
+	uxx totalSize = sizeof(SokolAllocHeader) + header->size;
+	header->magic = 0;
+	FreeMem(&allocator->arena, header, totalSize);
+}
+
+void* PlatSokolGfxAlloc(size_t size, void* userData) { return PlatSokolAlloc(size, userData, true); }
+void PlatSokolGfxFree(void* pntr, void* userData) { PlatSokolFree(pntr, userData, true); }
+void* PlatSokolAppAlloc(size_t size, void* userData) { return PlatSokolAlloc(size, userData, false); }
+void PlatSokolAppFree(void* pntr, void* userData) { PlatSokolFree(pntr, userData, false); }
+
+sg_allocator GetSokolGfxAllocator()
+{
+	return (sg_allocator){ .alloc_fn = PlatSokolGfxAlloc, .free_fn = PlatSokolGfxFree, .user_data = &sokolAllocator };
+}
+sapp_allocator GetSokolAppAllocator()
+{
+	return (sapp_allocator){ .alloc_fn = PlatSokolAppAlloc, .free_fn = PlatSokolAppFree, .user_data = &sokolAllocator };
+}